@@ -12,6 +12,11 @@ file(GLOB TINYCV_AARCH64_SRC
      src/tinycv/arm/*.cpp)
 list(APPEND TINYCV_SRC ${TINYCV_AARCH64_SRC})
 
+# the conversions round src * scale + bias the same way on every path, the compiler must not fuse mul and add
+if(NOT MSVC)
+    set_property(SOURCE ${CMAKE_CURRENT_SOURCE_DIR}/src/tinycv/arm/convert.cpp APPEND_STRING PROPERTY COMPILE_FLAGS " -ffp-contract=off")
+endif()
+
 # glob benchmark and unittest sources
 file(GLOB TINYCV_AARCH64_BENCHMARK_SRC "src/tinycv/arm/*_benchmark.cpp")
 file(GLOB TINYCV_AARCH64_UNITTEST_SRC "src/tinycv/arm/*_unittest.cpp")
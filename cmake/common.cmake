@@ -45,7 +45,7 @@ else()
     # forces to define a virtual destructor in a class when having virtual functions, though it is not necessary for all cases
     tinycv_append_cxx_compiler_flags("-Werror=non-virtual-dtor")
 
-    set(FMA_ENABLED_FLAGS "-mfma -mavx2")
+    set(FMA_ENABLED_FLAGS "-mfma -mavx2 -mf16c")
     set(AVX_ENABLED_FLAGS "-mavx")
     set(SSE_ENABLED_FLAGS "-msse -msse2 -msse3 -msse4.1")
     set(AVX512_ENABLED_FLAGS "-mavx512f")
@@ -30,6 +30,11 @@ endforeach()
 foreach(filename ${TINYCV_X86_SSE_SRC})
     set_source_files_properties(${filename} PROPERTIES COMPILE_FLAGS "${SSE_ENABLED_FLAGS}")
 endforeach()
+# the conversions round src * scale + bias the same way on every path, the compiler must not fuse mul and add
+if(NOT MSVC)
+    set_property(SOURCE ${CMAKE_CURRENT_SOURCE_DIR}/src/tinycv/x86/convert.cpp ${CMAKE_CURRENT_SOURCE_DIR}/src/tinycv/x86/fma/convert_fma.cpp
+                 APPEND_STRING PROPERTY COMPILE_FLAGS " -ffp-contract=off")
+endif()
 
 list(APPEND TINYCV_SRC ${TINYCV_X86_SRC})
 
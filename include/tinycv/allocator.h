@@ -0,0 +1,65 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_ALLOCATOR_H_
+#define __ST_TINYCV_ALLOCATOR_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+/**
+ * @brief Memory functions the library allocates with instead of the system's aligned allocation.
+ * `alloc` returns at least `size` bytes aligned to `alignment`, a power of two, or `nullptr` on failure.
+ * `free` releases a pointer returned by `alloc` and is never called with `nullptr`. Both get `user` back.
+ ***************************************************************************************************/
+struct Allocator {
+    void *(*alloc)(uint64_t size, uint32_t alignment, void *user);
+    void (*free)(void *p, void *user);
+    void *user;
+};
+
+/**
+ * @brief Installs `allocator` for every allocation of the library, `nullptr` restores the default one.
+ * It may be called at any time, from any thread. Memory is always freed by the allocator it came from, so a
+ * replaced allocator has to stay usable until its last block is freed: the scratch arenas are given back
+ * once they are empty and when their thread exits, StreamContext buffers when the context is destroyed.
+ ***************************************************************************************************/
+void SetAllocator(const Allocator *allocator);
+
+/**
+ * @brief Sets the size of the scratch arenas, 4 MiB by default.
+ * Kernels take their temporary tables and row buffers from an arena owned by the calling thread, allocated
+ * on its first use and released when the thread exits, so repeated calls do not go through the allocator.
+ * A temporary that does not fit is allocated and freed by the allocator for that call. The new size
+ * applies to each thread's arena the next time it is used while empty, 0 disables the arenas.
+ ***************************************************************************************************/
+void SetScratchArenaSize(uint64_t size);
+
+/**
+ * @brief Size of the scratch arenas, as set by SetScratchArenaSize.
+ ***************************************************************************************************/
+uint64_t GetScratchArenaSize();
+
+/**
+ * @brief Returns the calling thread's scratch arena to the allocator, the next kernel call allocates a new one.
+ ***************************************************************************************************/
+void ReleaseScratchArena();
+
+} // namespace tinycv
+
+#endif //! __ST_TINYCV_ALLOCATOR_H_
@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_BOXFILTER_H_
+#define __ST_TINYCV_BOXFILTER_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+/**
+ * @brief Sums or averages every pixel's kernelWidth x kernelHeight neighborhood, anchored at the kernel center,
+ * same results as OpenCV's `boxFilter` with the output depth of the input. Running sums are kept down the
+ * columns and slid along the rows, each pixel costs the same whatever the kernel size. Borders are resolved on
+ * the fly with the semantics of `CopyMakeBorder`, no padded copy of the image is made.
+ * @tparam T The data type, used for both input image and output image, currently \a uint8_t and \a float are supported.
+ * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `width * channels`
+ * @param outData           output image data, must not overlap `inData`
+ * @param kernelWidth       kernel width
+ * @param kernelHeight      kernel height
+ * @param normalize         whether the sums are divided by the kernel area, unnormalized \a uint8_t sums saturate
+ * @param border_type       ways to deal with border. BORDER_REFLECT_101, BORDER_REFLECT, BORDER_CONSTANT and
+ * BORDER_REPLICATE are supported
+ * @param border_value      padding value when border_type is BORDER_CONSTANT
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+void BoxFilter(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t kernelWidth,
+    int32_t kernelHeight,
+    bool normalize = true,
+    BorderType border_type = BORDER_DEFAULT,
+    T border_value = 0);
+
+/**
+ * @brief Normalized box filter, same results as OpenCV's `blur`. See `BoxFilter`.
+ * @tparam T The data type, used for both input image and output image, currently \a uint8_t and \a float are supported.
+ * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `width * channels`
+ * @param outData           output image data, must not overlap `inData`
+ * @param kernelWidth       kernel width
+ * @param kernelHeight      kernel height
+ * @param border_type       ways to deal with border, see `BoxFilter`
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+void Blur(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t kernelWidth,
+    int32_t kernelHeight,
+    BorderType border_type = BORDER_DEFAULT);
+
+} // namespace tinycv
+
+#endif //!__ST_TINYCV_BOXFILTER_H_
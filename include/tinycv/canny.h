@@ -0,0 +1,62 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_CANNY_H_
+#define __ST_TINYCV_CANNY_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+/**
+ * @brief Finds edges in a gray image with the Canny algorithm, same results as OpenCV's `Canny`. The \a int16_t
+ * Sobel derivatives (border replicated), their magnitude and the non-maximum suppression are streamed through a
+ * ring of three rows, so only the edge map is image sized. Local maxima above `threshold2` seed a stack of map
+ * offsets, the hysteresis pops them and grows edges into neighbouring local maxima above `threshold1`.
+ * When `numThreads > 1` the image is cut into row bands, each band is suppressed and traced on its own, then
+ * edges reaching a band seam are continued across it.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input gray image data
+ * @param outWidthStride    output image's width stride, usually it equals to `width`
+ * @param outData           output edge image data, 255 on edges and 0 elsewhere, must not overlap `inData`
+ * @param threshold1        first threshold for the hysteresis, the lower of the two is for edge growing
+ * @param threshold2        second threshold for the hysteresis, the higher of the two is for edge seeds
+ * @param apertureSize      aperture size of the Sobel operator, 3, 5 or 7, -1 for the 3x3 Scharr operator.
+ *                          As in OpenCV the 7x7 derivatives and both thresholds are divided by 16, and OpenCV
+ *                          only accepts the Scharr operator together with `L2gradient`
+ * @param L2gradient        whether the magnitude is `sqrt(dx * dx + dy * dy)` instead of `|dx| + |dy|`
+ * @param numThreads        number of threads, large frames only
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+void Canny(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    double threshold1,
+    double threshold2,
+    int32_t apertureSize = 3,
+    bool L2gradient = false,
+    int32_t numThreads = 1);
+
+} // namespace tinycv
+
+#endif //!__ST_TINYCV_CANNY_H_
@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_CONNECTEDCOMPONENTS_H_
+#define __ST_TINYCV_CONNECTEDCOMPONENTS_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+/**
+ * \brief
+ * Columns of the statistics written by `ConnectedComponentsWithStats`, same values as OpenCV's
+ * `ConnectedComponentsTypes`.
+ **********************************/
+enum ConnectedComponentsStat {
+    CC_STAT_LEFT = 0, //!< leftmost column of the bounding box
+    CC_STAT_TOP = 1, //!< topmost row of the bounding box
+    CC_STAT_WIDTH = 2, //!< width of the bounding box
+    CC_STAT_HEIGHT = 3, //!< height of the bounding box
+    CC_STAT_AREA = 4, //!< number of pixels
+    CC_STAT_MAX = 5
+};
+
+/**
+ * @brief Labels the connected components of the nonzero pixels of a mask, zero pixels get label 0 and the
+ * components labels 1 to `n - 1`. 8-connectivity scans 2x2 blocks two rows at a time, a few pixels around
+ * each block decide which of the four neighbouring blocks above and on the left it joins, like Grana's
+ * block based scan. 4-connectivity scans pixels like Wu's SAUF. Equivalent provisional labels are merged in a
+ * union-find array, flattened to consecutive labels before the second pass writes them.
+ * When `numThreads > 1` the image is cut into row bands with disjoint provisional labels, the components
+ * crossing a band seam are merged before the second pass.
+ * The partition is the same as OpenCV's `connectedComponents`, the numbering of the components may differ.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input mask data
+ * @param labelsWidthStride label image's width stride in elements, usually it equals to `width`
+ * @param labels            label image data
+ * @param connectivity      4 or 8
+ * @param numThreads        number of threads, large frames only
+ * @return the number of labels `n`, background included, 0 for invalid parameters
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+int32_t ConnectedComponents(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t labelsWidthStride,
+    int32_t *labels,
+    int32_t connectivity = 8,
+    int32_t numThreads = 1);
+
+/**
+ * @brief Labels the connected components of a mask like `ConnectedComponents` and measures every label,
+ * background included. The statistics are gathered over runs of equal labels while the labels are written.
+ * As the number of labels is only known at the end, statistics are written for the first `maxLabels` labels,
+ * a return value above `maxLabels` tells the buffers were too small. `ceil(height / 2) * ceil(width / 2) + 1`
+ * labels are always enough for 8-connectivity, `height * ceil(width / 2) + 1` for 4-connectivity.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input mask data
+ * @param labelsWidthStride label image's width stride in elements, usually it equals to `width`
+ * @param labels            label image data
+ * @param maxLabels         number of labels `stats` and `centroids` have room for
+ * @param stats             `CC_STAT_MAX` values per label, see `ConnectedComponentsStat`
+ * @param centroids         x and y of the centroid of every label, may be nullptr
+ * @param connectivity      4 or 8
+ * @param numThreads        number of threads, large frames only
+ * @return the number of labels `n`, background included, 0 for invalid parameters
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+int32_t ConnectedComponentsWithStats(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t labelsWidthStride,
+    int32_t *labels,
+    int32_t maxLabels,
+    int32_t *stats,
+    double *centroids,
+    int32_t connectivity = 8,
+    int32_t numThreads = 1);
+
+} // namespace tinycv
+
+#endif //!__ST_TINYCV_CONNECTEDCOMPONENTS_H_
@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_CONVERT_H_
+#define __ST_TINYCV_CONVERT_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+/**
+ * @brief Convert an image to float and normalize every channel with `(src - mean) * scale` in a single pass,
+ * optionally swapping the R and B channels and writing planar (CHW) output. This is the usual last step before
+ * feeding an image to a network, e.g. BGR `uint8_t` to normalized RGB planes.
+ * @tparam T The data type of input image, currently \a uint8_t and \a float are supported.
+ * @tparam nc The number of channels of input and output image, 1, 3 and 4 are supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * nc`
+ * @param inData            input image data
+ * @param mean              per channel mean with `nc` values, given in output channel order
+ * @param scale             per channel scale with `nc` values (usually `1 / std`), given in output channel order
+ * @param swapRB            swap the first and the third channel (BGR <-> RGB), ignored when `nc` is 1
+ * @param planar            write every channel to its own plane instead of interleaving them
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * nc` for interleaved
+ *                          output and `width` for planar output, where channel `c` starts at `outData + c * height * outWidthStride`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename T, int32_t nc>
+void ConvertNormalize(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    const float* mean,
+    const float* scale,
+    bool swapRB,
+    bool planar,
+    int32_t outWidthStride,
+    float* outData);
+
+/**
+ * @brief Convert an image to another depth with optional scaling, `dst = saturate_cast<TDst>(src * alpha + beta)`.
+ * Integer results are rounded to nearest even and saturated to the range of \a TDst, like `cv::Mat::convertTo`.
+ * @tparam TSrc The data type of input image, \a uint8_t, \a int16_t, \a uint16_t and \a float are supported.
+ * @tparam TDst The data type of output image, \a uint8_t, \a int16_t, \a uint16_t and \a float are supported.
+ * @tparam nc The number of channels of input and output image, 1, 3 and 4 are supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * nc`
+ * @param inData            input image data
+ * @param alpha             scale factor applied to every element
+ * @param beta              delta added to every element after scaling
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * nc`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Every channel is scaled with the same `alpha` and `beta`.
+ ***************************************************************************************************/
+template <typename TSrc, typename TDst, int32_t nc>
+void ConvertTo(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const TSrc* inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    TDst* outData);
+
+} // namespace tinycv
+
+#endif //! __ST_TINYCV_CONVERT_H_
@@ -24,7 +24,7 @@ namespace tinycv {
     
 /**
  * @brief Copy the source image into the middle of dest image, and make border pixels according to specific border type.
- * @tparam T The data type of input image, currently \a float and \a uint8_t are supported.
+ * @tparam T The data type of input image, currently \a float, \a uint8_t, \a uint16_t, \a int16_t and \a half_t are supported.
  * @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
  * @param srcHeight         input image's height
  * @param srcWidth          input image's width need to be processed
@@ -68,7 +68,7 @@ void BGRA2BGR(
 
 /**
  * @brief Convert RGB images to GRAY images
- * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam T The data type, used for both input image and output image, currently \a uint8_t, \a float and \a half_t are supported.
  * @tparam ncSrc The number of channels of input image, 3 is supported.
  * @tparam ncDst The number of channels of output image, 1 is supported.
  * @param height            input image's height
@@ -90,7 +90,7 @@ void RGB2GRAY(
 
 /**
  * @brief Convert GRAY images to RGB images
- * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam T The data type, used for both input image and output image, currently \a uint8_t, \a float and \a half_t are supported.
  * @tparam ncSrc The number of channels of input image, 1 is supported.
  * @tparam ncDst The number of channels of output image, 3 is supported.
  * @param height            input image's height
@@ -112,7 +112,7 @@ void GRAY2RGB(
 
 /**
  * @brief Convert RGBA images to GRAY images
- * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam T The data type, used for both input image and output image, currently \a uint8_t, \a float and \a half_t are supported.
  * @tparam ncSrc The number of channels of input image, 4 is supported.
  * @tparam ncDst The number of channels of output image, 1 is supported.
  * @param height            input image's height
@@ -134,7 +134,7 @@ void RGBA2GRAY(
 
 /**
  * @brief Convert GRAY images to RGBA images
- * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam T The data type, used for both input image and output image, currently \a uint8_t, \a float and \a half_t are supported.
  * @tparam ncSrc The number of channels of input image, 1 is supported.
  * @tparam ncDst The number of channels of output image, 4 is supported.
  * @param height            input image's height
@@ -157,7 +157,7 @@ void GRAY2RGBA(
 // BGR_GRAY
 /**
  * @brief Convert BGR images to GRAY images
- * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam T The data type, used for both input image and output image, currently \a uint8_t, \a float and \a half_t are supported.
  * @tparam ncSrc The number of channels of input image, 3 is supported.
  * @tparam ncDst The number of channels of output image, 1 is supported.
  * @param height            input image's height
@@ -179,7 +179,7 @@ void BGR2GRAY(
 
 /**
  * @brief Convert GRAY images to BGR images
- * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam T The data type, used for both input image and output image, currently \a uint8_t, \a float and \a half_t are supported.
  * @tparam ncSrc The number of channels of input image, 1 is supported.
  * @tparam ncDst The number of channels of output image, 3 is supported.
  * @param height            input image's height
@@ -201,7 +201,7 @@ void GRAY2BGR(
 
 /**
  * @brief Convert BGRA images to GRAY images
- * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam T The data type, used for both input image and output image, currently \a uint8_t, \a float and \a half_t are supported.
  * @tparam ncSrc The number of channels of input image, 4 is supported.
  * @tparam ncDst The number of channels of output image, 1 is supported.
  * @param height            input image's height
@@ -223,7 +223,7 @@ void BGRA2GRAY(
 
 /**
  * @brief Convert GRAY images to BGRA images
- * @tparam T The data type, used for both input image and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam T The data type, used for both input image and output image, currently \a uint8_t, \a float and \a half_t are supported.
  * @tparam ncSrc The number of channels of input image, 1 is supported.
  * @tparam ncDst The number of channels of output image, 4 is supported.
  * @param height            input image's height
@@ -1735,6 +1735,258 @@ void NV122I420(
     int32_t outStrideV,
     T* outDataV);
 
+/**
+ * @brief Convert BayerBG (RGGB) raw images to BGR images with bilinear interpolation
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw bayer image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * 3`
+ * @param outData           output image data
+ * @note The pattern is named after the second row, second and third columns, the same as the `COLOR_Bayer*2BGR` codes of OpenCV.
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ****************************************************************************************************/
+template <typename T>
+void BayerBG2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BayerGB (GRBG) raw images to BGR images with bilinear interpolation
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw bayer image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * 3`
+ * @param outData           output image data
+ * @note The pattern is named after the second row, second and third columns, the same as the `COLOR_Bayer*2BGR` codes of OpenCV.
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ****************************************************************************************************/
+template <typename T>
+void BayerGB2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BayerRG (BGGR) raw images to BGR images with bilinear interpolation
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw bayer image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * 3`
+ * @param outData           output image data
+ * @note The pattern is named after the second row, second and third columns, the same as the `COLOR_Bayer*2BGR` codes of OpenCV.
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ****************************************************************************************************/
+template <typename T>
+void BayerRG2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BayerGR (GBRG) raw images to BGR images with bilinear interpolation
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw bayer image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * 3`
+ * @param outData           output image data
+ * @note The pattern is named after the second row, second and third columns, the same as the `COLOR_Bayer*2BGR` codes of OpenCV.
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ****************************************************************************************************/
+template <typename T>
+void BayerGR2BGR(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BayerBG (RGGB) raw images to BGR images with edge-aware interpolation
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw bayer image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * 3`
+ * @param outData           output image data
+ * @note Green is interpolated along the direction of the smaller gradient, which avoids the zipper artifacts of the bilinear conversion.
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ****************************************************************************************************/
+template <typename T>
+void BayerBG2BGR_EA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BayerGB (GRBG) raw images to BGR images with edge-aware interpolation
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw bayer image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * 3`
+ * @param outData           output image data
+ * @note Green is interpolated along the direction of the smaller gradient, which avoids the zipper artifacts of the bilinear conversion.
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ****************************************************************************************************/
+template <typename T>
+void BayerGB2BGR_EA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BayerRG (BGGR) raw images to BGR images with edge-aware interpolation
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw bayer image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * 3`
+ * @param outData           output image data
+ * @note Green is interpolated along the direction of the smaller gradient, which avoids the zipper artifacts of the bilinear conversion.
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ****************************************************************************************************/
+template <typename T>
+void BayerRG2BGR_EA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BayerGR (GBRG) raw images to BGR images with edge-aware interpolation
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw bayer image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * 3`
+ * @param outData           output image data
+ * @note Green is interpolated along the direction of the smaller gradient, which avoids the zipper artifacts of the bilinear conversion.
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ****************************************************************************************************/
+template <typename T>
+void BayerGR2BGR_EA(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BayerBG (RGGB) raw images to half sized BGR images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw bayer image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `(width / 2) * 3`
+ * @param outData           output image data
+ * @note Each 2x2 bayer cell produces one output pixel, so the output image is `height / 2` x `width / 2`. It is cheaper than a full demosaic followed by a resize and suits preview streams.
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ****************************************************************************************************/
+template <typename T>
+void BayerBG2BGRHalf(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BayerGB (GRBG) raw images to half sized BGR images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw bayer image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `(width / 2) * 3`
+ * @param outData           output image data
+ * @note Each 2x2 bayer cell produces one output pixel, so the output image is `height / 2` x `width / 2`. It is cheaper than a full demosaic followed by a resize and suits preview streams.
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ****************************************************************************************************/
+template <typename T>
+void BayerGB2BGRHalf(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BayerRG (BGGR) raw images to half sized BGR images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw bayer image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `(width / 2) * 3`
+ * @param outData           output image data
+ * @note Each 2x2 bayer cell produces one output pixel, so the output image is `height / 2` x `width / 2`. It is cheaper than a full demosaic followed by a resize and suits preview streams.
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ****************************************************************************************************/
+template <typename T>
+void BayerRG2BGRHalf(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Convert BayerGR (GBRG) raw images to half sized BGR images
+ * @tparam T The data type, used for both input image and output image, currently only \a uint8_t is supported.
+ * @param height            input image's height
+ * @param width             input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input raw bayer image data
+ * @param outWidthStride    the width stride of output image, usually it equals to `(width / 2) * 3`
+ * @param outData           output image data
+ * @note Each 2x2 bayer cell produces one output pixel, so the output image is `height / 2` x `width / 2`. It is cheaper than a full demosaic followed by a resize and suits preview streams.
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ****************************************************************************************************/
+template <typename T>
+void BayerGR2BGRHalf(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outWidthStride,
+    T* outData);
+
 } // namespace tinycv
 
 #endif //! __ST_TINYCV_CVTCOLOR_H_
@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_DISTANCETRANSFORM_H_
+#define __ST_TINYCV_DISTANCETRANSFORM_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+/**
+ * \brief
+ * Distance type of `DistanceTransform`, same values as OpenCV's `DistanceTypes`.
+ **********************************/
+enum DistanceType {
+    DIST_L1 = 1, //!< `|x1 - x2| + |y1 - y2|`
+    DIST_L2 = 2, //!< euclidean distance, approximated by the chamfer mask
+    DIST_C = 3 //!< `max(|x1 - x2|, |y1 - y2|)`
+};
+
+/**
+ * @brief Distance of every nonzero pixel to the nearest zero pixel with a two pass chamfer algorithm, like
+ * OpenCV's `distanceTransform` with a \a float output. The forward pass runs top to bottom and the backward pass
+ * bottom to top. In each row the neighbours from the rows already done are taken for a whole vector of pixels at
+ * once, then the dependency on the previous pixel of the row is resolved by an in-register min-plus prefix scan.
+ * `DIST_L1` and `DIST_C` always use the 3x3 mask and are computed in 16.16 fixed point, their results are exact.
+ * `DIST_L2` adds OpenCV's 3x3 or 5x5 chamfer weights in float, each sum rounded as a scalar loop would; OpenCV's
+ * vectorised loops round some of them in another order, the results differ by less than 1e-5 relative.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input mask data
+ * @param outWidthStride    output image's width stride, usually it equals to `width`
+ * @param outData           output distance data
+ * @param distanceType      type of distance
+ * @param maskSize          size of the chamfer mask, 3 or 5
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @warning Without any zero pixel the distances are all `FLT_MAX` for `DIST_L2`, as in OpenCV, and about 8192
+ * for `DIST_L1` and `DIST_C`.
+ ***************************************************************************************************/
+void DistanceTransform(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    DistanceType distanceType,
+    int32_t maskSize = 3);
+
+} // namespace tinycv
+
+#endif //!__ST_TINYCV_DISTANCETRANSFORM_H_
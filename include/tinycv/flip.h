@@ -24,7 +24,7 @@ namespace tinycv {
 
 /**
  * @brief Flips a 2D array around vertical, horizontal, or both axes. Support in-place operation;
- * @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam T The data type of input and output image, currently \a uint8_t, \a uint16_t, \a int16_t, \a float and \a half_t are supported.
  * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
  * @param height            input image's height
  * @param width             input image's width
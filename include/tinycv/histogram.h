@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_HISTOGRAM_H_
+#define __ST_TINYCV_HISTOGRAM_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+/**
+ * @brief Counts the pixels of every value of a single channel image. The pixels are spread over four
+ * sub-histograms which are summed at the end, so that runs of equal pixels do not wait on the same counter.
+ * The Y plane of an NV12 or I420 frame can be passed as is, with the frame's width stride.
+ * @param inHeight          input image's height
+ * @param inWidth           input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input image data
+ * @param hist              256 counters, overwritten
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+void CalcHist(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    uint32_t *hist);
+
+/**
+ * @brief Equalizes the histogram of a single channel image through a lookup table built from the cumulative
+ * histogram. Same results as OpenCV's `equalizeHist`. `outData` may be `inData`, so the Y plane of an NV12 or
+ * I420 frame can be equalized in place.
+ * @param inHeight          input image's height
+ * @param inWidth           input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `width`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+void EqualizeHist(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+/**
+ * @brief Contrast limited adaptive histogram equalization of a single channel image. The image is cut into
+ * `tilesX * tilesY` tiles, every tile gets a lookup table from its clipped histogram and the pixels are mapped
+ * through the bilinear interpolation of the four nearest tables. Same results as OpenCV's `CLAHE::apply`,
+ * tiles crossing the right or bottom border are completed with `BORDER_REFLECT_101` without padding the image.
+ * `outData` may be `inData`, so the Y plane of an NV12 or I420 frame can be processed in place.
+ * @param inHeight          input image's height
+ * @param inWidth           input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `width`
+ * @param outData           output image data
+ * @param clipLimit         contrast limit, relative to the mean bin count of a tile, `<= 0` disables clipping
+ * @param tilesX            number of tiles in a row
+ * @param tilesY            number of tiles in a column
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+void CLAHE(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    float clipLimit = 40.0f,
+    int32_t tilesX = 8,
+    int32_t tilesY = 8);
+
+} // namespace tinycv
+
+#endif //!__ST_TINYCV_HISTOGRAM_H_
@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_INTEGRAL_H_
+#define __ST_TINYCV_INTEGRAL_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+/**
+ * @brief Computes the integral image `sum(X, Y) = Σ_{x < X, y < Y} in(x, y)` of every channel, the output has
+ * one more row and column than the input and its first row and column are zero. Same results as OpenCV's
+ * `integral`. Rows are scanned with in-register prefix sums and added to the previous output row.
+ * When `numThreads > 1` the image is cut into row bands, the column sums of every band are gathered first so
+ * that each band can then start from its exact top row and the bands are computed independently.
+ * @tparam Tsum The data type of output image, currently only \a int32_t and \a double are supported.
+ * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+ * @param inHeight          input image's height
+ * @param inWidth           input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `(inWidth + 1) * channels`
+ * @param outData           output image data, of `inHeight + 1` rows and `inWidth + 1` columns
+ * @param numThreads        number of threads, large frames only
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @warning \a int32_t sums overflow for images of more than 2^31 / 255 pixels, as in OpenCV.
+ ***************************************************************************************************/
+template <typename Tsum, int32_t channels>
+void Integral(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    Tsum *outData,
+    int32_t numThreads = 1);
+
+/**
+ * @brief Computes the integral image like `Integral` and the integral image of squared pixels
+ * `sqsum(X, Y) = Σ_{x < X, y < Y} in(x, y)^2` in the same pass over the input.
+ * @tparam Tsum The data type of sum image, currently only \a int32_t and \a double are supported.
+ * @tparam channels The number of channels of input image and output images, 1, 3 and 4 are supported.
+ * @param inHeight          input image's height
+ * @param inWidth           input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param sumWidthStride    sum image's width stride, usually it equals to `(inWidth + 1) * channels`
+ * @param sumData           sum image data, of `inHeight + 1` rows and `inWidth + 1` columns
+ * @param sqsumWidthStride  squared sum image's width stride, usually it equals to `(inWidth + 1) * channels`
+ * @param sqsumData         squared sum image data, of `inHeight + 1` rows and `inWidth + 1` columns
+ * @param numThreads        number of threads, large frames only
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename Tsum, int32_t channels>
+void IntegralSqr(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t sumWidthStride,
+    Tsum *sumData,
+    int32_t sqsumWidthStride,
+    double *sqsumData,
+    int32_t numThreads = 1);
+
+/**
+ * @brief Computes the integral image rotated by 45 degrees `tilted(X, Y) = Σ_{y < Y, |x - X + 1| <= Y - y - 1} in(x, y)`,
+ * the sum over the triangle above pixel `(X - 1, Y - 1)`. Same results as the `tilted` output of OpenCV's
+ * `integral`. Every row is obtained from the two previous output rows and input rows.
+ * @tparam Tsum The data type of output image, currently only \a int32_t and \a double are supported.
+ * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+ * @param inHeight          input image's height
+ * @param inWidth           input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `(inWidth + 1) * channels`
+ * @param outData           output image data, of `inHeight + 1` rows and `inWidth + 1` columns
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename Tsum, int32_t channels>
+void IntegralTilted(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    Tsum *outData);
+
+} // namespace tinycv
+
+#endif //!__ST_TINYCV_INTEGRAL_H_
@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_LUT_H_
+#define __ST_TINYCV_LUT_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+/**
+ * @brief Maps every element through a 256 entry lookup table, `out = lut[in]`. Same results as OpenCV's `LUT`
+ * on u8 images. Gamma correction, tone curves and contrast stretching are all tables.
+ * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `width * channels`
+ * @param outData           output image data, may be `inData`
+ * @param lutChannels       1 for one table shared by all channels, or `channels` for a table per channel
+ * @param lutData           `256 * lutChannels` entries, entry `i` of channel `c` at `i * lutChannels + c`
+ * like a 256 elements OpenCV table of `lutChannels` channels
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <int32_t channels>
+void LUT(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    int32_t lutChannels,
+    const uint8_t *lutData);
+
+} // namespace tinycv
+
+#endif //!__ST_TINYCV_LUT_H_
@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_MATCHTEMPLATE_H_
+#define __ST_TINYCV_MATCHTEMPLATE_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+enum TemplateMatchMode {
+    TM_SQDIFF = 0, //!< `Σ (T(x', y') - I(x + x', y + y'))^2`
+    TM_SQDIFF_NORMED = 1, //!< TM_SQDIFF divided by `sqrt(Σ T(x', y')^2 * Σ I(x + x', y + y')^2)`
+    TM_CCORR = 2, //!< `Σ T(x', y') * I(x + x', y + y')`
+    TM_CCORR_NORMED = 3, //!< TM_CCORR divided by the same norms as TM_SQDIFF_NORMED
+    TM_CCOEFF = 4, //!< TM_CCORR of the template and the window with their means removed
+    TM_CCOEFF_NORMED = 5 //!< TM_CCOEFF divided by the norms of the template and of the window with their means removed
+};
+
+/**
+ * @brief Compares a template against the overlapped windows of an image, same results as OpenCV's
+ * `matchTemplate` up to float rounding. The output has `inHeight - templHeight + 1` rows and
+ * `inWidth - templWidth + 1` columns.
+ * Small templates are correlated in the spatial domain with exact integer sums, larger ones block by block with
+ * an FFT (overlap-save), two image blocks sharing one complex transform. Window sums and sums of squares for
+ * the normalisation come from integral images of the rows in flight only: the output is produced band after
+ * band of rows, so memory does not grow with the image. When `numThreads > 1` bands are computed in parallel.
+ * @param inHeight          input image's height
+ * @param inWidth           input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `inWidth`
+ * @param inData            input image data
+ * @param templHeight       template's height, at most `inHeight`
+ * @param templWidth        template's width, at most `inWidth`
+ * @param templWidthStride  template's width stride, usually it equals to `templWidth`
+ * @param templData         template data
+ * @param outWidthStride    output image's width stride, usually it equals to `inWidth - templWidth + 1`
+ * @param outData           output image data
+ * @param method            comparison method
+ * @param numThreads        number of threads, large frames only
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+void MatchTemplate(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t templHeight,
+    int32_t templWidth,
+    int32_t templWidthStride,
+    const uint8_t *templData,
+    int32_t outWidthStride,
+    float *outData,
+    TemplateMatchMode method,
+    int32_t numThreads = 1);
+
+} // namespace tinycv
+
+#endif //!__ST_TINYCV_MATCHTEMPLATE_H_
@@ -0,0 +1,138 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_MORPHOLOGY_H_
+#define __ST_TINYCV_MORPHOLOGY_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+/**
+ * \brief
+ * Morphological operation type, same values as OpenCV's `MorphTypes`.
+ **********************************/
+enum MorphType {
+    MORPH_ERODE = 0, //!< minimum over the kernel
+    MORPH_DILATE = 1, //!< maximum over the kernel
+    MORPH_OPEN = 2, //!< erode, then dilate
+    MORPH_CLOSE = 3 //!< dilate, then erode
+};
+
+/**
+ * @brief Erodes an image with a rectangular kernel anchored at its center, same results as OpenCV's `erode`
+ * with a `MORPH_RECT` structuring element. The kernel is separable, small kernels run a direct sliding window,
+ * large ones run van Herk/Gil-Werman down the columns, whose cost does not depend on the kernel size, and
+ * log2(size) doubling passes along the rows. Iterations are folded into one pass with an enlarged kernel, like
+ * OpenCV does for rectangles, so they cost no more memory than one.
+ * @tparam T The data type, used for both input image and output image, currently \a uint8_t and \a float are supported.
+ * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `width * channels`
+ * @param outData           output image data, may be `inData`
+ * @param kernelWidth       kernel width
+ * @param kernelHeight      kernel height
+ * @param iterations        number of times erosion is applied
+ * @param border_type       ways to deal with border. BORDER_CONSTANT, BORDER_REPLICATE, BORDER_REFLECT and
+ * BORDER_REFLECT_101 are supported. BORDER_CONSTANT pads with the type's maximum, so the border never wins,
+ * which is OpenCV's default.
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+void Erode(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t kernelWidth,
+    int32_t kernelHeight,
+    int32_t iterations = 1,
+    BorderType border_type = BORDER_CONSTANT);
+
+/**
+ * @brief Dilates an image with a rectangular kernel anchored at its center, same results as OpenCV's `dilate`
+ * with a `MORPH_RECT` structuring element. See `Erode`.
+ * @tparam T The data type, used for both input image and output image, currently \a uint8_t and \a float are supported.
+ * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `width * channels`
+ * @param outData           output image data, may be `inData`
+ * @param kernelWidth       kernel width
+ * @param kernelHeight      kernel height
+ * @param iterations        number of times dilation is applied
+ * @param border_type       ways to deal with border. BORDER_CONSTANT, BORDER_REPLICATE, BORDER_REFLECT and
+ * BORDER_REFLECT_101 are supported. BORDER_CONSTANT pads with the type's minimum, so the border never wins,
+ * which is OpenCV's default.
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+void Dilate(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t kernelWidth,
+    int32_t kernelHeight,
+    int32_t iterations = 1,
+    BorderType border_type = BORDER_CONSTANT);
+
+/**
+ * @brief Erosion, dilation, opening or closing with a rectangular kernel, same results as OpenCV's
+ * `morphologyEx` with a `MORPH_RECT` structuring element. Opening and closing run their two stages through the
+ * same scratch buffers, the second stage works in place on the output.
+ * @tparam T The data type, used for both input image and output image, currently \a uint8_t and \a float are supported.
+ * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `width * channels`
+ * @param outData           output image data, may be `inData`
+ * @param op                the operation
+ * @param kernelWidth       kernel width
+ * @param kernelHeight      kernel height
+ * @param iterations        number of times erosion and dilation are applied
+ * @param border_type       ways to deal with border, see `Erode`
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+void MorphologyEx(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    MorphType op,
+    int32_t kernelWidth,
+    int32_t kernelHeight,
+    int32_t iterations = 1,
+    BorderType border_type = BORDER_CONSTANT);
+
+} // namespace tinycv
+
+#endif //!__ST_TINYCV_MORPHOLOGY_H_
@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_PYRAMID_H_
+#define __ST_TINYCV_PYRAMID_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+/**
+ * @brief Blurs the image with the 5x5 Gaussian kernel `[1 4 6 4 1]^T [1 4 6 4 1] / 256` and drops every
+ * other row and column, borders are `BORDER_REFLECT_101`. Same results as OpenCV's `pyrDown`.
+ * @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+ * @param inHeight          input image's height
+ * @param inWidth           input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `((inWidth + 1) / 2) * channels`
+ * @param outData           output image data, of `(inHeight + 1) / 2` rows and `(inWidth + 1) / 2` columns
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+void PyrDown(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData);
+
+/**
+ * @brief Upsamples the image by 2 in both directions, inserting zero rows and columns and filtering with
+ * the Gaussian kernel of `PyrDown` multiplied by 4. Same results as OpenCV's `pyrUp` with the default size.
+ * @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+ * @param inHeight          input image's height
+ * @param inWidth           input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `2 * inWidth * channels`
+ * @param outData           output image data, of `2 * inHeight` rows and `2 * inWidth` columns
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+void PyrUp(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData);
+
+/**
+ * \brief
+ * One level of an image pyramid built by `BuildPyramid`.
+ **********************************/
+template <typename T>
+struct PyramidLevel {
+    int32_t height;
+    int32_t width;
+    int32_t widthStride; //!< in elements, levels stored in the arena are packed with `width * channels`
+    const T *data;
+};
+
+/**
+ * @brief Number of elements of the arena `BuildPyramid` needs for `levels` levels, level 0 is the input
+ * image itself and is not stored in the arena.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+uint64_t PyramidArenaSize(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t levels);
+
+/**
+ * @brief Builds a Gaussian pyramid of `levels` levels, every level is `PyrDown` of the previous one.
+ * All levels are computed in one streaming pass over the input: a row of level N + 1 is produced as soon
+ * as the 5 rows of level N it needs exist, so they are consumed while they are still in cache.
+ * @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+ * @param inHeight          input image's height
+ * @param inWidth           input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data, it is level 0
+ * @param levels            number of levels including level 0
+ * @param arena             storage of levels 1 to `levels - 1`, at least `PyramidArenaSize` elements
+ * @param pyramid           array of `levels` entries, receives the geometry and data of every level
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+void BuildPyramid(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t levels,
+    T *arena,
+    PyramidLevel<T> *pyramid);
+
+} // namespace tinycv
+
+#endif //!__ST_TINYCV_PYRAMID_H_
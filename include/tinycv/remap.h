@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_REMAP_H_
+#define __ST_TINYCV_REMAP_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+enum {
+    REMAP_INTER_BITS     = 5, //!< fractional bits of the fixed-point maps
+    REMAP_INTER_TAB_SIZE = 1 << REMAP_INTER_BITS
+};
+
+/**
+ * @brief Converts a pair of floating point maps into the fixed-point form consumed by `RemapNearestPoint`
+ * and `RemapLinear`. Same layout and results as OpenCV's `convertMaps` to `CV_16SC2` + `CV_16UC1`.
+ * Lens undistortion maps only change with the calibration, so convert them once and reuse them per frame.
+ * @param height            map height, equals to the height of the remapped image
+ * @param width             map width, equals to the width of the remapped image
+ * @param mapXWidthStride   width stride of `mapX`, usually it equals to `width`
+ * @param mapX              source x coordinate of every output pixel
+ * @param mapYWidthStride   width stride of `mapY`, usually it equals to `width`
+ * @param mapY              source y coordinate of every output pixel
+ * @param mapXYWidthStride  width stride of `mapXY` in int16 elements, usually it equals to `2 * width`
+ * @param mapXY             interleaved integer source coordinates, `(x, y)` pairs
+ * @param mapFracWidthStride width stride of `mapFrac`, usually it equals to `width`
+ * @param mapFrac           `y_frac * REMAP_INTER_TAB_SIZE + x_frac` of every pixel in `1 / REMAP_INTER_TAB_SIZE`
+ *                          units. If it is `nullptr`, `mapXY` receives the rounded coordinates for nearest point
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+void ConvertMaps(
+    int32_t height,
+    int32_t width,
+    int32_t mapXWidthStride,
+    const float *mapX,
+    int32_t mapYWidthStride,
+    const float *mapY,
+    int32_t mapXYWidthStride,
+    int16_t *mapXY,
+    int32_t mapFracWidthStride,
+    uint16_t *mapFrac);
+
+/**
+ * @brief Nearest point remap with a map produced by `ConvertMaps` without `mapFrac`,
+ * `outData(x, y) = inData(mapXY(x, y))`. Same results as OpenCV's `remap` with `INTER_NEAREST`.
+ * @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+ * @param inHeight          input image's height
+ * @param inWidth           input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outHeight         output image's height, equals to the map height
+ * @param outWidth          output image's width, equals to the map width
+ * @param outWidthStride    output image's width stride, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @param mapXYWidthStride  width stride of `mapXY` in int16 elements
+ * @param mapXY             interleaved integer source coordinates
+ * @param border_type       how to treat coordinates outside the input image, all `BorderType` modes except
+ *                          `BORDER_ISOLATED` are supported, `BORDER_TRANSPARENT` leaves those pixels untouched
+ * @param border_value      value of the pixels outside the input image when border_type is BORDER_CONSTANT
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+void RemapNearestPoint(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t mapXYWidthStride,
+    const int16_t *mapXY,
+    BorderType border_type = BORDER_CONSTANT,
+    T border_value = 0);
+
+/**
+ * @brief Bilinear remap with maps produced by `ConvertMaps`, the fractional part of every coordinate is
+ * quantized to `1 / REMAP_INTER_TAB_SIZE`. Same results as OpenCV's `remap` with `INTER_LINEAR` and fixed-point maps.
+ * @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+ * @param inHeight          input image's height
+ * @param inWidth           input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outHeight         output image's height, equals to the map height
+ * @param outWidth          output image's width, equals to the map width
+ * @param outWidthStride    output image's width stride, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @param mapXYWidthStride  width stride of `mapXY` in int16 elements
+ * @param mapXY             interleaved integer source coordinates
+ * @param mapFracWidthStride width stride of `mapFrac`
+ * @param mapFrac           interpolation table index of every pixel
+ * @param border_type       how to treat neighbours outside the input image, all `BorderType` modes except
+ *                          `BORDER_ISOLATED` are supported, `BORDER_TRANSPARENT` leaves pixels whose 2x2
+ *                          neighbourhood is not inside the input image untouched
+ * @param border_value      value of the pixels outside the input image when border_type is BORDER_CONSTANT
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+void RemapLinear(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t mapXYWidthStride,
+    const int16_t *mapXY,
+    int32_t mapFracWidthStride,
+    const uint16_t *mapFrac,
+    BorderType border_type = BORDER_CONSTANT,
+    T border_value = 0);
+
+} // namespace tinycv
+
+#endif //!__ST_TINYCV_REMAP_H_
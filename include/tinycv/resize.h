@@ -22,9 +22,11 @@
 
 namespace tinycv {
 
+class StreamContext;
+
 /**
  * @brief Resize the image with nearest neighbor interpolation method
- * @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam T The data type of input and output image, currently \a uint8_t, \a uint16_t, \a int16_t, \a float and \a half_t are supported.
  * @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
  * @param inHeight          input image's height
  * @param inWidth           input image's width need to be processed
@@ -49,9 +51,37 @@ void ResizeNearestPoint(
 
 /**
  * @brief Resize the image with linear interpolation method.
- * @tparam TSrc The data type of input image, currently only \a uint8_t and \a float are supported.
+ * @tparam TSrc The data type of input image, currently \a uint8_t, \a uint16_t, \a int16_t, \a float and \a half_t are supported.
+ * @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
+ * @tparam TDst The data type of output image, currently \a uint8_t, \a uint16_t, \a int16_t, \a float and \a half_t are supported.The param is same with TSrc.
+ * @param inHeight          input image's height
+ * @param inWidth           input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outHeight         output image's height
+ * @param outWidth          output image's width need to be processed
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+void ResizeLinear(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief ResizeLinear for a stream of frames, see `tinycv/stream.h`. The offset and weight tables and the
+ * row buffers are kept in `context` and only rebuilt when the geometry changes, the result is identical to
+ * ResizeLinear. The call is recorded as stage `"ResizeLinear"`.
+ * @tparam T The data type of input and output image, currently \a uint8_t, \a uint16_t, \a int16_t, \a float and \a half_t are supported.
  * @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
- * @tparam TDst The data type of output image, currently only \a uint8_t and \a float are supported.The param is same with TSrc.
+ * @param context           the stream's context
  * @param inHeight          input image's height
  * @param inWidth           input image's width need to be processed
  * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
@@ -61,9 +91,11 @@ void ResizeNearestPoint(
  * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
  * @param outData           output image data
  * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark The exact 1/2, 1/4 and 1/6 shrinks of \a uint8_t images on arm need no tables, only their stage is recorded.
  ***************************************************************************************************/
 template <typename T, int32_t channels>
 void ResizeLinear(
+    StreamContext &context,
     int32_t inHeight,
     int32_t inWidth,
     int32_t inWidthStride,
@@ -73,11 +105,68 @@ void ResizeLinear(
     int32_t outWidthStride,
     T* outData);
 
+/**
+ * @brief The scale ResizeLinear derives from the image sizes, source pixels per output pixel.
+ * Pass it to ResizeLinearRegion to sample on the same grid as a whole image resize.
+ ***************************************************************************************************/
+inline double ResizeLinearScale(int32_t inSize, int32_t outSize)
+{
+    return 1.0 / ((double)outSize / inSize);
+}
+
+/**
+ * @brief Resize with linear interpolation and an explicit mapping instead of one derived from the sizes.
+ * Output pixel `(x, y)` samples the source at
+ * `((outX + x + 0.5) * scaleX - 0.5 + originX, (outY + y + 0.5) * scaleY - 0.5 + originY)`,
+ * samples outside of the source are clamped to its border like ResizeLinear does.
+ * Every output pixel only depends on its own position, so a large output can be split into tiles:
+ * calls sharing the source, scale and origin reassemble bit exactly into the result of one call over
+ * the whole output, whatever the tile sizes. A crop is resampled without copying by pointing `inData`
+ * at its first pixel, or by passing the whole image and the crop position as origin to let the
+ * samples near the crop's border see the pixels around it.
+ * @tparam T The data type of input and output image, currently \a uint8_t, \a uint16_t, \a int16_t, \a float and \a half_t are supported.
+ * @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
+ * @param inHeight          source height, samples are clamped to it
+ * @param inWidth           source width, samples are clamped to it
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            source data
+ * @param outHeight         height of the output tile
+ * @param outWidth          width of the output tile
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output tile data
+ * @param scaleY            source rows per output row, must be positive
+ * @param scaleX            source columns per output column, must be positive
+ * @param originY           vertical shift of the sampling grid in source pixels
+ * @param originX           horizontal shift of the sampling grid in source pixels
+ * @param outY              row of the tile's first pixel in the whole output
+ * @param outX              column of the tile's first pixel in the whole output
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark With ResizeLinearScale and zero origins the grid is the one of ResizeLinear, for \a uint8_t on x86
+ * the results are identical. Floating point types skip the FMA kernels here so that rounding does not depend
+ * on where a pixel falls in a tile, and may differ from ResizeLinear in the last bit.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+void ResizeLinearRegion(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T* outData,
+    double scaleY,
+    double scaleX,
+    double originY = 0.0,
+    double originX = 0.0,
+    int32_t outY = 0,
+    int32_t outX = 0);
+
 /**
  * @brief Scale the image with area interpolation method
- * @tparam TSrc The data type of input image, currently only \a uint8_t and \a float are supported.
+ * @tparam TSrc The data type of input image, currently only \a uint8_t and \a float are supported, plus \a uint16_t, \a int16_t and \a half_t on arm.
  * @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
- * @tparam TDst The data type of output image, currently only \a uint8_t and \a float are supported.The param is same with TSrc.
+ * @tparam TDst The data type of output image, currently only \a uint8_t and \a float are supported, plus \a uint16_t, \a int16_t and \a half_t on arm.The param is same with TSrc.
  * @param inHeight          input image's height
  * @param inWidth           input image's width need to be processed
  * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
@@ -99,6 +188,64 @@ void ResizeArea(
     int32_t outWidthStride,
     T* outData);
 
+/**
+ * @brief Resize the image with bicubic interpolation method, a 4x4 neighborhood is weighted with the
+ * same kernel as OpenCV's `INTER_CUBIC` (a = -0.75) and pixels outside of the image are replicated.
+ * @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
+ * @param inHeight          input image's height
+ * @param inWidth           input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outHeight         output image's height
+ * @param outWidth          output image's width need to be processed
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark \a uint8_t uses 11 bit fixed point weights, results may differ from OpenCV by 1.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+void ResizeCubic(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T* outData);
+
+/**
+ * @brief Resize the image with a separable Lanczos filter. When shrinking, the kernel is stretched by
+ * the scale factor so every input pixel contributes, which avoids the aliasing of 2 tap interpolation
+ * and keeps more detail than area averaging. Filter windows are clamped to the image and renormalized.
+ * @tparam T The data type of input and output image, currently only \a uint8_t and \a float are supported.
+ * @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
+ * @param inHeight          input image's height
+ * @param inWidth           input image's width need to be processed
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outHeight         output image's height
+ * @param outWidth          output image's width need to be processed
+ * @param outWidthStride    the width stride of output image, usually it equals to `width * channels`
+ * @param outData           output image data
+ * @param window            number of kernel lobes on each side, 3 gives Lanczos-3
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ * @remark Weight tables are built once per (input size, output size, window) and cached process-wide,
+ * so a stream of frames with the same geometry only pays for the filtering. Intermediate rows are fp32.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+void ResizeLanczos(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T* outData,
+    int32_t window = 3);
+
 } // namespace tinycv
 
 #endif //! __ST_TINYCV_RESIZE_H_
@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_SOBEL_H_
+#define __ST_TINYCV_SOBEL_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+/**
+ * @brief Image derivative with an extended Sobel operator, same results as OpenCV's `Sobel`. The kernel is
+ * separable, a vertical pass with integer taps feeds a horizontal pass that accumulates pairs of taps at once.
+ * \a uint8_t input is filtered in integers, so \a int16_t output is exact when `scale` is 1 and `delta` is 0.
+ * @tparam Tsrc The data type of input image, \a uint8_t or \a float.
+ * @tparam Tdst The data type of output image, \a int16_t or \a float for \a uint8_t input, \a float for \a float input.
+ * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `width * channels`
+ * @param outData           output image data, must not overlap `inData`
+ * @param dx                order of the derivative x
+ * @param dy                order of the derivative y
+ * @param ksize             size of the extended Sobel kernel, 1, 3, 5 or 7. 1 means a 3x1 or 1x3 kernel without
+ * smoothing, -1 means the 3x3 Scharr kernel, see `Scharr`
+ * @param scale             scale factor applied to the derivative
+ * @param delta             value added to the scaled derivative
+ * @param border_type       ways to deal with border. BORDER_REFLECT_101, BORDER_REFLECT, BORDER_CONSTANT (zeros)
+ * and BORDER_REPLICATE are supported
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename Tsrc, typename Tdst, int32_t channels>
+void Sobel(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const Tsrc *inData,
+    int32_t outWidthStride,
+    Tdst *outData,
+    int32_t dx,
+    int32_t dy,
+    int32_t ksize = 3,
+    float scale = 1.0f,
+    float delta = 0.0f,
+    BorderType border_type = BORDER_DEFAULT);
+
+/**
+ * @brief First x or y image derivative with the 3x3 Scharr operator, same results as OpenCV's `Scharr`.
+ * See `Sobel`.
+ * @tparam Tsrc The data type of input image, \a uint8_t or \a float.
+ * @tparam Tdst The data type of output image, \a int16_t or \a float for \a uint8_t input, \a float for \a float input.
+ * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `width * channels`
+ * @param outData           output image data, must not overlap `inData`
+ * @param dx                order of the derivative x, 0 or 1
+ * @param dy                order of the derivative y, 0 or 1, `dx + dy` must be 1
+ * @param scale             scale factor applied to the derivative
+ * @param delta             value added to the scaled derivative
+ * @param border_type       ways to deal with border, see `Sobel`
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename Tsrc, typename Tdst, int32_t channels>
+void Scharr(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const Tsrc *inData,
+    int32_t outWidthStride,
+    Tdst *outData,
+    int32_t dx,
+    int32_t dy,
+    float scale = 1.0f,
+    float delta = 0.0f,
+    BorderType border_type = BORDER_DEFAULT);
+
+/**
+ * @brief Gradient magnitude and quantized orientation of a gray image in one pass, the 3x3 Sobel derivatives
+ * stay in registers and are never written to memory. The magnitude is `sqrt(dx * dx + dy * dy)`, the bin of the
+ * orientation `atan2(dy, dx)` is `floor(angle * numBins / range)` with a range of 180 degrees for unsigned
+ * gradients, where opposite directions share a bin, or 360 degrees for signed ones. Bins are found by comparing
+ * the gradient against the bin boundary directions, no arc tangent is evaluated. Pixels without gradient go to
+ * bin 0.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input gray image data
+ * @param magWidthStride    magnitude image's width stride, usually it equals to `width`
+ * @param magnitude         magnitude image data
+ * @param binWidthStride    bin image's width stride, usually it equals to `width`
+ * @param bins              orientation bin image data
+ * @param numBins           number of orientation bins, 1 to 255
+ * @param signedGradient    whether the orientation range is 360 degrees instead of 180
+ * @param border_type       ways to deal with border, see `Sobel`
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+void SobelMagnitudeOrientation(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t magWidthStride,
+    float *magnitude,
+    int32_t binWidthStride,
+    uint8_t *bins,
+    int32_t numBins,
+    bool signedGradient = false,
+    BorderType border_type = BORDER_DEFAULT);
+
+} // namespace tinycv
+
+#endif //!__ST_TINYCV_SOBEL_H_
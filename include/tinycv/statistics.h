@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_STATISTICS_H_
+#define __ST_TINYCV_STATISTICS_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+/**
+ * @brief Sum of every channel, same results as OpenCV's `sum`, optionally over the pixels where a mask is set.
+ * \a uint8_t images are summed with `_mm_sad_epu8` (one channel) or 16 bit lanes flushed to 64 bit integers
+ * (several channels) and are exact, \a float images are summed in double lanes.
+ * When `numThreads > 1` the image is cut into row bands, each band is reduced on its own and the partial sums
+ * are added.
+ * @tparam T The data type of input image, currently \a uint8_t and \a float are supported.
+ * @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param sum               `channels` sums
+ * @param maskWidthStride   mask's width stride, usually it equals to `width`
+ * @param mask              optional mask, pixels are counted where it is nonzero, nullptr for all pixels
+ * @param numThreads        number of threads, large frames only
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+void Sum(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    double *sum,
+    int32_t maskWidthStride = 0,
+    const uint8_t *mask = nullptr,
+    int32_t numThreads = 1);
+
+/**
+ * @brief Mean and standard deviation of every channel, same results as OpenCV's `meanStdDev`, optionally
+ * over the pixels where a mask is set. Sums and sums of squares are accumulated as in `Sum`, exactly for
+ * \a uint8_t images. Both are 0 when the mask is empty.
+ * @tparam T The data type of input image, currently \a uint8_t and \a float are supported.
+ * @tparam channels The number of channels of input image, 1, 3 and 4 are supported.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param mean              `channels` means
+ * @param stddev            `channels` standard deviations, may be nullptr
+ * @param maskWidthStride   mask's width stride, usually it equals to `width`
+ * @param mask              optional mask, pixels are counted where it is nonzero, nullptr for all pixels
+ * @param numThreads        number of threads, large frames only
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+void MeanStdDev(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    double *mean,
+    double *stddev,
+    int32_t maskWidthStride = 0,
+    const uint8_t *mask = nullptr,
+    int32_t numThreads = 1);
+
+/**
+ * @brief Minimum and maximum of a single channel image and their first locations in row major order, same
+ * results as OpenCV's `minMaxLoc`, optionally over the pixels where a mask is set. The extrema are reduced in
+ * vector lanes first, then a second pass looks for the first pixel equal to each of them. With an empty mask
+ * the values are 0 and the locations (-1, -1). NaN pixels are skipped.
+ * @tparam T The data type of input image, currently \a uint8_t and \a float are supported.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input image data
+ * @param minVal            minimum, may be nullptr
+ * @param maxVal            maximum, may be nullptr
+ * @param minLoc            x and y of the minimum, may be nullptr
+ * @param maxLoc            x and y of the maximum, may be nullptr
+ * @param maskWidthStride   mask's width stride, usually it equals to `width`
+ * @param mask              optional mask, pixels are looked at where it is nonzero, nullptr for all pixels
+ * @param numThreads        number of threads, large frames only
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename T>
+void MinMaxLoc(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    T *minVal,
+    T *maxVal,
+    int32_t *minLoc,
+    int32_t *maxLoc,
+    int32_t maskWidthStride = 0,
+    const uint8_t *mask = nullptr,
+    int32_t numThreads = 1);
+
+} // namespace tinycv
+
+#endif //!__ST_TINYCV_STATISTICS_H_
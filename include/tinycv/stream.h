@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_STREAM_H_
+#define __ST_TINYCV_STREAM_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+/**
+ * \brief
+ * Latency of one stage of a stream, in microseconds over the most recent frames.
+ **********************************/
+struct StreamStageStats {
+    uint64_t count; //!< frames recorded since the last reset, the percentiles only cover the last `window` of them
+    double p50;
+    double p90;
+    double p99;
+    double max;
+};
+
+/**
+ * @brief Persistent state of a video stream processing frames of a fixed geometry.
+ * Functions taking a StreamContext build their lookup tables (resize offsets and weights) on the first frame
+ * and keep them, together with their scratch rows, for as long as the geometry stays the same, so the
+ * following frames neither allocate nor rebuild tables. The ISA used for dispatch is read once when the
+ * context is created. Every such call records its latency as a stage named after the function, stages of
+ * the caller's own code can be timed with StreamStageTimer.
+ * @warning A context is not thread safe, use one per stream and thread.
+ ***************************************************************************************************/
+class StreamContext {
+public:
+    /**
+     * @param statsWindow       number of most recent frames the latency percentiles are computed over
+     ***************************************************************************************************/
+    explicit StreamContext(int32_t statsWindow = 1024);
+    ~StreamContext();
+
+    StreamContext(const StreamContext &) = delete;
+    StreamContext &operator=(const StreamContext &) = delete;
+
+    /**
+     * @brief ISA flags of the CPU, as returned by `GetCpuISA` when the context was created.
+     ***************************************************************************************************/
+    uint32_t Isa() const;
+
+    /**
+     * @brief A 128 bytes aligned buffer of at least `size` bytes, kept under `name` until the context is
+     * destroyed. It only grows, so once a stream reached its largest frame this never allocates.
+     * @param name              identifies the buffer, compared by content
+     * @param size              bytes needed
+     * @return the buffer, its content is undefined, or `nullptr` when the allocation failed
+     ***************************************************************************************************/
+    void *Scratch(const char *name, uint64_t size);
+
+    /**
+     * @brief A 128 bytes aligned buffer of at least `size` bytes for lookup tables built for `key`.
+     * While the same key is asked for, the same buffer is returned with its content untouched.
+     * @param name              identifies the tables, compared by content
+     * @param key               the parameters the tables depend on, typically the geometry
+     * @param keyLength         number of elements of `key`, at most 16
+     * @param size              bytes needed
+     * @param ready             set to true when the buffer still holds the tables of `key`, to false when
+     *                          the caller has to build them
+     * @return the buffer, or `nullptr` when the allocation failed or the key is too long
+     ***************************************************************************************************/
+    void *Tables(const char *name, const int32_t *key, int32_t keyLength, uint64_t size, bool *ready);
+
+    /**
+     * @brief Adds one frame's latency of `stage`.
+     ***************************************************************************************************/
+    void RecordStage(const char *stage, double microseconds);
+
+    /**
+     * @brief Latency percentiles of `stage`.
+     * @return false when nothing has been recorded for `stage` since the last reset
+     ***************************************************************************************************/
+    bool GetStageStats(const char *stage, StreamStageStats *stats) const;
+
+    /**
+     * @brief Forgets the recorded latencies, the cached tables and buffers are kept.
+     ***************************************************************************************************/
+    void ResetStats();
+
+private:
+    struct Impl;
+    Impl *impl_;
+};
+
+/**
+ * @brief Records the time from its construction to its destruction as one frame of `stage`.
+ ***************************************************************************************************/
+class StreamStageTimer {
+public:
+    StreamStageTimer(StreamContext &context, const char *stage);
+    ~StreamStageTimer();
+
+    StreamStageTimer(const StreamStageTimer &) = delete;
+    StreamStageTimer &operator=(const StreamStageTimer &) = delete;
+
+private:
+    StreamContext &context_;
+    const char *stage_;
+    int64_t start_;
+};
+
+} // namespace tinycv
+
+#endif //! __ST_TINYCV_STREAM_H_
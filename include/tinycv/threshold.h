@@ -0,0 +1,143 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_THRESHOLD_H_
+#define __ST_TINYCV_THRESHOLD_H_
+
+#include "tinycv/types.h"
+
+namespace tinycv {
+
+/**
+ * \brief
+ * Threshold operation type, one of the first five, optionally or'ed with `THRESH_OTSU`.
+ **********************************/
+enum ThresholdType {
+    THRESH_BINARY = 0, //!< `maxval` if `src > thresh`, else 0
+    THRESH_BINARY_INV = 1, //!< 0 if `src > thresh`, else `maxval`
+    THRESH_TRUNC = 2, //!< `thresh` if `src > thresh`, else `src`
+    THRESH_TOZERO = 3, //!< `src` if `src > thresh`, else 0
+    THRESH_TOZERO_INV = 4, //!< 0 if `src > thresh`, else `src`
+    THRESH_OTSU = 8 //!< flag, `thresh` is ignored and picked from the image histogram with Otsu's method
+};
+
+/**
+ * @brief Applies a fixed level threshold to every element. Same results as OpenCV's `threshold`.
+ * @tparam T The data type, used for both input image and output image, currently \a uint8_t and \a float are supported.
+ * @tparam channels The number of channels of input image and output image, 1, 3 and 4 are supported.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * channels`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `width * channels`
+ * @param outData           output image data, may be `inData`
+ * @param thresh            threshold value
+ * @param maxval            value given to the elements passing `THRESH_BINARY` and `THRESH_BINARY_INV`
+ * @param type              a `ThresholdType`, `THRESH_OTSU` is honored for single channel \a uint8_t images only
+ * @return the threshold used, the Otsu threshold when `THRESH_OTSU` is honored, otherwise `thresh`
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+template <typename T, int32_t channels>
+T Threshold(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    T thresh,
+    T maxval,
+    int32_t type);
+
+/**
+ * @brief Picks the threshold maximizing the between-class variance of a 256 bins histogram (Otsu's method).
+ * Same value as OpenCV's `threshold` with `THRESH_OTSU`.
+ * @param hist              256 counters, as filled by `CalcHist`
+ * @return the threshold, pixels above it form the foreground class
+ ***************************************************************************************************/
+uint8_t OtsuThreshold(const uint32_t *hist);
+
+/**
+ * @brief Picks the Otsu threshold of a single channel image.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width`
+ * @param inData            input image data
+ * @return the threshold, pixels above it form the foreground class
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+uint8_t OtsuThreshold(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData);
+
+/**
+ * @brief Converts a BGR image to gray and thresholds it in one pass, the gray values stay in registers and only
+ * the thresholded image is written. Same results as `BGR2GRAY<uint8_t>` followed by `Threshold<uint8_t, 1>`.
+ * With `THRESH_OTSU` the image is converted twice, once to build the histogram and once to threshold.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * 3`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `width`
+ * @param outData           output image data
+ * @param thresh            threshold value
+ * @param maxval            value given to the elements passing `THRESH_BINARY` and `THRESH_BINARY_INV`
+ * @param type              a `ThresholdType`
+ * @return the threshold used
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+uint8_t BGR2GRAYThreshold(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    uint8_t thresh,
+    uint8_t maxval,
+    int32_t type);
+
+/**
+ * @brief Converts a RGB image to gray and thresholds it in one pass, see `BGR2GRAYThreshold`.
+ * @param height            input image's height
+ * @param width             input image's width
+ * @param inWidthStride     input image's width stride, usually it equals to `width * 3`
+ * @param inData            input image data
+ * @param outWidthStride    output image's width stride, usually it equals to `width`
+ * @param outData           output image data
+ * @param thresh            threshold value
+ * @param maxval            value given to the elements passing `THRESH_BINARY` and `THRESH_BINARY_INV`
+ * @param type              a `ThresholdType`
+ * @return the threshold used
+ * @warning All input parameters must be valid, or undefined behaviour may occur.
+ ***************************************************************************************************/
+uint8_t RGB2GRAYThreshold(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    uint8_t thresh,
+    uint8_t maxval,
+    int32_t type);
+
+} // namespace tinycv
+
+#endif //!__ST_TINYCV_THRESHOLD_H_
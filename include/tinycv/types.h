@@ -20,6 +20,7 @@
 
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
 
 namespace tinycv {
 
@@ -30,7 +31,8 @@ namespace tinycv {
 enum InterpolationType {
     INTERPOLATION_LINEAR, //!< Linear interpolation
     INTERPOLATION_NEAREST_POINT, //!< Nearest point interpolation
-    INTERPOLATION_AREA //!< Area interpolation
+    INTERPOLATION_AREA, //!< Area interpolation
+    INTERPOLATION_CUBIC //!< Bicubic interpolation over a 4x4 neighborhood
 };
 
 enum BorderType {
@@ -54,6 +56,91 @@ enum { INTER_NN = 0,
 typedef unsigned char uchar; //!< Type alias. For some code backward compatibility.
 typedef unsigned short ushort; //!< Type alias. For some code backward compatibility.
 
+/**
+ * \brief
+ * Convert a single precision value to IEEE 754 half precision bits, rounding to nearest even.
+ **********************************/
+inline uint16_t FloatToHalfBits(float value)
+{
+    uint32_t x;
+    memcpy(&x, &value, sizeof(x));
+    uint32_t sign = (x >> 16) & 0x8000;
+    x &= 0x7fffffff;
+    if (x > 0x7f800000) { //! NaN, keep it quiet
+        return (uint16_t)(sign | 0x7e00 | ((x >> 13) & 0x3ff));
+    }
+    if (x >= 0x47800000) { //! overflow or infinity
+        return (uint16_t)(sign | 0x7c00);
+    }
+    if (x < 0x38800000) { //! subnormal or zero in half precision
+        if (x < 0x33000000) {
+            return (uint16_t)sign;
+        }
+        uint32_t e = x >> 23;
+        uint32_t m = (x & 0x7fffff) | 0x800000;
+        uint32_t shift = 126 - e;
+        uint32_t h = m >> shift;
+        uint32_t rem = m & ((1u << shift) - 1);
+        uint32_t halfway = 1u << (shift - 1);
+        if (rem > halfway || (rem == halfway && (h & 1))) {
+            ++h;
+        }
+        return (uint16_t)(sign | h);
+    }
+    uint32_t h = (x - 0x38000000) >> 13;
+    uint32_t rem = x & 0x1fff;
+    if (rem > 0x1000 || (rem == 0x1000 && (h & 1))) {
+        ++h; //! a carry out of the mantissa correctly bumps the exponent, up to infinity
+    }
+    return (uint16_t)(sign | h);
+}
+
+/**
+ * \brief
+ * Convert IEEE 754 half precision bits to a single precision value.
+ **********************************/
+inline float HalfBitsToFloat(uint16_t h)
+{
+    uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    uint32_t e = (h >> 10) & 0x1f;
+    uint32_t m = h & 0x3ff;
+    uint32_t x;
+    if (e == 0x1f) {
+        x = sign | 0x7f800000 | (m << 13) | (m ? 0x400000 : 0);
+    } else if (e != 0) {
+        x = sign | ((e + 112) << 23) | (m << 13);
+    } else if (m == 0) {
+        x = sign;
+    } else {
+        e = 113;
+        while (!(m & 0x400)) {
+            m <<= 1;
+            --e;
+        }
+        x = sign | (e << 23) | ((m & 0x3ff) << 13);
+    }
+    float value;
+    memcpy(&value, &x, sizeof(value));
+    return value;
+}
+
+/**
+ * \brief
+ * Half precision (fp16) storage type. Images of this type are stored as fp16 and
+ * processed in fp32 registers, results are rounded to nearest even on store.
+ **********************************/
+struct half_t {
+    uint16_t bits;
+
+    half_t() = default;
+    half_t(float value)
+        : bits(FloatToHalfBits(value)) {}
+    operator float() const
+    {
+        return HalfBitsToFloat(bits);
+    }
+};
+
 } // namespace tinycv
 
 #endif //! __ST_HPC_TINYCV_TYPES_H_
@@ -0,0 +1,353 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/cvtcolor.h"
+#include "tinycv/types.h"
+
+#include <arm_neon.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace tinycv {
+
+// A bayer layout is described by two flags of its first row: whether the
+// top-left sample is green and whether the non-green samples are blue.
+// Every following row flips both flags.
+static inline void bayer2bgr_scalar_u8(
+    const uint8_t* up,
+    const uint8_t* cur,
+    const uint8_t* down,
+    int32_t begin,
+    int32_t end,
+    bool green_even,
+    bool blue_row,
+    bool edge_aware,
+    uint8_t* dst)
+{
+    for (int32_t x = begin; x < end; ++x) {
+        int32_t c, g, o;
+        if (((x & 1) == 0) == green_even) {
+            g = cur[x];
+            c = (cur[x - 1] + cur[x + 1] + 1) >> 1;
+            o = (up[x] + down[x] + 1) >> 1;
+        } else {
+            c = cur[x];
+            g = (cur[x - 1] + cur[x + 1] + up[x] + down[x] + 2) >> 2;
+            if (edge_aware) {
+                int32_t dh = abs(cur[x - 1] - cur[x + 1]);
+                int32_t dv = abs(up[x] - down[x]);
+                if (dh < dv) {
+                    g = (cur[x - 1] + cur[x + 1] + 1) >> 1;
+                } else if (dv < dh) {
+                    g = (up[x] + down[x] + 1) >> 1;
+                }
+            }
+            o = (up[x - 1] + up[x + 1] + down[x - 1] + down[x + 1] + 2) >> 2;
+        }
+        dst[x * 3 + 0] = (uint8_t)(blue_row ? c : o);
+        dst[x * 3 + 1] = (uint8_t)g;
+        dst[x * 3 + 2] = (uint8_t)(blue_row ? o : c);
+    }
+}
+
+static inline uint8x16_t bayer_avg4_u8(uint8x16_t a, uint8x16_t b, uint8x16_t c, uint8x16_t d)
+{
+    uint16x8_t lo = vaddq_u16(vaddl_u8(vget_low_u8(a), vget_low_u8(b)), vaddl_u8(vget_low_u8(c), vget_low_u8(d)));
+    uint16x8_t hi = vaddq_u16(vaddl_u8(vget_high_u8(a), vget_high_u8(b)), vaddl_u8(vget_high_u8(c), vget_high_u8(d)));
+    return vcombine_u8(vrshrn_n_u16(lo, 2), vrshrn_n_u16(hi, 2));
+}
+
+// 16 pixels of one output row, `mask_c` selects the lanes that hold the
+// row's own non-green color.
+static inline void bayer2bgr_16px_u8(
+    uint8x16_t u_l,
+    uint8x16_t u_c,
+    uint8x16_t u_r,
+    uint8x16_t c_l,
+    uint8x16_t c_c,
+    uint8x16_t c_r,
+    uint8x16_t d_l,
+    uint8x16_t d_c,
+    uint8x16_t d_r,
+    uint8x16_t mask_c,
+    bool blue_row,
+    bool edge_aware,
+    uint8_t* dst)
+{
+    uint8x16_t h_avg = vrhaddq_u8(c_l, c_r);
+    uint8x16_t v_avg = vrhaddq_u8(u_c, d_c);
+    uint8x16_t cross = bayer_avg4_u8(c_l, c_r, u_c, d_c);
+    uint8x16_t diag = bayer_avg4_u8(u_l, u_r, d_l, d_r);
+
+    if (edge_aware) {
+        uint8x16_t dh = vabdq_u8(c_l, c_r);
+        uint8x16_t dv = vabdq_u8(u_c, d_c);
+        cross = vbslq_u8(vcltq_u8(dh, dv), h_avg, cross);
+        cross = vbslq_u8(vcltq_u8(dv, dh), v_avg, cross);
+    }
+
+    uint8x16_t c = vbslq_u8(mask_c, c_c, h_avg);
+    uint8x16_t g = vbslq_u8(mask_c, cross, c_c);
+    uint8x16_t o = vbslq_u8(mask_c, diag, v_avg);
+    uint8x16x3_t v_dst;
+    v_dst.val[0] = blue_row ? c : o;
+    v_dst.val[1] = g;
+    v_dst.val[2] = blue_row ? o : c;
+    vst3q_u8(dst, v_dst);
+}
+
+// Vector loops start at column 1, so lane i always maps to an odd column when
+// i is even.
+static inline uint8x16_t bayer_color_mask(bool green_even)
+{
+    return vreinterpretq_u8_u16(vdupq_n_u16(green_even ? 0x00ff : 0xff00));
+}
+
+static int32_t bayer2bgr_twoline_kernel_u8(
+    const uint8_t* in_0,
+    const uint8_t* in_1,
+    const uint8_t* in_2,
+    const uint8_t* in_3,
+    int32_t width,
+    bool green_even,
+    bool blue_row,
+    bool edge_aware,
+    uint8_t* out_0,
+    uint8_t* out_1)
+{
+    uint8x16_t mask_0 = bayer_color_mask(green_even);
+    uint8x16_t mask_1 = bayer_color_mask(!green_even);
+    int32_t x = 1;
+    for (; x <= width - 17; x += 16) {
+        uint8x16_t r0_l = vld1q_u8(in_0 + x - 1);
+        uint8x16_t r0_c = vld1q_u8(in_0 + x);
+        uint8x16_t r0_r = vld1q_u8(in_0 + x + 1);
+        uint8x16_t r1_l = vld1q_u8(in_1 + x - 1);
+        uint8x16_t r1_c = vld1q_u8(in_1 + x);
+        uint8x16_t r1_r = vld1q_u8(in_1 + x + 1);
+        uint8x16_t r2_l = vld1q_u8(in_2 + x - 1);
+        uint8x16_t r2_c = vld1q_u8(in_2 + x);
+        uint8x16_t r2_r = vld1q_u8(in_2 + x + 1);
+        uint8x16_t r3_l = vld1q_u8(in_3 + x - 1);
+        uint8x16_t r3_c = vld1q_u8(in_3 + x);
+        uint8x16_t r3_r = vld1q_u8(in_3 + x + 1);
+
+        bayer2bgr_16px_u8(r0_l, r0_c, r0_r, r1_l, r1_c, r1_r, r2_l, r2_c, r2_r, mask_0, blue_row, edge_aware, out_0 + x * 3);
+        bayer2bgr_16px_u8(r1_l, r1_c, r1_r, r2_l, r2_c, r2_r, r3_l, r3_c, r3_r, mask_1, !blue_row, edge_aware, out_1 + x * 3);
+    }
+    return x;
+}
+
+static int32_t bayer2bgr_oneline_kernel_u8(
+    const uint8_t* in_0,
+    const uint8_t* in_1,
+    const uint8_t* in_2,
+    int32_t width,
+    bool green_even,
+    bool blue_row,
+    bool edge_aware,
+    uint8_t* out)
+{
+    uint8x16_t mask = bayer_color_mask(green_even);
+    int32_t x = 1;
+    for (; x <= width - 17; x += 16) {
+        bayer2bgr_16px_u8(
+            vld1q_u8(in_0 + x - 1),
+            vld1q_u8(in_0 + x),
+            vld1q_u8(in_0 + x + 1),
+            vld1q_u8(in_1 + x - 1),
+            vld1q_u8(in_1 + x),
+            vld1q_u8(in_1 + x + 1),
+            vld1q_u8(in_2 + x - 1),
+            vld1q_u8(in_2 + x),
+            vld1q_u8(in_2 + x + 1),
+            mask,
+            blue_row,
+            edge_aware,
+            out + x * 3);
+    }
+    return x;
+}
+
+static inline void bayer_fill_row_ends(int32_t width, uint8_t* dst)
+{
+    memcpy(dst, dst + 3, 3);
+    memcpy(dst + (width - 1) * 3, dst + (width - 2) * 3, 3);
+}
+
+// Interior pixels follow the usual bilinear rules; the outermost rows and
+// columns are copied from their inner neighbours, which matches OpenCV.
+static void bayer2bgr_u8(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outWidthStride,
+    uint8_t* outData,
+    bool start_with_green,
+    bool blue_row0,
+    bool edge_aware)
+{
+    int32_t y = 1;
+    for (; y <= height - 3; y += 2) {
+        const uint8_t* in_0 = inData + (y - 1) * inWidthStride;
+        const uint8_t* in_1 = in_0 + inWidthStride;
+        const uint8_t* in_2 = in_1 + inWidthStride;
+        const uint8_t* in_3 = in_2 + inWidthStride;
+        uint8_t* out_0 = outData + y * outWidthStride;
+        uint8_t* out_1 = out_0 + outWidthStride;
+        // row y is odd, so its flags are the flipped flags of row 0
+        bool green_even = !start_with_green;
+        bool blue_row = !blue_row0;
+
+        int32_t x = bayer2bgr_twoline_kernel_u8(in_0, in_1, in_2, in_3, width, green_even, blue_row, edge_aware, out_0, out_1);
+        bayer2bgr_scalar_u8(in_0, in_1, in_2, x, width - 1, green_even, blue_row, edge_aware, out_0);
+        bayer2bgr_scalar_u8(in_1, in_2, in_3, x, width - 1, !green_even, !blue_row, edge_aware, out_1);
+        bayer_fill_row_ends(width, out_0);
+        bayer_fill_row_ends(width, out_1);
+    }
+    for (; y <= height - 2; ++y) {
+        const uint8_t* in_0 = inData + (y - 1) * inWidthStride;
+        const uint8_t* in_1 = in_0 + inWidthStride;
+        const uint8_t* in_2 = in_1 + inWidthStride;
+        uint8_t* out = outData + y * outWidthStride;
+        bool green_even = start_with_green == ((y & 1) == 0);
+        bool blue_row = blue_row0 == ((y & 1) == 0);
+
+        int32_t x = bayer2bgr_oneline_kernel_u8(in_0, in_1, in_2, width, green_even, blue_row, edge_aware, out);
+        bayer2bgr_scalar_u8(in_0, in_1, in_2, x, width - 1, green_even, blue_row, edge_aware, out);
+        bayer_fill_row_ends(width, out);
+    }
+
+    memcpy(outData, outData + outWidthStride, width * 3);
+    memcpy(outData + (height - 1) * outWidthStride, outData + (height - 2) * outWidthStride, width * 3);
+}
+
+static void bayer2bgr_half_u8(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outWidthStride,
+    uint8_t* outData,
+    bool start_with_green,
+    bool blue_row0)
+{
+    int32_t out_height = height / 2;
+    int32_t out_width = width / 2;
+    for (int32_t i = 0; i < out_height; ++i) {
+        const uint8_t* in_0 = inData + 2 * i * inWidthStride;
+        const uint8_t* in_1 = in_0 + inWidthStride;
+        uint8_t* out = outData + i * outWidthStride;
+
+        int32_t j = 0;
+        for (; j <= out_width - 16; j += 16) {
+            uint8x16x2_t v_row0 = vld2q_u8(in_0 + j * 2);
+            uint8x16x2_t v_row1 = vld2q_u8(in_1 + j * 2);
+
+            uint8x16_t c0, c1, g;
+            if (start_with_green) {
+                g = vrhaddq_u8(v_row0.val[0], v_row1.val[1]);
+                c0 = v_row0.val[1];
+                c1 = v_row1.val[0];
+            } else {
+                g = vrhaddq_u8(v_row0.val[1], v_row1.val[0]);
+                c0 = v_row0.val[0];
+                c1 = v_row1.val[1];
+            }
+            uint8x16x3_t v_dst;
+            v_dst.val[0] = blue_row0 ? c0 : c1;
+            v_dst.val[1] = g;
+            v_dst.val[2] = blue_row0 ? c1 : c0;
+            vst3q_u8(out + j * 3, v_dst);
+        }
+        for (; j < out_width; ++j) {
+            int32_t p00 = in_0[j * 2], p01 = in_0[j * 2 + 1];
+            int32_t p10 = in_1[j * 2], p11 = in_1[j * 2 + 1];
+            int32_t g = start_with_green ? (p00 + p11 + 1) >> 1 : (p01 + p10 + 1) >> 1;
+            int32_t c0 = start_with_green ? p01 : p00;
+            int32_t c1 = start_with_green ? p10 : p11;
+            out[j * 3 + 0] = (uint8_t)(blue_row0 ? c0 : c1);
+            out[j * 3 + 1] = (uint8_t)g;
+            out[j * 3 + 2] = (uint8_t)(blue_row0 ? c1 : c0);
+        }
+    }
+}
+
+#define BAYER2BGR_IMPL(pattern, start_with_green, blue_row0)                                                                  \
+    template <>                                                                                                               \
+    void Bayer##pattern##2BGR<uint8_t>(                                                                                       \
+        int32_t height,                                                                                                       \
+        int32_t width,                                                                                                        \
+        int32_t inWidthStride,                                                                                                \
+        const uint8_t* inData,                                                                                                \
+        int32_t outWidthStride,                                                                                               \
+        uint8_t* outData)                                                                                                     \
+    {                                                                                                                         \
+        if (nullptr == inData || nullptr == outData) {                                                                        \
+            return;                                                                                                           \
+        }                                                                                                                     \
+        if (width < 3 || height < 3 || inWidthStride < width || outWidthStride < width * 3) {                                 \
+            return;                                                                                                           \
+        }                                                                                                                     \
+        bayer2bgr_u8(height, width, inWidthStride, inData, outWidthStride, outData, start_with_green, blue_row0, false);      \
+    }                                                                                                                         \
+    template <>                                                                                                               \
+    void Bayer##pattern##2BGR_EA<uint8_t>(                                                                                    \
+        int32_t height,                                                                                                       \
+        int32_t width,                                                                                                        \
+        int32_t inWidthStride,                                                                                                \
+        const uint8_t* inData,                                                                                                \
+        int32_t outWidthStride,                                                                                               \
+        uint8_t* outData)                                                                                                     \
+    {                                                                                                                         \
+        if (nullptr == inData || nullptr == outData) {                                                                        \
+            return;                                                                                                           \
+        }                                                                                                                     \
+        if (width < 3 || height < 3 || inWidthStride < width || outWidthStride < width * 3) {                                 \
+            return;                                                                                                           \
+        }                                                                                                                     \
+        bayer2bgr_u8(height, width, inWidthStride, inData, outWidthStride, outData, start_with_green, blue_row0, true);       \
+    }                                                                                                                         \
+    template <>                                                                                                               \
+    void Bayer##pattern##2BGRHalf<uint8_t>(                                                                                   \
+        int32_t height,                                                                                                       \
+        int32_t width,                                                                                                        \
+        int32_t inWidthStride,                                                                                                \
+        const uint8_t* inData,                                                                                                \
+        int32_t outWidthStride,                                                                                               \
+        uint8_t* outData)                                                                                                     \
+    {                                                                                                                         \
+        if (nullptr == inData || nullptr == outData) {                                                                        \
+            return;                                                                                                           \
+        }                                                                                                                     \
+        if (width < 2 || height < 2 || inWidthStride < width || outWidthStride < (width / 2) * 3) {                           \
+            return;                                                                                                           \
+        }                                                                                                                     \
+        bayer2bgr_half_u8(height, width, inWidthStride, inData, outWidthStride, outData, start_with_green, blue_row0);        \
+    }
+
+// OpenCV names a pattern after the second row, second and third columns:
+// BayerBG is RGGB, BayerGB is GRBG, BayerRG is BGGR and BayerGR is GBRG.
+BAYER2BGR_IMPL(BG, false, false)
+BAYER2BGR_IMPL(GB, true, false)
+BAYER2BGR_IMPL(RG, false, true)
+BAYER2BGR_IMPL(GR, true, true)
+
+#undef BAYER2BGR_IMPL
+
+} // namespace tinycv
@@ -0,0 +1,163 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/cvtcolor.h"
+#include "tinycv/arm/test.h"
+#include "tinycv/debug.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+enum BayerMode { BAYERBG_MODE,
+                 BAYERGB_MODE,
+                 BAYERRG_MODE,
+                 BAYERGR_MODE };
+
+// top-left 2x2 cell of every pattern, in the order of BayerMode
+static const char *bayer_cells[] = {"RGGB", "GRBG", "BGGR", "GBRG"};
+
+template <BayerMode mode>
+void BayerTest(int32_t height, int32_t width)
+{
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst_ref(new uint8_t[width * height * 3]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height * 3]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<uint8_t>::depth, 1), src.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(cv::DataType<uint8_t>::depth, 3), dst_ref.get());
+    if (mode == BAYERBG_MODE) {
+        tinycv::BayerBG2BGR<uint8_t>(height, width, width, src.get(), width * 3, dst.get());
+        cv::cvtColor(srcMat, dstMat, cv::COLOR_BayerBG2BGR);
+    } else if (mode == BAYERGB_MODE) {
+        tinycv::BayerGB2BGR<uint8_t>(height, width, width, src.get(), width * 3, dst.get());
+        cv::cvtColor(srcMat, dstMat, cv::COLOR_BayerGB2BGR);
+    } else if (mode == BAYERRG_MODE) {
+        tinycv::BayerRG2BGR<uint8_t>(height, width, width, src.get(), width * 3, dst.get());
+        cv::cvtColor(srcMat, dstMat, cv::COLOR_BayerRG2BGR);
+    } else if (mode == BAYERGR_MODE) {
+        tinycv::BayerGR2BGR<uint8_t>(height, width, width, src.get(), width * 3, dst.get());
+        cv::cvtColor(srcMat, dstMat, cv::COLOR_BayerGR2BGR);
+    }
+    checkResult<uint8_t, 3>(dst.get(), dst_ref.get(), height, width, width * 3, width * 3, 1.01f);
+}
+
+// On a smooth image every interpolation direction agrees, so the edge-aware
+// result has to stay close to the bilinear one of OpenCV.
+template <BayerMode mode>
+void BayerEATest(int32_t height, int32_t width)
+{
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst_ref(new uint8_t[width * height * 3]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height * 3]);
+    for (int32_t i = 0; i < height; ++i) {
+        for (int32_t j = 0; j < width; ++j) {
+            src[i * width + j] = (uint8_t)((i + j) / 8);
+        }
+    }
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<uint8_t>::depth, 1), src.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(cv::DataType<uint8_t>::depth, 3), dst_ref.get());
+    if (mode == BAYERBG_MODE) {
+        tinycv::BayerBG2BGR_EA<uint8_t>(height, width, width, src.get(), width * 3, dst.get());
+        cv::cvtColor(srcMat, dstMat, cv::COLOR_BayerBG2BGR);
+    } else if (mode == BAYERGB_MODE) {
+        tinycv::BayerGB2BGR_EA<uint8_t>(height, width, width, src.get(), width * 3, dst.get());
+        cv::cvtColor(srcMat, dstMat, cv::COLOR_BayerGB2BGR);
+    } else if (mode == BAYERRG_MODE) {
+        tinycv::BayerRG2BGR_EA<uint8_t>(height, width, width, src.get(), width * 3, dst.get());
+        cv::cvtColor(srcMat, dstMat, cv::COLOR_BayerRG2BGR);
+    } else if (mode == BAYERGR_MODE) {
+        tinycv::BayerGR2BGR_EA<uint8_t>(height, width, width, src.get(), width * 3, dst.get());
+        cv::cvtColor(srcMat, dstMat, cv::COLOR_BayerGR2BGR);
+    }
+    checkResult<uint8_t, 3>(dst.get(), dst_ref.get(), height, width, width * 3, width * 3, 2.01f);
+}
+
+template <BayerMode mode>
+void BayerHalfTest(int32_t height, int32_t width)
+{
+    int32_t out_height = height / 2;
+    int32_t out_width = width / 2;
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst_ref(new uint8_t[out_width * out_height * 3]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[out_width * out_height * 3]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+
+    const char *cell = bayer_cells[mode];
+    for (int32_t i = 0; i < out_height; ++i) {
+        for (int32_t j = 0; j < out_width; ++j) {
+            int32_t b = 0, g = 0, r = 0;
+            for (int32_t k = 0; k < 4; ++k) {
+                int32_t v = src[(2 * i + k / 2) * width + 2 * j + (k & 1)];
+                if (cell[k] == 'B') {
+                    b = v;
+                } else if (cell[k] == 'R') {
+                    r = v;
+                } else {
+                    g += v;
+                }
+            }
+            dst_ref[(i * out_width + j) * 3 + 0] = (uint8_t)b;
+            dst_ref[(i * out_width + j) * 3 + 1] = (uint8_t)((g + 1) >> 1);
+            dst_ref[(i * out_width + j) * 3 + 2] = (uint8_t)r;
+        }
+    }
+
+    if (mode == BAYERBG_MODE) {
+        tinycv::BayerBG2BGRHalf<uint8_t>(height, width, width, src.get(), out_width * 3, dst.get());
+    } else if (mode == BAYERGB_MODE) {
+        tinycv::BayerGB2BGRHalf<uint8_t>(height, width, width, src.get(), out_width * 3, dst.get());
+    } else if (mode == BAYERRG_MODE) {
+        tinycv::BayerRG2BGRHalf<uint8_t>(height, width, width, src.get(), out_width * 3, dst.get());
+    } else if (mode == BAYERGR_MODE) {
+        tinycv::BayerGR2BGRHalf<uint8_t>(height, width, width, src.get(), out_width * 3, dst.get());
+    }
+    checkResult<uint8_t, 3>(dst.get(), dst_ref.get(), out_height, out_width, out_width * 3, out_width * 3, 1.01f);
+}
+
+TEST(BAYER2BGR_UINT8, arm)
+{
+    BayerTest<BAYERBG_MODE>(480, 640);
+    BayerTest<BAYERGB_MODE>(480, 640);
+    BayerTest<BAYERRG_MODE>(480, 640);
+    BayerTest<BAYERGR_MODE>(480, 640);
+    BayerTest<BAYERBG_MODE>(101, 101);
+    BayerTest<BAYERGB_MODE>(101, 101);
+    BayerTest<BAYERRG_MODE>(101, 101);
+    BayerTest<BAYERGR_MODE>(101, 101);
+}
+
+TEST(BAYER2BGR_EA_UINT8, arm)
+{
+    BayerEATest<BAYERBG_MODE>(480, 640);
+    BayerEATest<BAYERGB_MODE>(480, 640);
+    BayerEATest<BAYERRG_MODE>(480, 640);
+    BayerEATest<BAYERGR_MODE>(480, 640);
+    BayerEATest<BAYERBG_MODE>(101, 101);
+    BayerEATest<BAYERGR_MODE>(101, 101);
+}
+
+TEST(BAYER2BGR_HALF_UINT8, arm)
+{
+    BayerHalfTest<BAYERBG_MODE>(480, 640);
+    BayerHalfTest<BAYERGB_MODE>(480, 640);
+    BayerHalfTest<BAYERRG_MODE>(480, 640);
+    BayerHalfTest<BAYERGR_MODE>(480, 640);
+    BayerHalfTest<BAYERBG_MODE>(101, 101);
+    BayerHalfTest<BAYERGR_MODE>(101, 101);
+}
@@ -0,0 +1,296 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/boxfilter.h"
+#include "tinycv/types.h"
+#include "tinycv/sys.h"
+
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <arm_neon.h>
+
+namespace tinycv {
+
+// running sums, wide enough for any kernel area, doubles keep float sums from drifting along a row
+template <typename T>
+struct BoxSum;
+
+template <>
+struct BoxSum<uint8_t> {
+    typedef int32_t type;
+};
+
+template <>
+struct BoxSum<float> {
+    typedef double type;
+};
+
+// all border modes, also valid far outside the image, -1 for BORDER_CONSTANT
+static inline int32_t box_border_interpolate(int32_t p, int32_t len, BorderType border_type)
+{
+    if ((uint32_t)p < (uint32_t)len) {
+        return p;
+    }
+    if (border_type == BORDER_REPLICATE) {
+        p = p < 0 ? 0 : len - 1;
+    } else if (border_type == BORDER_REFLECT || border_type == BORDER_REFLECT_101) {
+        int32_t delta = border_type == BORDER_REFLECT_101;
+        if (len == 1) {
+            return 0;
+        }
+        do {
+            if (p < 0) {
+                p = -p - 1 + delta;
+            } else {
+                p = len - 1 - (p - len) - delta;
+            }
+        } while ((uint32_t)p >= (uint32_t)len);
+    } else {
+        p = -1;
+    }
+    return p;
+}
+
+// sum[i] += src[i]
+template <typename T, typename S>
+static void box_col_add(const T *src, int32_t n, S *sum)
+{
+    for (int32_t i = 0; i < n; ++i) {
+        sum[i] += src[i];
+    }
+}
+
+// sum[i] += add[i] - sub[i], the row entering and the row leaving the kernel
+static void box_col_update(const uint8_t *add, const uint8_t *sub, int32_t n, int32_t *sum)
+{
+    int32_t i = 0;
+    for (; i <= n - 16; i += 16) {
+        uint8x16_t a = vld1q_u8(add + i);
+        uint8x16_t s = vld1q_u8(sub + i);
+        int16x8_t dlo = vreinterpretq_s16_u16(vsubl_u8(vget_low_u8(a), vget_low_u8(s)));
+        int16x8_t dhi = vreinterpretq_s16_u16(vsubl_u8(vget_high_u8(a), vget_high_u8(s)));
+        vst1q_s32(sum + i, vaddw_s16(vld1q_s32(sum + i), vget_low_s16(dlo)));
+        vst1q_s32(sum + i + 4, vaddw_s16(vld1q_s32(sum + i + 4), vget_high_s16(dlo)));
+        vst1q_s32(sum + i + 8, vaddw_s16(vld1q_s32(sum + i + 8), vget_low_s16(dhi)));
+        vst1q_s32(sum + i + 12, vaddw_s16(vld1q_s32(sum + i + 12), vget_high_s16(dhi)));
+    }
+    for (; i < n; ++i) {
+        sum[i] += add[i] - sub[i];
+    }
+}
+
+static void box_col_update(const float *add, const float *sub, int32_t n, double *sum)
+{
+    int32_t i = 0;
+    for (; i <= n - 4; i += 4) {
+        float32x4_t a = vld1q_f32(add + i);
+        float32x4_t s = vld1q_f32(sub + i);
+        float64x2_t dlo = vsubq_f64(vcvt_f64_f32(vget_low_f32(a)), vcvt_f64_f32(vget_low_f32(s)));
+        float64x2_t dhi = vsubq_f64(vcvt_high_f64_f32(a), vcvt_high_f64_f32(s));
+        vst1q_f64(sum + i, vaddq_f64(vld1q_f64(sum + i), dlo));
+        vst1q_f64(sum + i + 2, vaddq_f64(vld1q_f64(sum + i + 2), dhi));
+    }
+    for (; i < n; ++i) {
+        sum[i] += (double)add[i] - (double)sub[i];
+    }
+}
+
+// slides the horizontal sum along a row of padded column sums, one add and one subtract per pixel, the channels
+// are independent chains. `colSum` holds width + ksize pixels, the last one is only read by the final update.
+template <typename S, int32_t channels>
+static void box_row_sum(const S *colSum, int32_t width, int32_t ksize, S *dst)
+{
+    S s[channels];
+    for (int32_t c = 0; c < channels; ++c) {
+        s[c] = 0;
+    }
+    for (int32_t k = 0; k < ksize; ++k) {
+        for (int32_t c = 0; c < channels; ++c) {
+            s[c] += colSum[k * channels + c];
+        }
+    }
+    for (int32_t x = 0; x < width; ++x) {
+        for (int32_t c = 0; c < channels; ++c) {
+            dst[x * channels + c] = s[c];
+            s[c] += colSum[(x + ksize) * channels + c] - colSum[x * channels + c];
+        }
+    }
+}
+
+// dst = saturate(round(sum * scale)), rounds half to even in single precision like OpenCV's vector path
+static void box_store(const int32_t *sum, int32_t n, double scale, uint8_t *dst)
+{
+    const bool normalize = scale != 1.0;
+    const float fscale = (float)scale;
+    int32_t i = 0;
+    if (normalize) {
+        for (; i <= n - 16; i += 16) {
+            int32x4_t v0 = vcvtnq_s32_f32(vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(sum + i)), fscale));
+            int32x4_t v1 = vcvtnq_s32_f32(vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(sum + i + 4)), fscale));
+            int32x4_t v2 = vcvtnq_s32_f32(vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(sum + i + 8)), fscale));
+            int32x4_t v3 = vcvtnq_s32_f32(vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(sum + i + 12)), fscale));
+            uint16x8_t lo = vcombine_u16(vqmovun_s32(v0), vqmovun_s32(v1));
+            uint16x8_t hi = vcombine_u16(vqmovun_s32(v2), vqmovun_s32(v3));
+            vst1q_u8(dst + i, vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi)));
+        }
+    } else {
+        for (; i <= n - 16; i += 16) {
+            uint16x8_t lo = vcombine_u16(vqmovun_s32(vld1q_s32(sum + i)), vqmovun_s32(vld1q_s32(sum + i + 4)));
+            uint16x8_t hi = vcombine_u16(vqmovun_s32(vld1q_s32(sum + i + 8)), vqmovun_s32(vld1q_s32(sum + i + 12)));
+            vst1q_u8(dst + i, vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi)));
+        }
+    }
+    for (; i < n; ++i) {
+        int32_t v = normalize ? (int32_t)lrintf((float)sum[i] * fscale) : sum[i];
+        dst[i] = (uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v));
+    }
+}
+
+static void box_store(const double *sum, int32_t n, double scale, float *dst)
+{
+    int32_t i = 0;
+    for (; i <= n - 4; i += 4) {
+        float32x2_t lo = vcvt_f32_f64(vmulq_n_f64(vld1q_f64(sum + i), scale));
+        vst1q_f32(dst + i, vcvt_high_f32_f64(lo, vmulq_n_f64(vld1q_f64(sum + i + 2), scale)));
+    }
+    for (; i < n; ++i) {
+        dst[i] = (float)(sum[i] * scale);
+    }
+}
+
+template <typename T, int32_t channels>
+void BoxFilter(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t kernelWidth,
+    int32_t kernelHeight,
+    bool normalize,
+    BorderType border_type,
+    T border_value)
+{
+    typedef typename BoxSum<T>::type S;
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * channels || outWidthStride < width * channels) {
+        return;
+    }
+    if (kernelWidth <= 0 || kernelHeight <= 0) {
+        return;
+    }
+    if (border_type != BORDER_CONSTANT && border_type != BORDER_REPLICATE &&
+        border_type != BORDER_REFLECT && border_type != BORDER_REFLECT_101) {
+        return;
+    }
+    const int32_t n = width * channels;
+    const int32_t anchorX = kernelWidth / 2;
+    const int32_t anchorY = kernelHeight / 2;
+    const int32_t numRows = height + kernelHeight - 1;
+    const double scale = normalize ? 1.0 / ((double)kernelWidth * kernelHeight) : 1.0;
+
+    uint64_t size_for_const_row = border_type == BORDER_CONSTANT ? ((uint64_t)n * sizeof(T) + 64 - 1) / 64 * 64 : 0;
+    uint64_t size_for_rows = ((uint64_t)numRows * sizeof(const T *) + 64 - 1) / 64 * 64;
+    uint64_t size_for_border_cols = ((uint64_t)kernelWidth * 2 * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    uint64_t size_for_col_sum = ((uint64_t)(width + kernelWidth) * channels * sizeof(S) + 64 - 1) / 64 * 64;
+    uint64_t size_for_row_sum = ((uint64_t)n * sizeof(S) + 64 - 1) / 64 * 64;
+
+    uint64_t total_size = size_for_const_row + size_for_rows + size_for_border_cols + size_for_col_sum + size_for_row_sum;
+
+    void *temp_buffer = tinycv::ScratchAlloc(total_size, 64);
+    T *constRow = (T *)temp_buffer;
+    const T **rows = (const T **)((unsigned char *)constRow + size_for_const_row);
+    int32_t *borderCols = (int32_t *)((unsigned char *)rows + size_for_rows);
+    S *colSum = (S *)((unsigned char *)borderCols + size_for_border_cols);
+    S *rowSum = (S *)((unsigned char *)colSum + size_for_col_sum);
+
+    //! rows of the vertically padded image, rows outside point at a row of border values
+    if (border_type == BORDER_CONSTANT) {
+        std::fill(constRow, constRow + n, border_value);
+    }
+    for (int32_t p = 0; p < numRows; ++p) {
+        int32_t sy = box_border_interpolate(p - anchorY, height, border_type);
+        rows[p] = sy < 0 ? constRow : inData + (size_t)sy * inWidthStride;
+    }
+    //! padded columns and the image columns they copy, -1 for the constant border
+    int32_t numBorderCols = 0;
+    for (int32_t p = 0; p < width + kernelWidth; ++p) {
+        if (p < anchorX || p >= anchorX + width) {
+            borderCols[numBorderCols++] = p;
+            borderCols[numBorderCols++] = box_border_interpolate(p - anchorX, width, border_type);
+        }
+    }
+
+    //! the column sums of the padded row, the image part is updated in place down the image
+    std::fill(colSum, colSum + (size_t)(width + kernelWidth) * channels, (S)0);
+    S *center = colSum + anchorX * channels;
+    const S constSum = (S)border_value * kernelHeight;
+    for (int32_t k = 0; k < kernelHeight; ++k) {
+        box_col_add(rows[k], n, center);
+    }
+    for (int32_t y = 0; y < height; ++y) {
+        if (y > 0) {
+            box_col_update(rows[y + kernelHeight - 1], rows[y - 1], n, center);
+        }
+        for (int32_t b = 0; b < numBorderCols; b += 2) {
+            S *dst = colSum + borderCols[b] * channels;
+            int32_t sx = borderCols[b + 1];
+            for (int32_t c = 0; c < channels; ++c) {
+                dst[c] = sx < 0 ? constSum : center[sx * channels + c];
+            }
+        }
+        box_row_sum<S, channels>(colSum, width, kernelWidth, rowSum);
+        box_store(rowSum, n, scale, outData + (size_t)y * outWidthStride);
+    }
+
+    tinycv::ScratchFree(temp_buffer);
+}
+
+template <typename T, int32_t channels>
+void Blur(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t kernelWidth,
+    int32_t kernelHeight,
+    BorderType border_type)
+{
+    BoxFilter<T, channels>(height, width, inWidthStride, inData, outWidthStride, outData, kernelWidth, kernelHeight, true, border_type, 0);
+}
+
+template void BoxFilter<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t kernelWidth, int32_t kernelHeight, bool normalize, BorderType border_type, uint8_t border_value);
+template void BoxFilter<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t kernelWidth, int32_t kernelHeight, bool normalize, BorderType border_type, uint8_t border_value);
+template void BoxFilter<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t kernelWidth, int32_t kernelHeight, bool normalize, BorderType border_type, uint8_t border_value);
+template void BoxFilter<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t kernelWidth, int32_t kernelHeight, bool normalize, BorderType border_type, float border_value);
+template void BoxFilter<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t kernelWidth, int32_t kernelHeight, bool normalize, BorderType border_type, float border_value);
+template void BoxFilter<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t kernelWidth, int32_t kernelHeight, bool normalize, BorderType border_type, float border_value);
+
+template void Blur<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t kernelWidth, int32_t kernelHeight, BorderType border_type);
+template void Blur<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t kernelWidth, int32_t kernelHeight, BorderType border_type);
+template void Blur<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t kernelWidth, int32_t kernelHeight, BorderType border_type);
+template void Blur<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t kernelWidth, int32_t kernelHeight, BorderType border_type);
+template void Blur<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t kernelWidth, int32_t kernelHeight, BorderType border_type);
+template void Blur<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t kernelWidth, int32_t kernelHeight, BorderType border_type);
+
+} // namespace tinycv
@@ -0,0 +1,373 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/canny.h"
+#include "tinycv/arm/sobel.hpp"
+#include "tinycv/sys.h"
+
+#include <string.h>
+#include <math.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <arm_neon.h>
+
+#define CANNY_MIN_BAND_PIXELS (1 << 16)
+#define CANNY_SHIFT 15
+#define CANNY_TG22 13573 //! tan(22.5 degrees) in CANNY_SHIFT fixed point
+
+namespace tinycv {
+
+// edge map values, the map has a frame of CANNY_NOT_EDGE one pixel wide
+enum {
+    CANNY_CANDIDATE = 0,
+    CANNY_NOT_EDGE = 1,
+    CANNY_EDGE = 2
+};
+
+// map offsets of edges whose neighbours are still to be grown, a pixel is pushed once, when it becomes an edge
+struct CannyStack {
+    int32_t *base;
+    int32_t *top;
+};
+
+static void canny_magnitude(const int16_t *dx, const int16_t *dy, int32_t width, bool L2gradient, int32_t *mag)
+{
+    int32_t x = 0;
+    if (L2gradient) {
+        for (; x <= width - 8; x += 8) {
+            int16x8_t vx = vld1q_s16(dx + x);
+            int16x8_t vy = vld1q_s16(dy + x);
+            int32x4_t lo = vmlal_s16(vmull_s16(vget_low_s16(vx), vget_low_s16(vx)), vget_low_s16(vy), vget_low_s16(vy));
+            int32x4_t hi = vmlal_s16(vmull_s16(vget_high_s16(vx), vget_high_s16(vx)), vget_high_s16(vy), vget_high_s16(vy));
+            vst1q_s32(mag + x, lo);
+            vst1q_s32(mag + x + 4, hi);
+        }
+        for (; x < width; ++x) {
+            mag[x] = (int32_t)dx[x] * dx[x] + (int32_t)dy[x] * dy[x];
+        }
+    } else {
+        for (; x <= width - 8; x += 8) {
+            //! the absolute value of -32768 is right when read as unsigned
+            uint16x8_t ax = vreinterpretq_u16_s16(vabsq_s16(vld1q_s16(dx + x)));
+            uint16x8_t ay = vreinterpretq_u16_s16(vabsq_s16(vld1q_s16(dy + x)));
+            vst1q_s32(mag + x, vreinterpretq_s32_u32(vaddl_u16(vget_low_u16(ax), vget_low_u16(ay))));
+            vst1q_s32(mag + x + 4, vreinterpretq_s32_u32(vaddl_u16(vget_high_u16(ax), vget_high_u16(ay))));
+        }
+        for (; x < width; ++x) {
+            mag[x] = abs(dx[x]) + abs(dy[x]);
+        }
+    }
+}
+
+// non-maximum suppression of one pixel along the gradient direction quantized to 0, 45, 90 or 135 degrees,
+// magP, magA and magN are the magnitude rows above, at and below the pixel
+static inline void canny_pixel(
+    int32_t x,
+    const int16_t *dx,
+    const int16_t *dy,
+    const int32_t *magP,
+    const int32_t *magA,
+    const int32_t *magN,
+    int32_t high,
+    uint8_t *map,
+    int32_t mapOffset,
+    CannyStack &stack)
+{
+    int32_t m = magA[x];
+    int32_t xs = dx[x];
+    int32_t ys = dy[x];
+    int64_t ax = abs(xs);
+    int64_t ay = (int64_t)abs(ys) << CANNY_SHIFT;
+    int64_t tg22x = ax * CANNY_TG22;
+    bool maximum;
+    if (ay < tg22x) {
+        maximum = m > magA[x - 1] && m >= magA[x + 1];
+    } else if (ay > tg22x + (ax << (CANNY_SHIFT + 1))) {
+        maximum = m > magP[x] && m >= magN[x];
+    } else {
+        int32_t s = (xs ^ ys) < 0 ? -1 : 1;
+        maximum = m > magP[x - s] && m > magN[x + s];
+    }
+    if (!maximum) {
+        return;
+    }
+    if (m > high) {
+        map[x] = CANNY_EDGE;
+        *stack.top++ = mapOffset + x;
+    } else {
+        map[x] = CANNY_CANDIDATE;
+    }
+}
+
+// suppression of a map row, only pixels above the low threshold are looked at
+static void canny_suppress(
+    int32_t width,
+    const int16_t *dx,
+    const int16_t *dy,
+    const int32_t *magP,
+    const int32_t *magA,
+    const int32_t *magN,
+    int32_t low,
+    int32_t high,
+    uint8_t *map,
+    int32_t mapOffset,
+    CannyStack &stack)
+{
+    memset(map, CANNY_NOT_EDGE, width);
+    const int32x4_t vlow = vdupq_n_s32(low);
+    int32_t x = 0;
+    for (; x <= width - 8; x += 8) {
+        uint32x4_t lo = vcgtq_s32(vld1q_s32(magA + x), vlow);
+        uint32x4_t hi = vcgtq_s32(vld1q_s32(magA + x + 4), vlow);
+        //! one byte per pixel, all ones above the low threshold
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(vcombine_u16(vmovn_u32(lo), vmovn_u32(hi)))), 0);
+        while (mask) {
+            int32_t i = __builtin_ctzll(mask) >> 3;
+            canny_pixel(x + i, dx, dy, magP, magA, magN, high, map, mapOffset, stack);
+            mask &= ~((uint64_t)0xff << (i * 8));
+        }
+    }
+    for (; x < width; ++x) {
+        if (magA[x] > low) {
+            canny_pixel(x, dx, dy, magP, magA, magN, high, map, mapOffset, stack);
+        }
+    }
+}
+
+// grows edges from the map offsets on the stack into candidate neighbours, offsets outside [begin, end) belong
+// to other bands and are left alone
+static void canny_hysteresis(uint8_t *map, int32_t mapStep, int32_t begin, int32_t end, CannyStack &stack)
+{
+    auto grow = [&](int32_t o) {
+        if (map[o] == CANNY_CANDIDATE) {
+            map[o] = CANNY_EDGE;
+            *stack.top++ = o;
+        }
+    };
+    while (stack.top != stack.base) {
+        int32_t o = *--stack.top;
+        grow(o - 1);
+        grow(o + 1);
+        if (o - mapStep >= begin) {
+            grow(o - mapStep - 1);
+            grow(o - mapStep);
+            grow(o - mapStep + 1);
+        }
+        if (o + mapStep < end) {
+            grow(o + mapStep - 1);
+            grow(o + mapStep);
+            grow(o + mapStep + 1);
+        }
+    }
+}
+
+// output rows [y0, y1) of the edge map, the derivative and magnitude rows stream through a ring of three
+template <typename T>
+static void canny_band(
+    int32_t y0,
+    int32_t y1,
+    int32_t height,
+    int32_t width,
+    T &filterX,
+    T &filterY,
+    bool L2gradient,
+    int32_t low,
+    int32_t high,
+    uint8_t *map,
+    CannyStack &stack,
+    int16_t *derivs,
+    int32_t *mags)
+{
+    const int32_t mapStep = width + 2;
+    //! magnitude rows keep a zero on both sides for the horizontal neighbours
+    memset(mags, 0, (size_t)3 * (width + 2) * sizeof(int32_t));
+    for (int32_t r = y0 - 1; r <= y1; ++r) {
+        int32_t slot = (r + 3) % 3;
+        int32_t *mag = mags + (size_t)slot * (width + 2) + 1;
+        if (r >= 0 && r < height) {
+            int16_t *dx = derivs + (size_t)slot * 2 * width;
+            int16_t *dy = dx + width;
+            filterX(r, dx);
+            filterY(r, dy);
+            canny_magnitude(dx, dy, width, L2gradient, mag);
+        } else {
+            memset(mag, 0, width * sizeof(int32_t));
+        }
+        int32_t y = r - 1;
+        if (y < y0) {
+            continue;
+        }
+        const int16_t *dx = derivs + (size_t)(y % 3) * 2 * width;
+        const int32_t *magP = mags + (size_t)((y + 2) % 3) * (width + 2) + 1;
+        const int32_t *magA = mags + (size_t)(y % 3) * (width + 2) + 1;
+        const int32_t *magN = mags + (size_t)(r % 3) * (width + 2) + 1;
+        int32_t mapOffset = (y + 1) * mapStep + 1;
+        canny_suppress(width, dx, dx + width, magP, magA, magN, low, high, map + mapOffset, mapOffset, stack);
+    }
+    canny_hysteresis(map, mapStep, (y0 + 1) * mapStep, (y1 + 1) * mapStep, stack);
+}
+
+// pushes the candidates next to an edge across the seam between map rows `row - 1` and `row`
+static void canny_seam(uint8_t *map, int32_t mapStep, int32_t width, int32_t row, CannyStack &stack)
+{
+    for (int32_t side = 0; side < 2; ++side) {
+        int32_t from = (row - 1 + side) * mapStep;
+        int32_t to = (row - side) * mapStep;
+        for (int32_t x = 1; x <= width; ++x) {
+            if (map[from + x] != CANNY_EDGE) {
+                continue;
+            }
+            for (int32_t o = to + x - 1; o <= to + x + 1; ++o) {
+                if (map[o] == CANNY_CANDIDATE) {
+                    map[o] = CANNY_EDGE;
+                    *stack.top++ = o;
+                }
+            }
+        }
+    }
+}
+
+static void canny_output(const uint8_t *map, int32_t mapStep, int32_t y0, int32_t y1, int32_t width, int32_t outWidthStride, uint8_t *outData)
+{
+    const uint8x16_t edge = vdupq_n_u8(CANNY_EDGE);
+    for (int32_t y = y0; y < y1; ++y) {
+        const uint8_t *src = map + (size_t)(y + 1) * mapStep + 1;
+        uint8_t *dst = outData + (size_t)y * outWidthStride;
+        int32_t x = 0;
+        for (; x <= width - 16; x += 16) {
+            vst1q_u8(dst + x, vceqq_u8(vld1q_u8(src + x), edge));
+        }
+        for (; x < width; ++x) {
+            dst[x] = src[x] == CANNY_EDGE ? 255 : 0;
+        }
+    }
+}
+
+static inline int32_t canny_threshold(double t)
+{
+    t = floor(t);
+    return t < -2147483648.0 ? INT32_MIN : (t > 2147483647.0 ? INT32_MAX : (int32_t)t);
+}
+
+void Canny(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    double threshold1,
+    double threshold2,
+    int32_t apertureSize,
+    bool L2gradient,
+    int32_t numThreads)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width || outWidthStride < width) {
+        return;
+    }
+    if (apertureSize != -1 && apertureSize != 3 && apertureSize != 5 && apertureSize != 7) {
+        return;
+    }
+    DerivKernel dxKernelX, dxKernelY, dyKernelX, dyKernelY;
+    DerivKernels(1, 0, apertureSize, dxKernelX, dxKernelY);
+    DerivKernels(0, 1, apertureSize, dyKernelX, dyKernelY);
+
+    if (threshold1 > threshold2) {
+        std::swap(threshold1, threshold2);
+    }
+    //! like OpenCV, 7x7 derivatives and thresholds are scaled by 1/16 so that the gradients fit in int16
+    float scale = 1.0f;
+    if (7 == apertureSize) {
+        scale = 1.0f / 16;
+        threshold1 /= 16.0;
+        threshold2 /= 16.0;
+    }
+    if (L2gradient) {
+        //! magnitudes are compared squared
+        threshold1 = std::min(32767.0, threshold1);
+        threshold2 = std::min(32767.0, threshold2);
+        threshold1 = threshold1 > 0 ? threshold1 * threshold1 : threshold1;
+        threshold2 = threshold2 > 0 ? threshold2 * threshold2 : threshold2;
+    }
+    const int32_t low = canny_threshold(threshold1);
+    const int32_t high = canny_threshold(threshold2);
+
+    const int32_t mapStep = width + 2;
+    int32_t bands = (int32_t)std::min<int64_t>((int64_t)height * width / CANNY_MIN_BAND_PIXELS, height);
+    bands = std::max(std::min(bands, numThreads), 1);
+    typedef DerivRowFilter<uint8_t, int16_t, 1> Filter;
+
+    //! a pixel is pushed at most once, so band b stacks from y0 * width and the seams may use the whole stack
+    uint64_t size_for_map = ((uint64_t)(height + 2) * mapStep + 64 - 1) / 64 * 64;
+    uint64_t size_for_stack = ((uint64_t)height * width * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    uint64_t size_for_derivs = ((uint64_t)6 * width * sizeof(int16_t) + 64 - 1) / 64 * 64;
+    uint64_t size_for_mags = ((uint64_t)3 * (width + 2) * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    uint64_t size_for_filter_x = Filter::BufferSize(height, width, dxKernelX, dxKernelY);
+    uint64_t size_for_filter_y = Filter::BufferSize(height, width, dyKernelX, dyKernelY);
+    uint64_t size_for_band = size_for_derivs + size_for_mags + size_for_filter_x + size_for_filter_y;
+
+    uint64_t total_size = size_for_map + size_for_stack + size_for_band * bands;
+
+    void *temp_buffer = tinycv::ScratchAlloc(total_size, 64);
+    uint8_t *map = (uint8_t *)temp_buffer;
+    int32_t *stackData = (int32_t *)((unsigned char *)map + size_for_map);
+    unsigned char *bandBuffers = (unsigned char *)stackData + size_for_stack;
+
+    memset(map, CANNY_NOT_EDGE, mapStep);
+    memset(map + (size_t)(height + 1) * mapStep, CANNY_NOT_EDGE, mapStep);
+    for (int32_t y = 1; y <= height; ++y) {
+        map[(size_t)y * mapStep] = CANNY_NOT_EDGE;
+        map[(size_t)y * mapStep + width + 1] = CANNY_NOT_EDGE;
+    }
+
+    ParallelFor(bands, bands, [&](int32_t b0, int32_t b1) {
+        for (int32_t b = b0; b < b1; ++b) {
+            unsigned char *buffer = bandBuffers + size_for_band * b;
+            int16_t *derivs = (int16_t *)buffer;
+            int32_t *mags = (int32_t *)(buffer + size_for_derivs);
+            unsigned char *filterBuffer = buffer + size_for_derivs + size_for_mags;
+            Filter filterX(height, width, inWidthStride, inData, dxKernelX, dxKernelY, scale, 0.0f, BORDER_REPLICATE, filterBuffer);
+            Filter filterY(height, width, inWidthStride, inData, dyKernelX, dyKernelY, scale, 0.0f, BORDER_REPLICATE, filterBuffer + size_for_filter_x);
+            int32_t y0 = (int32_t)((int64_t)height * b / bands);
+            int32_t y1 = (int32_t)((int64_t)height * (b + 1) / bands);
+            CannyStack stack = {stackData + (size_t)y0 * width, stackData + (size_t)y0 * width};
+            canny_band(y0, y1, height, width, filterX, filterY, L2gradient, low, high, map, stack, derivs, mags);
+        }
+    });
+
+    if (bands > 1) {
+        //! each band stopped at its seams, edges are continued across them and may then run through any band
+        CannyStack stack = {stackData, stackData};
+        for (int32_t b = 1; b < bands; ++b) {
+            canny_seam(map, mapStep, width, (int32_t)((int64_t)height * b / bands) + 1, stack);
+        }
+        canny_hysteresis(map, mapStep, 0, (height + 2) * mapStep, stack);
+    }
+
+    ParallelFor(bands, bands, [&](int32_t b0, int32_t b1) {
+        for (int32_t b = b0; b < b1; ++b) {
+            canny_output(map, mapStep, (int32_t)((int64_t)height * b / bands), (int32_t)((int64_t)height * (b + 1) / bands), width, outWidthStride, outData);
+        }
+    });
+
+    tinycv::ScratchFree(temp_buffer);
+}
+
+} // namespace tinycv
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/canny.h"
+#include "tinycv/debug.h"
+
+#include <opencv2/imgproc.hpp>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace {
+
+template <int32_t apertureSize, bool L2gradient>
+void BM_Canny_tinycv_arm(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t numThreads = state.range(2);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::Canny(height, width, width, src.get(), width, dst.get(), 50, 150, apertureSize, L2gradient, numThreads);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_Canny_tinycv_arm, 3, false)->Args({640, 480, 1})->Args({1920, 1080, 1})->Args({1920, 1080, 4});
+BENCHMARK_TEMPLATE(BM_Canny_tinycv_arm, 3, true)->Args({640, 480, 1})->Args({1920, 1080, 1})->Args({1920, 1080, 4});
+BENCHMARK_TEMPLATE(BM_Canny_tinycv_arm, 5, false)->Args({640, 480, 1})->Args({1920, 1080, 1});
+
+#ifdef TINYCV_BENCHMARK_OPENCV
+template <int32_t apertureSize, bool L2gradient>
+static void BM_Canny_opencv_arm(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat oMat;
+    for (auto _ : state) {
+        cv::Canny(iMat, oMat, 50, 150, apertureSize, L2gradient);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_Canny_opencv_arm, 3, false)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Canny_opencv_arm, 3, true)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Canny_opencv_arm, 5, false)->Args({640, 480})->Args({1920, 1080});
+
+#endif //! TINYCV_BENCHMARK_OPENCV
+} // namespace
@@ -16,6 +16,8 @@
 // under the License.
 
 #include "tinycv/cvtcolor.h"
+#include "tinycv/threshold.h"
+#include "tinycv/arm/threshold.hpp"
 #include "tinycv/arm/typetraits.hpp"
 #include "tinycv/types.h"
 
@@ -24,7 +26,55 @@
 
 namespace tinycv {
 
-template <int32_t ncSrc, int32_t ncDst>
+// Writes the gray values as they are.
+struct Bgr2GrayStore {
+    inline void operator()(uint8_t* dst, uint8x8_t gray) const
+    {
+        vst1_u8(dst, gray);
+    }
+    inline void operator()(uint8_t* dst, uint8_t gray) const
+    {
+        *dst = gray;
+    }
+};
+
+// Thresholds the gray values before they are written.
+template <int32_t type>
+struct Bgr2GrayThresholdStore {
+    Bgr2GrayThresholdStore(uint8_t thresh, uint8_t maxval)
+        : op(thresh, maxval) {}
+    inline void operator()(uint8_t* dst, uint8x8_t gray) const
+    {
+        vst1_u8(dst, op(gray));
+    }
+    inline void operator()(uint8_t* dst, uint8_t gray) const
+    {
+        *dst = op(gray);
+    }
+    ThresholdOpU8<type> op;
+};
+
+// Counts the gray values into a histogram, nothing is written to the destination.
+struct Bgr2GrayHistStore {
+    explicit Bgr2GrayHistStore(uint32_t* h)
+        : hist(h) {}
+    inline void operator()(uint8_t*, uint8x8_t gray) const
+    {
+        uint64_t v = vget_lane_u64(vreinterpret_u64_u8(gray), 0);
+        for (int32_t k = 0; k < 64; k += 8) {
+            ++hist[(v >> k) & 0xff];
+        }
+    }
+    inline void operator()(uint8_t*, uint8_t gray) const
+    {
+        ++hist[gray];
+    }
+    uint32_t* hist;
+};
+
+// Converts 8 pixels per iteration and hands every gray vector to `store`, so the same loop either
+// writes the gray image or consumes the gray values in registers.
+template <int32_t ncSrc, typename Store>
 void cvt_color_bgr2gray_uint8_t(
     const int32_t height,
     const int32_t width,
@@ -32,7 +82,8 @@ void cvt_color_bgr2gray_uint8_t(
     const uint8_t* src,
     const int32_t dstStride,
     uint8_t* dst,
-    bool isBGR)
+    bool isBGR,
+    const Store& store)
 {
     if (!src || !dst || height == 0 || width == 0 || srcStride == 0 || dstStride == 0) {
         return;
@@ -41,7 +92,6 @@ void cvt_color_bgr2gray_uint8_t(
     uint8_t* dstPtr = dst;
 
     typedef typename DT<ncSrc, uint8_t>::vec_DT srcType;
-    typedef typename DT<ncDst, uint8_t>::vec_DT dstType;
 
     uint8_t k_r = 77; // 0.299;
     uint8_t k_g = 150; // 0.587;
@@ -70,9 +120,7 @@ void cvt_color_bgr2gray_uint8_t(
             v_tmp = vmlal_u8(v_tmp, v_src0.val[2], v_kr);
             v_tmp = vaddw_u8(v_tmp, v_SHIFT_LEFT);
 
-            dstType v_dst0 = vshrn_n_u16(v_tmp, 8);
-
-            vstx_u8_f32<ncDst, uint8_t, dstType>(dstPtr + ncDst * i, v_dst0);
+            store(dstPtr + i, vshrn_n_u16(v_tmp, 8));
         }
 
         for (; i < width; i++) {
@@ -81,7 +129,7 @@ void cvt_color_bgr2gray_uint8_t(
             int32_t gray = (k_r * r + k_b * b + k_g * g + SHIFT_LEFT) >> 8;
             gray = gray > 255 ? 255 : gray;
 
-            dstPtr[ncDst * i] = (uint8_t)gray;
+            store(dstPtr + i, (uint8_t)gray);
         }
     }
 }
@@ -248,6 +296,118 @@ void cvt_color_gray2bgr_f32(
     }
 }
 
+template <int32_t ncSrc>
+void cvt_color_bgr2gray_f16(
+    const int32_t height,
+    const int32_t width,
+    const int32_t srcStride,
+    const half_t* src,
+    const int32_t dstStride,
+    half_t* dst,
+    bool isBGR)
+{
+    if (!src || !dst || height == 0 || width == 0 || srcStride == 0 || dstStride == 0) {
+        return;
+    }
+    const uint16_t* srcPtr = reinterpret_cast<const uint16_t*>(src);
+    uint16_t* dstPtr = reinterpret_cast<uint16_t*>(dst);
+
+    float k_r = 0.299;
+    float k_g = 0.587;
+    float k_b = 0.114;
+    if (!isBGR) {
+        float temp = k_r;
+        k_r = k_b;
+        k_b = temp;
+    }
+    float32x4_t v_kr = vdupq_n_f32(k_r);
+    float32x4_t v_kg = vdupq_n_f32(k_g);
+    float32x4_t v_kb = vdupq_n_f32(k_b);
+
+    for (int32_t k = 0; k < height; k++, srcPtr += srcStride, dstPtr += dstStride) {
+        int32_t i = 0;
+        for (; i <= width - 8; i += 8) {
+            uint16x8_t v_b, v_g, v_r;
+            if (ncSrc == 3) {
+                uint16x8x3_t v_src = vld3q_u16(srcPtr + 3 * i);
+                v_b = v_src.val[0];
+                v_g = v_src.val[1];
+                v_r = v_src.val[2];
+            } else {
+                uint16x8x4_t v_src = vld4q_u16(srcPtr + 4 * i);
+                v_b = v_src.val[0];
+                v_g = v_src.val[1];
+                v_r = v_src.val[2];
+            }
+
+            float32x4_t v_dst0 = vmulq_f32(vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(v_b))), v_kb);
+            v_dst0 = vmlaq_f32(v_dst0, vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(v_g))), v_kg);
+            v_dst0 = vmlaq_f32(v_dst0, vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(v_r))), v_kr);
+
+            float32x4_t v_dst1 = vmulq_f32(vcvt_f32_f16(vreinterpret_f16_u16(vget_high_u16(v_b))), v_kb);
+            v_dst1 = vmlaq_f32(v_dst1, vcvt_f32_f16(vreinterpret_f16_u16(vget_high_u16(v_g))), v_kg);
+            v_dst1 = vmlaq_f32(v_dst1, vcvt_f32_f16(vreinterpret_f16_u16(vget_high_u16(v_r))), v_kr);
+
+            vst1q_u16(dstPtr + i, vcombine_u16(vreinterpret_u16_f16(vcvt_f16_f32(v_dst0)), vreinterpret_u16_f16(vcvt_f16_f32(v_dst1))));
+        }
+
+        const half_t* srcRow = reinterpret_cast<const half_t*>(srcPtr);
+        half_t* dstRow = reinterpret_cast<half_t*>(dstPtr);
+        for (; i < width; i++) {
+            float b = srcRow[ncSrc * i], g = srcRow[ncSrc * i + 1], r = srcRow[ncSrc * i + 2];
+            dstRow[i] = half_t(k_r * r + k_b * b + k_g * g);
+        }
+    }
+}
+
+template <int32_t ncDst>
+void cvt_color_gray2bgr_f16(
+    const int32_t height,
+    const int32_t width,
+    const int32_t srcStride,
+    const half_t* src,
+    const int32_t dstStride,
+    half_t* dst)
+{
+    if (!src || !dst || height == 0 || width == 0 || srcStride == 0 || dstStride == 0) {
+        return;
+    }
+    const uint16_t* srcPtr = reinterpret_cast<const uint16_t*>(src);
+    uint16_t* dstPtr = reinterpret_cast<uint16_t*>(dst);
+    const uint16_t alpha = half_t(1.0f).bits;
+
+    for (int32_t k = 0; k < height; k++, srcPtr += srcStride, dstPtr += dstStride) {
+        int32_t i = 0;
+        for (; i <= width - 8; i += 8) {
+            uint16x8_t v_gray = vld1q_u16(srcPtr + i);
+            if (ncDst == 3) {
+                uint16x8x3_t v_dst;
+                v_dst.val[0] = v_gray;
+                v_dst.val[1] = v_gray;
+                v_dst.val[2] = v_gray;
+                vst3q_u16(dstPtr + 3 * i, v_dst);
+            } else {
+                uint16x8x4_t v_dst;
+                v_dst.val[0] = v_gray;
+                v_dst.val[1] = v_gray;
+                v_dst.val[2] = v_gray;
+                v_dst.val[3] = vdupq_n_u16(alpha);
+                vst4q_u16(dstPtr + 4 * i, v_dst);
+            }
+        }
+
+        for (; i < width; i++) {
+            uint16_t gray = srcPtr[i];
+
+            dstPtr[ncDst * i] = gray;
+            dstPtr[ncDst * i + 1] = gray;
+            dstPtr[ncDst * i + 2] = gray;
+            if (ncDst == 4)
+                dstPtr[4 * i + 3] = alpha;
+        }
+    }
+}
+
 template <>
 void BGR2GRAY<uint8_t>(
     int32_t height,
@@ -257,7 +417,7 @@ void BGR2GRAY<uint8_t>(
     int32_t outWidthStride,
     uint8_t* outData)
 {
-    cvt_color_bgr2gray_uint8_t<3, 1>(height, width, inWidthStride, inData, outWidthStride, outData, true);
+    cvt_color_bgr2gray_uint8_t<3>(height, width, inWidthStride, inData, outWidthStride, outData, true, Bgr2GrayStore());
 }
 template <>
 void BGRA2GRAY<uint8_t>(
@@ -268,7 +428,7 @@ void BGRA2GRAY<uint8_t>(
     int32_t outWidthStride,
     uint8_t* outData)
 {
-    cvt_color_bgr2gray_uint8_t<4, 1>(height, width, inWidthStride, inData, outWidthStride, outData, true);
+    cvt_color_bgr2gray_uint8_t<4>(height, width, inWidthStride, inData, outWidthStride, outData, true, Bgr2GrayStore());
 }
 template <>
 void BGR2GRAY<float>(
@@ -347,7 +507,7 @@ void RGB2GRAY<uint8_t>(
     int32_t outWidthStride,
     uint8_t* outData)
 {
-    cvt_color_bgr2gray_uint8_t<3, 1>(height, width, inWidthStride, inData, outWidthStride, outData, false);
+    cvt_color_bgr2gray_uint8_t<3>(height, width, inWidthStride, inData, outWidthStride, outData, false, Bgr2GrayStore());
 }
 template <>
 void RGBA2GRAY<uint8_t>(
@@ -358,7 +518,7 @@ void RGBA2GRAY<uint8_t>(
     int32_t outWidthStride,
     uint8_t* outData)
 {
-    cvt_color_bgr2gray_uint8_t<4, 1>(height, width, inWidthStride, inData, outWidthStride, outData, false);
+    cvt_color_bgr2gray_uint8_t<4>(height, width, inWidthStride, inData, outWidthStride, outData, false, Bgr2GrayStore());
 }
 template <>
 void RGB2GRAY<float>(
@@ -428,4 +588,171 @@ void GRAY2RGBA<float>(
     cvt_color_gray2bgr_f32<1, 4>(height, width, inWidthStride, inData, outWidthStride, outData);
 }
 
+
+template <>
+void BGR2GRAY<half_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    cvt_color_bgr2gray_f16<3>(height, width, inWidthStride, inData, outWidthStride, outData, true);
+}
+template <>
+void BGRA2GRAY<half_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    cvt_color_bgr2gray_f16<4>(height, width, inWidthStride, inData, outWidthStride, outData, true);
+}
+template <>
+void RGB2GRAY<half_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    cvt_color_bgr2gray_f16<3>(height, width, inWidthStride, inData, outWidthStride, outData, false);
+}
+template <>
+void RGBA2GRAY<half_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    cvt_color_bgr2gray_f16<4>(height, width, inWidthStride, inData, outWidthStride, outData, false);
+}
+template <>
+void GRAY2BGR<half_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    cvt_color_gray2bgr_f16<3>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+template <>
+void GRAY2BGRA<half_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    cvt_color_gray2bgr_f16<4>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+template <>
+void GRAY2RGB<half_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    cvt_color_gray2bgr_f16<3>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+template <>
+void GRAY2RGBA<half_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    cvt_color_gray2bgr_f16<4>(height, width, inWidthStride, inData, outWidthStride, outData);
+}
+
+static uint8_t bgr2gray_threshold(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outWidthStride,
+    uint8_t* outData,
+    uint8_t thresh,
+    uint8_t maxval,
+    int32_t type,
+    bool isBGR)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return thresh;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * 3 || outWidthStride < width) {
+        return thresh;
+    }
+    int32_t mode = type & ~THRESH_OTSU;
+    if (mode < THRESH_BINARY || mode > THRESH_TOZERO_INV) {
+        return thresh;
+    }
+    if (type & THRESH_OTSU) {
+        uint32_t hist[256] = {0};
+        cvt_color_bgr2gray_uint8_t<3>(height, width, inWidthStride, inData, outWidthStride, outData, isBGR, Bgr2GrayHistStore(hist));
+        thresh = OtsuThreshold(hist);
+    }
+    switch (mode) {
+        case THRESH_BINARY:
+            cvt_color_bgr2gray_uint8_t<3>(height, width, inWidthStride, inData, outWidthStride, outData, isBGR, Bgr2GrayThresholdStore<THRESH_BINARY>(thresh, maxval));
+            break;
+        case THRESH_BINARY_INV:
+            cvt_color_bgr2gray_uint8_t<3>(height, width, inWidthStride, inData, outWidthStride, outData, isBGR, Bgr2GrayThresholdStore<THRESH_BINARY_INV>(thresh, maxval));
+            break;
+        case THRESH_TRUNC:
+            cvt_color_bgr2gray_uint8_t<3>(height, width, inWidthStride, inData, outWidthStride, outData, isBGR, Bgr2GrayThresholdStore<THRESH_TRUNC>(thresh, maxval));
+            break;
+        case THRESH_TOZERO:
+            cvt_color_bgr2gray_uint8_t<3>(height, width, inWidthStride, inData, outWidthStride, outData, isBGR, Bgr2GrayThresholdStore<THRESH_TOZERO>(thresh, maxval));
+            break;
+        case THRESH_TOZERO_INV:
+            cvt_color_bgr2gray_uint8_t<3>(height, width, inWidthStride, inData, outWidthStride, outData, isBGR, Bgr2GrayThresholdStore<THRESH_TOZERO_INV>(thresh, maxval));
+            break;
+        default:
+            break;
+    }
+    return thresh;
+}
+
+uint8_t BGR2GRAYThreshold(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outWidthStride,
+    uint8_t* outData,
+    uint8_t thresh,
+    uint8_t maxval,
+    int32_t type)
+{
+    return bgr2gray_threshold(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxval, type, true);
+}
+
+uint8_t RGB2GRAYThreshold(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outWidthStride,
+    uint8_t* outData,
+    uint8_t thresh,
+    uint8_t maxval,
+    int32_t type)
+{
+    return bgr2gray_threshold(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxval, type, false);
+}
+
 } // namespace tinycv
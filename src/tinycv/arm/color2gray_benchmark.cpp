@@ -100,6 +100,10 @@ BENCHMARK_TEMPLATE(BM_GRAY2BGR_tinycv_aarch64, float, c1, c3)->Args({320, 240})-
 BENCHMARK_TEMPLATE(BM_GRAY2BGRA_tinycv_aarch64, float, c1, c4)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
 BENCHMARK_TEMPLATE(BM_GRAY2BGR_tinycv_aarch64, uint8_t, c1, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
 BENCHMARK_TEMPLATE(BM_GRAY2BGRA_tinycv_aarch64, uint8_t, c1, c4)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_BGR2GRAY_tinycv_aarch64, tinycv::half_t, c3, c1)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_BGRA2GRAY_tinycv_aarch64, tinycv::half_t, c4, c1)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_GRAY2BGR_tinycv_aarch64, tinycv::half_t, c1, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_GRAY2BGRA_tinycv_aarch64, tinycv::half_t, c1, c4)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
 
 #ifdef TINYCV_BENCHMARK_OPENCV
 template <typename T, int32_t input_channels, int32_t output_channels>
@@ -307,3 +307,85 @@ R(UT_RGBA2GRAY_float_aarch64, float, c4, c1, 6, 1e-4)
 R(UT_RGBA2GRAY_uint8_t_aarch64, uint8_t, c4, c1, 6, 1.01)
 R(UT_GRAY2RGBA_float_aarch64, float, c1, c4, 7, 1e-4)
 R(UT_GRAY2RGBA_uint8_t_aarch64, uint8_t, c1, c4, 7, 1.01)
+
+template <int32_t nc>
+void Color2GRAYHalfTest(Size size, int32_t code, float diff)
+{
+    std::unique_ptr<tinycv::half_t[]> src(new tinycv::half_t[size.width * size.height * nc]);
+    std::unique_ptr<float[]> src_f32(new float[size.width * size.height * nc]);
+    std::unique_ptr<float[]> dst_f32(new float[size.width * size.height]);
+    std::unique_ptr<tinycv::half_t[]> dst_ref(new tinycv::half_t[size.width * size.height]);
+    std::unique_ptr<tinycv::half_t[]> dst(new tinycv::half_t[size.width * size.height]);
+
+    randomFillHalf(src.get(), src_f32.get(), size.width * size.height * nc, 0, 1);
+    cv::Mat src_opencv(size.height, size.width, CV_MAKETYPE(CV_32F, nc), src_f32.get(), sizeof(float) * size.width * nc);
+    cv::Mat dst_opencv(size.height, size.width, CV_MAKETYPE(CV_32F, 1), dst_f32.get(), sizeof(float) * size.width);
+    cv::cvtColor(src_opencv, dst_opencv, code);
+
+    if (code == cv::COLOR_BGR2GRAY) {
+        tinycv::BGR2GRAY<tinycv::half_t>(size.height, size.width, size.width * nc, src.get(), size.width, dst.get());
+    } else if (code == cv::COLOR_RGB2GRAY) {
+        tinycv::RGB2GRAY<tinycv::half_t>(size.height, size.width, size.width * nc, src.get(), size.width, dst.get());
+    } else if (code == cv::COLOR_BGRA2GRAY) {
+        tinycv::BGRA2GRAY<tinycv::half_t>(size.height, size.width, size.width * nc, src.get(), size.width, dst.get());
+    } else if (code == cv::COLOR_RGBA2GRAY) {
+        tinycv::RGBA2GRAY<tinycv::half_t>(size.height, size.width, size.width * nc, src.get(), size.width, dst.get());
+    }
+
+    for (int32_t i = 0; i < size.width * size.height; ++i) {
+        dst_ref[i] = tinycv::half_t(dst_f32[i]);
+    }
+    checkResult<tinycv::half_t, 1>(dst_ref.get(), dst.get(), size.height, size.width, size.width, size.width, diff);
+}
+
+template <int32_t nc>
+void GRAY2ColorHalfTest(Size size, int32_t code, float diff)
+{
+    std::unique_ptr<tinycv::half_t[]> src(new tinycv::half_t[size.width * size.height]);
+    std::unique_ptr<float[]> src_f32(new float[size.width * size.height]);
+    std::unique_ptr<float[]> dst_f32(new float[size.width * size.height * nc]);
+    std::unique_ptr<tinycv::half_t[]> dst_ref(new tinycv::half_t[size.width * size.height * nc]);
+    std::unique_ptr<tinycv::half_t[]> dst(new tinycv::half_t[size.width * size.height * nc]);
+
+    randomFillHalf(src.get(), src_f32.get(), size.width * size.height, 0, 1);
+    cv::Mat src_opencv(size.height, size.width, CV_MAKETYPE(CV_32F, 1), src_f32.get(), sizeof(float) * size.width);
+    cv::Mat dst_opencv(size.height, size.width, CV_MAKETYPE(CV_32F, nc), dst_f32.get(), sizeof(float) * size.width * nc);
+    cv::cvtColor(src_opencv, dst_opencv, code);
+
+    if (code == cv::COLOR_GRAY2BGR) {
+        tinycv::GRAY2BGR<tinycv::half_t>(size.height, size.width, size.width, src.get(), size.width * nc, dst.get());
+    } else if (code == cv::COLOR_GRAY2RGB) {
+        tinycv::GRAY2RGB<tinycv::half_t>(size.height, size.width, size.width, src.get(), size.width * nc, dst.get());
+    } else if (code == cv::COLOR_GRAY2BGRA) {
+        tinycv::GRAY2BGRA<tinycv::half_t>(size.height, size.width, size.width, src.get(), size.width * nc, dst.get());
+    } else if (code == cv::COLOR_GRAY2RGBA) {
+        tinycv::GRAY2RGBA<tinycv::half_t>(size.height, size.width, size.width, src.get(), size.width * nc, dst.get());
+    }
+
+    for (int32_t i = 0; i < size.width * size.height * nc; ++i) {
+        dst_ref[i] = tinycv::half_t(dst_f32[i]);
+    }
+    checkResult<tinycv::half_t, nc>(dst_ref.get(), dst.get(), size.height, size.width, size.width * nc, size.width * nc, diff);
+}
+
+TEST(UT_COLOR2GRAY_half_t_aarch64, arm)
+{
+    const Size sizes[] = {{320, 256}, {720, 480}};
+    for (const Size &size : sizes) {
+        Color2GRAYHalfTest<3>(size, cv::COLOR_BGR2GRAY, 1e-3f);
+        Color2GRAYHalfTest<3>(size, cv::COLOR_RGB2GRAY, 1e-3f);
+        Color2GRAYHalfTest<4>(size, cv::COLOR_BGRA2GRAY, 1e-3f);
+        Color2GRAYHalfTest<4>(size, cv::COLOR_RGBA2GRAY, 1e-3f);
+    }
+}
+
+TEST(UT_GRAY2COLOR_half_t_aarch64, arm)
+{
+    const Size sizes[] = {{320, 256}, {720, 480}};
+    for (const Size &size : sizes) {
+        GRAY2ColorHalfTest<3>(size, cv::COLOR_GRAY2BGR, 1e-3f);
+        GRAY2ColorHalfTest<3>(size, cv::COLOR_GRAY2RGB, 1e-3f);
+        GRAY2ColorHalfTest<4>(size, cv::COLOR_GRAY2BGRA, 1e-3f);
+        GRAY2ColorHalfTest<4>(size, cv::COLOR_GRAY2RGBA, 1e-3f);
+    }
+}
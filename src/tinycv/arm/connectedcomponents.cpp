@@ -0,0 +1,453 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/connectedcomponents.h"
+#include "tinycv/sys.h"
+
+#include <string.h>
+#include <algorithm>
+#include <arm_neon.h>
+
+#define CC_MIN_BAND_PIXELS (1 << 16)
+
+namespace tinycv {
+
+// union-find over provisional labels, the root of a set is its smallest label so parents never exceed children
+static inline int32_t cc_find_root(const int32_t *P, int32_t i)
+{
+    while (P[i] < i) {
+        i = P[i];
+    }
+    return i;
+}
+
+static inline void cc_set_root(int32_t *P, int32_t i, int32_t root)
+{
+    while (P[i] < i) {
+        int32_t j = P[i];
+        P[i] = root;
+        i = j;
+    }
+    P[i] = root;
+}
+
+static inline int32_t cc_union(int32_t *P, int32_t i, int32_t j)
+{
+    int32_t root = cc_find_root(P, i);
+    if (i != j) {
+        int32_t rootj = cc_find_root(P, j);
+        root = std::min(root, rootj);
+        cc_set_root(P, j, root);
+    }
+    cc_set_root(P, i, root);
+    return root;
+}
+
+// `label` joined with `other`, or `other` alone if there is no label yet
+static inline int32_t cc_merge(int32_t *P, int32_t label, int32_t other)
+{
+    return label ? cc_union(P, label, other) : other;
+}
+
+// whether the 16 pixels from x are zero in both rows, row1 may be nullptr
+static inline bool cc_zero16(const uint8_t *row0, const uint8_t *row1, int32_t x)
+{
+    uint8x16_t v = vld1q_u8(row0 + x);
+    if (nullptr != row1) {
+        v = vorrq_u8(v, vld1q_u8(row1 + x));
+    }
+    return vmaxvq_u8(v) == 0;
+}
+
+// end of the run of `lab[x]` starting at x
+static inline int32_t cc_run_end(const int32_t *lab, int32_t x, int32_t width)
+{
+    const int32x4_t l = vdupq_n_s32(lab[x]);
+    int32_t x1 = x + 1;
+    while (x1 <= width - 4 && vminvq_u32(vceqq_s32(vld1q_s32(lab + x1), l)) != 0) {
+        x1 += 4;
+    }
+    while (x1 < width && lab[x1] == lab[x]) {
+        ++x1;
+    }
+    return x1;
+}
+
+struct CCStat {
+    int32_t left, top, right, bottom;
+    int64_t area, sumX, sumY;
+
+    CCStat()
+        : left(INT32_MAX), top(INT32_MAX), right(-1), bottom(-1), area(0), sumX(0), sumY(0) {}
+    void add(const CCStat &s)
+    {
+        left = std::min(left, s.left);
+        top = std::min(top, s.top);
+        right = std::max(right, s.right);
+        bottom = std::max(bottom, s.bottom);
+        area += s.area;
+        sumX += s.sumX;
+        sumY += s.sumY;
+    }
+};
+
+// statistics of a label row, over runs of equal labels
+static void cc_stat_row(const int32_t *lab, int32_t y, int32_t width, CCStat *stats)
+{
+    int32_t x = 0;
+    while (x < width) {
+        int32_t x1 = cc_run_end(lab, x, width);
+        CCStat &s = stats[lab[x]];
+        int64_t len = x1 - x;
+        s.left = std::min(s.left, x);
+        s.right = std::max(s.right, x1 - 1);
+        s.top = std::min(s.top, y);
+        s.bottom = std::max(s.bottom, y);
+        s.area += len;
+        s.sumX += (int64_t)(x + x1 - 1) * len / 2;
+        s.sumY += (int64_t)y * len;
+        x = x1;
+    }
+}
+
+// 8-connectivity: provisional labels of the 2x2 blocks of rows [y0, y1), y0 even, stored at the top left pixel
+// of each block. A block joins the blocks P, Q and R above it and S on its left through the pixels touching
+// it. Returns the next free provisional label.
+static int32_t cc_scan_blocks(int32_t y0, int32_t y1, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t labelsWidthStride, int32_t *labels, int32_t *P, int32_t next)
+{
+    for (int32_t y = y0; y < y1; y += 2) {
+        const uint8_t *row0 = inData + (size_t)y * inWidthStride;
+        const uint8_t *row1 = y + 1 < y1 ? row0 + inWidthStride : nullptr;
+        const uint8_t *up = y > y0 ? row0 - inWidthStride : nullptr;
+        int32_t *lab = labels + (size_t)y * labelsWidthStride;
+        const int32_t *labUp = nullptr != up ? lab - (size_t)2 * labelsWidthStride : nullptr;
+        for (int32_t x0 = 0; x0 < width; x0 += 16) {
+            int32_t x1 = std::min(x0 + 16, width);
+            if (x1 - x0 == 16 && cc_zero16(row0, row1, x0)) {
+                for (int32_t x = x0; x < x1; x += 2) {
+                    lab[x] = 0;
+                }
+                continue;
+            }
+            for (int32_t x = x0; x < x1; x += 2) {
+                const bool last = x + 1 >= width;
+                bool a = row0[x] != 0;
+                bool b = !last && row0[x + 1] != 0;
+                bool c = nullptr != row1 && row1[x] != 0;
+                bool d = nullptr != row1 && !last && row1[x + 1] != 0;
+                if (!(a || b || c || d)) {
+                    lab[x] = 0;
+                    continue;
+                }
+                int32_t label = 0;
+                if (nullptr != up) {
+                    bool q0 = up[x] != 0;
+                    bool q1 = !last && up[x + 1] != 0;
+                    bool q = (a || b) && (q0 || q1);
+                    if (q) {
+                        label = labUp[x];
+                    }
+                    //! P and R touching a set pixel of Q in the row above are in its set already
+                    if (a && x > 0 && up[x - 1] && !(q && q0)) {
+                        label = cc_merge(P, label, labUp[x - 2]);
+                    }
+                    if (b && x + 2 < width && up[x + 2] && !(q && q1)) {
+                        label = cc_merge(P, label, labUp[x + 2]);
+                    }
+                }
+                if ((a || c) && x > 0 && (row0[x - 1] || (nullptr != row1 && row1[x - 1]))) {
+                    label = cc_merge(P, label, lab[x - 2]);
+                }
+                if (!label) {
+                    label = next;
+                    P[next++] = label;
+                }
+                lab[x] = label;
+            }
+        }
+    }
+    return next;
+}
+
+// 4-connectivity: provisional labels of the pixels of rows [y0, y1), a pixel joins the pixels above and on its left
+static int32_t cc_scan_pixels(int32_t y0, int32_t y1, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t labelsWidthStride, int32_t *labels, int32_t *P, int32_t next)
+{
+    for (int32_t y = y0; y < y1; ++y) {
+        const uint8_t *row = inData + (size_t)y * inWidthStride;
+        int32_t *lab = labels + (size_t)y * labelsWidthStride;
+        const int32_t *labUp = y > y0 ? lab - labelsWidthStride : nullptr;
+        for (int32_t x0 = 0; x0 < width; x0 += 16) {
+            int32_t x1 = std::min(x0 + 16, width);
+            if (x1 - x0 == 16 && cc_zero16(row, nullptr, x0)) {
+                memset(lab + x0, 0, 16 * sizeof(int32_t));
+                continue;
+            }
+            for (int32_t x = x0; x < x1; ++x) {
+                if (!row[x]) {
+                    lab[x] = 0;
+                    continue;
+                }
+                //! background labels are 0 already
+                int32_t u = nullptr != labUp ? labUp[x] : 0;
+                int32_t l = x > 0 ? lab[x - 1] : 0;
+                int32_t label = u && l ? (u == l ? u : cc_union(P, u, l)) : (u | l);
+                if (!label) {
+                    label = next;
+                    P[next++] = label;
+                }
+                lab[x] = label;
+            }
+        }
+    }
+    return next;
+}
+
+// joins the components crossing the seam above row y, the first row of a band
+static void cc_seam(int32_t y, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t labelsWidthStride, int32_t *labels, int32_t *P, bool blocks)
+{
+    const uint8_t *row = inData + (size_t)y * inWidthStride;
+    const uint8_t *up = row - inWidthStride;
+    int32_t *lab = labels + (size_t)y * labelsWidthStride;
+    if (!blocks) {
+        const int32_t *labUp = lab - labelsWidthStride;
+        for (int32_t x = 0; x < width; ++x) {
+            if (row[x] && up[x]) {
+                cc_union(P, lab[x], labUp[x]);
+            }
+        }
+        return;
+    }
+    const int32_t *labUp = lab - (size_t)2 * labelsWidthStride;
+    for (int32_t x = 0; x < width; x += 2) {
+        const bool last = x + 1 >= width;
+        bool a = row[x] != 0;
+        bool b = !last && row[x + 1] != 0;
+        if ((a || b) && (up[x] || (!last && up[x + 1]))) {
+            cc_union(P, lab[x], labUp[x]);
+        }
+        if (a && x > 0 && up[x - 1]) {
+            cc_union(P, lab[x], labUp[x - 2]);
+        }
+        if (b && x + 2 < width && up[x + 2]) {
+            cc_union(P, lab[x], labUp[x + 2]);
+        }
+    }
+}
+
+// final labels of rows [y0, y1), `P` maps provisional labels to them
+static void cc_relabel(int32_t y0, int32_t y1, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t labelsWidthStride, int32_t *labels, const int32_t *P, bool blocks, CCStat *stats)
+{
+    for (int32_t y = y0; y < y1; y += blocks ? 2 : 1) {
+        const uint8_t *row0 = inData + (size_t)y * inWidthStride;
+        int32_t *lab0 = labels + (size_t)y * labelsWidthStride;
+        if (!blocks) {
+            for (int32_t x = 0; x < width; ++x) {
+                lab0[x] = P[lab0[x]];
+            }
+            if (nullptr != stats) {
+                cc_stat_row(lab0, y, width, stats);
+            }
+            continue;
+        }
+        const uint8_t *row1 = y + 1 < y1 ? row0 + inWidthStride : nullptr;
+        int32_t *lab1 = lab0 + labelsWidthStride;
+        for (int32_t x0 = 0; x0 < width; x0 += 16) {
+            int32_t x1 = std::min(x0 + 16, width);
+            if (x1 - x0 == 16 && cc_zero16(row0, row1, x0)) {
+                memset(lab0 + x0, 0, 16 * sizeof(int32_t));
+                if (nullptr != row1) {
+                    memset(lab1 + x0, 0, 16 * sizeof(int32_t));
+                }
+                continue;
+            }
+            for (int32_t x = x0; x < x1; x += 2) {
+                int32_t l = P[lab0[x]];
+                lab0[x] = row0[x] ? l : 0;
+                if (x + 1 < width) {
+                    lab0[x + 1] = row0[x + 1] ? l : 0;
+                }
+                if (nullptr != row1) {
+                    lab1[x] = row1[x] ? l : 0;
+                    if (x + 1 < width) {
+                        lab1[x + 1] = row1[x + 1] ? l : 0;
+                    }
+                }
+            }
+        }
+        if (nullptr != stats) {
+            cc_stat_row(lab0, y, width, stats);
+            if (nullptr != row1) {
+                cc_stat_row(lab1, y + 1, width, stats);
+            }
+        }
+    }
+}
+
+static int32_t cc_label(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t labelsWidthStride,
+    int32_t *labels,
+    int32_t maxLabels,
+    int32_t *stats,
+    double *centroids,
+    int32_t connectivity,
+    int32_t numThreads)
+{
+    if (nullptr == inData || nullptr == labels) {
+        return 0;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width || labelsWidthStride < width) {
+        return 0;
+    }
+    if (connectivity != 4 && connectivity != 8) {
+        return 0;
+    }
+    const bool blocks = connectivity == 8;
+    const int32_t step = blocks ? 2 : 1;
+
+    //! bands start on even rows for blocks, each has its own range of provisional labels
+    int32_t bands = (int32_t)std::min<int64_t>((int64_t)height * width / CC_MIN_BAND_PIXELS, height / step);
+    bands = std::max(std::min(bands, numThreads), 1);
+    int64_t numLabels = 1;
+    for (int32_t b = 0; b < bands; ++b) {
+        int32_t row0 = (int32_t)((int64_t)height * b / bands) / step * step;
+        int32_t row1 = b + 1 == bands ? height : (int32_t)((int64_t)height * (b + 1) / bands) / step * step;
+        numLabels += (int64_t)((row1 - row0 + step - 1) / step) * ((width + 1) / 2);
+        if (numLabels > INT32_MAX) {
+            return 0;
+        }
+    }
+
+    uint64_t size_for_band_rows = ((uint64_t)(bands + 1) * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    uint64_t size_for_band_labels = ((uint64_t)(bands + 1) * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    uint64_t size_for_band_next = ((uint64_t)bands * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    uint64_t size_for_p = ((uint64_t)numLabels * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    uint64_t total_size = size_for_band_rows + size_for_band_labels + size_for_band_next + size_for_p;
+    void *temp_buffer = tinycv::ScratchAlloc(total_size, 64);
+    int32_t *bandRows = (int32_t *)temp_buffer;
+    int32_t *bandLabels = (int32_t *)((unsigned char *)bandRows + size_for_band_rows);
+    int32_t *bandNext = (int32_t *)((unsigned char *)bandLabels + size_for_band_labels);
+    int32_t *P = (int32_t *)((unsigned char *)bandNext + size_for_band_next);
+    bandRows[0] = 0;
+    bandLabels[0] = 1;
+    for (int32_t b = 0; b < bands; ++b) {
+        bandRows[b + 1] = b + 1 == bands ? height : (int32_t)((int64_t)height * (b + 1) / bands) / step * step;
+        int32_t rows = (bandRows[b + 1] - bandRows[b] + step - 1) / step;
+        bandLabels[b + 1] = bandLabels[b] + rows * ((width + 1) / 2);
+    }
+    P[0] = 0;
+
+    ParallelFor(bands, bands, [&](int32_t b0, int32_t b1) {
+        for (int32_t b = b0; b < b1; ++b) {
+            if (blocks) {
+                bandNext[b] = cc_scan_blocks(bandRows[b], bandRows[b + 1], width, inWidthStride, inData, labelsWidthStride, labels, P, bandLabels[b]);
+            } else {
+                bandNext[b] = cc_scan_pixels(bandRows[b], bandRows[b + 1], width, inWidthStride, inData, labelsWidthStride, labels, P, bandLabels[b]);
+            }
+        }
+    });
+    for (int32_t b = 1; b < bands; ++b) {
+        cc_seam(bandRows[b], width, inWidthStride, inData, labelsWidthStride, labels, P, blocks);
+    }
+
+    //! roots get consecutive labels in order, the other labels take the label of their root
+    int32_t count = 1;
+    for (int32_t b = 0; b < bands; ++b) {
+        for (int32_t k = bandLabels[b]; k < bandNext[b]; ++k) {
+            P[k] = P[k] < k ? P[P[k]] : count++;
+        }
+    }
+
+    //! the band statistics are sized by the final label count, which is only known here
+    CCStat *bandStats = nullptr;
+    if (nullptr != stats) {
+        bandStats = (CCStat *)tinycv::ScratchAlloc((uint64_t)bands * count * sizeof(CCStat), 64);
+        std::fill(bandStats, bandStats + (size_t)bands * count, CCStat());
+    }
+    ParallelFor(bands, bands, [&](int32_t b0, int32_t b1) {
+        for (int32_t b = b0; b < b1; ++b) {
+            CCStat *s = nullptr != stats ? bandStats + (size_t)b * count : nullptr;
+            cc_relabel(bandRows[b], bandRows[b + 1], width, inWidthStride, inData, labelsWidthStride, labels, P, blocks, s);
+        }
+    });
+
+    if (nullptr != stats) {
+        CCStat *total = bandStats;
+        for (int32_t b = 1; b < bands; ++b) {
+            for (int32_t l = 0; l < count; ++l) {
+                total[l].add(bandStats[(size_t)b * count + l]);
+            }
+        }
+        for (int32_t l = 0; l < std::min(count, maxLabels); ++l) {
+            const CCStat &s = total[l];
+            int32_t *st = stats + (size_t)l * CC_STAT_MAX;
+            if (s.area == 0) {
+                memset(st, 0, CC_STAT_MAX * sizeof(int32_t));
+            } else {
+                st[CC_STAT_LEFT] = s.left;
+                st[CC_STAT_TOP] = s.top;
+                st[CC_STAT_WIDTH] = s.right - s.left + 1;
+                st[CC_STAT_HEIGHT] = s.bottom - s.top + 1;
+                st[CC_STAT_AREA] = (int32_t)s.area;
+            }
+            if (nullptr != centroids) {
+                centroids[2 * l] = s.area ? (double)s.sumX / s.area : 0;
+                centroids[2 * l + 1] = s.area ? (double)s.sumY / s.area : 0;
+            }
+        }
+        tinycv::ScratchFree(bandStats);
+    }
+    tinycv::ScratchFree(temp_buffer);
+    return count;
+}
+
+int32_t ConnectedComponents(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t labelsWidthStride,
+    int32_t *labels,
+    int32_t connectivity,
+    int32_t numThreads)
+{
+    return cc_label(height, width, inWidthStride, inData, labelsWidthStride, labels, 0, nullptr, nullptr, connectivity, numThreads);
+}
+
+int32_t ConnectedComponentsWithStats(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t labelsWidthStride,
+    int32_t *labels,
+    int32_t maxLabels,
+    int32_t *stats,
+    double *centroids,
+    int32_t connectivity,
+    int32_t numThreads)
+{
+    if (nullptr == stats) {
+        return 0;
+    }
+    return cc_label(height, width, inWidthStride, inData, labelsWidthStride, labels, maxLabels, stats, centroids, connectivity, numThreads);
+}
+
+} // namespace tinycv
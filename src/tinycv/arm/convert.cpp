@@ -0,0 +1,885 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/convert.h"
+#include "tinycv/types.h"
+#include "tinycv/sys.h"
+
+#include <algorithm>
+#include <cmath>
+#include <arm_neon.h>
+
+namespace tinycv {
+
+static inline void convert_u8x16_f32(uint8x16_t v, float32x4_t *out)
+{
+    uint16x8_t v_lo = vmovl_u8(vget_low_u8(v));
+    uint16x8_t v_hi = vmovl_u8(vget_high_u8(v));
+    out[0] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(v_lo)));
+    out[1] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(v_lo)));
+    out[2] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(v_hi)));
+    out[3] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(v_hi)));
+}
+
+template <int32_t nc>
+static inline void load_deinterleave(const uint8_t *src, uint8x16_t *v);
+
+template <>
+inline void load_deinterleave<1>(const uint8_t *src, uint8x16_t *v)
+{
+    v[0] = vld1q_u8(src);
+}
+
+template <>
+inline void load_deinterleave<3>(const uint8_t *src, uint8x16_t *v)
+{
+    uint8x16x3_t v_src = vld3q_u8(src);
+    v[0] = v_src.val[0];
+    v[1] = v_src.val[1];
+    v[2] = v_src.val[2];
+}
+
+template <>
+inline void load_deinterleave<4>(const uint8_t *src, uint8x16_t *v)
+{
+    uint8x16x4_t v_src = vld4q_u8(src);
+    v[0] = v_src.val[0];
+    v[1] = v_src.val[1];
+    v[2] = v_src.val[2];
+    v[3] = v_src.val[3];
+}
+
+template <int32_t nc>
+static inline void load_deinterleave(const float *src, float32x4_t *v);
+
+template <>
+inline void load_deinterleave<1>(const float *src, float32x4_t *v)
+{
+    v[0] = vld1q_f32(src);
+}
+
+template <>
+inline void load_deinterleave<3>(const float *src, float32x4_t *v)
+{
+    float32x4x3_t v_src = vld3q_f32(src);
+    v[0] = v_src.val[0];
+    v[1] = v_src.val[1];
+    v[2] = v_src.val[2];
+}
+
+template <>
+inline void load_deinterleave<4>(const float *src, float32x4_t *v)
+{
+    float32x4x4_t v_src = vld4q_f32(src);
+    v[0] = v_src.val[0];
+    v[1] = v_src.val[1];
+    v[2] = v_src.val[2];
+    v[3] = v_src.val[3];
+}
+
+// v holds 4 pixels of every output channel, plane_stride is 0 for interleaved output
+template <int32_t nc>
+static inline void normalize_store_f32(float32x4_t *v, const float32x4_t *scale, const float32x4_t *bias, int32_t plane_stride, float *dst);
+
+template <>
+inline void normalize_store_f32<1>(float32x4_t *v, const float32x4_t *scale, const float32x4_t *bias, int32_t plane_stride, float *dst)
+{
+    vst1q_f32(dst, vaddq_f32(vmulq_f32(v[0], scale[0]), bias[0]));
+}
+
+template <>
+inline void normalize_store_f32<3>(float32x4_t *v, const float32x4_t *scale, const float32x4_t *bias, int32_t plane_stride, float *dst)
+{
+    float32x4x3_t v_dst;
+    for (int32_t c = 0; c < 3; ++c) {
+        v_dst.val[c] = vaddq_f32(vmulq_f32(v[c], scale[c]), bias[c]);
+    }
+    if (plane_stride) {
+        vst1q_f32(dst, v_dst.val[0]);
+        vst1q_f32(dst + plane_stride, v_dst.val[1]);
+        vst1q_f32(dst + 2 * plane_stride, v_dst.val[2]);
+    } else {
+        vst3q_f32(dst, v_dst);
+    }
+}
+
+template <>
+inline void normalize_store_f32<4>(float32x4_t *v, const float32x4_t *scale, const float32x4_t *bias, int32_t plane_stride, float *dst)
+{
+    float32x4x4_t v_dst;
+    for (int32_t c = 0; c < 4; ++c) {
+        v_dst.val[c] = vaddq_f32(vmulq_f32(v[c], scale[c]), bias[c]);
+    }
+    if (plane_stride) {
+        vst1q_f32(dst, v_dst.val[0]);
+        vst1q_f32(dst + plane_stride, v_dst.val[1]);
+        vst1q_f32(dst + 2 * plane_stride, v_dst.val[2]);
+        vst1q_f32(dst + 3 * plane_stride, v_dst.val[3]);
+    } else {
+        vst4q_f32(dst, v_dst);
+    }
+}
+
+template <int32_t nc>
+static int32_t convert_normalize_row_neon(const uint8_t *src, int32_t width, const float32x4_t *scale, const float32x4_t *bias, bool swap_rb, int32_t plane_stride, float *dst)
+{
+    // swap_rb is only set for nc >= 3
+    const int32_t rb = nc >= 3 ? 2 : 0;
+    int32_t dst_step = plane_stride ? 1 : nc;
+    int32_t i = 0;
+    for (; i <= width - 16; i += 16) {
+        uint8x16_t v_src[nc];
+        load_deinterleave<nc>(src + i * nc, v_src);
+        if (swap_rb) {
+            std::swap(v_src[0], v_src[rb]);
+        }
+        float32x4_t v_f32[nc][4];
+        for (int32_t c = 0; c < nc; ++c) {
+            convert_u8x16_f32(v_src[c], v_f32[c]);
+        }
+        for (int32_t k = 0; k < 4; ++k) {
+            float32x4_t v[nc];
+            for (int32_t c = 0; c < nc; ++c) {
+                v[c] = v_f32[c][k];
+            }
+            normalize_store_f32<nc>(v, scale, bias, plane_stride, dst + (i + k * 4) * dst_step);
+        }
+    }
+    return i;
+}
+
+template <int32_t nc>
+static int32_t convert_normalize_row_neon(const float *src, int32_t width, const float32x4_t *scale, const float32x4_t *bias, bool swap_rb, int32_t plane_stride, float *dst)
+{
+    // swap_rb is only set for nc >= 3
+    const int32_t rb = nc >= 3 ? 2 : 0;
+    int32_t dst_step = plane_stride ? 1 : nc;
+    int32_t i = 0;
+    for (; i <= width - 4; i += 4) {
+        float32x4_t v[nc];
+        load_deinterleave<nc>(src + i * nc, v);
+        if (swap_rb) {
+            std::swap(v[0], v[rb]);
+        }
+        normalize_store_f32<nc>(v, scale, bias, plane_stride, dst + i * dst_step);
+    }
+    return i;
+}
+
+template <typename T, int32_t nc>
+static void convert_normalize(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    const float *mean,
+    const float *scale,
+    bool swapRB,
+    bool planar,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (nullptr == mean || nullptr == scale) {
+        return;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return;
+    }
+
+    // (src - mean) * scale is evaluated as src * scale + bias
+    float s[nc], b[nc];
+    float32x4_t v_scale[nc], v_bias[nc];
+    int32_t src_channel[nc];
+    for (int32_t c = 0; c < nc; ++c) {
+        s[c] = scale[c];
+        b[c] = -mean[c] * scale[c];
+        v_scale[c] = vdupq_n_f32(s[c]);
+        v_bias[c] = vdupq_n_f32(b[c]);
+        src_channel[c] = c;
+    }
+    bool swap_rb = swapRB && nc >= 3;
+    if (swap_rb) {
+        src_channel[0] = 2;
+        src_channel[2] = 0;
+    }
+    int32_t plane_stride = planar ? height * outWidthStride : 0;
+    int32_t dst_step = planar ? 1 : nc;
+    int32_t dst_channel_stride = planar ? plane_stride : 1;
+
+    for (int32_t i = 0; i < height; ++i) {
+        const T *src = inData + i * inWidthStride;
+        float *dst = outData + i * outWidthStride;
+        int32_t j = convert_normalize_row_neon<nc>(src, width, v_scale, v_bias, swap_rb, plane_stride, dst);
+        for (; j < width; ++j) {
+            for (int32_t c = 0; c < nc; ++c) {
+                dst[j * dst_step + c * dst_channel_stride] = (float)src[j * nc + src_channel[c]] * s[c] + b[c];
+            }
+        }
+    }
+}
+
+template <>
+void ConvertNormalize<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, const float *mean, const float *scale, bool swapRB, bool planar, int32_t outWidthStride, float *outData)
+{
+    convert_normalize<uint8_t, 1>(height, width, inWidthStride, inData, mean, scale, swapRB, planar, outWidthStride, outData);
+}
+
+template <>
+void ConvertNormalize<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, const float *mean, const float *scale, bool swapRB, bool planar, int32_t outWidthStride, float *outData)
+{
+    convert_normalize<uint8_t, 3>(height, width, inWidthStride, inData, mean, scale, swapRB, planar, outWidthStride, outData);
+}
+
+template <>
+void ConvertNormalize<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, const float *mean, const float *scale, bool swapRB, bool planar, int32_t outWidthStride, float *outData)
+{
+    convert_normalize<uint8_t, 4>(height, width, inWidthStride, inData, mean, scale, swapRB, planar, outWidthStride, outData);
+}
+
+template <>
+void ConvertNormalize<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, const float *mean, const float *scale, bool swapRB, bool planar, int32_t outWidthStride, float *outData)
+{
+    convert_normalize<float, 1>(height, width, inWidthStride, inData, mean, scale, swapRB, planar, outWidthStride, outData);
+}
+
+template <>
+void ConvertNormalize<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, const float *mean, const float *scale, bool swapRB, bool planar, int32_t outWidthStride, float *outData)
+{
+    convert_normalize<float, 3>(height, width, inWidthStride, inData, mean, scale, swapRB, planar, outWidthStride, outData);
+}
+
+template <>
+void ConvertNormalize<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, const float *mean, const float *scale, bool swapRB, bool planar, int32_t outWidthStride, float *outData)
+{
+    convert_normalize<float, 4>(height, width, inWidthStride, inData, mean, scale, swapRB, planar, outWidthStride, outData);
+}
+
+
+template <typename T>
+static inline T saturate_convert(float v);
+
+// NaN maps to 0 like the vector path
+template <>
+inline uint8_t saturate_convert<uint8_t>(float v)
+{
+    v = v > 0.f ? v : 0.f;
+    return (uint8_t)lrintf(v < 255.f ? v : 255.f);
+}
+
+template <>
+inline int16_t saturate_convert<int16_t>(float v)
+{
+    v = v > -32768.f ? v : -32768.f;
+    return (int16_t)lrintf(v < 32767.f ? v : 32767.f);
+}
+
+template <>
+inline uint16_t saturate_convert<uint16_t>(float v)
+{
+    v = v > 0.f ? v : 0.f;
+    return (uint16_t)lrintf(v < 65535.f ? v : 65535.f);
+}
+
+template <>
+inline float saturate_convert<float>(float v)
+{
+    return v;
+}
+
+// loads 8 elements as two float vectors and stores them back with saturation
+template <typename T>
+struct convert_to_neon_traits;
+
+template <>
+struct convert_to_neon_traits<uint8_t> {
+    static inline void load(const uint8_t *src, float32x4_t &lo, float32x4_t &hi)
+    {
+        uint16x8_t v = vmovl_u8(vld1_u8(src));
+        lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(v)));
+        hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(v)));
+    }
+    static inline void store(uint8_t *dst, float32x4_t lo, float32x4_t hi)
+    {
+        int16x8_t v = vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(lo)), vqmovn_s32(vcvtnq_s32_f32(hi)));
+        vst1_u8(dst, vqmovun_s16(v));
+    }
+};
+
+template <>
+struct convert_to_neon_traits<int16_t> {
+    static inline void load(const int16_t *src, float32x4_t &lo, float32x4_t &hi)
+    {
+        int16x8_t v = vld1q_s16(src);
+        lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(v)));
+        hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(v)));
+    }
+    static inline void store(int16_t *dst, float32x4_t lo, float32x4_t hi)
+    {
+        vst1q_s16(dst, vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(lo)), vqmovn_s32(vcvtnq_s32_f32(hi))));
+    }
+};
+
+template <>
+struct convert_to_neon_traits<uint16_t> {
+    static inline void load(const uint16_t *src, float32x4_t &lo, float32x4_t &hi)
+    {
+        uint16x8_t v = vld1q_u16(src);
+        lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(v)));
+        hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(v)));
+    }
+    static inline void store(uint16_t *dst, float32x4_t lo, float32x4_t hi)
+    {
+        vst1q_u16(dst, vcombine_u16(vqmovun_s32(vcvtnq_s32_f32(lo)), vqmovun_s32(vcvtnq_s32_f32(hi))));
+    }
+};
+
+template <>
+struct convert_to_neon_traits<float> {
+    static inline void load(const float *src, float32x4_t &lo, float32x4_t &hi)
+    {
+        lo = vld1q_f32(src);
+        hi = vld1q_f32(src + 4);
+    }
+    static inline void store(float *dst, float32x4_t lo, float32x4_t hi)
+    {
+        vst1q_f32(dst, lo);
+        vst1q_f32(dst + 4, hi);
+    }
+};
+
+template <typename TSrc, typename TDst, int32_t nc>
+void ConvertTo(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const TSrc *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    TDst *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return;
+    }
+
+    int32_t n = width * nc;
+    float32x4_t v_alpha = vdupq_n_f32(alpha), v_beta = vdupq_n_f32(beta);
+    for (int32_t i = 0; i < height; ++i) {
+        const TSrc *src = inData + i * inWidthStride;
+        TDst *dst = outData + i * outWidthStride;
+        int32_t j = 0;
+        // vcvtnq_s32_f32 and the narrowing moves saturate on their own
+        for (; j <= n - 8; j += 8) {
+            float32x4_t lo, hi;
+            convert_to_neon_traits<TSrc>::load(src + j, lo, hi);
+            lo = vaddq_f32(vmulq_f32(lo, v_alpha), v_beta);
+            hi = vaddq_f32(vmulq_f32(hi, v_alpha), v_beta);
+            convert_to_neon_traits<TDst>::store(dst + j, lo, hi);
+        }
+        for (; j < n; ++j) {
+            dst[j] = saturate_convert<TDst>((float)src[j] * alpha + beta);
+        }
+    }
+}
+
+template void ConvertTo<uint8_t, uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<uint8_t, uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<uint8_t, uint8_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<uint8_t, int16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<uint8_t, int16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<uint8_t, int16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<uint8_t, uint16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<uint8_t, uint16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<uint8_t, uint16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<uint8_t, float, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<uint8_t, float, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<uint8_t, float, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<int16_t, uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<int16_t, uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<int16_t, uint8_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<int16_t, int16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<int16_t, int16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<int16_t, int16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<int16_t, uint16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<int16_t, uint16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<int16_t, uint16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<int16_t, float, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<int16_t, float, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<int16_t, float, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<uint16_t, uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<uint16_t, uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<uint16_t, uint8_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<uint16_t, int16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<uint16_t, int16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<uint16_t, int16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<uint16_t, uint16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<uint16_t, uint16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<uint16_t, uint16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<uint16_t, float, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<uint16_t, float, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<uint16_t, float, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<float, uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<float, uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<float, uint8_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<float, int16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<float, int16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<float, int16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<float, uint16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<float, uint16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<float, uint16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<float, float, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<float, float, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<float, float, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+} // namespace tinycv
@@ -0,0 +1,135 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/convert.h"
+#include "tinycv/debug.h"
+
+#include <opencv2/imgproc.hpp>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+const float kMean[4] = {103.94f, 116.78f, 123.68f, 127.5f};
+const float kScale[4] = {0.017f, 0.0175f, 0.0171f, 1.f / 127.5f};
+
+template <typename T, int32_t nc, bool planar>
+void BM_ConvertNormalize_tinycv_aarch64(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<float[]> dst(new float[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::ConvertNormalize<T, nc>(height, width, width * nc, src.get(), kMean, kScale, true, planar, planar ? width : width * nc, dst.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace tinycv::debug;
+
+BENCHMARK_TEMPLATE(BM_ConvertNormalize_tinycv_aarch64, uint8_t, c1, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertNormalize_tinycv_aarch64, uint8_t, c3, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertNormalize_tinycv_aarch64, uint8_t, c3, true)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertNormalize_tinycv_aarch64, uint8_t, c4, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertNormalize_tinycv_aarch64, float, c3, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertNormalize_tinycv_aarch64, float, c3, true)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+template <typename TSrc, typename TDst, int32_t nc>
+void BM_ConvertTo_tinycv_aarch64(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<TSrc[]> src(new TSrc[width * height * nc]);
+    std::unique_ptr<TDst[]> dst(new TDst[width * height * nc]);
+    tinycv::debug::randomFill<TSrc>(src.get(), width * height * nc, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::ConvertTo<TSrc, TDst, nc>(height, width, width * nc, src.get(), 0.5f, 3.f, width * nc, dst.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_ConvertTo_tinycv_aarch64, uint8_t, float, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertTo_tinycv_aarch64, float, uint8_t, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertTo_tinycv_aarch64, uint16_t, float, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertTo_tinycv_aarch64, float, uint16_t, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertTo_tinycv_aarch64, int16_t, uint8_t, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertTo_tinycv_aarch64, uint8_t, int16_t, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+#ifdef TINYCV_BENCHMARK_OPENCV
+template <typename T, int32_t nc, bool planar>
+static void BM_ConvertNormalize_opencv_aarch64(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    cv::Mat iMat(height, width, T2CvType<T, nc>::type, src.get());
+    cv::Mat fMat, oMat;
+    std::vector<cv::Mat> channels;
+    for (auto _ : state) {
+        iMat.convertTo(fMat, CV_32F);
+        if (nc == 3) {
+            cv::cvtColor(fMat, fMat, cv::COLOR_BGR2RGB);
+        }
+        cv::split(fMat, channels);
+        for (int32_t c = 0; c < nc; ++c) {
+            channels[c] = (channels[c] - kMean[c]) * kScale[c];
+        }
+        if (!planar) {
+            cv::merge(channels, oMat);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_ConvertNormalize_opencv_aarch64, uint8_t, c1, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertNormalize_opencv_aarch64, uint8_t, c3, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertNormalize_opencv_aarch64, uint8_t, c3, true)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertNormalize_opencv_aarch64, float, c3, false)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertNormalize_opencv_aarch64, float, c3, true)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+template <typename TSrc, typename TDst, int32_t nc>
+static void BM_ConvertTo_opencv_aarch64(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<TSrc[]> src(new TSrc[width * height * nc]);
+    std::unique_ptr<TDst[]> dst_opencv(new TDst[width * height * nc]);
+    tinycv::debug::randomFill<TSrc>(src.get(), width * height * nc, 0, 255);
+    cv::Mat iMat(height, width, T2CvType<TSrc, nc>::type, src.get());
+    cv::Mat oMat(height, width, T2CvType<TDst, nc>::type, dst_opencv.get());
+    for (auto _ : state) {
+        iMat.convertTo(oMat, oMat.type(), 0.5, 3.0);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_ConvertTo_opencv_aarch64, uint8_t, float, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertTo_opencv_aarch64, float, uint8_t, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertTo_opencv_aarch64, uint16_t, float, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertTo_opencv_aarch64, float, uint16_t, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertTo_opencv_aarch64, int16_t, uint8_t, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_ConvertTo_opencv_aarch64, uint8_t, int16_t, c3)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+#endif //! TINYCV_BENCHMARK_OPENCV
+} // namespace
@@ -236,4 +236,106 @@ template void CopyMakeBorder<float, 4>(
     BorderType border_type,
     float border_value);
 
+template void CopyMakeBorder<half_t, 1>(
+    int32_t srcHeight,
+    int32_t srcWidth,
+    int32_t srcWidthStride,
+    const half_t *src,
+    int32_t dstHeight,
+    int32_t dstWidth,
+    int32_t dstWidthStride,
+    half_t *dst,
+    BorderType border_type,
+    half_t border_value);
+template void CopyMakeBorder<half_t, 3>(
+    int32_t srcHeight,
+    int32_t srcWidth,
+    int32_t srcWidthStride,
+    const half_t *src,
+    int32_t dstHeight,
+    int32_t dstWidth,
+    int32_t dstWidthStride,
+    half_t *dst,
+    BorderType border_type,
+    half_t border_value);
+template void CopyMakeBorder<half_t, 4>(
+    int32_t srcHeight,
+    int32_t srcWidth,
+    int32_t srcWidthStride,
+    const half_t *src,
+    int32_t dstHeight,
+    int32_t dstWidth,
+    int32_t dstWidthStride,
+    half_t *dst,
+    BorderType border_type,
+    half_t border_value);
+
+template void CopyMakeBorder<uint16_t, 1>(
+    int32_t srcHeight,
+    int32_t srcWidth,
+    int32_t srcWidthStride,
+    const uint16_t *src,
+    int32_t dstHeight,
+    int32_t dstWidth,
+    int32_t dstWidthStride,
+    uint16_t *dst,
+    BorderType border_type,
+    uint16_t border_value);
+template void CopyMakeBorder<uint16_t, 3>(
+    int32_t srcHeight,
+    int32_t srcWidth,
+    int32_t srcWidthStride,
+    const uint16_t *src,
+    int32_t dstHeight,
+    int32_t dstWidth,
+    int32_t dstWidthStride,
+    uint16_t *dst,
+    BorderType border_type,
+    uint16_t border_value);
+template void CopyMakeBorder<uint16_t, 4>(
+    int32_t srcHeight,
+    int32_t srcWidth,
+    int32_t srcWidthStride,
+    const uint16_t *src,
+    int32_t dstHeight,
+    int32_t dstWidth,
+    int32_t dstWidthStride,
+    uint16_t *dst,
+    BorderType border_type,
+    uint16_t border_value);
+
+template void CopyMakeBorder<int16_t, 1>(
+    int32_t srcHeight,
+    int32_t srcWidth,
+    int32_t srcWidthStride,
+    const int16_t *src,
+    int32_t dstHeight,
+    int32_t dstWidth,
+    int32_t dstWidthStride,
+    int16_t *dst,
+    BorderType border_type,
+    int16_t border_value);
+template void CopyMakeBorder<int16_t, 3>(
+    int32_t srcHeight,
+    int32_t srcWidth,
+    int32_t srcWidthStride,
+    const int16_t *src,
+    int32_t dstHeight,
+    int32_t dstWidth,
+    int32_t dstWidthStride,
+    int16_t *dst,
+    BorderType border_type,
+    int16_t border_value);
+template void CopyMakeBorder<int16_t, 4>(
+    int32_t srcHeight,
+    int32_t srcWidth,
+    int32_t srcWidthStride,
+    const int16_t *src,
+    int32_t dstHeight,
+    int32_t dstWidth,
+    int32_t dstWidthStride,
+    int16_t *dst,
+    BorderType border_type,
+    int16_t border_value);
+
 } // namespace tinycv
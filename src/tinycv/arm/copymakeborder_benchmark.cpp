@@ -71,6 +71,32 @@ BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, uint8_t, c1, tinycv::BORDER
 BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, uint8_t, c3, tinycv::BORDER_REFLECT101)->Args({320, 240, 320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
 BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, uint8_t, c4, tinycv::BORDER_REFLECT101)->Args({320, 240, 320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
 
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, uint16_t, c1, tinycv::BORDER_CONSTANT)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, uint16_t, c3, tinycv::BORDER_CONSTANT)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, uint16_t, c4, tinycv::BORDER_CONSTANT)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, uint16_t, c1, tinycv::BORDER_REPLICATE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, uint16_t, c3, tinycv::BORDER_REPLICATE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, uint16_t, c4, tinycv::BORDER_REPLICATE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, uint16_t, c1, tinycv::BORDER_REFLECT)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, uint16_t, c3, tinycv::BORDER_REFLECT)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, uint16_t, c4, tinycv::BORDER_REFLECT)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, uint16_t, c1, tinycv::BORDER_REFLECT101)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, uint16_t, c3, tinycv::BORDER_REFLECT101)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, uint16_t, c4, tinycv::BORDER_REFLECT101)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, tinycv::half_t, c1, tinycv::BORDER_CONSTANT)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, tinycv::half_t, c3, tinycv::BORDER_CONSTANT)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, tinycv::half_t, c4, tinycv::BORDER_CONSTANT)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, tinycv::half_t, c1, tinycv::BORDER_REPLICATE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, tinycv::half_t, c3, tinycv::BORDER_REPLICATE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, tinycv::half_t, c4, tinycv::BORDER_REPLICATE)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, tinycv::half_t, c1, tinycv::BORDER_REFLECT)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, tinycv::half_t, c3, tinycv::BORDER_REFLECT)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, tinycv::half_t, c4, tinycv::BORDER_REFLECT)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, tinycv::half_t, c1, tinycv::BORDER_REFLECT101)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, tinycv::half_t, c3, tinycv::BORDER_REFLECT101)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Copymakeborder_tinycv_aarch64, tinycv::half_t, c4, tinycv::BORDER_REFLECT101)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
 #ifdef TINYCV_BENCHMARK_OPENCV
 
 template <typename T, int32_t nc, tinycv::BorderType border_type>
@@ -77,6 +77,32 @@ R(copymakeborder_u8c1_reflect101_aarch64, uint8_t, 1, tinycv::BORDER_REFLECT_101
 R(copymakeborder_u8c3_reflect101_aarch64, uint8_t, 3, tinycv::BORDER_REFLECT_101, 1.01f);
 R(copymakeborder_u8c4_reflect101_aarch64, uint8_t, 4, tinycv::BORDER_REFLECT_101, 1.01f);
 
+R(copymakeborder_u16c1_constant_aarch64, uint16_t, 1, tinycv::BORDER_CONSTANT, 1.01f);
+R(copymakeborder_u16c3_constant_aarch64, uint16_t, 3, tinycv::BORDER_CONSTANT, 1.01f);
+R(copymakeborder_u16c4_constant_aarch64, uint16_t, 4, tinycv::BORDER_CONSTANT, 1.01f);
+R(copymakeborder_u16c1_replicate_aarch64, uint16_t, 1, tinycv::BORDER_REPLICATE, 1.01f);
+R(copymakeborder_u16c3_replicate_aarch64, uint16_t, 3, tinycv::BORDER_REPLICATE, 1.01f);
+R(copymakeborder_u16c4_replicate_aarch64, uint16_t, 4, tinycv::BORDER_REPLICATE, 1.01f);
+R(copymakeborder_u16c1_reflect_aarch64, uint16_t, 1, tinycv::BORDER_REFLECT, 1.01f);
+R(copymakeborder_u16c3_reflect_aarch64, uint16_t, 3, tinycv::BORDER_REFLECT, 1.01f);
+R(copymakeborder_u16c4_reflect_aarch64, uint16_t, 4, tinycv::BORDER_REFLECT, 1.01f);
+R(copymakeborder_u16c1_reflect101_aarch64, uint16_t, 1, tinycv::BORDER_REFLECT_101, 1.01f);
+R(copymakeborder_u16c3_reflect101_aarch64, uint16_t, 3, tinycv::BORDER_REFLECT_101, 1.01f);
+R(copymakeborder_u16c4_reflect101_aarch64, uint16_t, 4, tinycv::BORDER_REFLECT_101, 1.01f);
+
+R(copymakeborder_s16c1_constant_aarch64, int16_t, 1, tinycv::BORDER_CONSTANT, 1.01f);
+R(copymakeborder_s16c3_constant_aarch64, int16_t, 3, tinycv::BORDER_CONSTANT, 1.01f);
+R(copymakeborder_s16c4_constant_aarch64, int16_t, 4, tinycv::BORDER_CONSTANT, 1.01f);
+R(copymakeborder_s16c1_replicate_aarch64, int16_t, 1, tinycv::BORDER_REPLICATE, 1.01f);
+R(copymakeborder_s16c3_replicate_aarch64, int16_t, 3, tinycv::BORDER_REPLICATE, 1.01f);
+R(copymakeborder_s16c4_replicate_aarch64, int16_t, 4, tinycv::BORDER_REPLICATE, 1.01f);
+R(copymakeborder_s16c1_reflect_aarch64, int16_t, 1, tinycv::BORDER_REFLECT, 1.01f);
+R(copymakeborder_s16c3_reflect_aarch64, int16_t, 3, tinycv::BORDER_REFLECT, 1.01f);
+R(copymakeborder_s16c4_reflect_aarch64, int16_t, 4, tinycv::BORDER_REFLECT, 1.01f);
+R(copymakeborder_s16c1_reflect101_aarch64, int16_t, 1, tinycv::BORDER_REFLECT_101, 1.01f);
+R(copymakeborder_s16c3_reflect101_aarch64, int16_t, 3, tinycv::BORDER_REFLECT_101, 1.01f);
+R(copymakeborder_s16c4_reflect101_aarch64, int16_t, 4, tinycv::BORDER_REFLECT_101, 1.01f);
+
 R(copymakeborder_fp32c1_constant_aarch64, float, 1, tinycv::BORDER_CONSTANT, 1.01f);
 R(copymakeborder_fp32c3_constant_aarch64, float, 3, tinycv::BORDER_CONSTANT, 1.01f);
 R(copymakeborder_fp32c4_constant_aarch64, float, 4, tinycv::BORDER_CONSTANT, 1.01f);
@@ -89,3 +115,58 @@ R(copymakeborder_fp32c4_reflect_aarch64, float, 4, tinycv::BORDER_REFLECT, 1.01f
 R(copymakeborder_fp32c1_reflect101_aarch64, float, 1, tinycv::BORDER_REFLECT_101, 1.01f);
 R(copymakeborder_fp32c3_reflect101_aarch64, float, 3, tinycv::BORDER_REFLECT_101, 1.01f);
 R(copymakeborder_fp32c4_reflect101_aarch64, float, 4, tinycv::BORDER_REFLECT_101, 1.01f);
+
+template <int32_t nc, tinycv::BorderType border_type>
+void CopymakeborderHalfTest(int32_t height, int32_t width, int32_t padding, float diff)
+{
+    int32_t input_height = height;
+    int32_t input_width = width;
+    int32_t output_height = height + 2 * padding;
+    int32_t output_width = width + 2 * padding;
+    std::unique_ptr<tinycv::half_t[]> src(new tinycv::half_t[input_height * input_width * nc]);
+    std::unique_ptr<float[]> src_f32(new float[input_height * input_width * nc]);
+    std::unique_ptr<float[]> dst_f32(new float[output_height * output_width * nc]);
+    std::unique_ptr<tinycv::half_t[]> dst_ref(new tinycv::half_t[output_height * output_width * nc]);
+    std::unique_ptr<tinycv::half_t[]> dst(new tinycv::half_t[output_height * output_width * nc]);
+    randomFillHalf(src.get(), src_f32.get(), input_height * input_width * nc, 0, 255);
+    cv::Mat src_opencv(input_height, input_width, CV_MAKETYPE(CV_32F, nc), src_f32.get(), sizeof(float) * input_width * nc);
+    cv::Mat dst_opencv(output_height, output_width, CV_MAKETYPE(CV_32F, nc), dst_f32.get(), sizeof(float) * output_width * nc);
+    cv::BorderTypes cv_border_type;
+    if (border_type == tinycv::BORDER_CONSTANT) {
+        cv_border_type = cv::BORDER_CONSTANT;
+    } else if (border_type == tinycv::BORDER_REPLICATE) {
+        cv_border_type = cv::BORDER_REPLICATE;
+    } else if (border_type == tinycv::BORDER_REFLECT) {
+        cv_border_type = cv::BORDER_REFLECT;
+    } else if (border_type == tinycv::BORDER_REFLECT101) {
+        cv_border_type = cv::BORDER_REFLECT101;
+    }
+    tinycv::CopyMakeBorder<tinycv::half_t, nc>(input_height, input_width, input_width * nc, src.get(), output_height, output_width, output_width * nc, dst.get(), border_type);
+    cv::copyMakeBorder(src_opencv, dst_opencv, padding, padding, padding, padding, cv_border_type);
+    for (int32_t i = 0; i < output_height * output_width * nc; ++i) {
+        dst_ref[i] = tinycv::half_t(dst_f32[i]);
+    }
+    checkResult<tinycv::half_t, nc>(dst_ref.get(), dst.get(), output_height, output_width, output_width * nc, output_width * nc, diff);
+}
+
+#define R_HALF(name, nc, border_type, diff)                             \
+    TEST(name, arm)                                                     \
+    {                                                                   \
+        CopymakeborderHalfTest<nc, border_type>(240, 320, 1, diff);     \
+        CopymakeborderHalfTest<nc, border_type>(241, 321, 2, diff);     \
+        CopymakeborderHalfTest<nc, border_type>(480, 640, 3, diff);     \
+        CopymakeborderHalfTest<nc, border_type>(720, 1280, 4, diff);    \
+    }
+
+R_HALF(copymakeborder_fp16c1_constant_aarch64, 1, tinycv::BORDER_CONSTANT, 1e-3f);
+R_HALF(copymakeborder_fp16c3_constant_aarch64, 3, tinycv::BORDER_CONSTANT, 1e-3f);
+R_HALF(copymakeborder_fp16c4_constant_aarch64, 4, tinycv::BORDER_CONSTANT, 1e-3f);
+R_HALF(copymakeborder_fp16c1_replicate_aarch64, 1, tinycv::BORDER_REPLICATE, 1e-3f);
+R_HALF(copymakeborder_fp16c3_replicate_aarch64, 3, tinycv::BORDER_REPLICATE, 1e-3f);
+R_HALF(copymakeborder_fp16c4_replicate_aarch64, 4, tinycv::BORDER_REPLICATE, 1e-3f);
+R_HALF(copymakeborder_fp16c1_reflect_aarch64, 1, tinycv::BORDER_REFLECT, 1e-3f);
+R_HALF(copymakeborder_fp16c3_reflect_aarch64, 3, tinycv::BORDER_REFLECT, 1e-3f);
+R_HALF(copymakeborder_fp16c4_reflect_aarch64, 4, tinycv::BORDER_REFLECT, 1e-3f);
+R_HALF(copymakeborder_fp16c1_reflect101_aarch64, 1, tinycv::BORDER_REFLECT_101, 1e-3f);
+R_HALF(copymakeborder_fp16c3_reflect101_aarch64, 3, tinycv::BORDER_REFLECT_101, 1e-3f);
+R_HALF(copymakeborder_fp16c4_reflect101_aarch64, 4, tinycv::BORDER_REFLECT_101, 1e-3f);
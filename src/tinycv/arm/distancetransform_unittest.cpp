@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/distancetransform.h"
+#include "tinycv/arm/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <memory>
+
+void DistanceTransformTest(int32_t height, int32_t width, int32_t density, tinycv::DistanceType distanceType, int32_t maskSize)
+{
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<float[]> dst(new float[width * height]);
+    std::unique_ptr<float[]> dst_opencv(new float[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    //! about `density` percent of the pixels are sources
+    for (int32_t i = 0; i < width * height; ++i) {
+        src[i] = src[i] * 100 < density * 255 ? 0 : 255;
+    }
+
+    tinycv::DistanceTransform(height, width, width, src.get(), width, dst.get(), distanceType, maskSize);
+
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat oMat(height, width, CV_32FC1, dst_opencv.get());
+    cv::distanceTransform(iMat, oMat, (int)distanceType, maskSize, CV_32F);
+
+    checkResult<float, 1>(dst.get(), dst_opencv.get(), height, width, width, width, 1e-5f);
+}
+
+TEST(DISTANCE_TRANSFORM_L2, arm)
+{
+    DistanceTransformTest(480, 640, 1, tinycv::DIST_L2, 3);
+    DistanceTransformTest(480, 640, 1, tinycv::DIST_L2, 5);
+    DistanceTransformTest(101, 99, 20, tinycv::DIST_L2, 3);
+    DistanceTransformTest(101, 99, 20, tinycv::DIST_L2, 5);
+    DistanceTransformTest(3, 5, 20, tinycv::DIST_L2, 5);
+}
+
+TEST(DISTANCE_TRANSFORM_L1, arm)
+{
+    DistanceTransformTest(480, 640, 1, tinycv::DIST_L1, 3);
+    DistanceTransformTest(101, 99, 20, tinycv::DIST_L1, 3);
+}
+
+TEST(DISTANCE_TRANSFORM_C, arm)
+{
+    DistanceTransformTest(480, 640, 1, tinycv::DIST_C, 3);
+    DistanceTransformTest(101, 99, 20, tinycv::DIST_C, 3);
+}
@@ -371,6 +371,129 @@ void flip_all_u8(
     }
 }
 
+static inline uint16x8_t vreverseq_u16(uint16x8_t v)
+{
+    v = vrev64q_u16(v);
+    return vcombine_u16(vget_high_u16(v), vget_low_u16(v));
+}
+
+static void flip_row_u16(
+    const uint16_t *src,
+    int32_t channels,
+    int32_t width,
+    uint16_t *dst)
+{
+    int32_t j = 0;
+    switch (channels) {
+        case 1:
+            for (; j <= width - 8; j += 8) {
+                uint16x8_t right = vld1q_u16(src + (width - j - 8));
+                vst1q_u16(dst + j, vreverseq_u16(right));
+            }
+            break;
+        case 2:
+            for (; j <= width - 8; j += 8) {
+                uint16x8x2_t right = vld2q_u16(src + (width - j - 8) * 2);
+                right.val[0] = vreverseq_u16(right.val[0]);
+                right.val[1] = vreverseq_u16(right.val[1]);
+                vst2q_u16(dst + j * 2, right);
+            }
+            break;
+        case 3:
+            for (; j <= width - 8; j += 8) {
+                uint16x8x3_t right = vld3q_u16(src + (width - j - 8) * 3);
+                right.val[0] = vreverseq_u16(right.val[0]);
+                right.val[1] = vreverseq_u16(right.val[1]);
+                right.val[2] = vreverseq_u16(right.val[2]);
+                vst3q_u16(dst + j * 3, right);
+            }
+            break;
+        case 4:
+            for (; j <= width - 8; j += 8) {
+                uint16x8x4_t right = vld4q_u16(src + (width - j - 8) * 4);
+                right.val[0] = vreverseq_u16(right.val[0]);
+                right.val[1] = vreverseq_u16(right.val[1]);
+                right.val[2] = vreverseq_u16(right.val[2]);
+                right.val[3] = vreverseq_u16(right.val[3]);
+                vst4q_u16(dst + j * 4, right);
+            }
+            break;
+        default:
+            break;
+    }
+    for (; j < width; ++j) {
+        for (int32_t c = 0; c < channels; ++c) {
+            dst[j * channels + c] = src[(width - j - 1) * channels + c];
+        }
+    }
+}
+
+void flip_vertical_u16(
+    const uint16_t *src,
+    int32_t channels,
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    int32_t outWidthStride,
+    uint16_t *dst)
+{
+    if (nullptr == src) {
+        return;
+    }
+    if (nullptr == dst) {
+        return;
+    }
+
+    width *= channels;
+    for (int32_t i = 0; i < height; ++i) {
+        const uint16_t *up_in_ptr = src + i * inWidthStride;
+        uint16_t *down_out_ptr = dst + (height - i - 1) * outWidthStride;
+        memcpy(down_out_ptr, up_in_ptr, width * sizeof(uint16_t));
+    }
+}
+
+void flip_horizontal_u16(
+    const uint16_t *src,
+    int32_t channels,
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    int32_t outWidthStride,
+    uint16_t *dst)
+{
+    if (nullptr == src) {
+        return;
+    }
+    if (nullptr == dst) {
+        return;
+    }
+
+    for (int32_t i = 0; i < height; ++i) {
+        flip_row_u16(src + i * inWidthStride, channels, width, dst + i * outWidthStride);
+    }
+}
+
+void flip_all_u16(
+    const uint16_t *src,
+    int32_t channels,
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    int32_t outWidthStride,
+    uint16_t *dst)
+{
+    if (nullptr == src) {
+        return;
+    }
+    if (nullptr == dst) {
+        return;
+    }
+
+    for (int32_t i = 0; i < height; ++i) {
+        flip_row_u16(src + (height - i - 1) * inWidthStride, channels, width, dst + i * outWidthStride);
+    }
+}
+
 template <>
 void Flip<float, 1>(
     int32_t height,
@@ -523,4 +646,248 @@ void Flip<uint8_t, 4>(
     }
 }
 
+template <>
+void Flip<half_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outWidthStride,
+    half_t *outData,
+    int32_t flipCode)
+{
+    const uint16_t *src = reinterpret_cast<const uint16_t *>(inData);
+    uint16_t *dst = reinterpret_cast<uint16_t *>(outData);
+    if (flipCode == 0) {
+        return flip_vertical_u16(src, 1, height, width, inWidthStride, outWidthStride, dst);
+    } else if (flipCode > 0) {
+        return flip_horizontal_u16(src, 1, height, width, inWidthStride, outWidthStride, dst);
+    } else { //! flipCode < 0
+        return flip_all_u16(src, 1, height, width, inWidthStride, outWidthStride, dst);
+    }
+}
+
+template <>
+void Flip<half_t, 2>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outWidthStride,
+    half_t *outData,
+    int32_t flipCode)
+{
+    const uint16_t *src = reinterpret_cast<const uint16_t *>(inData);
+    uint16_t *dst = reinterpret_cast<uint16_t *>(outData);
+    if (flipCode == 0) {
+        return flip_vertical_u16(src, 2, height, width, inWidthStride, outWidthStride, dst);
+    } else if (flipCode > 0) {
+        return flip_horizontal_u16(src, 2, height, width, inWidthStride, outWidthStride, dst);
+    } else { //! flipCode < 0
+        return flip_all_u16(src, 2, height, width, inWidthStride, outWidthStride, dst);
+    }
+}
+
+template <>
+void Flip<half_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outWidthStride,
+    half_t *outData,
+    int32_t flipCode)
+{
+    const uint16_t *src = reinterpret_cast<const uint16_t *>(inData);
+    uint16_t *dst = reinterpret_cast<uint16_t *>(outData);
+    if (flipCode == 0) {
+        return flip_vertical_u16(src, 3, height, width, inWidthStride, outWidthStride, dst);
+    } else if (flipCode > 0) {
+        return flip_horizontal_u16(src, 3, height, width, inWidthStride, outWidthStride, dst);
+    } else { //! flipCode < 0
+        return flip_all_u16(src, 3, height, width, inWidthStride, outWidthStride, dst);
+    }
+}
+
+template <>
+void Flip<half_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outWidthStride,
+    half_t *outData,
+    int32_t flipCode)
+{
+    const uint16_t *src = reinterpret_cast<const uint16_t *>(inData);
+    uint16_t *dst = reinterpret_cast<uint16_t *>(outData);
+    if (flipCode == 0) {
+        return flip_vertical_u16(src, 4, height, width, inWidthStride, outWidthStride, dst);
+    } else if (flipCode > 0) {
+        return flip_horizontal_u16(src, 4, height, width, inWidthStride, outWidthStride, dst);
+    } else { //! flipCode < 0
+        return flip_all_u16(src, 4, height, width, inWidthStride, outWidthStride, dst);
+    }
+}
+
+template <>
+void Flip<uint16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outWidthStride,
+    uint16_t *outData,
+    int32_t flipCode)
+{
+    if (flipCode == 0) {
+        return flip_vertical_u16(inData, 1, height, width, inWidthStride, outWidthStride, outData);
+    } else if (flipCode > 0) {
+        return flip_horizontal_u16(inData, 1, height, width, inWidthStride, outWidthStride, outData);
+    } else { //! flipCode < 0
+        return flip_all_u16(inData, 1, height, width, inWidthStride, outWidthStride, outData);
+    }
+}
+
+template <>
+void Flip<uint16_t, 2>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outWidthStride,
+    uint16_t *outData,
+    int32_t flipCode)
+{
+    if (flipCode == 0) {
+        return flip_vertical_u16(inData, 2, height, width, inWidthStride, outWidthStride, outData);
+    } else if (flipCode > 0) {
+        return flip_horizontal_u16(inData, 2, height, width, inWidthStride, outWidthStride, outData);
+    } else { //! flipCode < 0
+        return flip_all_u16(inData, 2, height, width, inWidthStride, outWidthStride, outData);
+    }
+}
+
+template <>
+void Flip<uint16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outWidthStride,
+    uint16_t *outData,
+    int32_t flipCode)
+{
+    if (flipCode == 0) {
+        return flip_vertical_u16(inData, 3, height, width, inWidthStride, outWidthStride, outData);
+    } else if (flipCode > 0) {
+        return flip_horizontal_u16(inData, 3, height, width, inWidthStride, outWidthStride, outData);
+    } else { //! flipCode < 0
+        return flip_all_u16(inData, 3, height, width, inWidthStride, outWidthStride, outData);
+    }
+}
+
+template <>
+void Flip<uint16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outWidthStride,
+    uint16_t *outData,
+    int32_t flipCode)
+{
+    if (flipCode == 0) {
+        return flip_vertical_u16(inData, 4, height, width, inWidthStride, outWidthStride, outData);
+    } else if (flipCode > 0) {
+        return flip_horizontal_u16(inData, 4, height, width, inWidthStride, outWidthStride, outData);
+    } else { //! flipCode < 0
+        return flip_all_u16(inData, 4, height, width, inWidthStride, outWidthStride, outData);
+    }
+}
+
+template <>
+void Flip<int16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    int32_t outWidthStride,
+    int16_t *outData,
+    int32_t flipCode)
+{
+    const uint16_t *src = reinterpret_cast<const uint16_t *>(inData);
+    uint16_t *dst = reinterpret_cast<uint16_t *>(outData);
+    if (flipCode == 0) {
+        return flip_vertical_u16(src, 1, height, width, inWidthStride, outWidthStride, dst);
+    } else if (flipCode > 0) {
+        return flip_horizontal_u16(src, 1, height, width, inWidthStride, outWidthStride, dst);
+    } else { //! flipCode < 0
+        return flip_all_u16(src, 1, height, width, inWidthStride, outWidthStride, dst);
+    }
+}
+
+template <>
+void Flip<int16_t, 2>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    int32_t outWidthStride,
+    int16_t *outData,
+    int32_t flipCode)
+{
+    const uint16_t *src = reinterpret_cast<const uint16_t *>(inData);
+    uint16_t *dst = reinterpret_cast<uint16_t *>(outData);
+    if (flipCode == 0) {
+        return flip_vertical_u16(src, 2, height, width, inWidthStride, outWidthStride, dst);
+    } else if (flipCode > 0) {
+        return flip_horizontal_u16(src, 2, height, width, inWidthStride, outWidthStride, dst);
+    } else { //! flipCode < 0
+        return flip_all_u16(src, 2, height, width, inWidthStride, outWidthStride, dst);
+    }
+}
+
+template <>
+void Flip<int16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    int32_t outWidthStride,
+    int16_t *outData,
+    int32_t flipCode)
+{
+    const uint16_t *src = reinterpret_cast<const uint16_t *>(inData);
+    uint16_t *dst = reinterpret_cast<uint16_t *>(outData);
+    if (flipCode == 0) {
+        return flip_vertical_u16(src, 3, height, width, inWidthStride, outWidthStride, dst);
+    } else if (flipCode > 0) {
+        return flip_horizontal_u16(src, 3, height, width, inWidthStride, outWidthStride, dst);
+    } else { //! flipCode < 0
+        return flip_all_u16(src, 3, height, width, inWidthStride, outWidthStride, dst);
+    }
+}
+
+template <>
+void Flip<int16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    int32_t outWidthStride,
+    int16_t *outData,
+    int32_t flipCode)
+{
+    const uint16_t *src = reinterpret_cast<const uint16_t *>(inData);
+    uint16_t *dst = reinterpret_cast<uint16_t *>(outData);
+    if (flipCode == 0) {
+        return flip_vertical_u16(src, 4, height, width, inWidthStride, outWidthStride, dst);
+    } else if (flipCode > 0) {
+        return flip_horizontal_u16(src, 4, height, width, inWidthStride, outWidthStride, dst);
+    } else { //! flipCode < 0
+        return flip_all_u16(src, 4, height, width, inWidthStride, outWidthStride, dst);
+    }
+}
+
 } // namespace tinycv
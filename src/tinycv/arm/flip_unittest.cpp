@@ -104,3 +104,115 @@ TEST(FLIP_UINT8, arm)
     FlipTest<uint8_t, 4>(101, 101, 1);
     FlipTest<uint8_t, 4>(101, 101, -1);
 }
+
+TEST(FLIP_UINT16, arm)
+{
+    FlipTest<uint16_t, 1>(640, 720, 0);
+    FlipTest<uint16_t, 1>(640, 720, 1);
+    FlipTest<uint16_t, 1>(640, 720, -1);
+
+    FlipTest<uint16_t, 3>(640, 720, 0);
+    FlipTest<uint16_t, 3>(640, 720, 1);
+    FlipTest<uint16_t, 3>(640, 720, -1);
+
+    FlipTest<uint16_t, 4>(640, 720, 0);
+    FlipTest<uint16_t, 4>(640, 720, 1);
+    FlipTest<uint16_t, 4>(640, 720, -1);
+
+    FlipTest<uint16_t, 1>(101, 101, 0);
+    FlipTest<uint16_t, 1>(101, 101, 1);
+    FlipTest<uint16_t, 1>(101, 101, -1);
+
+    FlipTest<uint16_t, 2>(101, 101, 0);
+    FlipTest<uint16_t, 2>(101, 101, 1);
+    FlipTest<uint16_t, 2>(101, 101, -1);
+
+    FlipTest<uint16_t, 3>(101, 101, 0);
+    FlipTest<uint16_t, 3>(101, 101, 1);
+    FlipTest<uint16_t, 3>(101, 101, -1);
+
+    FlipTest<uint16_t, 4>(101, 101, 0);
+    FlipTest<uint16_t, 4>(101, 101, 1);
+    FlipTest<uint16_t, 4>(101, 101, -1);
+}
+
+TEST(FLIP_INT16, arm)
+{
+    FlipTest<int16_t, 1>(640, 720, 0);
+    FlipTest<int16_t, 1>(640, 720, 1);
+    FlipTest<int16_t, 1>(640, 720, -1);
+
+    FlipTest<int16_t, 3>(640, 720, 0);
+    FlipTest<int16_t, 3>(640, 720, 1);
+    FlipTest<int16_t, 3>(640, 720, -1);
+
+    FlipTest<int16_t, 4>(640, 720, 0);
+    FlipTest<int16_t, 4>(640, 720, 1);
+    FlipTest<int16_t, 4>(640, 720, -1);
+
+    FlipTest<int16_t, 1>(101, 101, 0);
+    FlipTest<int16_t, 1>(101, 101, 1);
+    FlipTest<int16_t, 1>(101, 101, -1);
+
+    FlipTest<int16_t, 2>(101, 101, 0);
+    FlipTest<int16_t, 2>(101, 101, 1);
+    FlipTest<int16_t, 2>(101, 101, -1);
+
+    FlipTest<int16_t, 3>(101, 101, 0);
+    FlipTest<int16_t, 3>(101, 101, 1);
+    FlipTest<int16_t, 3>(101, 101, -1);
+
+    FlipTest<int16_t, 4>(101, 101, 0);
+    FlipTest<int16_t, 4>(101, 101, 1);
+    FlipTest<int16_t, 4>(101, 101, -1);
+}
+
+template <int32_t nc>
+void FlipHalfTest(int32_t height, int32_t width, int32_t flipCode)
+{
+    std::unique_ptr<tinycv::half_t[]> src(new tinycv::half_t[width * height * nc]);
+    std::unique_ptr<float[]> src_f32(new float[width * height * nc]);
+    randomFillHalf(src.get(), src_f32.get(), width * height * nc, 0, 255);
+
+    std::unique_ptr<tinycv::half_t[]> dst(new tinycv::half_t[width * height * nc]);
+    tinycv::Flip<tinycv::half_t, nc>(height, width, width * nc, src.get(), width * nc, dst.get(), flipCode);
+
+    std::unique_ptr<float[]> dst_opencv(new float[width * height * nc]);
+    cv::Mat iMat(height, width, CV_MAKETYPE(CV_32F, nc), src_f32.get());
+    cv::Mat oMat(height, width, CV_MAKETYPE(CV_32F, nc), dst_opencv.get());
+    cv::flip(iMat, oMat, flipCode);
+
+    std::unique_ptr<tinycv::half_t[]> dst_ref(new tinycv::half_t[width * height * nc]);
+    for (int32_t i = 0; i < width * height * nc; ++i) {
+        dst_ref[i] = tinycv::half_t(dst_opencv[i]);
+    }
+
+    checkResult<tinycv::half_t, nc>(dst.get(), dst_ref.get(), height, width, width * nc, width * nc, 1e-3f);
+}
+
+TEST(FLIP_FP16, arm)
+{
+    FlipHalfTest<1>(640, 720, 0);
+    FlipHalfTest<1>(640, 720, 1);
+    FlipHalfTest<1>(640, 720, -1);
+
+    FlipHalfTest<3>(640, 720, 0);
+    FlipHalfTest<3>(640, 720, 1);
+    FlipHalfTest<3>(640, 720, -1);
+
+    FlipHalfTest<4>(640, 720, 0);
+    FlipHalfTest<4>(640, 720, 1);
+    FlipHalfTest<4>(640, 720, -1);
+
+    FlipHalfTest<1>(101, 101, 0);
+    FlipHalfTest<1>(101, 101, 1);
+    FlipHalfTest<1>(101, 101, -1);
+
+    FlipHalfTest<3>(101, 101, 0);
+    FlipHalfTest<3>(101, 101, 1);
+    FlipHalfTest<3>(101, 101, -1);
+
+    FlipHalfTest<4>(101, 101, 0);
+    FlipHalfTest<4>(101, 101, 1);
+    FlipHalfTest<4>(101, 101, -1);
+}
@@ -0,0 +1,304 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/histogram.h"
+#include "tinycv/lut.h"
+#include "tinycv/types.h"
+#include "tinycv/sys.h"
+
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <algorithm>
+#include <arm_neon.h>
+
+namespace tinycv {
+
+#define HIST_SIZE 256
+
+// adds the pixels to four sub-histograms, consecutive pixels go to different sub-histograms
+static void hist_accumulate(int32_t height, int32_t width, int32_t stride, const uint8_t *in, uint32_t (*sub)[HIST_SIZE])
+{
+    for (int32_t y = 0; y < height; ++y) {
+        const uint8_t *row = in + (int64_t)y * stride;
+        int32_t x = 0;
+        for (; x <= width - 8; x += 8) {
+            uint64_t v;
+            memcpy(&v, row + x, sizeof(v));
+            sub[0][v & 0xff]++;
+            sub[1][(v >> 8) & 0xff]++;
+            sub[2][(v >> 16) & 0xff]++;
+            sub[3][(v >> 24) & 0xff]++;
+            sub[0][(v >> 32) & 0xff]++;
+            sub[1][(v >> 40) & 0xff]++;
+            sub[2][(v >> 48) & 0xff]++;
+            sub[3][v >> 56]++;
+        }
+        for (; x < width; ++x) {
+            sub[0][row[x]]++;
+        }
+    }
+}
+
+static void hist_merge(uint32_t (*sub)[HIST_SIZE], uint32_t *hist)
+{
+    for (int32_t i = 0; i < HIST_SIZE; i += 4) {
+        uint32x4_t s = vaddq_u32(vld1q_u32(sub[0] + i), vld1q_u32(sub[1] + i));
+        s            = vaddq_u32(s, vld1q_u32(sub[2] + i));
+        s            = vaddq_u32(s, vld1q_u32(sub[3] + i));
+        vst1q_u32(hist + i, s);
+    }
+}
+
+// same rounding as OpenCV's saturate_cast<uchar>(float), to nearest even
+static inline uint8_t hist_round_u8(float v)
+{
+    int32_t r = (int32_t)lrintf(v);
+    return (uint8_t)std::min(std::max(r, 0), 255);
+}
+
+void CalcHist(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    uint32_t *hist)
+{
+    if (nullptr == inData || nullptr == hist) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth) {
+        return;
+    }
+    uint32_t sub[4][HIST_SIZE];
+    memset(sub, 0, sizeof(sub));
+    hist_accumulate(inHeight, inWidth, inWidthStride, inData, sub);
+    hist_merge(sub, hist);
+}
+
+void EqualizeHist(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth || outWidthStride < inWidth) {
+        return;
+    }
+    uint32_t hist[HIST_SIZE];
+    CalcHist(inHeight, inWidth, inWidthStride, inData, hist);
+
+    uint8_t lut[HIST_SIZE];
+    int32_t i = 0;
+    while (0 == hist[i]) {
+        ++i;
+    }
+    int32_t total = inHeight * inWidth;
+    if ((int32_t)hist[i] == total) {
+        memset(lut, i, sizeof(lut));
+    } else {
+        float scale = (HIST_SIZE - 1.f) / (total - hist[i]);
+        int32_t sum = 0;
+        memset(lut, 0, i + 1);
+        for (++i; i < HIST_SIZE; ++i) {
+            sum += hist[i];
+            lut[i] = hist_round_u8(sum * scale);
+        }
+    }
+    LUT<1>(inHeight, inWidth, inWidthStride, inData, outWidthStride, outData, 1, lut);
+}
+
+// BORDER_REFLECT_101
+static inline int32_t clahe_reflect101(int32_t p, int32_t len)
+{
+    if (len == 1) {
+        return 0;
+    }
+    while (p < 0 || p >= len) {
+        p = p < 0 ? -p : 2 * len - p - 2;
+    }
+    return p;
+}
+
+// 4 interpolated pixels of CLAHE, in the order of OpenCV so that the roundings are the same
+static inline int32x4_t clahe_blend4(const uint32_t *l11, const uint32_t *l12, const uint32_t *l21, const uint32_t *l22, const float *xa, const float *xa1, float32x4_t ya, float32x4_t ya1)
+{
+    float32x4_t vxa  = vld1q_f32(xa);
+    float32x4_t vxa1 = vld1q_f32(xa1);
+    float32x4_t r1   = vaddq_f32(vmulq_f32(vcvtq_f32_u32(vld1q_u32(l11)), vxa1), vmulq_f32(vcvtq_f32_u32(vld1q_u32(l12)), vxa));
+    float32x4_t r2   = vaddq_f32(vmulq_f32(vcvtq_f32_u32(vld1q_u32(l21)), vxa1), vmulq_f32(vcvtq_f32_u32(vld1q_u32(l22)), vxa));
+    return vcvtnq_s32_f32(vaddq_f32(vmulq_f32(r1, ya1), vmulq_f32(r2, ya)));
+}
+
+void CLAHE(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    float clipLimit,
+    int32_t tilesX,
+    int32_t tilesY)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth || outWidthStride < inWidth) {
+        return;
+    }
+    if (tilesX <= 0 || tilesY <= 0) {
+        return;
+    }
+
+    // like OpenCV, an image which is not a multiple of the tile grid is extended on the right and at the
+    // bottom, by a full tile row or column when only the other dimension is off
+    int32_t extWidth  = inWidth;
+    int32_t extHeight = inHeight;
+    if (inWidth % tilesX != 0 || inHeight % tilesY != 0) {
+        extWidth += tilesX - inWidth % tilesX;
+        extHeight += tilesY - inHeight % tilesY;
+    }
+    const int32_t tileWidth  = extWidth / tilesX;
+    const int32_t tileHeight = extHeight / tilesY;
+    const int32_t tileArea   = tileWidth * tileHeight;
+    int32_t clip             = 0;
+    if (clipLimit > 0.0f) {
+        clip = std::max((int32_t)((double)clipLimit * tileArea / HIST_SIZE), 1);
+    }
+    const float lutScale = (float)(HIST_SIZE - 1) / tileArea;
+
+    uint64_t size_for_luts = ((uint64_t)tilesX * tilesY * HIST_SIZE + 64 - 1) / 64 * 64;
+    uint64_t size_for_ind = ((uint64_t)inWidth * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    uint64_t size_for_xa = ((uint64_t)inWidth * sizeof(float) + 64 - 1) / 64 * 64;
+
+    uint64_t total_size = size_for_luts + size_for_ind * 2 + size_for_xa * 2;
+
+    void *temp_buffer = tinycv::ScratchAlloc(total_size, 64);
+    uint8_t *luts = (uint8_t *)temp_buffer;
+    int32_t *ind1 = (int32_t *)((unsigned char *)luts + size_for_luts);
+    int32_t *ind2 = (int32_t *)((unsigned char *)ind1 + size_for_ind);
+    float *xa = (float *)((unsigned char *)ind2 + size_for_ind);
+    float *xa1 = (float *)((unsigned char *)xa + size_for_xa);
+
+    // one lookup table per tile, the parts of a tile past the image are read through BORDER_REFLECT_101
+    uint32_t sub[4][HIST_SIZE];
+    uint32_t hist[HIST_SIZE];
+    for (int32_t ty = 0; ty < tilesY; ++ty) {
+        for (int32_t tx = 0; tx < tilesX; ++tx) {
+            memset(sub, 0, sizeof(sub));
+            const int32_t x0 = tx * tileWidth;
+            const int32_t x1 = std::min(x0 + tileWidth, inWidth);
+            for (int32_t y = ty * tileHeight; y < (ty + 1) * tileHeight; ++y) {
+                const uint8_t *row = inData + (int64_t)clahe_reflect101(y, inHeight) * inWidthStride;
+                if (x1 > x0) {
+                    hist_accumulate(1, x1 - x0, inWidthStride, row + x0, sub);
+                }
+                for (int32_t x = std::max(x0, inWidth); x < x0 + tileWidth; ++x) {
+                    sub[0][row[clahe_reflect101(x, inWidth)]]++;
+                }
+            }
+            hist_merge(sub, hist);
+
+            if (clip > 0) {
+                int32_t clipped = 0;
+                for (int32_t i = 0; i < HIST_SIZE; ++i) {
+                    if ((int32_t)hist[i] > clip) {
+                        clipped += hist[i] - clip;
+                        hist[i] = clip;
+                    }
+                }
+                int32_t redistBatch = clipped / HIST_SIZE;
+                int32_t residual    = clipped - redistBatch * HIST_SIZE;
+                for (int32_t i = 0; i < HIST_SIZE; ++i) {
+                    hist[i] += redistBatch;
+                }
+                if (residual != 0) {
+                    int32_t residualStep = std::max(HIST_SIZE / residual, 1);
+                    for (int32_t i = 0; i < HIST_SIZE && residual > 0; i += residualStep, residual--) {
+                        hist[i]++;
+                    }
+                }
+            }
+
+            uint8_t *lut = luts + ((int64_t)ty * tilesX + tx) * HIST_SIZE;
+            int32_t sum  = 0;
+            for (int32_t i = 0; i < HIST_SIZE; ++i) {
+                sum += hist[i];
+                lut[i] = hist_round_u8(sum * lutScale);
+            }
+        }
+    }
+
+    // horizontal interpolation weights and table offsets of every column
+    const float invTileWidth  = 1.0f / tileWidth;
+    const float invTileHeight = 1.0f / tileHeight;
+    for (int32_t x = 0; x < inWidth; ++x) {
+        float txf   = x * invTileWidth - 0.5f;
+        int32_t tx1 = (int32_t)floorf(txf);
+        int32_t tx2 = tx1 + 1;
+        xa[x]       = txf - tx1;
+        xa1[x]      = 1.0f - xa[x];
+        ind1[x]     = std::max(tx1, 0) * HIST_SIZE;
+        ind2[x]     = std::min(tx2, tilesX - 1) * HIST_SIZE;
+    }
+
+    for (int32_t y = 0; y < inHeight; ++y) {
+        float tyf           = y * invTileHeight - 0.5f;
+        int32_t ty1         = (int32_t)floorf(tyf);
+        int32_t ty2         = ty1 + 1;
+        float ya            = tyf - ty1;
+        float ya1           = 1.0f - ya;
+        const uint8_t *lut1 = luts + (int64_t)std::max(ty1, 0) * tilesX * HIST_SIZE;
+        const uint8_t *lut2 = luts + (int64_t)std::min(ty2, tilesY - 1) * tilesX * HIST_SIZE;
+        const uint8_t *in   = inData + (int64_t)y * inWidthStride;
+        uint8_t *out        = outData + (int64_t)y * outWidthStride;
+
+        const float32x4_t vya  = vdupq_n_f32(ya);
+        const float32x4_t vya1 = vdupq_n_f32(ya1);
+
+        int32_t x = 0;
+        for (; x <= inWidth - 8; x += 8) {
+            uint32_t l11[8], l12[8], l21[8], l22[8];
+            for (int32_t k = 0; k < 8; ++k) {
+                int32_t i1 = ind1[x + k] + in[x + k];
+                int32_t i2 = ind2[x + k] + in[x + k];
+                l11[k]     = lut1[i1];
+                l12[k]     = lut1[i2];
+                l21[k]     = lut2[i1];
+                l22[k]     = lut2[i2];
+            }
+            int32x4_t r0 = clahe_blend4(l11, l12, l21, l22, &xa[x], &xa1[x], vya, vya1);
+            int32x4_t r1 = clahe_blend4(l11 + 4, l12 + 4, l21 + 4, l22 + 4, &xa[x + 4], &xa1[x + 4], vya, vya1);
+            vst1_u8(out + x, vqmovn_u16(vcombine_u16(vqmovun_s32(r0), vqmovun_s32(r1))));
+        }
+        for (; x < inWidth; ++x) {
+            int32_t v = in[x];
+            float res = (lut1[ind1[x] + v] * xa1[x] + lut1[ind2[x] + v] * xa[x]) * ya1 + (lut2[ind1[x] + v] * xa1[x] + lut2[ind2[x] + v] * xa[x]) * ya;
+            out[x]    = hist_round_u8(res);
+        }
+    }
+
+    tinycv::ScratchFree(temp_buffer);
+}
+
+} // namespace tinycv
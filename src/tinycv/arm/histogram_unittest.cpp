@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/histogram.h"
+#include "tinycv/arm/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <memory>
+#include <vector>
+
+void CalcHistTest(int32_t height, int32_t width)
+{
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    uint32_t hist[256];
+
+    tinycv::CalcHist(height, width, width, src.get(), hist);
+
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat hist_opencv;
+    int32_t histSize = 256;
+    float range[] = {0, 256};
+    const float *ranges[] = {range};
+    int32_t channel = 0;
+    cv::calcHist(&iMat, 1, &channel, cv::Mat(), hist_opencv, 1, &histSize, ranges);
+
+    for (int32_t i = 0; i < 256; i++) {
+        EXPECT_EQ((float)hist[i], hist_opencv.ptr<float>()[i]);
+    }
+}
+
+void EqualizeHistTest(int32_t height, int32_t width, int32_t low, int32_t high)
+{
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst_opencv(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, low, high);
+
+    tinycv::EqualizeHist(height, width, width, src.get(), width, dst.get());
+
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat oMat(height, width, CV_8UC1, dst_opencv.get());
+    cv::equalizeHist(iMat, oMat);
+
+    checkResult<uint8_t, 1>(dst.get(), dst_opencv.get(), height, width, width, width, 0.01f);
+}
+
+void CLAHETest(int32_t height, int32_t width, float clipLimit, int32_t tilesX, int32_t tilesY)
+{
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst_opencv(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 40, 160);
+
+    tinycv::CLAHE(height, width, width, src.get(), width, dst.get(), clipLimit, tilesX, tilesY);
+
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat oMat(height, width, CV_8UC1, dst_opencv.get());
+    cv::createCLAHE(clipLimit, cv::Size(tilesX, tilesY))->apply(iMat, oMat);
+
+    checkResult<uint8_t, 1>(dst.get(), dst_opencv.get(), height, width, width, width, 1.01f);
+}
+
+// the Y plane of an NV12 frame processed in place, the chroma plane must be left untouched
+void CLAHENV12Test(int32_t height, int32_t width)
+{
+    int32_t stride = width + 32;
+    std::vector<uint8_t> frame(stride * height * 3 / 2);
+    tinycv::debug::randomFill<uint8_t>(frame.data(), stride * height * 3 / 2, 0, 255);
+    std::vector<uint8_t> origin(frame);
+    std::unique_ptr<uint8_t[]> dst_opencv(new uint8_t[width * height]);
+
+    tinycv::CLAHE(height, width, stride, frame.data(), stride, frame.data());
+
+    cv::Mat yMat(height, width, CV_8UC1, origin.data(), stride);
+    cv::Mat oMat(height, width, CV_8UC1, dst_opencv.get());
+    cv::createCLAHE()->apply(yMat, oMat);
+
+    checkResult<uint8_t, 1>(frame.data(), dst_opencv.get(), height, width, stride, width, 1.01f);
+    EXPECT_EQ(0, memcmp(frame.data() + stride * height, origin.data() + stride * height, stride * height / 2));
+}
+
+TEST(CALC_HIST_UINT8, arm)
+{
+    CalcHistTest(480, 640);
+    CalcHistTest(101, 99);
+    CalcHistTest(1, 7);
+}
+
+TEST(EQUALIZE_HIST_UINT8, arm)
+{
+    EqualizeHistTest(480, 640, 0, 255);
+    EqualizeHistTest(480, 640, 60, 120);
+    EqualizeHistTest(101, 99, 60, 120);
+    EqualizeHistTest(16, 16, 7, 7);
+}
+
+TEST(CLAHE_UINT8, arm)
+{
+    CLAHETest(480, 640, 40.0f, 8, 8);
+    CLAHETest(480, 640, 2.0f, 8, 8);
+    CLAHETest(101, 99, 40.0f, 8, 8);
+    CLAHETest(101, 99, 3.0f, 4, 6);
+    CLAHETest(96, 99, 0.0f, 8, 8);
+    CLAHENV12Test(480, 640);
+}
@@ -0,0 +1,419 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/integral.h"
+#include "tinycv/types.h"
+#include "tinycv/sys.h"
+
+#include <string.h>
+#include <stdint.h>
+#include <algorithm>
+#include <arm_neon.h>
+
+namespace tinycv {
+
+// below this many pixels per band a thread costs more than it saves
+#define INTEGRAL_MIN_BAND_PIXELS (1 << 16)
+
+static inline uint32x4_t integral_load4_u8(const uint8_t *src)
+{
+    uint32_t v;
+    memcpy(&v, src, sizeof(v));
+    return vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(v)))));
+}
+
+// out[0..3] = prev[0..3] + s
+static inline void integral_store4(const int32_t *prev, int32_t *out, int32x4_t s)
+{
+    vst1q_s32(out, vaddq_s32(vld1q_s32(prev), s));
+}
+static inline void integral_store4(const double *prev, double *out, int32x4_t s)
+{
+    vst1q_f64(out, vaddq_f64(vld1q_f64(prev), vcvtq_f64_s64(vmovl_s32(vget_low_s32(s)))));
+    vst1q_f64(out + 2, vaddq_f64(vld1q_f64(prev + 2), vcvtq_f64_s64(vmovl_s32(vget_high_s32(s)))));
+}
+
+// one row of the integral image: out[x] = prev[x] + Σ_{x' <= x} in[x'], the running sum of the row stays in
+// int32 which is exact for rows shorter than 2^31 / 255 pixels
+template <typename Tsum, int32_t channels>
+static void integral_row(const uint8_t *in, int32_t width, const Tsum *prev, Tsum *out)
+{
+    int32_t x = 0;
+    int32_t s[4];
+    if (channels == 1) {
+        const uint16x8_t vzero = vdupq_n_u16(0);
+        int32x4_t carry        = vdupq_n_s32(0);
+        for (; x <= width - 8; x += 8) {
+            // inclusive prefix sum of 8 u16 lanes
+            uint16x8_t v = vmovl_u8(vld1_u8(in + x));
+            v            = vaddq_u16(v, vextq_u16(vzero, v, 7));
+            v            = vaddq_u16(v, vextq_u16(vzero, v, 6));
+            v            = vaddq_u16(v, vextq_u16(vzero, v, 4));
+            int32x4_t s0 = vaddq_s32(vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(v))), carry);
+            int32x4_t s1 = vaddq_s32(vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(v))), carry);
+            carry        = vdupq_n_s32(vgetq_lane_s32(s1, 3));
+            integral_store4(prev + x, out + x, s0);
+            integral_store4(prev + x + 4, out + x + 4, s1);
+        }
+        s[0] = vgetq_lane_s32(carry, 0);
+    } else {
+        // one pixel per step, the 4th lane of a 3 channels pixel is overwritten by the next pixel so the
+        // last pixel is left to the scalar loop
+        int32x4_t carry = vdupq_n_s32(0);
+        for (; x < width - (channels == 3); ++x) {
+            carry = vaddq_s32(carry, vreinterpretq_s32_u32(integral_load4_u8(in + x * channels)));
+            integral_store4(prev + x * channels, out + x * channels, carry);
+        }
+        vst1q_s32(s, carry);
+    }
+    for (; x < width; ++x) {
+        for (int32_t c = 0; c < channels; ++c) {
+            s[c] += in[x * channels + c];
+            out[x * channels + c] = prev[x * channels + c] + s[c];
+        }
+    }
+}
+
+// one row of the squared integral image, the running sum is kept in double
+template <int32_t channels>
+static void integral_sqr_row(const uint8_t *in, int32_t width, const double *prev, double *out)
+{
+    int32_t x = 0;
+    double s[4];
+    if (channels == 1) {
+        const uint32x4_t vzero = vdupq_n_u32(0);
+        float64x2_t carry      = vdupq_n_f64(0.0);
+        for (; x <= width - 8; x += 8) {
+            uint16x8_t v   = vmovl_u8(vld1_u8(in + x));
+            uint16x8_t sq  = vmulq_u16(v, v); // 255 * 255 still fits in u16
+            uint32x4_t q0  = vmovl_u16(vget_low_u16(sq));
+            uint32x4_t q1  = vmovl_u16(vget_high_u16(sq));
+            q0             = vaddq_u32(q0, vextq_u32(vzero, q0, 3));
+            q1             = vaddq_u32(q1, vextq_u32(vzero, q1, 3));
+            q0             = vaddq_u32(q0, vextq_u32(vzero, q0, 2));
+            q1             = vaddq_u32(q1, vextq_u32(vzero, q1, 2));
+            q1             = vaddq_u32(q1, vdupq_n_u32(vgetq_lane_u32(q0, 3)));
+            float64x2_t d0 = vaddq_f64(vcvtq_f64_u64(vmovl_u32(vget_low_u32(q0))), carry);
+            float64x2_t d1 = vaddq_f64(vcvtq_f64_u64(vmovl_u32(vget_high_u32(q0))), carry);
+            float64x2_t d2 = vaddq_f64(vcvtq_f64_u64(vmovl_u32(vget_low_u32(q1))), carry);
+            float64x2_t d3 = vaddq_f64(vcvtq_f64_u64(vmovl_u32(vget_high_u32(q1))), carry);
+            carry          = vdupq_n_f64(vgetq_lane_f64(d3, 1));
+            vst1q_f64(out + x, vaddq_f64(vld1q_f64(prev + x), d0));
+            vst1q_f64(out + x + 2, vaddq_f64(vld1q_f64(prev + x + 2), d1));
+            vst1q_f64(out + x + 4, vaddq_f64(vld1q_f64(prev + x + 4), d2));
+            vst1q_f64(out + x + 6, vaddq_f64(vld1q_f64(prev + x + 6), d3));
+        }
+        s[0] = vgetq_lane_f64(carry, 0);
+    } else {
+        float64x2_t carry0 = vdupq_n_f64(0.0);
+        float64x2_t carry1 = vdupq_n_f64(0.0);
+        for (; x < width - (channels == 3); ++x) {
+            uint32x4_t v = integral_load4_u8(in + x * channels);
+            v            = vmulq_u32(v, v);
+            carry0       = vaddq_f64(carry0, vcvtq_f64_u64(vmovl_u32(vget_low_u32(v))));
+            carry1       = vaddq_f64(carry1, vcvtq_f64_u64(vmovl_u32(vget_high_u32(v))));
+            vst1q_f64(out + x * channels, vaddq_f64(vld1q_f64(prev + x * channels), carry0));
+            vst1q_f64(out + x * channels + 2, vaddq_f64(vld1q_f64(prev + x * channels + 2), carry1));
+        }
+        vst1q_f64(s, carry0);
+        vst1q_f64(s + 2, carry1);
+    }
+    for (; x < width; ++x) {
+        for (int32_t c = 0; c < channels; ++c) {
+            int32_t v = in[x * channels + c];
+            s[c] += v * v;
+            out[x * channels + c] = prev[x * channels + c] + s[c];
+        }
+    }
+}
+
+// input rows [y0, y1) give output rows y0 + 1 to y1, starting from `sumBase` and `sqsumBase` which hold output row y0
+template <typename Tsum, int32_t channels>
+static void integral_band(
+    int32_t y0,
+    int32_t y1,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    const Tsum *sumBase,
+    int32_t sumWidthStride,
+    Tsum *sumData,
+    const double *sqsumBase,
+    int32_t sqsumWidthStride,
+    double *sqsumData)
+{
+    for (int32_t y = y0; y < y1; ++y) {
+        const uint8_t *in = inData + (int64_t)y * inWidthStride;
+        Tsum *sum         = sumData + (int64_t)(y + 1) * sumWidthStride;
+        for (int32_t c = 0; c < channels; ++c) {
+            sum[c] = 0;
+        }
+        integral_row<Tsum, channels>(in, width, sumBase + channels, sum + channels);
+        sumBase = sum;
+        if (nullptr != sqsumData) {
+            double *sqsum = sqsumData + (int64_t)(y + 1) * sqsumWidthStride;
+            for (int32_t c = 0; c < channels; ++c) {
+                sqsum[c] = 0;
+            }
+            integral_sqr_row<channels>(in, width, sqsumBase + channels, sqsum + channels);
+            sqsumBase = sqsum;
+        }
+    }
+}
+
+template <typename Tsum, int32_t channels>
+static void integral_impl(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t sumWidthStride,
+    Tsum *sumData,
+    int32_t sqsumWidthStride,
+    double *sqsumData,
+    int32_t numThreads)
+{
+    const int32_t rowLength = (width + 1) * channels;
+    const int32_t colLength = width * channels;
+    memset(sumData, 0, rowLength * sizeof(Tsum));
+    if (nullptr != sqsumData) {
+        memset(sqsumData, 0, rowLength * sizeof(double));
+    }
+
+    int32_t bands = (int32_t)std::min<int64_t>((int64_t)height * width / INTEGRAL_MIN_BAND_PIXELS, height);
+    bands         = std::min(bands, numThreads);
+    if (bands <= 1) {
+        integral_band<Tsum, channels>(0, height, width, inWidthStride, inData, sumData, sumWidthStride, sumData, sqsumData, sqsumWidthStride, sqsumData);
+        return;
+    }
+
+    // column sums of every band but the last one, then the output rows above the bands
+    uint64_t size_for_col_sum = ((uint64_t)(bands - 1) * colLength * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    uint64_t size_for_col_sq_sum = nullptr != sqsumData ? ((uint64_t)(bands - 1) * colLength * sizeof(double) + 64 - 1) / 64 * 64 : 0;
+    uint64_t size_for_sum_base = ((uint64_t)(bands - 1) * rowLength * sizeof(Tsum) + 64 - 1) / 64 * 64;
+    uint64_t size_for_sq_sum_base = nullptr != sqsumData ? ((uint64_t)(bands - 1) * rowLength * sizeof(double) + 64 - 1) / 64 * 64 : 0;
+
+    uint64_t total_size = size_for_col_sum + size_for_col_sq_sum + size_for_sum_base + size_for_sq_sum_base;
+
+    void *temp_buffer = tinycv::ScratchAlloc(total_size, 64);
+    int32_t *colSum = (int32_t *)temp_buffer;
+    double *colSqSum = (double *)((unsigned char *)colSum + size_for_col_sum);
+    Tsum *sumBase = (Tsum *)((unsigned char *)colSqSum + size_for_col_sq_sum);
+    double *sqsumBase = (double *)((unsigned char *)sumBase + size_for_sum_base);
+    memset(colSum, 0, (size_t)(bands - 1) * colLength * sizeof(int32_t));
+    if (nullptr != sqsumData) {
+        memset(colSqSum, 0, (size_t)(bands - 1) * colLength * sizeof(double));
+    }
+    ParallelFor(bands - 1, bands - 1, [&](int32_t b0, int32_t b1) {
+        for (int32_t b = b0; b < b1; ++b) {
+            int32_t *cs = colSum + (int64_t)b * colLength;
+            double *cq  = nullptr != sqsumData ? colSqSum + (int64_t)b * colLength : nullptr;
+            for (int32_t y = (int32_t)((int64_t)height * b / bands); y < (int32_t)((int64_t)height * (b + 1) / bands); ++y) {
+                const uint8_t *in = inData + (int64_t)y * inWidthStride;
+                for (int32_t i = 0; i < colLength; ++i) {
+                    cs[i] += in[i];
+                }
+                if (nullptr != cq) {
+                    for (int32_t i = 0; i < colLength; ++i) {
+                        cq[i] += in[i] * in[i];
+                    }
+                }
+            }
+        }
+    });
+
+    // the output row above band b is the row prefix sum of the column sums of bands 0 to b - 1
+    for (int32_t b = 0; b < bands - 1; ++b) {
+        int32_t *cs = colSum + (int64_t)b * colLength;
+        Tsum *base  = sumBase + (int64_t)b * rowLength;
+        if (b > 0) {
+            const int32_t *above = colSum + (int64_t)(b - 1) * colLength;
+            for (int32_t i = 0; i < colLength; ++i) {
+                cs[i] += above[i];
+            }
+        }
+        for (int32_t c = 0; c < channels; ++c) {
+            base[c] = 0;
+        }
+        for (int32_t i = 0; i < colLength; ++i) {
+            base[i + channels] = base[i] + cs[i];
+        }
+        if (nullptr != sqsumData) {
+            double *cq    = colSqSum + (int64_t)b * colLength;
+            double *sbase = sqsumBase + (int64_t)b * rowLength;
+            if (b > 0) {
+                const double *above = colSqSum + (int64_t)(b - 1) * colLength;
+                for (int32_t i = 0; i < colLength; ++i) {
+                    cq[i] += above[i];
+                }
+            }
+            for (int32_t c = 0; c < channels; ++c) {
+                sbase[c] = 0;
+            }
+            for (int32_t i = 0; i < colLength; ++i) {
+                sbase[i + channels] = sbase[i] + cq[i];
+            }
+        }
+    }
+
+    ParallelFor(bands, bands, [&](int32_t b0, int32_t b1) {
+        for (int32_t b = b0; b < b1; ++b) {
+            const Tsum *base    = b > 0 ? sumBase + (int64_t)(b - 1) * rowLength : sumData;
+            const double *sbase = nullptr;
+            if (nullptr != sqsumData) {
+                sbase = b > 0 ? sqsumBase + (int64_t)(b - 1) * rowLength : sqsumData;
+            }
+            integral_band<Tsum, channels>((int32_t)((int64_t)height * b / bands), (int32_t)((int64_t)height * (b + 1) / bands), width, inWidthStride, inData, base, sumWidthStride, sumData, sbase, sqsumWidthStride, sqsumData);
+        }
+    });
+
+    tinycv::ScratchFree(temp_buffer);
+}
+
+template <typename Tsum, int32_t channels>
+void Integral(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    Tsum *outData,
+    int32_t numThreads)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth * channels || outWidthStride < (inWidth + 1) * channels) {
+        return;
+    }
+    integral_impl<Tsum, channels>(inHeight, inWidth, inWidthStride, inData, outWidthStride, outData, 0, nullptr, numThreads);
+}
+
+template <typename Tsum, int32_t channels>
+void IntegralSqr(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t sumWidthStride,
+    Tsum *sumData,
+    int32_t sqsumWidthStride,
+    double *sqsumData,
+    int32_t numThreads)
+{
+    if (nullptr == inData || nullptr == sumData || nullptr == sqsumData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth * channels) {
+        return;
+    }
+    if (sumWidthStride < (inWidth + 1) * channels || sqsumWidthStride < (inWidth + 1) * channels) {
+        return;
+    }
+    integral_impl<Tsum, channels>(inHeight, inWidth, inWidthStride, inData, sumWidthStride, sumData, sqsumWidthStride, sqsumData, numThreads);
+}
+
+// out[0..3] = a[0..3] + b[0..3] - c[0..3] + u[0..3] + v[0..3]
+static inline void integral_tilted4(const int32_t *a, const int32_t *b, const int32_t *c, const uint8_t *u, const uint8_t *v, int32_t *out)
+{
+    int32x4_t s = vsubq_s32(vaddq_s32(vld1q_s32(a), vld1q_s32(b)), vld1q_s32(c));
+    s           = vaddq_s32(s, vreinterpretq_s32_u32(vaddq_u32(integral_load4_u8(u), integral_load4_u8(v))));
+    vst1q_s32(out, s);
+}
+static inline void integral_tilted4(const double *a, const double *b, const double *c, const uint8_t *u, const uint8_t *v, double *out)
+{
+    uint32x4_t p   = vaddq_u32(integral_load4_u8(u), integral_load4_u8(v));
+    float64x2_t s0 = vsubq_f64(vaddq_f64(vld1q_f64(a), vld1q_f64(b)), vld1q_f64(c));
+    float64x2_t s1 = vsubq_f64(vaddq_f64(vld1q_f64(a + 2), vld1q_f64(b + 2)), vld1q_f64(c + 2));
+    vst1q_f64(out, vaddq_f64(s0, vcvtq_f64_u64(vmovl_u32(vget_low_u32(p)))));
+    vst1q_f64(out + 2, vaddq_f64(s1, vcvtq_f64_u64(vmovl_u32(vget_high_u32(p)))));
+}
+
+template <typename Tsum, int32_t channels>
+void IntegralTilted(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    Tsum *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth * channels || outWidthStride < (inWidth + 1) * channels) {
+        return;
+    }
+    const int32_t rowLength = (inWidth + 1) * channels;
+    const int32_t last      = inWidth * channels;
+    // stand-ins for output row -1 and input row -1
+    uint64_t size_for_zero_sum = ((uint64_t)rowLength * sizeof(Tsum) + 64 - 1) / 64 * 64;
+    uint64_t size_for_zero_in = ((uint64_t)inWidth * channels + 64 - 1) / 64 * 64;
+    void *temp_buffer = tinycv::ScratchAlloc(size_for_zero_sum + size_for_zero_in, 64);
+    memset(temp_buffer, 0, size_for_zero_sum + size_for_zero_in);
+    const Tsum *zeroSum = (const Tsum *)temp_buffer;
+    const uint8_t *zeroIn = (const uint8_t *)temp_buffer + size_for_zero_sum;
+    memset(outData, 0, rowLength * sizeof(Tsum));
+
+    // T(X, Y) = T(X - 1, Y - 1) + T(X + 1, Y - 1) - T(X, Y - 2) + I(X - 1, Y - 1) + I(X - 1, Y - 2), with the
+    // triangles clipped by the left border T(0, Y) = T(1, Y - 1) and by the right one
+    // T(W, Y) = T(W - 1, Y - 1) + I(W - 1, Y - 1) + I(W - 1, Y - 2)
+    for (int32_t y = 1; y <= inHeight; ++y) {
+        const Tsum *t1    = outData + (int64_t)(y - 1) * outWidthStride;
+        const Tsum *t2    = y > 1 ? outData + (int64_t)(y - 2) * outWidthStride : zeroSum;
+        const uint8_t *i1 = inData + (int64_t)(y - 1) * inWidthStride;
+        const uint8_t *i2 = y > 1 ? inData + (int64_t)(y - 2) * inWidthStride : zeroIn;
+        Tsum *out         = outData + (int64_t)y * outWidthStride;
+        for (int32_t c = 0; c < channels; ++c) {
+            out[c] = t1[channels + c];
+        }
+        int32_t i = channels;
+        for (; i <= last - 4; i += 4) {
+            integral_tilted4(t1 + i - channels, t1 + i + channels, t2 + i, i1 + i - channels, i2 + i - channels, out + i);
+        }
+        for (; i < last; ++i) {
+            out[i] = t1[i - channels] + t1[i + channels] - t2[i] + i1[i - channels] + i2[i - channels];
+        }
+        for (; i < rowLength; ++i) {
+            out[i] = t1[i - channels] + i1[i - channels] + i2[i - channels];
+        }
+    }
+    tinycv::ScratchFree(temp_buffer);
+}
+
+template void Integral<int32_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int32_t *outData, int32_t numThreads);
+template void Integral<int32_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int32_t *outData, int32_t numThreads);
+template void Integral<int32_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int32_t *outData, int32_t numThreads);
+template void Integral<double, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, double *outData, int32_t numThreads);
+template void Integral<double, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, double *outData, int32_t numThreads);
+template void Integral<double, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, double *outData, int32_t numThreads);
+
+template void IntegralSqr<int32_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t sumWidthStride, int32_t *sumData, int32_t sqsumWidthStride, double *sqsumData, int32_t numThreads);
+template void IntegralSqr<int32_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t sumWidthStride, int32_t *sumData, int32_t sqsumWidthStride, double *sqsumData, int32_t numThreads);
+template void IntegralSqr<int32_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t sumWidthStride, int32_t *sumData, int32_t sqsumWidthStride, double *sqsumData, int32_t numThreads);
+template void IntegralSqr<double, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t sumWidthStride, double *sumData, int32_t sqsumWidthStride, double *sqsumData, int32_t numThreads);
+template void IntegralSqr<double, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t sumWidthStride, double *sumData, int32_t sqsumWidthStride, double *sqsumData, int32_t numThreads);
+template void IntegralSqr<double, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t sumWidthStride, double *sumData, int32_t sqsumWidthStride, double *sqsumData, int32_t numThreads);
+
+template void IntegralTilted<int32_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int32_t *outData);
+template void IntegralTilted<int32_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int32_t *outData);
+template void IntegralTilted<int32_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int32_t *outData);
+template void IntegralTilted<double, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, double *outData);
+template void IntegralTilted<double, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, double *outData);
+template void IntegralTilted<double, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, double *outData);
+
+} // namespace tinycv
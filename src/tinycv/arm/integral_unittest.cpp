@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/integral.h"
+#include "tinycv/arm/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <memory>
+#include <vector>
+
+// integral images are exact, any difference is an error
+template <typename T>
+static void checkExact(const T *data, const cv::Mat &ref, int32_t rows, int32_t rowLength, int32_t dstep)
+{
+    for (int32_t i = 0; i < rows; i++) {
+        const T *expected = ref.ptr<T>(i);
+        for (int32_t j = 0; j < rowLength; j++) {
+            ASSERT_EQ(data[i * dstep + j], expected[j]) << "row " << i << " col " << j;
+        }
+    }
+}
+
+template <typename Tsum, int32_t nc>
+void IntegralTest(int32_t height, int32_t width, int32_t numThreads)
+{
+    int32_t outStride = (width + 1) * nc;
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * nc]);
+    std::vector<Tsum> sum((height + 1) * outStride);
+    std::vector<double> sqsum((height + 1) * outStride);
+    std::vector<Tsum> tilted((height + 1) * outStride);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height * nc, 0, 255);
+
+    cv::Mat iMat(height, width, CV_MAKETYPE(CV_8U, nc), src.get());
+    cv::Mat sum_opencv, sqsum_opencv, tilted_opencv;
+    cv::integral(iMat, sum_opencv, sqsum_opencv, tilted_opencv, cv::DataType<Tsum>::depth, CV_64F);
+
+    tinycv::Integral<Tsum, nc>(height, width, width * nc, src.get(), outStride, sum.data(), numThreads);
+    checkExact<Tsum>(sum.data(), sum_opencv, height + 1, outStride, outStride);
+
+    std::fill(sum.begin(), sum.end(), (Tsum)0);
+    tinycv::IntegralSqr<Tsum, nc>(height, width, width * nc, src.get(), outStride, sum.data(), outStride, sqsum.data(), numThreads);
+    checkExact<Tsum>(sum.data(), sum_opencv, height + 1, outStride, outStride);
+    checkExact<double>(sqsum.data(), sqsum_opencv, height + 1, outStride, outStride);
+
+    tinycv::IntegralTilted<Tsum, nc>(height, width, width * nc, src.get(), outStride, tilted.data());
+    checkExact<Tsum>(tilted.data(), tilted_opencv, height + 1, outStride, outStride);
+}
+
+TEST(INTEGRAL_INT32, arm)
+{
+    IntegralTest<int32_t, 1>(480, 640, 1);
+    IntegralTest<int32_t, 3>(480, 640, 1);
+    IntegralTest<int32_t, 4>(480, 640, 1);
+    IntegralTest<int32_t, 1>(101, 99, 1);
+    IntegralTest<int32_t, 3>(101, 99, 1);
+    IntegralTest<int32_t, 4>(101, 99, 1);
+    IntegralTest<int32_t, 1>(1, 7, 1);
+}
+
+TEST(INTEGRAL_FP64, arm)
+{
+    IntegralTest<double, 1>(480, 640, 1);
+    IntegralTest<double, 3>(480, 640, 1);
+    IntegralTest<double, 4>(480, 640, 1);
+    IntegralTest<double, 1>(101, 99, 1);
+    IntegralTest<double, 3>(101, 99, 1);
+    IntegralTest<double, 4>(101, 99, 1);
+}
+
+TEST(INTEGRAL_THREADS, arm)
+{
+    IntegralTest<int32_t, 1>(1080, 1920, 4);
+    IntegralTest<int32_t, 3>(721, 1279, 3);
+    IntegralTest<double, 1>(1080, 1920, 4);
+    IntegralTest<double, 4>(721, 1279, 3);
+}
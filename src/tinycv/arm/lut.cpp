@@ -0,0 +1,143 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/lut.h"
+#include "tinycv/types.h"
+
+#include <string.h>
+#include <stdint.h>
+#include <arm_neon.h>
+
+namespace tinycv {
+
+#define LUT_SIZE 256
+
+// the 256 entries are 4 tables of 64 for tbl, the index drops by 64 for every next table and the out of range
+// lanes keep what the previous tables found
+static inline uint8x16_t lut_lookup16(const uint8x16x4_t *t, uint8x16_t v)
+{
+    const uint8x16_t v64 = vdupq_n_u8(64);
+    uint8x16_t r         = vqtbl4q_u8(t[0], v);
+    v                    = vsubq_u8(v, v64);
+    r                    = vqtbx4q_u8(r, t[1], v);
+    v                    = vsubq_u8(v, v64);
+    r                    = vqtbx4q_u8(r, t[2], v);
+    v                    = vsubq_u8(v, v64);
+    return vqtbx4q_u8(r, t[3], v);
+}
+
+static inline void lut_load_tables(const uint8_t *plane, uint8x16x4_t *t)
+{
+    for (int32_t k = 0; k < 4; ++k) {
+        t[k].val[0] = vld1q_u8(plane + k * 64);
+        t[k].val[1] = vld1q_u8(plane + k * 64 + 16);
+        t[k].val[2] = vld1q_u8(plane + k * 64 + 32);
+        t[k].val[3] = vld1q_u8(plane + k * 64 + 48);
+    }
+}
+
+template <int32_t channels>
+void LUT(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    int32_t lutChannels,
+    const uint8_t *lutData)
+{
+    if (nullptr == inData || nullptr == outData || nullptr == lutData) {
+        return;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * channels || outWidthStride < width * channels) {
+        return;
+    }
+    if (lutChannels != 1 && lutChannels != channels) {
+        return;
+    }
+
+    uint8_t planes[channels][LUT_SIZE];
+    for (int32_t c = 0; c < lutChannels; ++c) {
+        for (int32_t i = 0; i < LUT_SIZE; ++i) {
+            planes[c][i] = lutData[i * lutChannels + c];
+        }
+    }
+
+    if (lutChannels == 1) {
+        // one table for all the elements, the channels do not matter
+        uint8x16x4_t t[4];
+        lut_load_tables(planes[0], t);
+        const int32_t length = width * channels;
+        for (int32_t y = 0; y < height; ++y) {
+            const uint8_t *in = inData + (int64_t)y * inWidthStride;
+            uint8_t *out      = outData + (int64_t)y * outWidthStride;
+            int32_t i         = 0;
+            for (; i <= length - 32; i += 32) {
+                uint8x16_t v0 = vld1q_u8(in + i);
+                uint8x16_t v1 = vld1q_u8(in + i + 16);
+                vst1q_u8(out + i, lut_lookup16(t, v0));
+                vst1q_u8(out + i + 16, lut_lookup16(t, v1));
+            }
+            for (; i <= length - 16; i += 16) {
+                vst1q_u8(out + i, lut_lookup16(t, vld1q_u8(in + i)));
+            }
+            for (; i < length; ++i) {
+                out[i] = planes[0][in[i]];
+            }
+        }
+        return;
+    }
+
+    // a table per channel, 16 pixels are split into channel planes
+    uint8x16x4_t t[channels][4];
+    for (int32_t c = 0; c < channels; ++c) {
+        lut_load_tables(planes[c], t[c]);
+    }
+    for (int32_t y = 0; y < height; ++y) {
+        const uint8_t *in = inData + (int64_t)y * inWidthStride;
+        uint8_t *out      = outData + (int64_t)y * outWidthStride;
+        int32_t x         = 0;
+        for (; x <= width - 16; x += 16) {
+            if (channels == 3) {
+                uint8x16x3_t v = vld3q_u8(in + x * 3);
+                v.val[0]       = lut_lookup16(t[0], v.val[0]);
+                v.val[1]       = lut_lookup16(t[1], v.val[1]);
+                v.val[2]       = lut_lookup16(t[2], v.val[2]);
+                vst3q_u8(out + x * 3, v);
+            } else {
+                uint8x16x4_t v = vld4q_u8(in + x * 4);
+                v.val[0]       = lut_lookup16(t[0], v.val[0]);
+                v.val[1]       = lut_lookup16(t[1], v.val[1]);
+                v.val[2]       = lut_lookup16(t[2], v.val[2]);
+                v.val[3]       = lut_lookup16(t[channels - 1], v.val[3]);
+                vst4q_u8(out + x * 4, v);
+            }
+        }
+        for (; x < width; ++x) {
+            for (int32_t c = 0; c < channels; ++c) {
+                out[x * channels + c] = planes[c][in[x * channels + c]];
+            }
+        }
+    }
+}
+
+template void LUT<1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t lutChannels, const uint8_t *lutData);
+template void LUT<3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t lutChannels, const uint8_t *lutData);
+template void LUT<4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t lutChannels, const uint8_t *lutData);
+
+} // namespace tinycv
@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/lut.h"
+#include "tinycv/arm/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <memory>
+
+template <int32_t nc>
+void LUTTest(int32_t height, int32_t width, int32_t lutChannels)
+{
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * nc]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height * nc]);
+    std::unique_ptr<uint8_t[]> dst_opencv(new uint8_t[width * height * nc]);
+    std::unique_ptr<uint8_t[]> lut(new uint8_t[256 * lutChannels]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height * nc, 0, 255);
+    tinycv::debug::randomFill<uint8_t>(lut.get(), 256 * lutChannels, 0, 255);
+
+    tinycv::LUT<nc>(height, width, width * nc, src.get(), width * nc, dst.get(), lutChannels, lut.get());
+
+    cv::Mat iMat(height, width, CV_MAKETYPE(CV_8U, nc), src.get());
+    cv::Mat oMat(height, width, CV_MAKETYPE(CV_8U, nc), dst_opencv.get());
+    cv::Mat lutMat(1, 256, CV_MAKETYPE(CV_8U, lutChannels), lut.get());
+    cv::LUT(iMat, lutMat, oMat);
+
+    checkResult<uint8_t, nc>(dst.get(), dst_opencv.get(), height, width, width * nc, width * nc, 0.01f);
+}
+
+TEST(LUT_UINT8, arm)
+{
+    LUTTest<1>(480, 640, 1);
+    LUTTest<3>(480, 640, 1);
+    LUTTest<3>(480, 640, 3);
+    LUTTest<4>(480, 640, 1);
+    LUTTest<4>(480, 640, 4);
+    LUTTest<1>(101, 99, 1);
+    LUTTest<3>(101, 99, 3);
+    LUTTest<4>(101, 99, 4);
+}
@@ -0,0 +1,547 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/matchtemplate.h"
+#include "tinycv/integral.h"
+#include "tinycv/sys.h"
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <arm_neon.h>
+
+#define MT_SPATIAL_MAX_AREA 64
+#define MT_BAND_ROWS 32
+#define MT_CENTER 128 //! taken off image blocks before the FFT, the template has its mean taken off
+
+namespace tinycv {
+
+// template statistics and OpenCV's normalisation constants
+struct MtTemplate {
+    double area;
+    double mean;
+    double sum2; //! Σ T^2
+    double norm; //! norm of the template, with its mean taken off for CCOEFF_NORMED
+    bool flat; //! CCOEFF_NORMED with a constant template, every result is 1
+};
+
+static MtTemplate mt_template_stats(
+    int32_t templHeight,
+    int32_t templWidth,
+    int32_t templWidthStride,
+    const uint8_t *templData,
+    TemplateMatchMode method)
+{
+    int64_t s = 0, q = 0;
+    for (int32_t y = 0; y < templHeight; ++y) {
+        const uint8_t *t = templData + (size_t)y * templWidthStride;
+        for (int32_t x = 0; x < templWidth; ++x) {
+            s += t[x];
+            q += t[x] * t[x];
+        }
+    }
+    MtTemplate r;
+    r.area = (double)templHeight * templWidth;
+    double invArea = 1.0 / r.area;
+    r.mean = s * invArea;
+    double norm = std::max(q * invArea - r.mean * r.mean, 0.0);
+    r.flat = method == TM_CCOEFF_NORMED && norm < DBL_EPSILON;
+    double sum2 = norm + r.mean * r.mean;
+    if (method != TM_CCOEFF && method != TM_CCOEFF_NORMED) {
+        norm = sum2;
+    }
+    r.sum2 = sum2 * r.area;
+    r.norm = sqrt(norm) / sqrt(invArea);
+    return r;
+}
+
+// row stride of the widened input rows of `mt_correlate_spatial`, the taps read past the last block of 8 outputs
+static inline int32_t mt_spatial_row_stride(int32_t outWidth, int32_t templWidth)
+{
+    return (outWidth + 7) / 8 * 8 + templWidth;
+}
+
+// exact correlation of output rows [y0, y1). The input rows of the band are widened to 16 bits once, every tap
+// is multiplied into 8 outputs with vmlal
+static void mt_correlate_spatial(
+    int32_t y0,
+    int32_t y1,
+    int32_t outWidth,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t templHeight,
+    int32_t templWidth,
+    const int16_t *taps,
+    int16_t *rows,
+    int32_t *acc,
+    double *corr,
+    int32_t corrStride)
+{
+    const int32_t blocks = (outWidth + 7) / 8;
+    const int32_t rowStride = mt_spatial_row_stride(outWidth, templWidth);
+    const int32_t bandRows = y1 - y0 + templHeight - 1;
+    memset(rows, 0, (size_t)bandRows * rowStride * sizeof(int16_t));
+    for (int32_t r = 0; r < bandRows; ++r) {
+        const uint8_t *src = inData + (size_t)(y0 + r) * inWidthStride;
+        int16_t *dst = rows + (size_t)r * rowStride;
+        int32_t x = 0;
+        for (; x <= inWidth - 8; x += 8) {
+            vst1q_s16(dst + x, vreinterpretq_s16_u16(vmovl_u8(vld1_u8(src + x))));
+        }
+        for (; x < inWidth; ++x) {
+            dst[x] = src[x];
+        }
+    }
+    for (int32_t y = y0; y < y1; ++y) {
+        for (int32_t b = 0; b < blocks; ++b) {
+            int32x4_t a0 = vdupq_n_s32(0), a1 = vdupq_n_s32(0);
+            for (int32_t ty = 0; ty < templHeight; ++ty) {
+                const int16_t *r = rows + (size_t)(y - y0 + ty) * rowStride + 8 * b;
+                const int16_t *t = taps + ty * templWidth;
+                for (int32_t k = 0; k < templWidth; ++k) {
+                    int16x8_t v = vld1q_s16(r + k);
+                    a0 = vmlal_n_s16(a0, vget_low_s16(v), t[k]);
+                    a1 = vmlal_n_s16(a1, vget_high_s16(v), t[k]);
+                }
+            }
+            vst1q_s32(acc + 8 * b, a0);
+            vst1q_s32(acc + 8 * b + 4, a1);
+        }
+        double *c = corr + (size_t)(y - y0) * corrStride;
+        for (int32_t x = 0; x < outWidth; ++x) {
+            c[x] = acc[x];
+        }
+    }
+}
+
+// radix-2 FFT of size n over the columns of an n x n planar complex matrix
+struct MtFFT {
+    int32_t n;
+    float *wr, *wi; //! e^(-2 pi i k / n) for k < n / 2
+    int32_t *rev;
+};
+
+// bytes of the tables of a size n transform
+static uint64_t mt_fft_buffer_size(int32_t n)
+{
+    uint64_t size_for_w = ((uint64_t)n / 2 * sizeof(float) + 64 - 1) / 64 * 64;
+    uint64_t size_for_rev = ((uint64_t)n * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    return size_for_w * 2 + size_for_rev;
+}
+
+static void mt_fft_init(MtFFT &f, int32_t n, void *buffer)
+{
+    uint64_t size_for_w = ((uint64_t)n / 2 * sizeof(float) + 64 - 1) / 64 * 64;
+    f.n = n;
+    f.wr = (float *)buffer;
+    f.wi = (float *)((unsigned char *)f.wr + size_for_w);
+    f.rev = (int32_t *)((unsigned char *)f.wi + size_for_w);
+    for (int32_t k = 0; k < n / 2; ++k) {
+        f.wr[k] = (float)cos(2 * M_PI * k / n);
+        f.wi[k] = (float)-sin(2 * M_PI * k / n);
+    }
+    int32_t bits = __builtin_ctz(n);
+    for (int32_t i = 0; i < n; ++i) {
+        int32_t r = 0;
+        for (int32_t b = 0; b < bits; ++b) {
+            r |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+        f.rev[i] = r;
+    }
+}
+
+// every butterfly combines two whole rows, so all columns are transformed together in vector lanes
+static void mt_fft_columns(float *re, float *im, const MtFFT &f, bool inverse)
+{
+    const int32_t n = f.n;
+    for (int32_t i = 0; i < n; ++i) {
+        if (i < f.rev[i]) {
+            std::swap_ranges(re + (size_t)i * n, re + (size_t)(i + 1) * n, re + (size_t)f.rev[i] * n);
+            std::swap_ranges(im + (size_t)i * n, im + (size_t)(i + 1) * n, im + (size_t)f.rev[i] * n);
+        }
+    }
+    for (int32_t len = 2; len <= n; len <<= 1) {
+        const int32_t half = len >> 1, step = n / len;
+        for (int32_t i = 0; i < n; i += len) {
+            for (int32_t j = 0; j < half; ++j) {
+                const float wr = f.wr[j * step];
+                const float wi = inverse ? -f.wi[j * step] : f.wi[j * step];
+                float *ar = re + (size_t)(i + j) * n, *ai = im + (size_t)(i + j) * n;
+                float *br = ar + (size_t)half * n, *bi = ai + (size_t)half * n;
+                for (int32_t c = 0; c < n; c += 4) {
+                    float32x4_t xr = vld1q_f32(br + c), xi = vld1q_f32(bi + c);
+                    float32x4_t tr = vmlsq_n_f32(vmulq_n_f32(xr, wr), xi, wi);
+                    float32x4_t ti = vmlaq_n_f32(vmulq_n_f32(xr, wi), xi, wr);
+                    float32x4_t yr = vld1q_f32(ar + c), yi = vld1q_f32(ai + c);
+                    vst1q_f32(br + c, vsubq_f32(yr, tr));
+                    vst1q_f32(bi + c, vsubq_f32(yi, ti));
+                    vst1q_f32(ar + c, vaddq_f32(yr, tr));
+                    vst1q_f32(ai + c, vaddq_f32(yi, ti));
+                }
+            }
+        }
+    }
+}
+
+static inline void mt_transpose4(float32x4_t &a0, float32x4_t &a1, float32x4_t &a2, float32x4_t &a3)
+{
+    float32x4x2_t p01 = vtrnq_f32(a0, a1), p23 = vtrnq_f32(a2, a3);
+    a0 = vcombine_f32(vget_low_f32(p01.val[0]), vget_low_f32(p23.val[0]));
+    a1 = vcombine_f32(vget_low_f32(p01.val[1]), vget_low_f32(p23.val[1]));
+    a2 = vcombine_f32(vget_high_f32(p01.val[0]), vget_high_f32(p23.val[0]));
+    a3 = vcombine_f32(vget_high_f32(p01.val[1]), vget_high_f32(p23.val[1]));
+}
+
+static void mt_transpose(float *m, int32_t n)
+{
+    for (int32_t i = 0; i < n; i += 4) {
+        for (int32_t j = i; j < n; j += 4) {
+            float *p = m + (size_t)i * n + j, *q = m + (size_t)j * n + i;
+            float32x4_t a0 = vld1q_f32(p), a1 = vld1q_f32(p + n), a2 = vld1q_f32(p + 2 * n), a3 = vld1q_f32(p + 3 * n);
+            mt_transpose4(a0, a1, a2, a3);
+            if (i != j) {
+                float32x4_t b0 = vld1q_f32(q), b1 = vld1q_f32(q + n), b2 = vld1q_f32(q + 2 * n), b3 = vld1q_f32(q + 3 * n);
+                mt_transpose4(b0, b1, b2, b3);
+                vst1q_f32(p, b0);
+                vst1q_f32(p + n, b1);
+                vst1q_f32(p + 2 * n, b2);
+                vst1q_f32(p + 3 * n, b3);
+            }
+            vst1q_f32(q, a0);
+            vst1q_f32(q + n, a1);
+            vst1q_f32(q + 2 * n, a2);
+            vst1q_f32(q + 3 * n, a3);
+        }
+    }
+}
+
+// 2D transform of the n x n block in `re` and `im`, the spectrum comes out transposed
+static void mt_fft_2d(float *re, float *im, const MtFFT &f, bool inverse)
+{
+    mt_fft_columns(re, im, f, inverse);
+    mt_transpose(re, f.n);
+    mt_transpose(im, f.n);
+    mt_fft_columns(re, im, f, inverse);
+}
+
+// power of two block size with the fewest transforms times their cost
+static int32_t mt_fft_size(int32_t outHeight, int32_t outWidth, int32_t templHeight, int32_t templWidth)
+{
+    int32_t best = 0;
+    double bestCost = 0;
+    for (int32_t n = 16; n <= 4096; n <<= 1) {
+        if (n < templHeight || n < templWidth) {
+            continue;
+        }
+        double blocks = ceil((double)outHeight / (n - templHeight + 1)) * ceil((double)outWidth / (2.0 * (n - templWidth + 1)));
+        double cost = blocks * n * n * (__builtin_ctz(n) + 2);
+        if (0 == best || cost < bestCost) {
+            best = n;
+            bestCost = cost;
+        }
+    }
+    return best;
+}
+
+// correlation of output rows [y0, y1), at most n - templHeight + 1 of them, by blocks of n x n input pixels. The
+// block on the left goes to the real part and the next one to the imaginary part: the template is real so their
+// correlations come back apart. Blocks have MT_CENTER taken off and the template its mean, so the float sums stay
+// small, the result Σ I * (T - mean) misses `mean * window sum`.
+static void mt_correlate_fft(
+    int32_t y0,
+    int32_t y1,
+    int32_t outWidth,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t templWidth,
+    const MtFFT &f,
+    const float *specRe,
+    const float *specIm,
+    float *re,
+    float *im,
+    double *corr,
+    int32_t corrStride)
+{
+    const int32_t n = f.n;
+    const int32_t blockWidth = n - templWidth + 1;
+    const int16x8_t center = vdupq_n_s16(MT_CENTER);
+    for (int32_t x0 = 0; x0 < outWidth; x0 += 2 * blockWidth) {
+        for (int32_t k = 0; k < 2; ++k) {
+            float *dst = k ? im : re;
+            int32_t bx = x0 + k * blockWidth;
+            int32_t cols = std::max(std::min(n, inWidth - bx), 0);
+            for (int32_t r = 0; r < n; ++r) {
+                float *d = dst + (size_t)r * n;
+                int32_t c = 0;
+                if (y0 + r < inHeight) {
+                    const uint8_t *s = inData + (size_t)(y0 + r) * inWidthStride + bx;
+                    for (; c <= cols - 8; c += 8) {
+                        int16x8_t v = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(s + c))), center);
+                        vst1q_f32(d + c, vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))));
+                        vst1q_f32(d + c + 4, vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))));
+                    }
+                    for (; c < cols; ++c) {
+                        d[c] = (float)(s[c] - MT_CENTER);
+                    }
+                }
+                memset(d + c, 0, (n - c) * sizeof(float));
+            }
+        }
+        mt_fft_2d(re, im, f, false);
+        //! times the conjugate template spectrum, which also holds the 1 / n^2 of the inverse transform
+        for (int32_t i = 0; i < n * n; i += 4) {
+            float32x4_t a = vld1q_f32(re + i), b = vld1q_f32(im + i);
+            float32x4_t c = vld1q_f32(specRe + i), d = vld1q_f32(specIm + i);
+            vst1q_f32(re + i, vmlaq_f32(vmulq_f32(a, c), b, d));
+            vst1q_f32(im + i, vmlsq_f32(vmulq_f32(b, c), a, d));
+        }
+        mt_fft_2d(re, im, f, true);
+        for (int32_t k = 0; k < 2; ++k) {
+            const float *src = k ? im : re;
+            int32_t bx = x0 + k * blockWidth;
+            int32_t cols = std::min(blockWidth, outWidth - bx);
+            for (int32_t r = 0; r < y1 - y0; ++r) {
+                double *c = corr + (size_t)r * corrStride + bx;
+                for (int32_t x = 0; x < cols; ++x) {
+                    c[x] = src[(size_t)r * n + x];
+                }
+            }
+        }
+    }
+}
+
+// OpenCV's results from the correlation `corr + corrShift * window sum` and the window sums of the band, two
+// outputs at a time in double lanes with the branches turned into selects
+static void mt_normalize(
+    int32_t rows,
+    int32_t outWidth,
+    const double *corr,
+    int32_t corrStride,
+    double corrShift,
+    const int32_t *sum,
+    const double *sqsum,
+    int32_t sumStride,
+    int32_t templHeight,
+    int32_t templWidth,
+    TemplateMatchMode method,
+    const MtTemplate &t,
+    int32_t outWidthStride,
+    float *outData)
+{
+    const bool normed = method == TM_SQDIFF_NORMED || method == TM_CCORR_NORMED || method == TM_CCOEFF_NORMED;
+    const bool sqdiff = method == TM_SQDIFF || method == TM_SQDIFF_NORMED;
+    const bool ccoeff = method == TM_CCOEFF || method == TM_CCOEFF_NORMED;
+    const double invArea = 1.0 / t.area;
+    const double outside = method != TM_SQDIFF_NORMED ? 0 : 1; //! when the correlation exceeds the norms
+    const float64x2_t vzero = vdupq_n_f64(0), vone = vdupq_n_f64(1.0), vhalf = vdupq_n_f64(0.5);
+    const float64x2_t vshift = vdupq_n_f64(corrShift), vinvArea = vdupq_n_f64(invArea), vmean = vdupq_n_f64(t.mean);
+    const float64x2_t vsum2 = vdupq_n_f64(t.sum2), vnorm = vdupq_n_f64(t.norm), veps = vdupq_n_f64(10 * FLT_EPSILON);
+    const float64x2_t vlimit = vdupq_n_f64(1.125), voutside = vdupq_n_f64(outside);
+    for (int32_t y = 0; y < rows; ++y) {
+        const double *c = corr + (size_t)y * corrStride;
+        float *out = outData + (size_t)y * outWidthStride;
+        const int32_t *s0 = nullptr != sum ? sum + (size_t)y * sumStride : nullptr;
+        const int32_t *s1 = nullptr != sum ? s0 + (size_t)templHeight * sumStride : nullptr;
+        const double *q0 = nullptr != sqsum ? sqsum + (size_t)y * sumStride : nullptr;
+        const double *q1 = nullptr != sqsum ? q0 + (size_t)templHeight * sumStride : nullptr;
+        int32_t x = 0;
+        for (; x <= outWidth - 2; x += 2) {
+            float64x2_t s = vzero;
+            if (nullptr != sum) {
+                int32x2_t a = vsub_s32(vld1_s32(s1 + x + templWidth), vld1_s32(s1 + x));
+                int32x2_t b = vsub_s32(vld1_s32(s0 + x + templWidth), vld1_s32(s0 + x));
+                s = vcvtq_f64_s64(vmovl_s32(vsub_s32(a, b)));
+            }
+            float64x2_t num = vfmaq_f64(vld1q_f64(c + x), vshift, s);
+            float64x2_t wndMean2 = vzero, wndSum2 = vzero;
+            if (ccoeff) {
+                wndMean2 = vmulq_f64(vmulq_f64(s, s), vinvArea);
+                num = vfmsq_f64(num, s, vmean);
+            }
+            if (normed || sqdiff) {
+                wndSum2 = vaddq_f64(vsubq_f64(vld1q_f64(q1 + x + templWidth), vld1q_f64(q1 + x)),
+                    vsubq_f64(vld1q_f64(q0 + x), vld1q_f64(q0 + x + templWidth)));
+                if (sqdiff) {
+                    num = vmaxq_f64(vaddq_f64(vsubq_f64(wndSum2, vaddq_f64(num, num)), vsum2), vzero);
+                }
+            }
+            if (normed) {
+                float64x2_t diff2 = vmaxq_f64(vsubq_f64(wndSum2, wndMean2), vzero);
+                uint64x2_t tiny = vcleq_f64(diff2, vminq_f64(vhalf, vmulq_f64(veps, wndSum2)));
+                float64x2_t d = vbslq_f64(tiny, vzero, vmulq_f64(vsqrtq_f64(diff2), vnorm));
+                float64x2_t a = vabsq_f64(num);
+                float64x2_t sign = vbslq_f64(vcgtq_f64(num, vzero), vone, vnegq_f64(vone));
+                float64x2_t r = vbslq_f64(vcltq_f64(a, vmulq_f64(d, vlimit)), sign, voutside);
+                num = vbslq_f64(vcltq_f64(a, d), vdivq_f64(num, d), r);
+            }
+            vst1_f32(out + x, vcvt_f32_f64(num));
+        }
+        for (; x < outWidth; ++x) {
+            double s = nullptr != sum ? s1[x + templWidth] - s1[x] - s0[x + templWidth] + s0[x] : 0;
+            double num = c[x] + corrShift * s;
+            double wndMean2 = 0, wndSum2 = 0;
+            if (ccoeff) {
+                wndMean2 = s * s * invArea;
+                num -= s * t.mean;
+            }
+            if (normed || sqdiff) {
+                wndSum2 = q1[x + templWidth] - q1[x] - q0[x + templWidth] + q0[x];
+                if (sqdiff) {
+                    num = std::max(wndSum2 - 2 * num + t.sum2, 0.0);
+                }
+            }
+            if (normed) {
+                double diff2 = std::max(wndSum2 - wndMean2, 0.0);
+                double d = diff2 <= std::min(0.5, 10 * FLT_EPSILON * wndSum2) ? 0 : sqrt(diff2) * t.norm;
+                if (fabs(num) < d) {
+                    num /= d;
+                } else if (fabs(num) < d * 1.125) {
+                    num = num > 0 ? 1 : -1;
+                } else {
+                    num = outside;
+                }
+            }
+            out[x] = (float)num;
+        }
+    }
+}
+
+void MatchTemplate(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t templHeight,
+    int32_t templWidth,
+    int32_t templWidthStride,
+    const uint8_t *templData,
+    int32_t outWidthStride,
+    float *outData,
+    TemplateMatchMode method,
+    int32_t numThreads)
+{
+    if (nullptr == inData || nullptr == templData || nullptr == outData) {
+        return;
+    }
+    if (templHeight <= 0 || templWidth <= 0 || templHeight > inHeight || templWidth > inWidth) {
+        return;
+    }
+    const int32_t outHeight = inHeight - templHeight + 1;
+    const int32_t outWidth = inWidth - templWidth + 1;
+    if (inWidthStride < inWidth || templWidthStride < templWidth || outWidthStride < outWidth) {
+        return;
+    }
+    if (method < TM_SQDIFF || method > TM_CCOEFF_NORMED) {
+        return;
+    }
+    const MtTemplate t = mt_template_stats(templHeight, templWidth, templWidthStride, templData, method);
+    if (t.flat) {
+        for (int32_t y = 0; y < outHeight; ++y) {
+            std::fill(outData + (size_t)y * outWidthStride, outData + (size_t)y * outWidthStride + outWidth, 1.0f);
+        }
+        return;
+    }
+
+    const bool spatial = templHeight * templWidth <= MT_SPATIAL_MAX_AREA;
+    const int32_t n = spatial ? 0 : mt_fft_size(outHeight, outWidth, templHeight, templWidth);
+    const int32_t bandRows = spatial ? MT_BAND_ROWS : n - templHeight + 1;
+    const bool needSum = !spatial || method >= TM_CCOEFF;
+    const bool needSqsum = method != TM_CCORR && method != TM_CCOEFF;
+    const int32_t sumStride = inWidth + 1;
+    const int32_t bands = (outHeight + bandRows - 1) / bandRows;
+    const int32_t ranges = std::max(std::min(bands, numThreads), 1);
+
+    //! the template taps or spectrum, then the buffers of each range of bands, reused by its bands
+    uint64_t size_for_taps = spatial ? ((uint64_t)templHeight * templWidth * sizeof(int16_t) + 64 - 1) / 64 * 64 : 0;
+    uint64_t size_for_fft = spatial ? 0 : mt_fft_buffer_size(n);
+    uint64_t size_for_spec = spatial ? 0 : ((uint64_t)n * n * sizeof(float) + 64 - 1) / 64 * 64;
+    uint64_t size_for_corr = ((uint64_t)bandRows * outWidth * sizeof(double) + 64 - 1) / 64 * 64;
+    uint64_t size_for_sum = needSum || needSqsum ? ((uint64_t)(bandRows + templHeight) * sumStride * sizeof(int32_t) + 64 - 1) / 64 * 64 : 0;
+    uint64_t size_for_sqsum = needSqsum ? ((uint64_t)(bandRows + templHeight) * sumStride * sizeof(double) + 64 - 1) / 64 * 64 : 0;
+    uint64_t size_for_rows = spatial ? ((uint64_t)(bandRows + templHeight - 1) * mt_spatial_row_stride(outWidth, templWidth) * sizeof(int16_t) + 64 - 1) / 64 * 64 : 0;
+    uint64_t size_for_acc = spatial ? ((uint64_t)(outWidth + 7) / 8 * 8 * sizeof(int32_t) + 64 - 1) / 64 * 64 : 0;
+    uint64_t size_for_range = size_for_corr + size_for_sum + size_for_sqsum + size_for_rows + size_for_acc + size_for_spec * 2;
+
+    uint64_t total_size = size_for_taps + size_for_fft + size_for_spec * 2 + size_for_range * ranges;
+
+    void *temp_buffer = tinycv::ScratchAlloc(total_size, 64);
+    int16_t *taps = (int16_t *)temp_buffer;
+    unsigned char *fftBuffer = (unsigned char *)taps + size_for_taps;
+    float *specRe = (float *)(fftBuffer + size_for_fft);
+    float *specIm = (float *)((unsigned char *)specRe + size_for_spec);
+    unsigned char *rangeBuffers = (unsigned char *)specIm + size_for_spec;
+    MtFFT fft = {};
+    if (spatial) {
+        for (int32_t ty = 0; ty < templHeight; ++ty) {
+            std::copy(templData + (size_t)ty * templWidthStride, templData + (size_t)ty * templWidthStride + templWidth, taps + ty * templWidth);
+        }
+    } else {
+        mt_fft_init(fft, n, fftBuffer);
+        memset(specRe, 0, (size_t)n * n * sizeof(float));
+        memset(specIm, 0, (size_t)n * n * sizeof(float));
+        for (int32_t ty = 0; ty < templHeight; ++ty) {
+            for (int32_t tx = 0; tx < templWidth; ++tx) {
+                specRe[(size_t)ty * n + tx] = (float)(templData[(size_t)ty * templWidthStride + tx] - t.mean);
+            }
+        }
+        mt_fft_2d(specRe, specIm, fft, false);
+        //! conjugated and scaled for the inverse transform
+        const float scale = 1.0f / ((float)n * n);
+        for (size_t i = 0; i < (size_t)n * n; ++i) {
+            specRe[i] *= scale;
+            specIm[i] *= scale;
+        }
+    }
+
+    ParallelFor(ranges, ranges, [&](int32_t r0, int32_t r1) {
+        for (int32_t r = r0; r < r1; ++r) {
+            unsigned char *buffer = rangeBuffers + size_for_range * r;
+            double *corr = (double *)buffer;
+            int32_t *sum = (int32_t *)(buffer + size_for_corr);
+            double *sqsum = (double *)((unsigned char *)sum + size_for_sum);
+            int16_t *rows = (int16_t *)((unsigned char *)sqsum + size_for_sqsum);
+            int32_t *acc = (int32_t *)((unsigned char *)rows + size_for_rows);
+            float *re = (float *)((unsigned char *)acc + size_for_acc);
+            float *im = (float *)((unsigned char *)re + size_for_spec);
+            for (int32_t b = (int32_t)((int64_t)bands * r / ranges); b < (int32_t)((int64_t)bands * (r + 1) / ranges); ++b) {
+                const int32_t y0 = b * bandRows;
+                const int32_t y1 = std::min(outHeight, y0 + bandRows);
+                const int32_t inRows = y1 - y0 + templHeight - 1;
+                if (spatial) {
+                    mt_correlate_spatial(y0, y1, outWidth, inWidth, inWidthStride, inData, templHeight, templWidth, taps, rows, acc, corr, outWidth);
+                } else {
+                    mt_correlate_fft(y0, y1, outWidth, inHeight, inWidth, inWidthStride, inData, templWidth, fft, specRe, specIm, re, im, corr, outWidth);
+                }
+                const uint8_t *bandIn = inData + (size_t)y0 * inWidthStride;
+                if (needSqsum) {
+                    IntegralSqr<int32_t, 1>(inRows, inWidth, inWidthStride, bandIn, sumStride, sum, sumStride, sqsum);
+                } else if (needSum) {
+                    Integral<int32_t, 1>(inRows, inWidth, inWidthStride, bandIn, sumStride, sum);
+                }
+                mt_normalize(y1 - y0, outWidth, corr, outWidth, spatial ? 0 : t.mean, needSum ? sum : nullptr, needSqsum ? sqsum : nullptr, sumStride, templHeight, templWidth, method, t, outWidthStride, outData + (size_t)y0 * outWidthStride);
+            }
+        }
+    });
+
+    tinycv::ScratchFree(temp_buffer);
+}
+
+} // namespace tinycv
@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/morphology.h"
+#include "tinycv/arm/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <memory>
+
+template <typename T, int32_t nc>
+void MorphologyTest(int32_t height, int32_t width, tinycv::MorphType op, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, tinycv::BorderType border_type)
+{
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst_opencv(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+
+    tinycv::MorphologyEx<T, nc>(height, width, width * nc, src.get(), width * nc, dst.get(), op, kernelWidth, kernelHeight, iterations, border_type);
+
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat oMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_opencv.get());
+    cv::Mat kernel = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(kernelWidth, kernelHeight));
+    cv::morphologyEx(iMat, oMat, (int)op, kernel, cv::Point(-1, -1), iterations, (int)border_type);
+
+    checkResult<T, nc>(dst.get(), dst_opencv.get(), height, width, width * nc, width * nc, 0.01f);
+}
+
+template <typename T>
+void MorphologyTestAll()
+{
+    const tinycv::BorderType borders[] = {tinycv::BORDER_CONSTANT, tinycv::BORDER_REPLICATE, tinycv::BORDER_REFLECT, tinycv::BORDER_REFLECT_101};
+    for (tinycv::BorderType border_type : borders) {
+        MorphologyTest<T, 1>(480, 640, tinycv::MORPH_ERODE, 3, 3, 1, border_type);
+        MorphologyTest<T, 1>(480, 640, tinycv::MORPH_DILATE, 31, 31, 1, border_type);
+        MorphologyTest<T, 3>(101, 99, tinycv::MORPH_ERODE, 5, 9, 2, border_type);
+        MorphologyTest<T, 4>(101, 99, tinycv::MORPH_DILATE, 4, 1, 3, border_type);
+        MorphologyTest<T, 1>(101, 99, tinycv::MORPH_OPEN, 15, 7, 1, border_type);
+        MorphologyTest<T, 3>(101, 99, tinycv::MORPH_CLOSE, 21, 2, 2, border_type);
+    }
+}
+
+TEST(MORPHOLOGY_UINT8, arm)
+{
+    MorphologyTestAll<uint8_t>();
+}
+
+TEST(MORPHOLOGY_FP32, arm)
+{
+    MorphologyTestAll<float>();
+}
+
+TEST(MORPHOLOGY_INPLACE_UINT8, arm)
+{
+    const int32_t height = 120, width = 160;
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+
+    tinycv::Erode<uint8_t, 1>(height, width, width, src.get(), width, dst.get(), 11, 11);
+    tinycv::Erode<uint8_t, 1>(height, width, width, src.get(), width, src.get(), 11, 11);
+
+    checkResult<uint8_t, 1>(dst.get(), src.get(), height, width, width, width, 0.01f);
+}
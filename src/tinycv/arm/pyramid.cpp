@@ -0,0 +1,608 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/pyramid.h"
+#include "tinycv/types.h"
+#include "tinycv/sys.h"
+
+#include <string.h>
+#include <stdint.h>
+#include <algorithm>
+#include <arm_neon.h>
+
+namespace tinycv {
+
+// BORDER_REFLECT_101, also valid when the border is wider than the image
+static inline int32_t pyr_reflect101(int32_t p, int32_t len)
+{
+    if (len == 1) {
+        return 0;
+    }
+    while (p < 0 || p >= len) {
+        p = p < 0 ? -p : 2 * len - p - 2;
+    }
+    return p;
+}
+
+// u8 sums of the 5 tap kernel stay below 16 * 16 * 255 and fit in 16 bits
+template <typename T>
+struct pyr_traits;
+
+template <>
+struct pyr_traits<uint8_t> {
+    typedef uint16_t work_t;
+    static inline uint8_t cast_down(uint32_t v)
+    {
+        return (uint8_t)((v + 128) >> 8);
+    }
+    static inline uint8_t cast_up(uint32_t v)
+    {
+        return (uint8_t)((v + 32) >> 6);
+    }
+};
+
+template <>
+struct pyr_traits<float> {
+    typedef float work_t;
+    static inline float cast_down(float v)
+    {
+        return v * (1.f / 256.f);
+    }
+    static inline float cast_up(float v)
+    {
+        return v * (1.f / 64.f);
+    }
+};
+
+// r0 + r4 + 4 * (r1 + r3) + 6 * r2
+static void pyr_down_v(const uint8_t *const *rows, int32_t n, uint16_t *dst)
+{
+    int32_t i = 0;
+    for (; i <= n - 16; i += 16) {
+        uint8x16_t s0 = vld1q_u8(rows[0] + i);
+        uint8x16_t s1 = vld1q_u8(rows[1] + i);
+        uint8x16_t s2 = vld1q_u8(rows[2] + i);
+        uint8x16_t s3 = vld1q_u8(rows[3] + i);
+        uint8x16_t s4 = vld1q_u8(rows[4] + i);
+        uint16x8_t lo = vaddl_u8(vget_low_u8(s0), vget_low_u8(s4));
+        uint16x8_t hi = vaddl_u8(vget_high_u8(s0), vget_high_u8(s4));
+        lo            = vaddq_u16(lo, vshlq_n_u16(vaddl_u8(vget_low_u8(s1), vget_low_u8(s3)), 2));
+        hi            = vaddq_u16(hi, vshlq_n_u16(vaddl_u8(vget_high_u8(s1), vget_high_u8(s3)), 2));
+        lo            = vmlal_u8(lo, vget_low_u8(s2), vdup_n_u8(6));
+        hi            = vmlal_u8(hi, vget_high_u8(s2), vdup_n_u8(6));
+        vst1q_u16(dst + i, lo);
+        vst1q_u16(dst + i + 8, hi);
+    }
+    for (; i < n; ++i) {
+        dst[i] = rows[0][i] + rows[4][i] + 4 * (rows[1][i] + rows[3][i]) + 6 * rows[2][i];
+    }
+}
+
+static void pyr_down_v(const float *const *rows, int32_t n, float *dst)
+{
+    int32_t i = 0;
+    for (; i <= n - 4; i += 4) {
+        float32x4_t r = vaddq_f32(vld1q_f32(rows[0] + i), vld1q_f32(rows[4] + i));
+        r             = vfmaq_n_f32(r, vaddq_f32(vld1q_f32(rows[1] + i), vld1q_f32(rows[3] + i)), 4.f);
+        r             = vfmaq_n_f32(r, vld1q_f32(rows[2] + i), 6.f);
+        vst1q_f32(dst + i, r);
+    }
+    for (; i < n; ++i) {
+        dst[i] = rows[0][i] + rows[4][i] + 4.f * (rows[1][i] + rows[3][i]) + 6.f * rows[2][i];
+    }
+}
+
+// overloads so that the 3 and 4 channel passes below are written once
+static inline void pyr_vld(const uint16_t *p, uint16x8x3_t &v)
+{
+    v = vld3q_u16(p);
+}
+static inline void pyr_vld(const uint16_t *p, uint16x8x4_t &v)
+{
+    v = vld4q_u16(p);
+}
+static inline void pyr_vld(const float *p, float32x4x3_t &v)
+{
+    v = vld3q_f32(p);
+}
+static inline void pyr_vld(const float *p, float32x4x4_t &v)
+{
+    v = vld4q_f32(p);
+}
+static inline void pyr_vst(uint8_t *p, const uint8x8x3_t &v)
+{
+    vst3_u8(p, v);
+}
+static inline void pyr_vst(uint8_t *p, const uint8x8x4_t &v)
+{
+    vst4_u8(p, v);
+}
+static inline void pyr_vst(uint8_t *p, const uint8x16x3_t &v)
+{
+    vst3q_u8(p, v);
+}
+static inline void pyr_vst(uint8_t *p, const uint8x16x4_t &v)
+{
+    vst4q_u8(p, v);
+}
+static inline void pyr_vst(float *p, const float32x4x3_t &v)
+{
+    vst3q_f32(p, v);
+}
+static inline void pyr_vst(float *p, const float32x4x4_t &v)
+{
+    vst4q_f32(p, v);
+}
+
+// 8 outputs from p = row + 2 * x * channels, each tap is the even or odd half of two de-interleaved loads
+template <int32_t channels, typename W, typename V>
+static inline void pyr_down_h8_u8(const uint16_t *p, uint8_t *dst)
+{
+    W a0, a1, b0, b1, c0, c1;
+    pyr_vld(p - 2 * channels, a0);
+    pyr_vld(p + 6 * channels, a1);
+    pyr_vld(p, b0);
+    pyr_vld(p + 8 * channels, b1);
+    pyr_vld(p + 2 * channels, c0);
+    pyr_vld(p + 10 * channels, c1);
+    V r;
+    for (int32_t k = 0; k < channels; ++k) {
+        uint16x8_t s = vaddq_u16(vuzp1q_u16(a0.val[k], a1.val[k]), vuzp1q_u16(c0.val[k], c1.val[k]));
+        s = vaddq_u16(s, vshlq_n_u16(vaddq_u16(vuzp2q_u16(a0.val[k], a1.val[k]), vuzp2q_u16(b0.val[k], b1.val[k])), 2));
+        s = vmlaq_n_u16(s, vuzp1q_u16(b0.val[k], b1.val[k]), 6);
+        r.val[k] = vrshrn_n_u16(s, 8);
+    }
+    pyr_vst(dst, r);
+}
+
+static inline int32_t pyr_down_h_simd(const uint16_t *row, int32_t channels, int32_t out_width, uint8_t *dst)
+{
+    int32_t x = 0;
+    if (channels == 1) {
+        // even and odd columns come out of the de-interleaving load, 8 outputs per step
+        for (; x <= out_width - 8; x += 8) {
+            uint16x8x2_t a = vld2q_u16(row + 2 * x - 2);
+            uint16x8x2_t b = vld2q_u16(row + 2 * x);
+            uint16x8x2_t c = vld2q_u16(row + 2 * x + 2);
+            uint32x4_t lo  = vaddl_u16(vget_low_u16(a.val[0]), vget_low_u16(c.val[0]));
+            uint32x4_t hi  = vaddl_u16(vget_high_u16(a.val[0]), vget_high_u16(c.val[0]));
+            lo             = vaddq_u32(lo, vshlq_n_u32(vaddl_u16(vget_low_u16(a.val[1]), vget_low_u16(b.val[1])), 2));
+            hi             = vaddq_u32(hi, vshlq_n_u32(vaddl_u16(vget_high_u16(a.val[1]), vget_high_u16(b.val[1])), 2));
+            lo             = vmlal_n_u16(lo, vget_low_u16(b.val[0]), 6);
+            hi             = vmlal_n_u16(hi, vget_high_u16(b.val[0]), 6);
+            uint16x8_t r   = vcombine_u16(vrshrn_n_u32(lo, 8), vrshrn_n_u32(hi, 8));
+            vst1_u8(dst + x, vmovn_u16(r));
+        }
+    } else if (channels == 3) {
+        for (; x <= out_width - 8; x += 8) {
+            pyr_down_h8_u8<3, uint16x8x3_t, uint8x8x3_t>(row + 6 * x, dst + 3 * x);
+        }
+    } else if (channels == 4) {
+        for (; x <= out_width - 8; x += 8) {
+            pyr_down_h8_u8<4, uint16x8x4_t, uint8x8x4_t>(row + 8 * x, dst + 4 * x);
+        }
+    }
+    return x;
+}
+
+static inline float32x4_t pyr_down_h_f32(float32x4_t t0, float32x4_t t1, float32x4_t t2, float32x4_t t3, float32x4_t t4)
+{
+    float32x4_t r = vaddq_f32(t0, t4);
+    r = vfmaq_n_f32(r, vaddq_f32(t1, t3), 4.f);
+    r = vfmaq_n_f32(r, t2, 6.f);
+    return vmulq_n_f32(r, 1.f / 256.f);
+}
+
+template <int32_t channels, typename V>
+static inline void pyr_down_h4_f32(const float *p, float *dst)
+{
+    V a0, a1, b0, b1, c0, c1;
+    pyr_vld(p - 2 * channels, a0);
+    pyr_vld(p + 2 * channels, a1);
+    pyr_vld(p, b0);
+    pyr_vld(p + 4 * channels, b1);
+    pyr_vld(p + 2 * channels, c0);
+    pyr_vld(p + 6 * channels, c1);
+    V r;
+    for (int32_t k = 0; k < channels; ++k) {
+        r.val[k] = pyr_down_h_f32(vuzp1q_f32(a0.val[k], a1.val[k]), vuzp2q_f32(a0.val[k], a1.val[k]),
+                                  vuzp1q_f32(b0.val[k], b1.val[k]), vuzp2q_f32(b0.val[k], b1.val[k]),
+                                  vuzp1q_f32(c0.val[k], c1.val[k]));
+    }
+    pyr_vst(dst, r);
+}
+
+static inline int32_t pyr_down_h_simd(const float *row, int32_t channels, int32_t out_width, float *dst)
+{
+    int32_t x = 0;
+    if (channels == 1) {
+        for (; x <= out_width - 4; x += 4) {
+            float32x4x2_t a = vld2q_f32(row + 2 * x - 2);
+            float32x4x2_t b = vld2q_f32(row + 2 * x);
+            float32x4x2_t c = vld2q_f32(row + 2 * x + 2);
+            vst1q_f32(dst + x, pyr_down_h_f32(a.val[0], a.val[1], b.val[0], b.val[1], c.val[0]));
+        }
+    } else if (channels == 3) {
+        for (; x <= out_width - 4; x += 4) {
+            pyr_down_h4_f32<3, float32x4x3_t>(row + 6 * x, dst + 3 * x);
+        }
+    } else if (channels == 4) {
+        for (; x <= out_width - 4; x += 4) {
+            pyr_down_h4_f32<4, float32x4x4_t>(row + 8 * x, dst + 4 * x);
+        }
+    }
+    return x;
+}
+
+// row holds 2 reflected pixels on each side
+template <typename T>
+static void pyr_down_h(const typename pyr_traits<T>::work_t *row, int32_t channels, int32_t out_width, T *dst)
+{
+    for (int32_t x = pyr_down_h_simd(row, channels, out_width, dst); x < out_width; ++x) {
+        for (int32_t c = 0; c < channels; ++c) {
+            const typename pyr_traits<T>::work_t *p = row + 2 * x * channels + c;
+            dst[x * channels + c]                   = pyr_traits<T>::cast_down(
+                p[-2 * channels] + p[2 * channels] + 4 * (p[-channels] + p[channels]) + 6 * p[0]);
+        }
+    }
+}
+
+template <typename W>
+static inline void pyr_fill_border(W *row, int32_t width, int32_t channels, int32_t border)
+{
+    for (int32_t i = 1; i <= border; ++i) {
+        int32_t l = pyr_reflect101(-i, width);
+        int32_t r = pyr_reflect101(width - 1 + i, width);
+        for (int32_t c = 0; c < channels; ++c) {
+            row[-i * channels + c]              = row[l * channels + c];
+            row[(width - 1 + i) * channels + c] = row[r * channels + c];
+        }
+    }
+}
+
+// one output row of PyrDown, buffer holds the vertically filtered row with room for the borders
+template <typename T>
+static void pyr_down_row(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t channels,
+    int32_t y,
+    typename pyr_traits<T>::work_t *buffer,
+    T *dst)
+{
+    const T *rows[5];
+    for (int32_t k = 0; k < 5; ++k) {
+        rows[k] = inData + pyr_reflect101(2 * y - 2 + k, inHeight) * inWidthStride;
+    }
+    typename pyr_traits<T>::work_t *row = buffer + 2 * channels;
+    pyr_down_v(rows, inWidth * channels, row);
+    pyr_fill_border(row, inWidth, channels, 2);
+    pyr_down_h(row, channels, (inWidth + 1) / 2, dst);
+}
+
+template <typename T>
+static uint64_t pyr_buffer_size(int32_t width, int32_t channels)
+{
+    // 2 border pixels on each side, the vector loads may run 8 elements past the right border
+    return (((uint64_t)(width + 4) * channels + 16) * sizeof(typename pyr_traits<T>::work_t) + 64 - 1) / 64 * 64;
+}
+
+template <typename T, int32_t channels>
+void PyrDown(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0) {
+        return;
+    }
+    typename pyr_traits<T>::work_t *buffer = (typename pyr_traits<T>::work_t *)tinycv::ScratchAlloc(pyr_buffer_size<T>(inWidth, channels), 64);
+    for (int32_t y = 0; y < (inHeight + 1) / 2; ++y) {
+        pyr_down_row(inHeight, inWidth, inWidthStride, inData, channels, y, buffer, outData + y * outWidthStride);
+    }
+    tinycv::ScratchFree(buffer);
+}
+
+// t0 = r0 + 6 * r1 + r2 and t1 = 4 * (r1 + r2), the two vertical phases of PyrUp
+static void pyr_up_v(const uint8_t *r0, const uint8_t *r1, const uint8_t *r2, int32_t n, uint16_t *t0, uint16_t *t1)
+{
+    int32_t i = 0;
+    for (; i <= n - 8; i += 8) {
+        uint8x8_t a = vld1_u8(r0 + i);
+        uint8x8_t b = vld1_u8(r1 + i);
+        uint8x8_t c = vld1_u8(r2 + i);
+        vst1q_u16(t0 + i, vmlal_u8(vaddl_u8(a, c), b, vdup_n_u8(6)));
+        vst1q_u16(t1 + i, vshlq_n_u16(vaddl_u8(b, c), 2));
+    }
+    for (; i < n; ++i) {
+        t0[i] = r0[i] + 6 * r1[i] + r2[i];
+        t1[i] = 4 * (r1[i] + r2[i]);
+    }
+}
+
+static void pyr_up_v(const float *r0, const float *r1, const float *r2, int32_t n, float *t0, float *t1)
+{
+    int32_t i = 0;
+    for (; i <= n - 4; i += 4) {
+        float32x4_t a = vld1q_f32(r0 + i);
+        float32x4_t b = vld1q_f32(r1 + i);
+        float32x4_t c = vld1q_f32(r2 + i);
+        vst1q_f32(t0 + i, vfmaq_n_f32(vaddq_f32(a, c), b, 6.f));
+        vst1q_f32(t1 + i, vmulq_n_f32(vaddq_f32(b, c), 4.f));
+    }
+    for (; i < n; ++i) {
+        t0[i] = r0[i] + 6.f * r1[i] + r2[i];
+        t1[i] = 4.f * (r1[i] + r2[i]);
+    }
+}
+
+// 8 input pixels from p = row + x * channels, the even and odd outputs of each channel are zipped into 16 pixels
+template <int32_t channels, typename W, typename V>
+static inline void pyr_up_h8_u8(const uint16_t *p, uint8_t *dst)
+{
+    W a, b, c;
+    pyr_vld(p - channels, a);
+    pyr_vld(p, b);
+    pyr_vld(p + channels, c);
+    V r;
+    for (int32_t k = 0; k < channels; ++k) {
+        uint8x8_t e = vrshrn_n_u16(vmlaq_n_u16(vaddq_u16(a.val[k], c.val[k]), b.val[k], 6), 6);
+        uint8x8_t o = vrshrn_n_u16(vshlq_n_u16(vaddq_u16(b.val[k], c.val[k]), 2), 6);
+        uint8x8x2_t z = vzip_u8(e, o);
+        r.val[k] = vcombine_u8(z.val[0], z.val[1]);
+    }
+    pyr_vst(dst, r);
+}
+
+static inline int32_t pyr_up_h_simd(const uint16_t *row, int32_t channels, int32_t in_width, uint8_t *dst)
+{
+    int32_t x = 0;
+    if (channels == 1) {
+        for (; x <= in_width - 8; x += 8) {
+            uint16x8_t a = vld1q_u16(row + x - 1);
+            uint16x8_t b = vld1q_u16(row + x);
+            uint16x8_t c = vld1q_u16(row + x + 1);
+            uint8x8x2_t r;
+            r.val[0] = vrshrn_n_u16(vmlaq_n_u16(vaddq_u16(a, c), b, 6), 6);
+            r.val[1] = vrshrn_n_u16(vshlq_n_u16(vaddq_u16(b, c), 2), 6);
+            vst2_u8(dst + 2 * x, r);
+        }
+    } else if (channels == 3) {
+        for (; x <= in_width - 8; x += 8) {
+            pyr_up_h8_u8<3, uint16x8x3_t, uint8x16x3_t>(row + 3 * x, dst + 6 * x);
+        }
+    } else if (channels == 4) {
+        for (; x <= in_width - 8; x += 8) {
+            pyr_up_h8_u8<4, uint16x8x4_t, uint8x16x4_t>(row + 4 * x, dst + 8 * x);
+        }
+    }
+    return x;
+}
+
+// 4 input pixels from p = row + x * channels, the even and odd outputs of each channel are zipped into 8 pixels
+template <int32_t channels, typename V>
+static inline void pyr_up_h4_f32(const float *p, float *dst)
+{
+    V a, b, c, lo, hi;
+    pyr_vld(p - channels, a);
+    pyr_vld(p, b);
+    pyr_vld(p + channels, c);
+    for (int32_t k = 0; k < channels; ++k) {
+        float32x4_t e = vmulq_n_f32(vfmaq_n_f32(vaddq_f32(a.val[k], c.val[k]), b.val[k], 6.f), 1.f / 64.f);
+        float32x4_t o = vmulq_n_f32(vmulq_n_f32(vaddq_f32(b.val[k], c.val[k]), 4.f), 1.f / 64.f);
+        lo.val[k] = vzip1q_f32(e, o);
+        hi.val[k] = vzip2q_f32(e, o);
+    }
+    pyr_vst(dst, lo);
+    pyr_vst(dst + 4 * channels, hi);
+}
+
+static inline int32_t pyr_up_h_simd(const float *row, int32_t channels, int32_t in_width, float *dst)
+{
+    int32_t x = 0;
+    if (channels == 1) {
+        for (; x <= in_width - 4; x += 4) {
+            float32x4_t a = vld1q_f32(row + x - 1);
+            float32x4_t b = vld1q_f32(row + x);
+            float32x4_t c = vld1q_f32(row + x + 1);
+            float32x4x2_t r;
+            r.val[0] = vmulq_n_f32(vfmaq_n_f32(vaddq_f32(a, c), b, 6.f), 1.f / 64.f);
+            r.val[1] = vmulq_n_f32(vmulq_n_f32(vaddq_f32(b, c), 4.f), 1.f / 64.f);
+            vst2q_f32(dst + 2 * x, r);
+        }
+    } else if (channels == 3) {
+        for (; x <= in_width - 4; x += 4) {
+            pyr_up_h4_f32<3, float32x4x3_t>(row + 3 * x, dst + 6 * x);
+        }
+    } else if (channels == 4) {
+        for (; x <= in_width - 4; x += 4) {
+            pyr_up_h4_f32<4, float32x4x4_t>(row + 4 * x, dst + 8 * x);
+        }
+    }
+    return x;
+}
+
+// row holds one border pixel on each side, the right one replicates the last pixel
+template <typename T>
+static void pyr_up_h(const typename pyr_traits<T>::work_t *row, int32_t channels, int32_t in_width, T *dst)
+{
+    for (int32_t x = pyr_up_h_simd(row, channels, in_width, dst); x < in_width; ++x) {
+        for (int32_t c = 0; c < channels; ++c) {
+            const typename pyr_traits<T>::work_t *p = row + x * channels + c;
+            dst[2 * x * channels + c]               = pyr_traits<T>::cast_up(p[-channels] + 6 * p[0] + p[channels]);
+            dst[(2 * x + 1) * channels + c]         = pyr_traits<T>::cast_up(4 * (p[0] + p[channels]));
+        }
+    }
+}
+
+template <typename T, int32_t channels>
+void PyrUp(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0) {
+        return;
+    }
+    typedef typename pyr_traits<T>::work_t work_t;
+    uint64_t size_for_row = pyr_buffer_size<T>(inWidth, channels);
+    work_t *t0 = (work_t *)tinycv::ScratchAlloc(2 * size_for_row, 64);
+    work_t *t1 = (work_t *)((unsigned char *)t0 + size_for_row);
+    int32_t n  = inWidth * channels;
+    for (int32_t y = 0; y < inHeight; ++y) {
+        // the row below the image repeats the last one, like the right column does
+        const T *r0 = inData + pyr_reflect101(y - 1, inHeight) * inWidthStride;
+        const T *r1 = inData + y * inWidthStride;
+        const T *r2 = inData + std::min(y + 1, inHeight - 1) * inWidthStride;
+        work_t *row0 = t0 + channels;
+        work_t *row1 = t1 + channels;
+        pyr_up_v(r0, r1, r2, n, row0, row1);
+        for (int32_t c = 0; c < channels; ++c) {
+            row0[-channels + c] = row0[pyr_reflect101(-1, inWidth) * channels + c];
+            row1[-channels + c] = row1[pyr_reflect101(-1, inWidth) * channels + c];
+            row0[n + c]         = row0[n - channels + c];
+            row1[n + c]         = row1[n - channels + c];
+        }
+        pyr_up_h(row0, channels, inWidth, outData + 2 * y * outWidthStride);
+        pyr_up_h(row1, channels, inWidth, outData + (2 * y + 1) * outWidthStride);
+    }
+    tinycv::ScratchFree(t0);
+}
+
+template <typename T, int32_t channels>
+uint64_t PyramidArenaSize(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t levels)
+{
+    uint64_t size = 0;
+    for (int32_t l = 1; l < levels; ++l) {
+        inHeight = (inHeight + 1) / 2;
+        inWidth  = (inWidth + 1) / 2;
+        size += (uint64_t)inHeight * inWidth * channels;
+    }
+    return size;
+}
+
+// produce every row of level l whose source rows exist, each new row is handed to the next level
+template <typename T>
+static void pyr_build_level(
+    PyramidLevel<T> *pyramid,
+    int32_t levels,
+    int32_t channels,
+    int32_t l,
+    int32_t *done,
+    typename pyr_traits<T>::work_t *buffer)
+{
+    const PyramidLevel<T> &src = pyramid[l - 1];
+    const PyramidLevel<T> &dst = pyramid[l];
+    while (done[l] < dst.height) {
+        int32_t y = done[l];
+        if (l > 1 && done[l - 1] <= std::min(2 * y + 2, src.height - 1)) {
+            return;
+        }
+        pyr_down_row(src.height, src.width, src.widthStride, src.data, channels, y, buffer, (T *)dst.data + y * dst.widthStride);
+        ++done[l];
+        if (l + 1 < levels) {
+            pyr_build_level(pyramid, levels, channels, l + 1, done, buffer);
+        }
+    }
+}
+
+template <typename T, int32_t channels>
+void BuildPyramid(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t levels,
+    T *arena,
+    PyramidLevel<T> *pyramid)
+{
+    if (nullptr == inData || nullptr == pyramid || levels <= 0) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || (levels > 1 && nullptr == arena)) {
+        return;
+    }
+    pyramid[0].height      = inHeight;
+    pyramid[0].width       = inWidth;
+    pyramid[0].widthStride = inWidthStride;
+    pyramid[0].data        = inData;
+    for (int32_t l = 1; l < levels; ++l) {
+        pyramid[l].height      = (pyramid[l - 1].height + 1) / 2;
+        pyramid[l].width       = (pyramid[l - 1].width + 1) / 2;
+        pyramid[l].widthStride = pyramid[l].width * channels;
+        pyramid[l].data        = arena;
+        arena += (uint64_t)pyramid[l].height * pyramid[l].widthStride;
+    }
+    if (levels == 1) {
+        return;
+    }
+    // rows of every level are consumed by the next one right after they are written
+    uint64_t size_for_buffer = pyr_buffer_size<T>(inWidth, channels);
+    uint64_t size_for_done = ((uint64_t)levels * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    void *temp_buffer = tinycv::ScratchAlloc(size_for_buffer + size_for_done, 64);
+    typename pyr_traits<T>::work_t *buffer = (typename pyr_traits<T>::work_t *)temp_buffer;
+    int32_t *done = (int32_t *)((unsigned char *)temp_buffer + size_for_buffer);
+    memset(done, 0, levels * sizeof(int32_t));
+    pyr_build_level(pyramid, levels, channels, 1, done, buffer);
+    tinycv::ScratchFree(temp_buffer);
+}
+
+template void PyrDown<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData);
+template void PyrDown<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData);
+template void PyrDown<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData);
+template void PyrDown<float, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData);
+template void PyrDown<float, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData);
+template void PyrDown<float, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData);
+
+template void PyrUp<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData);
+template void PyrUp<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData);
+template void PyrUp<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData);
+template void PyrUp<float, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData);
+template void PyrUp<float, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData);
+template void PyrUp<float, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData);
+
+template uint64_t PyramidArenaSize<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t levels);
+template uint64_t PyramidArenaSize<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t levels);
+template uint64_t PyramidArenaSize<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t levels);
+template uint64_t PyramidArenaSize<float, 1>(int32_t inHeight, int32_t inWidth, int32_t levels);
+template uint64_t PyramidArenaSize<float, 3>(int32_t inHeight, int32_t inWidth, int32_t levels);
+template uint64_t PyramidArenaSize<float, 4>(int32_t inHeight, int32_t inWidth, int32_t levels);
+
+template void BuildPyramid<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t levels, uint8_t *arena, PyramidLevel<uint8_t> *pyramid);
+template void BuildPyramid<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t levels, uint8_t *arena, PyramidLevel<uint8_t> *pyramid);
+template void BuildPyramid<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t levels, uint8_t *arena, PyramidLevel<uint8_t> *pyramid);
+template void BuildPyramid<float, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t levels, float *arena, PyramidLevel<float> *pyramid);
+template void BuildPyramid<float, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t levels, float *arena, PyramidLevel<float> *pyramid);
+template void BuildPyramid<float, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t levels, float *arena, PyramidLevel<float> *pyramid);
+} // namespace tinycv
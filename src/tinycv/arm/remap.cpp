@@ -0,0 +1,489 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/remap.h"
+#include "tinycv/types.h"
+
+#include <string.h>
+#include <stdint.h>
+#include <arm_neon.h>
+
+namespace tinycv {
+
+enum { REMAP_INTER_TAB_SIZE2 = REMAP_INTER_TAB_SIZE * REMAP_INTER_TAB_SIZE };
+
+// all border modes, also valid far outside the image, -1 for BORDER_CONSTANT and BORDER_TRANSPARENT
+static inline int32_t remap_border_interpolate(int32_t p, int32_t len, BorderType border_type)
+{
+    if ((uint32_t)p < (uint32_t)len) {
+        return p;
+    }
+    if (border_type == BORDER_REPLICATE) {
+        p = p < 0 ? 0 : len - 1;
+    } else if (border_type == BORDER_REFLECT || border_type == BORDER_REFLECT_101) {
+        int32_t delta = border_type == BORDER_REFLECT_101;
+        if (len == 1) {
+            return 0;
+        }
+        do {
+            if (p < 0) {
+                p = -p - 1 + delta;
+            } else {
+                p = len - 1 - (p - len) - delta;
+            }
+        } while ((uint32_t)p >= (uint32_t)len);
+    } else if (border_type == BORDER_WRAP) {
+        if (p < 0) {
+            p -= ((p - len + 1) / len) * len;
+        }
+        if (p >= len) {
+            p %= len;
+        }
+    } else {
+        p = -1;
+    }
+    return p;
+}
+
+static inline int16_t remap_saturate_s16(int32_t v)
+{
+    return (int16_t)(v < INT16_MIN ? INT16_MIN : (v > INT16_MAX ? INT16_MAX : v));
+}
+
+// same rounding and saturation as the vector conversion
+static inline int32_t remap_round(float v)
+{
+    return vgetq_lane_s32(vcvtnq_s32_f32(vdupq_n_f32(v)), 0);
+}
+
+// bilinear weights of every table index, (1 - fx, fx) x (1 - fy, fy) in 1/32 steps.
+// u8 weights sum to 1 << 10, the products are exact so the fixed-point result equals the float one rounded.
+struct RemapTables {
+    int16_t w_u8[REMAP_INTER_TAB_SIZE2][4];
+    float w_f32[REMAP_INTER_TAB_SIZE2][4];
+
+    RemapTables()
+    {
+        for (int32_t fy = 0; fy < REMAP_INTER_TAB_SIZE; ++fy) {
+            for (int32_t fx = 0; fx < REMAP_INTER_TAB_SIZE; ++fx) {
+                int32_t idx = fy * REMAP_INTER_TAB_SIZE + fx;
+                int32_t ix = REMAP_INTER_TAB_SIZE - fx;
+                int32_t iy = REMAP_INTER_TAB_SIZE - fy;
+                w_u8[idx][0] = (int16_t)(ix * iy);
+                w_u8[idx][1] = (int16_t)(fx * iy);
+                w_u8[idx][2] = (int16_t)(ix * fy);
+                w_u8[idx][3] = (int16_t)(fx * fy);
+                float ax = fx * (1.f / REMAP_INTER_TAB_SIZE);
+                float ay = fy * (1.f / REMAP_INTER_TAB_SIZE);
+                w_f32[idx][0] = (1.f - ay) * (1.f - ax);
+                w_f32[idx][1] = (1.f - ay) * ax;
+                w_f32[idx][2] = ay * (1.f - ax);
+                w_f32[idx][3] = ay * ax;
+            }
+        }
+    }
+};
+
+static const RemapTables &remap_tables()
+{
+    static RemapTables tables;
+    return tables;
+}
+
+template <typename T>
+struct remap_traits;
+
+template <>
+struct remap_traits<uint8_t> {
+    typedef int32_t work_t;
+    static inline const int16_t *weights(const RemapTables &tables, int32_t idx)
+    {
+        return tables.w_u8[idx];
+    }
+    static inline uint8_t cast(int32_t v)
+    {
+        return (uint8_t)((v + (1 << 9)) >> 10);
+    }
+};
+
+template <>
+struct remap_traits<float> {
+    typedef float work_t;
+    static inline const float *weights(const RemapTables &tables, int32_t idx)
+    {
+        return tables.w_f32[idx];
+    }
+    static inline float cast(float v)
+    {
+        return v;
+    }
+};
+
+void ConvertMaps(
+    int32_t height,
+    int32_t width,
+    int32_t mapXWidthStride,
+    const float *mapX,
+    int32_t mapYWidthStride,
+    const float *mapY,
+    int32_t mapXYWidthStride,
+    int16_t *mapXY,
+    int32_t mapFracWidthStride,
+    uint16_t *mapFrac)
+{
+    if (nullptr == mapX || nullptr == mapY || nullptr == mapXY) {
+        return;
+    }
+    if (height <= 0 || width <= 0) {
+        return;
+    }
+    const int32x4_t v_mask = vdupq_n_s32(REMAP_INTER_TAB_SIZE - 1);
+    for (int32_t y = 0; y < height; ++y) {
+        const float *X = mapX + y * mapXWidthStride;
+        const float *Y = mapY + y * mapYWidthStride;
+        int16_t *XY = mapXY + y * mapXYWidthStride;
+        int32_t x = 0;
+        if (nullptr == mapFrac) {
+            for (; x <= width - 8; x += 8) {
+                int16x8x2_t v_xy;
+                v_xy.val[0] = vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(vld1q_f32(X + x))), vqmovn_s32(vcvtnq_s32_f32(vld1q_f32(X + x + 4))));
+                v_xy.val[1] = vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(vld1q_f32(Y + x))), vqmovn_s32(vcvtnq_s32_f32(vld1q_f32(Y + x + 4))));
+                vst2q_s16(XY + x * 2, v_xy);
+            }
+            for (; x < width; ++x) {
+                XY[x * 2]     = remap_saturate_s16(remap_round(X[x]));
+                XY[x * 2 + 1] = remap_saturate_s16(remap_round(Y[x]));
+            }
+            continue;
+        }
+        uint16_t *F = mapFrac + y * mapFracWidthStride;
+        for (; x <= width - 8; x += 8) {
+            int32x4_t ix0 = vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(X + x), (float)REMAP_INTER_TAB_SIZE));
+            int32x4_t ix1 = vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(X + x + 4), (float)REMAP_INTER_TAB_SIZE));
+            int32x4_t iy0 = vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(Y + x), (float)REMAP_INTER_TAB_SIZE));
+            int32x4_t iy1 = vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(Y + x + 4), (float)REMAP_INTER_TAB_SIZE));
+            int16x8x2_t v_xy;
+            v_xy.val[0] = vcombine_s16(vqmovn_s32(vshrq_n_s32(ix0, REMAP_INTER_BITS)), vqmovn_s32(vshrq_n_s32(ix1, REMAP_INTER_BITS)));
+            v_xy.val[1] = vcombine_s16(vqmovn_s32(vshrq_n_s32(iy0, REMAP_INTER_BITS)), vqmovn_s32(vshrq_n_s32(iy1, REMAP_INTER_BITS)));
+            vst2q_s16(XY + x * 2, v_xy);
+            int32x4_t f0 = vorrq_s32(vshlq_n_s32(vandq_s32(iy0, v_mask), REMAP_INTER_BITS), vandq_s32(ix0, v_mask));
+            int32x4_t f1 = vorrq_s32(vshlq_n_s32(vandq_s32(iy1, v_mask), REMAP_INTER_BITS), vandq_s32(ix1, v_mask));
+            vst1q_u16(F + x, vcombine_u16(vmovn_u32(vreinterpretq_u32_s32(f0)), vmovn_u32(vreinterpretq_u32_s32(f1))));
+        }
+        for (; x < width; ++x) {
+            int32_t ix = remap_round(X[x] * REMAP_INTER_TAB_SIZE);
+            int32_t iy = remap_round(Y[x] * REMAP_INTER_TAB_SIZE);
+            XY[x * 2]     = remap_saturate_s16(ix >> REMAP_INTER_BITS);
+            XY[x * 2 + 1] = remap_saturate_s16(iy >> REMAP_INTER_BITS);
+            F[x]          = (uint16_t)((iy & (REMAP_INTER_TAB_SIZE - 1)) * REMAP_INTER_TAB_SIZE + (ix & (REMAP_INTER_TAB_SIZE - 1)));
+        }
+    }
+}
+
+// element offsets of four map entries, returns true when all of them are inside [0, w) x [0, h)
+static inline bool remap_offsets4(const int16_t *XY, uint32x4_t v_w, uint32x4_t v_h, int32_t stride, int32_t cn, int32_t *ofs)
+{
+    int16x4x2_t xy = vld2_s16(XY);
+    int32x4_t v_x  = vmovl_s16(xy.val[0]);
+    int32x4_t v_y  = vmovl_s16(xy.val[1]);
+    // negative coordinates wrap to large unsigned values and fail the compare too
+    uint32x4_t in  = vandq_u32(vcltq_u32(vreinterpretq_u32_s32(v_x), v_w), vcltq_u32(vreinterpretq_u32_s32(v_y), v_h));
+    vst1q_s32(ofs, vmlaq_n_s32(vmulq_n_s32(v_x, cn), v_y, stride));
+    return vminvq_u32(in) != 0;
+}
+
+template <typename T, int32_t cn>
+static inline void remap_nearest_pixel(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t sx,
+    int32_t sy,
+    BorderType border_type,
+    T border_value,
+    T *D)
+{
+    if ((uint32_t)sx >= (uint32_t)inWidth || (uint32_t)sy >= (uint32_t)inHeight) {
+        if (border_type == BORDER_TRANSPARENT) {
+            return;
+        }
+        if (border_type == BORDER_CONSTANT) {
+            for (int32_t c = 0; c < cn; ++c) {
+                D[c] = border_value;
+            }
+            return;
+        }
+        sx = remap_border_interpolate(sx, inWidth, border_type);
+        sy = remap_border_interpolate(sy, inHeight, border_type);
+    }
+    memcpy(D, inData + sy * inWidthStride + sx * cn, cn * sizeof(T));
+}
+
+template <typename T, int32_t channels>
+void RemapNearestPoint(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t mapXYWidthStride,
+    const int16_t *mapXY,
+    BorderType border_type,
+    T border_value)
+{
+    if (nullptr == inData || nullptr == outData || nullptr == mapXY) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || outHeight <= 0 || outWidth <= 0) {
+        return;
+    }
+    if (border_type == BORDER_ISOLATED) {
+        return;
+    }
+    const uint32x4_t v_w = vdupq_n_u32(inWidth);
+    const uint32x4_t v_h = vdupq_n_u32(inHeight);
+    int32_t ofs[4];
+    for (int32_t y = 0; y < outHeight; ++y) {
+        const int16_t *XY = mapXY + y * mapXYWidthStride;
+        T *D = outData + y * outWidthStride;
+        int32_t x = 0;
+        for (; x <= outWidth - 4; x += 4) {
+            if (remap_offsets4(XY + x * 2, v_w, v_h, inWidthStride, channels, ofs)) {
+                for (int32_t k = 0; k < 4; ++k) {
+                    memcpy(D + (x + k) * channels, inData + ofs[k], channels * sizeof(T));
+                }
+            } else {
+                for (int32_t k = 0; k < 4; ++k) {
+                    remap_nearest_pixel<T, channels>(inHeight, inWidth, inWidthStride, inData, XY[(x + k) * 2], XY[(x + k) * 2 + 1], border_type, border_value, D + (x + k) * channels);
+                }
+            }
+        }
+        for (; x < outWidth; ++x) {
+            remap_nearest_pixel<T, channels>(inHeight, inWidth, inWidthStride, inData, XY[x * 2], XY[x * 2 + 1], border_type, border_value, D + x * channels);
+        }
+    }
+}
+
+template <typename T, int32_t cn>
+static inline void remap_linear_pixel(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t sx,
+    int32_t sy,
+    int32_t idx,
+    BorderType border_type,
+    T border_value,
+    T *D)
+{
+    typedef typename remap_traits<T>::work_t work_t;
+    const RemapTables &tables = remap_tables();
+    const auto *w = remap_traits<T>::weights(tables, idx);
+    const T *p[4];
+    if ((uint32_t)sx < (uint32_t)(inWidth - 1) && (uint32_t)sy < (uint32_t)(inHeight - 1)) {
+        p[0] = inData + sy * inWidthStride + sx * cn;
+        p[1] = p[0] + cn;
+        p[2] = p[0] + inWidthStride;
+        p[3] = p[2] + cn;
+    } else {
+        if (border_type == BORDER_TRANSPARENT) {
+            return;
+        }
+        int32_t x0 = remap_border_interpolate(sx, inWidth, border_type);
+        int32_t x1 = remap_border_interpolate(sx + 1, inWidth, border_type);
+        int32_t y0 = remap_border_interpolate(sy, inHeight, border_type);
+        int32_t y1 = remap_border_interpolate(sy + 1, inHeight, border_type);
+        // BORDER_CONSTANT neighbours outside the image are left null and read as border_value
+        p[0] = x0 >= 0 && y0 >= 0 ? inData + y0 * inWidthStride + x0 * cn : nullptr;
+        p[1] = x1 >= 0 && y0 >= 0 ? inData + y0 * inWidthStride + x1 * cn : nullptr;
+        p[2] = x0 >= 0 && y1 >= 0 ? inData + y1 * inWidthStride + x0 * cn : nullptr;
+        p[3] = x1 >= 0 && y1 >= 0 ? inData + y1 * inWidthStride + x1 * cn : nullptr;
+    }
+    for (int32_t c = 0; c < cn; ++c) {
+        work_t sum = 0;
+        for (int32_t k = 0; k < 4; ++k) {
+            sum += (work_t)(p[k] ? p[k][c] : border_value) * w[k];
+        }
+        D[c] = remap_traits<T>::cast(sum);
+    }
+}
+
+// four single channel pixels whose neighbourhoods are inside the image
+static inline void remap_linear_inside4_c1(const uint8_t *inData, int32_t inWidthStride, const int32_t *ofs, const int32_t *idx, uint8_t *D)
+{
+    const RemapTables &tables = remap_tables();
+    uint32_t v[4];
+    for (int32_t k = 0; k < 4; ++k) {
+        const uint8_t *s = inData + ofs[k];
+        uint16_t r0, r1;
+        memcpy(&r0, s, sizeof(r0));
+        memcpy(&r1, s + inWidthStride, sizeof(r1));
+        v[k] = (uint32_t)r0 | ((uint32_t)r1 << 16);
+    }
+    uint8x16_t pix = vreinterpretq_u8_u32(vld1q_u32(v));
+    uint16x8_t p01 = vmovl_u8(vget_low_u8(pix));
+    uint16x8_t p23 = vmovl_u8(vget_high_u8(pix));
+    uint32x4_t m0  = vmull_u16(vget_low_u16(p01), vreinterpret_u16_s16(vld1_s16(tables.w_u8[idx[0]])));
+    uint32x4_t m1  = vmull_u16(vget_high_u16(p01), vreinterpret_u16_s16(vld1_s16(tables.w_u8[idx[1]])));
+    uint32x4_t m2  = vmull_u16(vget_low_u16(p23), vreinterpret_u16_s16(vld1_s16(tables.w_u8[idx[2]])));
+    uint32x4_t m3  = vmull_u16(vget_high_u16(p23), vreinterpret_u16_s16(vld1_s16(tables.w_u8[idx[3]])));
+    uint16x4_t sum = vrshrn_n_u32(vpaddq_u32(vpaddq_u32(m0, m1), vpaddq_u32(m2, m3)), 10);
+    uint32_t res   = vget_lane_u32(vreinterpret_u32_u8(vmovn_u16(vcombine_u16(sum, sum))), 0);
+    memcpy(D, &res, sizeof(res));
+}
+
+static inline void remap_linear_inside4_c1(const float *inData, int32_t inWidthStride, const int32_t *ofs, const int32_t *idx, float *D)
+{
+    const RemapTables &tables = remap_tables();
+    float32x4_t m[4];
+    for (int32_t k = 0; k < 4; ++k) {
+        const float *s = inData + ofs[k];
+        m[k] = vmulq_f32(vcombine_f32(vld1_f32(s), vld1_f32(s + inWidthStride)), vld1q_f32(tables.w_f32[idx[k]]));
+    }
+    vst1q_f32(D, vpaddq_f32(vpaddq_f32(m[0], m[1]), vpaddq_f32(m[2], m[3])));
+}
+
+// one 3 or 4 channel pixel whose neighbourhood is inside the image, 3 channel loads never pass the right neighbour
+static inline uint16x8_t remap_load_pair_u8(const uint8_t *s, int32_t cn)
+{
+    uint32_t v[2];
+    memcpy(&v[0], s, sizeof(v[0]));
+    if (cn == 4) {
+        memcpy(&v[1], s + 4, sizeof(v[1]));
+    } else {
+        memcpy(&v[1], s + 2, sizeof(v[1]));
+        v[1] >>= 8;
+    }
+    return vmovl_u8(vreinterpret_u8_u32(vld1_u32(v)));
+}
+
+static inline void remap_linear_inside1(const uint8_t *s, int32_t inWidthStride, int32_t cn, int32_t idx, uint8_t *D)
+{
+    const int16_t *w = remap_tables().w_u8[idx];
+    uint16x8_t r0    = remap_load_pair_u8(s, cn);
+    uint16x8_t r1    = remap_load_pair_u8(s + inWidthStride, cn);
+    uint32x4_t sum   = vmull_n_u16(vget_low_u16(r0), (uint16_t)w[0]);
+    sum              = vmlal_n_u16(sum, vget_high_u16(r0), (uint16_t)w[1]);
+    sum              = vmlal_n_u16(sum, vget_low_u16(r1), (uint16_t)w[2]);
+    sum              = vmlal_n_u16(sum, vget_high_u16(r1), (uint16_t)w[3]);
+    uint16x4_t res16 = vrshrn_n_u32(sum, 10);
+    uint32_t res     = vget_lane_u32(vreinterpret_u32_u8(vmovn_u16(vcombine_u16(res16, res16))), 0);
+    memcpy(D, &res, cn);
+}
+
+static inline float32x4_t remap_load_right_f32(const float *s, int32_t cn)
+{
+    if (cn == 4) {
+        return vld1q_f32(s + 4);
+    }
+    float32x4_t v = vld1q_f32(s + 2);
+    return vextq_f32(v, v, 1);
+}
+
+static inline void remap_linear_inside1(const float *s, int32_t inWidthStride, int32_t cn, int32_t idx, float *D)
+{
+    const float *w  = remap_tables().w_f32[idx];
+    const float *s1 = s + inWidthStride;
+    float32x4_t res = vaddq_f32(vaddq_f32(vmulq_n_f32(vld1q_f32(s), w[0]), vmulq_n_f32(remap_load_right_f32(s, cn), w[1])),
+                                vaddq_f32(vmulq_n_f32(vld1q_f32(s1), w[2]), vmulq_n_f32(remap_load_right_f32(s1, cn), w[3])));
+    if (cn == 4) {
+        vst1q_f32(D, res);
+    } else {
+        vst1_f32(D, vget_low_f32(res));
+        vst1q_lane_f32(D + 2, res, 2);
+    }
+}
+
+template <typename T, int32_t channels>
+void RemapLinear(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t mapXYWidthStride,
+    const int16_t *mapXY,
+    int32_t mapFracWidthStride,
+    const uint16_t *mapFrac,
+    BorderType border_type,
+    T border_value)
+{
+    if (nullptr == inData || nullptr == outData || nullptr == mapXY || nullptr == mapFrac) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || outHeight <= 0 || outWidth <= 0) {
+        return;
+    }
+    if (border_type == BORDER_ISOLATED) {
+        return;
+    }
+    remap_tables();
+    // the whole 2x2 neighbourhood is inside for sx < inWidth - 1 and sy < inHeight - 1
+    const uint32x4_t v_w = vdupq_n_u32(inWidth - 1);
+    const uint32x4_t v_h = vdupq_n_u32(inHeight - 1);
+    int32_t ofs[4], idx[4];
+    for (int32_t y = 0; y < outHeight; ++y) {
+        const int16_t *XY = mapXY + y * mapXYWidthStride;
+        const uint16_t *F = mapFrac + y * mapFracWidthStride;
+        T *D = outData + y * outWidthStride;
+        int32_t x = 0;
+        for (; x <= outWidth - 4; x += 4) {
+            for (int32_t k = 0; k < 4; ++k) {
+                idx[k] = F[x + k] & (REMAP_INTER_TAB_SIZE2 - 1);
+            }
+            if (remap_offsets4(XY + x * 2, v_w, v_h, inWidthStride, channels, ofs)) {
+                if (channels == 1) {
+                    remap_linear_inside4_c1(inData, inWidthStride, ofs, idx, D + x);
+                } else {
+                    for (int32_t k = 0; k < 4; ++k) {
+                        remap_linear_inside1(inData + ofs[k], inWidthStride, channels, idx[k], D + (x + k) * channels);
+                    }
+                }
+            } else {
+                for (int32_t k = 0; k < 4; ++k) {
+                    remap_linear_pixel<T, channels>(inHeight, inWidth, inWidthStride, inData, XY[(x + k) * 2], XY[(x + k) * 2 + 1], idx[k], border_type, border_value, D + (x + k) * channels);
+                }
+            }
+        }
+        for (; x < outWidth; ++x) {
+            remap_linear_pixel<T, channels>(inHeight, inWidth, inWidthStride, inData, XY[x * 2], XY[x * 2 + 1], F[x] & (REMAP_INTER_TAB_SIZE2 - 1), border_type, border_value, D + x * channels);
+        }
+    }
+}
+
+template void RemapNearestPoint<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t mapXYWidthStride, const int16_t *mapXY, BorderType border_type, uint8_t border_value);
+template void RemapNearestPoint<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t mapXYWidthStride, const int16_t *mapXY, BorderType border_type, uint8_t border_value);
+template void RemapNearestPoint<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t mapXYWidthStride, const int16_t *mapXY, BorderType border_type, uint8_t border_value);
+template void RemapNearestPoint<float, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t mapXYWidthStride, const int16_t *mapXY, BorderType border_type, float border_value);
+template void RemapNearestPoint<float, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t mapXYWidthStride, const int16_t *mapXY, BorderType border_type, float border_value);
+template void RemapNearestPoint<float, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t mapXYWidthStride, const int16_t *mapXY, BorderType border_type, float border_value);
+
+template void RemapLinear<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t mapXYWidthStride, const int16_t *mapXY, int32_t mapFracWidthStride, const uint16_t *mapFrac, BorderType border_type, uint8_t border_value);
+template void RemapLinear<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t mapXYWidthStride, const int16_t *mapXY, int32_t mapFracWidthStride, const uint16_t *mapFrac, BorderType border_type, uint8_t border_value);
+template void RemapLinear<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t mapXYWidthStride, const int16_t *mapXY, int32_t mapFracWidthStride, const uint16_t *mapFrac, BorderType border_type, uint8_t border_value);
+template void RemapLinear<float, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t mapXYWidthStride, const int16_t *mapXY, int32_t mapFracWidthStride, const uint16_t *mapFrac, BorderType border_type, float border_value);
+template void RemapLinear<float, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t mapXYWidthStride, const int16_t *mapXY, int32_t mapFracWidthStride, const uint16_t *mapFrac, BorderType border_type, float border_value);
+template void RemapLinear<float, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t mapXYWidthStride, const int16_t *mapXY, int32_t mapFracWidthStride, const uint16_t *mapFrac, BorderType border_type, float border_value);
+} // namespace tinycv
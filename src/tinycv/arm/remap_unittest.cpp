@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/remap.h"
+#include "tinycv/arm/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <memory>
+#include <vector>
+
+// barrel distortion around the image centre, the corners map slightly outside the source image
+static void MakeUndistortMaps(int32_t height, int32_t width, float *mapX, float *mapY)
+{
+    float cx = 0.5f * width, cy = 0.5f * height;
+    float norm = 1.f / (cx * cx + cy * cy);
+    for (int32_t y = 0; y < height; ++y) {
+        for (int32_t x = 0; x < width; ++x) {
+            float dx = x - cx, dy = y - cy;
+            float k = 1.f + 0.12f * (dx * dx + dy * dy) * norm;
+            mapX[y * width + x] = cx + dx * k;
+            mapY[y * width + x] = cy + dy * k;
+        }
+    }
+}
+
+TEST(CONVERT_MAPS, arm)
+{
+    int32_t height = 101, width = 99;
+    std::vector<float> mapX(height * width), mapY(height * width);
+    MakeUndistortMaps(height, width, mapX.data(), mapY.data());
+    std::vector<int16_t> mapXY(height * width * 2);
+    std::vector<uint16_t> mapFrac(height * width);
+    tinycv::ConvertMaps(height, width, width, mapX.data(), width, mapY.data(), width * 2, mapXY.data(), width, mapFrac.data());
+
+    cv::Mat xMat(height, width, CV_32FC1, mapX.data());
+    cv::Mat yMat(height, width, CV_32FC1, mapY.data());
+    cv::Mat xyMat, fracMat;
+    cv::convertMaps(xMat, yMat, xyMat, fracMat, CV_16SC2, false);
+    checkResult<int16_t, 2>(mapXY.data(), xyMat.ptr<int16_t>(), height, width, width * 2, width * 2, 0.5f);
+    checkResult<uint16_t, 1>(mapFrac.data(), fracMat.ptr<uint16_t>(), height, width, width, width, 0.5f);
+
+    tinycv::ConvertMaps(height, width, width, mapX.data(), width, mapY.data(), width * 2, mapXY.data(), width, nullptr);
+    cv::convertMaps(xMat, yMat, xyMat, fracMat, CV_16SC2, true);
+    checkResult<int16_t, 2>(mapXY.data(), xyMat.ptr<int16_t>(), height, width, width * 2, width * 2, 0.5f);
+}
+
+template <typename T, int32_t nc>
+void RemapTest(int32_t height, int32_t width, int32_t interpolation, tinycv::BorderType border_type, float diff)
+{
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst_opencv(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    // BORDER_TRANSPARENT leaves pixels untouched, both outputs start from the same content
+    memcpy(dst.get(), src.get(), width * height * nc * sizeof(T));
+    memcpy(dst_opencv.get(), src.get(), width * height * nc * sizeof(T));
+
+    std::vector<float> mapX(height * width), mapY(height * width);
+    MakeUndistortMaps(height, width, mapX.data(), mapY.data());
+    std::vector<int16_t> mapXY(height * width * 2);
+    std::vector<uint16_t> mapFrac(height * width);
+    bool nearest = interpolation == cv::INTER_NEAREST;
+    tinycv::ConvertMaps(height, width, width, mapX.data(), width, mapY.data(), width * 2, mapXY.data(), width, nearest ? nullptr : mapFrac.data());
+
+    T border_value = 37;
+    if (nearest) {
+        tinycv::RemapNearestPoint<T, nc>(height, width, width * nc, src.get(), height, width, width * nc, dst.get(), width * 2, mapXY.data(), border_type, border_value);
+    } else {
+        tinycv::RemapLinear<T, nc>(height, width, width * nc, src.get(), height, width, width * nc, dst.get(), width * 2, mapXY.data(), width, mapFrac.data(), border_type, border_value);
+    }
+
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat oMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_opencv.get());
+    cv::Mat xyMat(height, width, CV_16SC2, mapXY.data());
+    cv::Mat fracMat = nearest ? cv::Mat() : cv::Mat(height, width, CV_16UC1, mapFrac.data());
+    cv::remap(iMat, oMat, xyMat, fracMat, interpolation, border_type, cv::Scalar::all(border_value));
+
+    checkResult<T, nc>(dst.get(), dst_opencv.get(), height, width, width * nc, width * nc, diff);
+}
+
+template <typename T, int32_t nc>
+void RemapAllBordersTest(int32_t height, int32_t width, int32_t interpolation, float diff)
+{
+    RemapTest<T, nc>(height, width, interpolation, tinycv::BORDER_CONSTANT, diff);
+    RemapTest<T, nc>(height, width, interpolation, tinycv::BORDER_REPLICATE, diff);
+    RemapTest<T, nc>(height, width, interpolation, tinycv::BORDER_REFLECT, diff);
+    RemapTest<T, nc>(height, width, interpolation, tinycv::BORDER_WRAP, diff);
+    RemapTest<T, nc>(height, width, interpolation, tinycv::BORDER_REFLECT_101, diff);
+}
+
+TEST(REMAP_NEAREST_UINT8, arm)
+{
+    RemapAllBordersTest<uint8_t, 1>(480, 640, cv::INTER_NEAREST, 0.5f);
+    RemapAllBordersTest<uint8_t, 3>(480, 640, cv::INTER_NEAREST, 0.5f);
+    RemapAllBordersTest<uint8_t, 4>(101, 99, cv::INTER_NEAREST, 0.5f);
+    RemapTest<uint8_t, 1>(101, 99, cv::INTER_NEAREST, tinycv::BORDER_TRANSPARENT, 0.5f);
+}
+
+TEST(REMAP_NEAREST_FP32, arm)
+{
+    RemapAllBordersTest<float, 1>(480, 640, cv::INTER_NEAREST, 1e-5f);
+    RemapAllBordersTest<float, 3>(101, 99, cv::INTER_NEAREST, 1e-5f);
+    RemapAllBordersTest<float, 4>(101, 99, cv::INTER_NEAREST, 1e-5f);
+    RemapTest<float, 4>(101, 99, cv::INTER_NEAREST, tinycv::BORDER_TRANSPARENT, 1e-5f);
+}
+
+TEST(REMAP_LINEAR_UINT8, arm)
+{
+    RemapAllBordersTest<uint8_t, 1>(480, 640, cv::INTER_LINEAR, 1.01f);
+    RemapAllBordersTest<uint8_t, 3>(480, 640, cv::INTER_LINEAR, 1.01f);
+    RemapAllBordersTest<uint8_t, 4>(101, 99, cv::INTER_LINEAR, 1.01f);
+}
+
+TEST(REMAP_LINEAR_FP32, arm)
+{
+    RemapAllBordersTest<float, 1>(480, 640, cv::INTER_LINEAR, 1e-3f);
+    RemapAllBordersTest<float, 3>(101, 99, cv::INTER_LINEAR, 1e-3f);
+    RemapAllBordersTest<float, 4>(101, 99, cv::INTER_LINEAR, 1e-3f);
+}
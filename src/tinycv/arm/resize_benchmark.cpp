@@ -18,6 +18,7 @@
 #include <benchmark/benchmark.h>
 
 #include "tinycv/resize.h"
+#include "tinycv/stream.h"
 #include "tinycv/debug.h"
 #include "tinycv/types.h"
 
@@ -32,6 +33,7 @@ public:
     int inHeight;
     int outWidth;
     int outHeight;
+    tinycv::StreamContext context;
     ResizeBenchmark(int inWidth, int inHeight, int outWidth, int outHeight)
         : inWidth(inWidth)
         , inHeight(inHeight)
@@ -96,6 +98,85 @@ public:
         }
     }
 
+    // kept out of apply() so types without a cubic kernel still build
+    void apply_cubic()
+    {
+        tinycv::ResizeCubic<T, channels>(this->inHeight,
+                                         this->inWidth,
+                                         this->inWidth * channels,
+                                         this->dev_iImage,
+                                         this->outHeight,
+                                         this->outWidth,
+                                         this->outWidth * channels,
+                                         this->dev_oImage);
+    }
+
+    void apply_cubic_opencv()
+    {
+        cv::Mat src_opencv(inHeight, inWidth, CV_MAKETYPE(cv::DataType<T>::depth, channels), dev_iImage);
+        cv::Mat dst_opencv(outHeight, outWidth, CV_MAKETYPE(cv::DataType<T>::depth, channels), dev_oImage);
+
+        cv::resize(src_opencv, dst_opencv, cv::Size(outWidth, outHeight), 0, 0, cv::INTER_CUBIC);
+    }
+
+    void apply_lanczos()
+    {
+        tinycv::ResizeLanczos<T, channels>(this->inHeight,
+                                           this->inWidth,
+                                           this->inWidth * channels,
+                                           this->dev_iImage,
+                                           this->outHeight,
+                                           this->outWidth,
+                                           this->outWidth * channels,
+                                           this->dev_oImage);
+    }
+
+    void apply_lanczos_opencv()
+    {
+        cv::Mat src_opencv(inHeight, inWidth, CV_MAKETYPE(cv::DataType<T>::depth, channels), dev_iImage);
+        cv::Mat dst_opencv(outHeight, outWidth, CV_MAKETYPE(cv::DataType<T>::depth, channels), dev_oImage);
+
+        cv::resize(src_opencv, dst_opencv, cv::Size(outWidth, outHeight), 0, 0, cv::INTER_LANCZOS4);
+    }
+
+    void apply_stream()
+    {
+        tinycv::ResizeLinear<T, channels>(this->context,
+                                          this->inHeight,
+                                          this->inWidth,
+                                          this->inWidth * channels,
+                                          this->dev_iImage,
+                                          this->outHeight,
+                                          this->outWidth,
+                                          this->outWidth * channels,
+                                          this->dev_oImage);
+    }
+
+    // the whole output in tiles of tileSize x tileSize, one region call each
+    void apply_region(int32_t tileSize)
+    {
+        double scaleY = tinycv::ResizeLinearScale(inHeight, outHeight);
+        double scaleX = tinycv::ResizeLinearScale(inWidth, outWidth);
+        for (int32_t y = 0; y < outHeight; y += tileSize) {
+            for (int32_t x = 0; x < outWidth; x += tileSize) {
+                tinycv::ResizeLinearRegion<T, channels>(this->inHeight,
+                                                        this->inWidth,
+                                                        this->inWidth * channels,
+                                                        this->dev_iImage,
+                                                        tileSize < outHeight - y ? tileSize : outHeight - y,
+                                                        tileSize < outWidth - x ? tileSize : outWidth - x,
+                                                        this->outWidth * channels,
+                                                        this->dev_oImage + y * outWidth * channels + x * channels,
+                                                        scaleY,
+                                                        scaleX,
+                                                        0.0,
+                                                        0.0,
+                                                        y,
+                                                        x);
+            }
+        }
+    }
+
     ~ResizeBenchmark()
     {
         free(this->dev_iImage);
@@ -125,6 +206,66 @@ static void BM_Resize_opencv_arm(benchmark::State& state)
     state.SetItemsProcessed(state.iterations());
 }
 
+template <typename T, int channels>
+static void BM_ResizeCubic_tinycv_arm(benchmark::State& state)
+{
+    ResizeBenchmark<T, channels, tinycv::INTERPOLATION_CUBIC> bm(state.range(0), state.range(1), state.range(2), state.range(3));
+    for (auto _ : state) {
+        bm.apply_cubic();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T, int channels>
+static void BM_ResizeCubic_opencv_arm(benchmark::State& state)
+{
+    ResizeBenchmark<T, channels, tinycv::INTERPOLATION_CUBIC> bm(state.range(0), state.range(1), state.range(2), state.range(3));
+    for (auto _ : state) {
+        bm.apply_cubic_opencv();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T, int channels>
+static void BM_ResizeLanczos_tinycv_arm(benchmark::State& state)
+{
+    ResizeBenchmark<T, channels, tinycv::INTERPOLATION_LINEAR> bm(state.range(0), state.range(1), state.range(2), state.range(3));
+    for (auto _ : state) {
+        bm.apply_lanczos();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T, int channels>
+static void BM_ResizeLanczos_opencv_arm(benchmark::State& state)
+{
+    ResizeBenchmark<T, channels, tinycv::INTERPOLATION_LINEAR> bm(state.range(0), state.range(1), state.range(2), state.range(3));
+    for (auto _ : state) {
+        bm.apply_lanczos_opencv();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T, int32_t channels>
+static void BM_ResizeLinearStream_tinycv_arm(benchmark::State& state)
+{
+    ResizeBenchmark<T, channels, tinycv::INTERPOLATION_LINEAR> bm(state.range(0), state.range(1), state.range(2), state.range(3));
+    for (auto _ : state) {
+        bm.apply_stream();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T, int32_t channels>
+static void BM_ResizeLinearRegion_tinycv_arm(benchmark::State& state)
+{
+    ResizeBenchmark<T, channels, tinycv::INTERPOLATION_LINEAR> bm(state.range(0), state.range(1), state.range(2), state.range(3));
+    for (auto _ : state) {
+        bm.apply_region(state.range(4));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
 using namespace tinycv::debug;
 using tinycv::INTERPOLATION_AREA;
 using tinycv::INTERPOLATION_LINEAR;
@@ -138,29 +279,29 @@ BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, uint8_t, c4, INTERPOLATION_LINEAR)->Arg
 BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, uint8_t, c4, INTERPOLATION_LINEAR)->Args({1080, 1920, 180, 320})->Args({1080, 1920, 270, 480});
 
 // tinycv
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
 // opencv
-BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
 // tinycv
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
 // opencv
-BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
 // tinycv
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c1, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c3, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c4, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c1, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c3, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, float, c4, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
 // opencv
-BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c1, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c3, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c4, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c1, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c3, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, float, c4, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
 
 BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, uint8_t, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
 BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, uint8_t, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
@@ -185,3 +326,79 @@ BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, uint8_t, c4, INTERPOLATION_AREA)->Args(
 BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, uint8_t, c1, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
 BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, uint8_t, c3, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
 BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, uint8_t, c4, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, uint16_t, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, uint16_t, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, uint16_t, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, uint16_t, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, uint16_t, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, uint16_t, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, uint16_t, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, uint16_t, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, uint16_t, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, uint16_t, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, uint16_t, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, uint16_t, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, uint16_t, c1, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, uint16_t, c3, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, uint16_t, c4, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, uint16_t, c1, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, uint16_t, c3, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_arm, uint16_t, c4, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, tinycv::half_t, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, tinycv::half_t, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, tinycv::half_t, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, tinycv::half_t, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, tinycv::half_t, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, tinycv::half_t, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, tinycv::half_t, c1, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, tinycv::half_t, c3, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_arm, tinycv::half_t, c4, INTERPOLATION_AREA)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+
+BENCHMARK_TEMPLATE(BM_ResizeCubic_tinycv_arm, uint8_t, c1)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_opencv_arm, uint8_t, c1)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_tinycv_arm, uint8_t, c3)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_opencv_arm, uint8_t, c3)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_tinycv_arm, uint8_t, c4)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_opencv_arm, uint8_t, c4)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_tinycv_arm, float, c1)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_opencv_arm, float, c1)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_tinycv_arm, float, c3)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_opencv_arm, float, c3)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_tinycv_arm, float, c4)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_opencv_arm, float, c4)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_tinycv_arm, uint8_t, c1)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_opencv_arm, uint8_t, c1)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_tinycv_arm, uint8_t, c3)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_opencv_arm, uint8_t, c3)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_tinycv_arm, uint8_t, c4)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_opencv_arm, uint8_t, c4)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_tinycv_arm, float, c1)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_opencv_arm, float, c1)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_tinycv_arm, float, c3)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_opencv_arm, float, c3)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_tinycv_arm, float, c4)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_opencv_arm, float, c4)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+
+BENCHMARK_TEMPLATE(BM_ResizeLinearRegion_tinycv_arm, uint8_t, c1)->Args({1920, 1080, 1280, 720, 64})->Args({1920, 1080, 1280, 720, 256})->Args({1920, 1080, 1280, 720, 4096})->Args({640, 480, 1280, 960, 128});
+BENCHMARK_TEMPLATE(BM_ResizeLinearRegion_tinycv_arm, uint8_t, c3)->Args({1920, 1080, 1280, 720, 64})->Args({1920, 1080, 1280, 720, 256})->Args({1920, 1080, 1280, 720, 4096})->Args({640, 480, 1280, 960, 128});
+BENCHMARK_TEMPLATE(BM_ResizeLinearRegion_tinycv_arm, uint8_t, c4)->Args({1920, 1080, 1280, 720, 64})->Args({1920, 1080, 1280, 720, 256})->Args({1920, 1080, 1280, 720, 4096})->Args({640, 480, 1280, 960, 128});
+BENCHMARK_TEMPLATE(BM_ResizeLinearRegion_tinycv_arm, float, c1)->Args({1920, 1080, 1280, 720, 64})->Args({1920, 1080, 1280, 720, 256})->Args({1920, 1080, 1280, 720, 4096})->Args({640, 480, 1280, 960, 128});
+BENCHMARK_TEMPLATE(BM_ResizeLinearRegion_tinycv_arm, float, c3)->Args({1920, 1080, 1280, 720, 64})->Args({1920, 1080, 1280, 720, 256})->Args({1920, 1080, 1280, 720, 4096})->Args({640, 480, 1280, 960, 128});
+BENCHMARK_TEMPLATE(BM_ResizeLinearRegion_tinycv_arm, float, c4)->Args({1920, 1080, 1280, 720, 64})->Args({1920, 1080, 1280, 720, 256})->Args({1920, 1080, 1280, 720, 4096})->Args({640, 480, 1280, 960, 128});
+
+BENCHMARK_TEMPLATE(BM_ResizeLinearStream_tinycv_arm, uint8_t, c1)->Args({320, 240, 640, 480})->Args({1280, 720, 800, 600})->Args({1920, 1080, 480, 270})->Args({1920, 1080, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeLinearStream_tinycv_arm, uint8_t, c3)->Args({320, 240, 640, 480})->Args({1280, 720, 800, 600})->Args({1920, 1080, 480, 270})->Args({1920, 1080, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeLinearStream_tinycv_arm, uint8_t, c4)->Args({320, 240, 640, 480})->Args({1280, 720, 800, 600})->Args({1920, 1080, 480, 270})->Args({1920, 1080, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeLinearStream_tinycv_arm, float, c1)->Args({320, 240, 640, 480})->Args({1280, 720, 800, 600})->Args({1920, 1080, 480, 270})->Args({1920, 1080, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeLinearStream_tinycv_arm, float, c3)->Args({320, 240, 640, 480})->Args({1280, 720, 800, 600})->Args({1920, 1080, 480, 270})->Args({1920, 1080, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeLinearStream_tinycv_arm, float, c4)->Args({320, 240, 640, 480})->Args({1280, 720, 800, 600})->Args({1920, 1080, 480, 270})->Args({1920, 1080, 1280, 720});
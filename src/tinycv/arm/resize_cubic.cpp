@@ -0,0 +1,404 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/resize.h"
+#include "tinycv/types.h"
+#include "tinycv/sys.h"
+
+#include <string.h>
+#include <limits.h>
+#include <stdint.h>
+#include <cmath>
+#include <algorithm>
+#include <arm_neon.h>
+
+namespace tinycv {
+
+#define INTER_RESIZE_COEF_BITS  (11)
+#define INTER_RESIZE_COEF_SCALE (1 << INTER_RESIZE_COEF_BITS)
+
+static inline int32_t resize_img_floor(float a)
+{
+    return (((a) >= 0) ? ((int32_t)a) : ((int32_t)a - 1));
+}
+
+static inline void resize_cubic_interpolate(float x, float *coeffs)
+{
+    const float A = -0.75f;
+
+    coeffs[0] = ((A * (x + 1) - 5 * A) * (x + 1) + 8 * A) * (x + 1) - 4 * A;
+    coeffs[1] = ((A + 2) * x - (A + 3)) * x * x + 1;
+    coeffs[2] = ((A + 2) * (1 - x) - (A + 3)) * (1 - x) * (1 - x) + 1;
+    coeffs[3] = 1.f - coeffs[0] - coeffs[1] - coeffs[2];
+}
+
+template <typename T>
+struct resize_cubic_traits;
+
+// u8 rows keep 11 bit weighted sums, the vertical pass removes both scales at once
+template <>
+struct resize_cubic_traits<uint8_t> {
+    typedef int16_t coeff_t;
+    typedef int32_t row_t;
+
+    static inline int16_t cast_coeff(float coeff)
+    {
+        int32_t iv = (int32_t)lrintf(coeff * INTER_RESIZE_COEF_SCALE);
+        return (int16_t)(iv > SHRT_MIN ? (iv < SHRT_MAX ? iv : SHRT_MAX) : SHRT_MIN);
+    }
+    static inline uint8_t cast_dst(int32_t value)
+    {
+        value = (value + (1 << (INTER_RESIZE_COEF_BITS * 2 - 1))) >> (INTER_RESIZE_COEF_BITS * 2);
+        return (uint8_t)(value > 255 ? 255 : (value < 0 ? 0 : value));
+    }
+};
+
+template <>
+struct resize_cubic_traits<float> {
+    typedef float coeff_t;
+    typedef float row_t;
+
+    static inline float cast_coeff(float coeff)
+    {
+        return coeff;
+    }
+    static inline float cast_dst(float value)
+    {
+        return value;
+    }
+};
+
+// ofs[i] is the source index of the second tap, taps out of [0, inSize) are clamped when used.
+// The weights are repeated for every channel and stored tap by tap, `coeff[k * outSize * channels + i * channels + c]`.
+// Returns the first output index whose taps do not start before the image.
+template <typename T>
+static int32_t resize_cubic_calc_offset(
+    int32_t inSize,
+    int32_t outSize,
+    int32_t channels,
+    int32_t *ofs,
+    typename resize_cubic_traits<T>::coeff_t *coeff)
+{
+    double inv_scale = (double)outSize / inSize;
+    double scale = 1.0 / inv_scale;
+    int32_t coeff_stride = outSize * channels;
+
+    int32_t first_inner = outSize;
+    for (int32_t i = outSize - 1; i >= 0; --i) {
+        float float_i = (float)((i + 0.5) * scale - 0.5);
+        int32_t int_i = resize_img_floor(float_i);
+        float_i -= int_i;
+
+        float cbuf[4];
+        resize_cubic_interpolate(float_i, cbuf);
+        ofs[i] = int_i;
+        for (int32_t k = 0; k < 4; ++k) {
+            for (int32_t c = 0; c < channels; ++c) {
+                coeff[k * coeff_stride + i * channels + c] = resize_cubic_traits<T>::cast_coeff(cbuf[k]);
+            }
+        }
+        if (int_i >= 1) {
+            first_inner = i;
+        }
+    }
+    return first_inner;
+}
+
+template <typename T>
+static void resize_cubic_w_oneline(
+    const T *src,
+    int32_t inWidth,
+    int32_t channels,
+    const int32_t *x_sx,
+    const typename resize_cubic_traits<T>::coeff_t *x_coeff,
+    int32_t n,
+    int32_t begin,
+    int32_t end,
+    typename resize_cubic_traits<T>::row_t *row)
+{
+    typedef typename resize_cubic_traits<T>::row_t row_t;
+    for (int32_t i = begin; i < end; ++i) {
+        int32_t w = i / channels;
+        int32_t c = i - w * channels;
+        row_t value = 0;
+        for (int32_t k = 0; k < 4; ++k) {
+            int32_t sx = std::min(std::max(x_sx[w] + k - 1, 0), inWidth - 1);
+            value += (row_t)src[sx * channels + c] * x_coeff[k * n + i];
+        }
+        row[i] = value;
+    }
+}
+
+
+static inline bool resize_cubic_w_inner(int32_t sx, int32_t channels, int32_t load_len, int32_t src_len)
+{
+    return sx >= 1 && (sx - 1) * channels + load_len <= src_len;
+}
+
+// one output pixel per step, row needs room for one extra element when channels is 3
+static void resize_cubic_w_neon(
+    const uint8_t *src,
+    int32_t inWidth,
+    int32_t channels,
+    const int32_t *x_sx,
+    const int16_t *x_coeff,
+    int32_t outWidth,
+    int32_t *row)
+{
+    int32_t n = outWidth * channels;
+    int32_t src_len = inWidth * channels;
+    int32_t load_len = channels == 1 ? 8 : 16;
+    for (int32_t w = 0; w < outWidth; ++w) {
+        int32_t sx = x_sx[w];
+        int32_t i = w * channels;
+        if (!resize_cubic_w_inner(sx, channels, load_len, src_len)) {
+            resize_cubic_w_oneline(src, inWidth, channels, x_sx, x_coeff, n, i, i + channels, row);
+            continue;
+        }
+        const uint8_t *ptr = src + (sx - 1) * channels;
+        if (channels == 1) {
+            int16x4_t v_src = vget_low_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(ptr))));
+            int16x4_t v_coeff = {x_coeff[i], x_coeff[n + i], x_coeff[2 * n + i], x_coeff[3 * n + i]};
+            row[i] = vaddvq_s32(vmull_s16(v_src, v_coeff));
+        } else {
+            int16x8_t v_lo = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(ptr)));
+            int16x8_t v_hi = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(ptr + 8)));
+            int16x4_t v_tap[4];
+            if (channels == 4) {
+                v_tap[0] = vget_low_s16(v_lo);
+                v_tap[1] = vget_high_s16(v_lo);
+                v_tap[2] = vget_low_s16(v_hi);
+                v_tap[3] = vget_high_s16(v_hi);
+            } else {
+                v_tap[0] = vget_low_s16(v_lo);
+                v_tap[1] = vget_low_s16(vextq_s16(v_lo, v_hi, 3));
+                v_tap[2] = vget_low_s16(vextq_s16(v_lo, v_hi, 6));
+                v_tap[3] = vget_low_s16(vextq_s16(v_hi, v_hi, 1));
+            }
+            int32x4_t v_sum = vmull_n_s16(v_tap[0], x_coeff[i]);
+            v_sum = vmlal_n_s16(v_sum, v_tap[1], x_coeff[n + i]);
+            v_sum = vmlal_n_s16(v_sum, v_tap[2], x_coeff[2 * n + i]);
+            v_sum = vmlal_n_s16(v_sum, v_tap[3], x_coeff[3 * n + i]);
+            vst1q_s32(row + i, v_sum);
+        }
+    }
+}
+
+static void resize_cubic_w_neon(
+    const float *src,
+    int32_t inWidth,
+    int32_t channels,
+    const int32_t *x_sx,
+    const float *x_coeff,
+    int32_t outWidth,
+    float *row)
+{
+    int32_t n = outWidth * channels;
+    int32_t src_len = inWidth * channels;
+    int32_t load_len = channels == 1 ? 4 : channels * 3 + 4;
+    for (int32_t w = 0; w < outWidth; ++w) {
+        int32_t sx = x_sx[w];
+        int32_t i = w * channels;
+        if (!resize_cubic_w_inner(sx, channels, load_len, src_len)) {
+            resize_cubic_w_oneline(src, inWidth, channels, x_sx, x_coeff, n, i, i + channels, row);
+            continue;
+        }
+        const float *ptr = src + (sx - 1) * channels;
+        if (channels == 1) {
+            float32x4_t v_coeff = {x_coeff[i], x_coeff[n + i], x_coeff[2 * n + i], x_coeff[3 * n + i]};
+            row[i] = vaddvq_f32(vmulq_f32(vld1q_f32(ptr), v_coeff));
+        } else {
+            float32x4_t v_sum = vmulq_n_f32(vld1q_f32(ptr), x_coeff[i]);
+            v_sum = vfmaq_n_f32(v_sum, vld1q_f32(ptr + channels), x_coeff[n + i]);
+            v_sum = vfmaq_n_f32(v_sum, vld1q_f32(ptr + 2 * channels), x_coeff[2 * n + i]);
+            v_sum = vfmaq_n_f32(v_sum, vld1q_f32(ptr + 3 * channels), x_coeff[3 * n + i]);
+            vst1q_f32(row + i, v_sum);
+        }
+    }
+}
+
+static void resize_cubic_h(const int32_t *const *rows, const int16_t *y_coeff, int32_t n, uint8_t *dst)
+{
+    int32_t i = 0;
+    for (; i <= n - 8; i += 8) {
+        int32x4_t v_lo = vdupq_n_s32(1 << (INTER_RESIZE_COEF_BITS * 2 - 1));
+        int32x4_t v_hi = v_lo;
+        for (int32_t k = 0; k < 4; ++k) {
+            v_lo = vmlaq_n_s32(v_lo, vld1q_s32(rows[k] + i), y_coeff[k]);
+            v_hi = vmlaq_n_s32(v_hi, vld1q_s32(rows[k] + i + 4), y_coeff[k]);
+        }
+        int16x8_t v_dst = vcombine_s16(vqmovn_s32(vshrq_n_s32(v_lo, INTER_RESIZE_COEF_BITS * 2)), vqmovn_s32(vshrq_n_s32(v_hi, INTER_RESIZE_COEF_BITS * 2)));
+        vst1_u8(dst + i, vqmovun_s16(v_dst));
+    }
+    for (; i < n; ++i) {
+        int32_t value = rows[0][i] * y_coeff[0] + rows[1][i] * y_coeff[1] + rows[2][i] * y_coeff[2] + rows[3][i] * y_coeff[3];
+        dst[i] = resize_cubic_traits<uint8_t>::cast_dst(value);
+    }
+}
+
+static void resize_cubic_h(const float *const *rows, const float *y_coeff, int32_t n, float *dst)
+{
+    int32_t i = 0;
+    for (; i <= n - 4; i += 4) {
+        float32x4_t v_dst = vmulq_n_f32(vld1q_f32(rows[0] + i), y_coeff[0]);
+        v_dst = vfmaq_n_f32(v_dst, vld1q_f32(rows[1] + i), y_coeff[1]);
+        v_dst = vfmaq_n_f32(v_dst, vld1q_f32(rows[2] + i), y_coeff[2]);
+        v_dst = vfmaq_n_f32(v_dst, vld1q_f32(rows[3] + i), y_coeff[3]);
+        vst1q_f32(dst + i, v_dst);
+    }
+    for (; i < n; ++i) {
+        dst[i] = rows[0][i] * y_coeff[0] + rows[1][i] * y_coeff[1] + rows[2][i] * y_coeff[2] + rows[3][i] * y_coeff[3];
+    }
+}
+
+template <typename T>
+static void resize_cubic_kernel(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t channels,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData)
+{
+    typedef typename resize_cubic_traits<T>::coeff_t coeff_t;
+    typedef typename resize_cubic_traits<T>::row_t row_t;
+
+    int32_t cn_width = channels * outWidth;
+    uint64_t size_for_x_sx = (outWidth * sizeof(int32_t) + 128 - 1) / 128 * 128;
+    uint64_t size_for_x_coeff = (cn_width * sizeof(coeff_t) * 4 + 128 - 1) / 128 * 128;
+    uint64_t size_for_y_sy = (outHeight * sizeof(int32_t) + 128 - 1) / 128 * 128;
+    uint64_t size_for_y_coeff = (outHeight * sizeof(coeff_t) * 4 + 128 - 1) / 128 * 128;
+    uint64_t size_for_row = ((cn_width + 1) * sizeof(row_t) + 128 - 1) / 128 * 128;
+
+    uint64_t total_size = size_for_x_sx + size_for_x_coeff + size_for_y_sy + size_for_y_coeff + size_for_row * 4;
+
+    void *temp_buffer = tinycv::ScratchAlloc(total_size, 128);
+    int32_t *x_sx = (int32_t *)temp_buffer;
+    coeff_t *x_coeff = (coeff_t *)((unsigned char *)x_sx + size_for_x_sx);
+    int32_t *y_sy = (int32_t *)((unsigned char *)x_coeff + size_for_x_coeff);
+    coeff_t *y_coeff = (coeff_t *)((unsigned char *)y_sy + size_for_y_sy);
+    row_t *row_buffer[4];
+    row_buffer[0] = (row_t *)((unsigned char *)y_coeff + size_for_y_coeff);
+    for (int32_t k = 1; k < 4; ++k) {
+        row_buffer[k] = (row_t *)((unsigned char *)row_buffer[k - 1] + size_for_row);
+    }
+
+    // x coefficients are expanded per element
+    resize_cubic_calc_offset<T>(inWidth, outWidth, channels, x_sx, x_coeff);
+    resize_cubic_calc_offset<T>(inHeight, outHeight, 1, y_sy, y_coeff);
+
+    // a rolling set of 4 horizontally resized rows, each tagged with its source row
+    int32_t buffer_h[4] = {-1, -1, -1, -1};
+    for (int32_t h = 0; h < outHeight; ++h) {
+        const row_t *rows[4];
+        bool used[4] = {false, false, false, false};
+        int32_t src_h[4];
+        for (int32_t k = 0; k < 4; ++k) {
+            src_h[k] = std::min(std::max(y_sy[h] + k - 1, 0), inHeight - 1);
+            rows[k] = nullptr;
+            for (int32_t j = 0; j < 4; ++j) {
+                if (buffer_h[j] == src_h[k]) {
+                    rows[k] = row_buffer[j];
+                    used[j] = true;
+                    break;
+                }
+            }
+        }
+        for (int32_t k = 0; k < 4; ++k) {
+            if (rows[k] != nullptr) {
+                continue;
+            }
+            int32_t j = 0;
+            while (used[j]) {
+                ++j;
+            }
+            const T *src = inData + src_h[k] * inWidthStride;
+            row_t *row = row_buffer[j];
+            resize_cubic_w_neon(src, inWidth, channels, x_sx, x_coeff, outWidth, row);
+            buffer_h[j] = src_h[k];
+            used[j] = true;
+            // later taps of this output row may read the same source row
+            for (int32_t m = k; m < 4; ++m) {
+                if (src_h[m] == src_h[k]) {
+                    rows[m] = row;
+                }
+            }
+        }
+        coeff_t h_coeff[4] = {y_coeff[h], y_coeff[outHeight + h], y_coeff[2 * outHeight + h], y_coeff[3 * outHeight + h]};
+        resize_cubic_h(rows, h_coeff, cn_width, outData + h * outWidthStride);
+    }
+    tinycv::ScratchFree(temp_buffer);
+}
+
+template <>
+void ResizeCubic<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    resize_cubic_kernel(inHeight, inWidth, inWidthStride, inData, 1, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeCubic<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    resize_cubic_kernel(inHeight, inWidth, inWidthStride, inData, 3, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeCubic<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    resize_cubic_kernel(inHeight, inWidth, inWidthStride, inData, 4, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeCubic<float, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    resize_cubic_kernel(inHeight, inWidth, inWidthStride, inData, 1, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeCubic<float, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    resize_cubic_kernel(inHeight, inWidth, inWidthStride, inData, 3, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeCubic<float, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    resize_cubic_kernel(inHeight, inWidth, inWidthStride, inData, 4, outHeight, outWidth, outWidthStride, outData);
+}
+
+} // namespace tinycv
@@ -16,7 +16,9 @@
 // under the License.
 
 #include "tinycv/resize.h"
+#include "tinycv/stream.h"
 #include "tinycv/types.h"
+#include "tinycv/sys.h"
 #include "operation_utils.hpp"
 
 #include <stdio.h>
@@ -42,7 +44,7 @@ void resizeNearestPoint(
     Tdst* outData)
 {
     int32_t x, y;
-    int32_t* x_ofs = (int32_t*)malloc(outWidth * sizeof(int32_t));
+    int32_t* x_ofs = (int32_t*)tinycv::ScratchAlloc(outWidth * sizeof(int32_t), 128);
     double fx = (double)outWidth / inWidth;
     double fy = (double)outHeight / inHeight;
     double ifx = 1. / fx;
@@ -63,7 +65,7 @@ void resizeNearestPoint(
             }
         }
     }
-    free(x_ofs);
+    tinycv::ScratchFree(x_ofs);
 }
 
 template <>
@@ -78,7 +80,7 @@ void resizeNearestPoint<float, float, 1>(
     float* outData) // resize_nereast_f32c1
 {
     int32_t x, y;
-    int32_t* x_ofs = (int32_t*)malloc(outWidth * sizeof(int32_t));
+    int32_t* x_ofs = (int32_t*)tinycv::ScratchAlloc(outWidth * sizeof(int32_t), 128);
     double fx = (double)outWidth / inWidth;
     double fy = (double)outHeight / inHeight;
     double ifx = 1.0f / fx;
@@ -103,7 +105,7 @@ void resizeNearestPoint<float, float, 1>(
             D[x] = S[x0];
         }
     }
-    free(x_ofs);
+    tinycv::ScratchFree(x_ofs);
 }
 
 template <>
@@ -118,7 +120,7 @@ void resizeNearestPoint<float, float, 3>(
     float* outData) // resize_nereast_f32c3
 {
     int32_t x, y;
-    int32_t* x_ofs = (int32_t*)malloc(outWidth * sizeof(int32_t));
+    int32_t* x_ofs = (int32_t*)tinycv::ScratchAlloc(outWidth * sizeof(int32_t), 128);
     double fx = (double)outWidth / inWidth;
     double fy = (double)outHeight / inHeight;
     double ifx = 1.0f / fx;
@@ -149,7 +151,7 @@ void resizeNearestPoint<float, float, 3>(
             D[xd + 0] = S[x0], D[xd + 1] = S[x0 + 1], D[xd + 2] = S[x0 + 2];
         }
     }
-    free(x_ofs);
+    tinycv::ScratchFree(x_ofs);
 }
 
 template <>
@@ -164,7 +166,7 @@ void resizeNearestPoint<float, float, 4>(
     float* outData) // resize_nereast_f32c4
 {
     int32_t x, y;
-    int32_t* x_ofs = (int32_t*)malloc(outWidth * sizeof(int32_t));
+    int32_t* x_ofs = (int32_t*)tinycv::ScratchAlloc(outWidth * sizeof(int32_t), 128);
     double fx = (double)outWidth / inWidth;
     double fy = (double)outHeight / inHeight;
     double ifx = 1.0f / fx;
@@ -200,7 +202,7 @@ void resizeNearestPoint<float, float, 4>(
             vst1q_f32(D + xd, v);
         }
     }
-    free(x_ofs);
+    tinycv::ScratchFree(x_ofs);
 }
 
 static void img_resize_cal_offset_linear_f32(
@@ -216,14 +218,15 @@ static void img_resize_cal_offset_linear_f32(
     int32_t srch,
     int32_t dstw,
     int32_t dsth,
-    int32_t channels)
+    int32_t channels,
+    double scale_x,
+    double scale_y,
+    double origin_x,
+    double origin_y,
+    int32_t out_x,
+    int32_t out_y)
 {
-    float inv_scale_x = (float)dstw / srcw;
-    float inv_scale_y = (float)dsth / srch;
-
     int32_t cn = channels;
-    float scale_x = 1. / inv_scale_x;
-    float scale_y = 1. / inv_scale_y;
     int32_t k, sx, sy, dx, dy;
 
     float fx, fy;
@@ -231,7 +234,7 @@ static void img_resize_cal_offset_linear_f32(
     float cbuf[MAX_ESIZE];
 
     for (dx = 0; dx < dstw; dx++) {
-        fx = (float)((dx + 0.5) * scale_x - 0.5);
+        fx = (float)((out_x + dx + 0.5) * scale_x - 0.5 + origin_x);
         sx = img_floor(fx);
         fx -= sx;
 
@@ -260,7 +263,7 @@ static void img_resize_cal_offset_linear_f32(
     }
 
     for (dy = 0; dy < dsth; dy++) {
-        fy = (float)((dy + 0.5) * scale_y - 0.5);
+        fy = (float)((out_y + dy + 0.5) * scale_y - 0.5 + origin_y);
         sy = img_floor(fy);
         fy -= sy;
 
@@ -450,9 +453,11 @@ void img_vresize_linear_neon_f32(
         vst1q_f32(dst + x + 12, qT3);
     }
 
+    // same order as vmulq + vmlaq, so a column rounds alike in the body and in the tail
     float b0 = beta[0], b1 = beta[1];
     for (; x < width; x++) {
-        dst[x] = b0 * S0[x] + b1 * S1[x];
+        float t = S0[x] * b0;
+        dst[x] = t + S1[x] * b1;
     }
 }
 
@@ -472,7 +477,8 @@ static void img_resize_generic_linear_neon_f32(
     int32_t dstw,
     int32_t dsth,
     int32_t dststep,
-    int32_t channels)
+    int32_t channels,
+    float* row_buffer)
 {
     const float* alpha = _alpha;
     const float* beta = _beta;
@@ -484,7 +490,7 @@ static void img_resize_generic_linear_neon_f32(
     // int32_t dststep = (int32_t) align_size (dstw, 4);
     // int32_t dststep = dstw;
 
-    float* buffer_ = (float*)malloc(bufstep * ksize * sizeof(float));
+    float* buffer_ = row_buffer ? row_buffer : (float*)tinycv::ScratchAlloc(bufstep * ksize * sizeof(float), 128);
 
     const float* srows[MAX_ESIZE];
     float* rows[MAX_ESIZE];
@@ -529,7 +535,9 @@ static void img_resize_generic_linear_neon_f32(
         img_vresize_linear_neon_f32((const float**)rows, (float*)(dst + dststep * dy), beta, dstw);
     }
 
-    free(buffer_);
+    if (!row_buffer) {
+        tinycv::ScratchFree(buffer_);
+    }
     buffer_ = NULL;
 }
 
@@ -571,8 +579,34 @@ bool img_resize_bilinear_neon_shrink2_f32(
             }
             for (; j < dstw; j++) {
                 dst[i * dst_stride + j] = (row1[j * 2 + 0] + row1[j * 2 + 1] +
-                                           row2[j * 2 + 0] + row2[j * 2 + 1] + 2) *
-                                          0.25;
+                                           row2[j * 2 + 0] + row2[j * 2 + 1]) *
+                                          0.25f;
+            }
+        }
+    } else if (cn == 3) {
+        for (int32_t i = 0; i < dsth; i++) {
+            const float* row1 = src + (2 * i) * src_stride;
+            const float* row2 = src + (2 * i + 1) * src_stride;
+            int32_t j = 0;
+            for (; j <= dstw - 4; j += 4) {
+                float32x4x3_t q0 = vld3q_f32(row1 + j * 6);
+                float32x4x3_t q1 = vld3q_f32(row1 + j * 6 + 12);
+                float32x4x3_t q2 = vld3q_f32(row2 + j * 6);
+                float32x4x3_t q3 = vld3q_f32(row2 + j * 6 + 12);
+                prefetch_l1(row1, j * 6 + 256);
+                prefetch_l1(row2, j * 6 + 256);
+                float32x4x3_t res;
+                for (int32_t c = 0; c < 3; c++) {
+                    res.val[c] = vmulq_f32(vaddq_f32(vpaddq_f32(q0.val[c], q1.val[c]), vpaddq_f32(q2.val[c], q3.val[c])), vdupq_n_f32(0.25f));
+                }
+                vst3q_f32(dst + i * dst_stride + j * 3, res);
+            }
+            for (; j < dstw; j++) {
+                for (int32_t c = 0; c < cn; c++) {
+                    dst[i * dst_stride + j * cn + c] = (row1[j * 2 * cn + c] + row1[j * 2 * cn + cn + c] +
+                                                        row2[j * 2 * cn + c] + row2[j * 2 * cn + cn + c]) *
+                                                       0.25f;
+                }
             }
         }
     } else if (cn == 4) {
@@ -599,8 +633,8 @@ bool img_resize_bilinear_neon_shrink2_f32(
             for (; j < dstw; j++) {
                 for (int32_t c = 0; c < cn; c++) {
                     dst[i * dst_stride + j * cn + c] = (row1[j * 2 * cn + c] + row1[j * 2 * cn + cn + c] +
-                                                        row2[j * 2 * cn + c] + row2[j * 2 * cn + cn + c] + 2) *
-                                                       0.25;
+                                                        row2[j * 2 * cn + c] + row2[j * 2 * cn + cn + c]) *
+                                                       0.25f;
                 }
             }
         }
@@ -608,6 +642,62 @@ bool img_resize_bilinear_neon_shrink2_f32(
     return true;
 }
 
+// At exactly 1/4 the bilinear sample points fall halfway between source pixels 4x+1 and 4x+2,
+// so every output is the mean of a 2x2 block at offset (1, 1).
+static void img_resize_bilinear_neon_shrink4_f32(
+    float* dst,
+    int32_t dst_width,
+    int32_t dst_height,
+    int32_t dst_stride,
+    const float* src,
+    int32_t src_stride,
+    int32_t channels)
+{
+    int32_t dstw = dst_width;
+    int32_t cn = channels;
+    float32x4_t v_p25 = vdupq_n_f32(0.25f);
+    for (int32_t i = 0; i < dst_height; i++) {
+        const float* row1 = src + (4 * i + 1) * src_stride;
+        const float* row2 = src + (4 * i + 2) * src_stride;
+        float* D = dst + i * dst_stride;
+        int32_t j = 0;
+        if (cn == 1) {
+            for (; j <= dstw - 4; j += 4) {
+                float32x4x4_t q0 = vld4q_f32(row1 + j * 4);
+                float32x4x4_t q1 = vld4q_f32(row2 + j * 4);
+                prefetch_l1(row1, j * 4 + 256);
+                prefetch_l1(row2, j * 4 + 256);
+                float32x4_t res = vaddq_f32(vaddq_f32(q0.val[1], q0.val[2]), vaddq_f32(q1.val[1], q1.val[2]));
+                vst1q_f32(D + j, vmulq_f32(res, v_p25));
+            }
+        } else if (cn == 3) {
+            // the fourth lane spills into the next output pixel and is overwritten by it
+            for (; j < dstw - 1; j++) {
+                float32x4_t q0 = vld1q_f32(row1 + j * 12 + 3);
+                float32x4_t q1 = vld1q_f32(row1 + j * 12 + 6);
+                float32x4_t q2 = vld1q_f32(row2 + j * 12 + 3);
+                float32x4_t q3 = vld1q_f32(row2 + j * 12 + 6);
+                vst1q_f32(D + j * 3, vmulq_f32(vaddq_f32(vaddq_f32(q0, q1), vaddq_f32(q2, q3)), v_p25));
+            }
+        } else if (cn == 4) {
+            for (; j < dstw; j++) {
+                float32x4_t q0 = vld1q_f32(row1 + j * 16 + 4);
+                float32x4_t q1 = vld1q_f32(row1 + j * 16 + 8);
+                float32x4_t q2 = vld1q_f32(row2 + j * 16 + 4);
+                float32x4_t q3 = vld1q_f32(row2 + j * 16 + 8);
+                vst1q_f32(D + j * 4, vmulq_f32(vaddq_f32(vaddq_f32(q0, q1), vaddq_f32(q2, q3)), v_p25));
+            }
+        }
+        for (; j < dstw; j++) {
+            for (int32_t c = 0; c < cn; c++) {
+                D[j * cn + c] = (row1[(j * 4 + 1) * cn + c] + row1[(j * 4 + 2) * cn + c] +
+                                 row2[(j * 4 + 1) * cn + c] + row2[(j * 4 + 2) * cn + c]) *
+                                0.25f;
+            }
+        }
+    }
+}
+
 void img_resize_bilinear_neon_f32(
     float* dst,
     uint32_t dst_width,
@@ -617,13 +707,19 @@ void img_resize_bilinear_neon_f32(
     uint32_t src_width,
     uint32_t src_height,
     uint32_t src_stride,
-    uint32_t channels)
+    uint32_t channels,
+    StreamContext* context = nullptr)
 {
     if (src_width % 2 == 0 && dst_width == src_width / 2 &&
-        src_height % 2 == 0 && dst_height == src_height / 2 && (channels == 1 || channels == 4)) {
+        src_height % 2 == 0 && dst_height == src_height / 2) {
         img_resize_bilinear_neon_shrink2_f32(dst, dst_width, dst_height, dst_stride, src, src_width, src_height, src_stride, channels);
         return;
     }
+    if (src_width % 4 == 0 && dst_width == src_width / 4 &&
+        src_height % 4 == 0 && dst_height == src_height / 4) {
+        img_resize_bilinear_neon_shrink4_f32(dst, dst_width, dst_height, dst_stride, src, src_stride, channels);
+        return;
+    }
     int32_t dstw = dst_width;
     int32_t dsth = dst_height;
     int32_t srcw = src_width;
@@ -632,8 +728,6 @@ void img_resize_bilinear_neon_f32(
     int32_t cn = channels; // 4;
     // int32_t src_stride = srcw * cn;
 
-    int32_t xmin = 0;
-    int32_t xmax = dstw;
     int32_t width = dstw * cn;
     // float fx, fy;
 
@@ -641,21 +735,288 @@ void img_resize_bilinear_neon_f32(
     ksize = 2;
     ksize2 = ksize / 2;
 
-    uint8_t* buffer_ = (uint8_t*)malloc((width + dsth) * (sizeof(int32_t) + sizeof(float) * ksize));
+    // xmin and xmax are kept in front of the tables so a context can hand all of them back
+    uint64_t size_for_range = 128;
+    uint64_t size_for_tables = align_size((width + dsth) * (sizeof(int32_t) + sizeof(float) * ksize), 128);
+    uint64_t size_for_rows = align_size(width, 16) * ksize * sizeof(float);
+
+    uint8_t* buffer_ = nullptr;
+    bool tables_ready = false;
+    if (context) {
+        // only ResizeLinear passes a context, its mapping follows from the sizes
+        const int32_t key[] = {srch, srcw, cn, dsth, dstw};
+        buffer_ = (uint8_t*)context->Tables("resize_linear_f32", key, 5, size_for_range + size_for_tables + size_for_rows, &tables_ready);
+    } else {
+        buffer_ = (uint8_t*)tinycv::ScratchAlloc(size_for_range + size_for_tables, 128);
+    }
+    if (nullptr == buffer_) {
+        return;
+    }
 
-    int32_t* xofs = (int32_t*)buffer_;
+    int32_t* range = (int32_t*)buffer_;
+    int32_t* xofs = (int32_t*)(buffer_ + size_for_range);
     int32_t* yofs = xofs + width;
     float* ialpha = (float*)(yofs + dsth);
     float* ibeta = ialpha + width * ksize;
+    float* rows = context ? (float*)(buffer_ + size_for_range + size_for_tables) : nullptr;
+
+    if (!tables_ready) {
+        range[0] = 0;
+        range[1] = dstw;
+        float scale_x = 1. / ((float)dstw / srcw);
+        float scale_y = 1. / ((float)dsth / srch);
+        img_resize_cal_offset_linear_f32(xofs, ialpha, yofs, ibeta, &range[0], &range[1], ksize, ksize2, srcw, srch, dstw, dsth, cn, scale_x, scale_y, 0.0, 0.0, 0, 0);
+    }
 
-    img_resize_cal_offset_linear_f32(xofs, ialpha, yofs, ibeta, &xmin, &xmax, ksize, ksize2, srcw, srch, dstw, dsth, cn);
-
-    img_resize_generic_linear_neon_f32(src, dst, xofs, ialpha, yofs, ibeta, xmin, xmax, ksize, srcw, srch, src_stride, dstw, dsth, dst_stride, cn);
+    img_resize_generic_linear_neon_f32(src, dst, xofs, ialpha, yofs, ibeta, range[0], range[1], ksize, srcw, srch, src_stride, dstw, dsth, dst_stride, cn, rows);
 
-    free(buffer_);
+    if (!context) {
+        tinycv::ScratchFree(buffer_);
+    }
     buffer_ = NULL;
 }
 
+static void img_resize_cal_offset_area_f32(
+    int32_t* xofs,
+    float* ialpha,
+    int32_t* yofs,
+    float* ibeta,
+    int32_t* xmin,
+    int32_t* xmax,
+    int32_t ksize,
+    int32_t ksize2,
+    int32_t srcw,
+    int32_t srch,
+    int32_t dstw,
+    int32_t dsth,
+    int32_t channels);
+
+static void img_cvt_row_to_f32(const half_t* src, float* dst, int32_t length)
+{
+    const uint16_t* S = reinterpret_cast<const uint16_t*>(src);
+    int32_t x = 0;
+    for (; x <= length - 8; x += 8) {
+        uint16x8_t v = vld1q_u16(S + x);
+        vst1q_f32(dst + x, vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(v))));
+        vst1q_f32(dst + x + 4, vcvt_f32_f16(vreinterpret_f16_u16(vget_high_u16(v))));
+    }
+    for (; x < length; x++) {
+        dst[x] = src[x];
+    }
+}
+
+static void img_cvt_row_to_f32(const uint16_t* src, float* dst, int32_t length)
+{
+    int32_t x = 0;
+    for (; x <= length - 8; x += 8) {
+        uint16x8_t v = vld1q_u16(src + x);
+        vst1q_f32(dst + x, vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))));
+        vst1q_f32(dst + x + 4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))));
+    }
+    for (; x < length; x++) {
+        dst[x] = src[x];
+    }
+}
+
+static void img_cvt_row_to_f32(const int16_t* src, float* dst, int32_t length)
+{
+    int32_t x = 0;
+    for (; x <= length - 8; x += 8) {
+        int16x8_t v = vld1q_s16(src + x);
+        vst1q_f32(dst + x, vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))));
+        vst1q_f32(dst + x + 4, vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))));
+    }
+    for (; x < length; x++) {
+        dst[x] = src[x];
+    }
+}
+
+static void img_cvt_row_from_f32(const float* src, half_t* dst, int32_t length)
+{
+    uint16_t* D = reinterpret_cast<uint16_t*>(dst);
+    int32_t x = 0;
+    for (; x <= length - 8; x += 8) {
+        uint16x4_t lo = vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + x)));
+        uint16x4_t hi = vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + x + 4)));
+        vst1q_u16(D + x, vcombine_u16(lo, hi));
+    }
+    for (; x < length; x++) {
+        dst[x] = half_t(src[x]);
+    }
+}
+
+static void img_cvt_row_from_f32(const float* src, uint16_t* dst, int32_t length)
+{
+    int32_t x = 0;
+    for (; x <= length - 8; x += 8) {
+        uint16x4_t lo = vqmovn_u32(vcvtnq_u32_f32(vld1q_f32(src + x)));
+        uint16x4_t hi = vqmovn_u32(vcvtnq_u32_f32(vld1q_f32(src + x + 4)));
+        vst1q_u16(dst + x, vcombine_u16(lo, hi));
+    }
+    for (; x < length; x++) {
+        int32_t v = (int32_t)lrintf(src[x]);
+        dst[x] = (uint16_t)(v < 0 ? 0 : (v > USHRT_MAX ? USHRT_MAX : v));
+    }
+}
+
+static void img_cvt_row_from_f32(const float* src, int16_t* dst, int32_t length)
+{
+    int32_t x = 0;
+    for (; x <= length - 8; x += 8) {
+        int16x4_t lo = vqmovn_s32(vcvtnq_s32_f32(vld1q_f32(src + x)));
+        int16x4_t hi = vqmovn_s32(vcvtnq_s32_f32(vld1q_f32(src + x + 4)));
+        vst1q_s16(dst + x, vcombine_s16(lo, hi));
+    }
+    for (; x < length; x++) {
+        int32_t v = (int32_t)lrintf(src[x]);
+        dst[x] = (int16_t)(v < SHRT_MIN ? SHRT_MIN : (v > SHRT_MAX ? SHRT_MAX : v));
+    }
+}
+
+// 16-bit rows (half, unsigned and signed) are widened to fp32 once and then go through the fp32 row kernels,
+// area_mode selects the INTER_AREA coefficients used when area resize enlarges the image
+template <typename T>
+static void img_resize_generic_linear_neon_widen(
+    const T* src,
+    T* dst,
+    const int32_t* xofs,
+    const float* ialpha,
+    const int32_t* yofs,
+    const float* ibeta,
+    int32_t xmin,
+    int32_t xmax,
+    int32_t srcw,
+    int32_t srch,
+    int32_t src_stride,
+    int32_t dstw,
+    int32_t dsth,
+    int32_t dst_stride,
+    int32_t cn,
+    float* rows_from_caller)
+{
+    int32_t ksize = 2, ksize2 = ksize / 2;
+    int32_t width = dstw * cn;
+
+    int32_t srcwc = (int32_t)align_size(srcw * cn, 16);
+    int32_t bufstep = (int32_t)align_size(width, 16);
+    float* row_buffer = rows_from_caller ? rows_from_caller : (float*)tinycv::ScratchAlloc((srcwc + bufstep) * (ksize + 1) * sizeof(float), 128);
+
+    const float* srows[MAX_ESIZE];
+    float* srcrows[MAX_ESIZE];
+    float* rows[MAX_ESIZE];
+    int32_t prev_sy[MAX_ESIZE];
+    for (int32_t k = 0; k < ksize; k++) {
+        prev_sy[k] = -1;
+        rows[k] = row_buffer + bufstep * k;
+        srcrows[k] = row_buffer + bufstep * (ksize + 1) + srcwc * k;
+        srows[k] = srcrows[k];
+    }
+    float* dst_row = row_buffer + bufstep * ksize;
+    xmin *= cn;
+    xmax *= cn;
+
+    const float* beta = ibeta;
+    for (int32_t dy = 0; dy < dsth; dy++, beta += ksize) {
+        int32_t sy0 = yofs[dy], k, k0 = ksize, k1 = 0;
+
+        for (k = 0; k < ksize; k++) {
+            int32_t sy = img_clip(sy0 - ksize2 + 1 + k, 0, srch);
+            for (k1 = FUNC_MAX(k1, k); k1 < ksize; k1++) {
+                if (sy == prev_sy[k1]) {
+                    if (k1 > k)
+                        memcpy(rows[k], rows[k1], bufstep * sizeof(rows[0][0]));
+                    break;
+                }
+            }
+            if (k1 == ksize) {
+                k0 = FUNC_MIN(k0, k);
+                img_cvt_row_to_f32(src + src_stride * sy, srcrows[k], srcw * cn);
+            }
+            prev_sy[k] = sy;
+        }
+
+        if (k0 < ksize) {
+            if (cn == 4)
+                img_hresize_4channels_linear_neon_f32(srows + k0, rows + k0, ksize - k0, xofs, ialpha, srcw * cn, width, cn, xmin, xmax);
+            else
+                img_hresize_linear_c_f32(srows + k0, rows + k0, ksize - k0, xofs, ialpha, srcw * cn, width, cn, xmin, xmax);
+        }
+        img_vresize_linear_neon_f32((const float**)rows, dst_row, beta, width);
+        img_cvt_row_from_f32(dst_row, dst + dst_stride * dy, width);
+    }
+
+    if (!rows_from_caller) {
+        tinycv::ScratchFree(row_buffer);
+    }
+}
+
+template <typename T>
+static void img_resize_bilinear_neon_widen(
+    T* dst,
+    uint32_t dst_width,
+    uint32_t dst_height,
+    uint32_t dst_stride,
+    const T* src,
+    uint32_t src_width,
+    uint32_t src_height,
+    uint32_t src_stride,
+    uint32_t channels,
+    bool area_mode,
+    StreamContext* context = nullptr)
+{
+    int32_t dstw = dst_width;
+    int32_t dsth = dst_height;
+    int32_t srcw = src_width;
+    int32_t srch = src_height;
+    int32_t cn = channels;
+
+    int32_t width = dstw * cn;
+
+    int32_t ksize = 2, ksize2 = ksize / 2;
+
+    // same layout as img_resize_bilinear_neon_f32, the rows also hold the source rows widened to fp32
+    uint64_t size_for_range = 128;
+    uint64_t size_for_tables = align_size((width + dsth) * (sizeof(int32_t) + sizeof(float) * ksize), 128);
+    uint64_t size_for_rows = (align_size(srcw * cn, 16) + align_size(width, 16)) * (ksize + 1) * sizeof(float);
+
+    uint8_t* buffer_ = nullptr;
+    bool tables_ready = false;
+    if (context) {
+        const int32_t key[] = {srch, srcw, cn, dsth, dstw, area_mode};
+        buffer_ = (uint8_t*)context->Tables("resize_linear_widen", key, 6, size_for_range + size_for_tables + size_for_rows, &tables_ready);
+    } else {
+        buffer_ = (uint8_t*)tinycv::ScratchAlloc(size_for_range + size_for_tables, 128);
+    }
+    if (nullptr == buffer_) {
+        return;
+    }
+
+    int32_t* range = (int32_t*)buffer_;
+    int32_t* xofs = (int32_t*)(buffer_ + size_for_range);
+    int32_t* yofs = xofs + width;
+    float* ialpha = (float*)(yofs + dsth);
+    float* ibeta = ialpha + width * ksize;
+    float* rows = context ? (float*)(buffer_ + size_for_range + size_for_tables) : nullptr;
+
+    if (!tables_ready) {
+        range[0] = 0;
+        range[1] = dstw;
+        if (area_mode) {
+            img_resize_cal_offset_area_f32(xofs, ialpha, yofs, ibeta, &range[0], &range[1], ksize, ksize2, srcw, srch, dstw, dsth, cn);
+        } else {
+            float scale_x = 1. / ((float)dstw / srcw);
+            float scale_y = 1. / ((float)dsth / srch);
+            img_resize_cal_offset_linear_f32(xofs, ialpha, yofs, ibeta, &range[0], &range[1], ksize, ksize2, srcw, srch, dstw, dsth, cn, scale_x, scale_y, 0.0, 0.0, 0, 0);
+        }
+    }
+
+    img_resize_generic_linear_neon_widen(src, dst, xofs, ialpha, yofs, ibeta, range[0], range[1], srcw, srch, src_stride, dstw, dsth, dst_stride, cn, rows);
+
+    if (!context) {
+        tinycv::ScratchFree(buffer_);
+    }
+}
+
 struct DecimateAlpha {
     int32_t di;
     int32_t si;
@@ -668,13 +1029,30 @@ T img_saturate_cast(float x);
 template <>
 inline float img_saturate_cast<float>(float x)
 {
-    return (x > FLT_MIN ? (x < FLT_MAX ? x : FLT_MAX) : FLT_MIN);
+    return (x > -FLT_MAX ? (x < FLT_MAX ? x : FLT_MAX) : -FLT_MAX);
 }
 template <>
 inline uint8_t img_saturate_cast<uint8_t>(float x)
 {
     return (x > 0 ? (x < 255 ? x : 255) : 0);
 }
+template <>
+inline uint16_t img_saturate_cast<uint16_t>(float x)
+{
+    int32_t v = (int32_t)lrintf(x);
+    return (uint16_t)(v < 0 ? 0 : (v > USHRT_MAX ? USHRT_MAX : v));
+}
+template <>
+inline int16_t img_saturate_cast<int16_t>(float x)
+{
+    int32_t v = (int32_t)lrintf(x);
+    return (int16_t)(v < SHRT_MIN ? SHRT_MIN : (v > SHRT_MAX ? SHRT_MAX : v));
+}
+template <>
+inline half_t img_saturate_cast<half_t>(float x)
+{
+    return half_t(x);
+}
 
 static int32_t computeResizeAreaTab(int32_t src_size, int32_t dst_size, int32_t cn, double scale, DecimateAlpha* tab)
 {
@@ -723,7 +1101,7 @@ void resizeAreaFast(
     int32_t scale_y = inHeight / outHeight;
     int32_t area = scale_x * scale_y;
     // size_t srcstep = inWidthStride / (sizeof(Tsrc));
-    int32_t* _ofs = (int32_t*)malloc((area + outWidth * nc) * sizeof(int32_t));
+    int32_t* _ofs = (int32_t*)tinycv::ScratchAlloc((area + outWidth * nc) * sizeof(int32_t), 128);
     int32_t *ofs = _ofs, *xofs = ofs + area;
     for (int32_t sy = 0, k = 0; sy < scale_y; ++sy) {
         for (int32_t sx = 0; sx < scale_x; ++sx) {
@@ -776,7 +1154,7 @@ void resizeAreaFast(
             D[dx] = img_saturate_cast<Tdst>((float)sum / count);
         }
     }
-    free(_ofs);
+    tinycv::ScratchFree(_ofs);
 }
 
 static void img_resize_cal_offset_area_f32(
@@ -856,6 +1234,94 @@ static void img_resize_cal_offset_area_f32(
     }
 }
 
+// exact 4x area shrink, every output is the mean of its 4x4 source block
+static void img_resize_area_neon_shrink4_f32(
+    float* dst,
+    int32_t dst_width,
+    int32_t dst_height,
+    int32_t dst_stride,
+    const float* src,
+    int32_t src_stride,
+    int32_t channels)
+{
+    int32_t dstw = dst_width;
+    int32_t cn = channels;
+    float32x4_t v_scale = vdupq_n_f32(1.f / 16);
+    for (int32_t i = 0; i < dst_height; i++) {
+        const float* S = src + (4 * i) * src_stride;
+        float* D = dst + i * dst_stride;
+        int32_t j = 0;
+        if (cn == 1) {
+            for (; j <= dstw - 4; j += 4) {
+                float32x4_t sum = vdupq_n_f32(0.f);
+                for (int32_t r = 0; r < 4; r++) {
+                    float32x4x4_t q = vld4q_f32(S + r * src_stride + j * 4);
+                    sum = vaddq_f32(sum, vaddq_f32(vaddq_f32(q.val[0], q.val[1]), vaddq_f32(q.val[2], q.val[3])));
+                }
+                vst1q_f32(D + j, vmulq_f32(sum, v_scale));
+            }
+        } else if (cn == 3) {
+            for (; j < dstw; j++) {
+                float32x4x3_t sum = vld3q_f32(S + j * 12);
+                for (int32_t r = 1; r < 4; r++) {
+                    float32x4x3_t q = vld3q_f32(S + r * src_stride + j * 12);
+                    for (int32_t c = 0; c < 3; c++) {
+                        sum.val[c] = vaddq_f32(sum.val[c], q.val[c]);
+                    }
+                }
+                for (int32_t c = 0; c < 3; c++) {
+                    D[j * 3 + c] = vaddvq_f32(sum.val[c]) * (1.f / 16);
+                }
+            }
+        } else if (cn == 4) {
+            for (; j < dstw; j++) {
+                float32x4_t sum = vdupq_n_f32(0.f);
+                for (int32_t r = 0; r < 4; r++) {
+                    const float* row = S + r * src_stride + j * 16;
+                    sum = vaddq_f32(sum, vaddq_f32(vaddq_f32(vld1q_f32(row), vld1q_f32(row + 4)),
+                                                   vaddq_f32(vld1q_f32(row + 8), vld1q_f32(row + 12))));
+                }
+                vst1q_f32(D + j * 4, vmulq_f32(sum, v_scale));
+            }
+        }
+        for (; j < dstw; j++) {
+            for (int32_t c = 0; c < cn; c++) {
+                float sum = 0.f;
+                for (int32_t r = 0; r < 4; r++) {
+                    const float* row = S + r * src_stride + j * 4 * cn + c;
+                    sum += (row[0] + row[cn]) + (row[2 * cn] + row[3 * cn]);
+                }
+                D[j * cn + c] = sum * (1.f / 16);
+            }
+        }
+    }
+}
+
+// the exact 2x and 4x shrink shortcuts only have fp32 kernels, other types take the generic integer scale path
+template <typename Tsrc, typename Tdst>
+static inline bool img_resize_area_shrink2(Tdst* dst, int32_t dst_width, int32_t dst_height, int32_t dst_stride, const Tsrc* src, int32_t src_width, int32_t src_height, int32_t src_stride, int32_t channels)
+{
+    return false;
+}
+
+static inline bool img_resize_area_shrink2(float* dst, int32_t dst_width, int32_t dst_height, int32_t dst_stride, const float* src, int32_t src_width, int32_t src_height, int32_t src_stride, int32_t channels)
+{
+    img_resize_bilinear_neon_shrink2_f32(dst, dst_width, dst_height, dst_stride, src, src_width, src_height, src_stride, channels);
+    return true;
+}
+
+template <typename Tsrc, typename Tdst>
+static inline bool img_resize_area_shrink4(Tdst* dst, int32_t dst_width, int32_t dst_height, int32_t dst_stride, const Tsrc* src, int32_t src_stride, int32_t channels)
+{
+    return false;
+}
+
+static inline bool img_resize_area_shrink4(float* dst, int32_t dst_width, int32_t dst_height, int32_t dst_stride, const float* src, int32_t src_stride, int32_t channels)
+{
+    img_resize_area_neon_shrink4_f32(dst, dst_width, dst_height, dst_stride, src, src_stride, channels);
+    return true;
+}
+
 template <typename Tsrc, int32_t ncSrc, typename Tdst, int32_t ncDst, int32_t nc>
 void resizeArea(
     int32_t inHeight,
@@ -868,8 +1334,13 @@ void resizeArea(
     Tdst* outData)
 {
     if (inWidth % 2 == 0 && outWidth == inWidth / 2 &&
-        inHeight % 2 == 0 && outHeight == inHeight / 2 && (nc == 1 || nc == 4)) {
-        img_resize_bilinear_neon_shrink2_f32(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, nc);
+        inHeight % 2 == 0 && outHeight == inHeight / 2 &&
+        img_resize_area_shrink2(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, nc)) {
+        return;
+    }
+    if (inWidth % 4 == 0 && outWidth == inWidth / 4 &&
+        inHeight % 4 == 0 && outHeight == inHeight / 4 &&
+        img_resize_area_shrink4(outData, outWidth, outHeight, outWidthStride, inData, inWidthStride, nc)) {
         return;
     }
     if (inWidth % outWidth == 0 && inHeight % outHeight == 0) {
@@ -877,13 +1348,13 @@ void resizeArea(
         return;
     }
 
-    DecimateAlpha* _xytab = (DecimateAlpha*)malloc((inHeight + inWidth) * 2 * sizeof(DecimateAlpha));
+    DecimateAlpha* _xytab = (DecimateAlpha*)tinycv::ScratchAlloc((inHeight + inWidth) * 2 * sizeof(DecimateAlpha), 128);
     DecimateAlpha *xtab = _xytab, *ytab = xtab + inWidth * 2;
 
     int32_t xtab_size = computeResizeAreaTab(inWidth, outWidth, nc, double(inWidth) / outWidth, xtab);
     int32_t ytab_size = computeResizeAreaTab(inHeight, outHeight, 1, double(inHeight) / outHeight, ytab);
 
-    int32_t* tabofs = (int32_t*)malloc((outHeight + 1) * sizeof(int32_t));
+    int32_t* tabofs = (int32_t*)tinycv::ScratchAlloc((outHeight + 1) * sizeof(int32_t), 128);
     int32_t k, dy;
     for (k = 0, dy = 0; k < ytab_size; ++k) {
         if (k == 0 || ytab[k].di != ytab[k - 1].di) {
@@ -894,7 +1365,7 @@ void resizeArea(
 
     // invoker's operator
     outWidth *= nc;
-    float* _buffer = (float*)malloc(outWidth * 2 * sizeof(float));
+    float* _buffer = (float*)tinycv::ScratchAlloc(outWidth * 2 * sizeof(float), 128);
     float *buf = _buffer, *sum = buf + outWidth;
     int32_t j_start = tabofs[0], j_end = tabofs[outHeight], j, dx, prev_dy = ytab[j_start].di;
 
@@ -933,15 +1404,15 @@ void resizeArea(
 
     Tdst* D = (Tdst*)(outData + outWidthStride * prev_dy);
     for (dx = 0; dx < outWidth; ++dx) {
-        D[dx] = (Tdst)sum[dx];
+        D[dx] = img_saturate_cast<Tdst>(sum[dx]);
     }
 
-    free(_xytab);
+    tinycv::ScratchFree(_xytab);
     _xytab = NULL;
-    free(tabofs);
+    tinycv::ScratchFree(tabofs);
     tabofs = NULL;
 
-    free(_buffer);
+    tinycv::ScratchFree(_buffer);
     _buffer = NULL;
 }
 
@@ -973,7 +1444,7 @@ void img_resize_area_neon_f32(
     ksize = 2;
     ksize2 = ksize / 2;
 
-    uint8_t* buffer_ = (uint8_t*)malloc((width + dsth) * (sizeof(int32_t) + sizeof(float) * ksize));
+    uint8_t* buffer_ = (uint8_t*)tinycv::ScratchAlloc((width + dsth) * (sizeof(int32_t) + sizeof(float) * ksize), 128);
 
     int32_t* xofs = (int32_t*)buffer_;
     int32_t* yofs = xofs + width;
@@ -982,12 +1453,52 @@ void img_resize_area_neon_f32(
 
     img_resize_cal_offset_area_f32(xofs, ialpha, yofs, ibeta, &xmin, &xmax, ksize, ksize2, srcw, srch, dstw, dsth, cn);
 
-    img_resize_generic_linear_neon_f32(src, dst, xofs, ialpha, yofs, ibeta, xmin, xmax, ksize, srcw, srch, src_stride, dstw, dsth, dst_stride, cn);
+    img_resize_generic_linear_neon_f32(src, dst, xofs, ialpha, yofs, ibeta, xmin, xmax, ksize, srcw, srch, src_stride, dstw, dsth, dst_stride, cn, nullptr);
 
-    free(buffer_);
+    tinycv::ScratchFree(buffer_);
     buffer_ = NULL;
 }
 
+// exact 2x and 4x nearest shrink, output pixel x samples source pixel scale * x
+static void img_resize_nearest_neon_shrink_f32(
+    float* dst,
+    int32_t dst_width,
+    int32_t dst_height,
+    int32_t dst_stride,
+    const float* src,
+    int32_t src_stride,
+    int32_t channels,
+    int32_t scale)
+{
+    int32_t dstw = dst_width;
+    int32_t cn = channels;
+    for (int32_t i = 0; i < dst_height; i++) {
+        const float* S = src + (scale * i) * src_stride;
+        float* D = dst + i * dst_stride;
+        int32_t j = 0;
+        if (cn == 1) {
+            if (scale == 2) {
+                for (; j <= dstw - 4; j += 4) {
+                    vst1q_f32(D + j, vld2q_f32(S + j * 2).val[0]);
+                }
+            } else {
+                for (; j <= dstw - 4; j += 4) {
+                    vst1q_f32(D + j, vld4q_f32(S + j * 4).val[0]);
+                }
+            }
+        } else if (cn == 4) {
+            for (; j < dstw; j++) {
+                vst1q_f32(D + j * 4, vld1q_f32(S + j * 4 * scale));
+            }
+        }
+        for (; j < dstw; j++) {
+            for (int32_t c = 0; c < cn; c++) {
+                D[j * cn + c] = S[j * scale * cn + c];
+            }
+        }
+    }
+}
+
 template <>
 void ResizeNearestPoint<float, 1>(
     int32_t inHeight,
@@ -1005,6 +1516,10 @@ void ResizeNearestPoint<float, 1>(
     if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
         return;
     }
+    if ((outHeight * 2 == inHeight && outWidth * 2 == inWidth) || (outHeight * 4 == inHeight && outWidth * 4 == inWidth)) {
+        img_resize_nearest_neon_shrink_f32(outData, outWidth, outHeight, outWidthStride, inData, inWidthStride, 1, inHeight / outHeight);
+        return;
+    }
     resizeNearestPoint<float, float, 1>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
 }
 
@@ -1025,6 +1540,10 @@ void ResizeNearestPoint<float, 3>(
     if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
         return;
     }
+    if ((outHeight * 2 == inHeight && outWidth * 2 == inWidth) || (outHeight * 4 == inHeight && outWidth * 4 == inWidth)) {
+        img_resize_nearest_neon_shrink_f32(outData, outWidth, outHeight, outWidthStride, inData, inWidthStride, 3, inHeight / outHeight);
+        return;
+    }
     resizeNearestPoint<float, float, 3>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
 }
 
@@ -1045,19 +1564,23 @@ void ResizeNearestPoint<float, 4>(
     if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
         return;
     }
+    if ((outHeight * 2 == inHeight && outWidth * 2 == inWidth) || (outHeight * 4 == inHeight && outWidth * 4 == inWidth)) {
+        img_resize_nearest_neon_shrink_f32(outData, outWidth, outHeight, outWidthStride, inData, inWidthStride, 4, inHeight / outHeight);
+        return;
+    }
     resizeNearestPoint<float, float, 4>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
 }
 
 template <>
-void ResizeLinear<float, 1>(
+void ResizeNearestPoint<half_t, 1>(
     int32_t inHeight,
     int32_t inWidth,
     int32_t inWidthStride,
-    const float* inData,
+    const half_t* inData,
     int32_t outHeight,
     int32_t outWidth,
     int32_t outWidthStride,
-    float* outData)
+    half_t* outData)
 {
     if (nullptr == outData || nullptr == inData) {
         return;
@@ -1065,19 +1588,19 @@ void ResizeLinear<float, 1>(
     if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
         return;
     }
-    img_resize_bilinear_neon_f32(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 1);
+    resizeNearestPoint<uint16_t, uint16_t, 1>(inHeight, inWidth, inWidthStride, (const uint16_t*)inData, outHeight, outWidth, outWidthStride, (uint16_t*)outData);
 }
 
 template <>
-void ResizeLinear<float, 3>(
+void ResizeNearestPoint<half_t, 3>(
     int32_t inHeight,
     int32_t inWidth,
     int32_t inWidthStride,
-    const float* inData,
+    const half_t* inData,
     int32_t outHeight,
     int32_t outWidth,
     int32_t outWidthStride,
-    float* outData)
+    half_t* outData)
 {
     if (nullptr == outData || nullptr == inData) {
         return;
@@ -1085,10 +1608,70 @@ void ResizeLinear<float, 3>(
     if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
         return;
     }
-    img_resize_bilinear_neon_f32(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 3);
+    resizeNearestPoint<uint16_t, uint16_t, 3>(inHeight, inWidth, inWidthStride, (const uint16_t*)inData, outHeight, outWidth, outWidthStride, (uint16_t*)outData);
 }
+
 template <>
-void ResizeLinear<float, 4>(
+void ResizeNearestPoint<half_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    resizeNearestPoint<uint16_t, uint16_t, 4>(inHeight, inWidth, inWidthStride, (const uint16_t*)inData, outHeight, outWidth, outWidthStride, (uint16_t*)outData);
+}
+
+template <>
+void ResizeLinear<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    img_resize_bilinear_neon_f32(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 1);
+}
+
+template <>
+void ResizeLinear<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    img_resize_bilinear_neon_f32(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 3);
+}
+template <>
+void ResizeLinear<float, 4>(
     int32_t inHeight,
     int32_t inWidth,
     int32_t inWidthStride,
@@ -1107,6 +1690,66 @@ void ResizeLinear<float, 4>(
     img_resize_bilinear_neon_f32(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 4);
 }
 
+template <>
+void ResizeLinear<half_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 1, false);
+}
+
+template <>
+void ResizeLinear<half_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 3, false);
+}
+
+template <>
+void ResizeLinear<half_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 4, false);
+}
+
 template <>
 void ResizeArea<float, 1>(
     int32_t inHeight,
@@ -1182,4 +1825,1022 @@ void ResizeArea<float, 4>(
     }
 }
 
+template <>
+void ResizeNearestPoint<uint16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    resizeNearestPoint<uint16_t, uint16_t, 1>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeNearestPoint<uint16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    resizeNearestPoint<uint16_t, uint16_t, 3>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeNearestPoint<uint16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    resizeNearestPoint<uint16_t, uint16_t, 4>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeNearestPoint<int16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    resizeNearestPoint<uint16_t, uint16_t, 1>(inHeight, inWidth, inWidthStride, (const uint16_t*)inData, outHeight, outWidth, outWidthStride, (uint16_t*)outData);
+}
+
+template <>
+void ResizeNearestPoint<int16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    resizeNearestPoint<uint16_t, uint16_t, 3>(inHeight, inWidth, inWidthStride, (const uint16_t*)inData, outHeight, outWidth, outWidthStride, (uint16_t*)outData);
+}
+
+template <>
+void ResizeNearestPoint<int16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    resizeNearestPoint<uint16_t, uint16_t, 4>(inHeight, inWidth, inWidthStride, (const uint16_t*)inData, outHeight, outWidth, outWidthStride, (uint16_t*)outData);
+}
+
+template <>
+void ResizeLinear<uint16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 1, false);
+}
+
+template <>
+void ResizeLinear<uint16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 3, false);
+}
+
+template <>
+void ResizeLinear<uint16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 4, false);
+}
+
+template <>
+void ResizeLinear<int16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 1, false);
+}
+
+template <>
+void ResizeLinear<int16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 3, false);
+}
+
+template <>
+void ResizeLinear<int16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 4, false);
+}
+
+template <>
+void ResizeArea<half_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    if (inHeight < outHeight || inWidth < outWidth) {
+        img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 1, true);
+
+    } else {
+        resizeArea<half_t, 1, half_t, 1, 1>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+    }
+}
+
+template <>
+void ResizeArea<half_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    if (inHeight < outHeight || inWidth < outWidth) {
+        img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 3, true);
+
+    } else {
+        resizeArea<half_t, 3, half_t, 3, 3>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+    }
+}
+
+template <>
+void ResizeArea<half_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    if (inHeight < outHeight || inWidth < outWidth) {
+        img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 4, true);
+
+    } else {
+        resizeArea<half_t, 4, half_t, 4, 4>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+    }
+}
+
+template <>
+void ResizeArea<uint16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    if (inHeight < outHeight || inWidth < outWidth) {
+        img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 1, true);
+
+    } else {
+        resizeArea<uint16_t, 1, uint16_t, 1, 1>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+    }
+}
+
+template <>
+void ResizeArea<uint16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    if (inHeight < outHeight || inWidth < outWidth) {
+        img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 3, true);
+
+    } else {
+        resizeArea<uint16_t, 3, uint16_t, 3, 3>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+    }
+}
+
+template <>
+void ResizeArea<uint16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    if (inHeight < outHeight || inWidth < outWidth) {
+        img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 4, true);
+
+    } else {
+        resizeArea<uint16_t, 4, uint16_t, 4, 4>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+    }
+}
+
+template <>
+void ResizeArea<int16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    if (inHeight < outHeight || inWidth < outWidth) {
+        img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 1, true);
+
+    } else {
+        resizeArea<int16_t, 1, int16_t, 1, 1>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+    }
+}
+
+template <>
+void ResizeArea<int16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    if (inHeight < outHeight || inWidth < outWidth) {
+        img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 3, true);
+
+    } else {
+        resizeArea<int16_t, 3, int16_t, 3, 3>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+    }
+}
+
+template <>
+void ResizeArea<int16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    if (inHeight < outHeight || inWidth < outWidth) {
+        img_resize_bilinear_neon_widen(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 4, true);
+
+    } else {
+        resizeArea<int16_t, 4, int16_t, 4, 4>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+    }
+}
+
+static void img_resize_stream(StreamContext& context, const float* src, float* dst, int32_t srcw, int32_t srch, int32_t src_stride, int32_t dstw, int32_t dsth, int32_t dst_stride, int32_t cn)
+{
+    img_resize_bilinear_neon_f32(dst, dstw, dsth, dst_stride, src, srcw, srch, src_stride, cn, &context);
+}
+
+template <typename T>
+static void img_resize_stream(StreamContext& context, const T* src, T* dst, int32_t srcw, int32_t srch, int32_t src_stride, int32_t dstw, int32_t dsth, int32_t dst_stride, int32_t cn)
+{
+    img_resize_bilinear_neon_widen(dst, dstw, dsth, dst_stride, src, srcw, srch, src_stride, cn, false, &context);
+}
+
+template <typename T, int32_t channels>
+static void resize_linear_stream_fp32(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T* outData)
+{
+    StreamStageTimer timer(context, "ResizeLinear");
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    img_resize_stream(context, inData, outData, inWidth, inHeight, inWidthStride, outWidth, outHeight, outWidthStride, channels);
+}
+
+static void img_resize_region_rows(
+    const float* src,
+    float* dst,
+    const int32_t* xofs,
+    const float* ialpha,
+    const int32_t* yofs,
+    const float* ibeta,
+    int32_t xmin,
+    int32_t xmax,
+    int32_t srcw,
+    int32_t srch,
+    int32_t src_stride,
+    int32_t dstw,
+    int32_t dsth,
+    int32_t dst_stride,
+    int32_t cn)
+{
+    img_resize_generic_linear_neon_f32(src, dst, xofs, ialpha, yofs, ibeta, xmin, xmax, 2, srcw, srch, src_stride, dstw, dsth, dst_stride, cn, nullptr);
+}
+
+template <typename T>
+static void img_resize_region_rows(
+    const T* src,
+    T* dst,
+    const int32_t* xofs,
+    const float* ialpha,
+    const int32_t* yofs,
+    const float* ibeta,
+    int32_t xmin,
+    int32_t xmax,
+    int32_t srcw,
+    int32_t srch,
+    int32_t src_stride,
+    int32_t dstw,
+    int32_t dsth,
+    int32_t dst_stride,
+    int32_t cn)
+{
+    img_resize_generic_linear_neon_widen(src, dst, xofs, ialpha, yofs, ibeta, xmin, xmax, srcw, srch, src_stride, dstw, dsth, dst_stride, cn, nullptr);
+}
+
+template <typename T, int32_t channels>
+static void resize_linear_region_fp32(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || outHeight <= 0 || outWidth <= 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    if (!(scaleY > 0.0) || !(scaleX > 0.0)) {
+        return;
+    }
+
+    // the shrink kernels of ResizeLinear sum in another order, the generic rows compute every pixel
+    // the same way wherever it is in the tile
+    int32_t ksize = 2, ksize2 = ksize / 2;
+    int32_t xmin = 0;
+    int32_t xmax = outWidth;
+    int32_t width = outWidth * channels;
+
+    uint8_t* buffer_ = (uint8_t*)tinycv::ScratchAlloc((width + outHeight) * (sizeof(int32_t) + sizeof(float) * ksize), 128);
+
+    int32_t* xofs = (int32_t*)buffer_;
+    int32_t* yofs = xofs + width;
+    float* ialpha = (float*)(yofs + outHeight);
+    float* ibeta = ialpha + width * ksize;
+
+    img_resize_cal_offset_linear_f32(xofs, ialpha, yofs, ibeta, &xmin, &xmax, ksize, ksize2, inWidth, inHeight, outWidth, outHeight, channels, scaleX, scaleY, originX, originY, outX, outY);
+
+    img_resize_region_rows(inData, outData, xofs, ialpha, yofs, ibeta, xmin, xmax, inWidth, inHeight, inWidthStride, outWidth, outHeight, outWidthStride, channels);
+    tinycv::ScratchFree(buffer_);
+}
+
+template <>
+void ResizeLinearRegion<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<float, 1>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<float, 3>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<float, 4>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<half_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<half_t, 1>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<half_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<half_t, 3>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<half_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<half_t, 4>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<uint16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<uint16_t, 1>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<uint16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<uint16_t, 3>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<uint16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<uint16_t, 4>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<int16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<int16_t, 1>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<int16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<int16_t, 3>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<int16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<int16_t, 4>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinear<float, 1>(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float* outData)
+{
+    resize_linear_stream_fp32<float, 1>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<float, 3>(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float* outData)
+{
+    resize_linear_stream_fp32<float, 3>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<float, 4>(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float* outData)
+{
+    resize_linear_stream_fp32<float, 4>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<half_t, 1>(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    resize_linear_stream_fp32<half_t, 1>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<half_t, 3>(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    resize_linear_stream_fp32<half_t, 3>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<half_t, 4>(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t* outData)
+{
+    resize_linear_stream_fp32<half_t, 4>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<uint16_t, 1>(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData)
+{
+    resize_linear_stream_fp32<uint16_t, 1>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<uint16_t, 3>(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData)
+{
+    resize_linear_stream_fp32<uint16_t, 3>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<uint16_t, 4>(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t* outData)
+{
+    resize_linear_stream_fp32<uint16_t, 4>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<int16_t, 1>(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    resize_linear_stream_fp32<int16_t, 1>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<int16_t, 3>(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    resize_linear_stream_fp32<int16_t, 3>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<int16_t, 4>(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t* outData)
+{
+    resize_linear_stream_fp32<int16_t, 4>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
 } // namespace tinycv
@@ -0,0 +1,275 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/resize.h"
+#include "tinycv/types.h"
+#include "tinycv/sys.h"
+#include "tinycv/resize_filter.hpp"
+
+#include <string.h>
+#include <stdint.h>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+#include <arm_neon.h>
+
+namespace tinycv {
+
+// source rows are widened to fp32 once, the copy also gives the taps 8 readable elements of padding
+static inline void resize_lanczos_load_row(const uint8_t *src, int32_t n, float *dst)
+{
+    int32_t i = 0;
+    for (; i <= n - 8; i += 8) {
+        uint16x8_t v = vmovl_u8(vld1_u8(src + i));
+        vst1q_f32(dst + i, vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))));
+        vst1q_f32(dst + i + 4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))));
+    }
+    for (; i < n; ++i) {
+        dst[i] = src[i];
+    }
+    memset(dst + n, 0, 8 * sizeof(float));
+}
+
+static inline void resize_lanczos_load_row(const float *src, int32_t n, float *dst)
+{
+    memcpy(dst, src, n * sizeof(float));
+    memset(dst + n, 0, 8 * sizeof(float));
+}
+
+static void resize_lanczos_w(
+    const float *src,
+    int32_t channels,
+    const int32_t *start,
+    const float *weights,
+    int32_t ksize,
+    int32_t ksize_pad,
+    int32_t out_width,
+    float *row)
+{
+    if (channels == 1) {
+        for (int32_t i = 0; i < out_width; ++i) {
+            const float *s  = src + start[i];
+            const float *w  = weights + i * ksize_pad;
+            float32x4_t acc0 = vmulq_f32(vld1q_f32(s), vld1q_f32(w));
+            float32x4_t acc1 = vmulq_f32(vld1q_f32(s + 4), vld1q_f32(w + 4));
+            for (int32_t k = 8; k < ksize_pad; k += 8) {
+                acc0 = vfmaq_f32(acc0, vld1q_f32(s + k), vld1q_f32(w + k));
+                acc1 = vfmaq_f32(acc1, vld1q_f32(s + k + 4), vld1q_f32(w + k + 4));
+            }
+            row[i] = vaddvq_f32(vaddq_f32(acc0, acc1));
+        }
+        return;
+    }
+    // 3 and 4 channels: one vector of channels per tap, a 3 channel store spills one lane into
+    // the next pixel which is written right after, two pixels are summed side by side
+    int32_t i = 0;
+    for (; i <= out_width - 2; i += 2) {
+        const float *s0 = src + start[i] * channels;
+        const float *s1 = src + start[i + 1] * channels;
+        const float *w0 = weights + i * ksize_pad;
+        const float *w1 = w0 + ksize_pad;
+        float32x4_t a0  = vdupq_n_f32(0.f);
+        float32x4_t a1  = vdupq_n_f32(0.f);
+        for (int32_t k = 0; k < ksize; ++k) {
+            a0 = vfmaq_n_f32(a0, vld1q_f32(s0 + k * channels), w0[k]);
+            a1 = vfmaq_n_f32(a1, vld1q_f32(s1 + k * channels), w1[k]);
+        }
+        vst1q_f32(row + i * channels, a0);
+        vst1q_f32(row + (i + 1) * channels, a1);
+    }
+    for (; i < out_width; ++i) {
+        const float *s  = src + start[i] * channels;
+        const float *w  = weights + i * ksize_pad;
+        float32x4_t acc = vdupq_n_f32(0.f);
+        for (int32_t k = 0; k < ksize; ++k) {
+            acc = vfmaq_n_f32(acc, vld1q_f32(s + k * channels), w[k]);
+        }
+        vst1q_f32(row + i * channels, acc);
+    }
+}
+
+static inline void resize_lanczos_load(const float *src, float32x4_t *v)
+{
+    v[0] = vld1q_f32(src);
+    v[1] = vld1q_f32(src + 4);
+    v[2] = vld1q_f32(src + 8);
+    v[3] = vld1q_f32(src + 12);
+}
+
+static inline void resize_lanczos_load(const uint8_t *src, float32x4_t *v)
+{
+    uint8x16_t u8  = vld1q_u8(src);
+    uint16x8_t lo  = vmovl_u8(vget_low_u8(u8));
+    uint16x8_t hi  = vmovl_u8(vget_high_u8(u8));
+    v[0] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo)));
+    v[1] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo)));
+    v[2] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi)));
+    v[3] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi)));
+}
+
+static inline void resize_lanczos_store(const float32x4_t *v, float *dst)
+{
+    vst1q_f32(dst, v[0]);
+    vst1q_f32(dst + 4, v[1]);
+    vst1q_f32(dst + 8, v[2]);
+    vst1q_f32(dst + 12, v[3]);
+}
+
+static inline void resize_lanczos_store(const float32x4_t *v, uint8_t *dst)
+{
+    int16x8_t lo = vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(v[0])), vqmovn_s32(vcvtnq_s32_f32(v[1])));
+    int16x8_t hi = vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(v[2])), vqmovn_s32(vcvtnq_s32_f32(v[3])));
+    vst1q_u8(dst, vcombine_u8(vqmovun_s16(lo), vqmovun_s16(hi)));
+}
+
+static inline void resize_lanczos_store(float v, float *dst)
+{
+    *dst = v;
+}
+
+static inline void resize_lanczos_store(float v, uint8_t *dst)
+{
+    *dst = (uint8_t)std::min(std::max((int32_t)lrintf(v), 0), 255);
+}
+
+// height pass over whole rows, every output element is independent
+template <typename TSrc, typename TDst>
+static void resize_lanczos_h(
+    const TSrc *const *rows,
+    const float *coeff,
+    int32_t ksize,
+    int32_t n,
+    TDst *dst)
+{
+    int32_t i = 0;
+    for (; i <= n - 16; i += 16) {
+        float32x4_t acc[4], v[4];
+        resize_lanczos_load(rows[0] + i, v);
+        for (int32_t j = 0; j < 4; ++j) {
+            acc[j] = vmulq_n_f32(v[j], coeff[0]);
+        }
+        for (int32_t k = 1; k < ksize; ++k) {
+            resize_lanczos_load(rows[k] + i, v);
+            for (int32_t j = 0; j < 4; ++j) {
+                acc[j] = vfmaq_n_f32(acc[j], v[j], coeff[k]);
+            }
+        }
+        resize_lanczos_store(acc, dst + i);
+    }
+    for (; i < n; ++i) {
+        float acc = 0.f;
+        for (int32_t k = 0; k < ksize; ++k) {
+            acc += rows[k][i] * coeff[k];
+        }
+        resize_lanczos_store(acc, dst + i);
+    }
+}
+
+template <typename T>
+static void resize_lanczos_kernel(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t channels,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t window)
+{
+    std::shared_ptr<const ResizeFilterTable> xtab = GetLanczosFilterTable(inWidth, outWidth, window);
+    std::shared_ptr<const ResizeFilterTable> ytab = GetLanczosFilterTable(inHeight, outHeight, window);
+
+    int32_t in_len   = inWidth * channels;
+    int32_t out_len  = outWidth * channels;
+    int32_t ksize    = ytab->ksize;
+    uint64_t src_len = (in_len + 8 + 31) & ~31;
+    uint64_t row_len = (out_len + 8 + 31) & ~31;
+    const float one = 1.f;
+
+    if (outHeight < inHeight) {
+        // shrinking: filter the source rows vertically first so the width pass runs on output rows only
+        float *line = (float *)tinycv::ScratchAlloc((src_len + row_len) * sizeof(float), 128);
+        float *row  = line + src_len;
+        const T **src_rows = (const T **)tinycv::ScratchAlloc(ksize * sizeof(const T *), 64);
+        memset(line + in_len, 0, 8 * sizeof(float));
+        for (int32_t h = 0; h < outHeight; ++h) {
+            int32_t sy = ytab->start[h];
+            for (int32_t k = 0; k < ksize; ++k) {
+                src_rows[k] = inData + (sy + k) * inWidthStride;
+            }
+            resize_lanczos_h(src_rows, ytab->weights.data() + h * ytab->ksize_pad, ksize, in_len, line);
+            resize_lanczos_w(line, channels, xtab->start.data(), xtab->weights.data(), xtab->ksize, xtab->ksize_pad, outWidth, row);
+            resize_lanczos_h(&row, &one, 1, out_len, outData + h * outWidthStride);
+        }
+        tinycv::ScratchFree(src_rows);
+        tinycv::ScratchFree(line);
+        return;
+    }
+
+    float *src_row    = (float *)tinycv::ScratchAlloc((src_len + row_len * ksize) * sizeof(float), 128);
+    float *row_buffer = src_row + src_len;
+    const float **rows = (const float **)tinycv::ScratchAlloc(ksize * sizeof(const float *), 64);
+
+    // horizontally filtered rows live in a ring indexed by source row, windows only move forward
+    int32_t next_row = 0;
+    for (int32_t h = 0; h < outHeight; ++h) {
+        int32_t sy = ytab->start[h];
+        for (int32_t r = std::max(next_row, sy); r < sy + ksize; ++r) {
+            resize_lanczos_load_row(inData + r * inWidthStride, in_len, src_row);
+            resize_lanczos_w(src_row, channels, xtab->start.data(), xtab->weights.data(), xtab->ksize, xtab->ksize_pad, outWidth, row_buffer + (r % ksize) * row_len);
+        }
+        next_row = std::max(next_row, sy + ksize);
+        for (int32_t k = 0; k < ksize; ++k) {
+            rows[k] = row_buffer + ((sy + k) % ksize) * row_len;
+        }
+        resize_lanczos_h(rows, ytab->weights.data() + h * ytab->ksize_pad, ksize, out_len, outData + h * outWidthStride);
+    }
+    tinycv::ScratchFree(rows);
+    tinycv::ScratchFree(src_row);
+}
+
+template <typename T, int32_t channels>
+void ResizeLanczos(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t window)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || outHeight <= 0 || outWidth <= 0 || window <= 0) {
+        return;
+    }
+    resize_lanczos_kernel(inHeight, inWidth, inWidthStride, inData, channels, outHeight, outWidth, outWidthStride, outData, window);
+}
+
+template void ResizeLanczos<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t window);
+template void ResizeLanczos<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t window);
+template void ResizeLanczos<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t window);
+template void ResizeLanczos<float, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t window);
+template void ResizeLanczos<float, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t window);
+template void ResizeLanczos<float, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t window);
+
+} // namespace tinycv
@@ -16,10 +16,12 @@
 // under the License.
 
 #include "tinycv/resize.h"
+#include "tinycv/stream.h"
 #include "tinycv/types.h"
+#include "tinycv/sys.h"
 #include "operation_utils.hpp"
 
-#include <vector>
+#include <algorithm>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -42,7 +44,7 @@ void resizeNearestPoint(
     Tdst* outData)
 {
     int32_t x, y;
-    int32_t* x_ofs = (int32_t*)malloc(outWidth * sizeof(int32_t));
+    int32_t* x_ofs = (int32_t*)tinycv::ScratchAlloc(outWidth * sizeof(int32_t), 128);
     double fx = (double)outWidth / inWidth;
     double fy = (double)outHeight / inHeight;
     double ifx = 1. / fx;
@@ -63,7 +65,7 @@ void resizeNearestPoint(
             }
         }
     }
-    free(x_ofs);
+    tinycv::ScratchFree(x_ofs);
 }
 
 template <>
@@ -78,7 +80,7 @@ void resizeNearestPoint<uint8_t, uint8_t, 1>(
     uint8_t* outData) // resize_nearest_u8c1
 {
     int32_t x, y;
-    int32_t* x_ofs = (int32_t*)malloc(outWidth * sizeof(int32_t));
+    int32_t* x_ofs = (int32_t*)tinycv::ScratchAlloc(outWidth * sizeof(int32_t), 128);
     double fx = (double)outWidth / inWidth;
     double fy = (double)outHeight / inHeight;
     double ifx = 1.0f / fx;
@@ -131,7 +133,7 @@ void resizeNearestPoint<uint8_t, uint8_t, 1>(
             D[x] = S[x0];
         }
     }
-    free(x_ofs);
+    tinycv::ScratchFree(x_ofs);
 }
 
 template <>
@@ -146,7 +148,7 @@ void resizeNearestPoint<uint8_t, uint8_t, 3>(
     uint8_t* outData) // resize_nearest_u8c3
 {
     int32_t x, y;
-    int32_t* x_ofs = (int32_t*)malloc(outWidth * sizeof(int32_t));
+    int32_t* x_ofs = (int32_t*)tinycv::ScratchAlloc(outWidth * sizeof(int32_t), 128);
     double fx = (double)outWidth / inWidth;
     double fy = (double)outHeight / inHeight;
     double ifx = 1.0f / fx;
@@ -180,7 +182,7 @@ void resizeNearestPoint<uint8_t, uint8_t, 3>(
             D[xd + 0] = S[x0], D[xd + 1] = S[x0 + 1], D[xd + 2] = S[x0 + 2];
         }
     }
-    free(x_ofs);
+    tinycv::ScratchFree(x_ofs);
 }
 
 template <>
@@ -195,7 +197,7 @@ void resizeNearestPoint<uint8_t, uint8_t, 4>(
     uint8_t* outData) // resize_nearest_u8c4
 {
     int32_t x, y;
-    int32_t* x_ofs = (int32_t*)malloc(outWidth * sizeof(int32_t));
+    int32_t* x_ofs = (int32_t*)tinycv::ScratchAlloc(outWidth * sizeof(int32_t), 128);
     double fx = (double)outWidth / inWidth;
     double fy = (double)outHeight / inHeight;
     double ifx = 1.0f / fx;
@@ -226,7 +228,71 @@ void resizeNearestPoint<uint8_t, uint8_t, 4>(
             *((int32_t*)(D + xd)) = *((int32_t*)(S + x0));
         }
     }
-    free(x_ofs);
+    tinycv::ScratchFree(x_ofs);
+}
+
+// exact 1/2 and 1/4 downscale, the sample points are the top left pixel of every block
+static void img_resize_nearest_neon_shrink_u8(
+    uint8_t* dst,
+    int32_t dst_width,
+    int32_t dst_height,
+    int32_t dst_stride,
+    const uint8_t* src,
+    int32_t src_stride,
+    int32_t channels,
+    int32_t scale)
+{
+    int32_t dstw = dst_width;
+    int32_t cn = channels;
+    for (int32_t i = 0; i < dst_height; i++) {
+        const uint8_t* S = src + i * scale * src_stride;
+        uint8_t* D = dst + i * dst_stride;
+        int32_t j = 0;
+        if (cn == 1 && scale == 2) {
+            for (; j <= dstw - 16; j += 16) {
+                vst1q_u8(D + j, vld2q_u8(S + j * 2).val[0]);
+            }
+        } else if (cn == 1 && scale == 4) {
+            for (; j <= dstw - 16; j += 16) {
+                vst1q_u8(D + j, vld4q_u8(S + j * 4).val[0]);
+            }
+        } else if (cn == 3 && scale == 2) {
+            for (; j <= dstw - 16; j += 16) {
+                uint8x16x3_t q0 = vld3q_u8(S + j * 6);
+                uint8x16x3_t q1 = vld3q_u8(S + j * 6 + 48);
+                uint8x16x3_t res;
+                for (int32_t c = 0; c < 3; c++) {
+                    res.val[c] = vuzp1q_u8(q0.val[c], q1.val[c]);
+                }
+                vst3q_u8(D + j * 3, res);
+            }
+        } else if (cn == 3 && scale == 4) {
+            for (; j <= dstw - 16; j += 16) {
+                uint8x16x3_t q0 = vld3q_u8(S + j * 12);
+                uint8x16x3_t q1 = vld3q_u8(S + j * 12 + 48);
+                uint8x16x3_t q2 = vld3q_u8(S + j * 12 + 96);
+                uint8x16x3_t q3 = vld3q_u8(S + j * 12 + 144);
+                uint8x16x3_t res;
+                for (int32_t c = 0; c < 3; c++) {
+                    res.val[c] = vuzp1q_u8(vuzp1q_u8(q0.val[c], q1.val[c]), vuzp1q_u8(q2.val[c], q3.val[c]));
+                }
+                vst3q_u8(D + j * 3, res);
+            }
+        } else if (cn == 4 && scale == 2) {
+            for (; j <= dstw - 4; j += 4) {
+                vst1q_u32((uint32_t*)(D + j * 4), vld2q_u32((const uint32_t*)(S + j * 8)).val[0]);
+            }
+        } else if (cn == 4 && scale == 4) {
+            for (; j <= dstw - 4; j += 4) {
+                vst1q_u32((uint32_t*)(D + j * 4), vld4q_u32((const uint32_t*)(S + j * 16)).val[0]);
+            }
+        }
+        for (; j < dstw; j++) {
+            for (int32_t c = 0; c < cn; c++) {
+                D[j * cn + c] = S[j * scale * cn + c];
+            }
+        }
+    }
 }
 
 bool img_resize_bilinear_neon_shrink2_u8(
@@ -396,45 +462,28 @@ bool img_resize_bilinear_neon_shrink4_u8(
     int32_t cn = channels;
 
     if (cn == 1) {
-        uint8_t* temp_buffer = (uint8_t*)malloc(dst_width * 2 * 2 * sizeof(uint8_t));
-
-        uint16_t* row1_buffer = (uint16_t*)temp_buffer;
-        uint16_t* row2_buffer = (uint16_t*)(temp_buffer + dst_width * 2);
-
         for (int32_t i = 0; i < dsth; i++) {
             const uint8_t* row1 = src + (4 * i + 1) * src_stride;
             const uint8_t* row2 = src + (4 * i + 2) * src_stride;
             int32_t j = 0;
-            // gather
-            for (; j < dstw; j++) {
-                row1_buffer[j] = *((uint16_t*)(row1 + j * 4 + 1));
-                prefetch_l1(row1, j * 4 + 1 + 256);
-                row2_buffer[j] = *((uint16_t*)(row2 + j * 4 + 1));
-                prefetch_l1(row2, j * 4 + 1 + 256);
-            }
-            j = 0;
-            uint8_t* row1_buffer_ptr = (uint8_t*)row1_buffer;
-            uint8_t* row2_buffer_ptr = (uint8_t*)row2_buffer;
-            for (; j <= dstw - 8; j += 8) {
-                uint8x8x2_t q0 = vld2_u8(row1_buffer_ptr + 2 * j);
-                uint8x8x2_t q1 = vld2_u8(row2_buffer_ptr + 2 * j);
-                uint8x8_t q00 = q0.val[0];
-                uint8x8_t q01 = q0.val[1];
-                uint8x8_t q10 = q1.val[0];
-                uint8x8_t q11 = q1.val[1];
-                uint16x8_t res_u16 = vaddq_u16(vaddq_u16(vaddl_u8(q00, q01), vaddl_u8(q10, q11)), vdupq_n_u16(2));
-                uint8x8_t res_u8 = vshrn_n_u16(res_u16, 2);
-                vst1_u8(dst + i * dst_stride + j, res_u8);
+            for (; j <= dstw - 16; j += 16) {
+                // lanes 1 and 2 of every 4 pixel group are the bilinear taps
+                uint8x16x4_t q0 = vld4q_u8(row1 + 4 * j);
+                prefetch_l1(row1, j * 4 + 256);
+                uint8x16x4_t q1 = vld4q_u8(row2 + 4 * j);
+                prefetch_l1(row2, j * 4 + 256);
+                uint16x8_t res_lo = vaddq_u16(vaddl_u8(vget_low_u8(q0.val[1]), vget_low_u8(q0.val[2])),
+                                              vaddl_u8(vget_low_u8(q1.val[1]), vget_low_u8(q1.val[2])));
+                uint16x8_t res_hi = vaddq_u16(vaddl_u8(vget_high_u8(q0.val[1]), vget_high_u8(q0.val[2])),
+                                              vaddl_u8(vget_high_u8(q1.val[1]), vget_high_u8(q1.val[2])));
+                vst1q_u8(dst + i * dst_stride + j, vcombine_u8(vrshrn_n_u16(res_lo, 2), vrshrn_n_u16(res_hi, 2)));
             }
             for (; j < dstw; j++) {
-                for (int32_t c = 0; c < cn; c++) {
-                    dst[i * dst_stride + j] = (row1_buffer_ptr[j * 2 + 0] + row1_buffer_ptr[j * 2 + 1] +
-                                               row2_buffer_ptr[j * 2 + 0] + row2_buffer_ptr[j * 2 + 1] + 2) >>
-                                              2;
-                }
+                dst[i * dst_stride + j] = (row1[j * 4 + 1] + row1[j * 4 + 2] +
+                                           row2[j * 4 + 1] + row2[j * 4 + 2] + 2) >>
+                                          2;
             }
         }
-        free(temp_buffer);
     } else if (cn == 3) {
         uint8x8_t tbl = {0, 1, 2, 4, 5, 6, 0, 0};
         for (int32_t i = 0; i < dsth; i++) {
@@ -561,7 +610,7 @@ bool img_resize_bilinear_neon_shrink6_u8(
     int32_t cn = channels;
 
     if (cn == 1) {
-        uint8_t* temp_buffer = (uint8_t*)malloc(dst_width * 2 * 2 * sizeof(uint8_t));
+        uint8_t* temp_buffer = (uint8_t*)tinycv::ScratchAlloc(dst_width * 2 * 2 * sizeof(uint8_t), 128);
 
         uint16_t* row1_buffer = (uint16_t*)temp_buffer;
         uint16_t* row2_buffer = (uint16_t*)(temp_buffer + dst_width * 2);
@@ -599,7 +648,7 @@ bool img_resize_bilinear_neon_shrink6_u8(
                 }
             }
         }
-        free(temp_buffer);
+        tinycv::ScratchFree(temp_buffer);
     } else if (cn == 3) {
         uint8x8_t tbl = {0, 1, 2, 4, 5, 6, 0, 0};
         for (int32_t i = 0; i < dsth; i++) {
@@ -1108,7 +1157,8 @@ void resize_linear_generic(
     int32_t outHeight,
     int32_t outWdith,
     int32_t outStride,
-    uint8_t* out)
+    uint8_t* out,
+    StreamContext* context = nullptr)
 {
     int32_t w = outWdith;
     int32_t h = outHeight;
@@ -1116,71 +1166,85 @@ void resize_linear_generic(
     double scale_x = (double)inWidth / outWdith;
     double scale_y = (double)inHeight / outHeight;
 
-    int32_t* buf = new int32_t[w + 8 + h + w + h];
+    int32_t* buf = nullptr;
+    bool tables_ready = false;
+    if (context) {
+        // only ResizeLinear passes a context, its mapping follows from the sizes
+        const int32_t key[] = {inHeight, inWidth, channels, outHeight, outWdith};
+        buf = (int32_t*)context->Tables("resize_linear_generic_u8", key, 5, (w + 8 + h + w + h) * sizeof(int32_t), &tables_ready);
+    } else {
+        buf = (int32_t*)tinycv::ScratchAlloc((w + 8 + h + w + h) * sizeof(int32_t), 128);
+    }
+    if (nullptr == buf) {
+        return;
+    }
 
     int32_t* xofs = buf;
-    // preload offset
-    for (int32_t i = 0; i < 8; i++) {
-        xofs[w + i] = 0;
-    }
     int32_t* yofs = buf + w + 8;
 
     int16_t* ialpha = (int16_t*)(buf + w + 8 + h);
     int16_t* ibeta = (int16_t*)(buf + w + 8 + h + w);
 
-    float fx;
-    float fy;
-    int32_t sx;
-    int32_t sy;
-    int32_t srcw = inWidth;
-    int32_t srch = inHeight;
-
-    int16_t* ialphap = ialpha;
-    for (int32_t dx = 0; dx < w; dx++) {
-        fx = (float)((dx + 0.5) * scale_x - 0.5);
-        sx = Floor(fx);
-        fx -= sx;
-
-        if (sx < 0) {
-            sx = 0;
-            fx = 0;
+    if (!tables_ready) {
+        // preload offset
+        for (int32_t i = 0; i < 8; i++) {
+            xofs[w + i] = 0;
         }
 
-        if (sx >= srcw - 1) {
-            sx = srcw - 2;
-            fx = 1.f;
-        }
+        float fx;
+        float fy;
+        int32_t sx;
+        int32_t sy;
+        int32_t srcw = inWidth;
+        int32_t srch = inHeight;
+
+        int16_t* ialphap = ialpha;
+        for (int32_t dx = 0; dx < w; dx++) {
+            fx = (float)((dx + 0.5) * scale_x - 0.5);
+            sx = Floor(fx);
+            fx -= sx;
+
+            if (sx < 0) {
+                sx = 0;
+                fx = 0;
+            }
+
+            if (sx >= srcw - 1) {
+                sx = srcw - 2;
+                fx = 1.f;
+            }
 
 #if offset_precompute
-        xofs[dx] = sx * channels;
+            xofs[dx] = sx * channels;
 #else
-        xofs[dx] = sx;
+            xofs[dx] = sx;
 #endif
 
-        ialphap[0] = HPC::utils::saturate_cast<int16_t>(fx * INTER_RESIZE_COEF_SCALE);
-        ialphap++;
-    }
+            ialphap[0] = HPC::utils::saturate_cast<int16_t>(fx * INTER_RESIZE_COEF_SCALE);
+            ialphap++;
+        }
 
-    int16_t* ibetap = ibeta;
-    for (int32_t dy = 0; dy < h; dy++) {
-        fy = (float)((dy + 0.5) * scale_y - 0.5);
-        sy = Floor(fy);
-        fy -= sy;
+        int16_t* ibetap = ibeta;
+        for (int32_t dy = 0; dy < h; dy++) {
+            fy = (float)((dy + 0.5) * scale_y - 0.5);
+            sy = Floor(fy);
+            fy -= sy;
 
-        if (sy < 0) {
-            sy = 0;
-            fy = 0;
-        }
+            if (sy < 0) {
+                sy = 0;
+                fy = 0;
+            }
 
-        if (sy >= srch - 1) {
-            sy = srch - 2;
-            fy = 1.f;
-        }
+            if (sy >= srch - 1) {
+                sy = srch - 2;
+                fy = 1.f;
+            }
 
-        yofs[dy] = sy;
+            yofs[dy] = sy;
 
-        ibetap[0] = HPC::utils::saturate_cast<int16_t>(fy * INTER_RESIZE_COEF_SCALE);
-        ibetap++;
+            ibetap[0] = HPC::utils::saturate_cast<int16_t>(fy * INTER_RESIZE_COEF_SCALE);
+            ibetap++;
+        }
     }
 
     if (channels == 3) {
@@ -1189,7 +1253,9 @@ void resize_linear_generic(
         resize_generic_8UC4(inHeight, inWidth, inStride, in, outHeight, outWdith, outStride, out, xofs, yofs, ialpha, ibeta, 1);
     }
 
-    delete[] buf;
+    if (!context) {
+        tinycv::ScratchFree(buf);
+    }
 }
 
 void resize_bilinear_rows(
@@ -1548,7 +1614,8 @@ void resize_linear_u8c1orc4(
     uint32_t dstHeight,
     uint32_t dstWidth,
     uint32_t dstStride,
-    uint8_t* dstBase)
+    uint8_t* dstBase,
+    StreamContext* context = nullptr)
 {
     float wr = (float)srcWidth / dstWidth;
     float hr = (float)srcHeight / dstHeight;
@@ -1560,70 +1627,94 @@ void resize_linear_u8c1orc4(
     dsize.width = dstWidth * channels;
     dsize.height = dstHeight;
 
-    std::vector<uint8_t> gcweight((dsize.width + 7) & ~7);
-    std::vector<const uint8_t*> gcols(((dsize.width + 7) & ~7) * 2);
-    std::vector<uint8_t> buf(((ssize.width + 7) & ~7) * 8); // (8 rows) x (width of src)
-
-    float32x4_t vscale_x = vdupq_n_f32(wr);
-    float32x4_t vscale_x_offset = vdupq_n_f32(scale_x_offset);
-    int32x4_t vc1 = vdupq_n_s32(1);
-    float32x4_t vc128f = vdupq_n_f32(128.0f);
-
-    int32x4_t vi;
-    resizeLinearInternals<channels> indexes(vi, srcWidth); // uint32_t is used to store indexes
-                                                           // so we could get issues on src image dimensions greater than (2^32-1)
-
-    for (int32_t dcol = 0; dcol < dsize.width; dcol += 8) {
-        int32_t idx[16];
-
-        float32x4_t vif = vcvtq_f32_s32(vi);
-        float32x4_t vw = vmlaq_f32(vscale_x_offset, vscale_x, vif);
-        int32x4_t vwi = vcvtq_s32_f32(vw);
-        float32x4_t vwif = vcvtq_f32_s32(vwi);
-        int32x4_t vmask = (int32x4_t)vcltq_f32(vwif, vw);
-        int32x4_t vsrch = vsubq_s32(vwi, vmask);
-        int32x4_t vsrcl = vsubq_s32(vsrch, vc1);
-        float32x4_t vsrchf = vcvtq_f32_s32(vsrch);
-        float32x4_t vw2 = vsubq_f32(vsrchf, vw);
-
-        vw2 = vmulq_f32(vw2, vc128f);
-        uint32x4_t vw32u = vcvtq_u32_f32(vw2);
-        uint16x4_t vw16ul = vmovn_u32(vw32u);
-        indexes.updateIndexes(vi, vsrch, vsrcl);
-
-        vst1q_s32(idx + 0, vsrcl);
-        vst1q_s32(idx + 8, vsrch);
-
-        vif = vcvtq_f32_s32(vi);
-        vw = vmlaq_f32(vscale_x_offset, vscale_x, vif);
-        vwi = vcvtq_s32_f32(vw);
-        vwif = vcvtq_f32_s32(vwi);
-        vmask = (int32x4_t)vcltq_f32(vwif, vw);
-        vsrch = vsubq_s32(vwi, vmask);
-        vsrcl = vsubq_s32(vsrch, vc1);
-        vsrchf = vcvtq_f32_s32(vsrch);
-        vw2 = vsubq_f32(vsrchf, vw);
-
-        vw2 = vmulq_f32(vw2, vc128f);
-        vw32u = vcvtq_u32_f32(vw2);
-        indexes.updateIndexes(vi, vsrch, vsrcl);
-
-        uint16x4_t vw16uh = vmovn_u32(vw32u);
-
-        vst1q_s32(idx + 4, vsrcl);
-        vst1q_s32(idx + 12, vsrch);
-
-        uint8x8_t vw8u = vmovn_u16(vcombine_u16(vw16ul, vw16uh));
+    // the column pointers point into buf, a context keeps it in the same block as the tables
+    uint64_t size_for_gcols = align_size(((dsize.width + 7) & ~7) * 2 * sizeof(const uint8_t*), 128);
+    uint64_t size_for_gcweight = align_size((dsize.width + 7) & ~7, 128);
+    uint64_t size_for_buf = ((ssize.width + 7) & ~7) * 8; // (8 rows) x (width of src)
+
+    uint8_t* buffer_ = nullptr;
+    bool tables_ready = false;
+    if (context) {
+        // only ResizeLinear passes a context, its mapping follows from the sizes
+        const int32_t key[] = {(int32_t)srcHeight, (int32_t)srcWidth, channels, (int32_t)dstHeight, (int32_t)dstWidth};
+        buffer_ = (uint8_t*)context->Tables("resize_linear_u8c1orc4", key, 5, size_for_gcols + size_for_gcweight + size_for_buf, &tables_ready);
+    } else {
+        buffer_ = (uint8_t*)tinycv::ScratchAlloc(size_for_gcols + size_for_gcweight + size_for_buf, 128);
+    }
+    if (nullptr == buffer_) {
+        return;
+    }
+    const uint8_t** gcols = (const uint8_t**)buffer_;
+    uint8_t* gcweight = buffer_ + size_for_gcols;
+    uint8_t* buf = gcweight + size_for_gcweight;
+    memset(buf, 0, size_for_buf);
+
+    if (!tables_ready) {
+        float32x4_t vscale_x = vdupq_n_f32(wr);
+        float32x4_t vscale_x_offset = vdupq_n_f32(scale_x_offset);
+        int32x4_t vc1 = vdupq_n_s32(1);
+        float32x4_t vc128f = vdupq_n_f32(128.0f);
+
+        int32x4_t vi;
+        resizeLinearInternals<channels> indexes(vi, srcWidth); // uint32_t is used to store indexes
+                                                               // so we could get issues on src image dimensions greater than (2^32-1)
+
+        for (int32_t dcol = 0; dcol < dsize.width; dcol += 8) {
+            int32_t idx[16];
+
+            float32x4_t vif = vcvtq_f32_s32(vi);
+            float32x4_t vw = vmlaq_f32(vscale_x_offset, vscale_x, vif);
+            int32x4_t vwi = vcvtq_s32_f32(vw);
+            float32x4_t vwif = vcvtq_f32_s32(vwi);
+            int32x4_t vmask = (int32x4_t)vcltq_f32(vwif, vw);
+            int32x4_t vsrch = vsubq_s32(vwi, vmask);
+            int32x4_t vsrcl = vsubq_s32(vsrch, vc1);
+            float32x4_t vsrchf = vcvtq_f32_s32(vsrch);
+            float32x4_t vw2 = vsubq_f32(vsrchf, vw);
+
+            vw2 = vmulq_f32(vw2, vc128f);
+            uint32x4_t vw32u = vcvtq_u32_f32(vw2);
+            uint16x4_t vw16ul = vmovn_u32(vw32u);
+            indexes.updateIndexes(vi, vsrch, vsrcl);
+
+            vst1q_s32(idx + 0, vsrcl);
+            vst1q_s32(idx + 8, vsrch);
+
+            vif = vcvtq_f32_s32(vi);
+            vw = vmlaq_f32(vscale_x_offset, vscale_x, vif);
+            vwi = vcvtq_s32_f32(vw);
+            vwif = vcvtq_f32_s32(vwi);
+            vmask = (int32x4_t)vcltq_f32(vwif, vw);
+            vsrch = vsubq_s32(vwi, vmask);
+            vsrcl = vsubq_s32(vsrch, vc1);
+            vsrchf = vcvtq_f32_s32(vsrch);
+            vw2 = vsubq_f32(vsrchf, vw);
+
+            vw2 = vmulq_f32(vw2, vc128f);
+            vw32u = vcvtq_u32_f32(vw2);
+            indexes.updateIndexes(vi, vsrch, vsrcl);
+
+            uint16x4_t vw16uh = vmovn_u32(vw32u);
+
+            vst1q_s32(idx + 4, vsrcl);
+            vst1q_s32(idx + 12, vsrch);
+
+            uint8x8_t vw8u = vmovn_u16(vcombine_u16(vw16ul, vw16uh));
+
+            for (uint32_t i = 0; i < 8; ++i) {
+                gcols[dcol * 2 + i * 2] = &buf[idx[i]];
+                gcols[dcol * 2 + i * 2 + 1] = &buf[idx[i + 8]];
+            }
 
-        for (uint32_t i = 0; i < 8; ++i) {
-            gcols[dcol * 2 + i * 2] = &buf[idx[i]];
-            gcols[dcol * 2 + i * 2 + 1] = &buf[idx[i + 8]];
+            vst1_u8(&gcweight[dcol], vw8u);
         }
-
-        vst1_u8(&gcweight[dcol], vw8u);
     }
 
-    resize_bilinear_rows(ssize, dsize, srcBase, srcStride, dstBase, dstStride, hr, &gcols[0], &gcweight[0], &buf[0]);
+    resize_bilinear_rows(ssize, dsize, srcBase, srcStride, dstBase, dstStride, hr, gcols, gcweight, buf);
+
+    if (!context) {
+        tinycv::ScratchFree(buffer_);
+    }
 }
 
 static void img_resize_cal_offset_linear_uchar(
@@ -1639,14 +1730,15 @@ static void img_resize_cal_offset_linear_uchar(
     int32_t srch,
     int32_t dstw,
     int32_t dsth,
-    int32_t channels)
+    int32_t channels,
+    double scale_x,
+    double scale_y,
+    double origin_x,
+    double origin_y,
+    int32_t out_x,
+    int32_t out_y)
 {
-    float inv_scale_x = (float)dstw / srcw;
-    float inv_scale_y = (float)dsth / srch;
-
     int32_t cn = channels;
-    float scale_x = 1. / inv_scale_x;
-    float scale_y = 1. / inv_scale_y;
     int32_t k, sx, sy, dx, dy;
 
     float fx, fy;
@@ -1654,7 +1746,7 @@ static void img_resize_cal_offset_linear_uchar(
     float cbuf[MAX_ESIZE];
 
     for (dx = 0; dx < dstw; dx++) {
-        fx = (float)((dx + 0.5) * scale_x - 0.5);
+        fx = (float)((out_x + dx + 0.5) * scale_x - 0.5 + origin_x);
         sx = img_floor(fx);
         fx -= sx;
 
@@ -1683,7 +1775,7 @@ static void img_resize_cal_offset_linear_uchar(
     }
 
     for (dy = 0; dy < dsth; dy++) {
-        fy = (float)((dy + 0.5) * scale_y - 0.5);
+        fy = (float)((out_y + dy + 0.5) * scale_y - 0.5 + origin_y);
         sy = img_floor(fy);
         fy -= sy;
 
@@ -1927,7 +2019,8 @@ static void img_resize_generic_linear_neon_uchar(
     int32_t dstw,
     int32_t dsth,
     int32_t dststep,
-    int32_t channels)
+    int32_t channels,
+    int32_t* row_buffer)
 {
     const int16_t* alpha = _alpha;
     const int16_t* beta = _beta;
@@ -1939,7 +2032,7 @@ static void img_resize_generic_linear_neon_uchar(
     // int32_t dststep = (int32_t) align_size (dstw, 4);
     //  int32_t dststep = dstw;
 
-    int32_t* buffer_ = (int32_t*)malloc(bufstep * ksize * sizeof(int32_t));
+    int32_t* buffer_ = row_buffer ? row_buffer : (int32_t*)tinycv::ScratchAlloc(bufstep * ksize * sizeof(int32_t), 128);
 
     const uint8_t* srows[MAX_ESIZE];
     int32_t* rows[MAX_ESIZE];
@@ -1982,7 +2075,9 @@ static void img_resize_generic_linear_neon_uchar(
         img_vresize_linear_neon_uchar((const int32_t**)rows, (uint8_t*)(dst + dststep * dy), beta, dstw);
     }
 
-    free(buffer_);
+    if (!row_buffer) {
+        tinycv::ScratchFree(buffer_);
+    }
     buffer_ = NULL;
 }
 
@@ -1995,14 +2090,15 @@ void img_resize_bilinear_neon_uchar(
     uint32_t src_width,
     uint32_t src_height,
     uint32_t src_stride,
-    uint32_t channels)
+    uint32_t channels,
+    StreamContext* context = nullptr)
 {
     if (src_width % 2 == 0 && dst_width == src_width / 2 &&
         src_height % 2 == 0 && dst_height == src_height / 2) {
         img_resize_bilinear_neon_shrink2_u8(dst, dst_width, dst_height, dst_stride, src, src_width, src_height, src_stride, channels);
         return;
     } else if (src_width % 4 == 0 && dst_width == src_width / 4 &&
-               src_height % 4 == 0 && dst_height == src_height / 4 && channels != 1) {
+               src_height % 4 == 0 && dst_height == src_height / 4) {
         img_resize_bilinear_neon_shrink4_u8(dst, dst_width, dst_height, dst_stride, src, src_width, src_height, src_stride, channels);
         return;
     } else if (src_width % 6 == 0 && dst_width == src_width / 6 &&
@@ -2021,14 +2117,14 @@ void img_resize_bilinear_neon_uchar(
                 src_width >= dst_width && src_width >= 2;
     bool flag_c1orc4 = dst_height >= 8 && dst_width >= 8;
     if (3 == cn && flag) {
-        resize_linear_generic(3, src_height, src_width, src_stride, src, dst_height, dst_width, dst_stride, dst);
+        resize_linear_generic(3, src_height, src_width, src_stride, src, dst_height, dst_width, dst_stride, dst, context);
         return;
     } else if (4 == cn && flag_c1orc4) {
         // resize_linear_generic(4, src_height, src_width, src_stride, src, dst_height, dst_width, dst_stride, dst);
-        resize_linear_u8c1orc4<4>(src_height, src_width, src_stride, src, dst_height, dst_width, dst_stride, dst);
+        resize_linear_u8c1orc4<4>(src_height, src_width, src_stride, src, dst_height, dst_width, dst_stride, dst, context);
         return;
     } else if (1 == cn && flag_c1orc4) {
-        resize_linear_u8c1orc4<1>(src_height, src_width, src_stride, src, dst_height, dst_width, dst_stride, dst);
+        resize_linear_u8c1orc4<1>(src_height, src_width, src_stride, src, dst_height, dst_width, dst_stride, dst, context);
         return;
     }
 
@@ -2041,17 +2137,44 @@ void img_resize_bilinear_neon_uchar(
     ksize = 2;
     ksize2 = ksize / 2;
 
-    uint8_t* buffer_ = (uint8_t*)malloc((width + dsth) * (sizeof(int32_t) + sizeof(float) * ksize));
+    // xmin and xmax are kept in front of the tables so a context can hand all of them back
+    uint64_t size_for_range = 128;
+    uint64_t size_for_tables = align_size((width + dsth) * (sizeof(int32_t) + sizeof(float) * ksize), 128);
+    uint64_t size_for_rows = align_size(width, 16) * ksize * sizeof(int32_t);
+
+    uint8_t* buffer_ = nullptr;
+    bool tables_ready = false;
+    if (context) {
+        // only ResizeLinear passes a context, its mapping follows from the sizes
+        const int32_t key[] = {srch, srcw, cn, dsth, dstw};
+        buffer_ = (uint8_t*)context->Tables("resize_linear_u8", key, 5, size_for_range + size_for_tables + size_for_rows, &tables_ready);
+    } else {
+        buffer_ = (uint8_t*)tinycv::ScratchAlloc(size_for_range + size_for_tables, 128);
+    }
+    if (nullptr == buffer_) {
+        return;
+    }
 
-    int32_t* xofs = (int32_t*)buffer_;
+    int32_t* range = (int32_t*)buffer_;
+    int32_t* xofs = (int32_t*)(buffer_ + size_for_range);
     int32_t* yofs = xofs + width;
     int16_t* ialpha = (int16_t*)(yofs + dsth);
     int16_t* ibeta = ialpha + width * ksize;
+    int32_t* rows = context ? (int32_t*)(buffer_ + size_for_range + size_for_tables) : nullptr;
+
+    if (!tables_ready) {
+        range[0] = xmin;
+        range[1] = xmax;
+        float scale_x = 1. / ((float)dstw / srcw);
+        float scale_y = 1. / ((float)dsth / srch);
+        img_resize_cal_offset_linear_uchar(xofs, ialpha, yofs, ibeta, &range[0], &range[1], ksize, ksize2, srcw, srch, dstw, dsth, cn, scale_x, scale_y, 0.0, 0.0, 0, 0);
+    }
 
-    img_resize_cal_offset_linear_uchar(xofs, ialpha, yofs, ibeta, &xmin, &xmax, ksize, ksize2, srcw, srch, dstw, dsth, cn);
+    img_resize_generic_linear_neon_uchar(src, dst, xofs, ialpha, yofs, ibeta, range[0], range[1], ksize, srcw, srch, src_stride, dstw, dsth, dst_stride, cn, rows);
 
-    img_resize_generic_linear_neon_uchar(src, dst, xofs, ialpha, yofs, ibeta, xmin, xmax, ksize, srcw, srch, src_stride, dstw, dsth, dst_stride, cn);
-    free(buffer_);
+    if (!context) {
+        tinycv::ScratchFree(buffer_);
+    }
     buffer_ = NULL;
 }
 
@@ -2180,7 +2303,7 @@ void img_resize_area_neon_uchar(
     ksize = 2;
     ksize2 = ksize / 2;
 
-    uint8_t* buffer_ = (uint8_t*)malloc((width + dsth) * (sizeof(int32_t) + sizeof(float) * ksize));
+    uint8_t* buffer_ = (uint8_t*)tinycv::ScratchAlloc((width + dsth) * (sizeof(int32_t) + sizeof(float) * ksize), 128);
 
     int32_t* xofs = (int32_t*)buffer_;
     int32_t* yofs = xofs + width;
@@ -2189,8 +2312,8 @@ void img_resize_area_neon_uchar(
 
     img_resize_cal_offset_area_uchar(xofs, ialpha, yofs, ibeta, &xmin, &xmax, ksize, ksize2, srcw, srch, dstw, dsth, cn);
 
-    img_resize_generic_linear_neon_uchar(src, dst, xofs, ialpha, yofs, ibeta, xmin, xmax, ksize, srcw, srch, src_stride, dstw, dsth, dst_stride, cn);
-    free(buffer_);
+    img_resize_generic_linear_neon_uchar(src, dst, xofs, ialpha, yofs, ibeta, xmin, xmax, ksize, srcw, srch, src_stride, dstw, dsth, dst_stride, cn, nullptr);
+    tinycv::ScratchFree(buffer_);
     buffer_ = NULL;
 }
 
@@ -2209,7 +2332,7 @@ void resizeAreaFast(
     int32_t scale_y = inHeight / outHeight;
     int32_t area = scale_x * scale_y;
     // size_t srcstep = inWidthStride / (sizeof(Tsrc));
-    int32_t* _ofs = (int32_t*)malloc((area + outWidth * nc) * sizeof(int32_t));
+    int32_t* _ofs = (int32_t*)tinycv::ScratchAlloc((area + outWidth * nc) * sizeof(int32_t), 128);
     int32_t *ofs = _ofs, *xofs = ofs + area;
     for (int32_t sy = 0, k = 0; sy < scale_y; ++sy) {
         for (int32_t sx = 0; sx < scale_x; ++sx) {
@@ -2262,7 +2385,7 @@ void resizeAreaFast(
             D[dx] = img_saturate_cast<Tdst>((float)sum / count);
         }
     }
-    free(_ofs);
+    tinycv::ScratchFree(_ofs);
 }
 
 static int32_t computeResizeAreaTab(int32_t src_size, int32_t dst_size, int32_t cn, double scale, DecimateAlpha* tab)
@@ -2321,7 +2444,7 @@ void resizeAreaShrinkx8<uint8_t, 3, uint8_t, 3, 3>(
 {
     const int32_t nc = 3;
 
-    DecimateAlpha* _xytab = (DecimateAlpha*)malloc((inHeight + inWidth) * 2 * sizeof(DecimateAlpha));
+    DecimateAlpha* _xytab = (DecimateAlpha*)tinycv::ScratchAlloc((inHeight + inWidth) * 2 * sizeof(DecimateAlpha), 128);
     DecimateAlpha *xtab = _xytab, *ytab = xtab + inWidth * 2;
 
     int32_t xtab_size = computeResizeAreaTab(inWidth, outWidth, nc, double(inWidth) / outWidth, xtab);
@@ -2329,7 +2452,7 @@ void resizeAreaShrinkx8<uint8_t, 3, uint8_t, 3, 3>(
 
     // create x direction histgram
     int32_t xtab_hist_num = 0;
-    int32_t* xtab_hist = (int32_t*)malloc(xtab_size * sizeof(int32_t));
+    int32_t* xtab_hist = (int32_t*)tinycv::ScratchAlloc(xtab_size * sizeof(int32_t), 128);
     for (int32_t i = 1; i < xtab_size; ++i) {
         if (xtab[i].di != xtab[i - 1].di) {
             xtab_hist[xtab_hist_num] = i;
@@ -2339,7 +2462,7 @@ void resizeAreaShrinkx8<uint8_t, 3, uint8_t, 3, 3>(
     xtab_hist[xtab_hist_num] = xtab_size;
     ++xtab_hist_num;
 
-    int32_t* tabofs = (int32_t*)malloc((outHeight + 1) * sizeof(int32_t));
+    int32_t* tabofs = (int32_t*)tinycv::ScratchAlloc((outHeight + 1) * sizeof(int32_t), 128);
     int32_t k, dy;
     int32_t h;
     for (k = 0, dy = 0; k < ytab_size; ++k) {
@@ -2350,7 +2473,7 @@ void resizeAreaShrinkx8<uint8_t, 3, uint8_t, 3, 3>(
     tabofs[dy] = ytab_size;
 
     outWidth *= nc;
-    float* _buffer = (float*)malloc(outWidth * 2 * sizeof(float));
+    float* _buffer = (float*)tinycv::ScratchAlloc(outWidth * 2 * sizeof(float), 128);
     float *buf = _buffer, *sum = buf + outWidth;
     int32_t j_start = tabofs[0], j_end = tabofs[outHeight], j, dx, prev_dy = ytab[j_start].di;
 
@@ -2395,13 +2518,13 @@ void resizeAreaShrinkx8<uint8_t, 3, uint8_t, 3, 3>(
         D[dx] = (uint8_t)sum[dx];
     }
 
-    free(xtab_hist);
+    tinycv::ScratchFree(xtab_hist);
     xtab_hist = NULL;
-    free(_xytab);
+    tinycv::ScratchFree(_xytab);
     _xytab = NULL;
-    free(tabofs);
+    tinycv::ScratchFree(tabofs);
     tabofs = NULL;
-    free(_buffer);
+    tinycv::ScratchFree(_buffer);
     _buffer = NULL;
 }
 
@@ -2418,7 +2541,7 @@ void resizeAreaShrinkx8<uint8_t, 4, uint8_t, 4, 4>(
 {
     const int32_t nc = 4;
 
-    DecimateAlpha* _xytab = (DecimateAlpha*)malloc((inHeight + inWidth) * 2 * sizeof(DecimateAlpha));
+    DecimateAlpha* _xytab = (DecimateAlpha*)tinycv::ScratchAlloc((inHeight + inWidth) * 2 * sizeof(DecimateAlpha), 128);
     DecimateAlpha *xtab = _xytab, *ytab = xtab + inWidth * 2;
 
     int32_t xtab_size = computeResizeAreaTab(inWidth, outWidth, nc, double(inWidth) / outWidth, xtab);
@@ -2426,7 +2549,7 @@ void resizeAreaShrinkx8<uint8_t, 4, uint8_t, 4, 4>(
 
     // create x direction histgram
     int32_t xtab_hist_num = 0;
-    int32_t* xtab_hist = (int32_t*)malloc(xtab_size * sizeof(int32_t));
+    int32_t* xtab_hist = (int32_t*)tinycv::ScratchAlloc(xtab_size * sizeof(int32_t), 128);
     for (int32_t i = 1; i < xtab_size; ++i) {
         if (xtab[i].di != xtab[i - 1].di) {
             xtab_hist[xtab_hist_num] = i;
@@ -2436,7 +2559,7 @@ void resizeAreaShrinkx8<uint8_t, 4, uint8_t, 4, 4>(
     xtab_hist[xtab_hist_num] = xtab_size;
     ++xtab_hist_num;
 
-    int32_t* tabofs = (int32_t*)malloc((outHeight + 1) * sizeof(int32_t));
+    int32_t* tabofs = (int32_t*)tinycv::ScratchAlloc((outHeight + 1) * sizeof(int32_t), 128);
     int32_t k, dy;
     int32_t h;
     for (k = 0, dy = 0; k < ytab_size; ++k) {
@@ -2447,7 +2570,7 @@ void resizeAreaShrinkx8<uint8_t, 4, uint8_t, 4, 4>(
     tabofs[dy] = ytab_size;
 
     outWidth *= nc;
-    float* _buffer = (float*)malloc(outWidth * 2 * sizeof(float));
+    float* _buffer = (float*)tinycv::ScratchAlloc(outWidth * 2 * sizeof(float), 128);
     float *buf = _buffer, *sum = buf + outWidth;
     int32_t j_start = tabofs[0], j_end = tabofs[outHeight], j, dx, prev_dy = ytab[j_start].di;
 
@@ -2540,16 +2663,109 @@ void resizeAreaShrinkx8<uint8_t, 4, uint8_t, 4, 4>(
         D[dx] = (uint8_t)sum[dx];
     }
 
-    free(xtab_hist);
+    tinycv::ScratchFree(xtab_hist);
     xtab_hist = NULL;
-    free(_xytab);
+    tinycv::ScratchFree(_xytab);
     _xytab = NULL;
-    free(tabofs);
+    tinycv::ScratchFree(tabofs);
     tabofs = NULL;
-    free(_buffer);
+    tinycv::ScratchFree(_buffer);
     _buffer = NULL;
 }
 
+// cvRound(sum / 16) of a 4x4 box sum, ties go to even like the generic area path in OpenCV
+static inline uint8x8_t img_area_round16_u16(uint16x8_t sum)
+{
+    uint16x8_t odd = vandq_u16(vshrq_n_u16(sum, 4), vdupq_n_u16(1));
+    return vshrn_n_u16(vaddq_u16(sum, vaddq_u16(odd, vdupq_n_u16(7))), 4);
+}
+
+// exact 1/4 area downscale, pairwise widening adds keep the whole 4x4 box sum in 16 bit lanes
+static void img_resize_area_neon_shrink4_u8(
+    uint8_t* dst,
+    int32_t dst_width,
+    int32_t dst_height,
+    int32_t dst_stride,
+    const uint8_t* src,
+    int32_t src_stride,
+    int32_t channels)
+{
+    int32_t dstw = dst_width;
+    int32_t cn = channels;
+    for (int32_t i = 0; i < dst_height; i++) {
+        const uint8_t* rows[4];
+        for (int32_t k = 0; k < 4; k++) {
+            rows[k] = src + (4 * i + k) * src_stride;
+        }
+        uint8_t* D = dst + i * dst_stride;
+        int32_t j = 0;
+        if (cn == 1) {
+            for (; j <= dstw - 8; j += 8) {
+                uint16x8_t acc0 = vdupq_n_u16(0);
+                uint16x8_t acc1 = vdupq_n_u16(0);
+                for (int32_t k = 0; k < 4; k++) {
+                    acc0 = vpadalq_u8(acc0, vld1q_u8(rows[k] + j * 4));
+                    acc1 = vpadalq_u8(acc1, vld1q_u8(rows[k] + j * 4 + 16));
+                }
+                vst1_u8(D + j, img_area_round16_u16(vpaddq_u16(acc0, acc1)));
+            }
+        } else if (cn == 3) {
+            for (; j <= dstw - 8; j += 8) {
+                uint16x8_t acc0[3], acc1[3];
+                for (int32_t c = 0; c < 3; c++) {
+                    acc0[c] = vdupq_n_u16(0);
+                    acc1[c] = vdupq_n_u16(0);
+                }
+                for (int32_t k = 0; k < 4; k++) {
+                    uint8x16x3_t q0 = vld3q_u8(rows[k] + j * 12);
+                    uint8x16x3_t q1 = vld3q_u8(rows[k] + j * 12 + 48);
+                    for (int32_t c = 0; c < 3; c++) {
+                        acc0[c] = vpadalq_u8(acc0[c], q0.val[c]);
+                        acc1[c] = vpadalq_u8(acc1[c], q1.val[c]);
+                    }
+                }
+                uint8x8x3_t res;
+                for (int32_t c = 0; c < 3; c++) {
+                    res.val[c] = img_area_round16_u16(vpaddq_u16(acc0[c], acc1[c]));
+                }
+                vst3_u8(D + j * 3, res);
+            }
+        } else if (cn == 4) {
+            for (; j <= dstw - 8; j += 8) {
+                uint16x8_t acc0[4], acc1[4];
+                for (int32_t c = 0; c < 4; c++) {
+                    acc0[c] = vdupq_n_u16(0);
+                    acc1[c] = vdupq_n_u16(0);
+                }
+                for (int32_t k = 0; k < 4; k++) {
+                    uint8x16x4_t q0 = vld4q_u8(rows[k] + j * 16);
+                    uint8x16x4_t q1 = vld4q_u8(rows[k] + j * 16 + 64);
+                    for (int32_t c = 0; c < 4; c++) {
+                        acc0[c] = vpadalq_u8(acc0[c], q0.val[c]);
+                        acc1[c] = vpadalq_u8(acc1[c], q1.val[c]);
+                    }
+                }
+                uint8x8x4_t res;
+                for (int32_t c = 0; c < 4; c++) {
+                    res.val[c] = img_area_round16_u16(vpaddq_u16(acc0[c], acc1[c]));
+                }
+                vst4_u8(D + j * 4, res);
+            }
+        }
+        for (; j < dstw; j++) {
+            for (int32_t c = 0; c < cn; c++) {
+                int32_t sum = 0;
+                for (int32_t k = 0; k < 4; k++) {
+                    for (int32_t x = 0; x < 4; x++) {
+                        sum += rows[k][(j * 4 + x) * cn + c];
+                    }
+                }
+                D[j * cn + c] = (sum + 7 + ((sum >> 4) & 1)) >> 4;
+            }
+        }
+    }
+}
+
 template <typename Tsrc, int32_t ncSrc, typename Tdst, int32_t ncDst, int32_t nc>
 void resizeArea(
     int32_t inHeight,
@@ -2566,18 +2782,23 @@ void resizeArea(
         img_resize_bilinear_neon_shrink2_u8(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, nc);
         return;
     }
+    if (inWidth % 4 == 0 && outWidth == inWidth / 4 &&
+        inHeight % 4 == 0 && outHeight == inHeight / 4) {
+        img_resize_area_neon_shrink4_u8(outData, outWidth, outHeight, outWidthStride, inData, inWidthStride, nc);
+        return;
+    }
     if (inWidth % outWidth == 0 && inHeight % outHeight == 0) {
         resizeAreaFast<Tsrc, ncSrc, Tdst, ncDst, nc>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
         return;
     }
 
-    DecimateAlpha* _xytab = (DecimateAlpha*)malloc((inHeight + inWidth) * 2 * sizeof(DecimateAlpha));
+    DecimateAlpha* _xytab = (DecimateAlpha*)tinycv::ScratchAlloc((inHeight + inWidth) * 2 * sizeof(DecimateAlpha), 128);
     DecimateAlpha *xtab = _xytab, *ytab = xtab + inWidth * 2;
 
     int32_t xtab_size = computeResizeAreaTab(inWidth, outWidth, nc, double(inWidth) / outWidth, xtab);
     int32_t ytab_size = computeResizeAreaTab(inHeight, outHeight, 1, double(inHeight) / outHeight, ytab);
 
-    int32_t* tabofs = (int32_t*)malloc((outHeight + 1) * sizeof(int32_t));
+    int32_t* tabofs = (int32_t*)tinycv::ScratchAlloc((outHeight + 1) * sizeof(int32_t), 128);
     int32_t k, dy;
     for (k = 0, dy = 0; k < ytab_size; ++k) {
         if (k == 0 || ytab[k].di != ytab[k - 1].di) {
@@ -2587,7 +2808,7 @@ void resizeArea(
     tabofs[dy] = ytab_size;
 
     outWidth *= nc;
-    float* _buffer = (float*)malloc(outWidth * 2 * sizeof(float));
+    float* _buffer = (float*)tinycv::ScratchAlloc(outWidth * 2 * sizeof(float), 128);
     float *buf = _buffer, *sum = buf + outWidth;
     int32_t j_start = tabofs[0], j_end = tabofs[outHeight], j, dx, prev_dy = ytab[j_start].di;
 
@@ -2629,12 +2850,12 @@ void resizeArea(
         D[dx] = (Tdst)sum[dx];
     }
 
-    free(_xytab);
+    tinycv::ScratchFree(_xytab);
     _xytab = NULL;
-    free(tabofs);
+    tinycv::ScratchFree(tabofs);
     tabofs = NULL;
 
-    free(_buffer);
+    tinycv::ScratchFree(_buffer);
     _buffer = NULL;
 }
 
@@ -2654,6 +2875,11 @@ void resizeArea<uint8_t, 3, uint8_t, 3, 3>(
         img_resize_bilinear_neon_shrink2_u8(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 3);
         return;
     }
+    if (inWidth % 4 == 0 && outWidth == inWidth / 4 &&
+        inHeight % 4 == 0 && outHeight == inHeight / 4) {
+        img_resize_area_neon_shrink4_u8(outData, outWidth, outHeight, outWidthStride, inData, inWidthStride, 3);
+        return;
+    }
     if (inWidth % outWidth == 0 && inHeight % outHeight == 0) {
         resizeAreaFast<uint8_t, 3, uint8_t, 3, 3>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
         return;
@@ -2664,13 +2890,13 @@ void resizeArea<uint8_t, 3, uint8_t, 3, 3>(
     }
     const int32_t nc = 3;
 
-    DecimateAlpha* _xytab = (DecimateAlpha*)malloc((inHeight + inWidth) * 2 * sizeof(DecimateAlpha));
+    DecimateAlpha* _xytab = (DecimateAlpha*)tinycv::ScratchAlloc((inHeight + inWidth) * 2 * sizeof(DecimateAlpha), 128);
     DecimateAlpha *xtab = _xytab, *ytab = xtab + inWidth * 2;
 
     int32_t xtab_size = computeResizeAreaTab(inWidth, outWidth, nc, double(inWidth) / outWidth, xtab);
     int32_t ytab_size = computeResizeAreaTab(inHeight, outHeight, 1, double(inHeight) / outHeight, ytab);
 
-    int32_t* tabofs = (int32_t*)malloc((outHeight + 1) * sizeof(int32_t));
+    int32_t* tabofs = (int32_t*)tinycv::ScratchAlloc((outHeight + 1) * sizeof(int32_t), 128);
     int32_t k, dy;
     for (k = 0, dy = 0; k < ytab_size; ++k) {
         if (k == 0 || ytab[k].di != ytab[k - 1].di) {
@@ -2680,7 +2906,7 @@ void resizeArea<uint8_t, 3, uint8_t, 3, 3>(
     tabofs[dy] = ytab_size;
 
     outWidth *= nc;
-    float* _buffer = (float*)malloc(outWidth * 2 * sizeof(float));
+    float* _buffer = (float*)tinycv::ScratchAlloc(outWidth * 2 * sizeof(float), 128);
     float *buf = _buffer, *sum = buf + outWidth;
     int32_t j_start = tabofs[0], j_end = tabofs[outHeight], j, dx, prev_dy = ytab[j_start].di;
 
@@ -2721,11 +2947,11 @@ void resizeArea<uint8_t, 3, uint8_t, 3, 3>(
         D[dx] = (uint8_t)sum[dx];
     }
 
-    free(_xytab);
+    tinycv::ScratchFree(_xytab);
     _xytab = NULL;
-    free(tabofs);
+    tinycv::ScratchFree(tabofs);
     tabofs = NULL;
-    free(_buffer);
+    tinycv::ScratchFree(_buffer);
     _buffer = NULL;
 }
 
@@ -2745,6 +2971,11 @@ void resizeArea<uint8_t, 4, uint8_t, 4, 4>(
         img_resize_bilinear_neon_shrink2_u8(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 4);
         return;
     }
+    if (inWidth % 4 == 0 && outWidth == inWidth / 4 &&
+        inHeight % 4 == 0 && outHeight == inHeight / 4) {
+        img_resize_area_neon_shrink4_u8(outData, outWidth, outHeight, outWidthStride, inData, inWidthStride, 4);
+        return;
+    }
     if (inWidth % outWidth == 0 && inHeight % outHeight == 0) {
         resizeAreaFast<uint8_t, 4, uint8_t, 4, 4>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
         return;
@@ -2756,13 +2987,13 @@ void resizeArea<uint8_t, 4, uint8_t, 4, 4>(
 
     const int32_t nc = 4;
 
-    DecimateAlpha* _xytab = (DecimateAlpha*)malloc((inHeight + inWidth) * 2 * sizeof(DecimateAlpha));
+    DecimateAlpha* _xytab = (DecimateAlpha*)tinycv::ScratchAlloc((inHeight + inWidth) * 2 * sizeof(DecimateAlpha), 128);
     DecimateAlpha *xtab = _xytab, *ytab = xtab + inWidth * 2;
 
     int32_t xtab_size = computeResizeAreaTab(inWidth, outWidth, nc, double(inWidth) / outWidth, xtab);
     int32_t ytab_size = computeResizeAreaTab(inHeight, outHeight, 1, double(inHeight) / outHeight, ytab);
 
-    int32_t* tabofs = (int32_t*)malloc((outHeight + 1) * sizeof(int32_t));
+    int32_t* tabofs = (int32_t*)tinycv::ScratchAlloc((outHeight + 1) * sizeof(int32_t), 128);
     int32_t k, dy;
     for (k = 0, dy = 0; k < ytab_size; ++k) {
         if (k == 0 || ytab[k].di != ytab[k - 1].di) {
@@ -2772,7 +3003,7 @@ void resizeArea<uint8_t, 4, uint8_t, 4, 4>(
     tabofs[dy] = ytab_size;
 
     outWidth *= nc;
-    float* _buffer = (float*)malloc(outWidth * 2 * sizeof(float));
+    float* _buffer = (float*)tinycv::ScratchAlloc(outWidth * 2 * sizeof(float), 128);
     float *buf = _buffer, *sum = buf + outWidth;
     int32_t j_start = tabofs[0], j_end = tabofs[outHeight], j, dx, prev_dy = ytab[j_start].di;
 
@@ -2813,11 +3044,11 @@ void resizeArea<uint8_t, 4, uint8_t, 4, 4>(
         D[dx] = (uint8_t)sum[dx];
     }
 
-    free(_xytab);
+    tinycv::ScratchFree(_xytab);
     _xytab = NULL;
-    free(tabofs);
+    tinycv::ScratchFree(tabofs);
     tabofs = NULL;
-    free(_buffer);
+    tinycv::ScratchFree(_buffer);
     _buffer = NULL;
 }
 
@@ -2838,6 +3069,11 @@ void ResizeNearestPoint<uint8_t, 1>(
     if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
         return;
     }
+    if ((outHeight * 2 == inHeight && outWidth * 2 == inWidth) ||
+        (outHeight * 4 == inHeight && outWidth * 4 == inWidth)) {
+        img_resize_nearest_neon_shrink_u8(outData, outWidth, outHeight, outWidthStride, inData, inWidthStride, 1, inHeight / outHeight);
+        return;
+    }
     resizeNearestPoint<uint8_t, uint8_t, 1>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
 }
 
@@ -2858,6 +3094,11 @@ void ResizeNearestPoint<uint8_t, 3>(
     if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
         return;
     }
+    if ((outHeight * 2 == inHeight && outWidth * 2 == inWidth) ||
+        (outHeight * 4 == inHeight && outWidth * 4 == inWidth)) {
+        img_resize_nearest_neon_shrink_u8(outData, outWidth, outHeight, outWidthStride, inData, inWidthStride, 3, inHeight / outHeight);
+        return;
+    }
     resizeNearestPoint<uint8_t, uint8_t, 3>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
 }
 
@@ -2878,6 +3119,11 @@ void ResizeNearestPoint<uint8_t, 4>(
     if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
         return;
     }
+    if ((outHeight * 2 == inHeight && outWidth * 2 == inWidth) ||
+        (outHeight * 4 == inHeight && outWidth * 4 == inWidth)) {
+        img_resize_nearest_neon_shrink_u8(outData, outWidth, outHeight, outWidthStride, inData, inWidthStride, 4, inHeight / outHeight);
+        return;
+    }
     resizeNearestPoint<uint8_t, uint8_t, 4>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
 }
 
@@ -2940,6 +3186,184 @@ void ResizeLinear<uint8_t, 4>(
     img_resize_bilinear_neon_uchar(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, 4);
 }
 
+// the exact 1/2, 1/4 and 1/6 shrinks need no tables, every other path takes its tables from the context
+template <int32_t channels>
+static void resize_linear_stream_u8(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    StreamStageTimer timer(context, "ResizeLinear");
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight == 0 || inWidth == 0 || outHeight == 0 || outWidth == 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    img_resize_bilinear_neon_uchar(outData, outWidth, outHeight, outWidthStride, inData, inWidth, inHeight, inWidthStride, channels, &context);
+}
+
+template <>
+void ResizeLinear<uint8_t, 1>(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    resize_linear_stream_u8<1>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<uint8_t, 3>(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    resize_linear_stream_u8<3>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<uint8_t, 4>(
+    StreamContext& context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t* outData)
+{
+    resize_linear_stream_u8<4>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <int32_t channels>
+static void resize_linear_region_u8(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    if (nullptr == outData || nullptr == inData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || outHeight <= 0 || outWidth <= 0 || inWidthStride < inWidth || outWidthStride < outWidth) {
+        return;
+    }
+    if (!(scaleY > 0.0) || !(scaleX > 0.0)) {
+        return;
+    }
+
+    // the shrink and c1/c4 kernels of ResizeLinear derive their own grids, the generic one works from
+    // the offset tables and computes every pixel the same way wherever it is in the tile
+    int32_t ksize = 2, ksize2 = ksize / 2;
+    int32_t xmin = 0;
+    int32_t xmax = outWidth;
+    int32_t width = outWidth * channels;
+
+    uint8_t* buffer_ = (uint8_t*)tinycv::ScratchAlloc((width + outHeight) * (sizeof(int32_t) + sizeof(float) * ksize), 128);
+
+    int32_t* xofs = (int32_t*)buffer_;
+    int32_t* yofs = xofs + width;
+    int16_t* ialpha = (int16_t*)(yofs + outHeight);
+    int16_t* ibeta = ialpha + width * ksize;
+
+    img_resize_cal_offset_linear_uchar(xofs, ialpha, yofs, ibeta, &xmin, &xmax, ksize, ksize2, inWidth, inHeight, outWidth, outHeight, channels, scaleX, scaleY, originX, originY, outX, outY);
+
+    img_resize_generic_linear_neon_uchar(inData, outData, xofs, ialpha, yofs, ibeta, xmin, xmax, ksize, inWidth, inHeight, inWidthStride, outWidth, outHeight, outWidthStride, channels, nullptr);
+    tinycv::ScratchFree(buffer_);
+}
+
+template <>
+void ResizeLinearRegion<uint8_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_u8<1>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<uint8_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_u8<3>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<uint8_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t* inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t* outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_u8<4>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
 template <>
 void ResizeArea<uint8_t, 1>(
     int32_t inHeight,
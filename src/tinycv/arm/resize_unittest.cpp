@@ -22,6 +22,9 @@
 #include <gtest/gtest.h>
 #include <opencv2/imgproc.hpp>
 
+#include <algorithm>
+#include <memory>
+
 struct Size_p {
     int inWidth;
     int inHeight;
@@ -148,6 +151,112 @@ public:
             size.outWidth * c,
             diff);
     }
+    void Cubicapply(const ResizeParam &param)
+    {
+        Size_p size = std::get<0>(param);
+        const float diff = std::get<1>(param);
+        std::cout << __FUNCTION__ << std::endl;
+
+        std::unique_ptr<T[]> src(new T[size.inWidth * size.inHeight * c]);
+        std::unique_ptr<T[]> dst_ref(new T[size.outWidth * size.outHeight * c]);
+        std::unique_ptr<T[]> dst(new T[size.outWidth * size.outHeight * c]);
+
+        tinycv::debug::randomFill<T>(src.get(), size.inWidth * size.inHeight * c, 0, 255);
+        cv::Mat src_opencv(size.inHeight, size.inWidth, CV_MAKETYPE(cv::DataType<T>::depth, c), src.get(), sizeof(T) * size.inWidth * c);
+        cv::Mat dst_opencv(size.outHeight, size.outWidth, CV_MAKETYPE(cv::DataType<T>::depth, c), dst_ref.get(), sizeof(T) * size.outWidth * c);
+
+        cv::resize(src_opencv, dst_opencv, cv::Size(size.outWidth, size.outHeight), 0, 0, cv::INTER_CUBIC);
+
+        tinycv::ResizeCubic<T, c>(
+            size.inHeight,
+            size.inWidth,
+            size.inWidth * c,
+            src.get(),
+            size.outHeight,
+            size.outWidth,
+            size.outWidth * c,
+            dst.get());
+
+        checkResult<T, c>(
+            dst_ref.get(),
+            dst.get(),
+            size.outHeight,
+            size.outWidth,
+            size.outWidth * c,
+            size.outWidth * c,
+            diff);
+    }
+    // output is twice the input, with window 4 the taps match OpenCV's INTER_LANCZOS4 away from the borders
+    void Lanczosapply(const ResizeParam &param)
+    {
+        Size_p size = std::get<0>(param);
+        const float diff = std::get<1>(param);
+        const int32_t margin = 8;
+        std::cout << __FUNCTION__ << std::endl;
+
+        std::unique_ptr<T[]> src(new T[size.inWidth * size.inHeight * c]);
+        std::unique_ptr<T[]> dst_ref(new T[size.outWidth * size.outHeight * c]);
+        std::unique_ptr<T[]> dst(new T[size.outWidth * size.outHeight * c]);
+
+        tinycv::debug::randomFill<T>(src.get(), size.inWidth * size.inHeight * c, 0, 255);
+        cv::Mat src_opencv(size.inHeight, size.inWidth, CV_MAKETYPE(cv::DataType<T>::depth, c), src.get(), sizeof(T) * size.inWidth * c);
+        cv::Mat dst_opencv(size.outHeight, size.outWidth, CV_MAKETYPE(cv::DataType<T>::depth, c), dst_ref.get(), sizeof(T) * size.outWidth * c);
+
+        cv::resize(src_opencv, dst_opencv, cv::Size(size.outWidth, size.outHeight), 0, 0, cv::INTER_LANCZOS4);
+
+        tinycv::ResizeLanczos<T, c>(
+            size.inHeight,
+            size.inWidth,
+            size.inWidth * c,
+            src.get(),
+            size.outHeight,
+            size.outWidth,
+            size.outWidth * c,
+            dst.get(),
+            4);
+
+        int32_t offset = margin * size.outWidth * c + margin * c;
+        checkResult<T, c>(
+            dst_ref.get() + offset,
+            dst.get() + offset,
+            size.outHeight - 2 * margin,
+            size.outWidth - 2 * margin,
+            size.outWidth * c,
+            size.outWidth * c,
+            diff);
+    }
+    // weights are normalized per output, a flat image stays flat for any ratio
+    void LanczosFlatapply(const ResizeParam &param)
+    {
+        Size_p size = std::get<0>(param);
+        const float diff = std::get<1>(param);
+        std::cout << __FUNCTION__ << std::endl;
+
+        std::unique_ptr<T[]> src(new T[size.inWidth * size.inHeight * c]);
+        std::unique_ptr<T[]> dst_ref(new T[size.outWidth * size.outHeight * c]);
+        std::unique_ptr<T[]> dst(new T[size.outWidth * size.outHeight * c]);
+        std::fill(src.get(), src.get() + size.inWidth * size.inHeight * c, (T)173);
+        std::fill(dst_ref.get(), dst_ref.get() + size.outWidth * size.outHeight * c, (T)173);
+
+        tinycv::ResizeLanczos<T, c>(
+            size.inHeight,
+            size.inWidth,
+            size.inWidth * c,
+            src.get(),
+            size.outHeight,
+            size.outWidth,
+            size.outWidth * c,
+            dst.get());
+
+        checkResult<T, c>(
+            dst_ref.get(),
+            dst.get(),
+            size.outHeight,
+            size.outWidth,
+            size.outWidth * c,
+            size.outWidth * c,
+            diff);
+    }
 };
 
 #define R1(name, t, c, diff)           \
@@ -156,7 +265,7 @@ public:
     {                                  \
         this->Linearapply(GetParam()); \
     }                                  \
-    INSTANTIATE_TEST_CASE_P(standard, name, ::testing::Combine(::testing::Values(Size_p{320, 240, 640, 480}, Size_p{640, 480, 320, 240}, Size_p{1080, 1920, 270, 480}, Size_p{1080, 1920, 180, 320}), ::testing::Values(diff)));
+    INSTANTIATE_TEST_CASE_P(standard, name, ::testing::Combine(::testing::Values(Size_p{320, 240, 640, 480}, Size_p{640, 480, 320, 240}, Size_p{1080, 1920, 270, 480}, Size_p{1080, 1920, 180, 320}, Size_p{644, 484, 161, 121}, Size_p{642, 482, 321, 241}), ::testing::Values(diff)));
 R1(ResizeLinear_f32c1, float, 1, 1e-1f)
 R1(ResizeLinear_f32c3, float, 3, 1e-1f)
 R1(ResizeLinear_f32c4, float, 4, 1e-1f)
@@ -165,13 +274,21 @@ R1(ResizeLinear_u8c1, uint8_t, 1, 2.01f)
 R1(ResizeLinear_u8c3, uint8_t, 3, 1.01f)
 R1(ResizeLinear_u8c4, uint8_t, 4, 2.01f)
 
+R1(ResizeLinear_u16c1, uint16_t, 1, 1.01f)
+R1(ResizeLinear_u16c3, uint16_t, 3, 1.01f)
+R1(ResizeLinear_u16c4, uint16_t, 4, 1.01f)
+
+R1(ResizeLinear_s16c1, int16_t, 1, 1.01f)
+R1(ResizeLinear_s16c3, int16_t, 3, 1.01f)
+R1(ResizeLinear_s16c4, int16_t, 4, 1.01f)
+
 #define R2(name, t, c, diff)                 \
     using name = Resize<t, c>;               \
     TEST_P(name, abc)                        \
     {                                        \
         this->NearestPointapply(GetParam()); \
     }                                        \
-    INSTANTIATE_TEST_CASE_P(standard, name, ::testing::Combine(::testing::Values(Size_p{320, 240, 640, 480}, Size_p{640, 480, 320, 240}), ::testing::Values(diff)));
+    INSTANTIATE_TEST_CASE_P(standard, name, ::testing::Combine(::testing::Values(Size_p{320, 240, 640, 480}, Size_p{640, 480, 320, 240}, Size_p{644, 484, 161, 121}, Size_p{642, 482, 321, 241}), ::testing::Values(diff)));
 R2(ResizeNearestPoint_f32c1, float, 1, 1e-5f)
 R2(ResizeNearestPoint_f32c3, float, 3, 1e-5f)
 R2(ResizeNearestPoint_f32c4, float, 4, 1e-5f)
@@ -180,13 +297,21 @@ R2(ResizeNearestPoint_u8c1, uint8_t, 1, 1.01f)
 R2(ResizeNearestPoint_u8c3, uint8_t, 3, 1.01f)
 R2(ResizeNearestPoint_u8c4, uint8_t, 4, 1.01f)
 
+R2(ResizeNearestPoint_u16c1, uint16_t, 1, 1.01f)
+R2(ResizeNearestPoint_u16c3, uint16_t, 3, 1.01f)
+R2(ResizeNearestPoint_u16c4, uint16_t, 4, 1.01f)
+
+R2(ResizeNearestPoint_s16c1, int16_t, 1, 1.01f)
+R2(ResizeNearestPoint_s16c3, int16_t, 3, 1.01f)
+R2(ResizeNearestPoint_s16c4, int16_t, 4, 1.01f)
+
 #define R3(name, t, c, diff)         \
     using name = Resize<t, c>;       \
     TEST_P(name, abc)                \
     {                                \
         this->Areaapply(GetParam()); \
     }                                \
-    INSTANTIATE_TEST_CASE_P(standard, name, ::testing::Combine(::testing::Values(Size_p{320, 240, 640, 480}, Size_p{640, 480, 320, 240}), ::testing::Values(diff)));
+    INSTANTIATE_TEST_CASE_P(standard, name, ::testing::Combine(::testing::Values(Size_p{320, 240, 640, 480}, Size_p{640, 480, 320, 240}, Size_p{644, 484, 161, 121}, Size_p{642, 482, 321, 241}), ::testing::Values(diff)));
 
 R3(ResizeArea_u8c1, uint8_t, 1, 1.01f)
 R3(ResizeArea_u8c3, uint8_t, 3, 1.01f)
@@ -194,3 +319,249 @@ R3(ResizeArea_u8c4, uint8_t, 4, 1.01f)
 R3(ResizeArea_f32c1, float, 1, 1.01f)
 R3(ResizeArea_f32c3, float, 3, 1.01f)
 R3(ResizeArea_f32c4, float, 4, 1.01f)
+R3(ResizeArea_u16c1, uint16_t, 1, 1.01f)
+R3(ResizeArea_u16c3, uint16_t, 3, 1.01f)
+R3(ResizeArea_u16c4, uint16_t, 4, 1.01f)
+R3(ResizeArea_s16c1, int16_t, 1, 1.01f)
+R3(ResizeArea_s16c3, int16_t, 3, 1.01f)
+R3(ResizeArea_s16c4, int16_t, 4, 1.01f)
+
+#define R4(name, t, c, diff)          \
+    using name = Resize<t, c>;        \
+    TEST_P(name, abc)                 \
+    {                                 \
+        this->Cubicapply(GetParam()); \
+    }                                 \
+    INSTANTIATE_TEST_CASE_P(standard, name, ::testing::Combine(::testing::Values(Size_p{320, 240, 640, 480}, Size_p{640, 480, 320, 240}, Size_p{101, 99, 37, 203}), ::testing::Values(diff)));
+
+R4(ResizeCubic_u8c1, uint8_t, 1, 1.01f)
+R4(ResizeCubic_u8c3, uint8_t, 3, 1.01f)
+R4(ResizeCubic_u8c4, uint8_t, 4, 1.01f)
+R4(ResizeCubic_f32c1, float, 1, 1e-2f)
+R4(ResizeCubic_f32c3, float, 3, 1e-2f)
+R4(ResizeCubic_f32c4, float, 4, 1e-2f)
+
+#define R5(name, t, c, diff)            \
+    using name = Resize<t, c>;          \
+    TEST_P(name, abc)                   \
+    {                                   \
+        this->Lanczosapply(GetParam()); \
+    }                                   \
+    INSTANTIATE_TEST_CASE_P(standard, name, ::testing::Combine(::testing::Values(Size_p{320, 240, 640, 480}, Size_p{101, 99, 202, 198}), ::testing::Values(diff)));
+
+R5(ResizeLanczos_u8c1, uint8_t, 1, 1.01f)
+R5(ResizeLanczos_u8c3, uint8_t, 3, 1.01f)
+R5(ResizeLanczos_u8c4, uint8_t, 4, 1.01f)
+R5(ResizeLanczos_f32c1, float, 1, 1e-2f)
+R5(ResizeLanczos_f32c3, float, 3, 1e-2f)
+R5(ResizeLanczos_f32c4, float, 4, 1e-2f)
+
+#define R6(name, t, c, diff)                \
+    using name = Resize<t, c>;              \
+    TEST_P(name, abc)                       \
+    {                                       \
+        this->LanczosFlatapply(GetParam()); \
+    }                                       \
+    INSTANTIATE_TEST_CASE_P(standard, name, ::testing::Combine(::testing::Values(Size_p{1920, 1080, 240, 135}, Size_p{1080, 720, 37, 203}), ::testing::Values(diff)));
+
+R6(ResizeLanczosFlat_u8c1, uint8_t, 1, 0.01f)
+R6(ResizeLanczosFlat_u8c3, uint8_t, 3, 0.01f)
+R6(ResizeLanczosFlat_u8c4, uint8_t, 4, 0.01f)
+R6(ResizeLanczosFlat_f32c1, float, 1, 1e-3f)
+R6(ResizeLanczosFlat_f32c3, float, 3, 1e-3f)
+R6(ResizeLanczosFlat_f32c4, float, 4, 1e-3f)
+
+template <int32_t c>
+void ResizeHalfTest(const Size_p &size, int32_t interpolation, float diff)
+{
+    std::unique_ptr<tinycv::half_t[]> src(new tinycv::half_t[size.inWidth * size.inHeight * c]);
+    std::unique_ptr<float[]> src_f32(new float[size.inWidth * size.inHeight * c]);
+    std::unique_ptr<float[]> dst_f32(new float[size.outWidth * size.outHeight * c]);
+    std::unique_ptr<tinycv::half_t[]> dst_ref(new tinycv::half_t[size.outWidth * size.outHeight * c]);
+    std::unique_ptr<tinycv::half_t[]> dst(new tinycv::half_t[size.outWidth * size.outHeight * c]);
+
+    randomFillHalf(src.get(), src_f32.get(), size.inWidth * size.inHeight * c, 0, 255);
+    cv::Mat src_opencv(size.inHeight, size.inWidth, CV_MAKETYPE(CV_32F, c), src_f32.get(), sizeof(float) * size.inWidth * c);
+    cv::Mat dst_opencv(size.outHeight, size.outWidth, CV_MAKETYPE(CV_32F, c), dst_f32.get(), sizeof(float) * size.outWidth * c);
+
+    cv::resize(src_opencv, dst_opencv, cv::Size(size.outWidth, size.outHeight), 0, 0, interpolation);
+
+    if (interpolation == cv::INTER_AREA) {
+        tinycv::ResizeArea<tinycv::half_t, c>(
+            size.inHeight,
+            size.inWidth,
+            size.inWidth * c,
+            src.get(),
+            size.outHeight,
+            size.outWidth,
+            size.outWidth * c,
+            dst.get());
+    } else {
+        tinycv::ResizeLinear<tinycv::half_t, c>(
+            size.inHeight,
+            size.inWidth,
+            size.inWidth * c,
+            src.get(),
+            size.outHeight,
+            size.outWidth,
+            size.outWidth * c,
+            dst.get());
+    }
+
+    for (int32_t i = 0; i < size.outWidth * size.outHeight * c; ++i) {
+        dst_ref[i] = tinycv::half_t(dst_f32[i]);
+    }
+    checkResult<tinycv::half_t, c>(
+        dst_ref.get(),
+        dst.get(),
+        size.outHeight,
+        size.outWidth,
+        size.outWidth * c,
+        size.outWidth * c,
+        diff);
+}
+
+TEST(ResizeLinear_f16, arm)
+{
+    // one fp16 step is 0.125 between 128 and 256, allow a rounding difference of one step
+    const Size_p sizes[] = {{320, 240, 640, 480}, {640, 480, 320, 240}, {1080, 1920, 270, 480}, {1080, 1920, 180, 320}};
+    for (const Size_p &size : sizes) {
+        ResizeHalfTest<1>(size, cv::INTER_LINEAR, 0.26f);
+        ResizeHalfTest<3>(size, cv::INTER_LINEAR, 0.26f);
+        ResizeHalfTest<4>(size, cv::INTER_LINEAR, 0.26f);
+    }
+}
+
+TEST(ResizeArea_f16, arm)
+{
+    const Size_p sizes[] = {{320, 240, 640, 480}, {640, 480, 320, 240}};
+    for (const Size_p &size : sizes) {
+        ResizeHalfTest<1>(size, cv::INTER_AREA, 0.26f);
+        ResizeHalfTest<3>(size, cv::INTER_AREA, 0.26f);
+        ResizeHalfTest<4>(size, cv::INTER_AREA, 0.26f);
+    }
+}
+
+template <typename T, int32_t c>
+void ResizeLinearRegionTest(const Size_p &size, int32_t tileHeight, int32_t tileWidth, float diff)
+{
+    std::unique_ptr<T[]> src(new T[size.inWidth * size.inHeight * c]);
+    std::unique_ptr<T[]> dst_ref(new T[size.outWidth * size.outHeight * c]);
+    std::unique_ptr<T[]> dst(new T[size.outWidth * size.outHeight * c]);
+    std::unique_ptr<T[]> dst_tiled(new T[size.outWidth * size.outHeight * c]);
+    tinycv::debug::randomFill<T>(src.get(), size.inWidth * size.inHeight * c, 0, 255);
+
+    cv::Mat src_opencv(size.inHeight, size.inWidth, CV_MAKETYPE(cv::DataType<T>::depth, c), src.get(), sizeof(T) * size.inWidth * c);
+    cv::Mat dst_opencv(size.outHeight, size.outWidth, CV_MAKETYPE(cv::DataType<T>::depth, c), dst_ref.get(), sizeof(T) * size.outWidth * c);
+
+    cv::resize(src_opencv, dst_opencv, cv::Size(size.outWidth, size.outHeight), 0, 0, cv::INTER_LINEAR);
+    double scaleY = tinycv::ResizeLinearScale(size.inHeight, size.outHeight);
+    double scaleX = tinycv::ResizeLinearScale(size.inWidth, size.outWidth);
+    tinycv::ResizeLinearRegion<T, c>(
+        size.inHeight,
+        size.inWidth,
+        size.inWidth * c,
+        src.get(),
+        size.outHeight,
+        size.outWidth,
+        size.outWidth * c,
+        dst.get(),
+        scaleY,
+        scaleX);
+
+    checkResult<T, c>(
+        dst_ref.get(),
+        dst.get(),
+        size.outHeight,
+        size.outWidth,
+        size.outWidth * c,
+        size.outWidth * c,
+        diff);
+
+    // the tiles have to reassemble bit exactly, also with a sub-pixel origin pushing samples over the border
+    const double origins[][2] = {{0.0, 0.0}, {0.37, -1.6}};
+    for (const auto &origin : origins) {
+        tinycv::ResizeLinearRegion<T, c>(
+            size.inHeight,
+            size.inWidth,
+            size.inWidth * c,
+            src.get(),
+            size.outHeight,
+            size.outWidth,
+            size.outWidth * c,
+            dst.get(),
+            scaleY,
+            scaleX,
+            origin[0],
+            origin[1]);
+        for (int32_t y = 0; y < size.outHeight; y += tileHeight) {
+            for (int32_t x = 0; x < size.outWidth; x += tileWidth) {
+                tinycv::ResizeLinearRegion<T, c>(
+                    size.inHeight,
+                    size.inWidth,
+                    size.inWidth * c,
+                    src.get(),
+                    std::min(tileHeight, size.outHeight - y),
+                    std::min(tileWidth, size.outWidth - x),
+                    size.outWidth * c,
+                    dst_tiled.get() + y * size.outWidth * c + x * c,
+                    scaleY,
+                    scaleX,
+                    origin[0],
+                    origin[1],
+                    y,
+                    x);
+            }
+        }
+        EXPECT_EQ(0, memcmp(dst.get(), dst_tiled.get(), sizeof(T) * size.outWidth * size.outHeight * c));
+    }
+}
+
+template <typename T, int32_t c>
+void ResizeLinearShiftTest(int32_t height, int32_t width, int32_t shiftY, int32_t shiftX)
+{
+    std::unique_ptr<T[]> src(new T[width * height * c]);
+    std::unique_ptr<T[]> dst(new T[width * height * c]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * c, 0, 255);
+
+    // unit scale and an integer origin sample exactly on source pixels, clamped at the border
+    tinycv::ResizeLinearRegion<T, c>(height, width, width * c, src.get(), height, width, width * c, dst.get(), 1.0, 1.0, shiftY, shiftX);
+    int32_t mismatch = 0;
+    for (int32_t y = 0; y < height; ++y) {
+        int32_t sy = std::min(std::max(y + shiftY, 0), height - 1);
+        for (int32_t x = 0; x < width; ++x) {
+            int32_t sx = std::min(std::max(x + shiftX, 0), width - 1);
+            mismatch += memcmp(dst.get() + (y * width + x) * c, src.get() + (sy * width + sx) * c, sizeof(T) * c) != 0;
+        }
+    }
+    EXPECT_EQ(0, mismatch);
+}
+
+TEST(ResizeLinearRegion_f32, arm)
+{
+    ResizeLinearRegionTest<float, 1>({540, 360, 1080, 720}, 64, 100, 1e-1f);
+    ResizeLinearRegionTest<float, 1>({1080, 720, 540, 360}, 37, 53, 1e-1f);
+    ResizeLinearRegionTest<float, 3>({480, 640, 540, 360}, 50, 77, 1e-1f);
+    ResizeLinearRegionTest<float, 4>({1076, 724, 269, 181}, 16, 16, 1e-1f);
+
+    ResizeLinearShiftTest<float, 1>(99, 101, 7, -12);
+    ResizeLinearShiftTest<float, 3>(99, 101, -150, 3);
+}
+
+TEST(ResizeLinearRegion_u8, arm)
+{
+    ResizeLinearRegionTest<uint8_t, 1>({540, 360, 1080, 720}, 64, 100, 1.01f);
+    ResizeLinearRegionTest<uint8_t, 1>({1080, 720, 540, 360}, 37, 53, 1.01f);
+    ResizeLinearRegionTest<uint8_t, 3>({480, 640, 540, 360}, 50, 77, 1.01f);
+    ResizeLinearRegionTest<uint8_t, 4>({1076, 724, 269, 181}, 16, 16, 1.01f);
+
+    ResizeLinearShiftTest<uint8_t, 1>(99, 101, 7, -12);
+    ResizeLinearShiftTest<uint8_t, 4>(99, 101, -150, 3);
+}
+
+TEST(ResizeLinearRegion_u16, arm)
+{
+    ResizeLinearRegionTest<uint16_t, 1>({540, 360, 1080, 720}, 64, 100, 1.01f);
+    ResizeLinearRegionTest<uint16_t, 3>({1080, 720, 540, 360}, 37, 53, 1.01f);
+    ResizeLinearShiftTest<uint16_t, 1>(99, 101, 7, -12);
+}
@@ -0,0 +1,116 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/sobel.h"
+#include "tinycv/debug.h"
+
+#include <opencv2/imgproc.hpp>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace {
+
+template <typename Tsrc, typename Tdst, int32_t nc, int32_t ksize>
+void BM_Sobel_tinycv_arm(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<Tsrc[]> src(new Tsrc[width * height * nc]);
+    std::unique_ptr<Tdst[]> dst(new Tdst[width * height * nc]);
+    tinycv::debug::randomFill<Tsrc>(src.get(), width * height * nc, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::Sobel<Tsrc, Tdst, nc>(height, width, width * nc, src.get(), width * nc, dst.get(), 1, 0, ksize);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_Sobel_tinycv_arm, uint8_t, int16_t, 1, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Sobel_tinycv_arm, uint8_t, int16_t, 1, 5)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Sobel_tinycv_arm, uint8_t, int16_t, 3, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Sobel_tinycv_arm, uint8_t, float, 1, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Sobel_tinycv_arm, float, float, 1, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Sobel_tinycv_arm, uint8_t, int16_t, 1, -1)->Args({640, 480})->Args({1920, 1080});
+
+template <int32_t numBins, bool signedGradient>
+void BM_SobelMagnitudeOrientation_tinycv_arm(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<float[]> magnitude(new float[width * height]);
+    std::unique_ptr<uint8_t[]> bins(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::SobelMagnitudeOrientation(height, width, width, src.get(), width, magnitude.get(), width, bins.get(), numBins, signedGradient);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_SobelMagnitudeOrientation_tinycv_arm, 9, false)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_SobelMagnitudeOrientation_tinycv_arm, 18, true)->Args({640, 480})->Args({1920, 1080});
+
+#ifdef TINYCV_BENCHMARK_OPENCV
+template <typename Tsrc, typename Tdst, int32_t nc, int32_t ksize>
+static void BM_Sobel_opencv_arm(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<Tsrc[]> src(new Tsrc[width * height * nc]);
+    tinycv::debug::randomFill<Tsrc>(src.get(), width * height * nc, 0, 255);
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<Tsrc>::depth, nc), src.get());
+    cv::Mat oMat;
+    for (auto _ : state) {
+        cv::Sobel(iMat, oMat, cv::DataType<Tdst>::depth, 1, 0, ksize);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_Sobel_opencv_arm, uint8_t, int16_t, 1, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Sobel_opencv_arm, uint8_t, int16_t, 1, 5)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Sobel_opencv_arm, uint8_t, int16_t, 3, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Sobel_opencv_arm, uint8_t, float, 1, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Sobel_opencv_arm, float, float, 1, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Sobel_opencv_arm, uint8_t, int16_t, 1, -1)->Args({640, 480})->Args({1920, 1080});
+
+//! the unfused pipeline: both derivatives to memory, then magnitude and angle
+template <int32_t numBins, bool signedGradient>
+static void BM_SobelMagnitudeOrientation_opencv_arm(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat gx, gy, magnitude, angle, bins;
+    const double range = signedGradient ? 360.0 : 180.0;
+    for (auto _ : state) {
+        cv::Sobel(iMat, gx, CV_32F, 1, 0);
+        cv::Sobel(iMat, gy, CV_32F, 0, 1);
+        cv::cartToPolar(gx, gy, magnitude, angle, true);
+        angle.convertTo(bins, CV_8U, numBins / range);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_SobelMagnitudeOrientation_opencv_arm, 9, false)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_SobelMagnitudeOrientation_opencv_arm, 18, true)->Args({640, 480})->Args({1920, 1080});
+
+#endif //! TINYCV_BENCHMARK_OPENCV
+} // namespace
@@ -0,0 +1,137 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/sobel.h"
+#include "tinycv/arm/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <cmath>
+#include <memory>
+
+template <typename Tsrc, typename Tdst, int32_t nc>
+void SobelTest(int32_t height, int32_t width, int32_t dx, int32_t dy, int32_t ksize, float scale, float delta, tinycv::BorderType border_type, float diff)
+{
+    std::unique_ptr<Tsrc[]> src(new Tsrc[width * height * nc]);
+    std::unique_ptr<Tdst[]> dst(new Tdst[width * height * nc]);
+    std::unique_ptr<Tdst[]> dst_opencv(new Tdst[width * height * nc]);
+    tinycv::debug::randomFill<Tsrc>(src.get(), width * height * nc, 0, 255);
+
+    tinycv::Sobel<Tsrc, Tdst, nc>(height, width, width * nc, src.get(), width * nc, dst.get(), dx, dy, ksize, scale, delta, border_type);
+
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<Tsrc>::depth, nc), src.get());
+    cv::Mat oMat(height, width, CV_MAKETYPE(cv::DataType<Tdst>::depth, nc), dst_opencv.get());
+    cv::Sobel(iMat, oMat, cv::DataType<Tdst>::depth, dx, dy, ksize, scale, delta, (int)border_type);
+
+    checkResult<Tdst, nc>(dst.get(), dst_opencv.get(), height, width, width * nc, width * nc, diff);
+}
+
+template <typename Tsrc, typename Tdst>
+void SobelTestAll(float diff)
+{
+    const tinycv::BorderType borders[] = {tinycv::BORDER_CONSTANT, tinycv::BORDER_REPLICATE, tinycv::BORDER_REFLECT, tinycv::BORDER_REFLECT_101};
+    for (tinycv::BorderType border_type : borders) {
+        SobelTest<Tsrc, Tdst, 1>(480, 640, 1, 0, 3, 1.0f, 0.0f, border_type, diff);
+        SobelTest<Tsrc, Tdst, 1>(480, 640, 0, 1, 3, 1.0f, 0.0f, border_type, diff);
+        SobelTest<Tsrc, Tdst, 3>(101, 99, 1, 1, 5, 1.0f, 0.0f, border_type, diff);
+        SobelTest<Tsrc, Tdst, 4>(101, 99, 2, 0, 7, 0.125f, 3.0f, border_type, diff);
+        SobelTest<Tsrc, Tdst, 1>(101, 99, 1, 0, 1, 1.0f, 0.0f, border_type, diff);
+        SobelTest<Tsrc, Tdst, 3>(101, 99, 0, 1, -1, 1.0f, 0.0f, border_type, diff);
+    }
+}
+
+TEST(SOBEL_UINT8_INT16, arm)
+{
+    SobelTestAll<uint8_t, int16_t>(1.01f);
+}
+
+TEST(SOBEL_UINT8_FP32, arm)
+{
+    SobelTestAll<uint8_t, float>(0.01f);
+}
+
+TEST(SOBEL_FP32, arm)
+{
+    SobelTestAll<float, float>(0.01f);
+}
+
+TEST(SCHARR_UINT8_INT16, arm)
+{
+    const int32_t height = 120, width = 160;
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<int16_t[]> dst(new int16_t[width * height]);
+    std::unique_ptr<int16_t[]> dst_opencv(new int16_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+
+    tinycv::Scharr<uint8_t, int16_t, 1>(height, width, width, src.get(), width, dst.get(), 1, 0);
+
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat oMat(height, width, CV_16SC1, dst_opencv.get());
+    cv::Scharr(iMat, oMat, CV_16S, 1, 0);
+
+    checkResult<int16_t, 1>(dst.get(), dst_opencv.get(), height, width, width, width, 0.01f);
+}
+
+void SobelMagnitudeOrientationTest(int32_t height, int32_t width, int32_t numBins, bool signedGradient)
+{
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<float[]> magnitude(new float[width * height]);
+    std::unique_ptr<uint8_t[]> bins(new uint8_t[width * height]);
+    std::unique_ptr<float[]> gx(new float[width * height]);
+    std::unique_ptr<float[]> gy(new float[width * height]);
+    std::unique_ptr<float[]> magnitude_opencv(new float[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+
+    tinycv::SobelMagnitudeOrientation(height, width, width, src.get(), width, magnitude.get(), width, bins.get(), numBins, signedGradient);
+
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat gxMat(height, width, CV_32FC1, gx.get());
+    cv::Mat gyMat(height, width, CV_32FC1, gy.get());
+    cv::Mat magMat(height, width, CV_32FC1, magnitude_opencv.get());
+    cv::Sobel(iMat, gxMat, CV_32F, 1, 0);
+    cv::Sobel(iMat, gyMat, CV_32F, 0, 1);
+    cv::magnitude(gxMat, gyMat, magMat);
+    checkResult<float, 1>(magnitude.get(), magnitude_opencv.get(), height, width, width, width, 1e-3f);
+
+    //! orientations exactly on a bin boundary may fall either side in double precision
+    const double range = signedGradient ? 2 * M_PI : M_PI;
+    int32_t mismatches = 0;
+    for (int32_t i = 0; i < width * height; ++i) {
+        int32_t expected = 0;
+        if (gx[i] != 0 || gy[i] != 0) {
+            double angle = std::atan2((double)gy[i], (double)gx[i]);
+            angle = angle < 0 ? angle + 2 * M_PI : angle;
+            angle = angle >= range ? angle - range : angle;
+            double position = angle * numBins / range;
+            if (std::fabs(position - std::round(position)) < 1e-6) {
+                continue;
+            }
+            expected = std::min((int32_t)position, numBins - 1);
+        }
+        mismatches += bins[i] != expected;
+    }
+    EXPECT_EQ(mismatches, 0);
+}
+
+TEST(SOBEL_MAGNITUDE_ORIENTATION, arm)
+{
+    SobelMagnitudeOrientationTest(480, 640, 9, false);
+    SobelMagnitudeOrientationTest(101, 99, 18, true);
+    SobelMagnitudeOrientationTest(101, 99, 8, true);
+}
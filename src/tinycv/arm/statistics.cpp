@@ -0,0 +1,581 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/statistics.h"
+#include "tinycv/sys.h"
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <limits>
+#include <arm_neon.h>
+
+#define STAT_MIN_BAND_PIXELS (1 << 16)
+#define STAT_FLUSH_STEPS 128 //! pairwise 16 bit sums may wrap after 129 vectors are added
+
+namespace tinycv {
+
+// sums of a band of rows, per channel
+struct StatSums {
+    double sum[4];
+    double sqsum[4];
+    int64_t count;
+};
+
+// 16 pixels split into channels
+template <int32_t channels>
+static inline void stat_load(const uint8_t *src, uint8x16_t *v)
+{
+    if (channels == 1) {
+        v[0] = vld1q_u8(src);
+    } else if (channels == 3) {
+        uint8x16x3_t t = vld3q_u8(src);
+        for (int32_t c = 0; c < channels; ++c) {
+            v[c] = t.val[c];
+        }
+    } else {
+        uint8x16x4_t t = vld4q_u8(src);
+        for (int32_t c = 0; c < channels; ++c) {
+            v[c] = t.val[c];
+        }
+    }
+}
+
+// 4 pixels split into channels
+template <int32_t channels>
+static inline void stat_load(const float *src, float32x4_t *v)
+{
+    if (channels == 1) {
+        v[0] = vld1q_f32(src);
+    } else if (channels == 3) {
+        float32x4x3_t t = vld3q_f32(src);
+        for (int32_t c = 0; c < channels; ++c) {
+            v[c] = t.val[c];
+        }
+    } else {
+        float32x4x4_t t = vld4q_f32(src);
+        for (int32_t c = 0; c < channels; ++c) {
+            v[c] = t.val[c];
+        }
+    }
+}
+
+// all ones for the 4 pixels at `m` where the mask is set
+static inline uint32x4_t stat_mask4(const uint8_t *m)
+{
+    uint32_t bytes;
+    memcpy(&bytes, m, sizeof(bytes));
+    uint16x4_t m16 = vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(bytes))));
+    return vtstq_u32(vmovl_u16(m16), vmovl_u16(m16));
+}
+
+// u8 sums of rows [y0, y1) per channel: pairwise adds into 16 bit lanes flushed to 64 bit lanes before they
+// may wrap, squares widened by vmull into 32 bit lanes
+template <int32_t channels, bool squares>
+static void stat_sums(
+    int32_t y0,
+    int32_t y1,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    StatSums &s)
+{
+    const uint8x16_t one = vdupq_n_u8(1);
+    uint64x2_t sum[channels], sqsum[channels];
+    for (int32_t c = 0; c < channels; ++c) {
+        sum[c] = vdupq_n_u64(0);
+        sqsum[c] = vdupq_n_u64(0);
+    }
+    uint64x2_t masked = vdupq_n_u64(0); //! pixels under the mask
+    int64_t tail[channels] = {0}, tailSq[channels] = {0};
+    int64_t count = 0;
+    for (int32_t y = y0; y < y1; ++y) {
+        const uint8_t *src = inData + (size_t)y * inWidthStride;
+        const uint8_t *m = nullptr != mask ? mask + (size_t)y * maskWidthStride : nullptr;
+        int32_t x = 0;
+        while (x <= width - 16) {
+            uint16x8_t acc[channels], n16 = vdupq_n_u16(0);
+            uint32x4_t accSq[channels];
+            for (int32_t c = 0; c < channels; ++c) {
+                acc[c] = vdupq_n_u16(0);
+                accSq[c] = vdupq_n_u32(0);
+            }
+            int32_t end = std::min(width - 16, x + 16 * (STAT_FLUSH_STEPS - 1));
+            for (; x <= end; x += 16) {
+                uint8x16_t v[channels];
+                stat_load<channels>(src + x * channels, v);
+                if (nullptr != m) {
+                    uint8x16_t mv = vld1q_u8(m + x);
+                    uint8x16_t on = vtstq_u8(mv, mv);
+                    n16 = vpadalq_u8(n16, vandq_u8(on, one));
+                    for (int32_t c = 0; c < channels; ++c) {
+                        v[c] = vandq_u8(v[c], on);
+                    }
+                }
+                for (int32_t c = 0; c < channels; ++c) {
+                    acc[c] = vpadalq_u8(acc[c], v[c]);
+                    if (squares) {
+                        accSq[c] = vpadalq_u16(accSq[c], vmull_u8(vget_low_u8(v[c]), vget_low_u8(v[c])));
+                        accSq[c] = vpadalq_u16(accSq[c], vmull_u8(vget_high_u8(v[c]), vget_high_u8(v[c])));
+                    }
+                }
+            }
+            for (int32_t c = 0; c < channels; ++c) {
+                sum[c] = vpadalq_u32(sum[c], vpaddlq_u16(acc[c]));
+                sqsum[c] = vpadalq_u32(sqsum[c], accSq[c]);
+            }
+            masked = vpadalq_u32(masked, vpaddlq_u16(n16));
+        }
+        if (nullptr == m) {
+            count += x;
+        }
+        for (; x < width; ++x) {
+            if (nullptr != m && 0 == m[x]) {
+                continue;
+            }
+            for (int32_t c = 0; c < channels; ++c) {
+                int32_t v = src[x * channels + c];
+                tail[c] += v;
+                tailSq[c] += v * v;
+            }
+            ++count;
+        }
+    }
+    for (int32_t c = 0; c < channels; ++c) {
+        s.sum[c] += (double)(int64_t)(vgetq_lane_u64(sum[c], 0) + vgetq_lane_u64(sum[c], 1) + tail[c]);
+        s.sqsum[c] += (double)(int64_t)(vgetq_lane_u64(sqsum[c], 0) + vgetq_lane_u64(sqsum[c], 1) + tailSq[c]);
+    }
+    s.count += count + (int64_t)(vgetq_lane_u64(masked, 0) + vgetq_lane_u64(masked, 1));
+}
+
+// fp32 sums of rows [y0, y1) per channel in double lanes
+template <int32_t channels, bool squares>
+static void stat_sums(
+    int32_t y0,
+    int32_t y1,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    StatSums &s)
+{
+    float64x2_t acc[2 * channels], accSq[2 * channels];
+    for (int32_t k = 0; k < 2 * channels; ++k) {
+        acc[k] = vdupq_n_f64(0);
+        accSq[k] = vdupq_n_f64(0);
+    }
+    double tail[channels] = {0}, tailSq[channels] = {0};
+    int64_t count = 0;
+    for (int32_t y = y0; y < y1; ++y) {
+        const float *src = inData + (size_t)y * inWidthStride;
+        const uint8_t *m = nullptr != mask ? mask + (size_t)y * maskWidthStride : nullptr;
+        int32_t x = 0;
+        for (; x <= width - 4; x += 4) {
+            float32x4_t v[channels];
+            stat_load<channels>(src + x * channels, v);
+            if (nullptr != m) {
+                uint32x4_t on = stat_mask4(m + x);
+                count -= vaddvq_s32(vreinterpretq_s32_u32(on));
+                for (int32_t c = 0; c < channels; ++c) {
+                    v[c] = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(v[c]), on));
+                }
+            }
+            for (int32_t c = 0; c < channels; ++c) {
+                float64x2_t lo = vcvt_f64_f32(vget_low_f32(v[c]));
+                float64x2_t hi = vcvt_f64_f32(vget_high_f32(v[c]));
+                acc[2 * c] = vaddq_f64(acc[2 * c], lo);
+                acc[2 * c + 1] = vaddq_f64(acc[2 * c + 1], hi);
+                if (squares) {
+                    accSq[2 * c] = vfmaq_f64(accSq[2 * c], lo, lo);
+                    accSq[2 * c + 1] = vfmaq_f64(accSq[2 * c + 1], hi, hi);
+                }
+            }
+        }
+        if (nullptr == m) {
+            count += x;
+        }
+        for (; x < width; ++x) {
+            if (nullptr != m && 0 == m[x]) {
+                continue;
+            }
+            for (int32_t c = 0; c < channels; ++c) {
+                double v = src[x * channels + c];
+                tail[c] += v;
+                tailSq[c] += v * v;
+            }
+            ++count;
+        }
+    }
+    for (int32_t c = 0; c < channels; ++c) {
+        float64x2_t a = vaddq_f64(acc[2 * c], acc[2 * c + 1]);
+        float64x2_t b = vaddq_f64(accSq[2 * c], accSq[2 * c + 1]);
+        s.sum[c] += vgetq_lane_f64(a, 0) + vgetq_lane_f64(a, 1) + tail[c];
+        s.sqsum[c] += vgetq_lane_f64(b, 0) + vgetq_lane_f64(b, 1) + tailSq[c];
+    }
+    s.count += count;
+}
+
+static inline int32_t stat_bands(int32_t height, int32_t width, int32_t numThreads)
+{
+    int32_t bands = (int32_t)std::min<int64_t>((int64_t)height * width / STAT_MIN_BAND_PIXELS, height);
+    return std::max(std::min(bands, numThreads), 1);
+}
+
+// per band partial sums, added in band order so results do not depend on scheduling
+template <typename T, int32_t channels, bool squares>
+static StatSums stat_reduce(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    int32_t numThreads)
+{
+    int32_t bands = stat_bands(height, width, numThreads);
+    StatSums *partial = (StatSums *)tinycv::ScratchAlloc((uint64_t)bands * sizeof(StatSums), 64);
+    ParallelFor(bands, bands, [&](int32_t b0, int32_t b1) {
+        for (int32_t b = b0; b < b1; ++b) {
+            memset(&partial[b], 0, sizeof(StatSums));
+            int32_t y0 = (int32_t)((int64_t)height * b / bands);
+            int32_t y1 = (int32_t)((int64_t)height * (b + 1) / bands);
+            stat_sums<channels, squares>(y0, y1, width, inWidthStride, inData, maskWidthStride, mask, partial[b]);
+        }
+    });
+    StatSums s = partial[0];
+    for (int32_t b = 1; b < bands; ++b) {
+        for (int32_t c = 0; c < channels; ++c) {
+            s.sum[c] += partial[b].sum[c];
+            s.sqsum[c] += partial[b].sqsum[c];
+        }
+        s.count += partial[b].count;
+    }
+    tinycv::ScratchFree(partial);
+    return s;
+}
+
+template <typename T, int32_t channels>
+static inline bool stat_valid(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask)
+{
+    if (nullptr == inData || height <= 0 || width <= 0) {
+        return false;
+    }
+    if (inWidthStride < width * channels) {
+        return false;
+    }
+    return nullptr == mask || maskWidthStride >= width;
+}
+
+template <typename T, int32_t channels>
+void Sum(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    double *sum,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    int32_t numThreads)
+{
+    if (nullptr == sum || !stat_valid<T, channels>(height, width, inWidthStride, inData, maskWidthStride, mask)) {
+        return;
+    }
+    StatSums s = stat_reduce<T, channels, false>(height, width, inWidthStride, inData, maskWidthStride, mask, numThreads);
+    for (int32_t c = 0; c < channels; ++c) {
+        sum[c] = s.sum[c];
+    }
+}
+
+template <typename T, int32_t channels>
+void MeanStdDev(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    double *mean,
+    double *stddev,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    int32_t numThreads)
+{
+    if (nullptr == mean || !stat_valid<T, channels>(height, width, inWidthStride, inData, maskWidthStride, mask)) {
+        return;
+    }
+    StatSums s = stat_reduce<T, channels, true>(height, width, inWidthStride, inData, maskWidthStride, mask, numThreads);
+    double scale = s.count ? 1.0 / s.count : 0;
+    for (int32_t c = 0; c < channels; ++c) {
+        mean[c] = s.sum[c] * scale;
+        if (nullptr != stddev) {
+            stddev[c] = sqrt(std::max(s.sqsum[c] * scale - mean[c] * mean[c], 0.0));
+        }
+    }
+}
+
+// extrema of rows [y0, y1) where the mask is set, 255 and 0 when it is empty
+static void stat_min_max(
+    int32_t y0,
+    int32_t y1,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    uint8_t &minVal,
+    uint8_t &maxVal)
+{
+    uint8x16_t vmin = vdupq_n_u8(0xff), vmax = vdupq_n_u8(0);
+    uint8_t lo = 0xff, hi = 0;
+    for (int32_t y = y0; y < y1; ++y) {
+        const uint8_t *src = inData + (size_t)y * inWidthStride;
+        const uint8_t *m = nullptr != mask ? mask + (size_t)y * maskWidthStride : nullptr;
+        int32_t x = 0;
+        for (; x <= width - 16; x += 16) {
+            uint8x16_t v = vld1q_u8(src + x);
+            if (nullptr != m) {
+                uint8x16_t off = vceqq_u8(vld1q_u8(m + x), vdupq_n_u8(0));
+                vmin = vminq_u8(vmin, vorrq_u8(v, off));
+                vmax = vmaxq_u8(vmax, vbicq_u8(v, off));
+            } else {
+                vmin = vminq_u8(vmin, v);
+                vmax = vmaxq_u8(vmax, v);
+            }
+        }
+        for (; x < width; ++x) {
+            if (nullptr == m || m[x]) {
+                lo = std::min(lo, src[x]);
+                hi = std::max(hi, src[x]);
+            }
+        }
+    }
+    minVal = std::min(lo, vminvq_u8(vmin));
+    maxVal = std::max(hi, vmaxvq_u8(vmax));
+}
+
+// the same for fp32, +inf and -inf when it is empty, NaNs are skipped by the minnm and maxnm forms
+static void stat_min_max(
+    int32_t y0,
+    int32_t y1,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    float &minVal,
+    float &maxVal)
+{
+    const float inf = std::numeric_limits<float>::infinity();
+    const float32x4_t vinf = vdupq_n_f32(inf), vninf = vdupq_n_f32(-inf);
+    float32x4_t vmin[2] = {vinf, vinf}, vmax[2] = {vninf, vninf};
+    float lo = inf, hi = -inf;
+    for (int32_t y = y0; y < y1; ++y) {
+        const float *src = inData + (size_t)y * inWidthStride;
+        const uint8_t *m = nullptr != mask ? mask + (size_t)y * maskWidthStride : nullptr;
+        int32_t x = 0;
+        for (; x <= width - 8; x += 8) {
+            for (int32_t j = 0; j < 2; ++j) {
+                float32x4_t v = vld1q_f32(src + x + 4 * j);
+                if (nullptr != m) {
+                    uint32x4_t on = stat_mask4(m + x + 4 * j);
+                    vmin[j] = vminnmq_f32(vmin[j], vbslq_f32(on, v, vinf));
+                    vmax[j] = vmaxnmq_f32(vmax[j], vbslq_f32(on, v, vninf));
+                } else {
+                    vmin[j] = vminnmq_f32(vmin[j], v);
+                    vmax[j] = vmaxnmq_f32(vmax[j], v);
+                }
+            }
+        }
+        for (; x < width; ++x) {
+            if (nullptr == m || m[x]) {
+                lo = src[x] < lo ? src[x] : lo;
+                hi = src[x] > hi ? src[x] : hi;
+            }
+        }
+    }
+    minVal = std::min(lo, vminnmvq_f32(vminnmq_f32(vmin[0], vmin[1])));
+    maxVal = std::max(hi, vmaxnmvq_f32(vmaxnmq_f32(vmax[0], vmax[1])));
+}
+
+// offset y * width + x of the first pixel of rows [y0, y1) equal to `value` where the mask is set, -1 if none
+static int64_t stat_locate(
+    int32_t y0,
+    int32_t y1,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    uint8_t value)
+{
+    const uint8x16_t vv = vdupq_n_u8(value);
+    for (int32_t y = y0; y < y1; ++y) {
+        const uint8_t *src = inData + (size_t)y * inWidthStride;
+        const uint8_t *m = nullptr != mask ? mask + (size_t)y * maskWidthStride : nullptr;
+        int32_t x = 0;
+        for (; x <= width - 16; x += 16) {
+            uint8x16_t eq = vceqq_u8(vld1q_u8(src + x), vv);
+            if (nullptr != m) {
+                uint8x16_t mv = vld1q_u8(m + x);
+                eq = vandq_u8(eq, vtstq_u8(mv, mv));
+            }
+            //! 4 bits per byte
+            uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+            if (bits) {
+                return (int64_t)y * width + x + (__builtin_ctzll(bits) >> 2);
+            }
+        }
+        for (; x < width; ++x) {
+            if (src[x] == value && (nullptr == m || m[x])) {
+                return (int64_t)y * width + x;
+            }
+        }
+    }
+    return -1;
+}
+
+static int64_t stat_locate(
+    int32_t y0,
+    int32_t y1,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    float value)
+{
+    const float32x4_t vv = vdupq_n_f32(value);
+    for (int32_t y = y0; y < y1; ++y) {
+        const float *src = inData + (size_t)y * inWidthStride;
+        const uint8_t *m = nullptr != mask ? mask + (size_t)y * maskWidthStride : nullptr;
+        int32_t x = 0;
+        for (; x <= width - 4; x += 4) {
+            uint32x4_t eq = vceqq_f32(vld1q_f32(src + x), vv);
+            if (nullptr != m) {
+                eq = vandq_u32(eq, stat_mask4(m + x));
+            }
+            //! 16 bits per lane
+            uint64_t bits = vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(eq)), 0);
+            if (bits) {
+                return (int64_t)y * width + x + (__builtin_ctzll(bits) >> 4);
+            }
+        }
+        for (; x < width; ++x) {
+            if (src[x] == value && (nullptr == m || m[x])) {
+                return (int64_t)y * width + x;
+            }
+        }
+    }
+    return -1;
+}
+
+template <typename T>
+void MinMaxLoc(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    T *minVal,
+    T *maxVal,
+    int32_t *minLoc,
+    int32_t *maxLoc,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    int32_t numThreads)
+{
+    if (!stat_valid<T, 1>(height, width, inWidthStride, inData, maskWidthStride, mask)) {
+        return;
+    }
+    int32_t bands = stat_bands(height, width, numThreads);
+    uint64_t size_for_at = ((uint64_t)bands * sizeof(int64_t) + 64 - 1) / 64 * 64;
+    uint64_t size_for_val = ((uint64_t)bands * sizeof(T) + 64 - 1) / 64 * 64;
+    void *temp_buffer = tinycv::ScratchAlloc(2 * size_for_at + 2 * size_for_val, 64);
+    int64_t *bandMinAt = (int64_t *)temp_buffer;
+    int64_t *bandMaxAt = (int64_t *)((unsigned char *)bandMinAt + size_for_at);
+    T *bandMin = (T *)((unsigned char *)bandMaxAt + size_for_at);
+    T *bandMax = (T *)((unsigned char *)bandMin + size_for_val);
+    ParallelFor(bands, bands, [&](int32_t b0, int32_t b1) {
+        for (int32_t b = b0; b < b1; ++b) {
+            int32_t y0 = (int32_t)((int64_t)height * b / bands);
+            int32_t y1 = (int32_t)((int64_t)height * (b + 1) / bands);
+            stat_min_max(y0, y1, width, inWidthStride, inData, maskWidthStride, mask, bandMin[b], bandMax[b]);
+        }
+    });
+    T lo = *std::min_element(bandMin, bandMin + bands);
+    T hi = *std::max_element(bandMax, bandMax + bands);
+
+    //! the extrema are known, every band looks for their first occurrence and the first band having one wins
+    ParallelFor(bands, bands, [&](int32_t b0, int32_t b1) {
+        for (int32_t b = b0; b < b1; ++b) {
+            int32_t y0 = (int32_t)((int64_t)height * b / bands);
+            int32_t y1 = (int32_t)((int64_t)height * (b + 1) / bands);
+            bandMinAt[b] = stat_locate(y0, y1, width, inWidthStride, inData, maskWidthStride, mask, lo);
+            bandMaxAt[b] = stat_locate(y0, y1, width, inWidthStride, inData, maskWidthStride, mask, hi);
+        }
+    });
+    int64_t minAt = -1, maxAt = -1;
+    for (int32_t b = bands - 1; b >= 0; --b) {
+        minAt = bandMinAt[b] >= 0 ? bandMinAt[b] : minAt;
+        maxAt = bandMaxAt[b] >= 0 ? bandMaxAt[b] : maxAt;
+    }
+    tinycv::ScratchFree(temp_buffer);
+    if (minAt < 0 || maxAt < 0) {
+        //! nothing under the mask
+        lo = hi = 0;
+        minAt = maxAt = -1;
+    }
+    if (nullptr != minVal) {
+        *minVal = lo;
+    }
+    if (nullptr != maxVal) {
+        *maxVal = hi;
+    }
+    if (nullptr != minLoc) {
+        minLoc[0] = minAt < 0 ? -1 : (int32_t)(minAt % width);
+        minLoc[1] = minAt < 0 ? -1 : (int32_t)(minAt / width);
+    }
+    if (nullptr != maxLoc) {
+        maxLoc[0] = maxAt < 0 ? -1 : (int32_t)(maxAt % width);
+        maxLoc[1] = maxAt < 0 ? -1 : (int32_t)(maxAt / width);
+    }
+}
+
+template void Sum<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, double *sum, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void Sum<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, double *sum, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void Sum<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, double *sum, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void Sum<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, double *sum, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void Sum<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, double *sum, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void Sum<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, double *sum, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+
+template void MeanStdDev<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, double *mean, double *stddev, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void MeanStdDev<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, double *mean, double *stddev, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void MeanStdDev<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, double *mean, double *stddev, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void MeanStdDev<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, double *mean, double *stddev, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void MeanStdDev<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, double *mean, double *stddev, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void MeanStdDev<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, double *mean, double *stddev, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+
+template void MinMaxLoc<uint8_t>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, uint8_t *minVal, uint8_t *maxVal, int32_t *minLoc, int32_t *maxLoc, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void MinMaxLoc<float>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, float *minVal, float *maxVal, int32_t *minLoc, int32_t *maxLoc, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+
+} // namespace tinycv
@@ -0,0 +1,142 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/statistics.h"
+#include "tinycv/debug.h"
+
+#include <opencv2/imgproc.hpp>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace {
+
+template <typename T, int32_t nc>
+void BM_MeanStdDev_tinycv_arm(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t numThreads = state.range(2);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    double mean[nc], stddev[nc];
+
+    for (auto _ : state) {
+        tinycv::MeanStdDev<T, nc>(height, width, width * nc, src.get(), mean, stddev, 0, nullptr, numThreads);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <typename T>
+void BM_MeanStdDevMask_tinycv_arm(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t numThreads = state.range(2);
+    std::unique_ptr<T[]> src(new T[width * height]);
+    std::unique_ptr<uint8_t[]> mask(new uint8_t[width * height]);
+    tinycv::debug::randomFill<T>(src.get(), width * height, 0, 255);
+    tinycv::debug::randomFill<uint8_t>(mask.get(), width * height, 0, 1);
+    double mean, stddev;
+
+    for (auto _ : state) {
+        tinycv::MeanStdDev<T, 1>(height, width, width, src.get(), &mean, &stddev, width, mask.get(), numThreads);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <typename T>
+void BM_Sum_tinycv_arm(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t numThreads = state.range(2);
+    std::unique_ptr<T[]> src(new T[width * height]);
+    tinycv::debug::randomFill<T>(src.get(), width * height, 0, 255);
+    double sum;
+
+    for (auto _ : state) {
+        tinycv::Sum<T, 1>(height, width, width, src.get(), &sum, 0, nullptr, numThreads);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <typename T>
+void BM_MinMaxLoc_tinycv_arm(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t numThreads = state.range(2);
+    std::unique_ptr<T[]> src(new T[width * height]);
+    tinycv::debug::randomFill<T>(src.get(), width * height, 0, 255);
+    T minVal, maxVal;
+    int32_t minLoc[2], maxLoc[2];
+
+    for (auto _ : state) {
+        tinycv::MinMaxLoc<T>(height, width, width, src.get(), &minVal, &maxVal, minLoc, maxLoc, 0, nullptr, numThreads);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_Sum_tinycv_arm, uint8_t)->Args({1920, 1080, 1})->Args({3840, 2160, 1})->Args({3840, 2160, 4});
+BENCHMARK_TEMPLATE(BM_MeanStdDev_tinycv_arm, uint8_t, 1)->Args({1920, 1080, 1})->Args({3840, 2160, 1})->Args({3840, 2160, 4});
+BENCHMARK_TEMPLATE(BM_MeanStdDev_tinycv_arm, uint8_t, 3)->Args({1920, 1080, 1})->Args({3840, 2160, 4});
+BENCHMARK_TEMPLATE(BM_MeanStdDev_tinycv_arm, float, 1)->Args({1920, 1080, 1})->Args({3840, 2160, 4});
+BENCHMARK_TEMPLATE(BM_MeanStdDevMask_tinycv_arm, uint8_t)->Args({1920, 1080, 1})->Args({3840, 2160, 4});
+BENCHMARK_TEMPLATE(BM_MinMaxLoc_tinycv_arm, uint8_t)->Args({1920, 1080, 1})->Args({3840, 2160, 1})->Args({3840, 2160, 4});
+BENCHMARK_TEMPLATE(BM_MinMaxLoc_tinycv_arm, float)->Args({1920, 1080, 1})->Args({3840, 2160, 4});
+
+#ifdef TINYCV_BENCHMARK_OPENCV
+template <typename T, int32_t nc>
+static void BM_MeanStdDev_opencv_arm(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Scalar mean, stddev;
+    for (auto _ : state) {
+        cv::meanStdDev(iMat, mean, stddev);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <typename T>
+static void BM_MinMaxLoc_opencv_arm(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height]);
+    tinycv::debug::randomFill<T>(src.get(), width * height, 0, 255);
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, 1), src.get());
+    double minVal, maxVal;
+    cv::Point minLoc, maxLoc;
+    for (auto _ : state) {
+        cv::minMaxLoc(iMat, &minVal, &maxVal, &minLoc, &maxLoc);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_MeanStdDev_opencv_arm, uint8_t, 1)->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_MeanStdDev_opencv_arm, uint8_t, 3)->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_MeanStdDev_opencv_arm, float, 1)->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_MinMaxLoc_opencv_arm, uint8_t)->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_MinMaxLoc_opencv_arm, float)->Args({1920, 1080})->Args({3840, 2160});
+
+#endif //! TINYCV_BENCHMARK_OPENCV
+} // namespace
@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "tinycv/stream.h"
+#include "tinycv/resize.h"
+#include "tinycv/arm/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+
+template <typename T, int32_t nc>
+void StreamResizeLinearTest(tinycv::StreamContext &context, int32_t inHeight, int32_t inWidth, int32_t outHeight, int32_t outWidth)
+{
+    std::unique_ptr<T[]> src(new T[inWidth * inHeight * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[outWidth * outHeight * nc]);
+    std::unique_ptr<T[]> dst(new T[outWidth * outHeight * nc]);
+    tinycv::debug::randomFill<T>(src.get(), inWidth * inHeight * nc, 0, 255);
+
+    tinycv::ResizeLinear<T, nc>(inHeight, inWidth, inWidth * nc, src.get(), outHeight, outWidth, outWidth * nc, dst_ref.get());
+    // the first frame builds the tables, the next ones reuse them
+    for (int32_t frame = 0; frame < 3; ++frame) {
+        tinycv::ResizeLinear<T, nc>(context, inHeight, inWidth, inWidth * nc, src.get(), outHeight, outWidth, outWidth * nc, dst.get());
+        EXPECT_EQ(0, memcmp(dst_ref.get(), dst.get(), sizeof(T) * outWidth * outHeight * nc));
+    }
+}
+
+template <typename T, int32_t nc>
+void StreamResizeLinearGeometryTest()
+{
+    // one context for all geometries, switching back and forth has to rebuild the tables
+    tinycv::StreamContext context;
+    StreamResizeLinearTest<T, nc>(context, 360, 540, 720, 1080);
+    StreamResizeLinearTest<T, nc>(context, 720, 1080, 360, 540);
+    StreamResizeLinearTest<T, nc>(context, 724, 1076, 181, 269);
+    StreamResizeLinearTest<T, nc>(context, 360, 540, 720, 1080);
+    StreamResizeLinearTest<T, nc>(context, 640, 480, 360, 540);
+    StreamResizeLinearTest<T, nc>(context, 101, 99, 37, 203);
+
+    tinycv::StreamStageStats stats;
+    ASSERT_TRUE(context.GetStageStats("ResizeLinear", &stats));
+    EXPECT_EQ(18u, stats.count);
+    EXPECT_LE(stats.p50, stats.p90);
+    EXPECT_LE(stats.p90, stats.p99);
+    EXPECT_LE(stats.p99, stats.max);
+}
+
+TEST(STREAM_RESIZE_LINEAR, arm)
+{
+    StreamResizeLinearGeometryTest<uint8_t, 1>();
+    StreamResizeLinearGeometryTest<uint8_t, 3>();
+    StreamResizeLinearGeometryTest<uint8_t, 4>();
+    StreamResizeLinearGeometryTest<float, 1>();
+    StreamResizeLinearGeometryTest<float, 3>();
+    StreamResizeLinearGeometryTest<float, 4>();
+    StreamResizeLinearGeometryTest<uint16_t, 3>();
+    StreamResizeLinearGeometryTest<int16_t, 4>();
+}
+
+TEST(STREAM_STATS, arm)
+{
+    tinycv::StreamContext context(100);
+    tinycv::StreamStageStats stats;
+    EXPECT_FALSE(context.GetStageStats("decode", &stats));
+
+    // only the last 100 of 1..200 are kept
+    for (int32_t i = 1; i <= 200; ++i) {
+        context.RecordStage("decode", i);
+    }
+    ASSERT_TRUE(context.GetStageStats("decode", &stats));
+    EXPECT_EQ(200u, stats.count);
+    EXPECT_EQ(150.0, stats.p50);
+    EXPECT_EQ(190.0, stats.p90);
+    EXPECT_EQ(199.0, stats.p99);
+    EXPECT_EQ(200.0, stats.max);
+
+    {
+        tinycv::StreamStageTimer timer(context, "convert");
+    }
+    ASSERT_TRUE(context.GetStageStats("convert", &stats));
+    EXPECT_EQ(1u, stats.count);
+    EXPECT_GE(stats.max, 0.0);
+
+    context.ResetStats();
+    EXPECT_FALSE(context.GetStageStats("decode", &stats));
+    EXPECT_FALSE(context.GetStageStats("convert", &stats));
+}
+
+TEST(STREAM_BUFFERS, arm)
+{
+    tinycv::StreamContext context;
+    uint8_t *scratch = (uint8_t *)context.Scratch("rows", 1000);
+    ASSERT_NE(nullptr, scratch);
+    EXPECT_EQ(0u, (uintptr_t)scratch % 128);
+    // a smaller request is served by the same buffer
+    EXPECT_EQ(scratch, context.Scratch("rows", 10));
+
+    const int32_t key_a[] = {480, 640, 3};
+    const int32_t key_b[] = {480, 640, 4};
+    bool ready = true;
+    int32_t *tables = (int32_t *)context.Tables("offsets", key_a, 3, 256, &ready);
+    ASSERT_NE(nullptr, tables);
+    EXPECT_FALSE(ready);
+    tables[0] = 42;
+    EXPECT_EQ(tables, context.Tables("offsets", key_a, 3, 256, &ready));
+    EXPECT_TRUE(ready);
+    EXPECT_EQ(42, tables[0]);
+    context.Tables("offsets", key_b, 3, 256, &ready);
+    EXPECT_FALSE(ready);
+    context.Tables("offsets", key_a, 3, 256, &ready);
+    EXPECT_FALSE(ready);
+}
@@ -24,6 +24,8 @@
 #include <random>
 #include <iostream>
 
+#include "tinycv/types.h"
+
 #define USE_QUANTIZED
 
 template <typename T, int32_t nc>
@@ -51,6 +53,20 @@ inline void checkResult(const T *data1,
     EXPECT_LT(max, diff_THR);
 }
 
+/**
+ * Fill a half precision buffer and its fp32 copy with the same random values,
+ * the fp32 copy is what gets handed to OpenCV as the reference input.
+ */
+inline void randomFillHalf(tinycv::half_t *data, float *data_f32, size_t N, float min, float max)
+{
+    std::default_random_engine eng(clock());
+    std::uniform_real_distribution<float> dis(min, max);
+    for (size_t i = 0; i < N; ++i) {
+        data[i] = tinycv::half_t(dis(eng));
+        data_f32[i] = data[i];
+    }
+}
+
 struct Size {
     int width;
     int height;
@@ -0,0 +1,101 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_ARM_THRESHOLD_HPP_
+#define __ST_TINYCV_ARM_THRESHOLD_HPP_
+
+#include "tinycv/threshold.h"
+
+#include <arm_neon.h>
+
+namespace tinycv {
+
+// Per element threshold of a fixed type, for 16 or 8 u8 and 4 f32 lanes at a time and for single elements.
+// `type` is a compile time constant so every branch below folds away.
+template <int32_t type>
+struct ThresholdOpU8 {
+    ThresholdOpU8(uint8_t thresh, uint8_t maxval)
+        : t(thresh), m(maxval)
+    {
+        v_t = vdupq_n_u8(thresh);
+        v_m = vdupq_n_u8(maxval);
+    }
+    inline uint8_t operator()(uint8_t x) const
+    {
+        bool gt = x > t;
+        if (type == THRESH_BINARY) return gt ? m : 0;
+        if (type == THRESH_BINARY_INV) return gt ? 0 : m;
+        if (type == THRESH_TRUNC) return gt ? t : x;
+        if (type == THRESH_TOZERO) return gt ? x : 0;
+        return gt ? 0 : x;
+    }
+    inline uint8x16_t operator()(uint8x16_t x) const
+    {
+        if (type == THRESH_TRUNC) return vminq_u8(x, v_t);
+        uint8x16_t gt = vcgtq_u8(x, v_t);
+        if (type == THRESH_BINARY) return vandq_u8(gt, v_m);
+        if (type == THRESH_BINARY_INV) return vbicq_u8(v_m, gt);
+        if (type == THRESH_TOZERO) return vandq_u8(gt, x);
+        return vbicq_u8(x, gt);
+    }
+    inline uint8x8_t operator()(uint8x8_t x) const
+    {
+        uint8x8_t t8 = vget_low_u8(v_t), m8 = vget_low_u8(v_m);
+        if (type == THRESH_TRUNC) return vmin_u8(x, t8);
+        uint8x8_t gt = vcgt_u8(x, t8);
+        if (type == THRESH_BINARY) return vand_u8(gt, m8);
+        if (type == THRESH_BINARY_INV) return vbic_u8(m8, gt);
+        if (type == THRESH_TOZERO) return vand_u8(gt, x);
+        return vbic_u8(x, gt);
+    }
+    uint8_t t, m;
+    uint8x16_t v_t, v_m;
+};
+
+template <int32_t type>
+struct ThresholdOpF32 {
+    ThresholdOpF32(float thresh, float maxval)
+        : t(thresh), m(maxval)
+    {
+        v_t = vdupq_n_f32(thresh);
+        v_m = vdupq_n_f32(maxval);
+    }
+    inline float operator()(float x) const
+    {
+        bool gt = x > t;
+        if (type == THRESH_BINARY) return gt ? m : 0.f;
+        if (type == THRESH_BINARY_INV) return gt ? 0.f : m;
+        if (type == THRESH_TRUNC) return gt ? t : x;
+        if (type == THRESH_TOZERO) return gt ? x : 0.f;
+        return gt ? 0.f : x;
+    }
+    inline float32x4_t operator()(float32x4_t x) const
+    {
+        uint32x4_t gt = vcgtq_f32(x, v_t);
+        if (type == THRESH_BINARY) return vreinterpretq_f32_u32(vandq_u32(gt, vreinterpretq_u32_f32(v_m)));
+        if (type == THRESH_BINARY_INV) return vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(v_m), gt));
+        if (type == THRESH_TRUNC) return vbslq_f32(gt, v_t, x);
+        if (type == THRESH_TOZERO) return vreinterpretq_f32_u32(vandq_u32(gt, vreinterpretq_u32_f32(x)));
+        return vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(x), gt));
+    }
+    float t, m;
+    float32x4_t v_t, v_m;
+};
+
+} // namespace tinycv
+
+#endif //! __ST_TINYCV_ARM_THRESHOLD_HPP_
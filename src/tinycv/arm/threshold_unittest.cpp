@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/threshold.h"
+#include "tinycv/cvtcolor.h"
+#include "tinycv/arm/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <memory>
+
+template <typename T, int32_t nc>
+void ThresholdTest(int32_t height, int32_t width, int32_t type)
+{
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst_opencv(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    T thresh = (T)117;
+    T maxval = (T)200;
+
+    T used = tinycv::Threshold<T, nc>(height, width, width * nc, src.get(), width * nc, dst.get(), thresh, maxval, type);
+
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat oMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_opencv.get());
+    double used_opencv = cv::threshold(iMat, oMat, thresh, maxval, type);
+
+    EXPECT_EQ((double)used, used_opencv);
+    checkResult<T, nc>(dst.get(), dst_opencv.get(), height, width, width * nc, width * nc, 0.01f);
+}
+
+void BGR2GRAYThresholdTest(int32_t height, int32_t width, int32_t type)
+{
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * 3]);
+    std::unique_ptr<uint8_t[]> gray(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst_ref(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height * 3, 0, 255);
+
+    uint8_t used = tinycv::BGR2GRAYThreshold(height, width, width * 3, src.get(), width, dst.get(), 117, 200, type);
+
+    tinycv::BGR2GRAY<uint8_t>(height, width, width * 3, src.get(), width, gray.get());
+    uint8_t used_ref = tinycv::Threshold<uint8_t, 1>(height, width, width, gray.get(), width, dst_ref.get(), 117, 200, type);
+
+    EXPECT_EQ(used, used_ref);
+    checkResult<uint8_t, 1>(dst.get(), dst_ref.get(), height, width, width, width, 0.01f);
+}
+
+TEST(THRESHOLD_UINT8, arm)
+{
+    for (int32_t type = tinycv::THRESH_BINARY; type <= tinycv::THRESH_TOZERO_INV; ++type) {
+        ThresholdTest<uint8_t, 1>(480, 640, type);
+        ThresholdTest<uint8_t, 3>(480, 640, type);
+        ThresholdTest<uint8_t, 4>(101, 99, type);
+        ThresholdTest<uint8_t, 1>(101, 99, type | tinycv::THRESH_OTSU);
+    }
+}
+
+TEST(THRESHOLD_FP32, arm)
+{
+    for (int32_t type = tinycv::THRESH_BINARY; type <= tinycv::THRESH_TOZERO_INV; ++type) {
+        ThresholdTest<float, 1>(480, 640, type);
+        ThresholdTest<float, 3>(480, 640, type);
+        ThresholdTest<float, 4>(101, 99, type);
+    }
+}
+
+TEST(BGR2GRAY_THRESHOLD_UINT8, arm)
+{
+    for (int32_t type = tinycv::THRESH_BINARY; type <= tinycv::THRESH_TOZERO_INV; ++type) {
+        BGR2GRAYThresholdTest(480, 640, type);
+        BGR2GRAYThresholdTest(101, 99, type);
+        BGR2GRAYThresholdTest(101, 99, type | tinycv::THRESH_OTSU);
+    }
+}
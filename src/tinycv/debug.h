@@ -34,6 +34,10 @@ struct T2CvType<uint8_t, channels> {
     static constexpr int32_t type = CV_MAKETYPE(CV_8U, channels);
 };
 template <int32_t channels>
+struct T2CvType<uint16_t, channels> {
+    static constexpr int32_t type = CV_MAKETYPE(CV_16U, channels);
+};
+template <int32_t channels>
 struct T2CvType<int16_t, channels> {
     static constexpr int32_t type = CV_MAKETYPE(CV_16S, channels);
 };
@@ -44,6 +48,7 @@ struct T2CvType<int16_t, channels> {
 #endif // TINYCV_UNITTEST_OPENCV || TINYCV_BENCHMARK_OPENCV
 
 #include <random>
+#include "tinycv/types.h"
 namespace tinycv {
 
 /**
@@ -118,6 +123,19 @@ public:
     }
 };
 
+template <>
+class RandomFillImpl<half_t, false> {
+public:
+    static void randomFill(half_t* array, size_t N, half_t min, half_t max)
+    {
+        std::default_random_engine eng(clock());
+        std::uniform_real_distribution<float> dis(min, max);
+        for (size_t i = 0; i < N; ++i) {
+            array[i] = half_t(dis(eng));
+        }
+    }
+};
+
 template <typename T>
 inline void randomFill(T* array, size_t N, T min, T max)
 {
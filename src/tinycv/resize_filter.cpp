@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/resize_filter.hpp"
+
+#include <algorithm>
+#include <math.h>
+#include <mutex>
+
+namespace tinycv {
+
+static inline double lanczos_kernel(double x, double window)
+{
+    x = fabs(x);
+    if (x >= window) {
+        return 0.0;
+    }
+    if (x < 1e-8) {
+        return 1.0;
+    }
+    double px = M_PI * x;
+    return window * sin(px) * sin(px / window) / (px * px);
+}
+
+static std::shared_ptr<ResizeFilterTable> build_lanczos_table(
+    int32_t in_size,
+    int32_t out_size,
+    int32_t window)
+{
+    std::shared_ptr<ResizeFilterTable> table = std::make_shared<ResizeFilterTable>();
+    double scale = (double)in_size / out_size;
+    double fscale = std::max(scale, 1.0);
+    double support = window * fscale;
+    int32_t ksize = std::min((int32_t)ceil(support) * 2 + 1, in_size);
+    int32_t kpad = (ksize + 7) & ~7;
+
+    table->in_size = in_size;
+    table->out_size = out_size;
+    table->window = window;
+    table->ksize = ksize;
+    table->ksize_pad = kpad;
+    table->start.resize(out_size);
+    table->weights.assign((size_t)out_size * kpad, 0.f);
+
+    std::vector<double> w(ksize);
+    for (int32_t i = 0; i < out_size; ++i) {
+        double center = (i + 0.5) * scale;
+        int32_t xmin = std::max((int32_t)floor(center - support + 0.5), 0);
+        int32_t xmax = std::min((int32_t)floor(center + support + 0.5), in_size);
+        xmax = std::min(xmax, xmin + ksize);
+        double sum = 0;
+        for (int32_t x = xmin; x < xmax; ++x) {
+            w[x - xmin] = lanczos_kernel((x + 0.5 - center) / fscale, window);
+            sum += w[x - xmin];
+        }
+        int32_t start = std::min(xmin, in_size - ksize);
+        float *dst = &table->weights[(size_t)i * kpad + (xmin - start)];
+        for (int32_t x = xmin; x < xmax; ++x) {
+            dst[x - xmin] = sum != 0 ? (float)(w[x - xmin] / sum) : 0.f;
+        }
+        table->start[i] = start;
+    }
+    return table;
+}
+
+std::shared_ptr<const ResizeFilterTable> GetLanczosFilterTable(
+    int32_t in_size,
+    int32_t out_size,
+    int32_t window)
+{
+    // a handful of geometries covers a video pipeline, the least recently used entry is evicted
+    static const int32_t CACHE_SIZE = 16;
+    static std::shared_ptr<const ResizeFilterTable> cache[CACHE_SIZE];
+    static uint64_t last_use[CACHE_SIZE];
+    static uint64_t clock = 0;
+    static std::mutex cache_mutex;
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    int32_t victim = 0;
+    for (int32_t i = 0; i < CACHE_SIZE; ++i) {
+        const ResizeFilterTable *t = cache[i].get();
+        if (t && t->in_size == in_size && t->out_size == out_size && t->window == window) {
+            last_use[i] = ++clock;
+            return cache[i];
+        }
+        if (last_use[i] < last_use[victim]) {
+            victim = i;
+        }
+    }
+    cache[victim] = build_lanczos_table(in_size, out_size, window);
+    last_use[victim] = ++clock;
+    return cache[victim];
+}
+
+} // namespace tinycv
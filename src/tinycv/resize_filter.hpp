@@ -0,0 +1,56 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_RESIZE_FILTER_HPP_
+#define __ST_TINYCV_RESIZE_FILTER_HPP_
+
+#include <stdint.h>
+#include <memory>
+#include <vector>
+
+namespace tinycv {
+
+/**
+ * Weight table of a separable windowed-sinc resize along one axis.
+ * Output pixel `i` is `sum(weights[i * ksize_pad + k] * in[start[i] + k])` for `k < ksize`,
+ * windows near the border are shifted inwards so every one of them stays inside the input,
+ * taps outside of the filter support carry zero weight. Weights of each output sum to 1.
+ */
+struct ResizeFilterTable {
+    int32_t in_size;
+    int32_t out_size;
+    int32_t window;
+    int32_t ksize; //!< taps per output, never more than in_size
+    int32_t ksize_pad; //!< row length of weights, ksize rounded up to a multiple of 8
+    std::vector<int32_t> start;
+    std::vector<float> weights;
+};
+
+/**
+ * Get the Lanczos weight table resizing `in_size` to `out_size` with a kernel of `window` lobes.
+ * When shrinking, the kernel is stretched by the scale factor so it low-pass filters the input.
+ * Tables are built once per geometry and kept in a small process-wide cache, the returned table is
+ * immutable and may be shared by any number of threads and frames.
+ */
+std::shared_ptr<const ResizeFilterTable> GetLanczosFilterTable(
+    int32_t in_size,
+    int32_t out_size,
+    int32_t window);
+
+} // namespace tinycv
+
+#endif //! __ST_TINYCV_RESIZE_FILTER_HPP_
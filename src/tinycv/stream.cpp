@@ -0,0 +1,197 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/stream.h"
+#include "tinycv/sys.h"
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace tinycv {
+
+static constexpr int32_t STREAM_MAX_KEY = 16;
+
+struct StreamBuffer {
+    std::string name;
+    bool tables;
+    int32_t key_length;
+    int32_t key[STREAM_MAX_KEY];
+    uint64_t capacity;
+    void *data;
+};
+
+struct StreamStage {
+    std::string name;
+    uint64_t count;
+    std::vector<float> samples; //!< ring of the last `window` latencies
+};
+
+struct StreamContext::Impl {
+    uint32_t isa;
+    int32_t window;
+    std::vector<StreamBuffer> buffers;
+    std::vector<StreamStage> stages;
+    mutable std::vector<float> sorted;
+};
+
+// a stream uses a handful of buffers and stages, a linear search beats any hashing here
+static StreamBuffer *stream_find_buffer(std::vector<StreamBuffer> &buffers, const char *name, bool tables)
+{
+    for (auto &buffer : buffers) {
+        if (buffer.tables == tables && buffer.name == name) {
+            return &buffer;
+        }
+    }
+    return nullptr;
+}
+
+static bool stream_reserve(StreamBuffer *buffer, uint64_t size)
+{
+    if (buffer->capacity >= size && buffer->data) {
+        return true;
+    }
+    AlignedFree(buffer->data);
+    buffer->data = AlignedAlloc(size, 128);
+    buffer->capacity = buffer->data ? size : 0;
+    return buffer->data != nullptr;
+}
+
+StreamContext::StreamContext(int32_t statsWindow)
+    : impl_(new Impl)
+{
+    impl_->isa = GetCpuISA();
+    impl_->window = statsWindow > 0 ? statsWindow : 1;
+}
+
+StreamContext::~StreamContext()
+{
+    for (auto &buffer : impl_->buffers) {
+        AlignedFree(buffer.data);
+    }
+    delete impl_;
+}
+
+uint32_t StreamContext::Isa() const
+{
+    return impl_->isa;
+}
+
+void *StreamContext::Scratch(const char *name, uint64_t size)
+{
+    StreamBuffer *buffer = stream_find_buffer(impl_->buffers, name, false);
+    if (!buffer) {
+        impl_->buffers.push_back(StreamBuffer{name, false, 0, {}, 0, nullptr});
+        buffer = &impl_->buffers.back();
+    }
+    return stream_reserve(buffer, size) ? buffer->data : nullptr;
+}
+
+void *StreamContext::Tables(const char *name, const int32_t *key, int32_t keyLength, uint64_t size, bool *ready)
+{
+    *ready = false;
+    if (keyLength < 0 || keyLength > STREAM_MAX_KEY) {
+        return nullptr;
+    }
+    StreamBuffer *buffer = stream_find_buffer(impl_->buffers, name, true);
+    if (!buffer) {
+        impl_->buffers.push_back(StreamBuffer{name, true, 0, {}, 0, nullptr});
+        buffer = &impl_->buffers.back();
+    }
+    if (buffer->data && buffer->capacity >= size && buffer->key_length == keyLength &&
+        memcmp(buffer->key, key, keyLength * sizeof(int32_t)) == 0) {
+        *ready = true;
+        return buffer->data;
+    }
+    // invalidate first, a failed allocation must not leave the old key on a buffer
+    buffer->key_length = -1;
+    if (!stream_reserve(buffer, size)) {
+        return nullptr;
+    }
+    buffer->key_length = keyLength;
+    memcpy(buffer->key, key, keyLength * sizeof(int32_t));
+    return buffer->data;
+}
+
+void StreamContext::RecordStage(const char *stage, double microseconds)
+{
+    StreamStage *entry = nullptr;
+    for (auto &s : impl_->stages) {
+        if (s.name == stage) {
+            entry = &s;
+            break;
+        }
+    }
+    if (!entry) {
+        impl_->stages.push_back(StreamStage{stage, 0, std::vector<float>(impl_->window)});
+        entry = &impl_->stages.back();
+    }
+    entry->samples[entry->count % impl_->window] = (float)microseconds;
+    ++entry->count;
+}
+
+bool StreamContext::GetStageStats(const char *stage, StreamStageStats *stats) const
+{
+    for (const auto &s : impl_->stages) {
+        if (s.name != stage || s.count == 0) {
+            continue;
+        }
+        size_t n = (size_t)std::min<uint64_t>(s.count, impl_->window);
+        impl_->sorted.assign(s.samples.begin(), s.samples.begin() + n);
+        std::sort(impl_->sorted.begin(), impl_->sorted.end());
+        // nearest rank, the smallest sample not exceeded by p percent of them
+        auto rank = [n](double p) { return (size_t)std::max(0.0, ceil(p * n) - 1.0); };
+        stats->count = s.count;
+        stats->p50 = impl_->sorted[rank(0.50)];
+        stats->p90 = impl_->sorted[rank(0.90)];
+        stats->p99 = impl_->sorted[rank(0.99)];
+        stats->max = impl_->sorted[n - 1];
+        return true;
+    }
+    return false;
+}
+
+void StreamContext::ResetStats()
+{
+    for (auto &s : impl_->stages) {
+        s.count = 0;
+    }
+}
+
+static inline int64_t stream_now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+StreamStageTimer::StreamStageTimer(StreamContext &context, const char *stage)
+    : context_(context)
+    , stage_(stage)
+    , start_(stream_now_ns())
+{
+}
+
+StreamStageTimer::~StreamStageTimer()
+{
+    context_.RecordStage(stage_, (stream_now_ns() - start_) * 1e-3);
+}
+
+} // namespace tinycv
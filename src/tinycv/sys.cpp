@@ -16,9 +16,14 @@
 // under the License.
 
 #include "tinycv/sys.h"
+#include "tinycv/allocator.h"
 
 #include <string.h>
 #include <stdlib.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
 #ifdef _WIN32
 #define WIN32_LEAN_MEAN
 #define NOGDI // remove ERROR def
@@ -55,13 +60,226 @@ static inline void AlignedFree_impl(void* p)
 #endif
 }
 
-void* AlignedAlloc(uint64_t size, uint32_t alignment)
+static void* default_alloc(uint64_t size, uint32_t alignment, void*)
 {
     return AlignedAlloc_impl(size, alignment);
 }
-void AlignedFree(void* p)
+static void default_free(void* p, void*)
 {
     AlignedFree_impl(p);
 }
 
+// installed allocators are never freed, a thread may still be copying one that was just replaced
+struct AllocatorNode {
+    Allocator allocator;
+    AllocatorNode* next; //!< the previously installed one, keeps them all reachable
+};
+
+static AllocatorNode default_allocator = {{default_alloc, default_free, nullptr}, nullptr};
+static std::atomic<AllocatorNode*> g_allocator(&default_allocator);
+static AllocatorNode* g_installed_allocators = nullptr;
+static std::mutex g_install_mutex;
+static std::atomic<uint64_t> g_arena_size(4 << 20);
+// bumped by every setting change, an arena built under another generation is rebuilt once it is empty
+static std::atomic<uint32_t> g_arena_generation(0);
+
+void SetAllocator(const Allocator* allocator)
+{
+    AllocatorNode* node = &default_allocator;
+    if (allocator && allocator->alloc && allocator->free) {
+        node = (AllocatorNode*)malloc(sizeof(AllocatorNode));
+        if (!node) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(g_install_mutex);
+        node->allocator = *allocator;
+        node->next = g_installed_allocators;
+        g_installed_allocators = node;
+    }
+    g_allocator.store(node, std::memory_order_release);
+    ++g_arena_generation;
+}
+
+void SetScratchArenaSize(uint64_t size)
+{
+    g_arena_size = size;
+    ++g_arena_generation;
+}
+
+uint64_t GetScratchArenaSize()
+{
+    return g_arena_size;
+}
+
+// precedes every block of AlignedAlloc, the block goes back to the allocator that made it
+struct AlignedHeader {
+    void* raw;
+    Allocator allocator;
+};
+
+void* AlignedAlloc(uint64_t size, uint32_t alignment)
+{
+    const Allocator allocator = g_allocator.load(std::memory_order_acquire)->allocator;
+    if (alignment < alignof(AlignedHeader)) {
+        alignment = alignof(AlignedHeader);
+    }
+    uint64_t offset = (sizeof(AlignedHeader) + alignment - 1) / alignment * alignment;
+    unsigned char* raw = (unsigned char*)allocator.alloc(size + offset, alignment, allocator.user);
+    if (!raw) {
+        return nullptr;
+    }
+    AlignedHeader* header = (AlignedHeader*)(raw + offset) - 1;
+    header->raw = raw;
+    header->allocator = allocator;
+    return raw + offset;
+}
+void AlignedFree(void* p)
+{
+    if (p) {
+        const AlignedHeader* header = (const AlignedHeader*)p - 1;
+        header->allocator.free(header->raw, header->allocator.user);
+    }
+}
+
+static constexpr uint64_t SCRATCH_NONE = ~(uint64_t)0;
+
+// precedes every block handed out by an arena
+struct ScratchHeader {
+    uint64_t prev_top;
+    uint64_t prev_last;
+    uint64_t freed;
+};
+
+struct ScratchArena {
+    uint32_t generation;
+    unsigned char* base;
+    uint64_t capacity;
+    uint64_t top; //!< first unused byte
+    uint64_t last; //!< header of the most recent block, SCRATCH_NONE when the arena is empty
+
+    ScratchArena()
+        : generation(0)
+        , base(nullptr)
+        , capacity(0)
+        , top(0)
+        , last(SCRATCH_NONE)
+    {
+    }
+    ~ScratchArena()
+    {
+        Release();
+    }
+
+    void Release()
+    {
+        AlignedFree(base);
+        base = nullptr;
+        capacity = 0;
+    }
+};
+
+static thread_local ScratchArena t_arena;
+
+void* ScratchAlloc(uint64_t size, uint32_t alignment)
+{
+    ScratchArena& arena = t_arena;
+    if (arena.top == 0) {
+        uint32_t generation = g_arena_generation;
+        uint64_t capacity = g_arena_size;
+        if (arena.generation != generation || (!arena.base && capacity > 0)) {
+            arena.Release();
+            arena.generation = generation;
+            if (capacity > 0) {
+                arena.base = (unsigned char*)AlignedAlloc(capacity, 128);
+                arena.capacity = arena.base ? capacity : 0;
+            }
+        }
+    }
+    if (alignment < sizeof(uint64_t)) {
+        alignment = sizeof(uint64_t);
+    }
+    if (arena.base) {
+        uintptr_t begin = (uintptr_t)arena.base;
+        uintptr_t p = (begin + arena.top + sizeof(ScratchHeader) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+        uint64_t end = p + size - begin;
+        if (end <= arena.capacity) {
+            ScratchHeader* header = (ScratchHeader*)(p - sizeof(ScratchHeader));
+            header->prev_top = arena.top;
+            header->prev_last = arena.last;
+            header->freed = 0;
+            arena.last = p - sizeof(ScratchHeader) - begin;
+            arena.top = end;
+            return (void*)p;
+        }
+    }
+    return AlignedAlloc(size, alignment);
+}
+
+void ScratchFree(void* p)
+{
+    if (!p) {
+        return;
+    }
+    ScratchArena& arena = t_arena;
+    uintptr_t begin = (uintptr_t)arena.base;
+    if (!arena.base || (uintptr_t)p <= begin || (uintptr_t)p > begin + arena.capacity) {
+        AlignedFree(p);
+        return;
+    }
+    ((ScratchHeader*)((uintptr_t)p - sizeof(ScratchHeader)))->freed = 1;
+    // a block freed before the ones above it is reclaimed together with them
+    while (arena.last != SCRATCH_NONE) {
+        ScratchHeader* header = (ScratchHeader*)(arena.base + arena.last);
+        if (!header->freed) {
+            break;
+        }
+        arena.top = header->prev_top;
+        arena.last = header->prev_last;
+    }
+}
+
+void ReleaseScratchArena()
+{
+    if (t_arena.top == 0) {
+        t_arena.Release();
+    }
+}
+
+// joins the started workers on every return path of ParallelFor, a joinable std::thread must not be destroyed
+struct ThreadJoiner {
+    std::vector<std::thread>& workers;
+
+    ~ThreadJoiner()
+    {
+        for (auto& worker : workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+    }
+};
+
+void ParallelFor(int32_t count, int32_t numThreads, const std::function<void(int32_t, int32_t)>& body)
+{
+    if (count <= 0) {
+        return;
+    }
+    if (numThreads > count) {
+        numThreads = count;
+    }
+    if (numThreads <= 1) {
+        body(0, count);
+        return;
+    }
+    std::vector<std::thread> workers;
+    ThreadJoiner joiner = {workers};
+    workers.reserve(numThreads - 1);
+    for (int32_t i = 1; i < numThreads; ++i) {
+        int32_t begin = (int32_t)((int64_t)count * i / numThreads);
+        int32_t end = (int32_t)((int64_t)count * (i + 1) / numThreads);
+        workers.emplace_back([&body, begin, end]() { body(begin, end); });
+    }
+    body(0, (int32_t)((int64_t)count / numThreads));
+}
+
 } // namespace tinycv
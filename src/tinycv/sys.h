@@ -19,6 +19,7 @@
 #define __ST_TINYCV_SYS_H_
 
 #include <stdint.h>
+#include <functional>
 
 namespace tinycv {
 
@@ -65,9 +66,27 @@ static inline isa_t GetCpuISA(int which = 0)
 void GetCPUInfoByCPUID(CpuInfo* info);
 void GetCPUInfoByRun(CpuInfo* info);
 
+// go through the allocator installed with SetAllocator, a block is freed by the one that made it
 void* AlignedAlloc(uint64_t size, uint32_t alignment);
 void AlignedFree(void* p);
 
+/**
+ * Temporary memory of a kernel call, taken from the calling thread's scratch arena, see `tinycv/allocator.h`.
+ * Falls back to AlignedAlloc when it does not fit. Blocks are meant to be freed with ScratchFree before the
+ * call returns, in any order, the arena space is reclaimed once the most recent blocks are freed.
+ */
+void* ScratchAlloc(uint64_t size, uint32_t alignment);
+void ScratchFree(void* p);
+
+/**
+ * Splits `[0, count)` into `numThreads` contiguous ranges and calls `body(begin, end)` once per range,
+ * each on its own thread. The calling thread runs the first range and returns when all of them are done.
+ * Runs `body(0, count)` inline when `numThreads <= 1`. The threads are created and joined on every call, which
+ * costs some tens of microseconds, so it is only worth it for calls that run well beyond that. The library is
+ * built without exceptions, so `body` must not throw and a thread that cannot be started ends the program.
+ */
+void ParallelFor(int32_t count, int32_t numThreads, const std::function<void(int32_t, int32_t)>& body);
+
 } // namespace tinycv
 
 #endif
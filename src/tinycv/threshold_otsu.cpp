@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/threshold.h"
+#include "tinycv/histogram.h"
+
+#include <float.h>
+#include <algorithm>
+
+namespace tinycv {
+
+// Follows OpenCV's getThreshVal_Otsu_8u step for step, the class means are updated incrementally
+// in double so the picked level is the same on ties and on near empty histograms.
+uint8_t OtsuThreshold(const uint32_t *hist)
+{
+    if (nullptr == hist) {
+        return 0;
+    }
+    uint64_t total = 0;
+    double mu = 0;
+    for (int32_t i = 0; i < 256; ++i) {
+        total += hist[i];
+        mu += i * (double)hist[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+    double scale = 1. / total;
+    mu *= scale;
+
+    double mu1 = 0, q1 = 0;
+    double max_sigma = 0;
+    int32_t max_val = 0;
+    for (int32_t i = 0; i < 256; ++i) {
+        double p_i = hist[i] * scale;
+        mu1 *= q1;
+        q1 += p_i;
+        double q2 = 1. - q1;
+        if (std::min(q1, q2) < FLT_EPSILON || std::max(q1, q2) > 1. - FLT_EPSILON) {
+            continue;
+        }
+        mu1 = (mu1 + i * p_i) / q1;
+        double mu2 = (mu - q1 * mu1) / q2;
+        double sigma = q1 * q2 * (mu1 - mu2) * (mu1 - mu2);
+        if (sigma > max_sigma) {
+            max_sigma = sigma;
+            max_val = i;
+        }
+    }
+    return (uint8_t)max_val;
+}
+
+uint8_t OtsuThreshold(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData)
+{
+    if (nullptr == inData || height <= 0 || width <= 0 || inWidthStride < width) {
+        return 0;
+    }
+    uint32_t hist[256];
+    CalcHist(height, width, inWidthStride, inData, hist);
+    return OtsuThreshold(hist);
+}
+
+} // namespace tinycv
@@ -0,0 +1,292 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/allocator.h"
+#include "tinycv/resize.h"
+#include "tinycv/stream.h"
+#include "tinycv/pyramid.h"
+#include "tinycv/sys.h"
+#include "tinycv/x86/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+// the std containers go through the global operator new, not through the allocator hook
+static std::atomic<int64_t> g_operator_news(0);
+
+// keeps gcc from matching the inlined malloc and free against new and delete
+#if defined(__GNUC__)
+#define HEAP_NOINLINE __attribute__((noinline))
+#else
+#define HEAP_NOINLINE
+#endif
+
+HEAP_NOINLINE void *operator new(size_t size)
+{
+    ++g_operator_news;
+    void *p = malloc(size ? size : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+HEAP_NOINLINE void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+HEAP_NOINLINE void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+HEAP_NOINLINE void operator delete[](void *p) noexcept
+{
+    operator delete(p);
+}
+
+// called by code built for C++14 and later, gtest for instance
+HEAP_NOINLINE void operator delete(void *p, size_t) noexcept
+{
+    operator delete(p);
+}
+
+HEAP_NOINLINE void operator delete[](void *p, size_t) noexcept
+{
+    operator delete(p);
+}
+
+struct CountingAllocator {
+    std::atomic<int32_t> allocs;
+    std::atomic<int32_t> frees;
+
+    CountingAllocator()
+        : allocs(0)
+        , frees(0)
+    {
+    }
+};
+
+static void *counting_alloc(uint64_t size, uint32_t alignment, void *user)
+{
+    ++((CountingAllocator *)user)->allocs;
+    void *p = nullptr;
+    return posix_memalign(&p, alignment, size) == 0 ? p : nullptr;
+}
+
+static void counting_free(void *p, void *user)
+{
+    ++((CountingAllocator *)user)->frees;
+    free(p);
+}
+
+// runs the kernels that need temporaries, each on its own part of `dst`
+static void RunKernels(const uint8_t *src, const float *src_f32, int32_t height, int32_t width, uint8_t *dst, float *dst_f32)
+{
+    const int32_t outHeight = height * 2 / 3, outWidth = width * 3 / 4;
+    const int32_t size = outHeight * outWidth * 3;
+    tinycv::ResizeLinear<uint8_t, 3>(height, width, width * 3, src, outHeight, outWidth, outWidth * 3, dst);
+    tinycv::ResizeNearestPoint<uint8_t, 3>(height, width, width * 3, src, outHeight, outWidth, outWidth * 3, dst + size);
+    tinycv::ResizeCubic<uint8_t, 3>(height, width, width * 3, src, outHeight, outWidth, outWidth * 3, dst + 2 * size);
+    tinycv::ResizeLanczos<uint8_t, 3>(height, width, width * 3, src, outHeight, outWidth, outWidth * 3, dst + 3 * size);
+    tinycv::PyrDown<uint8_t, 3>(height, width, width * 3, src, (width + 1) / 2 * 3, dst + 4 * size);
+    tinycv::ResizeLinear<float, 3>(height, width, width * 3, src_f32, outHeight, outWidth, outWidth * 3, dst_f32);
+    tinycv::ResizeNearestPoint<float, 3>(height, width, width * 3, src_f32, outHeight, outWidth, outWidth * 3, dst_f32 + size);
+}
+
+class AllocatorTest {
+public:
+    AllocatorTest(int32_t height, int32_t width)
+        : height_(height)
+        , width_(width)
+        , dst_size_(height * width * 3 * 5)
+    {
+        src_.reset(new uint8_t[height * width * 3]);
+        src_f32_.reset(new float[height * width * 3]);
+        ref_.reset(new uint8_t[dst_size_]);
+        ref_f32_.reset(new float[dst_size_]);
+        dst_.reset(new uint8_t[dst_size_]);
+        dst_f32_.reset(new float[dst_size_]);
+        tinycv::debug::randomFill<uint8_t>(src_.get(), height * width * 3, 0, 255);
+        tinycv::debug::randomFill<float>(src_f32_.get(), height * width * 3, 0, 255);
+        memset(ref_.get(), 0, dst_size_);
+        memset(ref_f32_.get(), 0, dst_size_ * sizeof(float));
+        RunKernels(src_.get(), src_f32_.get(), height, width, ref_.get(), ref_f32_.get());
+    }
+
+    // one frame, its results have to match the ones computed with the default settings
+    void Frame()
+    {
+        memset(dst_.get(), 0, dst_size_);
+        memset(dst_f32_.get(), 0, dst_size_ * sizeof(float));
+        RunKernels(src_.get(), src_f32_.get(), height_, width_, dst_.get(), dst_f32_.get());
+        EXPECT_EQ(0, memcmp(ref_.get(), dst_.get(), dst_size_));
+        EXPECT_EQ(0, memcmp(ref_f32_.get(), dst_f32_.get(), dst_size_ * sizeof(float)));
+    }
+
+private:
+    int32_t height_, width_, dst_size_;
+    std::unique_ptr<uint8_t[]> src_, ref_, dst_;
+    std::unique_ptr<float[]> src_f32_, ref_f32_, dst_f32_;
+};
+
+TEST(ALLOCATOR_STEADY_STATE, x86)
+{
+    AllocatorTest test(480, 640);
+    CountingAllocator counter;
+    tinycv::Allocator allocator = {counting_alloc, counting_free, &counter};
+    tinycv::SetAllocator(&allocator);
+
+    // the first frame allocates the arena, the next ones do not allocate at all
+    test.Frame();
+    EXPECT_EQ(1, counter.allocs.load());
+    const int64_t operator_news = g_operator_news;
+    for (int32_t frame = 0; frame < 3; ++frame) {
+        test.Frame();
+    }
+    EXPECT_EQ(1, counter.allocs.load());
+    EXPECT_EQ(operator_news, g_operator_news);
+    EXPECT_EQ(0, counter.frees.load());
+
+    tinycv::ReleaseScratchArena();
+    EXPECT_EQ(1, counter.frees.load());
+    tinycv::SetAllocator(nullptr);
+}
+
+TEST(ALLOCATOR_SMALL_ARENA, x86)
+{
+    AllocatorTest test(480, 640);
+    CountingAllocator counter;
+    tinycv::Allocator allocator = {counting_alloc, counting_free, &counter};
+    tinycv::SetAllocator(&allocator);
+    const uint64_t arena_size = tinycv::GetScratchArenaSize();
+
+    // what does not fit goes to the allocator, and is given back
+    tinycv::SetScratchArenaSize(4096);
+    EXPECT_EQ(4096u, tinycv::GetScratchArenaSize());
+    test.Frame();
+    EXPECT_LT(1, counter.allocs.load());
+    EXPECT_EQ(counter.allocs.load() - 1, counter.frees.load());
+
+    tinycv::SetScratchArenaSize(0);
+    test.Frame();
+    EXPECT_EQ(counter.allocs.load(), counter.frees.load());
+
+    tinycv::SetScratchArenaSize(arena_size);
+    tinycv::SetAllocator(nullptr);
+}
+
+TEST(ALLOCATOR_SCRATCH, x86)
+{
+    tinycv::ReleaseScratchArena();
+    uint8_t *a = (uint8_t *)tinycv::ScratchAlloc(100, 128);
+    uint8_t *b = (uint8_t *)tinycv::ScratchAlloc(1000, 64);
+    uint8_t *c = (uint8_t *)tinycv::ScratchAlloc(10, 1);
+    ASSERT_NE(nullptr, a);
+    ASSERT_NE(nullptr, b);
+    ASSERT_NE(nullptr, c);
+    EXPECT_EQ(0u, (uintptr_t)a % 128);
+    EXPECT_EQ(0u, (uintptr_t)b % 64);
+    EXPECT_LE(a + 100, b);
+    EXPECT_LE(b + 1000, c);
+
+    // out of order, the space is reclaimed once the last block is freed
+    tinycv::ScratchFree(b);
+    tinycv::ScratchFree(a);
+    uint8_t *d = (uint8_t *)tinycv::ScratchAlloc(10, 1);
+    EXPECT_LT(c, d);
+    tinycv::ScratchFree(d);
+    tinycv::ScratchFree(c);
+    EXPECT_EQ(a, (uint8_t *)tinycv::ScratchAlloc(100, 128));
+    tinycv::ScratchFree(a);
+
+    // larger than the arena
+    uint8_t *large = (uint8_t *)tinycv::ScratchAlloc(tinycv::GetScratchArenaSize() + 1, 128);
+    ASSERT_NE(nullptr, large);
+    EXPECT_EQ(a, (uint8_t *)tinycv::ScratchAlloc(100, 128));
+    tinycv::ScratchFree(a);
+    tinycv::ScratchFree(large);
+}
+
+TEST(ALLOCATOR_ORIGIN, x86)
+{
+    CountingAllocator first, second;
+    tinycv::Allocator allocator_first = {counting_alloc, counting_free, &first};
+    tinycv::Allocator allocator_second = {counting_alloc, counting_free, &second};
+    tinycv::ReleaseScratchArena();
+    tinycv::SetAllocator(&allocator_first);
+    {
+        tinycv::StreamContext context;
+        ASSERT_NE(nullptr, context.Scratch("rows", 1000));
+        // the arena, then the block that does not fit in it
+        void *large = tinycv::ScratchAlloc(tinycv::GetScratchArenaSize() + 1, 128);
+        ASSERT_NE(nullptr, large);
+        EXPECT_EQ(3, first.allocs.load());
+
+        // whatever the current allocator, blocks go back to the one that made them
+        tinycv::SetAllocator(&allocator_second);
+        tinycv::ScratchFree(large);
+        tinycv::ReleaseScratchArena();
+        EXPECT_EQ(2, first.frees.load());
+    }
+    EXPECT_EQ(3, first.frees.load());
+    EXPECT_EQ(0, second.allocs.load());
+    EXPECT_EQ(0, second.frees.load());
+    tinycv::SetAllocator(nullptr);
+}
+
+TEST(ALLOCATOR_SWITCH_THREADS, x86)
+{
+    CountingAllocator counters[2];
+    tinycv::Allocator allocators[2] = {{counting_alloc, counting_free, &counters[0]}, {counting_alloc, counting_free, &counters[1]}};
+    const uint64_t arena_size = tinycv::GetScratchArenaSize();
+    // a small arena sends most temporaries to the allocator while it is being switched
+    tinycv::SetScratchArenaSize(4096);
+
+    std::atomic<bool> done(false);
+    std::vector<std::thread> workers;
+    for (int32_t t = 0; t < 4; ++t) {
+        workers.emplace_back([&done]() {
+            std::vector<uint8_t> src(240 * 320 * 3, 128), dst(200 * 300 * 3);
+            while (!done) {
+                tinycv::ResizeCubic<uint8_t, 3>(240, 320, 320 * 3, src.data(), 200, 300, 300 * 3, dst.data());
+                tinycv::ResizeLinear<uint8_t, 3>(240, 320, 320 * 3, src.data(), 200, 300, 300 * 3, dst.data());
+            }
+        });
+    }
+    for (int32_t i = 0; i < 200; ++i) {
+        tinycv::SetAllocator(&allocators[i % 2]);
+        std::this_thread::yield();
+    }
+    done = true;
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    tinycv::SetAllocator(nullptr);
+    tinycv::SetScratchArenaSize(arena_size);
+
+    // the workers have exited, their arenas are released too
+    EXPECT_EQ(counters[0].allocs.load(), counters[0].frees.load());
+    EXPECT_EQ(counters[1].allocs.load(), counters[1].frees.load());
+}
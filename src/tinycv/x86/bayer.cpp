@@ -0,0 +1,380 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/cvtcolor.h"
+#include "tinycv/x86/fma/internal_fma.hpp"
+#include "tinycv/x86/intrinutils.hpp"
+#include "tinycv/types.h"
+#include "tinycv/sys.h"
+#include "tinycv/x86/sysinfo.h"
+
+#include <string.h>
+#include <immintrin.h>
+
+namespace tinycv {
+
+// A bayer layout is described by two flags of its first row: whether the
+// top-left sample is green and whether the non-green samples are blue.
+// Every following row flips both flags.
+static inline void bayer2bgr_scalar_u8(
+    const uint8_t *up,
+    const uint8_t *cur,
+    const uint8_t *down,
+    int32_t begin,
+    int32_t end,
+    bool green_even,
+    bool blue_row,
+    bool edge_aware,
+    uint8_t *dst)
+{
+    for (int32_t x = begin; x < end; ++x) {
+        int32_t c, g, o;
+        if (((x & 1) == 0) == green_even) {
+            g = cur[x];
+            c = (cur[x - 1] + cur[x + 1] + 1) >> 1;
+            o = (up[x] + down[x] + 1) >> 1;
+        } else {
+            c = cur[x];
+            g = (cur[x - 1] + cur[x + 1] + up[x] + down[x] + 2) >> 2;
+            if (edge_aware) {
+                int32_t dh = abs(cur[x - 1] - cur[x + 1]);
+                int32_t dv = abs(up[x] - down[x]);
+                if (dh < dv) {
+                    g = (cur[x - 1] + cur[x + 1] + 1) >> 1;
+                } else if (dv < dh) {
+                    g = (up[x] + down[x] + 1) >> 1;
+                }
+            }
+            o = (up[x - 1] + up[x + 1] + down[x - 1] + down[x + 1] + 2) >> 2;
+        }
+        dst[x * 3 + 0] = (uint8_t)(blue_row ? c : o);
+        dst[x * 3 + 1] = (uint8_t)g;
+        dst[x * 3 + 2] = (uint8_t)(blue_row ? o : c);
+    }
+}
+
+static inline __m128i bayer_avg4_u8(__m128i a, __m128i b, __m128i c, __m128i d)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i two = _mm_set1_epi16(2);
+    __m128i lo = _mm_add_epi16(_mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero)),
+                               _mm_add_epi16(_mm_unpacklo_epi8(c, zero), _mm_unpacklo_epi8(d, zero)));
+    __m128i hi = _mm_add_epi16(_mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero)),
+                               _mm_add_epi16(_mm_unpackhi_epi8(c, zero), _mm_unpackhi_epi8(d, zero)));
+    lo = _mm_srli_epi16(_mm_add_epi16(lo, two), 2);
+    hi = _mm_srli_epi16(_mm_add_epi16(hi, two), 2);
+    return _mm_packus_epi16(lo, hi);
+}
+
+// 16 pixels of one output row, `mask_c` selects the lanes that hold the
+// row's own non-green color.
+static inline void bayer2bgr_16px_u8(
+    __m128i u_l,
+    __m128i u_c,
+    __m128i u_r,
+    __m128i c_l,
+    __m128i c_c,
+    __m128i c_r,
+    __m128i d_l,
+    __m128i d_c,
+    __m128i d_r,
+    __m128i mask_c,
+    bool blue_row,
+    bool edge_aware,
+    uint8_t *dst)
+{
+    __m128i h_avg = _mm_avg_epu8(c_l, c_r);
+    __m128i v_avg = _mm_avg_epu8(u_c, d_c);
+    __m128i cross = bayer_avg4_u8(c_l, c_r, u_c, d_c);
+    __m128i diag = bayer_avg4_u8(u_l, u_r, d_l, d_r);
+
+    if (edge_aware) {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i dh = _mm_or_si128(_mm_subs_epu8(c_l, c_r), _mm_subs_epu8(c_r, c_l));
+        __m128i dv = _mm_or_si128(_mm_subs_epu8(u_c, d_c), _mm_subs_epu8(d_c, u_c));
+        // dh < dv <=> dv - dh saturates to a non-zero value
+        __m128i h_less = _mm_cmpeq_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(dv, dh), zero), zero);
+        __m128i v_less = _mm_cmpeq_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(dh, dv), zero), zero);
+        cross = _mm_blendv_epi8(cross, h_avg, h_less);
+        cross = _mm_blendv_epi8(cross, v_avg, v_less);
+    }
+
+    __m128i c = _mm_blendv_epi8(h_avg, c_c, mask_c);
+    __m128i g = _mm_blendv_epi8(c_c, cross, mask_c);
+    __m128i o = _mm_blendv_epi8(v_avg, diag, mask_c);
+    if (blue_row) {
+        v_store_interleave(dst, c, g, o);
+    } else {
+        v_store_interleave(dst, o, g, c);
+    }
+}
+
+// Vector loops start at column 1, so lane i always maps to an odd column when
+// i is even.
+static inline __m128i bayer_color_mask(bool green_even)
+{
+    const __m128i even_lanes = _mm_set1_epi16(0x00ff);
+    return green_even ? even_lanes : _mm_slli_epi16(even_lanes, 8);
+}
+
+static int32_t bayer2bgr_twoline_kernel_u8(
+    const uint8_t *in_0,
+    const uint8_t *in_1,
+    const uint8_t *in_2,
+    const uint8_t *in_3,
+    int32_t width,
+    bool green_even,
+    bool blue_row,
+    bool edge_aware,
+    uint8_t *out_0,
+    uint8_t *out_1)
+{
+    __m128i mask_0 = bayer_color_mask(green_even);
+    __m128i mask_1 = bayer_color_mask(!green_even);
+    int32_t x = 1;
+    for (; x <= width - 17; x += 16) {
+        __m128i r0_l = _mm_loadu_si128((const __m128i *)(in_0 + x - 1));
+        __m128i r0_c = _mm_loadu_si128((const __m128i *)(in_0 + x));
+        __m128i r0_r = _mm_loadu_si128((const __m128i *)(in_0 + x + 1));
+        __m128i r1_l = _mm_loadu_si128((const __m128i *)(in_1 + x - 1));
+        __m128i r1_c = _mm_loadu_si128((const __m128i *)(in_1 + x));
+        __m128i r1_r = _mm_loadu_si128((const __m128i *)(in_1 + x + 1));
+        __m128i r2_l = _mm_loadu_si128((const __m128i *)(in_2 + x - 1));
+        __m128i r2_c = _mm_loadu_si128((const __m128i *)(in_2 + x));
+        __m128i r2_r = _mm_loadu_si128((const __m128i *)(in_2 + x + 1));
+        __m128i r3_l = _mm_loadu_si128((const __m128i *)(in_3 + x - 1));
+        __m128i r3_c = _mm_loadu_si128((const __m128i *)(in_3 + x));
+        __m128i r3_r = _mm_loadu_si128((const __m128i *)(in_3 + x + 1));
+
+        bayer2bgr_16px_u8(r0_l, r0_c, r0_r, r1_l, r1_c, r1_r, r2_l, r2_c, r2_r, mask_0, blue_row, edge_aware, out_0 + x * 3);
+        bayer2bgr_16px_u8(r1_l, r1_c, r1_r, r2_l, r2_c, r2_r, r3_l, r3_c, r3_r, mask_1, !blue_row, edge_aware, out_1 + x * 3);
+    }
+    return x;
+}
+
+static int32_t bayer2bgr_oneline_kernel_u8(
+    const uint8_t *in_0,
+    const uint8_t *in_1,
+    const uint8_t *in_2,
+    int32_t width,
+    bool green_even,
+    bool blue_row,
+    bool edge_aware,
+    uint8_t *out)
+{
+    __m128i mask = bayer_color_mask(green_even);
+    int32_t x = 1;
+    for (; x <= width - 17; x += 16) {
+        bayer2bgr_16px_u8(
+            _mm_loadu_si128((const __m128i *)(in_0 + x - 1)),
+            _mm_loadu_si128((const __m128i *)(in_0 + x)),
+            _mm_loadu_si128((const __m128i *)(in_0 + x + 1)),
+            _mm_loadu_si128((const __m128i *)(in_1 + x - 1)),
+            _mm_loadu_si128((const __m128i *)(in_1 + x)),
+            _mm_loadu_si128((const __m128i *)(in_1 + x + 1)),
+            _mm_loadu_si128((const __m128i *)(in_2 + x - 1)),
+            _mm_loadu_si128((const __m128i *)(in_2 + x)),
+            _mm_loadu_si128((const __m128i *)(in_2 + x + 1)),
+            mask,
+            blue_row,
+            edge_aware,
+            out + x * 3);
+    }
+    return x;
+}
+
+static inline void bayer_fill_row_ends(int32_t width, uint8_t *dst)
+{
+    memcpy(dst, dst + 3, 3);
+    memcpy(dst + (width - 1) * 3, dst + (width - 2) * 3, 3);
+}
+
+// Interior pixels follow the usual bilinear rules; the outermost rows and
+// columns are copied from their inner neighbours, which matches OpenCV.
+static void bayer2bgr_u8(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    bool start_with_green,
+    bool blue_row0,
+    bool edge_aware)
+{
+    bool use_fma = CpuSupports(ISA_X86_FMA);
+    int32_t y = 1;
+    for (; y <= height - 3; y += 2) {
+        const uint8_t *in_0 = inData + (y - 1) * inWidthStride;
+        const uint8_t *in_1 = in_0 + inWidthStride;
+        const uint8_t *in_2 = in_1 + inWidthStride;
+        const uint8_t *in_3 = in_2 + inWidthStride;
+        uint8_t *out_0 = outData + y * outWidthStride;
+        uint8_t *out_1 = out_0 + outWidthStride;
+        // row y is odd, so its flags are the flipped flags of row 0
+        bool green_even = !start_with_green;
+        bool blue_row = !blue_row0;
+
+        int32_t x = use_fma ? fma::bayer2bgr_twoline_kernel_u8_fma(in_0, in_1, in_2, in_3, width, green_even, blue_row, edge_aware, out_0, out_1)
+                            : bayer2bgr_twoline_kernel_u8(in_0, in_1, in_2, in_3, width, green_even, blue_row, edge_aware, out_0, out_1);
+        bayer2bgr_scalar_u8(in_0, in_1, in_2, x, width - 1, green_even, blue_row, edge_aware, out_0);
+        bayer2bgr_scalar_u8(in_1, in_2, in_3, x, width - 1, !green_even, !blue_row, edge_aware, out_1);
+        bayer_fill_row_ends(width, out_0);
+        bayer_fill_row_ends(width, out_1);
+    }
+    for (; y <= height - 2; ++y) {
+        const uint8_t *in_0 = inData + (y - 1) * inWidthStride;
+        const uint8_t *in_1 = in_0 + inWidthStride;
+        const uint8_t *in_2 = in_1 + inWidthStride;
+        uint8_t *out = outData + y * outWidthStride;
+        bool green_even = start_with_green == ((y & 1) == 0);
+        bool blue_row = blue_row0 == ((y & 1) == 0);
+
+        int32_t x = bayer2bgr_oneline_kernel_u8(in_0, in_1, in_2, width, green_even, blue_row, edge_aware, out);
+        bayer2bgr_scalar_u8(in_0, in_1, in_2, x, width - 1, green_even, blue_row, edge_aware, out);
+        bayer_fill_row_ends(width, out);
+    }
+
+    memcpy(outData, outData + outWidthStride, width * 3);
+    memcpy(outData + (height - 1) * outWidthStride, outData + (height - 2) * outWidthStride, width * 3);
+}
+
+static void bayer2bgr_half_u8(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    bool start_with_green,
+    bool blue_row0)
+{
+    bool use_fma = CpuSupports(ISA_X86_FMA);
+    int32_t out_height = height / 2;
+    int32_t out_width = width / 2;
+    const __m128i mask_lo = _mm_set1_epi16(0x00ff);
+    for (int32_t i = 0; i < out_height; ++i) {
+        const uint8_t *in_0 = inData + 2 * i * inWidthStride;
+        const uint8_t *in_1 = in_0 + inWidthStride;
+        uint8_t *out = outData + i * outWidthStride;
+
+        int32_t j = 0;
+        if (use_fma) {
+            j = fma::bayer2bgr_half_oneline_kernel_u8_fma(in_0, in_1, out_width, start_with_green, blue_row0, out);
+        }
+        for (; j <= out_width - 16; j += 16) {
+            __m128i v0_0 = _mm_loadu_si128((const __m128i *)(in_0 + j * 2));
+            __m128i v0_1 = _mm_loadu_si128((const __m128i *)(in_0 + j * 2 + 16));
+            __m128i v1_0 = _mm_loadu_si128((const __m128i *)(in_1 + j * 2));
+            __m128i v1_1 = _mm_loadu_si128((const __m128i *)(in_1 + j * 2 + 16));
+            __m128i p00 = _mm_packus_epi16(_mm_and_si128(v0_0, mask_lo), _mm_and_si128(v0_1, mask_lo));
+            __m128i p01 = _mm_packus_epi16(_mm_srli_epi16(v0_0, 8), _mm_srli_epi16(v0_1, 8));
+            __m128i p10 = _mm_packus_epi16(_mm_and_si128(v1_0, mask_lo), _mm_and_si128(v1_1, mask_lo));
+            __m128i p11 = _mm_packus_epi16(_mm_srli_epi16(v1_0, 8), _mm_srli_epi16(v1_1, 8));
+
+            __m128i c0, c1, g;
+            if (start_with_green) {
+                g = _mm_avg_epu8(p00, p11);
+                c0 = p01;
+                c1 = p10;
+            } else {
+                g = _mm_avg_epu8(p01, p10);
+                c0 = p00;
+                c1 = p11;
+            }
+            if (blue_row0) {
+                v_store_interleave(out + j * 3, c0, g, c1);
+            } else {
+                v_store_interleave(out + j * 3, c1, g, c0);
+            }
+        }
+        for (; j < out_width; ++j) {
+            int32_t p00 = in_0[j * 2], p01 = in_0[j * 2 + 1];
+            int32_t p10 = in_1[j * 2], p11 = in_1[j * 2 + 1];
+            int32_t g = start_with_green ? (p00 + p11 + 1) >> 1 : (p01 + p10 + 1) >> 1;
+            int32_t c0 = start_with_green ? p01 : p00;
+            int32_t c1 = start_with_green ? p10 : p11;
+            out[j * 3 + 0] = (uint8_t)(blue_row0 ? c0 : c1);
+            out[j * 3 + 1] = (uint8_t)g;
+            out[j * 3 + 2] = (uint8_t)(blue_row0 ? c1 : c0);
+        }
+    }
+}
+
+#define BAYER2BGR_IMPL(pattern, start_with_green, blue_row0)                                                                  \
+    template <>                                                                                                               \
+    void Bayer##pattern##2BGR<uint8_t>(                                                                                       \
+        int32_t height,                                                                                                       \
+        int32_t width,                                                                                                        \
+        int32_t inWidthStride,                                                                                                \
+        const uint8_t *inData,                                                                                                \
+        int32_t outWidthStride,                                                                                               \
+        uint8_t *outData)                                                                                                     \
+    {                                                                                                                         \
+        if (nullptr == inData || nullptr == outData) {                                                                        \
+            return;                                                                                                           \
+        }                                                                                                                     \
+        if (width < 3 || height < 3 || inWidthStride < width || outWidthStride < width * 3) {                                 \
+            return;                                                                                                           \
+        }                                                                                                                     \
+        bayer2bgr_u8(height, width, inWidthStride, inData, outWidthStride, outData, start_with_green, blue_row0, false);      \
+    }                                                                                                                         \
+    template <>                                                                                                               \
+    void Bayer##pattern##2BGR_EA<uint8_t>(                                                                                    \
+        int32_t height,                                                                                                       \
+        int32_t width,                                                                                                        \
+        int32_t inWidthStride,                                                                                                \
+        const uint8_t *inData,                                                                                                \
+        int32_t outWidthStride,                                                                                               \
+        uint8_t *outData)                                                                                                     \
+    {                                                                                                                         \
+        if (nullptr == inData || nullptr == outData) {                                                                        \
+            return;                                                                                                           \
+        }                                                                                                                     \
+        if (width < 3 || height < 3 || inWidthStride < width || outWidthStride < width * 3) {                                 \
+            return;                                                                                                           \
+        }                                                                                                                     \
+        bayer2bgr_u8(height, width, inWidthStride, inData, outWidthStride, outData, start_with_green, blue_row0, true);       \
+    }                                                                                                                         \
+    template <>                                                                                                               \
+    void Bayer##pattern##2BGRHalf<uint8_t>(                                                                                   \
+        int32_t height,                                                                                                       \
+        int32_t width,                                                                                                        \
+        int32_t inWidthStride,                                                                                                \
+        const uint8_t *inData,                                                                                                \
+        int32_t outWidthStride,                                                                                               \
+        uint8_t *outData)                                                                                                     \
+    {                                                                                                                         \
+        if (nullptr == inData || nullptr == outData) {                                                                        \
+            return;                                                                                                           \
+        }                                                                                                                     \
+        if (width < 2 || height < 2 || inWidthStride < width || outWidthStride < (width / 2) * 3) {                           \
+            return;                                                                                                           \
+        }                                                                                                                     \
+        bayer2bgr_half_u8(height, width, inWidthStride, inData, outWidthStride, outData, start_with_green, blue_row0);        \
+    }
+
+// OpenCV names a pattern after the second row, second and third columns:
+// BayerBG is RGGB, BayerGB is GRBG, BayerRG is BGGR and BayerGR is GBRG.
+BAYER2BGR_IMPL(BG, false, false)
+BAYER2BGR_IMPL(GB, true, false)
+BAYER2BGR_IMPL(RG, false, true)
+BAYER2BGR_IMPL(GR, true, true)
+
+#undef BAYER2BGR_IMPL
+
+} // namespace tinycv
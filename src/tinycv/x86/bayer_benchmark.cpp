@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/cvtcolor.h"
+#include "tinycv/debug.h"
+
+#include <opencv2/imgproc.hpp>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace {
+
+enum BayerMode { BAYERBG_MODE,
+                 BAYERGB_MODE,
+                 BAYERRG_MODE,
+                 BAYERGR_MODE };
+
+enum DemosaicMode { DEMOSAIC_BILINEAR,
+                    DEMOSAIC_EA,
+                    DEMOSAIC_HALF };
+
+template <BayerMode mode, DemosaicMode demosaic>
+void BM_Bayer2BGR_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height * 3]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    int32_t out_stride = demosaic == DEMOSAIC_HALF ? (width / 2) * 3 : width * 3;
+    for (auto _ : state) {
+        if (demosaic == DEMOSAIC_BILINEAR) {
+            if (mode == BAYERBG_MODE) {
+                tinycv::BayerBG2BGR<uint8_t>(height, width, width, src.get(), out_stride, dst.get());
+            } else if (mode == BAYERGB_MODE) {
+                tinycv::BayerGB2BGR<uint8_t>(height, width, width, src.get(), out_stride, dst.get());
+            } else if (mode == BAYERRG_MODE) {
+                tinycv::BayerRG2BGR<uint8_t>(height, width, width, src.get(), out_stride, dst.get());
+            } else if (mode == BAYERGR_MODE) {
+                tinycv::BayerGR2BGR<uint8_t>(height, width, width, src.get(), out_stride, dst.get());
+            }
+        } else if (demosaic == DEMOSAIC_EA) {
+            if (mode == BAYERBG_MODE) {
+                tinycv::BayerBG2BGR_EA<uint8_t>(height, width, width, src.get(), out_stride, dst.get());
+            } else if (mode == BAYERGB_MODE) {
+                tinycv::BayerGB2BGR_EA<uint8_t>(height, width, width, src.get(), out_stride, dst.get());
+            } else if (mode == BAYERRG_MODE) {
+                tinycv::BayerRG2BGR_EA<uint8_t>(height, width, width, src.get(), out_stride, dst.get());
+            } else if (mode == BAYERGR_MODE) {
+                tinycv::BayerGR2BGR_EA<uint8_t>(height, width, width, src.get(), out_stride, dst.get());
+            }
+        } else {
+            if (mode == BAYERBG_MODE) {
+                tinycv::BayerBG2BGRHalf<uint8_t>(height, width, width, src.get(), out_stride, dst.get());
+            } else if (mode == BAYERGB_MODE) {
+                tinycv::BayerGB2BGRHalf<uint8_t>(height, width, width, src.get(), out_stride, dst.get());
+            } else if (mode == BAYERRG_MODE) {
+                tinycv::BayerRG2BGRHalf<uint8_t>(height, width, width, src.get(), out_stride, dst.get());
+            } else if (mode == BAYERGR_MODE) {
+                tinycv::BayerGR2BGRHalf<uint8_t>(height, width, width, src.get(), out_stride, dst.get());
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace tinycv::debug;
+
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_tinycv_x86, BAYERBG_MODE, DEMOSAIC_BILINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_tinycv_x86, BAYERGB_MODE, DEMOSAIC_BILINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_tinycv_x86, BAYERRG_MODE, DEMOSAIC_BILINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_tinycv_x86, BAYERGR_MODE, DEMOSAIC_BILINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_tinycv_x86, BAYERBG_MODE, DEMOSAIC_EA)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_tinycv_x86, BAYERGB_MODE, DEMOSAIC_EA)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_tinycv_x86, BAYERRG_MODE, DEMOSAIC_EA)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_tinycv_x86, BAYERGR_MODE, DEMOSAIC_EA)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_tinycv_x86, BAYERBG_MODE, DEMOSAIC_HALF)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_tinycv_x86, BAYERGB_MODE, DEMOSAIC_HALF)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_tinycv_x86, BAYERRG_MODE, DEMOSAIC_HALF)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_tinycv_x86, BAYERGR_MODE, DEMOSAIC_HALF)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+#ifdef TINYCV_BENCHMARK_OPENCV
+
+template <BayerMode mode, DemosaicMode demosaic>
+void BM_Bayer2BGR_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height * 3]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(cv::DataType<uint8_t>::depth, 1), src.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(cv::DataType<uint8_t>::depth, 3), dst.get());
+    const int32_t codes[2][4] = {{cv::COLOR_BayerBG2BGR, cv::COLOR_BayerGB2BGR, cv::COLOR_BayerRG2BGR, cv::COLOR_BayerGR2BGR},
+                                 {cv::COLOR_BayerBG2BGR_EA, cv::COLOR_BayerGB2BGR_EA, cv::COLOR_BayerRG2BGR_EA, cv::COLOR_BayerGR2BGR_EA}};
+    for (auto _ : state) {
+        cv::cvtColor(srcMat, dstMat, codes[demosaic][mode]);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_opencv_x86, BAYERBG_MODE, DEMOSAIC_BILINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_opencv_x86, BAYERGB_MODE, DEMOSAIC_BILINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_opencv_x86, BAYERRG_MODE, DEMOSAIC_BILINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_opencv_x86, BAYERGR_MODE, DEMOSAIC_BILINEAR)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_opencv_x86, BAYERBG_MODE, DEMOSAIC_EA)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_opencv_x86, BAYERGB_MODE, DEMOSAIC_EA)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_opencv_x86, BAYERRG_MODE, DEMOSAIC_EA)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Bayer2BGR_opencv_x86, BAYERGR_MODE, DEMOSAIC_EA)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+
+#endif //! TINYCV_BENCHMARK_OPENCV
+} // namespace
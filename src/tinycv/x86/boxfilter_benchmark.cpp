@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/boxfilter.h"
+#include "tinycv/debug.h"
+
+#include <opencv2/imgproc.hpp>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace {
+
+template <typename T, int32_t nc, int32_t ksize>
+void BM_Blur_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::Blur<T, nc>(height, width, width * nc, src.get(), width * nc, dst.get(), ksize, ksize);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_Blur_tinycv_x86, uint8_t, 1, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Blur_tinycv_x86, uint8_t, 1, 15)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Blur_tinycv_x86, uint8_t, 1, 31)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Blur_tinycv_x86, uint8_t, 3, 5)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Blur_tinycv_x86, float, 1, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Blur_tinycv_x86, float, 1, 31)->Args({640, 480})->Args({1920, 1080});
+
+#ifdef TINYCV_BENCHMARK_OPENCV
+template <typename T, int32_t nc, int32_t ksize>
+static void BM_Blur_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat oMat;
+    for (auto _ : state) {
+        cv::blur(iMat, oMat, cv::Size(ksize, ksize));
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_Blur_opencv_x86, uint8_t, 1, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Blur_opencv_x86, uint8_t, 1, 15)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Blur_opencv_x86, uint8_t, 1, 31)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Blur_opencv_x86, uint8_t, 3, 5)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Blur_opencv_x86, float, 1, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Blur_opencv_x86, float, 1, 31)->Args({640, 480})->Args({1920, 1080});
+
+#endif //! TINYCV_BENCHMARK_OPENCV
+} // namespace
@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/boxfilter.h"
+#include "tinycv/x86/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <memory>
+
+template <typename T, int32_t nc>
+void BoxFilterTest(int32_t height, int32_t width, int32_t kernelWidth, int32_t kernelHeight, bool normalize, tinycv::BorderType border_type, float diff)
+{
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst_opencv(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+
+    tinycv::BoxFilter<T, nc>(height, width, width * nc, src.get(), width * nc, dst.get(), kernelWidth, kernelHeight, normalize, border_type);
+
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat oMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_opencv.get());
+    cv::boxFilter(iMat, oMat, -1, cv::Size(kernelWidth, kernelHeight), cv::Point(-1, -1), normalize, (int)border_type);
+
+    checkResult<T, nc>(dst.get(), dst_opencv.get(), height, width, width * nc, width * nc, diff);
+}
+
+template <typename T>
+void BoxFilterTestAll(float diff)
+{
+    const tinycv::BorderType borders[] = {tinycv::BORDER_CONSTANT, tinycv::BORDER_REPLICATE, tinycv::BORDER_REFLECT, tinycv::BORDER_REFLECT_101};
+    for (tinycv::BorderType border_type : borders) {
+        BoxFilterTest<T, 1>(480, 640, 3, 3, true, border_type, diff);
+        BoxFilterTest<T, 1>(480, 640, 31, 31, true, border_type, diff);
+        BoxFilterTest<T, 3>(101, 99, 5, 9, true, border_type, diff);
+        BoxFilterTest<T, 4>(101, 99, 4, 1, true, border_type, diff);
+        BoxFilterTest<T, 3>(7, 5, 15, 11, true, border_type, diff);
+        BoxFilterTest<T, 1>(101, 99, 3, 3, false, border_type, diff);
+        BoxFilterTest<T, 4>(101, 99, 2, 2, false, border_type, diff);
+    }
+}
+
+TEST(BOXFILTER_UINT8, x86)
+{
+    BoxFilterTestAll<uint8_t>(1.01f);
+}
+
+TEST(BOXFILTER_FP32, x86)
+{
+    BoxFilterTestAll<float>(0.01f);
+}
+
+TEST(BLUR_UINT8, x86)
+{
+    const int32_t height = 120, width = 160;
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * 3]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height * 3]);
+    std::unique_ptr<uint8_t[]> dst_opencv(new uint8_t[width * height * 3]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height * 3, 0, 255);
+
+    tinycv::Blur<uint8_t, 3>(height, width, width * 3, src.get(), width * 3, dst.get(), 7, 5);
+
+    cv::Mat iMat(height, width, CV_8UC3, src.get());
+    cv::Mat oMat(height, width, CV_8UC3, dst_opencv.get());
+    cv::blur(iMat, oMat, cv::Size(7, 5));
+
+    checkResult<uint8_t, 3>(dst.get(), dst_opencv.get(), height, width, width * 3, width * 3, 1.01f);
+}
@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/canny.h"
+#include "tinycv/x86/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <memory>
+
+void CannyTest(int32_t height, int32_t width, double threshold1, double threshold2, int32_t apertureSize, bool L2gradient, int32_t numThreads)
+{
+    std::unique_ptr<uint8_t[]> noise(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst_opencv(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(noise.get(), width * height, 0, 255);
+
+    //! smoothed noise has long connected edges as well as weak ones for the hysteresis
+    cv::Mat nMat(height, width, CV_8UC1, noise.get());
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::GaussianBlur(nMat, iMat, cv::Size(7, 7), 2.0);
+
+    tinycv::Canny(height, width, width, src.get(), width, dst.get(), threshold1, threshold2, apertureSize, L2gradient, numThreads);
+
+    cv::Mat oMat(height, width, CV_8UC1, dst_opencv.get());
+    cv::Canny(iMat, oMat, threshold1, threshold2, apertureSize, L2gradient);
+
+    checkResult<uint8_t, 1>(dst.get(), dst_opencv.get(), height, width, width, width, 0.01f);
+}
+
+TEST(CANNY_L1, x86)
+{
+    CannyTest(480, 640, 20, 60, 3, false, 1);
+    CannyTest(101, 99, 60, 20, 3, false, 1);
+    CannyTest(101, 99, 100, 300, 5, false, 1);
+    CannyTest(101, 99, 1000, 3000, 7, false, 1);
+    CannyTest(480, 640, 1000, 3000, 7, false, 1);
+    CannyTest(1, 7, 20, 60, 3, false, 1);
+}
+
+TEST(CANNY_L2, x86)
+{
+    CannyTest(480, 640, 15, 45, 3, true, 1);
+    CannyTest(101, 99, 45, 15, 3, true, 1);
+    CannyTest(101, 99, 80, 240, 5, true, 1);
+    CannyTest(101, 99, 45, 135, -1, true, 1);
+    CannyTest(480, 640, 300, 900, 7, true, 1);
+}
+
+TEST(CANNY_THREADS, x86)
+{
+    CannyTest(1080, 1920, 20, 60, 3, false, 4);
+    CannyTest(721, 1279, 15, 45, 3, true, 3);
+    CannyTest(721, 1279, 100, 300, 5, false, 7);
+}
@@ -16,6 +16,8 @@
 // under the License.
 
 #include "tinycv/cvtcolor.h"
+#include "tinycv/threshold.h"
+#include "tinycv/x86/threshold.hpp"
 #include "tinycv/x86/avx/internal_avx.hpp"
 #include "tinycv/x86/fma/internal_fma.hpp"
 #include "tinycv/x86/intrinutils.hpp"
@@ -59,6 +61,18 @@ struct ColorChannel<uint8_t> {
         return 128;
     }
 };
+template <>
+struct ColorChannel<half_t> {
+    typedef float worktype_f;
+    static half_t max()
+    {
+        return half_t(1.f);
+    }
+    static half_t half()
+    {
+        return half_t(0.5f);
+    }
+};
 template <typename _Tp>
 struct Gray2RGB {
     typedef _Tp channel_type;
@@ -162,13 +176,88 @@ struct RGB2Gray<uint8_t> {
     int32_t tab[256 * 3];
     int32_t yuv_shift;
 };
+template <>
+struct RGB2Gray<half_t> {
+    typedef half_t channel_type;
+
+    RGB2Gray(int32_t _srccn, int32_t blueIdx, const float *_coeffs)
+        : srccn(_srccn)
+    {
+        static const float coeffs0[] = {0.299f, 0.587f, 0.114f};
+        memcpy(coeffs, _coeffs ? _coeffs : coeffs0, 3 * sizeof(coeffs[0]));
+        if (blueIdx == 0)
+            std::swap(coeffs[0], coeffs[2]);
+    }
+    void operator()(const half_t *src, half_t *dst, int32_t n) const
+    {
+        int32_t scn = srccn;
+        float cb = coeffs[0], cg = coeffs[1], cr = coeffs[2];
+        for (int32_t i = 0; i < n; i++, src += scn)
+            dst[i] = half_t(float(src[0]) * cb + float(src[1]) * cg + float(src[2]) * cr);
+    }
+    int32_t srccn;
+    float coeffs[3];
+};
+// Writes the gray values as they are.
+struct Bgr2GrayStore {
+    inline void operator()(uint8_t *dst, __m128i gray) const
+    {
+        _mm_storeu_si128((__m128i *)dst, gray);
+    }
+    inline void operator()(uint8_t *dst, uint8_t gray) const
+    {
+        *dst = gray;
+    }
+};
+
+// Thresholds the gray values before they are written.
+template <int32_t type>
+struct Bgr2GrayThresholdStore {
+    Bgr2GrayThresholdStore(uint8_t thresh, uint8_t maxval)
+        : op(thresh, maxval) {}
+    inline void operator()(uint8_t *dst, __m128i gray) const
+    {
+        _mm_storeu_si128((__m128i *)dst, op(gray));
+    }
+    inline void operator()(uint8_t *dst, uint8_t gray) const
+    {
+        *dst = op(gray);
+    }
+    ThresholdOpU8<type> op;
+};
+
+// Counts the gray values into a histogram, nothing is written to the destination.
+struct Bgr2GrayHistStore {
+    explicit Bgr2GrayHistStore(uint32_t *h)
+        : hist(h) {}
+    inline void operator()(uint8_t *, __m128i gray) const
+    {
+        uint64_t lo = (uint64_t)_mm_cvtsi128_si64(gray);
+        uint64_t hi = (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(gray, gray));
+        for (int32_t k = 0; k < 64; k += 8) {
+            ++hist[(lo >> k) & 0xff];
+            ++hist[(hi >> k) & 0xff];
+        }
+    }
+    inline void operator()(uint8_t *, uint8_t gray) const
+    {
+        ++hist[gray];
+    }
+    uint32_t *hist;
+};
+
+// Converts 16 pixels per iteration and hands every gray vector to `store`, so the same loop either
+// writes the gray image or consumes the gray values in registers.
+template <typename Store>
 void bgr2gray_operator(
     const uint8_t *src,
     uint8_t *dst,
     int32_t width,
     int32_t height,
     int32_t stride,
-    bool flag)
+    int32_t dst_stride,
+    bool flag,
+    const Store &store)
 {
     const int32_t shift = 15;
     const int32_t halfshift = 1 << (shift - 1);
@@ -187,9 +276,9 @@ void bgr2gray_operator(
     int32_t vsize = 16;
     for (int32_t h = 0; h < height; h++) {
         const uint8_t *src_ptr = src + h * stride;
-        uint8_t *dst_ptr = dst + h * width;
+        uint8_t *dst_ptr = dst + h * dst_stride;
         int32_t w = 0;
-        for (; w < width; w += vsize, src_ptr += vsize * 3) {
+        for (; w <= width - vsize; w += vsize, src_ptr += vsize * 3) {
             __m128i data1 = _mm_loadu_si128((__m128i *)(src_ptr + 0));
             __m128i data2 = _mm_loadu_si128((__m128i *)(src_ptr + 16));
             __m128i data3 = _mm_loadu_si128((__m128i *)(src_ptr + 32));
@@ -215,11 +304,11 @@ void bgr2gray_operator(
             __m128i graylh = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(v_gblh, coeff_bg), _mm_madd_epi16(v_rclh, coeff_rc)), shift);
             __m128i grayhl = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(v_bghl, coeff_bg), _mm_madd_epi16(v_rchl, coeff_rc)), shift);
             __m128i grayhh = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(v_bghh, coeff_bg), _mm_madd_epi16(v_rchh, coeff_rc)), shift);
-            _mm_storeu_si128((__m128i *)(dst_ptr + w), _mm_packus_epi16(_mm_packus_epi32(grayll, graylh), _mm_packus_epi32(grayhl, grayhh)));
+            store(dst_ptr + w, _mm_packus_epi16(_mm_packus_epi32(grayll, graylh), _mm_packus_epi32(grayhl, grayhh)));
         }
         for (; w < width; w++, src_ptr += 3) {
             int32_t blue = src_ptr[0], green = src_ptr[1], red = src_ptr[2];
-            dst_ptr[w] = (coeff_b * blue + coeff_g * green + coeff_r * red + halfshift) >> shift;
+            store(dst_ptr + w, (uint8_t)((coeff_b * blue + coeff_g * green + coeff_r * red + halfshift) >> shift));
         }
     }
 }
@@ -275,7 +364,7 @@ void BGR2GRAY<uint8_t>(
     if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
         return;
     }
-    return bgr2gray_operator(inData, outData, width, height, inWidthStride, true);
+    return bgr2gray_operator(inData, outData, width, height, inWidthStride, outWidthStride, true, Bgr2GrayStore());
 }
 
 template <>
@@ -386,15 +475,7 @@ void RGB2GRAY<uint8_t>(
     if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
         return;
     }
-    return bgr2gray_operator(inData, outData, width, height, inWidthStride, false);
-    const uint8_t *src = inData;
-    uint8_t *dst = outData;
-    RGB2Gray<uint8_t> s = RGB2Gray<uint8_t>(3, 2, NULL);
-    for (int32_t i = 0; i < height; i++) {
-        s.operator()(src, dst, width);
-        src += inWidthStride;
-        dst += outWidthStride;
-    }
+    return bgr2gray_operator(inData, outData, width, height, inWidthStride, outWidthStride, false, Bgr2GrayStore());
 }
 
 template <>
@@ -675,4 +756,317 @@ void GRAY2RGBA<uint8_t>(
     }
 }
 
+template <>
+void BGR2GRAY<half_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return;
+    }
+    if (CpuSupports(ISA_X86_FMA) && CpuSupports(ISA_X86_F16C)) {
+        return fma::BGR2GRAY(height, width, inWidthStride, inData, outWidthStride, outData, 3, false);
+    }
+    const half_t *src = inData;
+    half_t *dst = outData;
+    RGB2Gray<half_t> s = RGB2Gray<half_t>(3, 0, NULL);
+    for (int32_t i = 0; i < height; ++i) {
+        s.operator()(src, dst, width);
+        src += inWidthStride;
+        dst += outWidthStride;
+    }
+}
+
+template <>
+void BGRA2GRAY<half_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return;
+    }
+    if (CpuSupports(ISA_X86_FMA) && CpuSupports(ISA_X86_F16C)) {
+        return fma::BGR2GRAY(height, width, inWidthStride, inData, outWidthStride, outData, 4, false);
+    }
+    const half_t *src = inData;
+    half_t *dst = outData;
+    RGB2Gray<half_t> s = RGB2Gray<half_t>(4, 0, NULL);
+    for (int32_t i = 0; i < height; ++i) {
+        s.operator()(src, dst, width);
+        src += inWidthStride;
+        dst += outWidthStride;
+    }
+}
+
+template <>
+void RGB2GRAY<half_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return;
+    }
+    if (CpuSupports(ISA_X86_FMA) && CpuSupports(ISA_X86_F16C)) {
+        return fma::BGR2GRAY(height, width, inWidthStride, inData, outWidthStride, outData, 3, true);
+    }
+    const half_t *src = inData;
+    half_t *dst = outData;
+    RGB2Gray<half_t> s = RGB2Gray<half_t>(3, 2, NULL);
+    for (int32_t i = 0; i < height; ++i) {
+        s.operator()(src, dst, width);
+        src += inWidthStride;
+        dst += outWidthStride;
+    }
+}
+
+template <>
+void RGBA2GRAY<half_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return;
+    }
+    if (CpuSupports(ISA_X86_FMA) && CpuSupports(ISA_X86_F16C)) {
+        return fma::BGR2GRAY(height, width, inWidthStride, inData, outWidthStride, outData, 4, true);
+    }
+    const half_t *src = inData;
+    half_t *dst = outData;
+    RGB2Gray<half_t> s = RGB2Gray<half_t>(4, 2, NULL);
+    for (int32_t i = 0; i < height; ++i) {
+        s.operator()(src, dst, width);
+        src += inWidthStride;
+        dst += outWidthStride;
+    }
+}
+
+template <>
+void GRAY2BGR<half_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return;
+    }
+    const half_t *src = inData;
+    half_t *dst = outData;
+    Gray2RGB<half_t> s = Gray2RGB<half_t>(3);
+    for (int32_t i = 0; i < height; i++) {
+        s.operator()(src, dst, width);
+        src += inWidthStride;
+        dst += outWidthStride;
+    }
+}
+
+template <>
+void GRAY2BGRA<half_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return;
+    }
+    const half_t *src = inData;
+    half_t *dst = outData;
+    Gray2RGB<half_t> s = Gray2RGB<half_t>(4);
+    for (int32_t i = 0; i < height; i++) {
+        s.operator()(src, dst, width);
+        src += inWidthStride;
+        dst += outWidthStride;
+    }
+}
+
+template <>
+void GRAY2RGB<half_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return;
+    }
+    const half_t *src = inData;
+    half_t *dst = outData;
+    Gray2RGB<half_t> s = Gray2RGB<half_t>(3);
+    for (int32_t i = 0; i < height; i++) {
+        s.operator()(src, dst, width);
+        src += inWidthStride;
+        dst += outWidthStride;
+    }
+}
+
+template <>
+void GRAY2RGBA<half_t>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return;
+    }
+    const half_t *src = inData;
+    half_t *dst = outData;
+    Gray2RGB<half_t> s = Gray2RGB<half_t>(4);
+    for (int32_t i = 0; i < height; i++) {
+        s.operator()(src, dst, width);
+        src += inWidthStride;
+        dst += outWidthStride;
+    }
+}
+
+static uint8_t bgr2gray_threshold(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    uint8_t thresh,
+    uint8_t maxval,
+    int32_t type,
+    bool flag)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return thresh;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * 3 || outWidthStride < width) {
+        return thresh;
+    }
+    int32_t mode = type & ~THRESH_OTSU;
+    if (mode < THRESH_BINARY || mode > THRESH_TOZERO_INV) {
+        return thresh;
+    }
+    if (type & THRESH_OTSU) {
+        uint32_t hist[256] = {0};
+        bgr2gray_operator(inData, outData, width, height, inWidthStride, outWidthStride, flag, Bgr2GrayHistStore(hist));
+        thresh = OtsuThreshold(hist);
+    }
+    switch (mode) {
+        case THRESH_BINARY:
+            bgr2gray_operator(inData, outData, width, height, inWidthStride, outWidthStride, flag, Bgr2GrayThresholdStore<THRESH_BINARY>(thresh, maxval));
+            break;
+        case THRESH_BINARY_INV:
+            bgr2gray_operator(inData, outData, width, height, inWidthStride, outWidthStride, flag, Bgr2GrayThresholdStore<THRESH_BINARY_INV>(thresh, maxval));
+            break;
+        case THRESH_TRUNC:
+            bgr2gray_operator(inData, outData, width, height, inWidthStride, outWidthStride, flag, Bgr2GrayThresholdStore<THRESH_TRUNC>(thresh, maxval));
+            break;
+        case THRESH_TOZERO:
+            bgr2gray_operator(inData, outData, width, height, inWidthStride, outWidthStride, flag, Bgr2GrayThresholdStore<THRESH_TOZERO>(thresh, maxval));
+            break;
+        case THRESH_TOZERO_INV:
+            bgr2gray_operator(inData, outData, width, height, inWidthStride, outWidthStride, flag, Bgr2GrayThresholdStore<THRESH_TOZERO_INV>(thresh, maxval));
+            break;
+        default:
+            break;
+    }
+    return thresh;
+}
+
+uint8_t BGR2GRAYThreshold(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    uint8_t thresh,
+    uint8_t maxval,
+    int32_t type)
+{
+    return bgr2gray_threshold(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxval, type, true);
+}
+
+uint8_t RGB2GRAYThreshold(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    uint8_t thresh,
+    uint8_t maxval,
+    int32_t type)
+{
+    return bgr2gray_threshold(height, width, inWidthStride, inData, outWidthStride, outData, thresh, maxval, type, false);
+}
+
 } // namespace tinycv
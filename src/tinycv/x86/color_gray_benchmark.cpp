@@ -42,6 +42,7 @@ using namespace tinycv::debug;
 
 BENCHMARK_TEMPLATE(BM_BGR2GRAY_tinycv_x86, float)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
 BENCHMARK_TEMPLATE(BM_BGR2GRAY_tinycv_x86, uint8_t)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_BGR2GRAY_tinycv_x86, tinycv::half_t)->Args({320, 240})->Args({640, 480})->Args({1280, 720})->Args({1920, 1080})->Args({3840, 2160});
 
 #ifdef TINYCV_BENCHMARK_OPENCV
 template <typename T>
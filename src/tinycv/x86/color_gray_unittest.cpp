@@ -152,3 +152,107 @@ TEST(GRAY2BGR_UINT8, x86)
     GRAY2ColorTest<uint8_t, 4, GRAY2BGR_MODE>(640, 720);
     GRAY2ColorTest<uint8_t, 4, GRAY2BGR_MODE>(720, 1080);
 }
+
+template <int32_t nc, Color2GrayMode mode>
+void Color2GRAYHalfTest(int32_t height, int32_t width)
+{
+    std::unique_ptr<tinycv::half_t[]> src(new tinycv::half_t[width * height * nc]);
+    std::unique_ptr<float[]> src_f32(new float[width * height * nc]);
+    std::unique_ptr<float[]> dst_f32(new float[width * height]);
+    std::unique_ptr<tinycv::half_t[]> dst_ref(new tinycv::half_t[width * height]);
+    std::unique_ptr<tinycv::half_t[]> dst(new tinycv::half_t[width * height]);
+    randomFillHalf(src.get(), src_f32.get(), width * height * nc, 0, 1);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(CV_32F, nc), src_f32.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(CV_32F, 1), dst_f32.get());
+    if (nc == 3) {
+        if (mode == BGR2GRAY_MODE) {
+            tinycv::BGR2GRAY<tinycv::half_t>(height, width, width * nc, src.get(), width, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_BGR2GRAY);
+        }
+        if (mode == RGB2GRAY_MODE) {
+            tinycv::RGB2GRAY<tinycv::half_t>(height, width, width * nc, src.get(), width, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_RGB2GRAY);
+        }
+    } else if (nc == 4) {
+        if (mode == BGR2GRAY_MODE) {
+            tinycv::BGRA2GRAY<tinycv::half_t>(height, width, width * nc, src.get(), width, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_BGRA2GRAY);
+        }
+        if (mode == RGB2GRAY_MODE) {
+            tinycv::RGBA2GRAY<tinycv::half_t>(height, width, width * nc, src.get(), width, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_RGBA2GRAY);
+        }
+    }
+    for (int32_t i = 0; i < width * height; ++i) {
+        dst_ref[i] = tinycv::half_t(dst_f32[i]);
+    }
+    checkResult<tinycv::half_t, 1>(dst.get(), dst_ref.get(), height, width, width, width, 1e-3f);
+}
+
+template <int32_t nc, Gray2ColorMode mode>
+void GRAY2ColorHalfTest(int32_t height, int32_t width)
+{
+    std::unique_ptr<tinycv::half_t[]> src(new tinycv::half_t[width * height]);
+    std::unique_ptr<float[]> src_f32(new float[width * height]);
+    std::unique_ptr<float[]> dst_f32(new float[width * height * nc]);
+    std::unique_ptr<tinycv::half_t[]> dst_ref(new tinycv::half_t[width * height * nc]);
+    std::unique_ptr<tinycv::half_t[]> dst(new tinycv::half_t[width * height * nc]);
+    randomFillHalf(src.get(), src_f32.get(), width * height, 0, 1);
+    cv::Mat srcMat(height, width, CV_MAKETYPE(CV_32F, 1), src_f32.get());
+    cv::Mat dstMat(height, width, CV_MAKETYPE(CV_32F, nc), dst_f32.get());
+    if (nc == 3) {
+        if (mode == GRAY2BGR_MODE) {
+            tinycv::GRAY2BGR<tinycv::half_t>(height, width, width, src.get(), width * nc, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_GRAY2BGR);
+        }
+        if (mode == GRAY2RGB_MODE) {
+            tinycv::GRAY2RGB<tinycv::half_t>(height, width, width, src.get(), width * nc, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_GRAY2RGB);
+        }
+    } else if (nc == 4) {
+        if (mode == GRAY2BGR_MODE) {
+            tinycv::GRAY2BGRA<tinycv::half_t>(height, width, width, src.get(), width * nc, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_GRAY2BGRA);
+        }
+        if (mode == GRAY2RGB_MODE) {
+            tinycv::GRAY2RGBA<tinycv::half_t>(height, width, width, src.get(), width * nc, dst.get());
+            cv::cvtColor(srcMat, dstMat, cv::COLOR_GRAY2RGBA);
+        }
+    }
+    for (int32_t i = 0; i < width * height * nc; ++i) {
+        dst_ref[i] = tinycv::half_t(dst_f32[i]);
+    }
+    checkResult<tinycv::half_t, nc>(dst.get(), dst_ref.get(), height, width, width * nc, width * nc, 1e-3f);
+}
+
+TEST(RGB2GRAY_FP16, x86)
+{
+    Color2GRAYHalfTest<3, RGB2GRAY_MODE>(640, 720);
+    Color2GRAYHalfTest<3, RGB2GRAY_MODE>(720, 1080);
+    Color2GRAYHalfTest<4, RGB2GRAY_MODE>(640, 720);
+    Color2GRAYHalfTest<4, RGB2GRAY_MODE>(720, 1080);
+}
+
+TEST(BGR2GRAY_FP16, x86)
+{
+    Color2GRAYHalfTest<3, BGR2GRAY_MODE>(640, 720);
+    Color2GRAYHalfTest<3, BGR2GRAY_MODE>(720, 1080);
+    Color2GRAYHalfTest<4, BGR2GRAY_MODE>(640, 720);
+    Color2GRAYHalfTest<4, BGR2GRAY_MODE>(720, 1080);
+}
+
+TEST(GRAY2RGB_FP16, x86)
+{
+    GRAY2ColorHalfTest<3, GRAY2RGB_MODE>(640, 720);
+    GRAY2ColorHalfTest<3, GRAY2RGB_MODE>(720, 1080);
+    GRAY2ColorHalfTest<4, GRAY2RGB_MODE>(640, 720);
+    GRAY2ColorHalfTest<4, GRAY2RGB_MODE>(720, 1080);
+}
+
+TEST(GRAY2BGR_FP16, x86)
+{
+    GRAY2ColorHalfTest<3, GRAY2BGR_MODE>(640, 720);
+    GRAY2ColorHalfTest<3, GRAY2BGR_MODE>(720, 1080);
+    GRAY2ColorHalfTest<4, GRAY2BGR_MODE>(640, 720);
+    GRAY2ColorHalfTest<4, GRAY2BGR_MODE>(720, 1080);
+}
@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/connectedcomponents.h"
+#include "tinycv/debug.h"
+
+#include <opencv2/imgproc.hpp>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+// sparse blobs, like a segmentation mask
+static void fillMask(uint8_t *mask, int32_t height, int32_t width)
+{
+    tinycv::debug::randomFill<uint8_t>(mask, width * height, 0, 255);
+    for (int32_t i = 0; i < width * height; ++i) {
+        mask[i] = mask[i] < 100 ? 255 : 0;
+    }
+}
+
+template <int32_t connectivity>
+void BM_ConnectedComponents_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t numThreads = state.range(2);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<int32_t[]> labels(new int32_t[width * height]);
+    fillMask(src.get(), height, width);
+
+    for (auto _ : state) {
+        tinycv::ConnectedComponents(height, width, width, src.get(), width, labels.get(), connectivity, numThreads);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <int32_t connectivity>
+void BM_ConnectedComponentsWithStats_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t numThreads = state.range(2);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<int32_t[]> labels(new int32_t[width * height]);
+    const int32_t maxLabels = height * ((width + 1) / 2) + 1;
+    std::vector<int32_t> stats(maxLabels * tinycv::CC_STAT_MAX);
+    std::vector<double> centroids(maxLabels * 2);
+    fillMask(src.get(), height, width);
+
+    for (auto _ : state) {
+        tinycv::ConnectedComponentsWithStats(height, width, width, src.get(), width, labels.get(), maxLabels, stats.data(), centroids.data(), connectivity, numThreads);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace tinycv::debug;
+
+BENCHMARK_TEMPLATE(BM_ConnectedComponents_tinycv_x86, connectivity8)->Args({640, 480, 1})->Args({1920, 1080, 1})->Args({1920, 1080, 4});
+BENCHMARK_TEMPLATE(BM_ConnectedComponents_tinycv_x86, connectivity4)->Args({640, 480, 1})->Args({1920, 1080, 1})->Args({1920, 1080, 4});
+BENCHMARK_TEMPLATE(BM_ConnectedComponentsWithStats_tinycv_x86, connectivity8)->Args({640, 480, 1})->Args({1920, 1080, 1})->Args({1920, 1080, 4});
+
+#ifdef TINYCV_BENCHMARK_OPENCV
+template <int32_t connectivity>
+static void BM_ConnectedComponents_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    fillMask(src.get(), height, width);
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat labels;
+    for (auto _ : state) {
+        cv::connectedComponents(iMat, labels, connectivity, CV_32S);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <int32_t connectivity>
+static void BM_ConnectedComponentsWithStats_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    fillMask(src.get(), height, width);
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat labels, stats, centroids;
+    for (auto _ : state) {
+        cv::connectedComponentsWithStats(iMat, labels, stats, centroids, connectivity, CV_32S);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_ConnectedComponents_opencv_x86, connectivity8)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_ConnectedComponents_opencv_x86, connectivity4)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_ConnectedComponentsWithStats_opencv_x86, connectivity8)->Args({640, 480})->Args({1920, 1080});
+
+#endif //! TINYCV_BENCHMARK_OPENCV
+} // namespace
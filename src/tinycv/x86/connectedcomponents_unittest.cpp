@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/connectedcomponents.h"
+#include "tinycv/x86/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <memory>
+#include <vector>
+
+// a mask of blobs of smoothed noise, `level` sets how much of it is foreground
+static void fillMask(uint8_t *mask, int32_t height, int32_t width, int32_t level)
+{
+    std::unique_ptr<uint8_t[]> noise(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(noise.get(), width * height, 0, 255);
+    cv::Mat nMat(height, width, CV_8UC1, noise.get());
+    cv::Mat sMat;
+    cv::GaussianBlur(nMat, sMat, cv::Size(5, 5), 1.5);
+    for (int32_t y = 0; y < height; ++y) {
+        for (int32_t x = 0; x < width; ++x) {
+            mask[y * width + x] = sMat.at<uint8_t>(y, x) > level ? 255 : 0;
+        }
+    }
+}
+
+void ConnectedComponentsTest(int32_t height, int32_t width, int32_t level, int32_t connectivity, int32_t numThreads)
+{
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<int32_t[]> labels(new int32_t[width * height]);
+    fillMask(src.get(), height, width, level);
+
+    const int32_t maxLabels = connectivity == 8 ? (height + 1) / 2 * ((width + 1) / 2) + 1 : height * ((width + 1) / 2) + 1;
+    std::vector<int32_t> stats(maxLabels * tinycv::CC_STAT_MAX);
+    std::vector<double> centroids(maxLabels * 2);
+    int32_t n = tinycv::ConnectedComponentsWithStats(height, width, width, src.get(), width, labels.get(), maxLabels, stats.data(), centroids.data(), connectivity, numThreads);
+
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat labels_opencv, stats_opencv, centroids_opencv;
+    int32_t n_opencv = cv::connectedComponentsWithStats(iMat, labels_opencv, stats_opencv, centroids_opencv, connectivity, CV_32S);
+    ASSERT_EQ(n, n_opencv);
+
+    //! components may be numbered differently, the labels must map one to one
+    std::vector<int32_t> toOpencv(n, -1), fromOpencv(n, -1);
+    for (int32_t y = 0; y < height; ++y) {
+        for (int32_t x = 0; x < width; ++x) {
+            int32_t l = labels[y * width + x];
+            int32_t lo = labels_opencv.at<int32_t>(y, x);
+            ASSERT_EQ(l == 0, lo == 0);
+            if (toOpencv[l] < 0) {
+                ASSERT_LT(fromOpencv[lo], 0);
+                toOpencv[l] = lo;
+                fromOpencv[lo] = l;
+            }
+            ASSERT_EQ(toOpencv[l], lo);
+        }
+    }
+    for (int32_t l = 0; l < n; ++l) {
+        int32_t lo = toOpencv[l];
+        if (lo < 0) {
+            continue;
+        }
+        for (int32_t k = 0; k < tinycv::CC_STAT_MAX; ++k) {
+            EXPECT_EQ(stats[l * tinycv::CC_STAT_MAX + k], stats_opencv.at<int32_t>(lo, k));
+        }
+        EXPECT_NEAR(centroids[2 * l], centroids_opencv.at<double>(lo, 0), 1e-9);
+        EXPECT_NEAR(centroids[2 * l + 1], centroids_opencv.at<double>(lo, 1), 1e-9);
+    }
+
+    std::unique_ptr<int32_t[]> labels_only(new int32_t[width * height]);
+    EXPECT_EQ(n, tinycv::ConnectedComponents(height, width, width, src.get(), width, labels_only.get(), connectivity, numThreads));
+    EXPECT_EQ(0, memcmp(labels.get(), labels_only.get(), width * height * sizeof(int32_t)));
+}
+
+TEST(CONNECTED_COMPONENTS_8, x86)
+{
+    ConnectedComponentsTest(480, 640, 128, tinycv::debug::connectivity8, 1);
+    ConnectedComponentsTest(480, 640, 140, tinycv::debug::connectivity8, 1);
+    ConnectedComponentsTest(101, 99, 120, tinycv::debug::connectivity8, 1);
+    ConnectedComponentsTest(7, 13, 128, tinycv::debug::connectivity8, 1);
+    ConnectedComponentsTest(1, 31, 128, tinycv::debug::connectivity8, 1);
+}
+
+TEST(CONNECTED_COMPONENTS_4, x86)
+{
+    ConnectedComponentsTest(480, 640, 128, tinycv::debug::connectivity4, 1);
+    ConnectedComponentsTest(101, 99, 120, tinycv::debug::connectivity4, 1);
+    ConnectedComponentsTest(31, 1, 128, tinycv::debug::connectivity4, 1);
+}
+
+TEST(CONNECTED_COMPONENTS_THREADS, x86)
+{
+    ConnectedComponentsTest(1080, 1920, 128, tinycv::debug::connectivity8, 4);
+    ConnectedComponentsTest(721, 1279, 128, tinycv::debug::connectivity8, 3);
+    ConnectedComponentsTest(721, 1279, 128, tinycv::debug::connectivity4, 7);
+}
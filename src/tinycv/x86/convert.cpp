@@ -0,0 +1,749 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/convert.h"
+#include "tinycv/x86/fma/internal_fma.hpp"
+#include "tinycv/types.h"
+#include "tinycv/sys.h"
+#include "tinycv/x86/sysinfo.h"
+
+#include <string.h>
+#include <cmath>
+#include <immintrin.h>
+
+namespace tinycv {
+
+template <typename T, int32_t nc>
+static void convert_normalize(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    const float *mean,
+    const float *scale,
+    bool swapRB,
+    bool planar,
+    int32_t outWidthStride,
+    float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (nullptr == mean || nullptr == scale) {
+        return;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return;
+    }
+
+    // (src - mean) * scale is evaluated as src * scale + bias
+    float s[nc], b[nc];
+    int32_t src_channel[nc];
+    for (int32_t c = 0; c < nc; ++c) {
+        s[c] = scale[c];
+        b[c] = -mean[c] * scale[c];
+        src_channel[c] = c;
+    }
+    bool swap_rb = swapRB && nc >= 3;
+    if (swap_rb) {
+        src_channel[0] = 2;
+        src_channel[2] = 0;
+    }
+    int32_t plane_stride = planar ? height * outWidthStride : 0;
+    int32_t dst_step = planar ? 1 : nc;
+    int32_t dst_channel_stride = planar ? plane_stride : 1;
+    bool use_fma = CpuSupports(ISA_X86_FMA);
+
+    for (int32_t i = 0; i < height; ++i) {
+        const T *src = inData + i * inWidthStride;
+        float *dst = outData + i * outWidthStride;
+        int32_t j = 0;
+        if (use_fma) {
+            j = fma::convert_normalize_row_fma(src, width, nc, s, b, swap_rb, plane_stride, dst);
+        }
+        for (; j < width; ++j) {
+            for (int32_t c = 0; c < nc; ++c) {
+                dst[j * dst_step + c * dst_channel_stride] = (float)src[j * nc + src_channel[c]] * s[c] + b[c];
+            }
+        }
+    }
+}
+
+template <>
+void ConvertNormalize<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, const float *mean, const float *scale, bool swapRB, bool planar, int32_t outWidthStride, float *outData)
+{
+    convert_normalize<uint8_t, 1>(height, width, inWidthStride, inData, mean, scale, swapRB, planar, outWidthStride, outData);
+}
+
+template <>
+void ConvertNormalize<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, const float *mean, const float *scale, bool swapRB, bool planar, int32_t outWidthStride, float *outData)
+{
+    convert_normalize<uint8_t, 3>(height, width, inWidthStride, inData, mean, scale, swapRB, planar, outWidthStride, outData);
+}
+
+template <>
+void ConvertNormalize<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, const float *mean, const float *scale, bool swapRB, bool planar, int32_t outWidthStride, float *outData)
+{
+    convert_normalize<uint8_t, 4>(height, width, inWidthStride, inData, mean, scale, swapRB, planar, outWidthStride, outData);
+}
+
+template <>
+void ConvertNormalize<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, const float *mean, const float *scale, bool swapRB, bool planar, int32_t outWidthStride, float *outData)
+{
+    convert_normalize<float, 1>(height, width, inWidthStride, inData, mean, scale, swapRB, planar, outWidthStride, outData);
+}
+
+template <>
+void ConvertNormalize<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, const float *mean, const float *scale, bool swapRB, bool planar, int32_t outWidthStride, float *outData)
+{
+    convert_normalize<float, 3>(height, width, inWidthStride, inData, mean, scale, swapRB, planar, outWidthStride, outData);
+}
+
+template <>
+void ConvertNormalize<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, const float *mean, const float *scale, bool swapRB, bool planar, int32_t outWidthStride, float *outData)
+{
+    convert_normalize<float, 4>(height, width, inWidthStride, inData, mean, scale, swapRB, planar, outWidthStride, outData);
+}
+
+
+template <typename T>
+static inline T saturate_convert(float v);
+
+// NaN maps to 0 like the min/max clamp of the vector path
+template <>
+inline uint8_t saturate_convert<uint8_t>(float v)
+{
+    v = v > 0.f ? v : 0.f;
+    return (uint8_t)lrintf(v < 255.f ? v : 255.f);
+}
+
+template <>
+inline int16_t saturate_convert<int16_t>(float v)
+{
+    v = v > -32768.f ? v : -32768.f;
+    return (int16_t)lrintf(v < 32767.f ? v : 32767.f);
+}
+
+template <>
+inline uint16_t saturate_convert<uint16_t>(float v)
+{
+    v = v > 0.f ? v : 0.f;
+    return (uint16_t)lrintf(v < 65535.f ? v : 65535.f);
+}
+
+template <>
+inline float saturate_convert<float>(float v)
+{
+    return v;
+}
+
+// loads 8 elements as two float vectors and stores them back with saturation
+template <typename T>
+struct convert_to_sse_traits;
+
+template <>
+struct convert_to_sse_traits<uint8_t> {
+    static inline void load(const uint8_t *src, __m128 &lo, __m128 &hi)
+    {
+        __m128i v = _mm_loadl_epi64((const __m128i *)src);
+        lo = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(v));
+        hi = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(v, 4)));
+    }
+    static inline void store(uint8_t *dst, __m128 lo, __m128 hi)
+    {
+        const __m128 v_min = _mm_setzero_ps(), v_max = _mm_set1_ps(255.f);
+        __m128i v_lo = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(lo, v_min), v_max));
+        __m128i v_hi = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(hi, v_min), v_max));
+        __m128i v = _mm_packs_epi32(v_lo, v_hi);
+        _mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(v, v));
+    }
+};
+
+template <>
+struct convert_to_sse_traits<int16_t> {
+    static inline void load(const int16_t *src, __m128 &lo, __m128 &hi)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)src);
+        lo = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(v));
+        hi = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(v, 8)));
+    }
+    static inline void store(int16_t *dst, __m128 lo, __m128 hi)
+    {
+        const __m128 v_min = _mm_set1_ps(-32768.f), v_max = _mm_set1_ps(32767.f);
+        __m128i v_lo = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(lo, v_min), v_max));
+        __m128i v_hi = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(hi, v_min), v_max));
+        _mm_storeu_si128((__m128i *)dst, _mm_packs_epi32(v_lo, v_hi));
+    }
+};
+
+template <>
+struct convert_to_sse_traits<uint16_t> {
+    static inline void load(const uint16_t *src, __m128 &lo, __m128 &hi)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)src);
+        lo = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(v));
+        hi = _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_srli_si128(v, 8)));
+    }
+    static inline void store(uint16_t *dst, __m128 lo, __m128 hi)
+    {
+        const __m128 v_min = _mm_setzero_ps(), v_max = _mm_set1_ps(65535.f);
+        __m128i v_lo = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(lo, v_min), v_max));
+        __m128i v_hi = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(hi, v_min), v_max));
+        _mm_storeu_si128((__m128i *)dst, _mm_packus_epi32(v_lo, v_hi));
+    }
+};
+
+template <>
+struct convert_to_sse_traits<float> {
+    static inline void load(const float *src, __m128 &lo, __m128 &hi)
+    {
+        lo = _mm_loadu_ps(src);
+        hi = _mm_loadu_ps(src + 4);
+    }
+    static inline void store(float *dst, __m128 lo, __m128 hi)
+    {
+        _mm_storeu_ps(dst, lo);
+        _mm_storeu_ps(dst + 4, hi);
+    }
+};
+
+template <typename TSrc, typename TDst>
+static int32_t convert_to_row_sse(const TSrc *src, int32_t n, float alpha, float beta, TDst *dst)
+{
+    __m128 v_alpha = _mm_set1_ps(alpha), v_beta = _mm_set1_ps(beta);
+    int32_t i = 0;
+    for (; i <= n - 8; i += 8) {
+        __m128 lo, hi;
+        convert_to_sse_traits<TSrc>::load(src + i, lo, hi);
+        lo = _mm_add_ps(_mm_mul_ps(lo, v_alpha), v_beta);
+        hi = _mm_add_ps(_mm_mul_ps(hi, v_alpha), v_beta);
+        convert_to_sse_traits<TDst>::store(dst + i, lo, hi);
+    }
+    return i;
+}
+
+template <typename TSrc, typename TDst, int32_t nc>
+void ConvertTo(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const TSrc *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    TDst *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (width == 0 || height == 0 || inWidthStride == 0 || outWidthStride == 0) {
+        return;
+    }
+
+    int32_t n = width * nc;
+    bool use_fma = CpuSupports(ISA_X86_FMA);
+    for (int32_t i = 0; i < height; ++i) {
+        const TSrc *src = inData + i * inWidthStride;
+        TDst *dst = outData + i * outWidthStride;
+        int32_t j = use_fma ? fma::convert_to_row_fma(src, n, alpha, beta, dst) : convert_to_row_sse(src, n, alpha, beta, dst);
+        for (; j < n; ++j) {
+            dst[j] = saturate_convert<TDst>((float)src[j] * alpha + beta);
+        }
+    }
+}
+
+template void ConvertTo<uint8_t, uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<uint8_t, uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<uint8_t, uint8_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<uint8_t, int16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<uint8_t, int16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<uint8_t, int16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<uint8_t, uint16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<uint8_t, uint16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<uint8_t, uint16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<uint8_t, float, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<uint8_t, float, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<uint8_t, float, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<int16_t, uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<int16_t, uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<int16_t, uint8_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<int16_t, int16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<int16_t, int16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<int16_t, int16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<int16_t, uint16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<int16_t, uint16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<int16_t, uint16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<int16_t, float, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<int16_t, float, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<int16_t, float, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<uint16_t, uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<uint16_t, uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<uint16_t, uint8_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<uint16_t, int16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<uint16_t, int16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<uint16_t, int16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<uint16_t, uint16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<uint16_t, uint16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<uint16_t, uint16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<uint16_t, float, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<uint16_t, float, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<uint16_t, float, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<float, uint8_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<float, uint8_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<float, uint8_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint8_t *outData);
+
+template void ConvertTo<float, int16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<float, int16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<float, int16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    int16_t *outData);
+
+template void ConvertTo<float, uint16_t, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<float, uint16_t, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<float, uint16_t, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    uint16_t *outData);
+
+template void ConvertTo<float, float, 1>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<float, float, 3>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+template void ConvertTo<float, float, 4>(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    float alpha,
+    float beta,
+    int32_t outWidthStride,
+    float *outData);
+
+} // namespace tinycv
@@ -0,0 +1,188 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/convert.h"
+#include "tinycv/x86/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+template <typename T, int32_t nc>
+void ConvertNormalizeTest(int32_t height, int32_t width, bool swapRB, bool planar)
+{
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    const float mean[4] = {103.94f, 116.78f, 123.68f, 127.5f};
+    const float scale[4] = {0.017f, 0.0175f, 0.0171f, 1.f / 127.5f};
+
+    int32_t outWidthStride = planar ? width : width * nc;
+    std::unique_ptr<float[]> dst(new float[width * height * nc]);
+    tinycv::ConvertNormalize<T, nc>(height, width, width * nc, src.get(), mean, scale, swapRB, planar, outWidthStride, dst.get());
+
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat fMat;
+    iMat.convertTo(fMat, CV_32F);
+    if (swapRB && nc == 3) {
+        cv::cvtColor(fMat, fMat, cv::COLOR_BGR2RGB);
+    } else if (swapRB && nc == 4) {
+        cv::cvtColor(fMat, fMat, cv::COLOR_BGRA2RGBA);
+    }
+    std::vector<cv::Mat> channels;
+    cv::split(fMat, channels);
+    for (int32_t c = 0; c < nc; ++c) {
+        channels[c] = (channels[c] - mean[c]) * scale[c];
+    }
+
+    if (planar) {
+        for (int32_t c = 0; c < nc; ++c) {
+            checkResult<float, 1>(dst.get() + c * height * width, (const float *)channels[c].data, height, width, width, width, 1e-4f);
+        }
+    } else {
+        cv::Mat oMat;
+        cv::merge(channels, oMat);
+        checkResult<float, nc>(dst.get(), (const float *)oMat.data, height, width, width * nc, width * nc, 1e-4f);
+    }
+
+    // the vector paths and the scalar tail all multiply, then add -mean * scale, so they agree to the bit
+    std::vector<float> ref(width * height * nc);
+    for (int32_t i = 0; i < height * width; ++i) {
+        for (int32_t c = 0; c < nc; ++c) {
+            int32_t sc = (swapRB && nc >= 3 && c != 1 && c != 3) ? 2 - c : c;
+            volatile float product = (float)src[i * nc + sc] * scale[c];
+            ref[planar ? c * height * width + i : i * nc + c] = product + -mean[c] * scale[c];
+        }
+    }
+    EXPECT_EQ(0, memcmp(ref.data(), dst.get(), ref.size() * sizeof(float)));
+}
+
+TEST(CONVERT_NORMALIZE_UINT8, x86)
+{
+    ConvertNormalizeTest<uint8_t, 1>(480, 640, false, false);
+    ConvertNormalizeTest<uint8_t, 1>(101, 101, false, true);
+
+    ConvertNormalizeTest<uint8_t, 3>(480, 640, false, false);
+    ConvertNormalizeTest<uint8_t, 3>(480, 640, true, false);
+    ConvertNormalizeTest<uint8_t, 3>(480, 640, true, true);
+    ConvertNormalizeTest<uint8_t, 3>(101, 101, true, true);
+    ConvertNormalizeTest<uint8_t, 3>(101, 101, false, true);
+
+    ConvertNormalizeTest<uint8_t, 4>(480, 640, false, false);
+    ConvertNormalizeTest<uint8_t, 4>(480, 640, true, true);
+    ConvertNormalizeTest<uint8_t, 4>(101, 101, true, false);
+}
+
+TEST(CONVERT_NORMALIZE_FP32, x86)
+{
+    ConvertNormalizeTest<float, 1>(480, 640, false, false);
+    ConvertNormalizeTest<float, 1>(101, 101, false, true);
+
+    ConvertNormalizeTest<float, 3>(480, 640, false, false);
+    ConvertNormalizeTest<float, 3>(480, 640, true, false);
+    ConvertNormalizeTest<float, 3>(480, 640, true, true);
+    ConvertNormalizeTest<float, 3>(101, 101, true, true);
+    ConvertNormalizeTest<float, 3>(101, 101, false, true);
+
+    ConvertNormalizeTest<float, 4>(480, 640, false, false);
+    ConvertNormalizeTest<float, 4>(480, 640, true, true);
+    ConvertNormalizeTest<float, 4>(101, 101, true, false);
+}
+
+// integer results are rounded to nearest and saturated
+template <typename T>
+static T ConvertToRef(float v)
+{
+    if (!std::numeric_limits<T>::is_integer) {
+        return (T)v;
+    }
+    v = v > (float)std::numeric_limits<T>::min() ? v : (float)std::numeric_limits<T>::min();
+    v = v < (float)std::numeric_limits<T>::max() ? v : (float)std::numeric_limits<T>::max();
+    return (T)lrintf(v);
+}
+
+template <typename TSrc, typename TDst, int32_t nc>
+void ConvertToTest(int32_t height, int32_t width, float alpha, float beta)
+{
+    std::unique_ptr<TSrc[]> src(new TSrc[width * height * nc]);
+    tinycv::debug::randomFill<TSrc>(src.get(), width * height * nc, 0, 255);
+
+    std::unique_ptr<TDst[]> dst(new TDst[width * height * nc]);
+    tinycv::ConvertTo<TSrc, TDst, nc>(height, width, width * nc, src.get(), alpha, beta, width * nc, dst.get());
+
+    std::unique_ptr<TDst[]> dst_opencv(new TDst[width * height * nc]);
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<TSrc>::depth, nc), src.get());
+    cv::Mat oMat(height, width, CV_MAKETYPE(cv::DataType<TDst>::depth, nc), dst_opencv.get());
+    iMat.convertTo(oMat, oMat.type(), alpha, beta);
+
+    // OpenCV may round src * alpha + beta differently, integer results can be off by one
+    checkResult<TDst, nc>(dst.get(), dst_opencv.get(), height, width, width * nc, width * nc, 1.01f);
+
+    // the vector paths and the scalar tail round the same way, so they agree to the bit
+    std::vector<TDst> ref(width * height * nc);
+    for (int32_t i = 0; i < width * height * nc; ++i) {
+        volatile float product = (float)src[i] * alpha;
+        ref[i] = ConvertToRef<TDst>(product + beta);
+    }
+    EXPECT_EQ(0, memcmp(ref.data(), dst.get(), ref.size() * sizeof(TDst)));
+}
+
+template <typename TSrc, typename TDst>
+void ConvertToTestAll()
+{
+    ConvertToTest<TSrc, TDst, 1>(480, 640, 1.f, 0.f);
+    ConvertToTest<TSrc, TDst, 1>(101, 101, -3.5f, 100.f);
+    ConvertToTest<TSrc, TDst, 3>(480, 640, 257.f, -1000.f);
+    ConvertToTest<TSrc, TDst, 3>(101, 101, 0.5f, 0.25f);
+    ConvertToTest<TSrc, TDst, 4>(480, 640, 1.f / 255.f, 0.f);
+    ConvertToTest<TSrc, TDst, 4>(101, 101, -129.f, 3.f);
+}
+
+TEST(CONVERT_TO_UINT8, x86)
+{
+    ConvertToTestAll<uint8_t, uint8_t>();
+    ConvertToTestAll<uint8_t, int16_t>();
+    ConvertToTestAll<uint8_t, uint16_t>();
+    ConvertToTestAll<uint8_t, float>();
+}
+
+TEST(CONVERT_TO_INT16, x86)
+{
+    ConvertToTestAll<int16_t, uint8_t>();
+    ConvertToTestAll<int16_t, int16_t>();
+    ConvertToTestAll<int16_t, uint16_t>();
+    ConvertToTestAll<int16_t, float>();
+}
+
+TEST(CONVERT_TO_UINT16, x86)
+{
+    ConvertToTestAll<uint16_t, uint8_t>();
+    ConvertToTestAll<uint16_t, int16_t>();
+    ConvertToTestAll<uint16_t, uint16_t>();
+    ConvertToTestAll<uint16_t, float>();
+}
+
+TEST(CONVERT_TO_FP32, x86)
+{
+    ConvertToTestAll<float, uint8_t>();
+    ConvertToTestAll<float, int16_t>();
+    ConvertToTestAll<float, uint16_t>();
+    ConvertToTestAll<float, float>();
+}
@@ -0,0 +1,318 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/distancetransform.h"
+#include "tinycv/sys.h"
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <immintrin.h>
+
+#define DIST_SHIFT 16
+#define DIST_INIT 0x7fffffffu //! fixed point distance of the frame around the image
+#define DIST_MAX (0x7fffffffu >> 2)
+
+namespace tinycv {
+
+// chamfer weights, of a step to a 4-neighbour, to a diagonal one and of a knight move
+template <typename V>
+struct ChamferWeights {
+    V hv, diag, knight;
+};
+
+static inline uint32_t dist_fix(float weight)
+{
+    return (uint32_t)lrintf(weight * (1 << DIST_SHIFT));
+}
+
+// v moved up by n lanes, the n lowest lanes are taken from `fill`
+template <int32_t n>
+static inline __m128i dist_shift_up(__m128i v, __m128i fill)
+{
+    return _mm_blend_epi16(_mm_slli_si128(v, 4 * n), fill, (1 << (2 * n)) - 1);
+}
+
+// v moved down by n lanes, the n highest lanes are taken from `fill`
+template <int32_t n>
+static inline __m128i dist_shift_down(__m128i v, __m128i fill)
+{
+    return _mm_blend_epi16(_mm_srli_si128(v, 4 * n), fill, 0xff & ~(0xff >> (2 * n)));
+}
+
+// DIST_L1 and DIST_C in DIST_SHIFT fixed point, their weights are integers so the sums are exact
+struct DistFixedTraits {
+    typedef uint32_t value_t;
+    typedef __m128i vec_t;
+
+    static inline value_t init()
+    {
+        return DIST_INIT;
+    }
+    static inline float dist(value_t v)
+    {
+        return (float)std::min(v, DIST_MAX) * (1.0f / (1 << DIST_SHIFT));
+    }
+    static inline __m128i to_bits(vec_t v)
+    {
+        return v;
+    }
+    static inline vec_t from_bits(__m128i v)
+    {
+        return v;
+    }
+    static inline vec_t set1(value_t v)
+    {
+        return _mm_set1_epi32(v);
+    }
+    static inline vec_t load(const value_t *p)
+    {
+        return _mm_loadu_si128((const __m128i *)p);
+    }
+    static inline void store(value_t *p, vec_t v)
+    {
+        _mm_storeu_si128((__m128i *)p, v);
+    }
+    static inline vec_t add(vec_t a, vec_t b)
+    {
+        return _mm_add_epi32(a, b);
+    }
+    static inline vec_t min(vec_t a, vec_t b)
+    {
+        return _mm_min_epu32(a, b);
+    }
+    static inline void store_dist(float *dst, vec_t v)
+    {
+        _mm_storeu_ps(dst, _mm_mul_ps(_mm_cvtepi32_ps(_mm_min_epu32(v, _mm_set1_epi32(DIST_MAX))), _mm_set1_ps(1.0f / (1 << DIST_SHIFT))));
+    }
+};
+
+// DIST_L2 in float like OpenCV, its weights are not exact in fixed point and the error would grow with the distance
+struct DistFloatTraits {
+    typedef float value_t;
+    typedef __m128 vec_t;
+
+    //! FLT_MAX plus a weight rounds back to FLT_MAX
+    static inline value_t init()
+    {
+        return FLT_MAX;
+    }
+    static inline float dist(value_t v)
+    {
+        return v;
+    }
+    static inline __m128i to_bits(vec_t v)
+    {
+        return _mm_castps_si128(v);
+    }
+    static inline vec_t from_bits(__m128i v)
+    {
+        return _mm_castsi128_ps(v);
+    }
+    static inline vec_t set1(value_t v)
+    {
+        return _mm_set1_ps(v);
+    }
+    static inline vec_t load(const value_t *p)
+    {
+        return _mm_loadu_ps(p);
+    }
+    static inline void store(value_t *p, vec_t v)
+    {
+        _mm_storeu_ps(p, v);
+    }
+    static inline vec_t add(vec_t a, vec_t b)
+    {
+        return _mm_add_ps(a, b);
+    }
+    static inline vec_t min(vec_t a, vec_t b)
+    {
+        return _mm_min_ps(a, b);
+    }
+    static inline void store_dist(float *dst, vec_t v)
+    {
+        _mm_storeu_ps(dst, v);
+    }
+};
+
+// t[i] = min(v[i], t[i - 1] + hv) for the 4 lanes of v, `carry` is t of the lane left of them. Every step adds hv
+// once more instead of a multiple of it, so that float sums round like the scalar loop
+template <typename Traits>
+static inline typename Traits::vec_t dist_scan_forward(typename Traits::vec_t v, typename Traits::vec_t carry, typename Traits::vec_t hv)
+{
+    const __m128i init = Traits::to_bits(Traits::set1(Traits::init()));
+    v = Traits::min(v, Traits::from_bits(dist_shift_up<1>(init, Traits::to_bits(Traits::add(carry, hv)))));
+    v = Traits::min(v, Traits::add(Traits::from_bits(dist_shift_up<1>(Traits::to_bits(v), init)), hv));
+    return Traits::min(v, Traits::add(Traits::add(Traits::from_bits(dist_shift_up<2>(Traits::to_bits(v), init)), hv), hv));
+}
+
+// the same from the right, `carry` is t of the lane right of them
+template <typename Traits>
+static inline typename Traits::vec_t dist_scan_backward(typename Traits::vec_t v, typename Traits::vec_t carry, typename Traits::vec_t hv)
+{
+    const __m128i init = Traits::to_bits(Traits::set1(Traits::init()));
+    v = Traits::min(v, Traits::from_bits(dist_shift_down<1>(init, Traits::to_bits(Traits::add(carry, hv)))));
+    v = Traits::min(v, Traits::add(Traits::from_bits(dist_shift_down<1>(Traits::to_bits(v), init)), hv));
+    return Traits::min(v, Traits::add(Traits::add(Traits::from_bits(dist_shift_down<2>(Traits::to_bits(v), init)), hv), hv));
+}
+
+// the neighbours of a row in the rows done before it, `r1` one row away and `r2` two rows away
+template <int32_t maskSize, typename V>
+static inline V dist_neighbours(const V *r1, const V *r2, int32_t x, const ChamferWeights<V> &w)
+{
+    V t = std::min(std::min(r1[x - 1], r1[x + 1]) + w.diag, r1[x] + w.hv);
+    if (maskSize == 5) {
+        t = std::min(t, std::min(std::min(r2[x - 1], r2[x + 1]), std::min(r1[x - 2], r1[x + 2])) + w.knight);
+    }
+    return t;
+}
+
+// the same for 4 pixels
+template <typename Traits, int32_t maskSize>
+static inline typename Traits::vec_t dist_neighbours4(const typename Traits::value_t *r1, const typename Traits::value_t *r2, int32_t x, const ChamferWeights<typename Traits::value_t> &w)
+{
+    typedef typename Traits::vec_t vec_t;
+    vec_t diag = Traits::min(Traits::load(r1 + x - 1), Traits::load(r1 + x + 1));
+    vec_t t = Traits::min(Traits::add(diag, Traits::set1(w.diag)), Traits::add(Traits::load(r1 + x), Traits::set1(w.hv)));
+    if (maskSize == 5) {
+        vec_t k0 = Traits::min(Traits::load(r2 + x - 1), Traits::load(r2 + x + 1));
+        vec_t k1 = Traits::min(Traits::load(r1 + x - 2), Traits::load(r1 + x + 2));
+        t = Traits::min(t, Traits::add(Traits::min(k0, k1), Traits::set1(w.knight)));
+    }
+    return t;
+}
+
+// forward pass of a row, zero pixels are the distance sources
+template <typename Traits, int32_t maskSize>
+static void dist_forward_row(const uint8_t *src, int32_t width, int32_t step, const ChamferWeights<typename Traits::value_t> &w, typename Traits::value_t *t)
+{
+    typedef typename Traits::value_t value_t;
+    typedef typename Traits::vec_t vec_t;
+    const value_t *r1 = t - step;
+    const value_t *r2 = maskSize == 5 ? r1 - step : r1;
+    const vec_t hv = Traits::set1(w.hv);
+    vec_t carry = Traits::set1(Traits::init());
+    int32_t x = 0;
+    for (; x <= width - 4; x += 4) {
+        int32_t bytes;
+        memcpy(&bytes, src + x, sizeof(bytes));
+        __m128i zero = _mm_cmpeq_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(bytes)), _mm_setzero_si128());
+        vec_t v = Traits::from_bits(_mm_andnot_si128(zero, Traits::to_bits(dist_neighbours4<Traits, maskSize>(r1, r2, x, w))));
+        v = dist_scan_forward<Traits>(v, carry, hv);
+        Traits::store(t + x, v);
+        carry = Traits::from_bits(_mm_shuffle_epi32(Traits::to_bits(v), 0xff));
+    }
+    for (; x < width; ++x) {
+        t[x] = src[x] ? std::min(dist_neighbours<maskSize>(r1, r2, x, w), t[x - 1] + w.hv) : 0;
+    }
+}
+
+// backward pass of a row and its distances, `t` already holds the forward distances
+template <typename Traits, int32_t maskSize>
+static void dist_backward_row(int32_t width, int32_t step, const ChamferWeights<typename Traits::value_t> &w, typename Traits::value_t *t, float *dst)
+{
+    typedef typename Traits::value_t value_t;
+    typedef typename Traits::vec_t vec_t;
+    const value_t *r1 = t + step;
+    const value_t *r2 = maskSize == 5 ? r1 + step : r1;
+    int32_t x = width - 1;
+    for (; x >= (width & ~3); --x) {
+        t[x] = std::min(std::min(t[x], dist_neighbours<maskSize>(r1, r2, x, w)), t[x + 1] + w.hv);
+        dst[x] = Traits::dist(t[x]);
+    }
+    const vec_t hv = Traits::set1(w.hv);
+    vec_t carry = Traits::set1(t[x + 1]);
+    for (x -= 3; x >= 0; x -= 4) {
+        vec_t v = Traits::min(Traits::load(t + x), dist_neighbours4<Traits, maskSize>(r1, r2, x, w));
+        v = dist_scan_backward<Traits>(v, carry, hv);
+        Traits::store(t + x, v);
+        Traits::store_dist(dst + x, v);
+        carry = Traits::from_bits(_mm_shuffle_epi32(Traits::to_bits(v), 0x00));
+    }
+}
+
+template <typename Traits, int32_t maskSize>
+static void dist_transform(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, float *outData, const ChamferWeights<typename Traits::value_t> &w)
+{
+    typedef typename Traits::value_t value_t;
+    //! distances with a frame of the initial distance, as wide as the reach of the mask
+    const int32_t border = maskSize / 2;
+    const int32_t step = width + 2 * border;
+    const value_t init = Traits::init();
+    const size_t length = (size_t)(height + 2 * border) * step;
+    value_t *temp = (value_t *)tinycv::ScratchAlloc(length * sizeof(value_t), 64);
+    std::fill(temp, temp + (size_t)border * step, init);
+    std::fill(temp + length - (size_t)border * step, temp + length, init);
+    value_t *t0 = temp + (size_t)border * step + border;
+    for (int32_t y = 0; y < height; ++y) {
+        value_t *t = t0 + (size_t)y * step;
+        for (int32_t b = 1; b <= border; ++b) {
+            t[-b] = init;
+            t[width - 1 + b] = init;
+        }
+    }
+
+    for (int32_t y = 0; y < height; ++y) {
+        dist_forward_row<Traits, maskSize>(inData + (size_t)y * inWidthStride, width, step, w, t0 + (size_t)y * step);
+    }
+    for (int32_t y = height - 1; y >= 0; --y) {
+        dist_backward_row<Traits, maskSize>(width, step, w, t0 + (size_t)y * step, outData + (size_t)y * outWidthStride);
+    }
+    tinycv::ScratchFree(temp);
+}
+
+void DistanceTransform(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    float *outData,
+    DistanceType distanceType,
+    int32_t maskSize)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width || outWidthStride < width) {
+        return;
+    }
+    if (maskSize != 3 && maskSize != 5) {
+        return;
+    }
+    //! same weights as OpenCV's, L1 and C use the 3x3 mask
+    if (distanceType == DIST_L2) {
+        ChamferWeights<float> w;
+        w.hv = maskSize == 3 ? 0.955f : 1.0f;
+        w.diag = maskSize == 3 ? 1.3693f : 1.4f;
+        w.knight = 2.1969f;
+        if (maskSize == 3) {
+            dist_transform<DistFloatTraits, 3>(height, width, inWidthStride, inData, outWidthStride, outData, w);
+        } else {
+            dist_transform<DistFloatTraits, 5>(height, width, inWidthStride, inData, outWidthStride, outData, w);
+        }
+    } else if (distanceType == DIST_L1 || distanceType == DIST_C) {
+        ChamferWeights<uint32_t> w;
+        w.hv = dist_fix(1.0f);
+        w.diag = dist_fix(distanceType == DIST_L1 ? 2.0f : 1.0f);
+        w.knight = 0;
+        dist_transform<DistFixedTraits, 3>(height, width, inWidthStride, inData, outWidthStride, outData, w);
+    }
+}
+
+} // namespace tinycv
@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/distancetransform.h"
+#include "tinycv/debug.h"
+
+#include <opencv2/imgproc.hpp>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace {
+
+// one source pixel in a hundred
+static void fillMask(uint8_t *mask, int32_t height, int32_t width)
+{
+    tinycv::debug::randomFill<uint8_t>(mask, width * height, 0, 255);
+    for (int32_t i = 0; i < width * height; ++i) {
+        mask[i] = mask[i] < 3 ? 0 : 255;
+    }
+}
+
+template <tinycv::DistanceType distanceType, int32_t maskSize>
+void BM_DistanceTransform_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<float[]> dst(new float[width * height]);
+    fillMask(src.get(), height, width);
+
+    for (auto _ : state) {
+        tinycv::DistanceTransform(height, width, width, src.get(), width, dst.get(), distanceType, maskSize);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_DistanceTransform_tinycv_x86, tinycv::DIST_L2, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_DistanceTransform_tinycv_x86, tinycv::DIST_L2, 5)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_DistanceTransform_tinycv_x86, tinycv::DIST_L1, 3)->Args({640, 480})->Args({1920, 1080});
+
+#ifdef TINYCV_BENCHMARK_OPENCV
+template <tinycv::DistanceType distanceType, int32_t maskSize>
+static void BM_DistanceTransform_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    fillMask(src.get(), height, width);
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat oMat;
+    for (auto _ : state) {
+        cv::distanceTransform(iMat, oMat, (int)distanceType, maskSize, CV_32F);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_DistanceTransform_opencv_x86, tinycv::DIST_L2, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_DistanceTransform_opencv_x86, tinycv::DIST_L2, 5)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_DistanceTransform_opencv_x86, tinycv::DIST_L1, 3)->Args({640, 480})->Args({1920, 1080});
+
+#endif //! TINYCV_BENCHMARK_OPENCV
+} // namespace
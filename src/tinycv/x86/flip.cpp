@@ -385,6 +385,127 @@ void flip_all_u8(
     }
 }
 
+static void flip_row_u16(
+    const uint16_t *src,
+    int32_t channels,
+    int32_t width,
+    uint16_t *dst)
+{
+    int32_t j = 0;
+    switch (channels) {
+        case 1: {
+            __m128i v_index = _mm_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+            for (; j <= width - 8; j += 8) {
+                __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + (width - j - 8)));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + j), _mm_shuffle_epi8(right, v_index));
+            }
+            break;
+        }
+        case 2:
+            for (; j <= width - 4; j += 4) {
+                __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + (width - j - 4) * 2));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + j * 2), _mm_shuffle_epi32(right, 0x1b));
+            }
+            break;
+        case 3: {
+            //! load two pixels plus two leading elements, so that neither end of the row is overrun;
+            //! the last 4 bytes of every store land on pixel j + 2 which is written afterwards
+            __m128i v_index = _mm_setr_epi8(10, 11, 12, 13, 14, 15, 4, 5, 6, 7, 8, 9, -1, -1, -1, -1);
+            for (; j <= width - 3; j += 2) {
+                __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + (width - j - 2) * 3 - 2));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + j * 3), _mm_shuffle_epi8(right, v_index));
+            }
+            break;
+        }
+        case 4:
+            for (; j <= width - 2; j += 2) {
+                __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + (width - j - 2) * 4));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + j * 4), _mm_shuffle_epi32(right, 0x4e));
+            }
+            break;
+        default:
+            break;
+    }
+    for (; j < width; ++j) {
+        for (int32_t c = 0; c < channels; ++c) {
+            dst[j * channels + c] = src[(width - j - 1) * channels + c];
+        }
+    }
+}
+
+void flip_vertical_u16(
+    const uint16_t *src,
+    int32_t channels,
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    int32_t outWidthStride,
+    uint16_t *dst)
+{
+    if (nullptr == src) {
+        return;
+    }
+    if (nullptr == dst) {
+        return;
+    }
+
+    width *= channels;
+    for (int32_t i = 0; i < height; ++i) {
+        const uint16_t *up_in_ptr = src + i * inWidthStride;
+        uint16_t *down_out_ptr = dst + (height - i - 1) * outWidthStride;
+        int32_t j = 0;
+        for (; j <= width - 8; j += 8) {
+            __m128i up_vec = _mm_loadu_si128(reinterpret_cast<const __m128i *>(up_in_ptr + j));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(down_out_ptr + j), up_vec);
+        }
+        for (; j < width; j++) {
+            down_out_ptr[j] = up_in_ptr[j];
+        }
+    }
+}
+
+void flip_horizontal_u16(
+    const uint16_t *src,
+    int32_t channels,
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    int32_t outWidthStride,
+    uint16_t *dst)
+{
+    if (nullptr == src) {
+        return;
+    }
+    if (nullptr == dst) {
+        return;
+    }
+
+    for (int32_t i = 0; i < height; ++i) {
+        flip_row_u16(src + i * inWidthStride, channels, width, dst + i * outWidthStride);
+    }
+}
+
+void flip_all_u16(
+    const uint16_t *src,
+    int32_t channels,
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    int32_t outWidthStride,
+    uint16_t *dst)
+{
+    if (nullptr == src) {
+        return;
+    }
+    if (nullptr == dst) {
+        return;
+    }
+
+    for (int32_t i = 0; i < height; ++i) {
+        flip_row_u16(src + (height - i - 1) * inWidthStride, channels, width, dst + i * outWidthStride);
+    }
+}
+
 template <>
 void Flip<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t flipCode)
 {
@@ -481,4 +602,164 @@ void Flip<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, cons
     }
 }
 
+template <>
+void Flip<half_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const half_t *inData, int32_t outWidthStride, half_t *outData, int32_t flipCode)
+{
+    const uint16_t *src = reinterpret_cast<const uint16_t *>(inData);
+    uint16_t *dst = reinterpret_cast<uint16_t *>(outData);
+    if (flipCode == 0) {
+        flip_vertical_u16(src, 1, height, width, inWidthStride, outWidthStride, dst);
+    } else if (flipCode > 0) {
+        flip_horizontal_u16(src, 1, height, width, inWidthStride, outWidthStride, dst);
+    } else { //! flipCode < 0
+        flip_all_u16(src, 1, height, width, inWidthStride, outWidthStride, dst);
+    }
+}
+
+template <>
+void Flip<half_t, 2>(int32_t height, int32_t width, int32_t inWidthStride, const half_t *inData, int32_t outWidthStride, half_t *outData, int32_t flipCode)
+{
+    const uint16_t *src = reinterpret_cast<const uint16_t *>(inData);
+    uint16_t *dst = reinterpret_cast<uint16_t *>(outData);
+    if (flipCode == 0) {
+        flip_vertical_u16(src, 2, height, width, inWidthStride, outWidthStride, dst);
+    } else if (flipCode > 0) {
+        flip_horizontal_u16(src, 2, height, width, inWidthStride, outWidthStride, dst);
+    } else { //! flipCode < 0
+        flip_all_u16(src, 2, height, width, inWidthStride, outWidthStride, dst);
+    }
+}
+
+template <>
+void Flip<half_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const half_t *inData, int32_t outWidthStride, half_t *outData, int32_t flipCode)
+{
+    const uint16_t *src = reinterpret_cast<const uint16_t *>(inData);
+    uint16_t *dst = reinterpret_cast<uint16_t *>(outData);
+    if (flipCode == 0) {
+        flip_vertical_u16(src, 3, height, width, inWidthStride, outWidthStride, dst);
+    } else if (flipCode > 0) {
+        flip_horizontal_u16(src, 3, height, width, inWidthStride, outWidthStride, dst);
+    } else { //! flipCode < 0
+        flip_all_u16(src, 3, height, width, inWidthStride, outWidthStride, dst);
+    }
+}
+
+template <>
+void Flip<half_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const half_t *inData, int32_t outWidthStride, half_t *outData, int32_t flipCode)
+{
+    const uint16_t *src = reinterpret_cast<const uint16_t *>(inData);
+    uint16_t *dst = reinterpret_cast<uint16_t *>(outData);
+    if (flipCode == 0) {
+        flip_vertical_u16(src, 4, height, width, inWidthStride, outWidthStride, dst);
+    } else if (flipCode > 0) {
+        flip_horizontal_u16(src, 4, height, width, inWidthStride, outWidthStride, dst);
+    } else { //! flipCode < 0
+        flip_all_u16(src, 4, height, width, inWidthStride, outWidthStride, dst);
+    }
+}
+
+template <>
+void Flip<uint16_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint16_t *inData, int32_t outWidthStride, uint16_t *outData, int32_t flipCode)
+{
+    if (flipCode == 0) {
+        flip_vertical_u16(inData, 1, height, width, inWidthStride, outWidthStride, outData);
+    } else if (flipCode > 0) {
+        flip_horizontal_u16(inData, 1, height, width, inWidthStride, outWidthStride, outData);
+    } else { //! flipCode < 0
+        flip_all_u16(inData, 1, height, width, inWidthStride, outWidthStride, outData);
+    }
+}
+
+template <>
+void Flip<uint16_t, 2>(int32_t height, int32_t width, int32_t inWidthStride, const uint16_t *inData, int32_t outWidthStride, uint16_t *outData, int32_t flipCode)
+{
+    if (flipCode == 0) {
+        flip_vertical_u16(inData, 2, height, width, inWidthStride, outWidthStride, outData);
+    } else if (flipCode > 0) {
+        flip_horizontal_u16(inData, 2, height, width, inWidthStride, outWidthStride, outData);
+    } else { //! flipCode < 0
+        flip_all_u16(inData, 2, height, width, inWidthStride, outWidthStride, outData);
+    }
+}
+
+template <>
+void Flip<uint16_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint16_t *inData, int32_t outWidthStride, uint16_t *outData, int32_t flipCode)
+{
+    if (flipCode == 0) {
+        flip_vertical_u16(inData, 3, height, width, inWidthStride, outWidthStride, outData);
+    } else if (flipCode > 0) {
+        flip_horizontal_u16(inData, 3, height, width, inWidthStride, outWidthStride, outData);
+    } else { //! flipCode < 0
+        flip_all_u16(inData, 3, height, width, inWidthStride, outWidthStride, outData);
+    }
+}
+
+template <>
+void Flip<uint16_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint16_t *inData, int32_t outWidthStride, uint16_t *outData, int32_t flipCode)
+{
+    if (flipCode == 0) {
+        flip_vertical_u16(inData, 4, height, width, inWidthStride, outWidthStride, outData);
+    } else if (flipCode > 0) {
+        flip_horizontal_u16(inData, 4, height, width, inWidthStride, outWidthStride, outData);
+    } else { //! flipCode < 0
+        flip_all_u16(inData, 4, height, width, inWidthStride, outWidthStride, outData);
+    }
+}
+
+template <>
+void Flip<int16_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const int16_t *inData, int32_t outWidthStride, int16_t *outData, int32_t flipCode)
+{
+    const uint16_t *src = reinterpret_cast<const uint16_t *>(inData);
+    uint16_t *dst = reinterpret_cast<uint16_t *>(outData);
+    if (flipCode == 0) {
+        flip_vertical_u16(src, 1, height, width, inWidthStride, outWidthStride, dst);
+    } else if (flipCode > 0) {
+        flip_horizontal_u16(src, 1, height, width, inWidthStride, outWidthStride, dst);
+    } else { //! flipCode < 0
+        flip_all_u16(src, 1, height, width, inWidthStride, outWidthStride, dst);
+    }
+}
+
+template <>
+void Flip<int16_t, 2>(int32_t height, int32_t width, int32_t inWidthStride, const int16_t *inData, int32_t outWidthStride, int16_t *outData, int32_t flipCode)
+{
+    const uint16_t *src = reinterpret_cast<const uint16_t *>(inData);
+    uint16_t *dst = reinterpret_cast<uint16_t *>(outData);
+    if (flipCode == 0) {
+        flip_vertical_u16(src, 2, height, width, inWidthStride, outWidthStride, dst);
+    } else if (flipCode > 0) {
+        flip_horizontal_u16(src, 2, height, width, inWidthStride, outWidthStride, dst);
+    } else { //! flipCode < 0
+        flip_all_u16(src, 2, height, width, inWidthStride, outWidthStride, dst);
+    }
+}
+
+template <>
+void Flip<int16_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const int16_t *inData, int32_t outWidthStride, int16_t *outData, int32_t flipCode)
+{
+    const uint16_t *src = reinterpret_cast<const uint16_t *>(inData);
+    uint16_t *dst = reinterpret_cast<uint16_t *>(outData);
+    if (flipCode == 0) {
+        flip_vertical_u16(src, 3, height, width, inWidthStride, outWidthStride, dst);
+    } else if (flipCode > 0) {
+        flip_horizontal_u16(src, 3, height, width, inWidthStride, outWidthStride, dst);
+    } else { //! flipCode < 0
+        flip_all_u16(src, 3, height, width, inWidthStride, outWidthStride, dst);
+    }
+}
+
+template <>
+void Flip<int16_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const int16_t *inData, int32_t outWidthStride, int16_t *outData, int32_t flipCode)
+{
+    const uint16_t *src = reinterpret_cast<const uint16_t *>(inData);
+    uint16_t *dst = reinterpret_cast<uint16_t *>(outData);
+    if (flipCode == 0) {
+        flip_vertical_u16(src, 4, height, width, inWidthStride, outWidthStride, dst);
+    } else if (flipCode > 0) {
+        flip_horizontal_u16(src, 4, height, width, inWidthStride, outWidthStride, dst);
+    } else { //! flipCode < 0
+        flip_all_u16(src, 4, height, width, inWidthStride, outWidthStride, dst);
+    }
+}
+
 } // namespace tinycv
@@ -0,0 +1,163 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/x86/fma/internal_fma.hpp"
+#include "tinycv/x86/fma/intrinutils_fma.hpp"
+#include "tinycv/types.h"
+
+#include <immintrin.h>
+
+namespace tinycv {
+namespace fma {
+
+static inline __m256i bayer_avg4_u8(__m256i a, __m256i b, __m256i c, __m256i d)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i two = _mm256_set1_epi16(2);
+    __m256i lo = _mm256_add_epi16(_mm256_add_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero)),
+                                  _mm256_add_epi16(_mm256_unpacklo_epi8(c, zero), _mm256_unpacklo_epi8(d, zero)));
+    __m256i hi = _mm256_add_epi16(_mm256_add_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero)),
+                                  _mm256_add_epi16(_mm256_unpackhi_epi8(c, zero), _mm256_unpackhi_epi8(d, zero)));
+    lo = _mm256_srli_epi16(_mm256_add_epi16(lo, two), 2);
+    hi = _mm256_srli_epi16(_mm256_add_epi16(hi, two), 2);
+    // unpack and pack both work per 128-bit lane, so the pixel order is kept
+    return _mm256_packus_epi16(lo, hi);
+}
+
+static inline void bayer2bgr_32px_u8(
+    __m256i u_l,
+    __m256i u_c,
+    __m256i u_r,
+    __m256i c_l,
+    __m256i c_c,
+    __m256i c_r,
+    __m256i d_l,
+    __m256i d_c,
+    __m256i d_r,
+    __m256i mask_c,
+    bool blue_row,
+    bool edge_aware,
+    uint8_t *dst)
+{
+    __m256i h_avg = _mm256_avg_epu8(c_l, c_r);
+    __m256i v_avg = _mm256_avg_epu8(u_c, d_c);
+    __m256i cross = bayer_avg4_u8(c_l, c_r, u_c, d_c);
+    __m256i diag = bayer_avg4_u8(u_l, u_r, d_l, d_r);
+
+    if (edge_aware) {
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i dh = _mm256_or_si256(_mm256_subs_epu8(c_l, c_r), _mm256_subs_epu8(c_r, c_l));
+        __m256i dv = _mm256_or_si256(_mm256_subs_epu8(u_c, d_c), _mm256_subs_epu8(d_c, u_c));
+        __m256i h_less = _mm256_cmpeq_epi8(_mm256_cmpeq_epi8(_mm256_subs_epu8(dv, dh), zero), zero);
+        __m256i v_less = _mm256_cmpeq_epi8(_mm256_cmpeq_epi8(_mm256_subs_epu8(dh, dv), zero), zero);
+        cross = _mm256_blendv_epi8(cross, h_avg, h_less);
+        cross = _mm256_blendv_epi8(cross, v_avg, v_less);
+    }
+
+    __m256i c = _mm256_blendv_epi8(h_avg, c_c, mask_c);
+    __m256i g = _mm256_blendv_epi8(c_c, cross, mask_c);
+    __m256i o = _mm256_blendv_epi8(v_avg, diag, mask_c);
+    if (blue_row) {
+        v_store_interleave(dst, c, g, o);
+    } else {
+        v_store_interleave(dst, o, g, c);
+    }
+}
+
+static inline __m256i bayer_color_mask(bool green_even)
+{
+    const __m256i even_lanes = _mm256_set1_epi16(0x00ff);
+    return green_even ? even_lanes : _mm256_slli_epi16(even_lanes, 8);
+}
+
+int32_t bayer2bgr_twoline_kernel_u8_fma(
+    const uint8_t *in_0,
+    const uint8_t *in_1,
+    const uint8_t *in_2,
+    const uint8_t *in_3,
+    int32_t width,
+    bool green_even,
+    bool blue_row,
+    bool edge_aware,
+    uint8_t *out_0,
+    uint8_t *out_1)
+{
+    __m256i mask_0 = bayer_color_mask(green_even);
+    __m256i mask_1 = bayer_color_mask(!green_even);
+    int32_t x = 1;
+    for (; x <= width - 33; x += 32) {
+        __m256i r0_l = _mm256_loadu_si256((const __m256i *)(in_0 + x - 1));
+        __m256i r0_c = _mm256_loadu_si256((const __m256i *)(in_0 + x));
+        __m256i r0_r = _mm256_loadu_si256((const __m256i *)(in_0 + x + 1));
+        __m256i r1_l = _mm256_loadu_si256((const __m256i *)(in_1 + x - 1));
+        __m256i r1_c = _mm256_loadu_si256((const __m256i *)(in_1 + x));
+        __m256i r1_r = _mm256_loadu_si256((const __m256i *)(in_1 + x + 1));
+        __m256i r2_l = _mm256_loadu_si256((const __m256i *)(in_2 + x - 1));
+        __m256i r2_c = _mm256_loadu_si256((const __m256i *)(in_2 + x));
+        __m256i r2_r = _mm256_loadu_si256((const __m256i *)(in_2 + x + 1));
+        __m256i r3_l = _mm256_loadu_si256((const __m256i *)(in_3 + x - 1));
+        __m256i r3_c = _mm256_loadu_si256((const __m256i *)(in_3 + x));
+        __m256i r3_r = _mm256_loadu_si256((const __m256i *)(in_3 + x + 1));
+
+        bayer2bgr_32px_u8(r0_l, r0_c, r0_r, r1_l, r1_c, r1_r, r2_l, r2_c, r2_r, mask_0, blue_row, edge_aware, out_0 + x * 3);
+        bayer2bgr_32px_u8(r1_l, r1_c, r1_r, r2_l, r2_c, r2_r, r3_l, r3_c, r3_r, mask_1, !blue_row, edge_aware, out_1 + x * 3);
+    }
+    return x;
+}
+
+int32_t bayer2bgr_half_oneline_kernel_u8_fma(
+    const uint8_t *in_0,
+    const uint8_t *in_1,
+    int32_t out_width,
+    bool start_with_green,
+    bool blue_row0,
+    uint8_t *out)
+{
+    const __m256i mask_lo = _mm256_set1_epi16(0x00ff);
+    int32_t j = 0;
+    for (; j <= out_width - 32; j += 32) {
+        __m256i v0_0 = _mm256_loadu_si256((const __m256i *)(in_0 + j * 2));
+        __m256i v0_1 = _mm256_loadu_si256((const __m256i *)(in_0 + j * 2 + 32));
+        __m256i v1_0 = _mm256_loadu_si256((const __m256i *)(in_1 + j * 2));
+        __m256i v1_1 = _mm256_loadu_si256((const __m256i *)(in_1 + j * 2 + 32));
+        // packus interleaves the 128-bit lanes of its two sources, restore the order afterwards
+        __m256i p00 = _mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_and_si256(v0_0, mask_lo), _mm256_and_si256(v0_1, mask_lo)), 0xd8);
+        __m256i p01 = _mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_srli_epi16(v0_0, 8), _mm256_srli_epi16(v0_1, 8)), 0xd8);
+        __m256i p10 = _mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_and_si256(v1_0, mask_lo), _mm256_and_si256(v1_1, mask_lo)), 0xd8);
+        __m256i p11 = _mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_srli_epi16(v1_0, 8), _mm256_srli_epi16(v1_1, 8)), 0xd8);
+
+        __m256i c0, c1, g;
+        if (start_with_green) {
+            g = _mm256_avg_epu8(p00, p11);
+            c0 = p01;
+            c1 = p10;
+        } else {
+            g = _mm256_avg_epu8(p01, p10);
+            c0 = p00;
+            c1 = p11;
+        }
+        if (blue_row0) {
+            v_store_interleave(out + j * 3, c0, g, c1);
+        } else {
+            v_store_interleave(out + j * 3, c1, g, c0);
+        }
+    }
+    return j;
+}
+
+}
+} // namespace tinycv::fma
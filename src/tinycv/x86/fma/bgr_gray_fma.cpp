@@ -1,76 +1,155 @@
-// Licensed to the Apache Software Foundation (ASF) under one
-// or more contributor license agreements.  See the NOTICE file
-// distributed with this work for additional information
-// regarding copyright ownership.  The ASF licenses this file
-// to you under the Apache License, Version 2.0 (the
-// "License"); you may not use this file except in compliance
-// with the License.  You may obtain a copy of the License at
-//
-//   http://www.apache.org/licenses/LICENSE-2.0
-//
-// Unless required by applicable law or agreed to in writing,
-// software distributed under the License is distributed on an
-// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
-// KIND, either express or implied.  See the License for the
-// specific language governing permissions and limitations
-// under the License.
-
-#include "internal_fma.hpp"
-#include "tinycv/x86/avx/intrinutils_avx.hpp"
-#include "tinycv/sys.h"
-
-#include <stdint.h>
-#include <immintrin.h>
-#include <vector>
-#include <algorithm>
-#include <cstring>
-
-namespace tinycv {
-namespace fma {
-
-void BGR2GRAY(
-    int32_t height,
-    int32_t width,
-    int32_t inWidthStride,
-    const float* in,
-    int32_t outWidthStride,
-    float* out,
-    bool reverse_channel)
-{
-    float r_coeff = 0.299f;
-    float g_coeff = 0.587f;
-    float b_coeff = 0.114f;
-
-    if (reverse_channel) {
-        std::swap(r_coeff, b_coeff);
-    }
-    __m256 v_cb = _mm256_set1_ps(b_coeff);
-    __m256 v_cg = _mm256_set1_ps(g_coeff);
-    __m256 v_cr = _mm256_set1_ps(r_coeff);
-
-    for (int32_t h = 0; h < height; ++h) {
-        const float* base_in = in + h * inWidthStride;
-        float* base_out = out + h * outWidthStride;
-        int32_t w = 0;
-        for (; w <= width - 16; w += 16) {
-            __m256 v_gray0, vr0, vb0, vg0;
-            __m256 v_gray1, vr1, vb1, vg1;
-            _mm256_deinterleave_ps(base_in + w * 3, vb0, vg0, vr0);
-            _mm256_deinterleave_ps(base_in + w * 3 + 24, vb1, vg1, vr1);
-            v_gray0 = _mm256_mul_ps(vr0, v_cr);
-            v_gray0 = _mm256_fmadd_ps(vg0, v_cg, v_gray0);
-            v_gray0 = _mm256_fmadd_ps(vb0, v_cb, v_gray0);
-            v_gray1 = _mm256_mul_ps(vr1, v_cr);
-            v_gray1 = _mm256_fmadd_ps(vg1, v_cg, v_gray1);
-            v_gray1 = _mm256_fmadd_ps(vb1, v_cb, v_gray1);
-            _mm256_storeu_ps(base_out + w, v_gray0);
-            _mm256_storeu_ps(base_out + w + 8, v_gray1);
-        }
-        for (; w < width; w++) {
-            base_out[w] = base_in[w * 3] * b_coeff + base_in[w * 3 + 1] * g_coeff + base_in[w * 3 + 2] * r_coeff;
-        }
-    }
-}
-
-}
-} // namespace tinycv::fma
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "internal_fma.hpp"
+#include "tinycv/x86/avx/intrinutils_avx.hpp"
+#include "tinycv/sys.h"
+
+#include <stdint.h>
+#include <immintrin.h>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+namespace tinycv {
+namespace fma {
+
+void BGR2GRAY(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const float* in,
+    int32_t outWidthStride,
+    float* out,
+    bool reverse_channel)
+{
+    float r_coeff = 0.299f;
+    float g_coeff = 0.587f;
+    float b_coeff = 0.114f;
+
+    if (reverse_channel) {
+        std::swap(r_coeff, b_coeff);
+    }
+    __m256 v_cb = _mm256_set1_ps(b_coeff);
+    __m256 v_cg = _mm256_set1_ps(g_coeff);
+    __m256 v_cr = _mm256_set1_ps(r_coeff);
+
+    for (int32_t h = 0; h < height; ++h) {
+        const float* base_in = in + h * inWidthStride;
+        float* base_out = out + h * outWidthStride;
+        int32_t w = 0;
+        for (; w <= width - 16; w += 16) {
+            __m256 v_gray0, vr0, vb0, vg0;
+            __m256 v_gray1, vr1, vb1, vg1;
+            _mm256_deinterleave_ps(base_in + w * 3, vb0, vg0, vr0);
+            _mm256_deinterleave_ps(base_in + w * 3 + 24, vb1, vg1, vr1);
+            v_gray0 = _mm256_mul_ps(vr0, v_cr);
+            v_gray0 = _mm256_fmadd_ps(vg0, v_cg, v_gray0);
+            v_gray0 = _mm256_fmadd_ps(vb0, v_cb, v_gray0);
+            v_gray1 = _mm256_mul_ps(vr1, v_cr);
+            v_gray1 = _mm256_fmadd_ps(vg1, v_cg, v_gray1);
+            v_gray1 = _mm256_fmadd_ps(vb1, v_cb, v_gray1);
+            _mm256_storeu_ps(base_out + w, v_gray0);
+            _mm256_storeu_ps(base_out + w + 8, v_gray1);
+        }
+        for (; w < width; w++) {
+            base_out[w] = base_in[w * 3] * b_coeff + base_in[w * 3 + 1] * g_coeff + base_in[w * 3 + 2] * r_coeff;
+        }
+    }
+}
+
+static inline void v_load_deinterleave_u16(const uint16_t* ptr, __m128i& a, __m128i& b, __m128i& c)
+{
+    __m128i v0 = _mm_loadu_si128((const __m128i*)(ptr + 0));
+    __m128i v1 = _mm_loadu_si128((const __m128i*)(ptr + 8));
+    __m128i v2 = _mm_loadu_si128((const __m128i*)(ptr + 16));
+    a = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(v0, _mm_setr_epi8(0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+                                  _mm_shuffle_epi8(v1, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15, -1, -1, -1, -1))),
+                     _mm_shuffle_epi8(v2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 10, 11)));
+    b = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(v0, _mm_setr_epi8(2, 3, 8, 9, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+                                  _mm_shuffle_epi8(v1, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 4, 5, 10, 11, -1, -1, -1, -1, -1, -1))),
+                     _mm_shuffle_epi8(v2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 6, 7, 12, 13)));
+    c = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(v0, _mm_setr_epi8(4, 5, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+                                  _mm_shuffle_epi8(v1, _mm_setr_epi8(-1, -1, -1, -1, 0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1))),
+                     _mm_shuffle_epi8(v2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15)));
+}
+
+static inline void v_load_deinterleave_u16(const uint16_t* ptr, __m128i& a, __m128i& b, __m128i& c, __m128i& d)
+{
+    // gather each 2-pixel register as (c0 c0 c1 c1 c2 c2 c3 c3), then transpose the 32-bit pairs
+    const __m128i v_index = _mm_setr_epi8(0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+    __m128i v0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(ptr + 0)), v_index);
+    __m128i v1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(ptr + 8)), v_index);
+    __m128i v2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(ptr + 16)), v_index);
+    __m128i v3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(ptr + 24)), v_index);
+    __m128i t0 = _mm_unpacklo_epi32(v0, v1);
+    __m128i t1 = _mm_unpackhi_epi32(v0, v1);
+    __m128i t2 = _mm_unpacklo_epi32(v2, v3);
+    __m128i t3 = _mm_unpackhi_epi32(v2, v3);
+    a = _mm_unpacklo_epi64(t0, t2);
+    b = _mm_unpackhi_epi64(t0, t2);
+    c = _mm_unpacklo_epi64(t1, t3);
+    d = _mm_unpackhi_epi64(t1, t3);
+}
+
+void BGR2GRAY(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t* in,
+    int32_t outWidthStride,
+    half_t* out,
+    int32_t srccn,
+    bool reverse_channel)
+{
+    float r_coeff = 0.299f;
+    float g_coeff = 0.587f;
+    float b_coeff = 0.114f;
+
+    if (reverse_channel) {
+        std::swap(r_coeff, b_coeff);
+    }
+    __m256 v_cb = _mm256_set1_ps(b_coeff);
+    __m256 v_cg = _mm256_set1_ps(g_coeff);
+    __m256 v_cr = _mm256_set1_ps(r_coeff);
+
+    for (int32_t h = 0; h < height; ++h) {
+        const uint16_t* base_in = (const uint16_t*)(in + h * inWidthStride);
+        uint16_t* base_out = (uint16_t*)(out + h * outWidthStride);
+        int32_t w = 0;
+        for (; w <= width - 8; w += 8) {
+            __m128i vb, vg, vr, va;
+            if (srccn == 3) {
+                v_load_deinterleave_u16(base_in + w * 3, vb, vg, vr);
+            } else {
+                v_load_deinterleave_u16(base_in + w * 4, vb, vg, vr, va);
+            }
+            __m256 v_gray = _mm256_mul_ps(_mm256_cvtph_ps(vr), v_cr);
+            v_gray = _mm256_fmadd_ps(_mm256_cvtph_ps(vg), v_cg, v_gray);
+            v_gray = _mm256_fmadd_ps(_mm256_cvtph_ps(vb), v_cb, v_gray);
+            _mm_storeu_si128((__m128i*)(base_out + w), _mm256_cvtps_ph(v_gray, _MM_FROUND_TO_NEAREST_INT));
+        }
+        for (; w < width; w++) {
+            const uint16_t* px = base_in + w * srccn;
+            float gray = _cvtsh_ss(px[0]) * b_coeff + _cvtsh_ss(px[1]) * g_coeff + _cvtsh_ss(px[2]) * r_coeff;
+            base_out[w] = _cvtss_sh(gray, _MM_FROUND_TO_NEAREST_INT);
+        }
+    }
+}
+
+}
+} // namespace tinycv::fma
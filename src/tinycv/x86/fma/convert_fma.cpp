@@ -0,0 +1,288 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/x86/fma/internal_fma.hpp"
+#include "tinycv/x86/fma/intrinutils_fma.hpp"
+#include "tinycv/x86/avx/intrinutils_avx.hpp"
+#include "tinycv/types.h"
+
+#include <immintrin.h>
+#include <algorithm>
+
+namespace tinycv {
+namespace fma {
+
+static inline __m256 cvt_u8_ps_lo(__m128i v)
+{
+    return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v));
+}
+
+static inline __m256 cvt_u8_ps_hi(__m128i v)
+{
+    return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(v, 8)));
+}
+
+// a, b, c and d are 8 pixels of every output channel, plane_stride is 0 for interleaved output
+static inline void normalize_store_c1(__m256 a, const __m256 *scale, const __m256 *bias, float *dst)
+{
+    _mm256_storeu_ps(dst, _mm256_add_ps(_mm256_mul_ps(a, scale[0]), bias[0]));
+}
+
+static inline void normalize_store_c3(__m256 a, __m256 b, __m256 c, const __m256 *scale, const __m256 *bias, int32_t plane_stride, float *dst)
+{
+    a = _mm256_add_ps(_mm256_mul_ps(a, scale[0]), bias[0]);
+    b = _mm256_add_ps(_mm256_mul_ps(b, scale[1]), bias[1]);
+    c = _mm256_add_ps(_mm256_mul_ps(c, scale[2]), bias[2]);
+    if (plane_stride) {
+        _mm256_storeu_ps(dst, a);
+        _mm256_storeu_ps(dst + plane_stride, b);
+        _mm256_storeu_ps(dst + 2 * plane_stride, c);
+    } else {
+        _mm256_interleave1_ps(dst, a, b, c);
+    }
+}
+
+static inline void normalize_store_c4(__m256 a, __m256 b, __m256 c, __m256 d, const __m256 *scale, const __m256 *bias, int32_t plane_stride, float *dst)
+{
+    a = _mm256_add_ps(_mm256_mul_ps(a, scale[0]), bias[0]);
+    b = _mm256_add_ps(_mm256_mul_ps(b, scale[1]), bias[1]);
+    c = _mm256_add_ps(_mm256_mul_ps(c, scale[2]), bias[2]);
+    d = _mm256_add_ps(_mm256_mul_ps(d, scale[3]), bias[3]);
+    if (plane_stride) {
+        _mm256_storeu_ps(dst, a);
+        _mm256_storeu_ps(dst + plane_stride, b);
+        _mm256_storeu_ps(dst + 2 * plane_stride, c);
+        _mm256_storeu_ps(dst + 3 * plane_stride, d);
+    } else {
+        _mm256_interleave1_ps(dst, a, b, c, d);
+    }
+}
+
+int32_t convert_normalize_row_fma(
+    const uint8_t *src,
+    int32_t width,
+    int32_t channels,
+    const float *scale,
+    const float *bias,
+    bool swap_rb,
+    int32_t plane_stride,
+    float *dst)
+{
+    __m256 v_scale[4], v_bias[4];
+    for (int32_t c = 0; c < channels; ++c) {
+        v_scale[c] = _mm256_set1_ps(scale[c]);
+        v_bias[c] = _mm256_set1_ps(bias[c]);
+    }
+    // planar output advances by one element per pixel, interleaved output by one pixel
+    int32_t dst_step = plane_stride ? 1 : channels;
+
+    int32_t i = 0;
+    if (channels == 1) {
+        for (; i <= width - 32; i += 32) {
+            __m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+            __m128i v_lo = _mm256_castsi256_si128(v), v_hi = _mm256_extracti128_si256(v, 1);
+            normalize_store_c1(cvt_u8_ps_lo(v_lo), v_scale, v_bias, dst + i);
+            normalize_store_c1(cvt_u8_ps_hi(v_lo), v_scale, v_bias, dst + i + 8);
+            normalize_store_c1(cvt_u8_ps_lo(v_hi), v_scale, v_bias, dst + i + 16);
+            normalize_store_c1(cvt_u8_ps_hi(v_hi), v_scale, v_bias, dst + i + 24);
+        }
+    } else if (channels == 3) {
+        for (; i <= width - 32; i += 32) {
+            __m256i v_c[3];
+            v_load_deinterleave(src + i * 3, v_c[0], v_c[1], v_c[2]);
+            if (swap_rb) {
+                std::swap(v_c[0], v_c[2]);
+            }
+            __m128i lo[3], hi[3];
+            for (int32_t c = 0; c < 3; ++c) {
+                lo[c] = _mm256_castsi256_si128(v_c[c]);
+                hi[c] = _mm256_extracti128_si256(v_c[c], 1);
+            }
+            normalize_store_c3(cvt_u8_ps_lo(lo[0]), cvt_u8_ps_lo(lo[1]), cvt_u8_ps_lo(lo[2]), v_scale, v_bias, plane_stride, dst + i * dst_step);
+            normalize_store_c3(cvt_u8_ps_hi(lo[0]), cvt_u8_ps_hi(lo[1]), cvt_u8_ps_hi(lo[2]), v_scale, v_bias, plane_stride, dst + (i + 8) * dst_step);
+            normalize_store_c3(cvt_u8_ps_lo(hi[0]), cvt_u8_ps_lo(hi[1]), cvt_u8_ps_lo(hi[2]), v_scale, v_bias, plane_stride, dst + (i + 16) * dst_step);
+            normalize_store_c3(cvt_u8_ps_hi(hi[0]), cvt_u8_ps_hi(hi[1]), cvt_u8_ps_hi(hi[2]), v_scale, v_bias, plane_stride, dst + (i + 24) * dst_step);
+        }
+    } else if (channels == 4) {
+        for (; i <= width - 32; i += 32) {
+            __m256i v_c[4];
+            v_load_deinterleave(src + i * 4, v_c[0], v_c[1], v_c[2], v_c[3]);
+            if (swap_rb) {
+                std::swap(v_c[0], v_c[2]);
+            }
+            __m128i lo[4], hi[4];
+            for (int32_t c = 0; c < 4; ++c) {
+                lo[c] = _mm256_castsi256_si128(v_c[c]);
+                hi[c] = _mm256_extracti128_si256(v_c[c], 1);
+            }
+            normalize_store_c4(cvt_u8_ps_lo(lo[0]), cvt_u8_ps_lo(lo[1]), cvt_u8_ps_lo(lo[2]), cvt_u8_ps_lo(lo[3]), v_scale, v_bias, plane_stride, dst + i * dst_step);
+            normalize_store_c4(cvt_u8_ps_hi(lo[0]), cvt_u8_ps_hi(lo[1]), cvt_u8_ps_hi(lo[2]), cvt_u8_ps_hi(lo[3]), v_scale, v_bias, plane_stride, dst + (i + 8) * dst_step);
+            normalize_store_c4(cvt_u8_ps_lo(hi[0]), cvt_u8_ps_lo(hi[1]), cvt_u8_ps_lo(hi[2]), cvt_u8_ps_lo(hi[3]), v_scale, v_bias, plane_stride, dst + (i + 16) * dst_step);
+            normalize_store_c4(cvt_u8_ps_hi(hi[0]), cvt_u8_ps_hi(hi[1]), cvt_u8_ps_hi(hi[2]), cvt_u8_ps_hi(hi[3]), v_scale, v_bias, plane_stride, dst + (i + 24) * dst_step);
+        }
+    }
+    return i;
+}
+
+int32_t convert_normalize_row_fma(
+    const float *src,
+    int32_t width,
+    int32_t channels,
+    const float *scale,
+    const float *bias,
+    bool swap_rb,
+    int32_t plane_stride,
+    float *dst)
+{
+    __m256 v_scale[4], v_bias[4];
+    for (int32_t c = 0; c < channels; ++c) {
+        v_scale[c] = _mm256_set1_ps(scale[c]);
+        v_bias[c] = _mm256_set1_ps(bias[c]);
+    }
+    int32_t dst_step = plane_stride ? 1 : channels;
+
+    int32_t i = 0;
+    if (channels == 1) {
+        for (; i <= width - 8; i += 8) {
+            normalize_store_c1(_mm256_loadu_ps(src + i), v_scale, v_bias, dst + i);
+        }
+    } else if (channels == 3) {
+        for (; i <= width - 8; i += 8) {
+            __m256 v_c[3];
+            _mm256_deinterleave_ps(src + i * 3, v_c[0], v_c[1], v_c[2]);
+            if (swap_rb) {
+                std::swap(v_c[0], v_c[2]);
+            }
+            normalize_store_c3(v_c[0], v_c[1], v_c[2], v_scale, v_bias, plane_stride, dst + i * dst_step);
+        }
+    } else if (channels == 4) {
+        for (; i <= width - 8; i += 8) {
+            __m256 v_c[4];
+            v_load_deinterleave(src + i * 4, v_c[0], v_c[1], v_c[2], v_c[3]);
+            if (swap_rb) {
+                std::swap(v_c[0], v_c[2]);
+            }
+            normalize_store_c4(v_c[0], v_c[1], v_c[2], v_c[3], v_scale, v_bias, plane_stride, dst + i * dst_step);
+        }
+    }
+    return i;
+}
+
+// loads 16 elements as two float vectors and stores them back with saturation
+template <typename T>
+struct convert_to_traits;
+
+template <>
+struct convert_to_traits<uint8_t> {
+    static inline void load(const uint8_t *src, __m256 &lo, __m256 &hi)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)src);
+        lo = cvt_u8_ps_lo(v);
+        hi = cvt_u8_ps_hi(v);
+    }
+    static inline void store(uint8_t *dst, __m256 lo, __m256 hi)
+    {
+        const __m256 v_min = _mm256_setzero_ps(), v_max = _mm256_set1_ps(255.f);
+        __m256i v_lo = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(lo, v_min), v_max));
+        __m256i v_hi = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(hi, v_min), v_max));
+        __m256i v = _mm256_permute4x64_epi64(_mm256_packs_epi32(v_lo, v_hi), 0xD8);
+        _mm_storeu_si128((__m128i *)dst, _mm_packus_epi16(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1)));
+    }
+};
+
+template <>
+struct convert_to_traits<int16_t> {
+    static inline void load(const int16_t *src, __m256 &lo, __m256 &hi)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)src);
+        lo = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(v)));
+        hi = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(v, 1)));
+    }
+    static inline void store(int16_t *dst, __m256 lo, __m256 hi)
+    {
+        const __m256 v_min = _mm256_set1_ps(-32768.f), v_max = _mm256_set1_ps(32767.f);
+        __m256i v_lo = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(lo, v_min), v_max));
+        __m256i v_hi = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(hi, v_min), v_max));
+        _mm256_storeu_si256((__m256i *)dst, _mm256_permute4x64_epi64(_mm256_packs_epi32(v_lo, v_hi), 0xD8));
+    }
+};
+
+template <>
+struct convert_to_traits<uint16_t> {
+    static inline void load(const uint16_t *src, __m256 &lo, __m256 &hi)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)src);
+        lo = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(v)));
+        hi = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(v, 1)));
+    }
+    static inline void store(uint16_t *dst, __m256 lo, __m256 hi)
+    {
+        const __m256 v_min = _mm256_setzero_ps(), v_max = _mm256_set1_ps(65535.f);
+        __m256i v_lo = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(lo, v_min), v_max));
+        __m256i v_hi = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(hi, v_min), v_max));
+        _mm256_storeu_si256((__m256i *)dst, _mm256_permute4x64_epi64(_mm256_packus_epi32(v_lo, v_hi), 0xD8));
+    }
+};
+
+template <>
+struct convert_to_traits<float> {
+    static inline void load(const float *src, __m256 &lo, __m256 &hi)
+    {
+        lo = _mm256_loadu_ps(src);
+        hi = _mm256_loadu_ps(src + 8);
+    }
+    static inline void store(float *dst, __m256 lo, __m256 hi)
+    {
+        _mm256_storeu_ps(dst, lo);
+        _mm256_storeu_ps(dst + 8, hi);
+    }
+};
+
+template <typename TSrc, typename TDst>
+int32_t convert_to_row_fma(const TSrc *src, int32_t n, float alpha, float beta, TDst *dst)
+{
+    __m256 v_alpha = _mm256_set1_ps(alpha), v_beta = _mm256_set1_ps(beta);
+    int32_t i = 0;
+    for (; i <= n - 16; i += 16) {
+        __m256 lo, hi;
+        convert_to_traits<TSrc>::load(src + i, lo, hi);
+        lo = _mm256_add_ps(_mm256_mul_ps(lo, v_alpha), v_beta);
+        hi = _mm256_add_ps(_mm256_mul_ps(hi, v_alpha), v_beta);
+        convert_to_traits<TDst>::store(dst + i, lo, hi);
+    }
+    return i;
+}
+
+template int32_t convert_to_row_fma<uint8_t, uint8_t>(const uint8_t *src, int32_t n, float alpha, float beta, uint8_t *dst);
+template int32_t convert_to_row_fma<uint8_t, int16_t>(const uint8_t *src, int32_t n, float alpha, float beta, int16_t *dst);
+template int32_t convert_to_row_fma<uint8_t, uint16_t>(const uint8_t *src, int32_t n, float alpha, float beta, uint16_t *dst);
+template int32_t convert_to_row_fma<uint8_t, float>(const uint8_t *src, int32_t n, float alpha, float beta, float *dst);
+template int32_t convert_to_row_fma<int16_t, uint8_t>(const int16_t *src, int32_t n, float alpha, float beta, uint8_t *dst);
+template int32_t convert_to_row_fma<int16_t, int16_t>(const int16_t *src, int32_t n, float alpha, float beta, int16_t *dst);
+template int32_t convert_to_row_fma<int16_t, uint16_t>(const int16_t *src, int32_t n, float alpha, float beta, uint16_t *dst);
+template int32_t convert_to_row_fma<int16_t, float>(const int16_t *src, int32_t n, float alpha, float beta, float *dst);
+template int32_t convert_to_row_fma<uint16_t, uint8_t>(const uint16_t *src, int32_t n, float alpha, float beta, uint8_t *dst);
+template int32_t convert_to_row_fma<uint16_t, int16_t>(const uint16_t *src, int32_t n, float alpha, float beta, int16_t *dst);
+template int32_t convert_to_row_fma<uint16_t, uint16_t>(const uint16_t *src, int32_t n, float alpha, float beta, uint16_t *dst);
+template int32_t convert_to_row_fma<uint16_t, float>(const uint16_t *src, int32_t n, float alpha, float beta, float *dst);
+template int32_t convert_to_row_fma<float, uint8_t>(const float *src, int32_t n, float alpha, float beta, uint8_t *dst);
+template int32_t convert_to_row_fma<float, int16_t>(const float *src, int32_t n, float alpha, float beta, int16_t *dst);
+template int32_t convert_to_row_fma<float, uint16_t>(const float *src, int32_t n, float alpha, float beta, uint16_t *dst);
+template int32_t convert_to_row_fma<float, float>(const float *src, int32_t n, float alpha, float beta, float *dst);
+
+}
+} // namespace tinycv::fma
@@ -35,6 +35,21 @@ int32_t resize_linear_twoline_fp32_fma(
     float *row_1,
     float *out_data);
 
+int32_t resize_linear_w_oneline_fp16_fma(
+    int32_t max_length,
+    int32_t channels,
+    const half_t *in_data,
+    const int32_t *w_offset,
+    const float *w_coeff,
+    float *row);
+
+int32_t resize_linear_h_fp16_fma(
+    int32_t max_length,
+    const float *row_0,
+    const float *row_1,
+    float h_coeff,
+    half_t *out_data);
+
 int32_t resize_linear_w_oneline_c1_u8_fma(
     int32_t in_width,
     const uint8_t *in_data,
@@ -44,6 +59,71 @@ int32_t resize_linear_w_oneline_c1_u8_fma(
     int16_t COEFF_SUM,
     int32_t *row);
 
+// horizontal cubic pass over the elements from begin on, x_coeff holds 4 taps with a stride of n
+int32_t resize_cubic_w_fma(
+    const uint8_t *src,
+    int32_t src_len,
+    int32_t channels,
+    const int32_t *x_ofs,
+    const int16_t *x_coeff,
+    int32_t n,
+    int32_t begin,
+    int32_t *row);
+
+int32_t resize_cubic_w_fma(
+    const float *src,
+    int32_t src_len,
+    int32_t channels,
+    const int32_t *x_ofs,
+    const float *x_coeff,
+    int32_t n,
+    int32_t begin,
+    float *row);
+
+int32_t resize_cubic_h_fma(
+    const int32_t *const *rows,
+    const int16_t *y_coeff,
+    int32_t n,
+    uint8_t *dst);
+
+int32_t resize_cubic_h_fma(
+    const float *const *rows,
+    const float *y_coeff,
+    int32_t n,
+    float *dst);
+
+// horizontal Lanczos pass of a fp32 row padded by 8 elements, tables follow ResizeFilterTable
+void resize_lanczos_w_fma(
+    const float *src,
+    int32_t channels,
+    const int32_t *start,
+    const float *weights,
+    int32_t ksize,
+    int32_t ksize_pad,
+    int32_t out_width,
+    float *row);
+
+int32_t resize_lanczos_h_fma(
+    const float *const *rows,
+    const float *coeff,
+    int32_t ksize,
+    int32_t n,
+    float *dst);
+
+int32_t resize_lanczos_h_fma(
+    const float *const *rows,
+    const float *coeff,
+    int32_t ksize,
+    int32_t n,
+    uint8_t *dst);
+
+int32_t resize_lanczos_h_fma(
+    const uint8_t *const *rows,
+    const float *coeff,
+    int32_t ksize,
+    int32_t n,
+    float *dst);
+
 void resize_linear_kernel_c1_shrink_u8_fma(
     int32_t in_height,
     int32_t in_width,
@@ -158,6 +238,36 @@ void BGR2GRAY(
     float *outData,
     bool reverse_channel);
 
+void BGR2GRAY(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outWidthStride,
+    half_t *outData,
+    int32_t srccn,
+    bool reverse_channel);
+
+int32_t bayer2bgr_twoline_kernel_u8_fma(
+    const uint8_t *in_0,
+    const uint8_t *in_1,
+    const uint8_t *in_2,
+    const uint8_t *in_3,
+    int32_t width,
+    bool green_even,
+    bool blue_row,
+    bool edge_aware,
+    uint8_t *out_0,
+    uint8_t *out_1);
+
+int32_t bayer2bgr_half_oneline_kernel_u8_fma(
+    const uint8_t *in_0,
+    const uint8_t *in_1,
+    int32_t out_width,
+    bool start_with_green,
+    bool blue_row0,
+    uint8_t *out);
+
 template <int32_t dstcn, int32_t blueIdx, bool isUV>
 void nv_2_rgb(
     int32_t height,
@@ -294,6 +404,35 @@ void convolution_f_r(
     int32_t srcWidthStride,
     BorderType border_type);
 
+// converts one row with dst = src * scale + bias, returns the number of pixels processed
+int32_t convert_normalize_row_fma(
+    const uint8_t *src,
+    int32_t width,
+    int32_t channels,
+    const float *scale,
+    const float *bias,
+    bool swap_rb,
+    int32_t plane_stride,
+    float *dst);
+
+int32_t convert_normalize_row_fma(
+    const float *src,
+    int32_t width,
+    int32_t channels,
+    const float *scale,
+    const float *bias,
+    bool swap_rb,
+    int32_t plane_stride,
+    float *dst);
+
+// converts n elements with dst = saturate(src * alpha + beta), returns the number of elements processed
+template <typename TSrc, typename TDst>
+int32_t convert_to_row_fma(const TSrc *src, int32_t n, float alpha, float beta, TDst *dst);
+
+// thresholds n elements with a ThresholdType without the Otsu flag, returns the number of elements processed
+template <typename T>
+int32_t threshold_row_fma(const T *src, int32_t n, T thresh, T maxval, int32_t type, T *dst);
+
 template <typename T, int32_t nc>
 void mergeSOA2AOS(
     int32_t height,
@@ -108,6 +108,29 @@ inline void v_load_deinterleave(const float *ptr, __m256 &a, __m256 &b, __m256 &
     d = _mm256_castsi256_ps(a0);
 }
 
+inline void v_store_interleave(uint8_t *ptr, const __m256i &a, const __m256i &b, const __m256i &c)
+{
+    const __m256i
+        sh_a0 = _mm256_setr_epi8(0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5),
+        sh_b0 = _mm256_setr_epi8(-1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1),
+        sh_c0 = _mm256_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1),
+        sh_a1 = _mm256_setr_epi8(-1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1),
+        sh_b1 = _mm256_setr_epi8(5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10),
+        sh_c1 = _mm256_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, -1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1),
+        sh_a2 = _mm256_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1),
+        sh_b2 = _mm256_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1),
+        sh_c2 = _mm256_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, 10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15);
+
+    // every lane holds 16 interleaved pixels split into three 16-byte blocks
+    __m256i s0 = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(a, sh_a0), _mm256_shuffle_epi8(b, sh_b0)), _mm256_shuffle_epi8(c, sh_c0));
+    __m256i s1 = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(a, sh_a1), _mm256_shuffle_epi8(b, sh_b1)), _mm256_shuffle_epi8(c, sh_c1));
+    __m256i s2 = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(a, sh_a2), _mm256_shuffle_epi8(b, sh_b2)), _mm256_shuffle_epi8(c, sh_c2));
+
+    _mm256_storeu_si256((__m256i *)ptr, _mm256_permute2x128_si256(s0, s1, 0 + 2 * 16));
+    _mm256_storeu_si256((__m256i *)(ptr + 32), _mm256_permute2x128_si256(s2, s0, 0 + 3 * 16));
+    _mm256_storeu_si256((__m256i *)(ptr + 64), _mm256_permute2x128_si256(s1, s2, 1 + 3 * 16));
+}
+
 }
 } // namespace tinycv::fma
 
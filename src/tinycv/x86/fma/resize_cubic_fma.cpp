@@ -0,0 +1,128 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/x86/fma/internal_fma.hpp"
+
+#include <immintrin.h>
+
+namespace tinycv {
+namespace fma {
+
+int32_t resize_cubic_w_fma(
+    const uint8_t *src,
+    int32_t src_len,
+    int32_t channels,
+    const int32_t *x_ofs,
+    const int16_t *x_coeff,
+    int32_t n,
+    int32_t begin,
+    int32_t *row)
+{
+    __m256i m_mask = _mm256_set1_epi32(0xff);
+    int32_t i = begin;
+    for (; i <= n - 8; i += 8) {
+        // every gather reads 4 bytes, the last one must stay inside the source row
+        if (x_ofs[i + 7] + 2 * channels + 4 > src_len) {
+            break;
+        }
+        __m256i m_idx = _mm256_loadu_si256((const __m256i *)(x_ofs + i));
+        __m256i m_sum = _mm256_setzero_si256();
+        for (int32_t k = 0; k < 4; ++k) {
+            __m256i m_src = _mm256_and_si256(_mm256_i32gather_epi32((const int *)(src + (k - 1) * channels), m_idx, 1), m_mask);
+            __m256i m_coeff = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(x_coeff + k * n + i)));
+            m_sum = _mm256_add_epi32(m_sum, _mm256_mullo_epi32(m_src, m_coeff));
+        }
+        _mm256_storeu_si256((__m256i *)(row + i), m_sum);
+    }
+    return i;
+}
+
+int32_t resize_cubic_w_fma(
+    const float *src,
+    int32_t src_len,
+    int32_t channels,
+    const int32_t *x_ofs,
+    const float *x_coeff,
+    int32_t n,
+    int32_t begin,
+    float *row)
+{
+    int32_t i = begin;
+    for (; i <= n - 8; i += 8) {
+        if (x_ofs[i + 7] + 2 * channels >= src_len) {
+            break;
+        }
+        __m256i m_idx = _mm256_loadu_si256((const __m256i *)(x_ofs + i));
+        __m256 m_sum = _mm256_mul_ps(_mm256_i32gather_ps(src - channels, m_idx, 4), _mm256_loadu_ps(x_coeff + i));
+        for (int32_t k = 1; k < 4; ++k) {
+            m_sum = _mm256_fmadd_ps(_mm256_i32gather_ps(src + (k - 1) * channels, m_idx, 4), _mm256_loadu_ps(x_coeff + k * n + i), m_sum);
+        }
+        _mm256_storeu_ps(row + i, m_sum);
+    }
+    return i;
+}
+
+int32_t resize_cubic_h_fma(
+    const int32_t *const *rows,
+    const int16_t *y_coeff,
+    int32_t n,
+    uint8_t *dst)
+{
+    __m256i m_coeff[4];
+    for (int32_t k = 0; k < 4; ++k) {
+        m_coeff[k] = _mm256_set1_epi32(y_coeff[k]);
+    }
+    __m256i m_delta = _mm256_set1_epi32(1 << 21);
+    int32_t i = 0;
+    for (; i <= n - 16; i += 16) {
+        __m256i m_lo = m_delta, m_hi = m_delta;
+        for (int32_t k = 0; k < 4; ++k) {
+            m_lo = _mm256_add_epi32(m_lo, _mm256_mullo_epi32(_mm256_loadu_si256((const __m256i *)(rows[k] + i)), m_coeff[k]));
+            m_hi = _mm256_add_epi32(m_hi, _mm256_mullo_epi32(_mm256_loadu_si256((const __m256i *)(rows[k] + i + 8)), m_coeff[k]));
+        }
+        // both passes are scaled by 2^11
+        m_lo = _mm256_srai_epi32(m_lo, 22);
+        m_hi = _mm256_srai_epi32(m_hi, 22);
+        __m256i m_dst = _mm256_permute4x64_epi64(_mm256_packs_epi32(m_lo, m_hi), 0xD8);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(_mm256_castsi256_si128(m_dst), _mm256_extracti128_si256(m_dst, 1)));
+    }
+    return i;
+}
+
+int32_t resize_cubic_h_fma(
+    const float *const *rows,
+    const float *y_coeff,
+    int32_t n,
+    float *dst)
+{
+    __m256 m_coeff[4];
+    for (int32_t k = 0; k < 4; ++k) {
+        m_coeff[k] = _mm256_set1_ps(y_coeff[k]);
+    }
+    int32_t i = 0;
+    for (; i <= n - 8; i += 8) {
+        __m256 m_dst = _mm256_mul_ps(_mm256_loadu_ps(rows[0] + i), m_coeff[0]);
+        m_dst = _mm256_fmadd_ps(_mm256_loadu_ps(rows[1] + i), m_coeff[1], m_dst);
+        m_dst = _mm256_fmadd_ps(_mm256_loadu_ps(rows[2] + i), m_coeff[2], m_dst);
+        m_dst = _mm256_fmadd_ps(_mm256_loadu_ps(rows[3] + i), m_coeff[3], m_dst);
+        _mm256_storeu_ps(dst + i, m_dst);
+    }
+    return i;
+}
+
+}
+} // namespace tinycv::fma
@@ -0,0 +1,231 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/x86/fma/internal_fma.hpp"
+
+#include <immintrin.h>
+
+namespace tinycv {
+namespace fma {
+
+static inline float hsum_ps(__m256 v)
+{
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s        = _mm_hadd_ps(s, s);
+    s        = _mm_hadd_ps(s, s);
+    return _mm_cvtss_f32(s);
+}
+
+static inline __m256 lanczos_dot_c1(const float *src, const float *w, int32_t ksize_pad)
+{
+    __m256 acc = _mm256_mul_ps(_mm256_loadu_ps(src), _mm256_loadu_ps(w));
+    for (int32_t k = 8; k < ksize_pad; k += 8) {
+        acc = _mm256_fmadd_ps(_mm256_loadu_ps(src + k), _mm256_loadu_ps(w + k), acc);
+    }
+    return acc;
+}
+
+void resize_lanczos_w_fma(
+    const float *src,
+    int32_t channels,
+    const int32_t *start,
+    const float *weights,
+    int32_t ksize,
+    int32_t ksize_pad,
+    int32_t out_width,
+    float *row)
+{
+    if (channels == 1) {
+        int32_t i = 0;
+        // 8 outputs per step, their dot products are reduced together by a tree of hadd
+        for (; i <= out_width - 8; i += 8) {
+            __m256 a[8];
+            for (int32_t j = 0; j < 8; ++j) {
+                a[j] = lanczos_dot_c1(src + start[i + j], weights + (i + j) * ksize_pad, ksize_pad);
+            }
+            __m256 h01   = _mm256_hadd_ps(a[0], a[1]);
+            __m256 h23   = _mm256_hadd_ps(a[2], a[3]);
+            __m256 h45   = _mm256_hadd_ps(a[4], a[5]);
+            __m256 h67   = _mm256_hadd_ps(a[6], a[7]);
+            __m256 h0123 = _mm256_hadd_ps(h01, h23);
+            __m256 h4567 = _mm256_hadd_ps(h45, h67);
+            __m256 lo    = _mm256_permute2f128_ps(h0123, h4567, 0x20);
+            __m256 hi    = _mm256_permute2f128_ps(h0123, h4567, 0x31);
+            _mm256_storeu_ps(row + i, _mm256_add_ps(lo, hi));
+        }
+        for (; i < out_width; ++i) {
+            row[i] = hsum_ps(lanczos_dot_c1(src + start[i], weights + i * ksize_pad, ksize_pad));
+        }
+        return;
+    }
+    // 3 and 4 channels: one vector of channels per tap, a 3 channel store spills one lane into
+    // the next pixel which is written right after. Even and odd taps of two pixels are summed
+    // separately to keep four independent fma chains in flight.
+    int32_t i = 0;
+    for (; i <= out_width - 2; i += 2) {
+        const float *s0 = src + start[i] * channels;
+        const float *s1 = src + start[i + 1] * channels;
+        const float *w0 = weights + i * ksize_pad;
+        const float *w1 = w0 + ksize_pad;
+        __m128 a0       = _mm_setzero_ps();
+        __m128 b0       = _mm_setzero_ps();
+        __m128 a1       = _mm_setzero_ps();
+        __m128 b1       = _mm_setzero_ps();
+        int32_t k       = 0;
+        for (; k <= ksize - 2; k += 2) {
+            a0 = _mm_fmadd_ps(_mm_loadu_ps(s0 + k * channels), _mm_set1_ps(w0[k]), a0);
+            a1 = _mm_fmadd_ps(_mm_loadu_ps(s1 + k * channels), _mm_set1_ps(w1[k]), a1);
+            b0 = _mm_fmadd_ps(_mm_loadu_ps(s0 + (k + 1) * channels), _mm_set1_ps(w0[k + 1]), b0);
+            b1 = _mm_fmadd_ps(_mm_loadu_ps(s1 + (k + 1) * channels), _mm_set1_ps(w1[k + 1]), b1);
+        }
+        if (k < ksize) {
+            a0 = _mm_fmadd_ps(_mm_loadu_ps(s0 + k * channels), _mm_set1_ps(w0[k]), a0);
+            a1 = _mm_fmadd_ps(_mm_loadu_ps(s1 + k * channels), _mm_set1_ps(w1[k]), a1);
+        }
+        _mm_storeu_ps(row + i * channels, _mm_add_ps(a0, b0));
+        _mm_storeu_ps(row + (i + 1) * channels, _mm_add_ps(a1, b1));
+    }
+    for (; i < out_width; ++i) {
+        const float *s = src + start[i] * channels;
+        const float *w = weights + i * ksize_pad;
+        __m128 acc     = _mm_setzero_ps();
+        for (int32_t k = 0; k < ksize; ++k) {
+            acc = _mm_fmadd_ps(_mm_loadu_ps(s + k * channels), _mm_set1_ps(w[k]), acc);
+        }
+        _mm_storeu_ps(row + i * channels, acc);
+    }
+}
+
+int32_t resize_lanczos_h_fma(
+    const float *const *rows,
+    const float *coeff,
+    int32_t ksize,
+    int32_t n,
+    float *dst)
+{
+    int32_t i = 0;
+    for (; i <= n - 32; i += 32) {
+        __m256 w  = _mm256_set1_ps(coeff[0]);
+        __m256 a0 = _mm256_mul_ps(_mm256_loadu_ps(rows[0] + i), w);
+        __m256 a1 = _mm256_mul_ps(_mm256_loadu_ps(rows[0] + i + 8), w);
+        __m256 a2 = _mm256_mul_ps(_mm256_loadu_ps(rows[0] + i + 16), w);
+        __m256 a3 = _mm256_mul_ps(_mm256_loadu_ps(rows[0] + i + 24), w);
+        for (int32_t k = 1; k < ksize; ++k) {
+            const float *r = rows[k] + i;
+            w              = _mm256_set1_ps(coeff[k]);
+            a0             = _mm256_fmadd_ps(_mm256_loadu_ps(r), w, a0);
+            a1             = _mm256_fmadd_ps(_mm256_loadu_ps(r + 8), w, a1);
+            a2             = _mm256_fmadd_ps(_mm256_loadu_ps(r + 16), w, a2);
+            a3             = _mm256_fmadd_ps(_mm256_loadu_ps(r + 24), w, a3);
+        }
+        _mm256_storeu_ps(dst + i, a0);
+        _mm256_storeu_ps(dst + i + 8, a1);
+        _mm256_storeu_ps(dst + i + 16, a2);
+        _mm256_storeu_ps(dst + i + 24, a3);
+    }
+    for (; i <= n - 8; i += 8) {
+        __m256 a = _mm256_mul_ps(_mm256_loadu_ps(rows[0] + i), _mm256_set1_ps(coeff[0]));
+        for (int32_t k = 1; k < ksize; ++k) {
+            a = _mm256_fmadd_ps(_mm256_loadu_ps(rows[k] + i), _mm256_set1_ps(coeff[k]), a);
+        }
+        _mm256_storeu_ps(dst + i, a);
+    }
+    return i;
+}
+
+int32_t resize_lanczos_h_fma(
+    const float *const *rows,
+    const float *coeff,
+    int32_t ksize,
+    int32_t n,
+    uint8_t *dst)
+{
+    const __m256i m_perm = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    int32_t i            = 0;
+    for (; i <= n - 32; i += 32) {
+        __m256 w  = _mm256_set1_ps(coeff[0]);
+        __m256 a0 = _mm256_mul_ps(_mm256_loadu_ps(rows[0] + i), w);
+        __m256 a1 = _mm256_mul_ps(_mm256_loadu_ps(rows[0] + i + 8), w);
+        __m256 a2 = _mm256_mul_ps(_mm256_loadu_ps(rows[0] + i + 16), w);
+        __m256 a3 = _mm256_mul_ps(_mm256_loadu_ps(rows[0] + i + 24), w);
+        for (int32_t k = 1; k < ksize; ++k) {
+            const float *r = rows[k] + i;
+            w              = _mm256_set1_ps(coeff[k]);
+            a0             = _mm256_fmadd_ps(_mm256_loadu_ps(r), w, a0);
+            a1             = _mm256_fmadd_ps(_mm256_loadu_ps(r + 8), w, a1);
+            a2             = _mm256_fmadd_ps(_mm256_loadu_ps(r + 16), w, a2);
+            a3             = _mm256_fmadd_ps(_mm256_loadu_ps(r + 24), w, a3);
+        }
+        __m256i p01 = _mm256_packs_epi32(_mm256_cvtps_epi32(a0), _mm256_cvtps_epi32(a1));
+        __m256i p23 = _mm256_packs_epi32(_mm256_cvtps_epi32(a2), _mm256_cvtps_epi32(a3));
+        __m256i u8  = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(p01, p23), m_perm);
+        _mm256_storeu_si256((__m256i *)(dst + i), u8);
+    }
+    for (; i <= n - 8; i += 8) {
+        __m256 a = _mm256_mul_ps(_mm256_loadu_ps(rows[0] + i), _mm256_set1_ps(coeff[0]));
+        for (int32_t k = 1; k < ksize; ++k) {
+            a = _mm256_fmadd_ps(_mm256_loadu_ps(rows[k] + i), _mm256_set1_ps(coeff[k]), a);
+        }
+        __m256i v   = _mm256_cvtps_epi32(a);
+        __m128i p16 = _mm_packs_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+        _mm_storel_epi64((__m128i *)(dst + i), _mm_packus_epi16(p16, p16));
+    }
+    return i;
+}
+
+// height pass straight from u8 source rows, used when shrinking so the width pass sees fewer rows
+int32_t resize_lanczos_h_fma(
+    const uint8_t *const *rows,
+    const float *coeff,
+    int32_t ksize,
+    int32_t n,
+    float *dst)
+{
+    int32_t i = 0;
+    for (; i <= n - 32; i += 32) {
+        __m256 a0 = _mm256_setzero_ps();
+        __m256 a1 = _mm256_setzero_ps();
+        __m256 a2 = _mm256_setzero_ps();
+        __m256 a3 = _mm256_setzero_ps();
+        for (int32_t k = 0; k < ksize; ++k) {
+            __m256i v = _mm256_loadu_si256((const __m256i *)(rows[k] + i));
+            __m128i l = _mm256_castsi256_si128(v);
+            __m128i h = _mm256_extracti128_si256(v, 1);
+            __m256 w  = _mm256_set1_ps(coeff[k]);
+            a0        = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(l)), w, a0);
+            a1        = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(l, 8))), w, a1);
+            a2        = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(h)), w, a2);
+            a3        = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(h, 8))), w, a3);
+        }
+        _mm256_storeu_ps(dst + i, a0);
+        _mm256_storeu_ps(dst + i + 8, a1);
+        _mm256_storeu_ps(dst + i + 16, a2);
+        _mm256_storeu_ps(dst + i + 24, a3);
+    }
+    for (; i <= n - 8; i += 8) {
+        __m256 a = _mm256_setzero_ps();
+        for (int32_t k = 0; k < ksize; ++k) {
+            __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(rows[k] + i)));
+            a         = _mm256_fmadd_ps(_mm256_cvtepi32_ps(v), _mm256_set1_ps(coeff[k]), a);
+        }
+        _mm256_storeu_ps(dst + i, a);
+    }
+    return i;
+}
+
+} // namespace fma
+} // namespace tinycv
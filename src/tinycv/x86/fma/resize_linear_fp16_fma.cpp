@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "internal_fma.hpp"
+
+#include <immintrin.h>
+
+namespace tinycv {
+namespace fma {
+
+int32_t resize_linear_w_oneline_fp16_fma(
+    int32_t max_length,
+    int32_t channels,
+    const half_t *in_data,
+    const int32_t *w_offset,
+    const float *w_coeff,
+    float *row)
+{
+    const uint16_t *in = (const uint16_t *)in_data;
+    __m256 m_one = _mm256_set1_ps(1.0f);
+
+    int32_t i = 0;
+    if (channels == 4) {
+        // one 16-byte load fetches a pixel together with its right neighbour
+        for (; i <= max_length - 8; i += 8) {
+            __m128i m_pair_0 = _mm_loadu_si128((const __m128i *)(in + w_offset[i]));
+            __m128i m_pair_1 = _mm_loadu_si128((const __m128i *)(in + w_offset[i + 4]));
+            __m256 m_data_0 = _mm256_cvtph_ps(_mm_unpacklo_epi64(m_pair_0, m_pair_1));
+            __m256 m_data_1 = _mm256_cvtph_ps(_mm_unpackhi_epi64(m_pair_0, m_pair_1));
+
+            __m256 m_w_coeff_0 = _mm256_loadu_ps(w_coeff + i);
+            __m256 m_w_coeff_1 = _mm256_sub_ps(m_one, m_w_coeff_0);
+            _mm256_storeu_ps(row + i, _mm256_fmadd_ps(m_data_0, m_w_coeff_0, _mm256_mul_ps(m_data_1, m_w_coeff_1)));
+        }
+        return i;
+    }
+
+    for (; i <= max_length - 8; i += 8) {
+        __m128i m_half_0 = _mm_setr_epi16(in[w_offset[i + 0]],
+                                          in[w_offset[i + 1]],
+                                          in[w_offset[i + 2]],
+                                          in[w_offset[i + 3]],
+                                          in[w_offset[i + 4]],
+                                          in[w_offset[i + 5]],
+                                          in[w_offset[i + 6]],
+                                          in[w_offset[i + 7]]);
+        __m128i m_half_1 = _mm_setr_epi16(in[w_offset[i + 0] + channels],
+                                          in[w_offset[i + 1] + channels],
+                                          in[w_offset[i + 2] + channels],
+                                          in[w_offset[i + 3] + channels],
+                                          in[w_offset[i + 4] + channels],
+                                          in[w_offset[i + 5] + channels],
+                                          in[w_offset[i + 6] + channels],
+                                          in[w_offset[i + 7] + channels]);
+        __m256 m_data_0 = _mm256_cvtph_ps(m_half_0);
+        __m256 m_data_1 = _mm256_cvtph_ps(m_half_1);
+
+        __m256 m_w_coeff_0 = _mm256_loadu_ps(w_coeff + i);
+        __m256 m_w_coeff_1 = _mm256_sub_ps(m_one, m_w_coeff_0);
+        _mm256_storeu_ps(row + i, _mm256_fmadd_ps(m_data_0, m_w_coeff_0, _mm256_mul_ps(m_data_1, m_w_coeff_1)));
+    }
+    return i;
+}
+
+int32_t resize_linear_h_fp16_fma(
+    int32_t max_length,
+    const float *row_0,
+    const float *row_1,
+    float h_coeff,
+    half_t *out_data)
+{
+    __m256 m_h_coeff_0 = _mm256_set1_ps(h_coeff);
+    __m256 m_h_coeff_1 = _mm256_set1_ps(1.0f - h_coeff);
+
+    int32_t i = 0;
+    for (; i <= max_length - 8; i += 8) {
+        __m256 m_data_0 = _mm256_loadu_ps(row_0 + i);
+        __m256 m_data_1 = _mm256_loadu_ps(row_1 + i);
+        __m256 m_rst = _mm256_fmadd_ps(m_data_0, m_h_coeff_0, _mm256_mul_ps(m_data_1, m_h_coeff_1));
+        _mm_storeu_si128((__m128i *)(out_data + i), _mm256_cvtps_ph(m_rst, _MM_FROUND_TO_NEAREST_INT));
+    }
+    return i;
+}
+
+}
+} // namespace tinycv::fma
@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "internal_fma.hpp"
+#include "tinycv/threshold.h"
+
+#include <stdint.h>
+#include <immintrin.h>
+
+namespace tinycv {
+namespace fma {
+
+template <int32_t type>
+static int32_t threshold_row_u8_fma(const uint8_t *src, int32_t n, uint8_t thresh, uint8_t maxval, uint8_t *dst)
+{
+    __m256i v_t = _mm256_set1_epi8((char)thresh);
+    __m256i v_t_signed = _mm256_set1_epi8((char)(thresh ^ 0x80));
+    __m256i v_m = _mm256_set1_epi8((char)maxval);
+    __m256i v_sign = _mm256_set1_epi8((char)0x80);
+    int32_t i = 0;
+    for (; i <= n - 64; i += 64) {
+        __m256i x0 = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i x1 = _mm256_loadu_si256((const __m256i *)(src + i + 32));
+        __m256i r0, r1;
+        if (type == THRESH_TRUNC) {
+            r0 = _mm256_min_epu8(x0, v_t);
+            r1 = _mm256_min_epu8(x1, v_t);
+        } else {
+            __m256i gt0 = _mm256_cmpgt_epi8(_mm256_xor_si256(x0, v_sign), v_t_signed);
+            __m256i gt1 = _mm256_cmpgt_epi8(_mm256_xor_si256(x1, v_sign), v_t_signed);
+            if (type == THRESH_BINARY) {
+                r0 = _mm256_and_si256(gt0, v_m);
+                r1 = _mm256_and_si256(gt1, v_m);
+            } else if (type == THRESH_BINARY_INV) {
+                r0 = _mm256_andnot_si256(gt0, v_m);
+                r1 = _mm256_andnot_si256(gt1, v_m);
+            } else if (type == THRESH_TOZERO) {
+                r0 = _mm256_and_si256(gt0, x0);
+                r1 = _mm256_and_si256(gt1, x1);
+            } else {
+                r0 = _mm256_andnot_si256(gt0, x0);
+                r1 = _mm256_andnot_si256(gt1, x1);
+            }
+        }
+        _mm256_storeu_si256((__m256i *)(dst + i), r0);
+        _mm256_storeu_si256((__m256i *)(dst + i + 32), r1);
+    }
+    return i;
+}
+
+template <int32_t type>
+static int32_t threshold_row_f32_fma(const float *src, int32_t n, float thresh, float maxval, float *dst)
+{
+    __m256 v_t = _mm256_set1_ps(thresh);
+    __m256 v_m = _mm256_set1_ps(maxval);
+    int32_t i = 0;
+    for (; i <= n - 16; i += 16) {
+        __m256 x0 = _mm256_loadu_ps(src + i);
+        __m256 x1 = _mm256_loadu_ps(src + i + 8);
+        __m256 gt0 = _mm256_cmp_ps(x0, v_t, _CMP_GT_OQ);
+        __m256 gt1 = _mm256_cmp_ps(x1, v_t, _CMP_GT_OQ);
+        __m256 r0, r1;
+        if (type == THRESH_BINARY) {
+            r0 = _mm256_and_ps(gt0, v_m);
+            r1 = _mm256_and_ps(gt1, v_m);
+        } else if (type == THRESH_BINARY_INV) {
+            r0 = _mm256_andnot_ps(gt0, v_m);
+            r1 = _mm256_andnot_ps(gt1, v_m);
+        } else if (type == THRESH_TRUNC) {
+            r0 = _mm256_blendv_ps(x0, v_t, gt0);
+            r1 = _mm256_blendv_ps(x1, v_t, gt1);
+        } else if (type == THRESH_TOZERO) {
+            r0 = _mm256_and_ps(gt0, x0);
+            r1 = _mm256_and_ps(gt1, x1);
+        } else {
+            r0 = _mm256_andnot_ps(gt0, x0);
+            r1 = _mm256_andnot_ps(gt1, x1);
+        }
+        _mm256_storeu_ps(dst + i, r0);
+        _mm256_storeu_ps(dst + i + 8, r1);
+    }
+    return i;
+}
+
+template <>
+int32_t threshold_row_fma<uint8_t>(const uint8_t *src, int32_t n, uint8_t thresh, uint8_t maxval, int32_t type, uint8_t *dst)
+{
+    switch (type) {
+        case THRESH_BINARY: return threshold_row_u8_fma<THRESH_BINARY>(src, n, thresh, maxval, dst);
+        case THRESH_BINARY_INV: return threshold_row_u8_fma<THRESH_BINARY_INV>(src, n, thresh, maxval, dst);
+        case THRESH_TRUNC: return threshold_row_u8_fma<THRESH_TRUNC>(src, n, thresh, maxval, dst);
+        case THRESH_TOZERO: return threshold_row_u8_fma<THRESH_TOZERO>(src, n, thresh, maxval, dst);
+        case THRESH_TOZERO_INV: return threshold_row_u8_fma<THRESH_TOZERO_INV>(src, n, thresh, maxval, dst);
+        default: return 0;
+    }
+}
+
+template <>
+int32_t threshold_row_fma<float>(const float *src, int32_t n, float thresh, float maxval, int32_t type, float *dst)
+{
+    switch (type) {
+        case THRESH_BINARY: return threshold_row_f32_fma<THRESH_BINARY>(src, n, thresh, maxval, dst);
+        case THRESH_BINARY_INV: return threshold_row_f32_fma<THRESH_BINARY_INV>(src, n, thresh, maxval, dst);
+        case THRESH_TRUNC: return threshold_row_f32_fma<THRESH_TRUNC>(src, n, thresh, maxval, dst);
+        case THRESH_TOZERO: return threshold_row_f32_fma<THRESH_TOZERO>(src, n, thresh, maxval, dst);
+        case THRESH_TOZERO_INV: return threshold_row_f32_fma<THRESH_TOZERO_INV>(src, n, thresh, maxval, dst);
+        default: return 0;
+    }
+}
+
+}
+} // namespace tinycv::fma
@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/histogram.h"
+#include "tinycv/debug.h"
+
+#include <opencv2/imgproc.hpp>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace {
+
+void BM_CalcHist_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    uint32_t hist[256];
+
+    for (auto _ : state) {
+        tinycv::CalcHist(height, width, width, src.get(), hist);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+void BM_EqualizeHist_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::EqualizeHist(height, width, width, src.get(), width, dst.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+void BM_CLAHE_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::CLAHE(height, width, width, src.get(), width, dst.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK(BM_CalcHist_tinycv_x86)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK(BM_EqualizeHist_tinycv_x86)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK(BM_CLAHE_tinycv_x86)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+
+#ifdef TINYCV_BENCHMARK_OPENCV
+static void BM_CalcHist_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat hist;
+    int32_t histSize = 256;
+    float range[] = {0, 256};
+    const float *ranges[] = {range};
+    int32_t channel = 0;
+    for (auto _ : state) {
+        cv::calcHist(&iMat, 1, &channel, cv::Mat(), hist, 1, &histSize, ranges);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+static void BM_EqualizeHist_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat oMat;
+    for (auto _ : state) {
+        cv::equalizeHist(iMat, oMat);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+static void BM_CLAHE_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat oMat;
+    cv::Ptr<cv::CLAHE> clahe = cv::createCLAHE();
+    for (auto _ : state) {
+        clahe->apply(iMat, oMat);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK(BM_CalcHist_opencv_x86)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK(BM_EqualizeHist_opencv_x86)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK(BM_CLAHE_opencv_x86)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+
+#endif //! TINYCV_BENCHMARK_OPENCV
+} // namespace
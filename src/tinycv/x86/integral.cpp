@@ -0,0 +1,428 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/integral.h"
+#include "tinycv/types.h"
+#include "tinycv/sys.h"
+
+#include <string.h>
+#include <stdint.h>
+#include <immintrin.h>
+#include <algorithm>
+
+namespace tinycv {
+
+// below this many pixels per band a thread costs more than it saves
+#define INTEGRAL_MIN_BAND_PIXELS (1 << 16)
+
+static inline __m128i integral_load4_u8(const uint8_t *src)
+{
+    int32_t v;
+    memcpy(&v, src, sizeof(v));
+    return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(v));
+}
+
+// inclusive prefix sum of 8 u16 lanes
+static inline __m128i integral_prefix_u16x8(__m128i v)
+{
+    v = _mm_add_epi16(v, _mm_slli_si128(v, 2));
+    v = _mm_add_epi16(v, _mm_slli_si128(v, 4));
+    return _mm_add_epi16(v, _mm_slli_si128(v, 8));
+}
+
+// inclusive prefix sum of 4 s32 lanes
+static inline __m128i integral_prefix_s32x4(__m128i v)
+{
+    v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+    return _mm_add_epi32(v, _mm_slli_si128(v, 8));
+}
+
+// out[0..3] = prev[0..3] + s
+static inline void integral_store4(const int32_t *prev, int32_t *out, __m128i s)
+{
+    _mm_storeu_si128((__m128i *)out, _mm_add_epi32(_mm_loadu_si128((const __m128i *)prev), s));
+}
+static inline void integral_store4(const double *prev, double *out, __m128i s)
+{
+    _mm_storeu_pd(out, _mm_add_pd(_mm_loadu_pd(prev), _mm_cvtepi32_pd(s)));
+    _mm_storeu_pd(out + 2, _mm_add_pd(_mm_loadu_pd(prev + 2), _mm_cvtepi32_pd(_mm_srli_si128(s, 8))));
+}
+
+// one row of the integral image: out[x] = prev[x] + Σ_{x' <= x} in[x'], the running sum of the row stays in
+// int32 which is exact for rows shorter than 2^31 / 255 pixels
+template <typename Tsum, int32_t channels>
+static void integral_row(const uint8_t *in, int32_t width, const Tsum *prev, Tsum *out)
+{
+    int32_t x = 0;
+    int32_t s[4];
+    if (channels == 1) {
+        __m128i carry = _mm_setzero_si128();
+        for (; x <= width - 8; x += 8) {
+            __m128i v  = integral_prefix_u16x8(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(in + x))));
+            __m128i s0 = _mm_add_epi32(_mm_cvtepu16_epi32(v), carry);
+            __m128i s1 = _mm_add_epi32(_mm_cvtepu16_epi32(_mm_srli_si128(v, 8)), carry);
+            carry      = _mm_shuffle_epi32(s1, 0xFF);
+            integral_store4(prev + x, out + x, s0);
+            integral_store4(prev + x + 4, out + x + 4, s1);
+        }
+        s[0] = _mm_cvtsi128_si32(carry);
+    } else {
+        // one pixel per step, the 4th lane of a 3 channels pixel is overwritten by the next pixel so the
+        // last pixel is left to the scalar loop
+        __m128i carry = _mm_setzero_si128();
+        for (; x < width - (channels == 3); ++x) {
+            carry = _mm_add_epi32(carry, integral_load4_u8(in + x * channels));
+            integral_store4(prev + x * channels, out + x * channels, carry);
+        }
+        s[0] = _mm_extract_epi32(carry, 0);
+        s[1] = _mm_extract_epi32(carry, 1);
+        s[2] = _mm_extract_epi32(carry, 2);
+        s[3] = _mm_extract_epi32(carry, 3);
+    }
+    for (; x < width; ++x) {
+        for (int32_t c = 0; c < channels; ++c) {
+            s[c] += in[x * channels + c];
+            out[x * channels + c] = prev[x * channels + c] + s[c];
+        }
+    }
+}
+
+// one row of the squared integral image, the running sum is kept in double
+template <int32_t channels>
+static void integral_sqr_row(const uint8_t *in, int32_t width, const double *prev, double *out)
+{
+    int32_t x = 0;
+    double s[4];
+    if (channels == 1) {
+        __m128d carry = _mm_setzero_pd();
+        for (; x <= width - 8; x += 8) {
+            __m128i v  = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(in + x)));
+            __m128i sq = _mm_mullo_epi16(v, v); // 255 * 255 still fits in u16
+            __m128i q0 = integral_prefix_s32x4(_mm_cvtepu16_epi32(sq));
+            __m128i q1 = integral_prefix_s32x4(_mm_cvtepu16_epi32(_mm_srli_si128(sq, 8)));
+            q1         = _mm_add_epi32(q1, _mm_shuffle_epi32(q0, 0xFF));
+            __m128d d0 = _mm_add_pd(_mm_cvtepi32_pd(q0), carry);
+            __m128d d1 = _mm_add_pd(_mm_cvtepi32_pd(_mm_srli_si128(q0, 8)), carry);
+            __m128d d2 = _mm_add_pd(_mm_cvtepi32_pd(q1), carry);
+            __m128d d3 = _mm_add_pd(_mm_cvtepi32_pd(_mm_srli_si128(q1, 8)), carry);
+            carry      = _mm_unpackhi_pd(d3, d3);
+            _mm_storeu_pd(out + x, _mm_add_pd(_mm_loadu_pd(prev + x), d0));
+            _mm_storeu_pd(out + x + 2, _mm_add_pd(_mm_loadu_pd(prev + x + 2), d1));
+            _mm_storeu_pd(out + x + 4, _mm_add_pd(_mm_loadu_pd(prev + x + 4), d2));
+            _mm_storeu_pd(out + x + 6, _mm_add_pd(_mm_loadu_pd(prev + x + 6), d3));
+        }
+        _mm_store_sd(s, carry);
+    } else {
+        __m128d carry0 = _mm_setzero_pd();
+        __m128d carry1 = _mm_setzero_pd();
+        for (; x < width - (channels == 3); ++x) {
+            __m128i v = integral_load4_u8(in + x * channels);
+            v         = _mm_mullo_epi32(v, v);
+            carry0    = _mm_add_pd(carry0, _mm_cvtepi32_pd(v));
+            carry1    = _mm_add_pd(carry1, _mm_cvtepi32_pd(_mm_srli_si128(v, 8)));
+            _mm_storeu_pd(out + x * channels, _mm_add_pd(_mm_loadu_pd(prev + x * channels), carry0));
+            _mm_storeu_pd(out + x * channels + 2, _mm_add_pd(_mm_loadu_pd(prev + x * channels + 2), carry1));
+        }
+        _mm_storeu_pd(s, carry0);
+        _mm_storeu_pd(s + 2, carry1);
+    }
+    for (; x < width; ++x) {
+        for (int32_t c = 0; c < channels; ++c) {
+            int32_t v = in[x * channels + c];
+            s[c] += v * v;
+            out[x * channels + c] = prev[x * channels + c] + s[c];
+        }
+    }
+}
+
+// input rows [y0, y1) give output rows y0 + 1 to y1, starting from `sumBase` and `sqsumBase` which hold output row y0
+template <typename Tsum, int32_t channels>
+static void integral_band(
+    int32_t y0,
+    int32_t y1,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    const Tsum *sumBase,
+    int32_t sumWidthStride,
+    Tsum *sumData,
+    const double *sqsumBase,
+    int32_t sqsumWidthStride,
+    double *sqsumData)
+{
+    for (int32_t y = y0; y < y1; ++y) {
+        const uint8_t *in = inData + (int64_t)y * inWidthStride;
+        Tsum *sum         = sumData + (int64_t)(y + 1) * sumWidthStride;
+        for (int32_t c = 0; c < channels; ++c) {
+            sum[c] = 0;
+        }
+        integral_row<Tsum, channels>(in, width, sumBase + channels, sum + channels);
+        sumBase = sum;
+        if (nullptr != sqsumData) {
+            double *sqsum = sqsumData + (int64_t)(y + 1) * sqsumWidthStride;
+            for (int32_t c = 0; c < channels; ++c) {
+                sqsum[c] = 0;
+            }
+            integral_sqr_row<channels>(in, width, sqsumBase + channels, sqsum + channels);
+            sqsumBase = sqsum;
+        }
+    }
+}
+
+template <typename Tsum, int32_t channels>
+static void integral_impl(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t sumWidthStride,
+    Tsum *sumData,
+    int32_t sqsumWidthStride,
+    double *sqsumData,
+    int32_t numThreads)
+{
+    const int32_t rowLength = (width + 1) * channels;
+    const int32_t colLength = width * channels;
+    memset(sumData, 0, rowLength * sizeof(Tsum));
+    if (nullptr != sqsumData) {
+        memset(sqsumData, 0, rowLength * sizeof(double));
+    }
+
+    int32_t bands = (int32_t)std::min<int64_t>((int64_t)height * width / INTEGRAL_MIN_BAND_PIXELS, height);
+    bands         = std::min(bands, numThreads);
+    if (bands <= 1) {
+        integral_band<Tsum, channels>(0, height, width, inWidthStride, inData, sumData, sumWidthStride, sumData, sqsumData, sqsumWidthStride, sqsumData);
+        return;
+    }
+
+    // column sums of every band but the last one, then the output rows above the bands
+    uint64_t size_for_col_sum = ((uint64_t)(bands - 1) * colLength * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    uint64_t size_for_col_sq_sum = nullptr != sqsumData ? ((uint64_t)(bands - 1) * colLength * sizeof(double) + 64 - 1) / 64 * 64 : 0;
+    uint64_t size_for_sum_base = ((uint64_t)(bands - 1) * rowLength * sizeof(Tsum) + 64 - 1) / 64 * 64;
+    uint64_t size_for_sq_sum_base = nullptr != sqsumData ? ((uint64_t)(bands - 1) * rowLength * sizeof(double) + 64 - 1) / 64 * 64 : 0;
+
+    uint64_t total_size = size_for_col_sum + size_for_col_sq_sum + size_for_sum_base + size_for_sq_sum_base;
+
+    void *temp_buffer = tinycv::ScratchAlloc(total_size, 64);
+    int32_t *colSum = (int32_t *)temp_buffer;
+    double *colSqSum = (double *)((unsigned char *)colSum + size_for_col_sum);
+    Tsum *sumBase = (Tsum *)((unsigned char *)colSqSum + size_for_col_sq_sum);
+    double *sqsumBase = (double *)((unsigned char *)sumBase + size_for_sum_base);
+    memset(colSum, 0, (size_t)(bands - 1) * colLength * sizeof(int32_t));
+    if (nullptr != sqsumData) {
+        memset(colSqSum, 0, (size_t)(bands - 1) * colLength * sizeof(double));
+    }
+    ParallelFor(bands - 1, bands - 1, [&](int32_t b0, int32_t b1) {
+        for (int32_t b = b0; b < b1; ++b) {
+            int32_t *cs = colSum + (int64_t)b * colLength;
+            double *cq  = nullptr != sqsumData ? colSqSum + (int64_t)b * colLength : nullptr;
+            for (int32_t y = (int32_t)((int64_t)height * b / bands); y < (int32_t)((int64_t)height * (b + 1) / bands); ++y) {
+                const uint8_t *in = inData + (int64_t)y * inWidthStride;
+                for (int32_t i = 0; i < colLength; ++i) {
+                    cs[i] += in[i];
+                }
+                if (nullptr != cq) {
+                    for (int32_t i = 0; i < colLength; ++i) {
+                        cq[i] += in[i] * in[i];
+                    }
+                }
+            }
+        }
+    });
+
+    // the output row above band b is the row prefix sum of the column sums of bands 0 to b - 1
+    for (int32_t b = 0; b < bands - 1; ++b) {
+        int32_t *cs = colSum + (int64_t)b * colLength;
+        Tsum *base  = sumBase + (int64_t)b * rowLength;
+        if (b > 0) {
+            const int32_t *above = colSum + (int64_t)(b - 1) * colLength;
+            for (int32_t i = 0; i < colLength; ++i) {
+                cs[i] += above[i];
+            }
+        }
+        for (int32_t c = 0; c < channels; ++c) {
+            base[c] = 0;
+        }
+        for (int32_t i = 0; i < colLength; ++i) {
+            base[i + channels] = base[i] + cs[i];
+        }
+        if (nullptr != sqsumData) {
+            double *cq    = colSqSum + (int64_t)b * colLength;
+            double *sbase = sqsumBase + (int64_t)b * rowLength;
+            if (b > 0) {
+                const double *above = colSqSum + (int64_t)(b - 1) * colLength;
+                for (int32_t i = 0; i < colLength; ++i) {
+                    cq[i] += above[i];
+                }
+            }
+            for (int32_t c = 0; c < channels; ++c) {
+                sbase[c] = 0;
+            }
+            for (int32_t i = 0; i < colLength; ++i) {
+                sbase[i + channels] = sbase[i] + cq[i];
+            }
+        }
+    }
+
+    ParallelFor(bands, bands, [&](int32_t b0, int32_t b1) {
+        for (int32_t b = b0; b < b1; ++b) {
+            const Tsum *base    = b > 0 ? sumBase + (int64_t)(b - 1) * rowLength : sumData;
+            const double *sbase = nullptr;
+            if (nullptr != sqsumData) {
+                sbase = b > 0 ? sqsumBase + (int64_t)(b - 1) * rowLength : sqsumData;
+            }
+            integral_band<Tsum, channels>((int32_t)((int64_t)height * b / bands), (int32_t)((int64_t)height * (b + 1) / bands), width, inWidthStride, inData, base, sumWidthStride, sumData, sbase, sqsumWidthStride, sqsumData);
+        }
+    });
+
+    tinycv::ScratchFree(temp_buffer);
+}
+
+template <typename Tsum, int32_t channels>
+void Integral(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    Tsum *outData,
+    int32_t numThreads)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth * channels || outWidthStride < (inWidth + 1) * channels) {
+        return;
+    }
+    integral_impl<Tsum, channels>(inHeight, inWidth, inWidthStride, inData, outWidthStride, outData, 0, nullptr, numThreads);
+}
+
+template <typename Tsum, int32_t channels>
+void IntegralSqr(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t sumWidthStride,
+    Tsum *sumData,
+    int32_t sqsumWidthStride,
+    double *sqsumData,
+    int32_t numThreads)
+{
+    if (nullptr == inData || nullptr == sumData || nullptr == sqsumData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth * channels) {
+        return;
+    }
+    if (sumWidthStride < (inWidth + 1) * channels || sqsumWidthStride < (inWidth + 1) * channels) {
+        return;
+    }
+    integral_impl<Tsum, channels>(inHeight, inWidth, inWidthStride, inData, sumWidthStride, sumData, sqsumWidthStride, sqsumData, numThreads);
+}
+
+// out[0..3] = a[0..3] + b[0..3] - c[0..3] + u[0..3] + v[0..3]
+static inline void integral_tilted4(const int32_t *a, const int32_t *b, const int32_t *c, const uint8_t *u, const uint8_t *v, int32_t *out)
+{
+    __m128i s = _mm_add_epi32(_mm_loadu_si128((const __m128i *)a), _mm_loadu_si128((const __m128i *)b));
+    s         = _mm_sub_epi32(s, _mm_loadu_si128((const __m128i *)c));
+    s         = _mm_add_epi32(s, _mm_add_epi32(integral_load4_u8(u), integral_load4_u8(v)));
+    _mm_storeu_si128((__m128i *)out, s);
+}
+static inline void integral_tilted4(const double *a, const double *b, const double *c, const uint8_t *u, const uint8_t *v, double *out)
+{
+    __m128i p  = _mm_add_epi32(integral_load4_u8(u), integral_load4_u8(v));
+    __m128d s0 = _mm_sub_pd(_mm_add_pd(_mm_loadu_pd(a), _mm_loadu_pd(b)), _mm_loadu_pd(c));
+    __m128d s1 = _mm_sub_pd(_mm_add_pd(_mm_loadu_pd(a + 2), _mm_loadu_pd(b + 2)), _mm_loadu_pd(c + 2));
+    _mm_storeu_pd(out, _mm_add_pd(s0, _mm_cvtepi32_pd(p)));
+    _mm_storeu_pd(out + 2, _mm_add_pd(s1, _mm_cvtepi32_pd(_mm_srli_si128(p, 8))));
+}
+
+template <typename Tsum, int32_t channels>
+void IntegralTilted(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    Tsum *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || inWidthStride < inWidth * channels || outWidthStride < (inWidth + 1) * channels) {
+        return;
+    }
+    const int32_t rowLength = (inWidth + 1) * channels;
+    const int32_t last      = inWidth * channels;
+    // stand-ins for output row -1 and input row -1
+    uint64_t size_for_zero_sum = ((uint64_t)rowLength * sizeof(Tsum) + 64 - 1) / 64 * 64;
+    uint64_t size_for_zero_in = ((uint64_t)inWidth * channels + 64 - 1) / 64 * 64;
+    void *temp_buffer = tinycv::ScratchAlloc(size_for_zero_sum + size_for_zero_in, 64);
+    memset(temp_buffer, 0, size_for_zero_sum + size_for_zero_in);
+    const Tsum *zeroSum = (const Tsum *)temp_buffer;
+    const uint8_t *zeroIn = (const uint8_t *)temp_buffer + size_for_zero_sum;
+    memset(outData, 0, rowLength * sizeof(Tsum));
+
+    // T(X, Y) = T(X - 1, Y - 1) + T(X + 1, Y - 1) - T(X, Y - 2) + I(X - 1, Y - 1) + I(X - 1, Y - 2), with the
+    // triangles clipped by the left border T(0, Y) = T(1, Y - 1) and by the right one
+    // T(W, Y) = T(W - 1, Y - 1) + I(W - 1, Y - 1) + I(W - 1, Y - 2)
+    for (int32_t y = 1; y <= inHeight; ++y) {
+        const Tsum *t1    = outData + (int64_t)(y - 1) * outWidthStride;
+        const Tsum *t2    = y > 1 ? outData + (int64_t)(y - 2) * outWidthStride : zeroSum;
+        const uint8_t *i1 = inData + (int64_t)(y - 1) * inWidthStride;
+        const uint8_t *i2 = y > 1 ? inData + (int64_t)(y - 2) * inWidthStride : zeroIn;
+        Tsum *out         = outData + (int64_t)y * outWidthStride;
+        for (int32_t c = 0; c < channels; ++c) {
+            out[c] = t1[channels + c];
+        }
+        int32_t i = channels;
+        for (; i <= last - 4; i += 4) {
+            integral_tilted4(t1 + i - channels, t1 + i + channels, t2 + i, i1 + i - channels, i2 + i - channels, out + i);
+        }
+        for (; i < last; ++i) {
+            out[i] = t1[i - channels] + t1[i + channels] - t2[i] + i1[i - channels] + i2[i - channels];
+        }
+        for (; i < rowLength; ++i) {
+            out[i] = t1[i - channels] + i1[i - channels] + i2[i - channels];
+        }
+    }
+    tinycv::ScratchFree(temp_buffer);
+}
+
+template void Integral<int32_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int32_t *outData, int32_t numThreads);
+template void Integral<int32_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int32_t *outData, int32_t numThreads);
+template void Integral<int32_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int32_t *outData, int32_t numThreads);
+template void Integral<double, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, double *outData, int32_t numThreads);
+template void Integral<double, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, double *outData, int32_t numThreads);
+template void Integral<double, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, double *outData, int32_t numThreads);
+
+template void IntegralSqr<int32_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t sumWidthStride, int32_t *sumData, int32_t sqsumWidthStride, double *sqsumData, int32_t numThreads);
+template void IntegralSqr<int32_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t sumWidthStride, int32_t *sumData, int32_t sqsumWidthStride, double *sqsumData, int32_t numThreads);
+template void IntegralSqr<int32_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t sumWidthStride, int32_t *sumData, int32_t sqsumWidthStride, double *sqsumData, int32_t numThreads);
+template void IntegralSqr<double, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t sumWidthStride, double *sumData, int32_t sqsumWidthStride, double *sqsumData, int32_t numThreads);
+template void IntegralSqr<double, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t sumWidthStride, double *sumData, int32_t sqsumWidthStride, double *sqsumData, int32_t numThreads);
+template void IntegralSqr<double, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t sumWidthStride, double *sumData, int32_t sqsumWidthStride, double *sqsumData, int32_t numThreads);
+
+template void IntegralTilted<int32_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int32_t *outData);
+template void IntegralTilted<int32_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int32_t *outData);
+template void IntegralTilted<int32_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int32_t *outData);
+template void IntegralTilted<double, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, double *outData);
+template void IntegralTilted<double, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, double *outData);
+template void IntegralTilted<double, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, double *outData);
+
+} // namespace tinycv
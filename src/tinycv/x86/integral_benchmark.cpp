@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/integral.h"
+#include "tinycv/debug.h"
+
+#include <opencv2/imgproc.hpp>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+template <typename Tsum, int32_t nc>
+void BM_Integral_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t numThreads = state.range(2);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * nc]);
+    std::vector<Tsum> sum((height + 1) * (width + 1) * nc);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height * nc, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::Integral<Tsum, nc>(height, width, width * nc, src.get(), (width + 1) * nc, sum.data(), numThreads);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <typename Tsum, int32_t nc>
+void BM_IntegralSqr_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t numThreads = state.range(2);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * nc]);
+    std::vector<Tsum> sum((height + 1) * (width + 1) * nc);
+    std::vector<double> sqsum((height + 1) * (width + 1) * nc);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height * nc, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::IntegralSqr<Tsum, nc>(height, width, width * nc, src.get(), (width + 1) * nc, sum.data(), (width + 1) * nc, sqsum.data(), numThreads);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <typename Tsum, int32_t nc>
+void BM_IntegralTilted_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * nc]);
+    std::vector<Tsum> tilted((height + 1) * (width + 1) * nc);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height * nc, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::IntegralTilted<Tsum, nc>(height, width, width * nc, src.get(), (width + 1) * nc, tilted.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace tinycv::debug;
+
+BENCHMARK_TEMPLATE(BM_Integral_tinycv_x86, int32_t, c1)->Args({640, 480, 1})->Args({1920, 1080, 1})->Args({3840, 2160, 1})->Args({3840, 2160, 4});
+BENCHMARK_TEMPLATE(BM_Integral_tinycv_x86, int32_t, c3)->Args({640, 480, 1})->Args({1920, 1080, 1})->Args({3840, 2160, 1})->Args({3840, 2160, 4});
+BENCHMARK_TEMPLATE(BM_Integral_tinycv_x86, double, c1)->Args({640, 480, 1})->Args({1920, 1080, 1})->Args({3840, 2160, 1})->Args({3840, 2160, 4});
+BENCHMARK_TEMPLATE(BM_IntegralSqr_tinycv_x86, int32_t, c1)->Args({640, 480, 1})->Args({1920, 1080, 1})->Args({3840, 2160, 1})->Args({3840, 2160, 4});
+BENCHMARK_TEMPLATE(BM_IntegralTilted_tinycv_x86, int32_t, c1)->Args({640, 480})->Args({1920, 1080});
+
+#ifdef TINYCV_BENCHMARK_OPENCV
+template <typename Tsum, int32_t nc>
+static void BM_Integral_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * nc]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height * nc, 0, 255);
+    cv::Mat iMat(height, width, T2CvType<uint8_t, nc>::type, src.get());
+    cv::Mat sum;
+    for (auto _ : state) {
+        cv::integral(iMat, sum, cv::DataType<Tsum>::depth);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <typename Tsum, int32_t nc>
+static void BM_IntegralSqr_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * nc]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height * nc, 0, 255);
+    cv::Mat iMat(height, width, T2CvType<uint8_t, nc>::type, src.get());
+    cv::Mat sum, sqsum;
+    for (auto _ : state) {
+        cv::integral(iMat, sum, sqsum, cv::DataType<Tsum>::depth, CV_64F);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_Integral_opencv_x86, int32_t, c1)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Integral_opencv_x86, int32_t, c3)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_Integral_opencv_x86, double, c1)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+BENCHMARK_TEMPLATE(BM_IntegralSqr_opencv_x86, int32_t, c1)->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+
+#endif //! TINYCV_BENCHMARK_OPENCV
+} // namespace
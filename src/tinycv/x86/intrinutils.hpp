@@ -69,6 +69,25 @@ inline void v_load_deinterleave(const uint8_t* ptr, __m128i& a, __m128i& b, __m1
     d = _mm_unpackhi_epi8(v2, v3);
 }
 
+inline void v_store_interleave(uint8_t* ptr, const __m128i& a, const __m128i& b, const __m128i& c)
+{
+    const __m128i sh_a0 = _mm_setr_epi8(0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5);
+    const __m128i sh_b0 = _mm_setr_epi8(-1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1);
+    const __m128i sh_c0 = _mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1);
+    const __m128i sh_a1 = _mm_setr_epi8(-1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1);
+    const __m128i sh_b1 = _mm_setr_epi8(5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10);
+    const __m128i sh_c1 = _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1);
+    const __m128i sh_a2 = _mm_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1);
+    const __m128i sh_b2 = _mm_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1);
+    const __m128i sh_c2 = _mm_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15);
+    __m128i s0 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, sh_a0), _mm_shuffle_epi8(b, sh_b0)), _mm_shuffle_epi8(c, sh_c0));
+    __m128i s1 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, sh_a1), _mm_shuffle_epi8(b, sh_b1)), _mm_shuffle_epi8(c, sh_c1));
+    __m128i s2 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, sh_a2), _mm_shuffle_epi8(b, sh_b2)), _mm_shuffle_epi8(c, sh_c2));
+    _mm_storeu_si128((__m128i*)ptr, s0);
+    _mm_storeu_si128((__m128i*)(ptr + 16), s1);
+    _mm_storeu_si128((__m128i*)(ptr + 32), s2);
+}
+
 inline void _mm_interleave_epi8(__m128i& v_r0, __m128i& v_r1, __m128i& v_g0, __m128i& v_g1, __m128i& v_b0, __m128i& v_b1)
 {
     __m128i v_mask = _mm_set1_epi16(0x00ff);
@@ -0,0 +1,105 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/lut.h"
+#include "tinycv/types.h"
+
+#include <string.h>
+#include <stdint.h>
+
+namespace tinycv {
+
+#define LUT_SIZE 256
+
+// A 256 entry table does not fit the 16 entries of pshufb, a lookup needs 16 shuffles per vector and the
+// shuffle port makes it slower than plain loads. Elements are loaded and stored 8 at a time instead, the 8
+// lookups of a chunk are independent.
+static void lut_row_shared(const uint8_t *in, int32_t length, uint8_t *out, const uint8_t *t)
+{
+    int32_t i = 0;
+    for (; i <= length - 8; i += 8) {
+        uint64_t v, r;
+        memcpy(&v, in + i, sizeof(v));
+        r = (uint64_t)t[v & 0xff];
+        r |= (uint64_t)t[(v >> 8) & 0xff] << 8;
+        r |= (uint64_t)t[(v >> 16) & 0xff] << 16;
+        r |= (uint64_t)t[(v >> 24) & 0xff] << 24;
+        r |= (uint64_t)t[(v >> 32) & 0xff] << 32;
+        r |= (uint64_t)t[(v >> 40) & 0xff] << 40;
+        r |= (uint64_t)t[(v >> 48) & 0xff] << 48;
+        r |= (uint64_t)t[v >> 56] << 56;
+        memcpy(out + i, &r, sizeof(r));
+    }
+    for (; i < length; ++i) {
+        out[i] = t[in[i]];
+    }
+}
+
+template <int32_t channels>
+static void lut_row_planar(const uint8_t *in, int32_t width, uint8_t *out, const uint8_t (*planes)[LUT_SIZE])
+{
+    for (int32_t x = 0; x < width; ++x) {
+        for (int32_t c = 0; c < channels; ++c) {
+            out[x * channels + c] = planes[c][in[x * channels + c]];
+        }
+    }
+}
+
+template <int32_t channels>
+void LUT(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    int32_t lutChannels,
+    const uint8_t *lutData)
+{
+    if (nullptr == inData || nullptr == outData || nullptr == lutData) {
+        return;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * channels || outWidthStride < width * channels) {
+        return;
+    }
+    if (lutChannels != 1 && lutChannels != channels) {
+        return;
+    }
+
+    if (lutChannels == 1) {
+        for (int32_t y = 0; y < height; ++y) {
+            lut_row_shared(inData + (int64_t)y * inWidthStride, width * channels, outData + (int64_t)y * outWidthStride, lutData);
+        }
+        return;
+    }
+
+    uint8_t planes[channels][LUT_SIZE];
+    for (int32_t c = 0; c < channels; ++c) {
+        for (int32_t i = 0; i < LUT_SIZE; ++i) {
+            planes[c][i] = lutData[i * channels + c];
+        }
+    }
+    for (int32_t y = 0; y < height; ++y) {
+        lut_row_planar<channels>(inData + (int64_t)y * inWidthStride, width, outData + (int64_t)y * outWidthStride, planes);
+    }
+}
+
+template void LUT<1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t lutChannels, const uint8_t *lutData);
+template void LUT<3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t lutChannels, const uint8_t *lutData);
+template void LUT<4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t lutChannels, const uint8_t *lutData);
+
+} // namespace tinycv
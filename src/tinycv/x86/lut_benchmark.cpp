@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/lut.h"
+#include "tinycv/debug.h"
+
+#include <opencv2/imgproc.hpp>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace {
+
+template <int32_t nc, int32_t lutChannels>
+void BM_LUT_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * nc]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height * nc]);
+    std::unique_ptr<uint8_t[]> lut(new uint8_t[256 * lutChannels]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height * nc, 0, 255);
+    tinycv::debug::randomFill<uint8_t>(lut.get(), 256 * lutChannels, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::LUT<nc>(height, width, width * nc, src.get(), width * nc, dst.get(), lutChannels, lut.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_LUT_tinycv_x86, 1, 1)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_LUT_tinycv_x86, 3, 1)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_LUT_tinycv_x86, 3, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_LUT_tinycv_x86, 4, 4)->Args({640, 480})->Args({1920, 1080});
+
+#ifdef TINYCV_BENCHMARK_OPENCV
+template <int32_t nc, int32_t lutChannels>
+static void BM_LUT_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height * nc]);
+    std::unique_ptr<uint8_t[]> lut(new uint8_t[256 * lutChannels]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height * nc, 0, 255);
+    tinycv::debug::randomFill<uint8_t>(lut.get(), 256 * lutChannels, 0, 255);
+    cv::Mat iMat(height, width, CV_MAKETYPE(CV_8U, nc), src.get());
+    cv::Mat lutMat(1, 256, CV_MAKETYPE(CV_8U, lutChannels), lut.get());
+    cv::Mat oMat;
+    for (auto _ : state) {
+        cv::LUT(iMat, lutMat, oMat);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_LUT_opencv_x86, 1, 1)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_LUT_opencv_x86, 3, 1)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_LUT_opencv_x86, 3, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_LUT_opencv_x86, 4, 4)->Args({640, 480})->Args({1920, 1080});
+
+#endif //! TINYCV_BENCHMARK_OPENCV
+} // namespace
@@ -0,0 +1,550 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/matchtemplate.h"
+#include "tinycv/integral.h"
+#include "tinycv/sys.h"
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <immintrin.h>
+
+#define MT_SPATIAL_MAX_AREA 64
+#define MT_BAND_ROWS 32
+#define MT_CENTER 128 //! taken off image blocks before the FFT, the template has its mean taken off
+
+namespace tinycv {
+
+// template statistics and OpenCV's normalisation constants
+struct MtTemplate {
+    double area;
+    double mean;
+    double sum2; //! Σ T^2
+    double norm; //! norm of the template, with its mean taken off for CCOEFF_NORMED
+    bool flat; //! CCOEFF_NORMED with a constant template, every result is 1
+};
+
+static MtTemplate mt_template_stats(
+    int32_t templHeight,
+    int32_t templWidth,
+    int32_t templWidthStride,
+    const uint8_t *templData,
+    TemplateMatchMode method)
+{
+    int64_t s = 0, q = 0;
+    for (int32_t y = 0; y < templHeight; ++y) {
+        const uint8_t *t = templData + (size_t)y * templWidthStride;
+        for (int32_t x = 0; x < templWidth; ++x) {
+            s += t[x];
+            q += t[x] * t[x];
+        }
+    }
+    MtTemplate r;
+    r.area = (double)templHeight * templWidth;
+    double invArea = 1.0 / r.area;
+    r.mean = s * invArea;
+    double norm = std::max(q * invArea - r.mean * r.mean, 0.0);
+    r.flat = method == TM_CCOEFF_NORMED && norm < DBL_EPSILON;
+    double sum2 = norm + r.mean * r.mean;
+    if (method != TM_CCOEFF && method != TM_CCOEFF_NORMED) {
+        norm = sum2;
+    }
+    r.sum2 = sum2 * r.area;
+    r.norm = sqrt(norm) / sqrt(invArea);
+    return r;
+}
+
+// row stride of the widened input rows of `mt_correlate_spatial`, the taps read past the last block of 8 outputs
+static inline int32_t mt_spatial_row_stride(int32_t outWidth, int32_t templWidth)
+{
+    return (outWidth + 7) / 8 * 8 + 2 * ((templWidth + 1) / 2);
+}
+
+// exact correlation of output rows [y0, y1). The input rows of the band are widened to 16 bits once, template taps
+// go in pairs so that one madd does two of them for 4 outputs
+static void mt_correlate_spatial(
+    int32_t y0,
+    int32_t y1,
+    int32_t outWidth,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t templHeight,
+    int32_t templWidth,
+    const int32_t *taps,
+    int16_t *rows,
+    int32_t *acc,
+    double *corr,
+    int32_t corrStride)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const int32_t blocks = (outWidth + 7) / 8;
+    const int32_t pairs = (templWidth + 1) / 2;
+    const int32_t rowStride = mt_spatial_row_stride(outWidth, templWidth);
+    const int32_t bandRows = y1 - y0 + templHeight - 1;
+    memset(rows, 0, (size_t)bandRows * rowStride * sizeof(int16_t));
+    for (int32_t r = 0; r < bandRows; ++r) {
+        const uint8_t *src = inData + (size_t)(y0 + r) * inWidthStride;
+        int16_t *dst = rows + (size_t)r * rowStride;
+        int32_t x = 0;
+        for (; x <= inWidth - 8; x += 8) {
+            _mm_storeu_si128((__m128i *)(dst + x), _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(src + x))));
+        }
+        for (; x < inWidth; ++x) {
+            dst[x] = src[x];
+        }
+    }
+    for (int32_t y = y0; y < y1; ++y) {
+        for (int32_t b = 0; b < blocks; ++b) {
+            __m128i a0 = zero, a1 = zero;
+            for (int32_t ty = 0; ty < templHeight; ++ty) {
+                const int16_t *r = rows + (size_t)(y - y0 + ty) * rowStride + 8 * b;
+                const int32_t *t = taps + 4 * ty * pairs;
+                for (int32_t k = 0; k < pairs; ++k) {
+                    __m128i tk = _mm_loadu_si128((const __m128i *)(t + 4 * k));
+                    __m128i u = _mm_loadu_si128((const __m128i *)(r + 2 * k));
+                    __m128i v = _mm_loadu_si128((const __m128i *)(r + 2 * k + 1));
+                    a0 = _mm_add_epi32(a0, _mm_madd_epi16(_mm_unpacklo_epi16(u, v), tk));
+                    a1 = _mm_add_epi32(a1, _mm_madd_epi16(_mm_unpackhi_epi16(u, v), tk));
+                }
+            }
+            _mm_storeu_si128((__m128i *)(acc + 8 * b), a0);
+            _mm_storeu_si128((__m128i *)(acc + 8 * b + 4), a1);
+        }
+        double *c = corr + (size_t)(y - y0) * corrStride;
+        for (int32_t x = 0; x < outWidth; ++x) {
+            c[x] = acc[x];
+        }
+    }
+}
+
+// radix-2 FFT of size n over the columns of an n x n planar complex matrix
+struct MtFFT {
+    int32_t n;
+    float *wr, *wi; //! e^(-2 pi i k / n) for k < n / 2
+    int32_t *rev;
+};
+
+// bytes of the tables of a size n transform
+static uint64_t mt_fft_buffer_size(int32_t n)
+{
+    uint64_t size_for_w = ((uint64_t)n / 2 * sizeof(float) + 64 - 1) / 64 * 64;
+    uint64_t size_for_rev = ((uint64_t)n * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    return size_for_w * 2 + size_for_rev;
+}
+
+static void mt_fft_init(MtFFT &f, int32_t n, void *buffer)
+{
+    uint64_t size_for_w = ((uint64_t)n / 2 * sizeof(float) + 64 - 1) / 64 * 64;
+    f.n = n;
+    f.wr = (float *)buffer;
+    f.wi = (float *)((unsigned char *)f.wr + size_for_w);
+    f.rev = (int32_t *)((unsigned char *)f.wi + size_for_w);
+    for (int32_t k = 0; k < n / 2; ++k) {
+        f.wr[k] = (float)cos(2 * M_PI * k / n);
+        f.wi[k] = (float)-sin(2 * M_PI * k / n);
+    }
+    int32_t bits = __builtin_ctz(n);
+    for (int32_t i = 0; i < n; ++i) {
+        int32_t r = 0;
+        for (int32_t b = 0; b < bits; ++b) {
+            r |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+        f.rev[i] = r;
+    }
+}
+
+// every butterfly combines two whole rows, so all columns are transformed together in vector lanes
+static void mt_fft_columns(float *re, float *im, const MtFFT &f, bool inverse)
+{
+    const int32_t n = f.n;
+    for (int32_t i = 0; i < n; ++i) {
+        if (i < f.rev[i]) {
+            std::swap_ranges(re + (size_t)i * n, re + (size_t)(i + 1) * n, re + (size_t)f.rev[i] * n);
+            std::swap_ranges(im + (size_t)i * n, im + (size_t)(i + 1) * n, im + (size_t)f.rev[i] * n);
+        }
+    }
+    for (int32_t len = 2; len <= n; len <<= 1) {
+        const int32_t half = len >> 1, step = n / len;
+        for (int32_t i = 0; i < n; i += len) {
+            for (int32_t j = 0; j < half; ++j) {
+                const __m128 wr = _mm_set1_ps(f.wr[j * step]);
+                const __m128 wi = _mm_set1_ps(inverse ? -f.wi[j * step] : f.wi[j * step]);
+                float *ar = re + (size_t)(i + j) * n, *ai = im + (size_t)(i + j) * n;
+                float *br = ar + (size_t)half * n, *bi = ai + (size_t)half * n;
+                for (int32_t c = 0; c < n; c += 4) {
+                    __m128 xr = _mm_loadu_ps(br + c), xi = _mm_loadu_ps(bi + c);
+                    __m128 tr = _mm_sub_ps(_mm_mul_ps(xr, wr), _mm_mul_ps(xi, wi));
+                    __m128 ti = _mm_add_ps(_mm_mul_ps(xr, wi), _mm_mul_ps(xi, wr));
+                    __m128 yr = _mm_loadu_ps(ar + c), yi = _mm_loadu_ps(ai + c);
+                    _mm_storeu_ps(br + c, _mm_sub_ps(yr, tr));
+                    _mm_storeu_ps(bi + c, _mm_sub_ps(yi, ti));
+                    _mm_storeu_ps(ar + c, _mm_add_ps(yr, tr));
+                    _mm_storeu_ps(ai + c, _mm_add_ps(yi, ti));
+                }
+            }
+        }
+    }
+}
+
+static void mt_transpose(float *m, int32_t n)
+{
+    for (int32_t i = 0; i < n; i += 4) {
+        for (int32_t j = i; j < n; j += 4) {
+            float *p = m + (size_t)i * n + j, *q = m + (size_t)j * n + i;
+            __m128 a0 = _mm_loadu_ps(p), a1 = _mm_loadu_ps(p + n), a2 = _mm_loadu_ps(p + 2 * n), a3 = _mm_loadu_ps(p + 3 * n);
+            _MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+            if (i != j) {
+                __m128 b0 = _mm_loadu_ps(q), b1 = _mm_loadu_ps(q + n), b2 = _mm_loadu_ps(q + 2 * n), b3 = _mm_loadu_ps(q + 3 * n);
+                _MM_TRANSPOSE4_PS(b0, b1, b2, b3);
+                _mm_storeu_ps(p, b0);
+                _mm_storeu_ps(p + n, b1);
+                _mm_storeu_ps(p + 2 * n, b2);
+                _mm_storeu_ps(p + 3 * n, b3);
+            }
+            _mm_storeu_ps(q, a0);
+            _mm_storeu_ps(q + n, a1);
+            _mm_storeu_ps(q + 2 * n, a2);
+            _mm_storeu_ps(q + 3 * n, a3);
+        }
+    }
+}
+
+// 2D transform of the n x n block in `re` and `im`, the spectrum comes out transposed
+static void mt_fft_2d(float *re, float *im, const MtFFT &f, bool inverse)
+{
+    mt_fft_columns(re, im, f, inverse);
+    mt_transpose(re, f.n);
+    mt_transpose(im, f.n);
+    mt_fft_columns(re, im, f, inverse);
+}
+
+// power of two block size with the fewest transforms times their cost
+static int32_t mt_fft_size(int32_t outHeight, int32_t outWidth, int32_t templHeight, int32_t templWidth)
+{
+    int32_t best = 0;
+    double bestCost = 0;
+    for (int32_t n = 16; n <= 4096; n <<= 1) {
+        if (n < templHeight || n < templWidth) {
+            continue;
+        }
+        double blocks = ceil((double)outHeight / (n - templHeight + 1)) * ceil((double)outWidth / (2.0 * (n - templWidth + 1)));
+        double cost = blocks * n * n * (__builtin_ctz(n) + 2);
+        if (0 == best || cost < bestCost) {
+            best = n;
+            bestCost = cost;
+        }
+    }
+    return best;
+}
+
+// correlation of output rows [y0, y1), at most n - templHeight + 1 of them, by blocks of n x n input pixels. The
+// block on the left goes to the real part and the next one to the imaginary part: the template is real so their
+// correlations come back apart. Blocks have MT_CENTER taken off and the template its mean, so the float sums stay
+// small, the result Σ I * (T - mean) misses `mean * window sum`.
+static void mt_correlate_fft(
+    int32_t y0,
+    int32_t y1,
+    int32_t outWidth,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t templWidth,
+    const MtFFT &f,
+    const float *specRe,
+    const float *specIm,
+    float *re,
+    float *im,
+    double *corr,
+    int32_t corrStride)
+{
+    const int32_t n = f.n;
+    const int32_t blockWidth = n - templWidth + 1;
+    const __m128i center = _mm_set1_epi32(MT_CENTER);
+    for (int32_t x0 = 0; x0 < outWidth; x0 += 2 * blockWidth) {
+        for (int32_t k = 0; k < 2; ++k) {
+            float *dst = k ? im : re;
+            int32_t bx = x0 + k * blockWidth;
+            int32_t cols = std::max(std::min(n, inWidth - bx), 0);
+            for (int32_t r = 0; r < n; ++r) {
+                float *d = dst + (size_t)r * n;
+                int32_t c = 0;
+                if (y0 + r < inHeight) {
+                    const uint8_t *s = inData + (size_t)(y0 + r) * inWidthStride + bx;
+                    for (; c <= cols - 4; c += 4) {
+                        int32_t bytes;
+                        memcpy(&bytes, s + c, sizeof(bytes));
+                        __m128i v = _mm_sub_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(bytes)), center);
+                        _mm_storeu_ps(d + c, _mm_cvtepi32_ps(v));
+                    }
+                    for (; c < cols; ++c) {
+                        d[c] = (float)(s[c] - MT_CENTER);
+                    }
+                }
+                memset(d + c, 0, (n - c) * sizeof(float));
+            }
+        }
+        mt_fft_2d(re, im, f, false);
+        //! times the conjugate template spectrum, which also holds the 1 / n^2 of the inverse transform
+        for (int32_t i = 0; i < n * n; i += 4) {
+            __m128 a = _mm_loadu_ps(re + i), b = _mm_loadu_ps(im + i);
+            __m128 c = _mm_loadu_ps(specRe + i), d = _mm_loadu_ps(specIm + i);
+            _mm_storeu_ps(re + i, _mm_add_ps(_mm_mul_ps(a, c), _mm_mul_ps(b, d)));
+            _mm_storeu_ps(im + i, _mm_sub_ps(_mm_mul_ps(b, c), _mm_mul_ps(a, d)));
+        }
+        mt_fft_2d(re, im, f, true);
+        for (int32_t k = 0; k < 2; ++k) {
+            const float *src = k ? im : re;
+            int32_t bx = x0 + k * blockWidth;
+            int32_t cols = std::min(blockWidth, outWidth - bx);
+            for (int32_t r = 0; r < y1 - y0; ++r) {
+                double *c = corr + (size_t)r * corrStride + bx;
+                for (int32_t x = 0; x < cols; ++x) {
+                    c[x] = src[(size_t)r * n + x];
+                }
+            }
+        }
+    }
+}
+
+// OpenCV's results from the correlation `corr + corrShift * window sum` and the window sums of the band, two
+// outputs at a time in double lanes with the branches turned into blends
+static void mt_normalize(
+    int32_t rows,
+    int32_t outWidth,
+    const double *corr,
+    int32_t corrStride,
+    double corrShift,
+    const int32_t *sum,
+    const double *sqsum,
+    int32_t sumStride,
+    int32_t templHeight,
+    int32_t templWidth,
+    TemplateMatchMode method,
+    const MtTemplate &t,
+    int32_t outWidthStride,
+    float *outData)
+{
+    const bool normed = method == TM_SQDIFF_NORMED || method == TM_CCORR_NORMED || method == TM_CCOEFF_NORMED;
+    const bool sqdiff = method == TM_SQDIFF || method == TM_SQDIFF_NORMED;
+    const bool ccoeff = method == TM_CCOEFF || method == TM_CCOEFF_NORMED;
+    const double invArea = 1.0 / t.area;
+    const double outside = method != TM_SQDIFF_NORMED ? 0 : 1; //! when the correlation exceeds the norms
+    const __m128d vzero = _mm_setzero_pd(), vone = _mm_set1_pd(1.0), vhalf = _mm_set1_pd(0.5);
+    const __m128d vabs = _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffll));
+    const __m128d vshift = _mm_set1_pd(corrShift), vinvArea = _mm_set1_pd(invArea), vmean = _mm_set1_pd(t.mean);
+    const __m128d vsum2 = _mm_set1_pd(t.sum2), vnorm = _mm_set1_pd(t.norm), veps = _mm_set1_pd(10 * FLT_EPSILON);
+    const __m128d vlimit = _mm_set1_pd(1.125), voutside = _mm_set1_pd(outside);
+    for (int32_t y = 0; y < rows; ++y) {
+        const double *c = corr + (size_t)y * corrStride;
+        float *out = outData + (size_t)y * outWidthStride;
+        const int32_t *s0 = nullptr != sum ? sum + (size_t)y * sumStride : nullptr;
+        const int32_t *s1 = nullptr != sum ? s0 + (size_t)templHeight * sumStride : nullptr;
+        const double *q0 = nullptr != sqsum ? sqsum + (size_t)y * sumStride : nullptr;
+        const double *q1 = nullptr != sqsum ? q0 + (size_t)templHeight * sumStride : nullptr;
+        int32_t x = 0;
+        for (; x <= outWidth - 2; x += 2) {
+            __m128d s = vzero;
+            if (nullptr != sum) {
+                __m128i a = _mm_sub_epi32(_mm_loadl_epi64((const __m128i *)(s1 + x + templWidth)), _mm_loadl_epi64((const __m128i *)(s1 + x)));
+                __m128i b = _mm_sub_epi32(_mm_loadl_epi64((const __m128i *)(s0 + x + templWidth)), _mm_loadl_epi64((const __m128i *)(s0 + x)));
+                s = _mm_cvtepi32_pd(_mm_sub_epi32(a, b));
+            }
+            __m128d num = _mm_add_pd(_mm_loadu_pd(c + x), _mm_mul_pd(vshift, s));
+            __m128d wndMean2 = vzero, wndSum2 = vzero;
+            if (ccoeff) {
+                wndMean2 = _mm_mul_pd(_mm_mul_pd(s, s), vinvArea);
+                num = _mm_sub_pd(num, _mm_mul_pd(s, vmean));
+            }
+            if (normed || sqdiff) {
+                wndSum2 = _mm_add_pd(_mm_sub_pd(_mm_loadu_pd(q1 + x + templWidth), _mm_loadu_pd(q1 + x)),
+                    _mm_sub_pd(_mm_loadu_pd(q0 + x), _mm_loadu_pd(q0 + x + templWidth)));
+                if (sqdiff) {
+                    num = _mm_max_pd(_mm_add_pd(_mm_sub_pd(wndSum2, _mm_add_pd(num, num)), vsum2), vzero);
+                }
+            }
+            if (normed) {
+                __m128d diff2 = _mm_max_pd(_mm_sub_pd(wndSum2, wndMean2), vzero);
+                __m128d tiny = _mm_cmple_pd(diff2, _mm_min_pd(vhalf, _mm_mul_pd(veps, wndSum2)));
+                __m128d d = _mm_andnot_pd(tiny, _mm_mul_pd(_mm_sqrt_pd(diff2), vnorm));
+                __m128d a = _mm_and_pd(num, vabs);
+                __m128d sign = _mm_blendv_pd(_mm_sub_pd(vzero, vone), vone, _mm_cmpgt_pd(num, vzero));
+                __m128d r = _mm_blendv_pd(voutside, sign, _mm_cmplt_pd(a, _mm_mul_pd(d, vlimit)));
+                num = _mm_blendv_pd(r, _mm_div_pd(num, d), _mm_cmplt_pd(a, d));
+            }
+            __m128 f = _mm_cvtpd_ps(num);
+            _mm_storel_pi((__m64 *)(out + x), f);
+        }
+        for (; x < outWidth; ++x) {
+            double s = nullptr != sum ? s1[x + templWidth] - s1[x] - s0[x + templWidth] + s0[x] : 0;
+            double num = c[x] + corrShift * s;
+            double wndMean2 = 0, wndSum2 = 0;
+            if (ccoeff) {
+                wndMean2 = s * s * invArea;
+                num -= s * t.mean;
+            }
+            if (normed || sqdiff) {
+                wndSum2 = q1[x + templWidth] - q1[x] - q0[x + templWidth] + q0[x];
+                if (sqdiff) {
+                    num = std::max(wndSum2 - 2 * num + t.sum2, 0.0);
+                }
+            }
+            if (normed) {
+                double diff2 = std::max(wndSum2 - wndMean2, 0.0);
+                double d = diff2 <= std::min(0.5, 10 * FLT_EPSILON * wndSum2) ? 0 : sqrt(diff2) * t.norm;
+                if (fabs(num) < d) {
+                    num /= d;
+                } else if (fabs(num) < d * 1.125) {
+                    num = num > 0 ? 1 : -1;
+                } else {
+                    num = outside;
+                }
+            }
+            out[x] = (float)num;
+        }
+    }
+}
+
+void MatchTemplate(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t templHeight,
+    int32_t templWidth,
+    int32_t templWidthStride,
+    const uint8_t *templData,
+    int32_t outWidthStride,
+    float *outData,
+    TemplateMatchMode method,
+    int32_t numThreads)
+{
+    if (nullptr == inData || nullptr == templData || nullptr == outData) {
+        return;
+    }
+    if (templHeight <= 0 || templWidth <= 0 || templHeight > inHeight || templWidth > inWidth) {
+        return;
+    }
+    const int32_t outHeight = inHeight - templHeight + 1;
+    const int32_t outWidth = inWidth - templWidth + 1;
+    if (inWidthStride < inWidth || templWidthStride < templWidth || outWidthStride < outWidth) {
+        return;
+    }
+    if (method < TM_SQDIFF || method > TM_CCOEFF_NORMED) {
+        return;
+    }
+    const MtTemplate t = mt_template_stats(templHeight, templWidth, templWidthStride, templData, method);
+    if (t.flat) {
+        for (int32_t y = 0; y < outHeight; ++y) {
+            std::fill(outData + (size_t)y * outWidthStride, outData + (size_t)y * outWidthStride + outWidth, 1.0f);
+        }
+        return;
+    }
+
+    const bool spatial = templHeight * templWidth <= MT_SPATIAL_MAX_AREA;
+    const int32_t n = spatial ? 0 : mt_fft_size(outHeight, outWidth, templHeight, templWidth);
+    const int32_t bandRows = spatial ? MT_BAND_ROWS : n - templHeight + 1;
+    const bool needSum = !spatial || method >= TM_CCOEFF;
+    const bool needSqsum = method != TM_CCORR && method != TM_CCOEFF;
+    const int32_t sumStride = inWidth + 1;
+    const int32_t bands = (outHeight + bandRows - 1) / bandRows;
+    const int32_t ranges = std::max(std::min(bands, numThreads), 1);
+
+    //! the template taps or spectrum, then the buffers of each range of bands, reused by its bands
+    uint64_t size_for_taps = spatial ? ((uint64_t)4 * templHeight * ((templWidth + 1) / 2) * sizeof(int32_t) + 64 - 1) / 64 * 64 : 0;
+    uint64_t size_for_fft = spatial ? 0 : mt_fft_buffer_size(n);
+    uint64_t size_for_spec = spatial ? 0 : ((uint64_t)n * n * sizeof(float) + 64 - 1) / 64 * 64;
+    uint64_t size_for_corr = ((uint64_t)bandRows * outWidth * sizeof(double) + 64 - 1) / 64 * 64;
+    uint64_t size_for_sum = needSum || needSqsum ? ((uint64_t)(bandRows + templHeight) * sumStride * sizeof(int32_t) + 64 - 1) / 64 * 64 : 0;
+    uint64_t size_for_sqsum = needSqsum ? ((uint64_t)(bandRows + templHeight) * sumStride * sizeof(double) + 64 - 1) / 64 * 64 : 0;
+    uint64_t size_for_rows = spatial ? ((uint64_t)(bandRows + templHeight - 1) * mt_spatial_row_stride(outWidth, templWidth) * sizeof(int16_t) + 64 - 1) / 64 * 64 : 0;
+    uint64_t size_for_acc = spatial ? ((uint64_t)(outWidth + 7) / 8 * 8 * sizeof(int32_t) + 64 - 1) / 64 * 64 : 0;
+    uint64_t size_for_range = size_for_corr + size_for_sum + size_for_sqsum + size_for_rows + size_for_acc + size_for_spec * 2;
+
+    uint64_t total_size = size_for_taps + size_for_fft + size_for_spec * 2 + size_for_range * ranges;
+
+    void *temp_buffer = tinycv::ScratchAlloc(total_size, 64);
+    int32_t *taps = (int32_t *)temp_buffer; //! pairs of taps, 4 copies for the 4 lanes
+    unsigned char *fftBuffer = (unsigned char *)taps + size_for_taps;
+    float *specRe = (float *)(fftBuffer + size_for_fft);
+    float *specIm = (float *)((unsigned char *)specRe + size_for_spec);
+    unsigned char *rangeBuffers = (unsigned char *)specIm + size_for_spec;
+    MtFFT fft = {};
+    if (spatial) {
+        const int32_t pairs = (templWidth + 1) / 2;
+        for (int32_t ty = 0; ty < templHeight; ++ty) {
+            const uint8_t *tr = templData + (size_t)ty * templWidthStride;
+            for (int32_t k = 0; k < pairs; ++k) {
+                int32_t hi = 2 * k + 1 < templWidth ? tr[2 * k + 1] : 0;
+                std::fill_n(taps + 4 * (ty * pairs + k), 4, tr[2 * k] | (hi << 16));
+            }
+        }
+    } else {
+        mt_fft_init(fft, n, fftBuffer);
+        memset(specRe, 0, (size_t)n * n * sizeof(float));
+        memset(specIm, 0, (size_t)n * n * sizeof(float));
+        for (int32_t ty = 0; ty < templHeight; ++ty) {
+            for (int32_t tx = 0; tx < templWidth; ++tx) {
+                specRe[(size_t)ty * n + tx] = (float)(templData[(size_t)ty * templWidthStride + tx] - t.mean);
+            }
+        }
+        mt_fft_2d(specRe, specIm, fft, false);
+        //! conjugated and scaled for the inverse transform
+        const float scale = 1.0f / ((float)n * n);
+        for (size_t i = 0; i < (size_t)n * n; ++i) {
+            specRe[i] *= scale;
+            specIm[i] *= scale;
+        }
+    }
+
+    ParallelFor(ranges, ranges, [&](int32_t r0, int32_t r1) {
+        for (int32_t r = r0; r < r1; ++r) {
+            unsigned char *buffer = rangeBuffers + size_for_range * r;
+            double *corr = (double *)buffer;
+            int32_t *sum = (int32_t *)(buffer + size_for_corr);
+            double *sqsum = (double *)((unsigned char *)sum + size_for_sum);
+            int16_t *rows = (int16_t *)((unsigned char *)sqsum + size_for_sqsum);
+            int32_t *acc = (int32_t *)((unsigned char *)rows + size_for_rows);
+            float *re = (float *)((unsigned char *)acc + size_for_acc);
+            float *im = (float *)((unsigned char *)re + size_for_spec);
+            for (int32_t b = (int32_t)((int64_t)bands * r / ranges); b < (int32_t)((int64_t)bands * (r + 1) / ranges); ++b) {
+                const int32_t y0 = b * bandRows;
+                const int32_t y1 = std::min(outHeight, y0 + bandRows);
+                const int32_t inRows = y1 - y0 + templHeight - 1;
+                if (spatial) {
+                    mt_correlate_spatial(y0, y1, outWidth, inWidth, inWidthStride, inData, templHeight, templWidth, taps, rows, acc, corr, outWidth);
+                } else {
+                    mt_correlate_fft(y0, y1, outWidth, inHeight, inWidth, inWidthStride, inData, templWidth, fft, specRe, specIm, re, im, corr, outWidth);
+                }
+                const uint8_t *bandIn = inData + (size_t)y0 * inWidthStride;
+                if (needSqsum) {
+                    IntegralSqr<int32_t, 1>(inRows, inWidth, inWidthStride, bandIn, sumStride, sum, sumStride, sqsum);
+                } else if (needSum) {
+                    Integral<int32_t, 1>(inRows, inWidth, inWidthStride, bandIn, sumStride, sum);
+                }
+                mt_normalize(y1 - y0, outWidth, corr, outWidth, spatial ? 0 : t.mean, needSum ? sum : nullptr, needSqsum ? sqsum : nullptr, sumStride, templHeight, templWidth, method, t, outWidthStride, outData + (size_t)y0 * outWidthStride);
+            }
+        }
+    });
+
+    tinycv::ScratchFree(temp_buffer);
+}
+
+} // namespace tinycv
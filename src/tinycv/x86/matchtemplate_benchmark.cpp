@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/matchtemplate.h"
+#include "tinycv/debug.h"
+
+#include <opencv2/imgproc.hpp>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace {
+
+template <tinycv::TemplateMatchMode method>
+void BM_MatchTemplate_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t templSize = state.range(2);
+    int32_t numThreads = state.range(3);
+    int32_t outWidth = width - templSize + 1;
+    int32_t outHeight = height - templSize + 1;
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> templ(new uint8_t[templSize * templSize]);
+    std::unique_ptr<float[]> dst(new float[outWidth * outHeight]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    tinycv::debug::randomFill<uint8_t>(templ.get(), templSize * templSize, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::MatchTemplate(height, width, width, src.get(), templSize, templSize, templSize, templ.get(), outWidth, dst.get(), method, numThreads);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_MatchTemplate_tinycv_x86, tinycv::TM_CCOEFF_NORMED)->Args({640, 480, 8, 1})->Args({640, 480, 32, 1})->Args({1920, 1080, 64, 1})->Args({1920, 1080, 64, 4});
+BENCHMARK_TEMPLATE(BM_MatchTemplate_tinycv_x86, tinycv::TM_SQDIFF)->Args({640, 480, 8, 1})->Args({640, 480, 32, 1});
+
+#ifdef TINYCV_BENCHMARK_OPENCV
+template <tinycv::TemplateMatchMode method>
+static void BM_MatchTemplate_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t templSize = state.range(2);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> templ(new uint8_t[templSize * templSize]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    tinycv::debug::randomFill<uint8_t>(templ.get(), templSize * templSize, 0, 255);
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat tMat(templSize, templSize, CV_8UC1, templ.get());
+    cv::Mat oMat;
+    for (auto _ : state) {
+        cv::matchTemplate(iMat, tMat, oMat, (int)method);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_MatchTemplate_opencv_x86, tinycv::TM_CCOEFF_NORMED)->Args({640, 480, 8})->Args({640, 480, 32})->Args({1920, 1080, 64});
+BENCHMARK_TEMPLATE(BM_MatchTemplate_opencv_x86, tinycv::TM_SQDIFF)->Args({640, 480, 8})->Args({640, 480, 32});
+
+#endif //! TINYCV_BENCHMARK_OPENCV
+} // namespace
@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/matchtemplate.h"
+#include "tinycv/x86/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <algorithm>
+#include <memory>
+
+void MatchTemplateTest(int32_t height, int32_t width, int32_t templHeight, int32_t templWidth, tinycv::TemplateMatchMode method, int32_t numThreads)
+{
+    const int32_t outHeight = height - templHeight + 1;
+    const int32_t outWidth = width - templWidth + 1;
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> templ(new uint8_t[templWidth * templHeight]);
+    std::unique_ptr<float[]> dst(new float[outWidth * outHeight]);
+    std::unique_ptr<float[]> dst_opencv(new float[outWidth * outHeight]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+    //! the template is cut out of the image so there is a perfect match
+    const int32_t templY = std::min(height / 3, height - templHeight);
+    const int32_t templX = std::min(width / 4, width - templWidth);
+    for (int32_t y = 0; y < templHeight; ++y) {
+        memcpy(templ.get() + y * templWidth, src.get() + (templY + y) * width + templX, templWidth);
+    }
+
+    tinycv::MatchTemplate(height, width, width, src.get(), templHeight, templWidth, templWidth, templ.get(), outWidth, dst.get(), method, numThreads);
+
+    cv::Mat iMat(height, width, CV_8UC1, src.get());
+    cv::Mat tMat(templHeight, templWidth, CV_8UC1, templ.get());
+    cv::Mat oMat(outHeight, outWidth, CV_32FC1, dst_opencv.get());
+    cv::matchTemplate(iMat, tMat, oMat, (int)method);
+
+    //! both work in float, errors scale with the largest result for the unnormalised methods
+    float diff_THR = 1e-4f;
+    if (method == tinycv::TM_SQDIFF || method == tinycv::TM_CCORR || method == tinycv::TM_CCOEFF) {
+        diff_THR = 2e-5f * 255 * 255 * templHeight * templWidth;
+    }
+    checkResult<float, 1>(dst.get(), dst_opencv.get(), outHeight, outWidth, outWidth, outWidth, diff_THR);
+}
+
+TEST(MATCH_TEMPLATE_SPATIAL, x86)
+{
+    for (int32_t method = tinycv::TM_SQDIFF; method <= tinycv::TM_CCOEFF_NORMED; ++method) {
+        MatchTemplateTest(480, 640, 8, 8, (tinycv::TemplateMatchMode)method, 1);
+        MatchTemplateTest(101, 99, 5, 7, (tinycv::TemplateMatchMode)method, 4);
+        MatchTemplateTest(7, 9, 1, 1, (tinycv::TemplateMatchMode)method, 1);
+    }
+}
+
+TEST(MATCH_TEMPLATE_FFT, x86)
+{
+    for (int32_t method = tinycv::TM_SQDIFF; method <= tinycv::TM_CCOEFF_NORMED; ++method) {
+        MatchTemplateTest(480, 640, 32, 32, (tinycv::TemplateMatchMode)method, 1);
+        MatchTemplateTest(480, 640, 17, 45, (tinycv::TemplateMatchMode)method, 4);
+        MatchTemplateTest(101, 99, 64, 20, (tinycv::TemplateMatchMode)method, 1);
+        MatchTemplateTest(40, 40, 40, 40, (tinycv::TemplateMatchMode)method, 1);
+    }
+}
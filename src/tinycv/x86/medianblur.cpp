@@ -0,0 +1,472 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/medianblur.h"
+#include "tinycv/types.h"
+#include "tinycv/sys.h"
+
+#include <string.h>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace tinycv {
+
+// the histogram filter works on vertical stripes of about this many elements, the column histograms of a stripe
+// then stay in the L2 cache
+#define MEDIAN_HIST_STRIPE 512
+
+template <typename T>
+struct MedianOp;
+
+template <>
+struct MedianOp<uint8_t> {
+    typedef __m128i vec_t;
+    enum { VLEN = 16 };
+    static inline uint8_t vmin(uint8_t a, uint8_t b)
+    {
+        return a < b ? a : b;
+    }
+    static inline uint8_t vmax(uint8_t a, uint8_t b)
+    {
+        return a > b ? a : b;
+    }
+    static inline __m128i vmin(__m128i a, __m128i b)
+    {
+        return _mm_min_epu8(a, b);
+    }
+    static inline __m128i vmax(__m128i a, __m128i b)
+    {
+        return _mm_max_epu8(a, b);
+    }
+    static inline __m128i load(const uint8_t *p)
+    {
+        return _mm_loadu_si128((const __m128i *)p);
+    }
+    static inline void store(uint8_t *p, __m128i v)
+    {
+        _mm_storeu_si128((__m128i *)p, v);
+    }
+};
+
+template <>
+struct MedianOp<float> {
+    typedef __m128 vec_t;
+    enum { VLEN = 4 };
+    static inline float vmin(float a, float b)
+    {
+        return a < b ? a : b;
+    }
+    static inline float vmax(float a, float b)
+    {
+        return a > b ? a : b;
+    }
+    static inline __m128 vmin(__m128 a, __m128 b)
+    {
+        return _mm_min_ps(a, b);
+    }
+    static inline __m128 vmax(__m128 a, __m128 b)
+    {
+        return _mm_max_ps(a, b);
+    }
+    static inline __m128 load(const float *p)
+    {
+        return _mm_loadu_ps(p);
+    }
+    static inline void store(float *p, __m128 v)
+    {
+        _mm_storeu_ps(p, v);
+    }
+};
+
+// comparators of the sorting networks, median_min and median_max are the halves of one whose other output is
+// never used by the median
+template <typename Op, typename V>
+static inline void median_sort(V &a, V &b)
+{
+    V t = Op::vmin(a, b);
+    b = Op::vmax(a, b);
+    a = t;
+}
+
+template <typename Op, typename V>
+static inline void median_min(V &a, V b)
+{
+    a = Op::vmin(a, b);
+}
+
+template <typename Op, typename V>
+static inline void median_max(V a, V &b)
+{
+    b = Op::vmax(a, b);
+}
+
+template <int32_t ksize>
+struct MedianNetwork;
+
+template <>
+struct MedianNetwork<3> {
+    // 19 comparators, 11 full ones
+    template <typename Op, typename V>
+    static inline V run(V *p)
+    {
+        median_sort<Op>(p[1], p[2]); median_sort<Op>(p[4], p[5]); median_sort<Op>(p[7], p[8]);
+        median_sort<Op>(p[0], p[1]); median_sort<Op>(p[3], p[4]); median_sort<Op>(p[6], p[7]);
+        median_sort<Op>(p[1], p[2]); median_sort<Op>(p[4], p[5]); median_sort<Op>(p[7], p[8]);
+        median_max<Op>(p[0], p[3]); median_min<Op>(p[5], p[8]); median_sort<Op>(p[4], p[7]);
+        median_max<Op>(p[3], p[6]); median_max<Op>(p[1], p[4]); median_min<Op>(p[2], p[5]); median_min<Op>(p[4], p[7]);
+        median_sort<Op>(p[4], p[2]); median_max<Op>(p[6], p[4]); median_min<Op>(p[4], p[2]);
+        return p[4];
+    }
+};
+
+template <>
+struct MedianNetwork<5> {
+    // 99 comparators, 75 full ones
+    template <typename Op, typename V>
+    static inline V run(V *p)
+    {
+        median_sort<Op>(p[0], p[1]); median_sort<Op>(p[3], p[4]); median_sort<Op>(p[2], p[4]);
+        median_sort<Op>(p[2], p[3]); median_sort<Op>(p[6], p[7]); median_sort<Op>(p[5], p[7]);
+        median_sort<Op>(p[5], p[6]); median_sort<Op>(p[9], p[10]); median_sort<Op>(p[8], p[10]);
+        median_sort<Op>(p[8], p[9]); median_sort<Op>(p[12], p[13]); median_sort<Op>(p[11], p[13]);
+        median_sort<Op>(p[11], p[12]); median_sort<Op>(p[15], p[16]); median_sort<Op>(p[14], p[16]);
+        median_sort<Op>(p[14], p[15]); median_sort<Op>(p[18], p[19]); median_sort<Op>(p[17], p[19]);
+        median_sort<Op>(p[17], p[18]); median_sort<Op>(p[21], p[22]); median_sort<Op>(p[20], p[22]);
+        median_sort<Op>(p[20], p[21]); median_sort<Op>(p[23], p[24]); median_sort<Op>(p[2], p[5]);
+        median_sort<Op>(p[3], p[6]); median_sort<Op>(p[0], p[6]); median_sort<Op>(p[0], p[3]);
+        median_sort<Op>(p[4], p[7]); median_sort<Op>(p[1], p[7]); median_sort<Op>(p[1], p[4]);
+        median_sort<Op>(p[11], p[14]); median_sort<Op>(p[8], p[14]); median_sort<Op>(p[8], p[11]);
+        median_sort<Op>(p[12], p[15]); median_sort<Op>(p[9], p[15]); median_sort<Op>(p[9], p[12]);
+        median_sort<Op>(p[13], p[16]); median_sort<Op>(p[10], p[16]); median_sort<Op>(p[10], p[13]);
+        median_sort<Op>(p[20], p[23]); median_sort<Op>(p[17], p[23]); median_sort<Op>(p[17], p[20]);
+        median_sort<Op>(p[21], p[24]); median_sort<Op>(p[18], p[24]); median_sort<Op>(p[18], p[21]);
+        median_sort<Op>(p[19], p[22]); median_max<Op>(p[8], p[17]); median_sort<Op>(p[9], p[18]);
+        median_sort<Op>(p[0], p[18]); median_max<Op>(p[0], p[9]); median_sort<Op>(p[10], p[19]);
+        median_sort<Op>(p[1], p[19]); median_sort<Op>(p[1], p[10]); median_sort<Op>(p[11], p[20]);
+        median_sort<Op>(p[2], p[20]); median_max<Op>(p[2], p[11]); median_sort<Op>(p[12], p[21]);
+        median_sort<Op>(p[3], p[21]); median_sort<Op>(p[3], p[12]); median_sort<Op>(p[13], p[22]);
+        median_min<Op>(p[4], p[22]); median_sort<Op>(p[4], p[13]); median_sort<Op>(p[14], p[23]);
+        median_sort<Op>(p[5], p[23]); median_sort<Op>(p[5], p[14]); median_sort<Op>(p[15], p[24]);
+        median_min<Op>(p[6], p[24]); median_sort<Op>(p[6], p[15]); median_min<Op>(p[7], p[16]);
+        median_min<Op>(p[7], p[19]); median_min<Op>(p[13], p[21]); median_min<Op>(p[15], p[23]);
+        median_min<Op>(p[7], p[13]); median_min<Op>(p[7], p[15]); median_max<Op>(p[1], p[9]);
+        median_max<Op>(p[3], p[11]); median_max<Op>(p[5], p[17]); median_max<Op>(p[11], p[17]);
+        median_max<Op>(p[9], p[17]); median_sort<Op>(p[4], p[10]); median_sort<Op>(p[6], p[12]);
+        median_sort<Op>(p[7], p[14]); median_sort<Op>(p[4], p[6]); median_max<Op>(p[4], p[7]);
+        median_sort<Op>(p[12], p[14]); median_min<Op>(p[10], p[14]); median_sort<Op>(p[6], p[7]);
+        median_sort<Op>(p[10], p[12]); median_sort<Op>(p[6], p[10]); median_max<Op>(p[6], p[17]);
+        median_sort<Op>(p[12], p[17]); median_min<Op>(p[7], p[17]); median_sort<Op>(p[7], p[10]);
+        median_sort<Op>(p[12], p[18]); median_max<Op>(p[7], p[12]); median_min<Op>(p[10], p[18]);
+        median_sort<Op>(p[12], p[20]); median_min<Op>(p[10], p[20]); median_max<Op>(p[10], p[12]);
+        return p[12];
+    }
+};
+
+// the last ksize source rows padded with replicated edge pixels, a row is padded once and used by ksize output rows
+template <typename T>
+class MedianRows {
+public:
+    MedianRows(int32_t ksize, int32_t width, int32_t channels, int32_t inWidthStride, const T *inData)
+        : ksize_(ksize)
+        , width_(width)
+        , channels_(channels)
+        , length_((width + ksize - 1) * channels)
+        , inWidthStride_(inWidthStride)
+        , inData_(inData)
+    {
+        uint64_t size_for_rows = ((uint64_t)ksize * length_ * sizeof(T) + 64 - 1) / 64 * 64;
+        uint64_t size_for_tags = ((uint64_t)ksize * sizeof(int32_t) + 64 - 1) / 64 * 64;
+        rows_ = (T *)tinycv::ScratchAlloc(size_for_rows + size_for_tags, 64);
+        tags_ = (int32_t *)((unsigned char *)rows_ + size_for_rows);
+        std::fill(tags_, tags_ + ksize, -1);
+    }
+    ~MedianRows()
+    {
+        tinycv::ScratchFree(rows_);
+    }
+
+    const T *row(int32_t sy)
+    {
+        int32_t slot = sy % ksize_;
+        T *dst = rows_ + (size_t)slot * length_;
+        if (tags_[slot] != sy) {
+            const T *src = inData_ + (size_t)sy * inWidthStride_;
+            int32_t radius = ksize_ / 2;
+            int32_t cn = channels_;
+            memcpy(dst + radius * cn, src, width_ * cn * sizeof(T));
+            for (int32_t i = 0; i < radius; ++i) {
+                for (int32_t c = 0; c < cn; ++c) {
+                    dst[i * cn + c] = src[c];
+                    dst[(radius + width_ + i) * cn + c] = src[(width_ - 1) * cn + c];
+                }
+            }
+            tags_[slot] = sy;
+        }
+        return dst;
+    }
+
+private:
+    int32_t ksize_;
+    int32_t width_;
+    int32_t channels_;
+    int32_t length_;
+    int32_t inWidthStride_;
+    const T *inData_;
+    T *rows_;
+    int32_t *tags_;
+};
+
+// one output row of the sorting network, rows[dy] are the padded rows of the aperture
+template <typename T, int32_t ksize>
+static void median_network_row(const T *const *rows, int32_t cn, int32_t n, T *dst)
+{
+    typedef MedianOp<T> Op;
+    const int32_t VLEN = Op::VLEN;
+    int32_t i = 0;
+    for (; i <= n - VLEN; i += VLEN) {
+        typename Op::vec_t p[ksize * ksize];
+        for (int32_t dy = 0; dy < ksize; ++dy) {
+            for (int32_t dx = 0; dx < ksize; ++dx) {
+                p[dy * ksize + dx] = Op::load(rows[dy] + i + dx * cn);
+            }
+        }
+        Op::store(dst + i, MedianNetwork<ksize>::template run<Op>(p));
+    }
+    for (; i < n; ++i) {
+        T p[ksize * ksize];
+        for (int32_t dy = 0; dy < ksize; ++dy) {
+            for (int32_t dx = 0; dx < ksize; ++dx) {
+                p[dy * ksize + dx] = rows[dy][i + dx * cn];
+            }
+        }
+        dst[i] = MedianNetwork<ksize>::template run<Op>(p);
+    }
+}
+
+template <typename T, int32_t channels, int32_t ksize>
+static void median_network(int32_t height, int32_t width, int32_t inWidthStride, const T *inData, int32_t outWidthStride, T *outData)
+{
+    const int32_t radius = ksize / 2;
+    MedianRows<T> cache(ksize, width, channels, inWidthStride, inData);
+    const T *rows[ksize];
+    for (int32_t y = 0; y < height; ++y) {
+        for (int32_t dy = 0; dy < ksize; ++dy) {
+            int32_t sy = std::min(std::max(y + dy - radius, 0), height - 1);
+            rows[dy] = cache.row(sy);
+        }
+        median_network_row<T, ksize>(rows, channels, width * channels, outData + (size_t)y * outWidthStride);
+    }
+}
+
+// 16 bins of a histogram at once
+static inline void median_hist_add(uint16_t *dst, const uint16_t *src)
+{
+    __m128i v0 = _mm_add_epi16(_mm_loadu_si128((const __m128i *)dst), _mm_loadu_si128((const __m128i *)src));
+    __m128i v1 = _mm_add_epi16(_mm_loadu_si128((const __m128i *)(dst + 8)), _mm_loadu_si128((const __m128i *)(src + 8)));
+    _mm_storeu_si128((__m128i *)dst, v0);
+    _mm_storeu_si128((__m128i *)(dst + 8), v1);
+}
+
+static inline void median_hist_sub(uint16_t *dst, const uint16_t *src)
+{
+    __m128i v0 = _mm_sub_epi16(_mm_loadu_si128((const __m128i *)dst), _mm_loadu_si128((const __m128i *)src));
+    __m128i v1 = _mm_sub_epi16(_mm_loadu_si128((const __m128i *)(dst + 8)), _mm_loadu_si128((const __m128i *)(src + 8)));
+    _mm_storeu_si128((__m128i *)dst, v0);
+    _mm_storeu_si128((__m128i *)(dst + 8), v1);
+}
+
+// index of the first of 16 bins whose running count exceeds rank, `below` gets the count before that bin
+static inline int32_t median_hist_find(const uint16_t *hist, int32_t rank, int32_t *below)
+{
+    __m128i v0 = _mm_loadu_si128((const __m128i *)hist);
+    __m128i v1 = _mm_loadu_si128((const __m128i *)(hist + 8));
+    v0 = _mm_add_epi16(v0, _mm_slli_si128(v0, 2));
+    v1 = _mm_add_epi16(v1, _mm_slli_si128(v1, 2));
+    v0 = _mm_add_epi16(v0, _mm_slli_si128(v0, 4));
+    v1 = _mm_add_epi16(v1, _mm_slli_si128(v1, 4));
+    v0 = _mm_add_epi16(v0, _mm_slli_si128(v0, 8));
+    v1 = _mm_add_epi16(v1, _mm_slli_si128(v1, 8));
+    __m128i last = _mm_shufflehi_epi16(v0, 0xff);
+    v1 = _mm_add_epi16(v1, _mm_unpackhi_epi64(last, last));
+    //! counts reach ksize * ksize, compare unsigned: prefix > rank where max(prefix, rank + 1) == prefix
+    __m128i r = _mm_set1_epi16((int16_t)(rank + 1));
+    __m128i g0 = _mm_cmpeq_epi16(_mm_max_epu16(v0, r), v0);
+    __m128i g1 = _mm_cmpeq_epi16(_mm_max_epu16(v1, r), v1);
+    int32_t mask = _mm_movemask_epi8(_mm_packs_epi16(g0, g1)) | 0x8000;
+    int32_t i = __builtin_ctz(mask);
+    uint16_t prefix[16];
+    _mm_storeu_si128((__m128i *)prefix, v0);
+    _mm_storeu_si128((__m128i *)(prefix + 8), v1);
+    *below += i > 0 ? prefix[i - 1] : 0;
+    return i;
+}
+
+// Perreault and Hébert, "Median Filtering in Constant Time": every column of the stripe keeps a histogram of its
+// ksize pixels in the aperture rows, updated by one removal and one insertion per row. The aperture histogram slides
+// along the row by adding one column histogram and subtracting another. Histograms are two level, the 16 coarse
+// bins locate the median's high nibble and only that fine bin group is brought up to date, lazily from the
+// column where it was last used.
+template <int32_t channels>
+static void median_hist(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t ksize)
+{
+    const int32_t radius = ksize / 2;
+    const int32_t rank = ksize * ksize / 2;
+    const int32_t stripe = std::max(MEDIAN_HIST_STRIPE / channels, ksize);
+    const int32_t maxColumns = (std::min(stripe, width) + 2 * radius) * channels;
+
+    uint64_t size_for_coarse = ((uint64_t)maxColumns * 16 * sizeof(uint16_t) + 64 - 1) / 64 * 64;
+    uint64_t size_for_fine = ((uint64_t)maxColumns * 256 * sizeof(uint16_t) + 64 - 1) / 64 * 64;
+    uint64_t size_for_xofs = ((uint64_t)maxColumns * sizeof(int32_t) + 64 - 1) / 64 * 64;
+
+    uint64_t total_size = size_for_coarse + size_for_fine + size_for_xofs;
+
+    void *temp_buffer = tinycv::ScratchAlloc(total_size, 64);
+    uint16_t *coarse = (uint16_t *)temp_buffer;
+    uint16_t *fine = (uint16_t *)((unsigned char *)coarse + size_for_coarse);
+    int32_t *xofs = (int32_t *)((unsigned char *)fine + size_for_fine);
+
+    uint16_t kernelCoarse[channels][16];
+    uint16_t kernelFine[channels][256];
+    int32_t fineAt[channels][16];
+
+    for (int32_t x0 = 0; x0 < width; x0 += stripe) {
+        const int32_t outWidth = std::min(stripe, width - x0);
+        const int32_t columns = (outWidth + 2 * radius) * channels;
+        for (int32_t j = 0; j < columns; ++j) {
+            int32_t sx = std::min(std::max(x0 + j / channels - radius, 0), width - 1);
+            xofs[j] = sx * channels + j % channels;
+        }
+        memset(coarse, 0, (size_t)columns * 16 * sizeof(uint16_t));
+        memset(fine, 0, (size_t)columns * 256 * sizeof(uint16_t));
+        for (int32_t dy = -radius; dy <= radius; ++dy) {
+            const uint8_t *src = inData + (size_t)std::min(std::max(dy, 0), height - 1) * inWidthStride;
+            for (int32_t j = 0; j < columns; ++j) {
+                uint8_t v = src[xofs[j]];
+                ++coarse[j * 16 + (v >> 4)];
+                ++fine[j * 256 + v];
+            }
+        }
+
+        for (int32_t y = 0; y < height; ++y) {
+            if (y > 0) {
+                const uint8_t *rem = inData + (size_t)std::max(y - radius - 1, 0) * inWidthStride;
+                const uint8_t *add = inData + (size_t)std::min(y + radius, height - 1) * inWidthStride;
+                for (int32_t j = 0; j < columns; ++j) {
+                    uint8_t r = rem[xofs[j]];
+                    uint8_t a = add[xofs[j]];
+                    --coarse[j * 16 + (r >> 4)];
+                    --fine[j * 256 + r];
+                    ++coarse[j * 16 + (a >> 4)];
+                    ++fine[j * 256 + a];
+                }
+            }
+
+            memset(kernelCoarse, 0, sizeof(kernelCoarse));
+            for (int32_t c = 0; c < channels; ++c) {
+                for (int32_t k = 0; k < ksize; ++k) {
+                    median_hist_add(kernelCoarse[c], coarse + (k * channels + c) * 16);
+                }
+                for (int32_t b = 0; b < 16; ++b) {
+                    fineAt[c][b] = -ksize;
+                }
+            }
+            uint8_t *dst = outData + (size_t)y * outWidthStride + x0 * channels;
+            for (int32_t x = 0; x < outWidth; ++x) {
+                for (int32_t c = 0; c < channels; ++c) {
+                    if (x > 0) {
+                        median_hist_sub(kernelCoarse[c], coarse + ((x - 1) * channels + c) * 16);
+                        median_hist_add(kernelCoarse[c], coarse + ((x + ksize - 1) * channels + c) * 16);
+                    }
+                    int32_t below = 0;
+                    int32_t b = median_hist_find(kernelCoarse[c], rank, &below);
+
+                    //! bring fine group b from the aperture at fineAt[c][b] to the one at x
+                    uint16_t *hf = kernelFine[c] + b * 16;
+                    int32_t from = fineAt[c][b];
+                    if (from <= x - ksize) {
+                        memset(hf, 0, 16 * sizeof(uint16_t));
+                        for (int32_t k = 0; k < ksize; ++k) {
+                            median_hist_add(hf, fine + ((x + k) * channels + c) * 256 + b * 16);
+                        }
+                    } else {
+                        for (int32_t p = from; p < x; ++p) {
+                            median_hist_sub(hf, fine + (p * channels + c) * 256 + b * 16);
+                            median_hist_add(hf, fine + ((p + ksize) * channels + c) * 256 + b * 16);
+                        }
+                    }
+                    fineAt[c][b] = x;
+
+                    int32_t v = median_hist_find(hf, rank - below, &below);
+                    dst[x * channels + c] = (uint8_t)(b * 16 + v);
+                }
+            }
+        }
+    }
+
+    tinycv::ScratchFree(temp_buffer);
+}
+
+// no histogram filter for float, larger apertures are rejected before
+template <int32_t channels>
+static void median_hist(int32_t, int32_t, int32_t, const float *, int32_t, float *, int32_t) {}
+
+template <typename T, int32_t channels>
+static void median_copy(int32_t height, int32_t width, int32_t inWidthStride, const T *inData, int32_t outWidthStride, T *outData)
+{
+    for (int32_t y = 0; y < height; ++y) {
+        memcpy(outData + (size_t)y * outWidthStride, inData + (size_t)y * inWidthStride, width * channels * sizeof(T));
+    }
+}
+
+template <typename T, int32_t channels>
+void MedianBlur(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t ksize)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * channels || outWidthStride < width * channels) {
+        return;
+    }
+    if (ksize <= 0 || ksize % 2 == 0 || ksize > (sizeof(T) == 1 ? 255 : 5)) {
+        return;
+    }
+    if (ksize == 1) {
+        median_copy<T, channels>(height, width, inWidthStride, inData, outWidthStride, outData);
+    } else if (ksize == 3) {
+        median_network<T, channels, 3>(height, width, inWidthStride, inData, outWidthStride, outData);
+    } else if (ksize == 5) {
+        median_network<T, channels, 5>(height, width, inWidthStride, inData, outWidthStride, outData);
+    } else {
+        median_hist<channels>(height, width, inWidthStride, inData, outWidthStride, outData, ksize);
+    }
+}
+
+template void MedianBlur<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t ksize);
+template void MedianBlur<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t ksize);
+template void MedianBlur<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t ksize);
+template void MedianBlur<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t ksize);
+template void MedianBlur<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t ksize);
+template void MedianBlur<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t ksize);
+
+} // namespace tinycv
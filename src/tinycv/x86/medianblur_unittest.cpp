@@ -0,0 +1,68 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/medianblur.h"
+#include "tinycv/x86/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <memory>
+
+template <typename T, int32_t nc>
+void MedianBlurTest(int32_t height, int32_t width, int32_t ksize)
+{
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst_opencv(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+
+    tinycv::MedianBlur<T, nc>(height, width, width * nc, src.get(), width * nc, dst.get(), ksize);
+
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat oMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_opencv.get());
+    cv::medianBlur(iMat, oMat, ksize);
+
+    checkResult<T, nc>(dst.get(), dst_opencv.get(), height, width, width * nc, width * nc, 0.01f);
+}
+
+template <typename T>
+void MedianBlurTestNetworks()
+{
+    MedianBlurTest<T, 1>(480, 640, 3);
+    MedianBlurTest<T, 3>(480, 640, 3);
+    MedianBlurTest<T, 4>(101, 99, 3);
+    MedianBlurTest<T, 1>(480, 640, 5);
+    MedianBlurTest<T, 3>(101, 99, 5);
+    MedianBlurTest<T, 4>(2, 3, 5);
+}
+
+TEST(MEDIANBLUR_UINT8, x86)
+{
+    MedianBlurTestNetworks<uint8_t>();
+    MedianBlurTest<uint8_t, 1>(480, 640, 7);
+    MedianBlurTest<uint8_t, 1>(480, 1280, 15);
+    MedianBlurTest<uint8_t, 3>(101, 99, 9);
+    MedianBlurTest<uint8_t, 4>(101, 99, 31);
+    MedianBlurTest<uint8_t, 3>(7, 5, 11);
+}
+
+TEST(MEDIANBLUR_FP32, x86)
+{
+    MedianBlurTestNetworks<float>();
+}
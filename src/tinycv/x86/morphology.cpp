@@ -0,0 +1,478 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/morphology.h"
+#include "tinycv/types.h"
+#include "tinycv/sys.h"
+
+#include <string.h>
+#include <limits>
+#include <algorithm>
+#include <immintrin.h>
+
+namespace tinycv {
+
+// Small kernels run a direct sliding window, its accumulator stays in a register for one min/max per tap. From
+// these sizes on rows switch to log2(ksize) doubling passes and columns to van Herk/Gil-Werman, three min/max
+// per element whatever the size.
+#define MORPH_DOUBLING_MIN_KSIZE 8
+#define MORPH_VHGW_MIN_KSIZE 8
+
+template <typename T, bool erode>
+struct MorphOp;
+
+template <bool erode>
+struct MorphOp<uint8_t, erode> {
+    typedef __m128i vec_t;
+    enum { VLEN = 16 };
+    static inline uint8_t neutral()
+    {
+        return erode ? 255 : 0;
+    }
+    static inline uint8_t apply(uint8_t a, uint8_t b)
+    {
+        return erode ? (a < b ? a : b) : (a > b ? a : b);
+    }
+    static inline __m128i apply(__m128i a, __m128i b)
+    {
+        return erode ? _mm_min_epu8(a, b) : _mm_max_epu8(a, b);
+    }
+    static inline __m128i load(const uint8_t *p)
+    {
+        return _mm_loadu_si128((const __m128i *)p);
+    }
+    static inline void store(uint8_t *p, __m128i v)
+    {
+        _mm_storeu_si128((__m128i *)p, v);
+    }
+};
+
+template <bool erode>
+struct MorphOp<float, erode> {
+    typedef __m128 vec_t;
+    enum { VLEN = 4 };
+    static inline float neutral()
+    {
+        return erode ? std::numeric_limits<float>::infinity() : -std::numeric_limits<float>::infinity();
+    }
+    static inline float apply(float a, float b)
+    {
+        return erode ? (a < b ? a : b) : (a > b ? a : b);
+    }
+    static inline __m128 apply(__m128 a, __m128 b)
+    {
+        return erode ? _mm_min_ps(a, b) : _mm_max_ps(a, b);
+    }
+    static inline __m128 load(const float *p)
+    {
+        return _mm_loadu_ps(p);
+    }
+    static inline void store(float *p, __m128 v)
+    {
+        _mm_storeu_ps(p, v);
+    }
+};
+
+// all border modes, also valid far outside the image, -1 for BORDER_CONSTANT
+static inline int32_t morph_border_interpolate(int32_t p, int32_t len, BorderType border_type)
+{
+    if ((uint32_t)p < (uint32_t)len) {
+        return p;
+    }
+    if (border_type == BORDER_REPLICATE) {
+        p = p < 0 ? 0 : len - 1;
+    } else if (border_type == BORDER_REFLECT || border_type == BORDER_REFLECT_101) {
+        int32_t delta = border_type == BORDER_REFLECT_101;
+        if (len == 1) {
+            return 0;
+        }
+        do {
+            if (p < 0) {
+                p = -p - 1 + delta;
+            } else {
+                p = len - 1 - (p - len) - delta;
+            }
+        } while ((uint32_t)p >= (uint32_t)len);
+    } else {
+        p = -1;
+    }
+    return p;
+}
+
+// dst[i] = op(a[i], b[i]), dst may be a or b
+template <typename Op, typename T>
+static void morph_combine(const T *a, const T *b, int32_t n, T *dst)
+{
+    const int32_t VLEN = Op::VLEN;
+    int32_t i = 0;
+    for (; i <= n - 2 * VLEN; i += 2 * VLEN) {
+        typename Op::vec_t v0 = Op::apply(Op::load(a + i), Op::load(b + i));
+        typename Op::vec_t v1 = Op::apply(Op::load(a + i + VLEN), Op::load(b + i + VLEN));
+        Op::store(dst + i, v0);
+        Op::store(dst + i + VLEN, v1);
+    }
+    for (; i <= n - VLEN; i += VLEN) {
+        Op::store(dst + i, Op::apply(Op::load(a + i), Op::load(b + i)));
+    }
+    for (; i < n; ++i) {
+        dst[i] = Op::apply(a[i], b[i]);
+    }
+}
+
+// dst[i] = op over k of src[k][i], the accumulator stays in a register for all taps
+template <typename Op, typename T>
+static void morph_direct(const T *const *src, int32_t ksize, int32_t n, T *dst)
+{
+    const int32_t VLEN = Op::VLEN;
+    int32_t i = 0;
+    for (; i <= n - 2 * VLEN; i += 2 * VLEN) {
+        typename Op::vec_t v0 = Op::load(src[0] + i);
+        typename Op::vec_t v1 = Op::load(src[0] + i + VLEN);
+        for (int32_t k = 1; k < ksize; ++k) {
+            v0 = Op::apply(v0, Op::load(src[k] + i));
+            v1 = Op::apply(v1, Op::load(src[k] + i + VLEN));
+        }
+        Op::store(dst + i, v0);
+        Op::store(dst + i + VLEN, v1);
+    }
+    for (; i <= n - VLEN; i += VLEN) {
+        typename Op::vec_t v = Op::load(src[0] + i);
+        for (int32_t k = 1; k < ksize; ++k) {
+            v = Op::apply(v, Op::load(src[k] + i));
+        }
+        Op::store(dst + i, v);
+    }
+    for (; i < n; ++i) {
+        T v = src[0][i];
+        for (int32_t k = 1; k < ksize; ++k) {
+            v = Op::apply(v, src[k][i]);
+        }
+        dst[i] = v;
+    }
+}
+
+// Large windows along a row by doubling: after the pass of step s every element holds the min/max of the
+// 2 * s pixels starting at it, the window of ksize is the overlap of two windows of the largest power of two not
+// above ksize. The van Herk/Gil-Werman recurrences run along the row and do not vectorize there, log2(ksize)
+// SIMD passes over a row in cache are cheaper. `prow` holds `length` pixels and is overwritten.
+template <typename Op, typename T>
+static void morph_doubling_row(T *prow, int32_t length, int32_t cn, int32_t ksize, int32_t width, T *dst)
+{
+    const int32_t VLEN = Op::VLEN;
+    int32_t span = 1;
+    for (; span * 2 <= ksize; span *= 2) {
+        //! forward in place, element i + step is read before it is overwritten
+        int32_t step = span * cn;
+        int32_t n = (length - span) * cn;
+        int32_t i = 0;
+        for (; i <= n - VLEN; i += VLEN) {
+            Op::store(prow + i, Op::apply(Op::load(prow + i), Op::load(prow + i + step)));
+        }
+        for (; i < n; ++i) {
+            prow[i] = Op::apply(prow[i], prow[i + step]);
+        }
+        length -= span;
+    }
+    morph_combine<Op>(prow, prow + (ksize - span) * cn, width * cn, dst);
+}
+
+// van Herk/Gil-Werman down the columns, rows[p] is padded row p, a block of suffix rows is built at a time
+// and the running prefix of the next block is carried in one row
+template <typename Op, typename T>
+static void morph_vhgw_cols(const T *const *rows, int32_t height, int32_t ksize, int32_t n, T *hbuf, T *gbuf, int32_t outWidthStride, T *outData)
+{
+    for (int32_t b0 = 0; b0 < height; b0 += ksize) {
+        memcpy(hbuf + (size_t)(ksize - 1) * n, rows[b0 + ksize - 1], n * sizeof(T));
+        for (int32_t j = ksize - 2; j >= 0; --j) {
+            morph_combine<Op>(hbuf + (size_t)(j + 1) * n, rows[b0 + j], n, hbuf + (size_t)j * n);
+        }
+        memcpy(outData + (size_t)b0 * outWidthStride, hbuf, n * sizeof(T));
+        const T *gp = nullptr;
+        for (int32_t j = 1; j < ksize && b0 + j < height; ++j) {
+            if (j == 1) {
+                gp = rows[b0 + ksize];
+            } else {
+                morph_combine<Op>(gp, rows[b0 + ksize + j - 1], n, gbuf);
+                gp = gbuf;
+            }
+            morph_combine<Op>(hbuf + (size_t)j * n, gp, n, outData + (size_t)(b0 + j) * outWidthStride);
+        }
+    }
+}
+
+// iterations of a rectangle are one pass of a larger rectangle
+static inline int32_t morph_iterated_ksize(int32_t ksize, int32_t iterations)
+{
+    return iterations <= 0 ? 1 : ksize + (iterations - 1) * (ksize - 1);
+}
+
+// scratch of one call, taken from the scratch arena in one block and shared by both stages of opening and closing
+template <typename T>
+struct MorphBuffers {
+    T *rowResult; //!< the horizontal pass of the whole image
+    T *paddedRow;
+    T *prefix;
+    T *suffix;
+    T *constRow;
+    const T **taps;
+    int32_t *xofs;
+};
+
+// sizes the buffers for a ksizeX x ksizeY pass over the image and returns the block to ScratchFree
+template <typename T>
+static void *morph_alloc_buffers(int32_t height, int32_t width, int32_t channels, int32_t ksizeX, int32_t ksizeY, MorphBuffers<T> &buf)
+{
+    const int32_t n = width * channels;
+    const int32_t lengthX = width + ksizeX - 1;
+    uint64_t size_for_taps = ((uint64_t)std::max(ksizeX, height + ksizeY - 1) * sizeof(const T *) + 64 - 1) / 64 * 64;
+    uint64_t size_for_xofs = ((uint64_t)lengthX * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    uint64_t size_for_row_result = ksizeY > 1 ? ((uint64_t)height * n * sizeof(T) + 64 - 1) / 64 * 64 : 0;
+    uint64_t size_for_padded_row = ((uint64_t)lengthX * channels * sizeof(T) + 64 - 1) / 64 * 64;
+    uint64_t size_for_row = ((uint64_t)n * sizeof(T) + 64 - 1) / 64 * 64;
+    uint64_t size_for_suffix = ksizeY >= MORPH_VHGW_MIN_KSIZE ? size_for_row * ksizeY : 0;
+
+    uint64_t total_size = size_for_taps + size_for_xofs + size_for_row_result + size_for_padded_row + size_for_row * 2 + size_for_suffix;
+
+    void *temp_buffer = tinycv::ScratchAlloc(total_size, 64);
+    buf.taps = (const T **)temp_buffer;
+    buf.xofs = (int32_t *)((unsigned char *)buf.taps + size_for_taps);
+    buf.rowResult = (T *)((unsigned char *)buf.xofs + size_for_xofs);
+    buf.paddedRow = (T *)((unsigned char *)buf.rowResult + size_for_row_result);
+    buf.constRow = (T *)((unsigned char *)buf.paddedRow + size_for_padded_row);
+    buf.prefix = (T *)((unsigned char *)buf.constRow + size_for_row);
+    buf.suffix = (T *)((unsigned char *)buf.prefix + size_for_row);
+    return temp_buffer;
+}
+
+// one erosion or dilation with a ksizeX x ksizeY rectangle, the horizontal pass goes through a buffer of the whole
+// image before any output row is written, so outData may be inData
+template <typename T, int32_t channels, bool erode>
+static void morph_rect(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t ksizeX,
+    int32_t ksizeY,
+    int32_t anchorX,
+    int32_t anchorY,
+    BorderType border_type,
+    MorphBuffers<T> &buf)
+{
+    typedef MorphOp<T, erode> Op;
+    const int32_t n = width * channels;
+    const int32_t lengthX = width + ksizeX - 1;
+    const T neutral = Op::neutral();
+    bool doublingX = ksizeX >= MORPH_DOUBLING_MIN_KSIZE;
+    bool vhgwY = ksizeY >= MORPH_VHGW_MIN_KSIZE;
+
+    //! a single row kernel writes the horizontal pass straight to the output, its input row is copied first
+    T *rowResult = ksizeY > 1 ? buf.rowResult : outData;
+    int32_t rowStride = ksizeY > 1 ? n : outWidthStride;
+
+    int32_t *xofs = buf.xofs;
+    for (int32_t p = 0; p < lengthX; ++p) {
+        xofs[p] = morph_border_interpolate(p - anchorX, width, border_type);
+    }
+    T *prow = buf.paddedRow;
+    for (int32_t y = 0; y < height; ++y) {
+        const T *src = inData + (size_t)y * inWidthStride;
+        T *dst = rowResult + (size_t)y * rowStride;
+        if (ksizeX == 1) {
+            if (dst != src) {
+                memcpy(dst, src, n * sizeof(T));
+            }
+            continue;
+        }
+        memcpy(prow + anchorX * channels, src, n * sizeof(T));
+        for (int32_t p = 0; p < lengthX; ++p) {
+            if (p == anchorX) {
+                p += width - 1;
+                continue;
+            }
+            for (int32_t c = 0; c < channels; ++c) {
+                prow[p * channels + c] = xofs[p] < 0 ? neutral : src[xofs[p] * channels + c];
+            }
+        }
+        if (doublingX) {
+            morph_doubling_row<Op>(prow, lengthX, channels, ksizeX, width, dst);
+        } else {
+            for (int32_t k = 0; k < ksizeX; ++k) {
+                buf.taps[k] = prow + k * channels;
+            }
+            morph_direct<Op>(buf.taps, ksizeX, n, dst);
+        }
+    }
+    if (ksizeY == 1) {
+        return;
+    }
+
+    const int32_t lengthY = height + ksizeY - 1;
+    std::fill(buf.constRow, buf.constRow + n, neutral);
+    for (int32_t p = 0; p < lengthY; ++p) {
+        int32_t sy = morph_border_interpolate(p - anchorY, height, border_type);
+        buf.taps[p] = sy < 0 ? buf.constRow : rowResult + (size_t)sy * n;
+    }
+    if (vhgwY) {
+        morph_vhgw_cols<Op>(buf.taps, height, ksizeY, n, buf.suffix, buf.prefix, outWidthStride, outData);
+    } else {
+        for (int32_t y = 0; y < height; ++y) {
+            morph_direct<Op>(buf.taps + y, ksizeY, n, outData + (size_t)y * outWidthStride);
+        }
+    }
+}
+
+// the anchor of iterations scales along with the rectangle
+template <typename T, int32_t channels, bool erode>
+static void morph_iterate(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t kernelWidth,
+    int32_t kernelHeight,
+    int32_t iterations,
+    BorderType border_type,
+    MorphBuffers<T> &buf)
+{
+    if (iterations <= 0 || (kernelWidth == 1 && kernelHeight == 1)) {
+        if (outData != inData) {
+            for (int32_t y = 0; y < height; ++y) {
+                memcpy(outData + (size_t)y * outWidthStride, inData + (size_t)y * inWidthStride, width * channels * sizeof(T));
+            }
+        }
+        return;
+    }
+    int32_t ksizeX = morph_iterated_ksize(kernelWidth, iterations);
+    int32_t ksizeY = morph_iterated_ksize(kernelHeight, iterations);
+    int32_t anchorX = (kernelWidth / 2) * iterations;
+    int32_t anchorY = (kernelHeight / 2) * iterations;
+    morph_rect<T, channels, erode>(height, width, inWidthStride, inData, outWidthStride, outData, ksizeX, ksizeY, anchorX, anchorY, border_type, buf);
+}
+
+static inline bool morph_valid_border(BorderType border_type)
+{
+    return border_type == BORDER_CONSTANT || border_type == BORDER_REPLICATE ||
+           border_type == BORDER_REFLECT || border_type == BORDER_REFLECT_101;
+}
+
+template <typename T, int32_t channels>
+void MorphologyEx(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    MorphType op,
+    int32_t kernelWidth,
+    int32_t kernelHeight,
+    int32_t iterations,
+    BorderType border_type)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * channels || outWidthStride < width * channels) {
+        return;
+    }
+    if (kernelWidth <= 0 || kernelHeight <= 0 || !morph_valid_border(border_type)) {
+        return;
+    }
+    // opening and closing run both stages with the same rectangle, one set of buffers fits them
+    MorphBuffers<T> buf;
+    void *temp_buffer = morph_alloc_buffers<T>(height, width, channels, morph_iterated_ksize(kernelWidth, iterations),
+                                               morph_iterated_ksize(kernelHeight, iterations), buf);
+    switch (op) {
+        case MORPH_ERODE:
+            morph_iterate<T, channels, true>(height, width, inWidthStride, inData, outWidthStride, outData, kernelWidth, kernelHeight, iterations, border_type, buf);
+            break;
+        case MORPH_DILATE:
+            morph_iterate<T, channels, false>(height, width, inWidthStride, inData, outWidthStride, outData, kernelWidth, kernelHeight, iterations, border_type, buf);
+            break;
+        case MORPH_OPEN:
+            morph_iterate<T, channels, true>(height, width, inWidthStride, inData, outWidthStride, outData, kernelWidth, kernelHeight, iterations, border_type, buf);
+            morph_iterate<T, channels, false>(height, width, outWidthStride, outData, outWidthStride, outData, kernelWidth, kernelHeight, iterations, border_type, buf);
+            break;
+        case MORPH_CLOSE:
+            morph_iterate<T, channels, false>(height, width, inWidthStride, inData, outWidthStride, outData, kernelWidth, kernelHeight, iterations, border_type, buf);
+            morph_iterate<T, channels, true>(height, width, outWidthStride, outData, outWidthStride, outData, kernelWidth, kernelHeight, iterations, border_type, buf);
+            break;
+        default:
+            break;
+    }
+    tinycv::ScratchFree(temp_buffer);
+}
+
+template <typename T, int32_t channels>
+void Erode(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t kernelWidth,
+    int32_t kernelHeight,
+    int32_t iterations,
+    BorderType border_type)
+{
+    MorphologyEx<T, channels>(height, width, inWidthStride, inData, outWidthStride, outData, MORPH_ERODE, kernelWidth, kernelHeight, iterations, border_type);
+}
+
+template <typename T, int32_t channels>
+void Dilate(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t kernelWidth,
+    int32_t kernelHeight,
+    int32_t iterations,
+    BorderType border_type)
+{
+    MorphologyEx<T, channels>(height, width, inWidthStride, inData, outWidthStride, outData, MORPH_DILATE, kernelWidth, kernelHeight, iterations, border_type);
+}
+
+template void Erode<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+template void Erode<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+template void Erode<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+template void Erode<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+template void Erode<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+template void Erode<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+
+template void Dilate<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+template void Dilate<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+template void Dilate<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+template void Dilate<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+template void Dilate<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+template void Dilate<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+
+template void MorphologyEx<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, MorphType op, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+template void MorphologyEx<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, MorphType op, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+template void MorphologyEx<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, MorphType op, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+template void MorphologyEx<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, MorphType op, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+template void MorphologyEx<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, MorphType op, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+template void MorphologyEx<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, MorphType op, int32_t kernelWidth, int32_t kernelHeight, int32_t iterations, BorderType border_type);
+
+} // namespace tinycv
@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/morphology.h"
+#include "tinycv/debug.h"
+
+#include <opencv2/imgproc.hpp>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+namespace {
+
+template <typename T, int32_t nc, int32_t ksize>
+void BM_Erode_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::Erode<T, nc>(height, width, width * nc, src.get(), width * nc, dst.get(), ksize, ksize);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_Erode_tinycv_x86, uint8_t, 1, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Erode_tinycv_x86, uint8_t, 1, 7)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Erode_tinycv_x86, uint8_t, 1, 15)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Erode_tinycv_x86, uint8_t, 1, 31)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Erode_tinycv_x86, uint8_t, 3, 7)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Erode_tinycv_x86, float, 1, 7)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Erode_tinycv_x86, float, 1, 31)->Args({640, 480})->Args({1920, 1080});
+
+template <tinycv::MorphType op>
+void BM_MorphologyEx_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<uint8_t[]> src(new uint8_t[width * height]);
+    std::unique_ptr<uint8_t[]> dst(new uint8_t[width * height]);
+    tinycv::debug::randomFill<uint8_t>(src.get(), width * height, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::MorphologyEx<uint8_t, 1>(height, width, width, src.get(), width, dst.get(), op, 5, 5, 3);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_MorphologyEx_tinycv_x86, tinycv::MORPH_OPEN)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_MorphologyEx_tinycv_x86, tinycv::MORPH_CLOSE)->Args({640, 480})->Args({1920, 1080});
+
+#ifdef TINYCV_BENCHMARK_OPENCV
+template <typename T, int32_t nc, int32_t ksize>
+static void BM_Erode_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat oMat;
+    cv::Mat kernel = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(ksize, ksize));
+    for (auto _ : state) {
+        cv::erode(iMat, oMat, kernel);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_Erode_opencv_x86, uint8_t, 1, 3)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Erode_opencv_x86, uint8_t, 1, 7)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Erode_opencv_x86, uint8_t, 1, 15)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Erode_opencv_x86, uint8_t, 1, 31)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Erode_opencv_x86, uint8_t, 3, 7)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Erode_opencv_x86, float, 1, 7)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Erode_opencv_x86, float, 1, 31)->Args({640, 480})->Args({1920, 1080});
+
+#endif //! TINYCV_BENCHMARK_OPENCV
+} // namespace
@@ -0,0 +1,544 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/pyramid.h"
+#include "tinycv/types.h"
+#include "tinycv/sys.h"
+
+#include <string.h>
+#include <stdint.h>
+#include <immintrin.h>
+#include <algorithm>
+
+namespace tinycv {
+
+// BORDER_REFLECT_101, also valid when the border is wider than the image
+static inline int32_t pyr_reflect101(int32_t p, int32_t len)
+{
+    if (len == 1) {
+        return 0;
+    }
+    while (p < 0 || p >= len) {
+        p = p < 0 ? -p : 2 * len - p - 2;
+    }
+    return p;
+}
+
+// u8 sums of the 5 tap kernel stay below 16 * 16 * 255 and fit in 16 bits
+template <typename T>
+struct pyr_traits;
+
+template <>
+struct pyr_traits<uint8_t> {
+    typedef uint16_t work_t;
+    static inline uint8_t cast_down(uint32_t v)
+    {
+        return (uint8_t)((v + 128) >> 8);
+    }
+    static inline uint8_t cast_up(uint32_t v)
+    {
+        return (uint8_t)((v + 32) >> 6);
+    }
+};
+
+template <>
+struct pyr_traits<float> {
+    typedef float work_t;
+    static inline float cast_down(float v)
+    {
+        return v * (1.f / 256.f);
+    }
+    static inline float cast_up(float v)
+    {
+        return v * (1.f / 64.f);
+    }
+};
+
+// r0 + r4 + 4 * (r1 + r3) + 6 * r2
+static void pyr_down_v(const uint8_t *const *rows, int32_t n, uint16_t *dst)
+{
+    int32_t i = 0;
+    for (; i <= n - 16; i += 16) {
+        __m128i s[5];
+        for (int32_t k = 0; k < 5; ++k) {
+            s[k] = _mm_loadu_si128((const __m128i *)(rows[k] + i));
+        }
+        for (int32_t h = 0; h < 2; ++h) {
+            __m128i v[5];
+            for (int32_t k = 0; k < 5; ++k) {
+                v[k] = _mm_cvtepu8_epi16(h ? _mm_srli_si128(s[k], 8) : s[k]);
+            }
+            __m128i r = _mm_add_epi16(v[0], v[4]);
+            r         = _mm_add_epi16(r, _mm_slli_epi16(_mm_add_epi16(v[1], v[3]), 2));
+            r         = _mm_add_epi16(r, _mm_add_epi16(_mm_slli_epi16(v[2], 2), _mm_slli_epi16(v[2], 1)));
+            _mm_storeu_si128((__m128i *)(dst + i + 8 * h), r);
+        }
+    }
+    for (; i < n; ++i) {
+        dst[i] = rows[0][i] + rows[4][i] + 4 * (rows[1][i] + rows[3][i]) + 6 * rows[2][i];
+    }
+}
+
+static void pyr_down_v(const float *const *rows, int32_t n, float *dst)
+{
+    const __m128 m_4 = _mm_set1_ps(4.f);
+    const __m128 m_6 = _mm_set1_ps(6.f);
+    int32_t i        = 0;
+    for (; i <= n - 4; i += 4) {
+        __m128 r = _mm_add_ps(_mm_loadu_ps(rows[0] + i), _mm_loadu_ps(rows[4] + i));
+        r        = _mm_add_ps(r, _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(rows[1] + i), _mm_loadu_ps(rows[3] + i)), m_4));
+        r        = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(rows[2] + i), m_6));
+        _mm_storeu_ps(dst + i, r);
+    }
+    for (; i < n; ++i) {
+        dst[i] = rows[0][i] + rows[4][i] + 4.f * (rows[1][i] + rows[3][i]) + 6.f * rows[2][i];
+    }
+}
+
+// 4 single channel outputs from p = row + 2 * x, each 32 bit lane holds an even and an odd column
+static inline __m128i pyr_down_h4_u8c1(const uint16_t *p)
+{
+    const __m128i m_lo = _mm_set1_epi32(0xffff);
+    __m128i a          = _mm_loadu_si128((const __m128i *)(p - 2));
+    __m128i b          = _mm_loadu_si128((const __m128i *)p);
+    __m128i c          = _mm_loadu_si128((const __m128i *)(p + 2));
+    __m128i e          = _mm_and_si128(b, m_lo);
+    __m128i s          = _mm_add_epi32(_mm_and_si128(a, m_lo), _mm_and_si128(c, m_lo));
+    s                  = _mm_add_epi32(s, _mm_slli_epi32(_mm_add_epi32(_mm_srli_epi32(a, 16), _mm_srli_epi32(b, 16)), 2));
+    s                  = _mm_add_epi32(s, _mm_add_epi32(_mm_slli_epi32(e, 2), _mm_slli_epi32(e, 1)));
+    return _mm_srli_epi32(_mm_add_epi32(s, _mm_set1_epi32(128)), 8);
+}
+
+// 2 outputs of 3 or 4 channels from p = row + 2 * x * channels, a tap of the first output comes from the load
+// at its own offset and the same tap of the second one from the load a pixel further, the 16 bit sums stay
+// below 16 * 16 * 255
+template <int32_t channels>
+static inline __m128i pyr_down_h2_u8(const uint16_t *p)
+{
+    const int32_t high = channels == 3 ? 0x38 : 0xf0;
+    __m128i l[6];
+    for (int32_t k = 0; k < 6; ++k) {
+        l[k] = _mm_loadu_si128((const __m128i *)(p + (k - 2) * channels));
+    }
+    __m128i t[5];
+    for (int32_t k = 0; k < 5; ++k) {
+        t[k] = _mm_blend_epi16(l[k], l[k + 1], high);
+    }
+    __m128i s = _mm_add_epi16(t[0], t[4]);
+    s = _mm_add_epi16(s, _mm_slli_epi16(_mm_add_epi16(t[1], t[3]), 2));
+    s = _mm_add_epi16(s, _mm_add_epi16(_mm_slli_epi16(t[2], 2), _mm_slli_epi16(t[2], 1)));
+    s = _mm_srli_epi16(_mm_add_epi16(s, _mm_set1_epi16(128)), 8);
+    return _mm_packus_epi16(s, s);
+}
+
+static inline int32_t pyr_down_h_simd(const uint16_t *row, int32_t channels, int32_t out_width, uint8_t *dst)
+{
+    int32_t x = 0;
+    if (channels == 1) {
+        for (; x <= out_width - 8; x += 8) {
+            __m128i r = _mm_packus_epi32(pyr_down_h4_u8c1(row + 2 * x), pyr_down_h4_u8c1(row + 2 * x + 8));
+            _mm_storel_epi64((__m128i *)(dst + x), _mm_packus_epi16(r, r));
+        }
+    } else if (channels == 3) {
+        // the 2 bytes past the second pixel are written again by the next step
+        for (; x <= out_width - 3; x += 2) {
+            _mm_storel_epi64((__m128i *)(dst + 3 * x), pyr_down_h2_u8<3>(row + 6 * x));
+        }
+    } else if (channels == 4) {
+        for (; x <= out_width - 2; x += 2) {
+            _mm_storel_epi64((__m128i *)(dst + 4 * x), pyr_down_h2_u8<4>(row + 8 * x));
+        }
+    }
+    return x;
+}
+
+// (t0 + t4) + 4 * (t1 + t3) + 6 * t2 / 256 in the order of the scalar loop, so both give the same bits
+static inline __m128 pyr_down_h_ps(__m128 t0, __m128 t1, __m128 t2, __m128 t3, __m128 t4)
+{
+    __m128 r = _mm_add_ps(_mm_add_ps(t0, t4), _mm_mul_ps(_mm_set1_ps(4.f), _mm_add_ps(t1, t3)));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(6.f), t2));
+    return _mm_mul_ps(r, _mm_set1_ps(1.f / 256.f));
+}
+
+static inline int32_t pyr_down_h_simd(const float *row, int32_t channels, int32_t out_width, float *dst)
+{
+    int32_t x = 0;
+    if (channels == 1) {
+        for (; x <= out_width - 4; x += 4) {
+            const float *p = row + 2 * x;
+            __m128 a = _mm_loadu_ps(p - 2);
+            __m128 b = _mm_loadu_ps(p + 2);
+            __m128 c = _mm_loadu_ps(p + 6);
+            __m128 d = _mm_loadu_ps(p);
+            __m128 e = _mm_loadu_ps(p + 4);
+            __m128 r = pyr_down_h_ps(_mm_shuffle_ps(a, b, 0x88), _mm_shuffle_ps(a, b, 0xdd), _mm_shuffle_ps(d, e, 0x88),
+                                     _mm_shuffle_ps(d, e, 0xdd), _mm_shuffle_ps(b, c, 0x88));
+            _mm_storeu_ps(dst + x, r);
+        }
+    } else if (channels == 3 || channels == 4) {
+        // one pixel per step, the fourth lane of 3 channels is written again by the next step
+        for (; x < out_width - (channels == 3 ? 1 : 0); ++x) {
+            const float *p = row + 2 * x * channels;
+            __m128 r = pyr_down_h_ps(_mm_loadu_ps(p - 2 * channels), _mm_loadu_ps(p - channels), _mm_loadu_ps(p),
+                                     _mm_loadu_ps(p + channels), _mm_loadu_ps(p + 2 * channels));
+            _mm_storeu_ps(dst + x * channels, r);
+        }
+    }
+    return x;
+}
+
+// row holds 2 reflected pixels on each side
+template <typename T>
+static void pyr_down_h(const typename pyr_traits<T>::work_t *row, int32_t channels, int32_t out_width, T *dst)
+{
+    for (int32_t x = pyr_down_h_simd(row, channels, out_width, dst); x < out_width; ++x) {
+        for (int32_t c = 0; c < channels; ++c) {
+            const typename pyr_traits<T>::work_t *p = row + 2 * x * channels + c;
+            dst[x * channels + c]                   = pyr_traits<T>::cast_down(
+                p[-2 * channels] + p[2 * channels] + 4 * (p[-channels] + p[channels]) + 6 * p[0]);
+        }
+    }
+}
+
+template <typename W>
+static inline void pyr_fill_border(W *row, int32_t width, int32_t channels, int32_t border)
+{
+    for (int32_t i = 1; i <= border; ++i) {
+        int32_t l = pyr_reflect101(-i, width);
+        int32_t r = pyr_reflect101(width - 1 + i, width);
+        for (int32_t c = 0; c < channels; ++c) {
+            row[-i * channels + c]              = row[l * channels + c];
+            row[(width - 1 + i) * channels + c] = row[r * channels + c];
+        }
+    }
+}
+
+// one output row of PyrDown, buffer holds the vertically filtered row with room for the borders
+template <typename T>
+static void pyr_down_row(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t channels,
+    int32_t y,
+    typename pyr_traits<T>::work_t *buffer,
+    T *dst)
+{
+    const T *rows[5];
+    for (int32_t k = 0; k < 5; ++k) {
+        rows[k] = inData + pyr_reflect101(2 * y - 2 + k, inHeight) * inWidthStride;
+    }
+    typename pyr_traits<T>::work_t *row = buffer + 2 * channels;
+    pyr_down_v(rows, inWidth * channels, row);
+    pyr_fill_border(row, inWidth, channels, 2);
+    pyr_down_h(row, channels, (inWidth + 1) / 2, dst);
+}
+
+template <typename T>
+static uint64_t pyr_buffer_size(int32_t width, int32_t channels)
+{
+    // 2 border pixels on each side, the vector loads may run 8 elements past the right border
+    return (((uint64_t)(width + 4) * channels + 16) * sizeof(typename pyr_traits<T>::work_t) + 64 - 1) / 64 * 64;
+}
+
+template <typename T, int32_t channels>
+void PyrDown(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0) {
+        return;
+    }
+    typename pyr_traits<T>::work_t *buffer = (typename pyr_traits<T>::work_t *)tinycv::ScratchAlloc(pyr_buffer_size<T>(inWidth, channels), 64);
+    for (int32_t y = 0; y < (inHeight + 1) / 2; ++y) {
+        pyr_down_row(inHeight, inWidth, inWidthStride, inData, channels, y, buffer, outData + y * outWidthStride);
+    }
+    tinycv::ScratchFree(buffer);
+}
+
+// t0 = r0 + 6 * r1 + r2 and t1 = 4 * (r1 + r2), the two vertical phases of PyrUp
+static void pyr_up_v(const uint8_t *r0, const uint8_t *r1, const uint8_t *r2, int32_t n, uint16_t *t0, uint16_t *t1)
+{
+    int32_t i = 0;
+    for (; i <= n - 8; i += 8) {
+        __m128i a = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(r0 + i)));
+        __m128i b = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(r1 + i)));
+        __m128i c = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(r2 + i)));
+        __m128i e = _mm_add_epi16(_mm_add_epi16(a, c), _mm_add_epi16(_mm_slli_epi16(b, 2), _mm_slli_epi16(b, 1)));
+        _mm_storeu_si128((__m128i *)(t0 + i), e);
+        _mm_storeu_si128((__m128i *)(t1 + i), _mm_slli_epi16(_mm_add_epi16(b, c), 2));
+    }
+    for (; i < n; ++i) {
+        t0[i] = r0[i] + 6 * r1[i] + r2[i];
+        t1[i] = 4 * (r1[i] + r2[i]);
+    }
+}
+
+static void pyr_up_v(const float *r0, const float *r1, const float *r2, int32_t n, float *t0, float *t1)
+{
+    const __m128 m_4 = _mm_set1_ps(4.f);
+    const __m128 m_6 = _mm_set1_ps(6.f);
+    int32_t i        = 0;
+    for (; i <= n - 4; i += 4) {
+        __m128 a = _mm_loadu_ps(r0 + i);
+        __m128 b = _mm_loadu_ps(r1 + i);
+        __m128 c = _mm_loadu_ps(r2 + i);
+        _mm_storeu_ps(t0 + i, _mm_add_ps(_mm_add_ps(a, c), _mm_mul_ps(b, m_6)));
+        _mm_storeu_ps(t1 + i, _mm_mul_ps(_mm_add_ps(b, c), m_4));
+    }
+    for (; i < n; ++i) {
+        t0[i] = r0[i] + 6.f * r1[i] + r2[i];
+        t1[i] = 4.f * (r1[i] + r2[i]);
+    }
+}
+
+static inline int32_t pyr_up_h_simd(const uint16_t *row, int32_t channels, int32_t in_width, uint8_t *dst)
+{
+    const __m128i m_32 = _mm_set1_epi16(32);
+    int32_t x          = 0;
+    if (channels == 1) {
+        for (; x <= in_width - 8; x += 8) {
+            __m128i a = _mm_loadu_si128((const __m128i *)(row + x - 1));
+            __m128i b = _mm_loadu_si128((const __m128i *)(row + x));
+            __m128i c = _mm_loadu_si128((const __m128i *)(row + x + 1));
+            __m128i e = _mm_add_epi16(_mm_add_epi16(a, c), _mm_add_epi16(_mm_slli_epi16(b, 2), _mm_slli_epi16(b, 1)));
+            __m128i o = _mm_slli_epi16(_mm_add_epi16(b, c), 2);
+            e         = _mm_srli_epi16(_mm_add_epi16(e, m_32), 6);
+            o         = _mm_srli_epi16(_mm_add_epi16(o, m_32), 6);
+            __m128i r = _mm_packus_epi16(e, o);
+            _mm_storeu_si128((__m128i *)(dst + 2 * x), _mm_unpacklo_epi8(r, _mm_srli_si128(r, 8)));
+        }
+    } else if (channels == 3 || channels == 4) {
+        // 2 pixels per step, the even and odd outputs of each pixel are stored next to each other
+        const __m128i m_order = channels == 3 ? _mm_setr_epi8(0, 1, 2, 8, 9, 10, 3, 4, 5, 11, 12, 13, -1, -1, -1, -1)
+                                              : _mm_setr_epi8(0, 1, 2, 3, 8, 9, 10, 11, 4, 5, 6, 7, 12, 13, 14, 15);
+        for (; x <= in_width - (channels == 3 ? 3 : 2); x += 2) {
+            const uint16_t *p = row + x * channels;
+            __m128i a = _mm_loadu_si128((const __m128i *)(p - channels));
+            __m128i b = _mm_loadu_si128((const __m128i *)p);
+            __m128i c = _mm_loadu_si128((const __m128i *)(p + channels));
+            __m128i e = _mm_add_epi16(_mm_add_epi16(a, c), _mm_add_epi16(_mm_slli_epi16(b, 2), _mm_slli_epi16(b, 1)));
+            __m128i o = _mm_slli_epi16(_mm_add_epi16(b, c), 2);
+            e = _mm_srli_epi16(_mm_add_epi16(e, m_32), 6);
+            o = _mm_srli_epi16(_mm_add_epi16(o, m_32), 6);
+            // the last 4 bytes of 3 channels are written again by the next step
+            _mm_storeu_si128((__m128i *)(dst + 2 * x * channels), _mm_shuffle_epi8(_mm_packus_epi16(e, o), m_order));
+        }
+    }
+    return x;
+}
+
+static inline int32_t pyr_up_h_simd(const float *row, int32_t channels, int32_t in_width, float *dst)
+{
+    const __m128 m_4 = _mm_set1_ps(4.f);
+    const __m128 m_6 = _mm_set1_ps(6.f);
+    const __m128 m_scale = _mm_set1_ps(1.f / 64.f);
+    int32_t x = 0;
+    if (channels == 1) {
+        for (; x <= in_width - 4; x += 4) {
+            __m128 a = _mm_loadu_ps(row + x - 1);
+            __m128 b = _mm_loadu_ps(row + x);
+            __m128 c = _mm_loadu_ps(row + x + 1);
+            __m128 e = _mm_mul_ps(_mm_add_ps(_mm_add_ps(a, _mm_mul_ps(m_6, b)), c), m_scale);
+            __m128 o = _mm_mul_ps(_mm_mul_ps(m_4, _mm_add_ps(b, c)), m_scale);
+            _mm_storeu_ps(dst + 2 * x, _mm_unpacklo_ps(e, o));
+            _mm_storeu_ps(dst + 2 * x + 4, _mm_unpackhi_ps(e, o));
+        }
+    } else if (channels == 3 || channels == 4) {
+        // one pixel per step, the odd output overwrites the fourth lane of the even one for 3 channels
+        for (; x < in_width - (channels == 3 ? 1 : 0); ++x) {
+            const float *p = row + x * channels;
+            __m128 a = _mm_loadu_ps(p - channels);
+            __m128 b = _mm_loadu_ps(p);
+            __m128 c = _mm_loadu_ps(p + channels);
+            _mm_storeu_ps(dst + 2 * x * channels, _mm_mul_ps(_mm_add_ps(_mm_add_ps(a, _mm_mul_ps(m_6, b)), c), m_scale));
+            _mm_storeu_ps(dst + (2 * x + 1) * channels, _mm_mul_ps(_mm_mul_ps(m_4, _mm_add_ps(b, c)), m_scale));
+        }
+    }
+    return x;
+}
+
+// row holds one border pixel on each side, the right one replicates the last pixel
+template <typename T>
+static void pyr_up_h(const typename pyr_traits<T>::work_t *row, int32_t channels, int32_t in_width, T *dst)
+{
+    for (int32_t x = pyr_up_h_simd(row, channels, in_width, dst); x < in_width; ++x) {
+        for (int32_t c = 0; c < channels; ++c) {
+            const typename pyr_traits<T>::work_t *p = row + x * channels + c;
+            dst[2 * x * channels + c]               = pyr_traits<T>::cast_up(p[-channels] + 6 * p[0] + p[channels]);
+            dst[(2 * x + 1) * channels + c]         = pyr_traits<T>::cast_up(4 * (p[0] + p[channels]));
+        }
+    }
+}
+
+template <typename T, int32_t channels>
+void PyrUp(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0) {
+        return;
+    }
+    typedef typename pyr_traits<T>::work_t work_t;
+    uint64_t size_for_row = pyr_buffer_size<T>(inWidth, channels);
+    work_t *t0 = (work_t *)tinycv::ScratchAlloc(2 * size_for_row, 64);
+    work_t *t1 = (work_t *)((unsigned char *)t0 + size_for_row);
+    int32_t n  = inWidth * channels;
+    for (int32_t y = 0; y < inHeight; ++y) {
+        // the row below the image repeats the last one, like the right column does
+        const T *r0 = inData + pyr_reflect101(y - 1, inHeight) * inWidthStride;
+        const T *r1 = inData + y * inWidthStride;
+        const T *r2 = inData + std::min(y + 1, inHeight - 1) * inWidthStride;
+        work_t *row0 = t0 + channels;
+        work_t *row1 = t1 + channels;
+        pyr_up_v(r0, r1, r2, n, row0, row1);
+        for (int32_t c = 0; c < channels; ++c) {
+            row0[-channels + c] = row0[pyr_reflect101(-1, inWidth) * channels + c];
+            row1[-channels + c] = row1[pyr_reflect101(-1, inWidth) * channels + c];
+            row0[n + c]         = row0[n - channels + c];
+            row1[n + c]         = row1[n - channels + c];
+        }
+        pyr_up_h(row0, channels, inWidth, outData + 2 * y * outWidthStride);
+        pyr_up_h(row1, channels, inWidth, outData + (2 * y + 1) * outWidthStride);
+    }
+    tinycv::ScratchFree(t0);
+}
+
+template <typename T, int32_t channels>
+uint64_t PyramidArenaSize(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t levels)
+{
+    uint64_t size = 0;
+    for (int32_t l = 1; l < levels; ++l) {
+        inHeight = (inHeight + 1) / 2;
+        inWidth  = (inWidth + 1) / 2;
+        size += (uint64_t)inHeight * inWidth * channels;
+    }
+    return size;
+}
+
+// produce every row of level l whose source rows exist, each new row is handed to the next level
+template <typename T>
+static void pyr_build_level(
+    PyramidLevel<T> *pyramid,
+    int32_t levels,
+    int32_t channels,
+    int32_t l,
+    int32_t *done,
+    typename pyr_traits<T>::work_t *buffer)
+{
+    const PyramidLevel<T> &src = pyramid[l - 1];
+    const PyramidLevel<T> &dst = pyramid[l];
+    while (done[l] < dst.height) {
+        int32_t y = done[l];
+        if (l > 1 && done[l - 1] <= std::min(2 * y + 2, src.height - 1)) {
+            return;
+        }
+        pyr_down_row(src.height, src.width, src.widthStride, src.data, channels, y, buffer, (T *)dst.data + y * dst.widthStride);
+        ++done[l];
+        if (l + 1 < levels) {
+            pyr_build_level(pyramid, levels, channels, l + 1, done, buffer);
+        }
+    }
+}
+
+template <typename T, int32_t channels>
+void BuildPyramid(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t levels,
+    T *arena,
+    PyramidLevel<T> *pyramid)
+{
+    if (nullptr == inData || nullptr == pyramid || levels <= 0) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || (levels > 1 && nullptr == arena)) {
+        return;
+    }
+    pyramid[0].height      = inHeight;
+    pyramid[0].width       = inWidth;
+    pyramid[0].widthStride = inWidthStride;
+    pyramid[0].data        = inData;
+    for (int32_t l = 1; l < levels; ++l) {
+        pyramid[l].height      = (pyramid[l - 1].height + 1) / 2;
+        pyramid[l].width       = (pyramid[l - 1].width + 1) / 2;
+        pyramid[l].widthStride = pyramid[l].width * channels;
+        pyramid[l].data        = arena;
+        arena += (uint64_t)pyramid[l].height * pyramid[l].widthStride;
+    }
+    if (levels == 1) {
+        return;
+    }
+    // rows of every level are consumed by the next one right after they are written
+    uint64_t size_for_buffer = pyr_buffer_size<T>(inWidth, channels);
+    uint64_t size_for_done = ((uint64_t)levels * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    void *temp_buffer = tinycv::ScratchAlloc(size_for_buffer + size_for_done, 64);
+    typename pyr_traits<T>::work_t *buffer = (typename pyr_traits<T>::work_t *)temp_buffer;
+    int32_t *done = (int32_t *)((unsigned char *)temp_buffer + size_for_buffer);
+    memset(done, 0, levels * sizeof(int32_t));
+    pyr_build_level(pyramid, levels, channels, 1, done, buffer);
+    tinycv::ScratchFree(temp_buffer);
+}
+
+template void PyrDown<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData);
+template void PyrDown<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData);
+template void PyrDown<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData);
+template void PyrDown<float, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData);
+template void PyrDown<float, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData);
+template void PyrDown<float, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData);
+
+template void PyrUp<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData);
+template void PyrUp<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData);
+template void PyrUp<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData);
+template void PyrUp<float, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData);
+template void PyrUp<float, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData);
+template void PyrUp<float, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData);
+
+template uint64_t PyramidArenaSize<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t levels);
+template uint64_t PyramidArenaSize<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t levels);
+template uint64_t PyramidArenaSize<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t levels);
+template uint64_t PyramidArenaSize<float, 1>(int32_t inHeight, int32_t inWidth, int32_t levels);
+template uint64_t PyramidArenaSize<float, 3>(int32_t inHeight, int32_t inWidth, int32_t levels);
+template uint64_t PyramidArenaSize<float, 4>(int32_t inHeight, int32_t inWidth, int32_t levels);
+
+template void BuildPyramid<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t levels, uint8_t *arena, PyramidLevel<uint8_t> *pyramid);
+template void BuildPyramid<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t levels, uint8_t *arena, PyramidLevel<uint8_t> *pyramid);
+template void BuildPyramid<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t levels, uint8_t *arena, PyramidLevel<uint8_t> *pyramid);
+template void BuildPyramid<float, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t levels, float *arena, PyramidLevel<float> *pyramid);
+template void BuildPyramid<float, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t levels, float *arena, PyramidLevel<float> *pyramid);
+template void BuildPyramid<float, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t levels, float *arena, PyramidLevel<float> *pyramid);
+} // namespace tinycv
@@ -0,0 +1,177 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/pyramid.h"
+#include "tinycv/resize.h"
+#include "tinycv/debug.h"
+
+#include <opencv2/imgproc.hpp>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+template <typename T, int32_t nc>
+void BM_PyrDown_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t outWidth = (width + 1) / 2;
+    int32_t outHeight = (height + 1) / 2;
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[outWidth * outHeight * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::PyrDown<T, nc>(height, width, width * nc, src.get(), outWidth * nc, dst.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <typename T, int32_t nc>
+void BM_PyrUp_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc * 4]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+
+    for (auto _ : state) {
+        tinycv::PyrUp<T, nc>(height, width, width * nc, src.get(), width * 2 * nc, dst.get());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <typename T, int32_t nc>
+void BM_BuildPyramid_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t levels = state.range(2);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    std::vector<T> arena(tinycv::PyramidArenaSize<T, nc>(height, width, levels));
+    std::vector<tinycv::PyramidLevel<T>> pyramid(levels);
+
+    for (auto _ : state) {
+        tinycv::BuildPyramid<T, nc>(height, width, width * nc, src.get(), levels, arena.data(), pyramid.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+// the multi-scale baseline: every level resized from the full resolution source
+template <typename T, int32_t nc>
+void BM_BuildPyramid_resize_linear_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t levels = state.range(2);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    std::vector<T> arena(tinycv::PyramidArenaSize<T, nc>(height, width, levels));
+
+    for (auto _ : state) {
+        T *dst = arena.data();
+        int32_t h = height, w = width;
+        for (int32_t l = 1; l < levels; ++l) {
+            h = (h + 1) / 2;
+            w = (w + 1) / 2;
+            tinycv::ResizeLinear<T, nc>(height, width, width * nc, src.get(), h, w, w * nc, dst);
+            dst += h * w * nc;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace tinycv::debug;
+
+BENCHMARK_TEMPLATE(BM_PyrDown_tinycv_x86, uint8_t, c1)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_PyrDown_tinycv_x86, uint8_t, c3)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_PyrDown_tinycv_x86, float, c1)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_PyrDown_tinycv_x86, float, c3)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_PyrUp_tinycv_x86, uint8_t, c1)->Args({320, 240})->Args({640, 360})->Args({960, 540});
+BENCHMARK_TEMPLATE(BM_PyrUp_tinycv_x86, uint8_t, c3)->Args({320, 240})->Args({640, 360})->Args({960, 540});
+BENCHMARK_TEMPLATE(BM_PyrUp_tinycv_x86, float, c1)->Args({320, 240})->Args({640, 360})->Args({960, 540});
+BENCHMARK_TEMPLATE(BM_PyrUp_tinycv_x86, float, c3)->Args({320, 240})->Args({640, 360})->Args({960, 540});
+BENCHMARK_TEMPLATE(BM_BuildPyramid_tinycv_x86, uint8_t, c1)->Args({1280, 720, 8})->Args({1920, 1080, 8});
+BENCHMARK_TEMPLATE(BM_BuildPyramid_tinycv_x86, uint8_t, c3)->Args({1280, 720, 8})->Args({1920, 1080, 8});
+BENCHMARK_TEMPLATE(BM_BuildPyramid_resize_linear_x86, uint8_t, c1)->Args({1280, 720, 8})->Args({1920, 1080, 8});
+BENCHMARK_TEMPLATE(BM_BuildPyramid_resize_linear_x86, uint8_t, c3)->Args({1280, 720, 8})->Args({1920, 1080, 8});
+
+#ifdef TINYCV_BENCHMARK_OPENCV
+template <typename T, int32_t nc>
+static void BM_PyrDown_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    cv::Mat iMat(height, width, T2CvType<T, nc>::type, src.get());
+    cv::Mat oMat;
+    for (auto _ : state) {
+        cv::pyrDown(iMat, oMat);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <typename T, int32_t nc>
+static void BM_PyrUp_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    cv::Mat iMat(height, width, T2CvType<T, nc>::type, src.get());
+    cv::Mat oMat;
+    for (auto _ : state) {
+        cv::pyrUp(iMat, oMat);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <typename T, int32_t nc>
+static void BM_BuildPyramid_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    int32_t levels = state.range(2);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    cv::Mat iMat(height, width, T2CvType<T, nc>::type, src.get());
+    std::vector<cv::Mat> pyramid;
+    for (auto _ : state) {
+        cv::buildPyramid(iMat, pyramid, levels - 1);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_PyrDown_opencv_x86, uint8_t, c1)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_PyrDown_opencv_x86, uint8_t, c3)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_PyrDown_opencv_x86, float, c1)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_PyrDown_opencv_x86, float, c3)->Args({640, 480})->Args({1280, 720})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_PyrUp_opencv_x86, uint8_t, c1)->Args({320, 240})->Args({640, 360})->Args({960, 540});
+BENCHMARK_TEMPLATE(BM_PyrUp_opencv_x86, uint8_t, c3)->Args({320, 240})->Args({640, 360})->Args({960, 540});
+BENCHMARK_TEMPLATE(BM_PyrUp_opencv_x86, float, c1)->Args({320, 240})->Args({640, 360})->Args({960, 540});
+BENCHMARK_TEMPLATE(BM_PyrUp_opencv_x86, float, c3)->Args({320, 240})->Args({640, 360})->Args({960, 540});
+BENCHMARK_TEMPLATE(BM_BuildPyramid_opencv_x86, uint8_t, c1)->Args({1280, 720, 8})->Args({1920, 1080, 8});
+BENCHMARK_TEMPLATE(BM_BuildPyramid_opencv_x86, uint8_t, c3)->Args({1280, 720, 8})->Args({1920, 1080, 8});
+
+#endif //! TINYCV_BENCHMARK_OPENCV
+} // namespace
@@ -0,0 +1,141 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/pyramid.h"
+#include "tinycv/x86/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <memory>
+#include <vector>
+
+template <typename T, int32_t nc>
+void PyrDownTest(int32_t height, int32_t width, float diff)
+{
+    int32_t outHeight = (height + 1) / 2;
+    int32_t outWidth = (width + 1) / 2;
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[outWidth * outHeight * nc]);
+    std::unique_ptr<T[]> dst_opencv(new T[outWidth * outHeight * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+
+    tinycv::PyrDown<T, nc>(height, width, width * nc, src.get(), outWidth * nc, dst.get());
+
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat oMat(outHeight, outWidth, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_opencv.get());
+    cv::pyrDown(iMat, oMat, cv::Size(outWidth, outHeight));
+
+    checkResult<T, nc>(dst.get(), dst_opencv.get(), outHeight, outWidth, outWidth * nc, outWidth * nc, diff);
+}
+
+template <typename T, int32_t nc>
+void PyrUpTest(int32_t height, int32_t width, float diff)
+{
+    int32_t outHeight = height * 2;
+    int32_t outWidth = width * 2;
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[outWidth * outHeight * nc]);
+    std::unique_ptr<T[]> dst_opencv(new T[outWidth * outHeight * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+
+    tinycv::PyrUp<T, nc>(height, width, width * nc, src.get(), outWidth * nc, dst.get());
+
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat oMat(outHeight, outWidth, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_opencv.get());
+    cv::pyrUp(iMat, oMat, cv::Size(outWidth, outHeight));
+
+    checkResult<T, nc>(dst.get(), dst_opencv.get(), outHeight, outWidth, outWidth * nc, outWidth * nc, diff);
+}
+
+template <typename T, int32_t nc>
+void BuildPyramidTest(int32_t height, int32_t width, int32_t levels, float diff)
+{
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    std::vector<T> arena(tinycv::PyramidArenaSize<T, nc>(height, width, levels));
+    std::vector<tinycv::PyramidLevel<T>> pyramid(levels);
+
+    tinycv::BuildPyramid<T, nc>(height, width, width * nc, src.get(), levels, arena.data(), pyramid.data());
+
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    std::vector<cv::Mat> pyramid_opencv;
+    cv::buildPyramid(iMat, pyramid_opencv, levels - 1);
+
+    ASSERT_EQ((int32_t)pyramid_opencv.size(), levels);
+    for (int32_t l = 1; l < levels; ++l) {
+        const cv::Mat &ref = pyramid_opencv[l];
+        ASSERT_EQ(pyramid[l].height, ref.rows);
+        ASSERT_EQ(pyramid[l].width, ref.cols);
+        checkResult<T, nc>(pyramid[l].data, ref.ptr<T>(), ref.rows, ref.cols, pyramid[l].widthStride, (int32_t)(ref.step / sizeof(T)), diff);
+    }
+}
+
+TEST(PYR_DOWN_UINT8, x86)
+{
+    PyrDownTest<uint8_t, 1>(480, 640, 0.01f);
+    PyrDownTest<uint8_t, 3>(480, 640, 0.01f);
+    PyrDownTest<uint8_t, 4>(480, 640, 0.01f);
+    PyrDownTest<uint8_t, 1>(101, 99, 0.01f);
+    PyrDownTest<uint8_t, 3>(101, 99, 0.01f);
+    PyrDownTest<uint8_t, 4>(101, 99, 0.01f);
+}
+
+TEST(PYR_DOWN_FP32, x86)
+{
+    PyrDownTest<float, 1>(480, 640, 1e-3f);
+    PyrDownTest<float, 3>(480, 640, 1e-3f);
+    PyrDownTest<float, 4>(480, 640, 1e-3f);
+    PyrDownTest<float, 1>(101, 99, 1e-3f);
+    PyrDownTest<float, 3>(101, 99, 1e-3f);
+    PyrDownTest<float, 4>(101, 99, 1e-3f);
+}
+
+TEST(PYR_UP_UINT8, x86)
+{
+    PyrUpTest<uint8_t, 1>(240, 320, 0.01f);
+    PyrUpTest<uint8_t, 3>(240, 320, 0.01f);
+    PyrUpTest<uint8_t, 4>(240, 320, 0.01f);
+    PyrUpTest<uint8_t, 1>(51, 49, 0.01f);
+    PyrUpTest<uint8_t, 3>(51, 49, 0.01f);
+    PyrUpTest<uint8_t, 4>(51, 49, 0.01f);
+}
+
+TEST(PYR_UP_FP32, x86)
+{
+    PyrUpTest<float, 1>(240, 320, 1e-3f);
+    PyrUpTest<float, 3>(240, 320, 1e-3f);
+    PyrUpTest<float, 4>(240, 320, 1e-3f);
+    PyrUpTest<float, 1>(51, 49, 1e-3f);
+    PyrUpTest<float, 3>(51, 49, 1e-3f);
+    PyrUpTest<float, 4>(51, 49, 1e-3f);
+}
+
+TEST(BUILD_PYRAMID_UINT8, x86)
+{
+    BuildPyramidTest<uint8_t, 1>(1080, 1920, 8, 0.01f);
+    BuildPyramidTest<uint8_t, 3>(480, 640, 5, 0.01f);
+    BuildPyramidTest<uint8_t, 4>(101, 99, 4, 0.01f);
+}
+
+TEST(BUILD_PYRAMID_FP32, x86)
+{
+    BuildPyramidTest<float, 1>(1080, 1920, 8, 1e-3f);
+    BuildPyramidTest<float, 3>(480, 640, 5, 1e-3f);
+    BuildPyramidTest<float, 4>(101, 99, 4, 1e-3f);
+}
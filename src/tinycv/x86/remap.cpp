@@ -0,0 +1,498 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/remap.h"
+#include "tinycv/types.h"
+
+#include <string.h>
+#include <stdint.h>
+#include <immintrin.h>
+
+namespace tinycv {
+
+enum { REMAP_INTER_TAB_SIZE2 = REMAP_INTER_TAB_SIZE * REMAP_INTER_TAB_SIZE };
+
+// all border modes, also valid far outside the image, -1 for BORDER_CONSTANT and BORDER_TRANSPARENT
+static inline int32_t remap_border_interpolate(int32_t p, int32_t len, BorderType border_type)
+{
+    if ((uint32_t)p < (uint32_t)len) {
+        return p;
+    }
+    if (border_type == BORDER_REPLICATE) {
+        p = p < 0 ? 0 : len - 1;
+    } else if (border_type == BORDER_REFLECT || border_type == BORDER_REFLECT_101) {
+        int32_t delta = border_type == BORDER_REFLECT_101;
+        if (len == 1) {
+            return 0;
+        }
+        do {
+            if (p < 0) {
+                p = -p - 1 + delta;
+            } else {
+                p = len - 1 - (p - len) - delta;
+            }
+        } while ((uint32_t)p >= (uint32_t)len);
+    } else if (border_type == BORDER_WRAP) {
+        if (p < 0) {
+            p -= ((p - len + 1) / len) * len;
+        }
+        if (p >= len) {
+            p %= len;
+        }
+    } else {
+        p = -1;
+    }
+    return p;
+}
+
+static inline int16_t remap_saturate_s16(int32_t v)
+{
+    return (int16_t)(v < INT16_MIN ? INT16_MIN : (v > INT16_MAX ? INT16_MAX : v));
+}
+
+// same rounding and overflow behaviour as the vector conversion
+static inline int32_t remap_round(float v)
+{
+    return _mm_cvtss_si32(_mm_set_ss(v));
+}
+
+// bilinear weights of every table index, (1 - fx, fx) x (1 - fy, fy) in 1/32 steps.
+// u8 weights sum to 1 << 10, the products are exact so the fixed-point result equals the float one rounded.
+struct RemapTables {
+    int16_t w_u8[REMAP_INTER_TAB_SIZE2][4];
+    float w_f32[REMAP_INTER_TAB_SIZE2][4];
+
+    RemapTables()
+    {
+        for (int32_t fy = 0; fy < REMAP_INTER_TAB_SIZE; ++fy) {
+            for (int32_t fx = 0; fx < REMAP_INTER_TAB_SIZE; ++fx) {
+                int32_t idx = fy * REMAP_INTER_TAB_SIZE + fx;
+                int32_t ix = REMAP_INTER_TAB_SIZE - fx;
+                int32_t iy = REMAP_INTER_TAB_SIZE - fy;
+                w_u8[idx][0] = (int16_t)(ix * iy);
+                w_u8[idx][1] = (int16_t)(fx * iy);
+                w_u8[idx][2] = (int16_t)(ix * fy);
+                w_u8[idx][3] = (int16_t)(fx * fy);
+                float ax = fx * (1.f / REMAP_INTER_TAB_SIZE);
+                float ay = fy * (1.f / REMAP_INTER_TAB_SIZE);
+                w_f32[idx][0] = (1.f - ay) * (1.f - ax);
+                w_f32[idx][1] = (1.f - ay) * ax;
+                w_f32[idx][2] = ay * (1.f - ax);
+                w_f32[idx][3] = ay * ax;
+            }
+        }
+    }
+};
+
+static const RemapTables &remap_tables()
+{
+    static RemapTables tables;
+    return tables;
+}
+
+template <typename T>
+struct remap_traits;
+
+template <>
+struct remap_traits<uint8_t> {
+    typedef int32_t work_t;
+    static inline const int16_t *weights(const RemapTables &tables, int32_t idx)
+    {
+        return tables.w_u8[idx];
+    }
+    static inline uint8_t cast(int32_t v)
+    {
+        return (uint8_t)((v + (1 << 9)) >> 10);
+    }
+};
+
+template <>
+struct remap_traits<float> {
+    typedef float work_t;
+    static inline const float *weights(const RemapTables &tables, int32_t idx)
+    {
+        return tables.w_f32[idx];
+    }
+    static inline float cast(float v)
+    {
+        return v;
+    }
+};
+
+void ConvertMaps(
+    int32_t height,
+    int32_t width,
+    int32_t mapXWidthStride,
+    const float *mapX,
+    int32_t mapYWidthStride,
+    const float *mapY,
+    int32_t mapXYWidthStride,
+    int16_t *mapXY,
+    int32_t mapFracWidthStride,
+    uint16_t *mapFrac)
+{
+    if (nullptr == mapX || nullptr == mapY || nullptr == mapXY) {
+        return;
+    }
+    if (height <= 0 || width <= 0) {
+        return;
+    }
+    const __m128 v_scale = _mm_set1_ps((float)REMAP_INTER_TAB_SIZE);
+    const __m128i v_mask = _mm_set1_epi32(REMAP_INTER_TAB_SIZE - 1);
+    for (int32_t y = 0; y < height; ++y) {
+        const float *X = mapX + y * mapXWidthStride;
+        const float *Y = mapY + y * mapYWidthStride;
+        int16_t *XY = mapXY + y * mapXYWidthStride;
+        int32_t x = 0;
+        if (nullptr == mapFrac) {
+            for (; x <= width - 8; x += 8) {
+                __m128i v_x = _mm_packs_epi32(_mm_cvtps_epi32(_mm_loadu_ps(X + x)), _mm_cvtps_epi32(_mm_loadu_ps(X + x + 4)));
+                __m128i v_y = _mm_packs_epi32(_mm_cvtps_epi32(_mm_loadu_ps(Y + x)), _mm_cvtps_epi32(_mm_loadu_ps(Y + x + 4)));
+                _mm_storeu_si128((__m128i *)(XY + x * 2), _mm_unpacklo_epi16(v_x, v_y));
+                _mm_storeu_si128((__m128i *)(XY + x * 2 + 8), _mm_unpackhi_epi16(v_x, v_y));
+            }
+            for (; x < width; ++x) {
+                XY[x * 2]     = remap_saturate_s16(remap_round(X[x]));
+                XY[x * 2 + 1] = remap_saturate_s16(remap_round(Y[x]));
+            }
+            continue;
+        }
+        uint16_t *F = mapFrac + y * mapFracWidthStride;
+        for (; x <= width - 8; x += 8) {
+            __m128i ix0 = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(X + x), v_scale));
+            __m128i ix1 = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(X + x + 4), v_scale));
+            __m128i iy0 = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(Y + x), v_scale));
+            __m128i iy1 = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(Y + x + 4), v_scale));
+            __m128i v_x = _mm_packs_epi32(_mm_srai_epi32(ix0, REMAP_INTER_BITS), _mm_srai_epi32(ix1, REMAP_INTER_BITS));
+            __m128i v_y = _mm_packs_epi32(_mm_srai_epi32(iy0, REMAP_INTER_BITS), _mm_srai_epi32(iy1, REMAP_INTER_BITS));
+            _mm_storeu_si128((__m128i *)(XY + x * 2), _mm_unpacklo_epi16(v_x, v_y));
+            _mm_storeu_si128((__m128i *)(XY + x * 2 + 8), _mm_unpackhi_epi16(v_x, v_y));
+            __m128i f0 = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(iy0, v_mask), REMAP_INTER_BITS), _mm_and_si128(ix0, v_mask));
+            __m128i f1 = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(iy1, v_mask), REMAP_INTER_BITS), _mm_and_si128(ix1, v_mask));
+            _mm_storeu_si128((__m128i *)(F + x), _mm_packs_epi32(f0, f1));
+        }
+        for (; x < width; ++x) {
+            int32_t ix = remap_round(X[x] * REMAP_INTER_TAB_SIZE);
+            int32_t iy = remap_round(Y[x] * REMAP_INTER_TAB_SIZE);
+            XY[x * 2]     = remap_saturate_s16(ix >> REMAP_INTER_BITS);
+            XY[x * 2 + 1] = remap_saturate_s16(iy >> REMAP_INTER_BITS);
+            F[x]          = (uint16_t)((iy & (REMAP_INTER_TAB_SIZE - 1)) * REMAP_INTER_TAB_SIZE + (ix & (REMAP_INTER_TAB_SIZE - 1)));
+        }
+    }
+}
+
+// element offsets of four map entries, the returned mask has a bit set for every entry inside [0, w) x [0, h)
+static inline int32_t remap_offsets4(const int16_t *XY, __m128i v_w, __m128i v_h, __m128i v_stride, __m128i v_cn, int32_t *ofs)
+{
+    __m128i xy  = _mm_loadu_si128((const __m128i *)XY);
+    __m128i v_x = _mm_srai_epi32(_mm_slli_epi32(xy, 16), 16);
+    __m128i v_y = _mm_srai_epi32(xy, 16);
+    __m128i v_n = _mm_set1_epi32(-1);
+    __m128i in  = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(v_x, v_n), _mm_cmpgt_epi32(v_w, v_x)),
+                               _mm_and_si128(_mm_cmpgt_epi32(v_y, v_n), _mm_cmpgt_epi32(v_h, v_y)));
+    _mm_storeu_si128((__m128i *)ofs, _mm_add_epi32(_mm_mullo_epi32(v_y, v_stride), _mm_mullo_epi32(v_x, v_cn)));
+    return _mm_movemask_ps(_mm_castsi128_ps(in));
+}
+
+template <typename T, int32_t cn>
+static inline void remap_nearest_pixel(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t sx,
+    int32_t sy,
+    BorderType border_type,
+    T border_value,
+    T *D)
+{
+    if ((uint32_t)sx >= (uint32_t)inWidth || (uint32_t)sy >= (uint32_t)inHeight) {
+        if (border_type == BORDER_TRANSPARENT) {
+            return;
+        }
+        if (border_type == BORDER_CONSTANT) {
+            for (int32_t c = 0; c < cn; ++c) {
+                D[c] = border_value;
+            }
+            return;
+        }
+        sx = remap_border_interpolate(sx, inWidth, border_type);
+        sy = remap_border_interpolate(sy, inHeight, border_type);
+    }
+    memcpy(D, inData + sy * inWidthStride + sx * cn, cn * sizeof(T));
+}
+
+template <typename T, int32_t channels>
+void RemapNearestPoint(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t mapXYWidthStride,
+    const int16_t *mapXY,
+    BorderType border_type,
+    T border_value)
+{
+    if (nullptr == inData || nullptr == outData || nullptr == mapXY) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || outHeight <= 0 || outWidth <= 0) {
+        return;
+    }
+    if (border_type == BORDER_ISOLATED) {
+        return;
+    }
+    const __m128i v_w      = _mm_set1_epi32(inWidth);
+    const __m128i v_h      = _mm_set1_epi32(inHeight);
+    const __m128i v_stride = _mm_set1_epi32(inWidthStride);
+    const __m128i v_cn     = _mm_set1_epi32(channels);
+    int32_t ofs[4];
+    for (int32_t y = 0; y < outHeight; ++y) {
+        const int16_t *XY = mapXY + y * mapXYWidthStride;
+        T *D = outData + y * outWidthStride;
+        int32_t x = 0;
+        for (; x <= outWidth - 4; x += 4) {
+            if (remap_offsets4(XY + x * 2, v_w, v_h, v_stride, v_cn, ofs) == 0xf) {
+                for (int32_t k = 0; k < 4; ++k) {
+                    memcpy(D + (x + k) * channels, inData + ofs[k], channels * sizeof(T));
+                }
+            } else {
+                for (int32_t k = 0; k < 4; ++k) {
+                    remap_nearest_pixel<T, channels>(inHeight, inWidth, inWidthStride, inData, XY[(x + k) * 2], XY[(x + k) * 2 + 1], border_type, border_value, D + (x + k) * channels);
+                }
+            }
+        }
+        for (; x < outWidth; ++x) {
+            remap_nearest_pixel<T, channels>(inHeight, inWidth, inWidthStride, inData, XY[x * 2], XY[x * 2 + 1], border_type, border_value, D + x * channels);
+        }
+    }
+}
+
+template <typename T, int32_t cn>
+static inline void remap_linear_pixel(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t sx,
+    int32_t sy,
+    int32_t idx,
+    BorderType border_type,
+    T border_value,
+    T *D)
+{
+    typedef typename remap_traits<T>::work_t work_t;
+    const RemapTables &tables = remap_tables();
+    const auto *w = remap_traits<T>::weights(tables, idx);
+    const T *p[4];
+    if ((uint32_t)sx < (uint32_t)(inWidth - 1) && (uint32_t)sy < (uint32_t)(inHeight - 1)) {
+        p[0] = inData + sy * inWidthStride + sx * cn;
+        p[1] = p[0] + cn;
+        p[2] = p[0] + inWidthStride;
+        p[3] = p[2] + cn;
+    } else {
+        if (border_type == BORDER_TRANSPARENT) {
+            return;
+        }
+        int32_t x0 = remap_border_interpolate(sx, inWidth, border_type);
+        int32_t x1 = remap_border_interpolate(sx + 1, inWidth, border_type);
+        int32_t y0 = remap_border_interpolate(sy, inHeight, border_type);
+        int32_t y1 = remap_border_interpolate(sy + 1, inHeight, border_type);
+        // BORDER_CONSTANT neighbours outside the image are left null and read as border_value
+        p[0] = x0 >= 0 && y0 >= 0 ? inData + y0 * inWidthStride + x0 * cn : nullptr;
+        p[1] = x1 >= 0 && y0 >= 0 ? inData + y0 * inWidthStride + x1 * cn : nullptr;
+        p[2] = x0 >= 0 && y1 >= 0 ? inData + y1 * inWidthStride + x0 * cn : nullptr;
+        p[3] = x1 >= 0 && y1 >= 0 ? inData + y1 * inWidthStride + x1 * cn : nullptr;
+    }
+    for (int32_t c = 0; c < cn; ++c) {
+        work_t sum = 0;
+        for (int32_t k = 0; k < 4; ++k) {
+            sum += (work_t)(p[k] ? p[k][c] : border_value) * w[k];
+        }
+        D[c] = remap_traits<T>::cast(sum);
+    }
+}
+
+// four single channel pixels whose neighbourhoods are inside the image
+static inline void remap_linear_inside4_c1(const uint8_t *inData, int32_t inWidthStride, const int32_t *ofs, const int32_t *idx, uint8_t *D)
+{
+    const RemapTables &tables = remap_tables();
+    int32_t v[4];
+    for (int32_t k = 0; k < 4; ++k) {
+        const uint8_t *s = inData + ofs[k];
+        uint16_t r0, r1;
+        memcpy(&r0, s, sizeof(r0));
+        memcpy(&r1, s + inWidthStride, sizeof(r1));
+        v[k] = (int32_t)r0 | ((int32_t)r1 << 16);
+    }
+    __m128i pix  = _mm_loadu_si128((const __m128i *)v);
+    __m128i zero = _mm_setzero_si128();
+    __m128i w01  = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)tables.w_u8[idx[0]]), _mm_loadl_epi64((const __m128i *)tables.w_u8[idx[1]]));
+    __m128i w23  = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)tables.w_u8[idx[2]]), _mm_loadl_epi64((const __m128i *)tables.w_u8[idx[3]]));
+    __m128i s01  = _mm_madd_epi16(_mm_unpacklo_epi8(pix, zero), w01);
+    __m128i s23  = _mm_madd_epi16(_mm_unpackhi_epi8(pix, zero), w23);
+    __m128i sum  = _mm_srli_epi32(_mm_add_epi32(_mm_hadd_epi32(s01, s23), _mm_set1_epi32(1 << 9)), 10);
+    sum          = _mm_packus_epi16(_mm_packs_epi32(sum, sum), sum);
+    int32_t res  = _mm_cvtsi128_si32(sum);
+    memcpy(D, &res, sizeof(res));
+}
+
+static inline void remap_linear_inside4_c1(const float *inData, int32_t inWidthStride, const int32_t *ofs, const int32_t *idx, float *D)
+{
+    const RemapTables &tables = remap_tables();
+    __m128 m[4];
+    for (int32_t k = 0; k < 4; ++k) {
+        const float *s = inData + ofs[k];
+        __m128 p = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)s);
+        p        = _mm_loadh_pi(p, (const __m64 *)(s + inWidthStride));
+        m[k]     = _mm_mul_ps(p, _mm_loadu_ps(tables.w_f32[idx[k]]));
+    }
+    _mm_storeu_ps(D, _mm_hadd_ps(_mm_hadd_ps(m[0], m[1]), _mm_hadd_ps(m[2], m[3])));
+}
+
+// one 3 or 4 channel pixel whose neighbourhood is inside the image, 3 channel loads never pass the right neighbour
+static inline __m128i remap_load_pair_u8(const uint8_t *s, int32_t cn)
+{
+    int32_t a, b;
+    memcpy(&a, s, sizeof(a));
+    if (cn == 4) {
+        memcpy(&b, s + 4, sizeof(b));
+    } else {
+        memcpy(&b, s + 2, sizeof(b));
+        b = (int32_t)((uint32_t)b >> 8);
+    }
+    // (p00, p01) of every channel next to each other for madd
+    const __m128i v_pairs = _mm_setr_epi8(0, 4, 1, 5, 2, 6, 3, 7, -1, -1, -1, -1, -1, -1, -1, -1);
+    __m128i v = _mm_unpacklo_epi32(_mm_cvtsi32_si128(a), _mm_cvtsi32_si128(b));
+    return _mm_unpacklo_epi8(_mm_shuffle_epi8(v, v_pairs), _mm_setzero_si128());
+}
+
+static inline void remap_linear_inside1(const uint8_t *s, int32_t inWidthStride, int32_t cn, int32_t idx, uint8_t *D)
+{
+    const int16_t *w = remap_tables().w_u8[idx];
+    __m128i w01 = _mm_set1_epi32((int32_t)(uint16_t)w[0] | ((int32_t)w[1] << 16));
+    __m128i w23 = _mm_set1_epi32((int32_t)(uint16_t)w[2] | ((int32_t)w[3] << 16));
+    __m128i sum = _mm_add_epi32(_mm_madd_epi16(remap_load_pair_u8(s, cn), w01),
+                                _mm_madd_epi16(remap_load_pair_u8(s + inWidthStride, cn), w23));
+    sum         = _mm_srli_epi32(_mm_add_epi32(sum, _mm_set1_epi32(1 << 9)), 10);
+    sum         = _mm_packus_epi16(_mm_packs_epi32(sum, sum), sum);
+    int32_t res = _mm_cvtsi128_si32(sum);
+    memcpy(D, &res, cn);
+}
+
+static inline __m128 remap_load_right_f32(const float *s, int32_t cn)
+{
+    if (cn == 4) {
+        return _mm_loadu_ps(s + 4);
+    }
+    return _mm_castsi128_ps(_mm_srli_si128(_mm_castps_si128(_mm_loadu_ps(s + 2)), 4));
+}
+
+static inline void remap_linear_inside1(const float *s, int32_t inWidthStride, int32_t cn, int32_t idx, float *D)
+{
+    const float *w = remap_tables().w_f32[idx];
+    const float *s1 = s + inWidthStride;
+    __m128 res = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(s), _mm_set1_ps(w[0])), _mm_mul_ps(remap_load_right_f32(s, cn), _mm_set1_ps(w[1]))),
+                            _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(s1), _mm_set1_ps(w[2])), _mm_mul_ps(remap_load_right_f32(s1, cn), _mm_set1_ps(w[3]))));
+    if (cn == 4) {
+        _mm_storeu_ps(D, res);
+    } else {
+        _mm_storel_pi((__m64 *)D, res);
+        _mm_store_ss(D + 2, _mm_movehl_ps(res, res));
+    }
+}
+
+template <typename T, int32_t channels>
+void RemapLinear(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t mapXYWidthStride,
+    const int16_t *mapXY,
+    int32_t mapFracWidthStride,
+    const uint16_t *mapFrac,
+    BorderType border_type,
+    T border_value)
+{
+    if (nullptr == inData || nullptr == outData || nullptr == mapXY || nullptr == mapFrac) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || outHeight <= 0 || outWidth <= 0) {
+        return;
+    }
+    if (border_type == BORDER_ISOLATED) {
+        return;
+    }
+    remap_tables();
+    // the whole 2x2 neighbourhood is inside for sx < inWidth - 1 and sy < inHeight - 1
+    const __m128i v_w      = _mm_set1_epi32(inWidth - 1);
+    const __m128i v_h      = _mm_set1_epi32(inHeight - 1);
+    const __m128i v_stride = _mm_set1_epi32(inWidthStride);
+    const __m128i v_cn     = _mm_set1_epi32(channels);
+    int32_t ofs[4], idx[4];
+    for (int32_t y = 0; y < outHeight; ++y) {
+        const int16_t *XY = mapXY + y * mapXYWidthStride;
+        const uint16_t *F = mapFrac + y * mapFracWidthStride;
+        T *D = outData + y * outWidthStride;
+        int32_t x = 0;
+        for (; x <= outWidth - 4; x += 4) {
+            for (int32_t k = 0; k < 4; ++k) {
+                idx[k] = F[x + k] & (REMAP_INTER_TAB_SIZE2 - 1);
+            }
+            if (remap_offsets4(XY + x * 2, v_w, v_h, v_stride, v_cn, ofs) == 0xf) {
+                if (channels == 1) {
+                    remap_linear_inside4_c1(inData, inWidthStride, ofs, idx, D + x);
+                } else {
+                    for (int32_t k = 0; k < 4; ++k) {
+                        remap_linear_inside1(inData + ofs[k], inWidthStride, channels, idx[k], D + (x + k) * channels);
+                    }
+                }
+            } else {
+                for (int32_t k = 0; k < 4; ++k) {
+                    remap_linear_pixel<T, channels>(inHeight, inWidth, inWidthStride, inData, XY[(x + k) * 2], XY[(x + k) * 2 + 1], idx[k], border_type, border_value, D + (x + k) * channels);
+                }
+            }
+        }
+        for (; x < outWidth; ++x) {
+            remap_linear_pixel<T, channels>(inHeight, inWidth, inWidthStride, inData, XY[x * 2], XY[x * 2 + 1], F[x] & (REMAP_INTER_TAB_SIZE2 - 1), border_type, border_value, D + x * channels);
+        }
+    }
+}
+
+template void RemapNearestPoint<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t mapXYWidthStride, const int16_t *mapXY, BorderType border_type, uint8_t border_value);
+template void RemapNearestPoint<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t mapXYWidthStride, const int16_t *mapXY, BorderType border_type, uint8_t border_value);
+template void RemapNearestPoint<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t mapXYWidthStride, const int16_t *mapXY, BorderType border_type, uint8_t border_value);
+template void RemapNearestPoint<float, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t mapXYWidthStride, const int16_t *mapXY, BorderType border_type, float border_value);
+template void RemapNearestPoint<float, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t mapXYWidthStride, const int16_t *mapXY, BorderType border_type, float border_value);
+template void RemapNearestPoint<float, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t mapXYWidthStride, const int16_t *mapXY, BorderType border_type, float border_value);
+
+template void RemapLinear<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t mapXYWidthStride, const int16_t *mapXY, int32_t mapFracWidthStride, const uint16_t *mapFrac, BorderType border_type, uint8_t border_value);
+template void RemapLinear<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t mapXYWidthStride, const int16_t *mapXY, int32_t mapFracWidthStride, const uint16_t *mapFrac, BorderType border_type, uint8_t border_value);
+template void RemapLinear<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t mapXYWidthStride, const int16_t *mapXY, int32_t mapFracWidthStride, const uint16_t *mapFrac, BorderType border_type, uint8_t border_value);
+template void RemapLinear<float, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t mapXYWidthStride, const int16_t *mapXY, int32_t mapFracWidthStride, const uint16_t *mapFrac, BorderType border_type, float border_value);
+template void RemapLinear<float, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t mapXYWidthStride, const int16_t *mapXY, int32_t mapFracWidthStride, const uint16_t *mapFrac, BorderType border_type, float border_value);
+template void RemapLinear<float, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t mapXYWidthStride, const int16_t *mapXY, int32_t mapFracWidthStride, const uint16_t *mapFrac, BorderType border_type, float border_value);
+} // namespace tinycv
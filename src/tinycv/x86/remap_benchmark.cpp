@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/remap.h"
+#include "tinycv/debug.h"
+
+#include <opencv2/imgproc.hpp>
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+// a mild barrel distortion, the typical lens undistortion map
+void MakeUndistortMaps(int32_t height, int32_t width, float *mapX, float *mapY)
+{
+    float cx = 0.5f * width, cy = 0.5f * height;
+    float norm = 1.f / (cx * cx + cy * cy);
+    for (int32_t y = 0; y < height; ++y) {
+        for (int32_t x = 0; x < width; ++x) {
+            float dx = x - cx, dy = y - cy;
+            float k = 1.f + 0.12f * (dx * dx + dy * dy) * norm;
+            mapX[y * width + x] = cx + dx * k;
+            mapY[y * width + x] = cy + dy * k;
+        }
+    }
+}
+
+void BM_ConvertMaps_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::vector<float> mapX(height * width), mapY(height * width);
+    MakeUndistortMaps(height, width, mapX.data(), mapY.data());
+    std::vector<int16_t> mapXY(height * width * 2);
+    std::vector<uint16_t> mapFrac(height * width);
+
+    for (auto _ : state) {
+        tinycv::ConvertMaps(height, width, width, mapX.data(), width, mapY.data(), width * 2, mapXY.data(), width, mapFrac.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+template <typename T, int32_t nc, tinycv::InterpolationType mode>
+void BM_Remap_tinycv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    std::vector<float> mapX(height * width), mapY(height * width);
+    MakeUndistortMaps(height, width, mapX.data(), mapY.data());
+    std::vector<int16_t> mapXY(height * width * 2);
+    std::vector<uint16_t> mapFrac(height * width);
+    bool nearest = mode == tinycv::INTERPOLATION_NEAREST_POINT;
+    tinycv::ConvertMaps(height, width, width, mapX.data(), width, mapY.data(), width * 2, mapXY.data(), width, nearest ? nullptr : mapFrac.data());
+
+    for (auto _ : state) {
+        if (nearest) {
+            tinycv::RemapNearestPoint<T, nc>(height, width, width * nc, src.get(), height, width, width * nc, dst.get(), width * 2, mapXY.data());
+        } else {
+            tinycv::RemapLinear<T, nc>(height, width, width * nc, src.get(), height, width, width * nc, dst.get(), width * 2, mapXY.data(), width, mapFrac.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+using namespace tinycv::debug;
+
+BENCHMARK(BM_ConvertMaps_tinycv_x86)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_tinycv_x86, uint8_t, c1, tinycv::INTERPOLATION_NEAREST_POINT)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_tinycv_x86, uint8_t, c3, tinycv::INTERPOLATION_NEAREST_POINT)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_tinycv_x86, uint8_t, c1, tinycv::INTERPOLATION_LINEAR)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_tinycv_x86, uint8_t, c3, tinycv::INTERPOLATION_LINEAR)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_tinycv_x86, uint8_t, c4, tinycv::INTERPOLATION_LINEAR)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_tinycv_x86, float, c1, tinycv::INTERPOLATION_LINEAR)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_tinycv_x86, float, c3, tinycv::INTERPOLATION_LINEAR)->Args({640, 480})->Args({1920, 1080});
+
+#ifdef TINYCV_BENCHMARK_OPENCV
+template <typename T, int32_t nc, tinycv::InterpolationType mode>
+static void BM_Remap_opencv_x86(benchmark::State &state)
+{
+    int32_t width = state.range(0);
+    int32_t height = state.range(1);
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+    std::vector<float> mapX(height * width), mapY(height * width);
+    MakeUndistortMaps(height, width, mapX.data(), mapY.data());
+    cv::Mat iMat(height, width, T2CvType<T, nc>::type, src.get());
+    cv::Mat xMat(height, width, CV_32FC1, mapX.data());
+    cv::Mat yMat(height, width, CV_32FC1, mapY.data());
+    bool nearest = mode == tinycv::INTERPOLATION_NEAREST_POINT;
+    cv::Mat xyMat, fracMat, oMat;
+    cv::convertMaps(xMat, yMat, xyMat, fracMat, CV_16SC2, nearest);
+    for (auto _ : state) {
+        cv::remap(iMat, oMat, xyMat, fracMat, nearest ? cv::INTER_NEAREST : cv::INTER_LINEAR);
+    }
+    state.SetItemsProcessed(state.iterations() * 1);
+}
+
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, uint8_t, c1, tinycv::INTERPOLATION_NEAREST_POINT)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, uint8_t, c3, tinycv::INTERPOLATION_NEAREST_POINT)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, uint8_t, c1, tinycv::INTERPOLATION_LINEAR)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, uint8_t, c3, tinycv::INTERPOLATION_LINEAR)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, uint8_t, c4, tinycv::INTERPOLATION_LINEAR)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, float, c1, tinycv::INTERPOLATION_LINEAR)->Args({640, 480})->Args({1920, 1080});
+BENCHMARK_TEMPLATE(BM_Remap_opencv_x86, float, c3, tinycv::INTERPOLATION_LINEAR)->Args({640, 480})->Args({1920, 1080});
+
+#endif //! TINYCV_BENCHMARK_OPENCV
+} // namespace
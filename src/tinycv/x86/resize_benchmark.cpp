@@ -16,6 +16,7 @@
 // under the License.
 
 #include "tinycv/resize.h"
+#include "tinycv/stream.h"
 #include "tinycv/debug.h"
 #include "tinycv/types.h"
 
@@ -33,6 +34,7 @@ public:
     int32_t inHeight;
     int32_t outWidth;
     int32_t outHeight;
+    tinycv::StreamContext context;
     ResizeBenchmark(int32_t inWidth, int32_t inHeight, int32_t outWidth, int32_t outHeight)
         : inWidth(inWidth)
         , inHeight(inHeight)
@@ -83,6 +85,85 @@ public:
         }
     }
 
+    // kept out of apply() so types without a cubic kernel still build
+    void apply_cubic()
+    {
+        tinycv::ResizeCubic<T, channels>(this->inHeight,
+                                         this->inWidth,
+                                         this->inWidth * channels,
+                                         this->dev_iImage,
+                                         this->outHeight,
+                                         this->outWidth,
+                                         this->outWidth * channels,
+                                         this->dev_oImage);
+    }
+
+    void apply_cubic_opencv()
+    {
+        cv::Mat src_opencv(inHeight, inWidth, CV_MAKETYPE(cv::DataType<T>::depth, channels), dev_iImage);
+        cv::Mat dst_opencv(outHeight, outWidth, CV_MAKETYPE(cv::DataType<T>::depth, channels), dev_oImage);
+
+        cv::resize(src_opencv, dst_opencv, cv::Size(outWidth, outHeight), 0, 0, cv::INTER_CUBIC);
+    }
+
+    void apply_lanczos()
+    {
+        tinycv::ResizeLanczos<T, channels>(this->inHeight,
+                                           this->inWidth,
+                                           this->inWidth * channels,
+                                           this->dev_iImage,
+                                           this->outHeight,
+                                           this->outWidth,
+                                           this->outWidth * channels,
+                                           this->dev_oImage);
+    }
+
+    void apply_lanczos_opencv()
+    {
+        cv::Mat src_opencv(inHeight, inWidth, CV_MAKETYPE(cv::DataType<T>::depth, channels), dev_iImage);
+        cv::Mat dst_opencv(outHeight, outWidth, CV_MAKETYPE(cv::DataType<T>::depth, channels), dev_oImage);
+
+        cv::resize(src_opencv, dst_opencv, cv::Size(outWidth, outHeight), 0, 0, cv::INTER_LANCZOS4);
+    }
+
+    void apply_stream()
+    {
+        tinycv::ResizeLinear<T, channels>(this->context,
+                                          this->inHeight,
+                                          this->inWidth,
+                                          this->inWidth * channels,
+                                          this->dev_iImage,
+                                          this->outHeight,
+                                          this->outWidth,
+                                          this->outWidth * channels,
+                                          this->dev_oImage);
+    }
+
+    // the whole output in tiles of tileSize x tileSize, one region call each
+    void apply_region(int32_t tileSize)
+    {
+        double scaleY = tinycv::ResizeLinearScale(inHeight, outHeight);
+        double scaleX = tinycv::ResizeLinearScale(inWidth, outWidth);
+        for (int32_t y = 0; y < outHeight; y += tileSize) {
+            for (int32_t x = 0; x < outWidth; x += tileSize) {
+                tinycv::ResizeLinearRegion<T, channels>(this->inHeight,
+                                                        this->inWidth,
+                                                        this->inWidth * channels,
+                                                        this->dev_iImage,
+                                                        tileSize < outHeight - y ? tileSize : outHeight - y,
+                                                        tileSize < outWidth - x ? tileSize : outWidth - x,
+                                                        this->outWidth * channels,
+                                                        this->dev_oImage + y * outWidth * channels + x * channels,
+                                                        scaleY,
+                                                        scaleX,
+                                                        0.0,
+                                                        0.0,
+                                                        y,
+                                                        x);
+            }
+        }
+    }
+
     ~ResizeBenchmark()
     {
         free(this->dev_iImage);
@@ -112,31 +193,145 @@ static void BM_Resize_opencv_x86(benchmark::State& state)
     state.SetItemsProcessed(state.iterations());
 }
 
+template <typename T, int32_t channels>
+static void BM_ResizeCubic_tinycv_x86(benchmark::State& state)
+{
+    ResizeBenchmark<T, channels, tinycv::INTERPOLATION_CUBIC> bm(state.range(0), state.range(1), state.range(2), state.range(3));
+    for (auto _ : state) {
+        bm.apply_cubic();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T, int32_t channels>
+static void BM_ResizeCubic_opencv_x86(benchmark::State& state)
+{
+    ResizeBenchmark<T, channels, tinycv::INTERPOLATION_CUBIC> bm(state.range(0), state.range(1), state.range(2), state.range(3));
+    for (auto _ : state) {
+        bm.apply_cubic_opencv();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T, int32_t channels>
+static void BM_ResizeLanczos_tinycv_x86(benchmark::State& state)
+{
+    ResizeBenchmark<T, channels, tinycv::INTERPOLATION_LINEAR> bm(state.range(0), state.range(1), state.range(2), state.range(3));
+    for (auto _ : state) {
+        bm.apply_lanczos();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T, int32_t channels>
+static void BM_ResizeLanczos_opencv_x86(benchmark::State& state)
+{
+    ResizeBenchmark<T, channels, tinycv::INTERPOLATION_LINEAR> bm(state.range(0), state.range(1), state.range(2), state.range(3));
+    for (auto _ : state) {
+        bm.apply_lanczos_opencv();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T, int32_t channels>
+static void BM_ResizeLinearStream_tinycv_x86(benchmark::State& state)
+{
+    ResizeBenchmark<T, channels, tinycv::INTERPOLATION_LINEAR> bm(state.range(0), state.range(1), state.range(2), state.range(3));
+    for (auto _ : state) {
+        bm.apply_stream();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename T, int32_t channels>
+static void BM_ResizeLinearRegion_tinycv_x86(benchmark::State& state)
+{
+    ResizeBenchmark<T, channels, tinycv::INTERPOLATION_LINEAR> bm(state.range(0), state.range(1), state.range(2), state.range(3));
+    for (auto _ : state) {
+        bm.apply_region(state.range(4));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
 using namespace tinycv::debug;
 using tinycv::INTERPOLATION_LINEAR;
 using tinycv::INTERPOLATION_NEAREST_POINT;
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, float, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, float, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, float, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, float, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, float, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, float, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, float, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, float, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, float, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, float, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, float, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, float, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint8_t, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint8_t, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint8_t, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint8_t, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint8_t, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint8_t, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
-BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, float, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, float, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, float, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, float, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, float, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, float, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, float, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, float, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, float, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, float, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, float, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, float, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint8_t, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint8_t, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint8_t, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint8_t, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint8_t, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint8_t, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+BENCHMARK_TEMPLATE(BM_Resize_opencv_x86, uint8_t, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720})->Args({1920, 1080, 480, 270});
+
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint16_t, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint16_t, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint16_t, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint16_t, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint16_t, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, uint16_t, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, tinycv::half_t, c1, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, tinycv::half_t, c3, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, tinycv::half_t, c4, INTERPOLATION_LINEAR)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, tinycv::half_t, c1, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, tinycv::half_t, c3, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_Resize_tinycv_x86, tinycv::half_t, c4, INTERPOLATION_NEAREST_POINT)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+
+BENCHMARK_TEMPLATE(BM_ResizeCubic_tinycv_x86, uint8_t, c1)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_opencv_x86, uint8_t, c1)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_tinycv_x86, uint8_t, c3)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_opencv_x86, uint8_t, c3)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_tinycv_x86, uint8_t, c4)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_opencv_x86, uint8_t, c4)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_tinycv_x86, float, c1)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_opencv_x86, float, c1)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_tinycv_x86, float, c3)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_opencv_x86, float, c3)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_tinycv_x86, float, c4)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeCubic_opencv_x86, float, c4)->Args({320, 240, 640, 480})->Args({640, 480, 320, 240})->Args({1280, 720, 800, 600})->Args({800, 600, 1280, 720});
+
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_tinycv_x86, uint8_t, c1)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_opencv_x86, uint8_t, c1)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_tinycv_x86, uint8_t, c3)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_opencv_x86, uint8_t, c3)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_tinycv_x86, uint8_t, c4)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_opencv_x86, uint8_t, c4)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_tinycv_x86, float, c1)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_opencv_x86, float, c1)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_tinycv_x86, float, c3)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_opencv_x86, float, c3)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_tinycv_x86, float, c4)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+BENCHMARK_TEMPLATE(BM_ResizeLanczos_opencv_x86, float, c4)->Args({1920, 1080, 480, 270})->Args({1280, 720, 160, 90})->Args({640, 480, 1280, 960});
+
+BENCHMARK_TEMPLATE(BM_ResizeLinearRegion_tinycv_x86, uint8_t, c1)->Args({1920, 1080, 1280, 720, 64})->Args({1920, 1080, 1280, 720, 256})->Args({1920, 1080, 1280, 720, 4096})->Args({640, 480, 1280, 960, 128});
+BENCHMARK_TEMPLATE(BM_ResizeLinearRegion_tinycv_x86, uint8_t, c3)->Args({1920, 1080, 1280, 720, 64})->Args({1920, 1080, 1280, 720, 256})->Args({1920, 1080, 1280, 720, 4096})->Args({640, 480, 1280, 960, 128});
+BENCHMARK_TEMPLATE(BM_ResizeLinearRegion_tinycv_x86, uint8_t, c4)->Args({1920, 1080, 1280, 720, 64})->Args({1920, 1080, 1280, 720, 256})->Args({1920, 1080, 1280, 720, 4096})->Args({640, 480, 1280, 960, 128});
+BENCHMARK_TEMPLATE(BM_ResizeLinearRegion_tinycv_x86, float, c1)->Args({1920, 1080, 1280, 720, 64})->Args({1920, 1080, 1280, 720, 256})->Args({1920, 1080, 1280, 720, 4096})->Args({640, 480, 1280, 960, 128});
+BENCHMARK_TEMPLATE(BM_ResizeLinearRegion_tinycv_x86, float, c3)->Args({1920, 1080, 1280, 720, 64})->Args({1920, 1080, 1280, 720, 256})->Args({1920, 1080, 1280, 720, 4096})->Args({640, 480, 1280, 960, 128});
+BENCHMARK_TEMPLATE(BM_ResizeLinearRegion_tinycv_x86, float, c4)->Args({1920, 1080, 1280, 720, 64})->Args({1920, 1080, 1280, 720, 256})->Args({1920, 1080, 1280, 720, 4096})->Args({640, 480, 1280, 960, 128});
+
+BENCHMARK_TEMPLATE(BM_ResizeLinearStream_tinycv_x86, uint8_t, c1)->Args({320, 240, 640, 480})->Args({1280, 720, 800, 600})->Args({1920, 1080, 480, 270})->Args({1920, 1080, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeLinearStream_tinycv_x86, uint8_t, c3)->Args({320, 240, 640, 480})->Args({1280, 720, 800, 600})->Args({1920, 1080, 480, 270})->Args({1920, 1080, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeLinearStream_tinycv_x86, uint8_t, c4)->Args({320, 240, 640, 480})->Args({1280, 720, 800, 600})->Args({1920, 1080, 480, 270})->Args({1920, 1080, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeLinearStream_tinycv_x86, float, c1)->Args({320, 240, 640, 480})->Args({1280, 720, 800, 600})->Args({1920, 1080, 480, 270})->Args({1920, 1080, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeLinearStream_tinycv_x86, float, c3)->Args({320, 240, 640, 480})->Args({1280, 720, 800, 600})->Args({1920, 1080, 480, 270})->Args({1920, 1080, 1280, 720});
+BENCHMARK_TEMPLATE(BM_ResizeLinearStream_tinycv_x86, float, c4)->Args({320, 240, 640, 480})->Args({1280, 720, 800, 600})->Args({1920, 1080, 480, 270})->Args({1920, 1080, 1280, 720});
@@ -0,0 +1,362 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/resize.h"
+#include "tinycv/types.h"
+#include "tinycv/sys.h"
+#include "tinycv/x86/sysinfo.h"
+#include "tinycv/x86/fma/internal_fma.hpp"
+
+#include <string.h>
+#include <limits.h>
+#include <immintrin.h>
+#include <stdint.h>
+#include <cmath>
+#include <algorithm>
+
+namespace tinycv {
+
+#define INTER_RESIZE_COEF_BITS  (11)
+#define INTER_RESIZE_COEF_SCALE (1 << INTER_RESIZE_COEF_BITS)
+
+static inline int32_t resize_img_floor(float a)
+{
+    return (((a) >= 0) ? ((int32_t)a) : ((int32_t)a - 1));
+}
+
+static inline void resize_cubic_interpolate(float x, float *coeffs)
+{
+    const float A = -0.75f;
+
+    coeffs[0] = ((A * (x + 1) - 5 * A) * (x + 1) + 8 * A) * (x + 1) - 4 * A;
+    coeffs[1] = ((A + 2) * x - (A + 3)) * x * x + 1;
+    coeffs[2] = ((A + 2) * (1 - x) - (A + 3)) * (1 - x) * (1 - x) + 1;
+    coeffs[3] = 1.f - coeffs[0] - coeffs[1] - coeffs[2];
+}
+
+template <typename T>
+struct resize_cubic_traits;
+
+// u8 rows keep 11 bit weighted sums, the vertical pass removes both scales at once
+template <>
+struct resize_cubic_traits<uint8_t> {
+    typedef int16_t coeff_t;
+    typedef int32_t row_t;
+
+    static inline int16_t cast_coeff(float coeff)
+    {
+        int32_t iv = (int32_t)lrintf(coeff * INTER_RESIZE_COEF_SCALE);
+        return (int16_t)(iv > SHRT_MIN ? (iv < SHRT_MAX ? iv : SHRT_MAX) : SHRT_MIN);
+    }
+    static inline uint8_t cast_dst(int32_t value)
+    {
+        value = (value + (1 << (INTER_RESIZE_COEF_BITS * 2 - 1))) >> (INTER_RESIZE_COEF_BITS * 2);
+        return (uint8_t)(value > 255 ? 255 : (value < 0 ? 0 : value));
+    }
+};
+
+template <>
+struct resize_cubic_traits<float> {
+    typedef float coeff_t;
+    typedef float row_t;
+
+    static inline float cast_coeff(float coeff)
+    {
+        return coeff;
+    }
+    static inline float cast_dst(float value)
+    {
+        return value;
+    }
+};
+
+// ofs[i] is the source index of the second tap, taps out of [0, inSize) are clamped when used.
+// The weights are repeated for every channel and stored tap by tap, `coeff[k * outSize * channels + i * channels + c]`.
+// Returns the first output index whose taps do not start before the image.
+template <typename T>
+static int32_t resize_cubic_calc_offset(
+    int32_t inSize,
+    int32_t outSize,
+    int32_t channels,
+    int32_t *ofs,
+    typename resize_cubic_traits<T>::coeff_t *coeff)
+{
+    double inv_scale = (double)outSize / inSize;
+    double scale = 1.0 / inv_scale;
+    int32_t coeff_stride = outSize * channels;
+
+    int32_t first_inner = outSize;
+    for (int32_t i = outSize - 1; i >= 0; --i) {
+        float float_i = (float)((i + 0.5) * scale - 0.5);
+        int32_t int_i = resize_img_floor(float_i);
+        float_i -= int_i;
+
+        float cbuf[4];
+        resize_cubic_interpolate(float_i, cbuf);
+        ofs[i] = int_i;
+        for (int32_t k = 0; k < 4; ++k) {
+            for (int32_t c = 0; c < channels; ++c) {
+                coeff[k * coeff_stride + i * channels + c] = resize_cubic_traits<T>::cast_coeff(cbuf[k]);
+            }
+        }
+        if (int_i >= 1) {
+            first_inner = i;
+        }
+    }
+    return first_inner;
+}
+
+template <typename T>
+static void resize_cubic_w_oneline(
+    const T *src,
+    int32_t inWidth,
+    int32_t channels,
+    const int32_t *x_sx,
+    const typename resize_cubic_traits<T>::coeff_t *x_coeff,
+    int32_t n,
+    int32_t begin,
+    int32_t end,
+    typename resize_cubic_traits<T>::row_t *row)
+{
+    typedef typename resize_cubic_traits<T>::row_t row_t;
+    for (int32_t i = begin; i < end; ++i) {
+        int32_t w = i / channels;
+        int32_t c = i - w * channels;
+        row_t value = 0;
+        for (int32_t k = 0; k < 4; ++k) {
+            int32_t sx = std::min(std::max(x_sx[w] + k - 1, 0), inWidth - 1);
+            value += (row_t)src[sx * channels + c] * x_coeff[k * n + i];
+        }
+        row[i] = value;
+    }
+}
+
+static int32_t resize_cubic_w_simd(const uint8_t *src, int32_t inWidth, int32_t channels, const int32_t *x_ofs, const int16_t *x_coeff, int32_t n, int32_t begin, int32_t *row)
+{
+    if (CpuSupports(ISA_X86_FMA)) {
+        return fma::resize_cubic_w_fma(src, inWidth * channels, channels, x_ofs, x_coeff, n, begin, row);
+    }
+    return begin;
+}
+
+static int32_t resize_cubic_w_simd(const float *src, int32_t inWidth, int32_t channels, const int32_t *x_ofs, const float *x_coeff, int32_t n, int32_t begin, float *row)
+{
+    if (CpuSupports(ISA_X86_FMA)) {
+        return fma::resize_cubic_w_fma(src, inWidth * channels, channels, x_ofs, x_coeff, n, begin, row);
+    }
+    return begin;
+}
+
+static void resize_cubic_h(const int32_t *const *rows, const int16_t *y_coeff, int32_t n, uint8_t *dst)
+{
+    int32_t i = 0;
+    if (CpuSupports(ISA_X86_FMA)) {
+        i = fma::resize_cubic_h_fma(rows, y_coeff, n, dst);
+    }
+
+    __m128i m_coeff[4];
+    for (int32_t k = 0; k < 4; ++k) {
+        m_coeff[k] = _mm_set1_epi32(y_coeff[k]);
+    }
+    __m128i m_delta = _mm_set1_epi32(1 << (INTER_RESIZE_COEF_BITS * 2 - 1));
+    for (; i <= n - 8; i += 8) {
+        __m128i m_lo = m_delta, m_hi = m_delta;
+        for (int32_t k = 0; k < 4; ++k) {
+            m_lo = _mm_add_epi32(m_lo, _mm_mullo_epi32(_mm_loadu_si128((const __m128i *)(rows[k] + i)), m_coeff[k]));
+            m_hi = _mm_add_epi32(m_hi, _mm_mullo_epi32(_mm_loadu_si128((const __m128i *)(rows[k] + i + 4)), m_coeff[k]));
+        }
+        m_lo = _mm_srai_epi32(m_lo, INTER_RESIZE_COEF_BITS * 2);
+        m_hi = _mm_srai_epi32(m_hi, INTER_RESIZE_COEF_BITS * 2);
+        __m128i m_dst = _mm_packs_epi32(m_lo, m_hi);
+        _mm_storel_epi64((__m128i *)(dst + i), _mm_packus_epi16(m_dst, m_dst));
+    }
+    for (; i < n; ++i) {
+        int32_t value = rows[0][i] * y_coeff[0] + rows[1][i] * y_coeff[1] + rows[2][i] * y_coeff[2] + rows[3][i] * y_coeff[3];
+        dst[i] = resize_cubic_traits<uint8_t>::cast_dst(value);
+    }
+}
+
+static void resize_cubic_h(const float *const *rows, const float *y_coeff, int32_t n, float *dst)
+{
+    int32_t i = 0;
+    if (CpuSupports(ISA_X86_FMA)) {
+        i = fma::resize_cubic_h_fma(rows, y_coeff, n, dst);
+    }
+
+    __m128 m_coeff[4];
+    for (int32_t k = 0; k < 4; ++k) {
+        m_coeff[k] = _mm_set1_ps(y_coeff[k]);
+    }
+    for (; i <= n - 4; i += 4) {
+        __m128 m_dst = _mm_mul_ps(_mm_loadu_ps(rows[0] + i), m_coeff[0]);
+        m_dst = _mm_add_ps(m_dst, _mm_mul_ps(_mm_loadu_ps(rows[1] + i), m_coeff[1]));
+        m_dst = _mm_add_ps(m_dst, _mm_mul_ps(_mm_loadu_ps(rows[2] + i), m_coeff[2]));
+        m_dst = _mm_add_ps(m_dst, _mm_mul_ps(_mm_loadu_ps(rows[3] + i), m_coeff[3]));
+        _mm_storeu_ps(dst + i, m_dst);
+    }
+    for (; i < n; ++i) {
+        dst[i] = rows[0][i] * y_coeff[0] + rows[1][i] * y_coeff[1] + rows[2][i] * y_coeff[2] + rows[3][i] * y_coeff[3];
+    }
+}
+
+template <typename T>
+static void resize_cubic_kernel(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t channels,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData)
+{
+    typedef typename resize_cubic_traits<T>::coeff_t coeff_t;
+    typedef typename resize_cubic_traits<T>::row_t row_t;
+
+    int32_t cn_width = channels * outWidth;
+    uint64_t size_for_x_sx = (outWidth * sizeof(int32_t) + 128 - 1) / 128 * 128;
+    uint64_t size_for_x_ofs = (cn_width * sizeof(int32_t) + 128 - 1) / 128 * 128;
+    uint64_t size_for_x_coeff = (cn_width * sizeof(coeff_t) * 4 + 128 - 1) / 128 * 128;
+    uint64_t size_for_y_sy = (outHeight * sizeof(int32_t) + 128 - 1) / 128 * 128;
+    uint64_t size_for_y_coeff = (outHeight * sizeof(coeff_t) * 4 + 128 - 1) / 128 * 128;
+    uint64_t size_for_row = (cn_width * sizeof(row_t) + 128 - 1) / 128 * 128;
+
+    uint64_t total_size = size_for_x_sx + size_for_x_ofs + size_for_x_coeff + size_for_y_sy + size_for_y_coeff + size_for_row * 4;
+
+    void *temp_buffer = tinycv::ScratchAlloc(total_size, 128);
+    int32_t *x_sx = (int32_t *)temp_buffer;
+    int32_t *x_ofs = (int32_t *)((unsigned char *)x_sx + size_for_x_sx);
+    coeff_t *x_coeff = (coeff_t *)((unsigned char *)x_ofs + size_for_x_ofs);
+    int32_t *y_sy = (int32_t *)((unsigned char *)x_coeff + size_for_x_coeff);
+    coeff_t *y_coeff = (coeff_t *)((unsigned char *)y_sy + size_for_y_sy);
+    row_t *row_buffer[4];
+    row_buffer[0] = (row_t *)((unsigned char *)y_coeff + size_for_y_coeff);
+    for (int32_t k = 1; k < 4; ++k) {
+        row_buffer[k] = (row_t *)((unsigned char *)row_buffer[k - 1] + size_for_row);
+    }
+
+    // x offsets and coefficients are expanded per element for the vector loads
+    int32_t x_inner = resize_cubic_calc_offset<T>(inWidth, outWidth, channels, x_sx, x_coeff);
+    resize_cubic_calc_offset<T>(inHeight, outHeight, 1, y_sy, y_coeff);
+    for (int32_t w = 0; w < outWidth; ++w) {
+        for (int32_t c = 0; c < channels; ++c) {
+            x_ofs[w * channels + c] = x_sx[w] * channels + c;
+        }
+    }
+
+    // a rolling set of 4 horizontally resized rows, each tagged with its source row
+    int32_t buffer_h[4] = {-1, -1, -1, -1};
+    for (int32_t h = 0; h < outHeight; ++h) {
+        const row_t *rows[4];
+        bool used[4] = {false, false, false, false};
+        int32_t src_h[4];
+        for (int32_t k = 0; k < 4; ++k) {
+            src_h[k] = std::min(std::max(y_sy[h] + k - 1, 0), inHeight - 1);
+            rows[k] = nullptr;
+            for (int32_t j = 0; j < 4; ++j) {
+                if (buffer_h[j] == src_h[k]) {
+                    rows[k] = row_buffer[j];
+                    used[j] = true;
+                    break;
+                }
+            }
+        }
+        for (int32_t k = 0; k < 4; ++k) {
+            if (rows[k] != nullptr) {
+                continue;
+            }
+            int32_t j = 0;
+            while (used[j]) {
+                ++j;
+            }
+            const T *src = inData + src_h[k] * inWidthStride;
+            row_t *row = row_buffer[j];
+            int32_t begin = x_inner * channels;
+            int32_t end = resize_cubic_w_simd(src, inWidth, channels, x_ofs, x_coeff, cn_width, begin, row);
+            resize_cubic_w_oneline(src, inWidth, channels, x_sx, x_coeff, cn_width, 0, begin, row);
+            resize_cubic_w_oneline(src, inWidth, channels, x_sx, x_coeff, cn_width, end, cn_width, row);
+            buffer_h[j] = src_h[k];
+            used[j] = true;
+            // later taps of this output row may read the same source row
+            for (int32_t m = k; m < 4; ++m) {
+                if (src_h[m] == src_h[k]) {
+                    rows[m] = row;
+                }
+            }
+        }
+        coeff_t h_coeff[4] = {y_coeff[h], y_coeff[outHeight + h], y_coeff[2 * outHeight + h], y_coeff[3 * outHeight + h]};
+        resize_cubic_h(rows, h_coeff, cn_width, outData + h * outWidthStride);
+    }
+    tinycv::ScratchFree(temp_buffer);
+}
+
+template <>
+void ResizeCubic<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    resize_cubic_kernel(inHeight, inWidth, inWidthStride, inData, 1, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeCubic<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    resize_cubic_kernel(inHeight, inWidth, inWidthStride, inData, 3, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeCubic<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    resize_cubic_kernel(inHeight, inWidth, inWidthStride, inData, 4, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeCubic<float, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    resize_cubic_kernel(inHeight, inWidth, inWidthStride, inData, 1, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeCubic<float, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    resize_cubic_kernel(inHeight, inWidth, inWidthStride, inData, 3, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeCubic<float, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    resize_cubic_kernel(inHeight, inWidth, inWidthStride, inData, 4, outHeight, outWidth, outWidthStride, outData);
+}
+
+} // namespace tinycv
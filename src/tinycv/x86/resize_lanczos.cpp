@@ -0,0 +1,255 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/resize.h"
+#include "tinycv/types.h"
+#include "tinycv/sys.h"
+#include "tinycv/resize_filter.hpp"
+#include "tinycv/x86/sysinfo.h"
+#include "tinycv/x86/fma/internal_fma.hpp"
+
+#include <string.h>
+#include <math.h>
+#include <immintrin.h>
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+
+namespace tinycv {
+
+// source rows are widened to fp32 once, the copy also gives the taps 8 readable elements of padding
+static inline void resize_lanczos_load_row(const uint8_t *src, int32_t n, float *dst)
+{
+    int32_t i = 0;
+    for (; i <= n - 8; i += 8) {
+        __m128i v = _mm_loadl_epi64((const __m128i *)(src + i));
+        _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_cvtepu8_epi32(v)));
+        _mm_storeu_ps(dst + i + 4, _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(v, 4))));
+    }
+    for (; i < n; ++i) {
+        dst[i] = src[i];
+    }
+    memset(dst + n, 0, 8 * sizeof(float));
+}
+
+static inline void resize_lanczos_load_row(const float *src, int32_t n, float *dst)
+{
+    memcpy(dst, src, n * sizeof(float));
+    memset(dst + n, 0, 8 * sizeof(float));
+}
+
+static void resize_lanczos_w(
+    const float *src,
+    int32_t channels,
+    const int32_t *start,
+    const float *weights,
+    int32_t ksize,
+    int32_t ksize_pad,
+    int32_t out_width,
+    float *row)
+{
+    if (channels == 1) {
+        for (int32_t i = 0; i < out_width; ++i) {
+            const float *s = src + start[i];
+            const float *w = weights + i * ksize_pad;
+            __m128 acc     = _mm_setzero_ps();
+            for (int32_t k = 0; k < ksize_pad; k += 4) {
+                acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(s + k), _mm_loadu_ps(w + k)));
+            }
+            acc    = _mm_hadd_ps(acc, acc);
+            acc    = _mm_hadd_ps(acc, acc);
+            row[i] = _mm_cvtss_f32(acc);
+        }
+        return;
+    }
+    for (int32_t i = 0; i < out_width; ++i) {
+        const float *s = src + start[i] * channels;
+        const float *w = weights + i * ksize_pad;
+        __m128 acc     = _mm_setzero_ps();
+        for (int32_t k = 0; k < ksize; ++k) {
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(s + k * channels), _mm_set1_ps(w[k])));
+        }
+        _mm_storeu_ps(row + i * channels, acc);
+    }
+}
+
+static inline void resize_lanczos_load(const float *src, __m128 &v0, __m128 &v1)
+{
+    v0 = _mm_loadu_ps(src);
+    v1 = _mm_loadu_ps(src + 4);
+}
+
+static inline void resize_lanczos_load(const uint8_t *src, __m128 &v0, __m128 &v1)
+{
+    __m128i v = _mm_loadl_epi64((const __m128i *)src);
+    v0        = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(v));
+    v1        = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(v, 4)));
+}
+
+static inline void resize_lanczos_store(__m128 v0, __m128 v1, float *dst)
+{
+    _mm_storeu_ps(dst, v0);
+    _mm_storeu_ps(dst + 4, v1);
+}
+
+static inline void resize_lanczos_store(__m128 v0, __m128 v1, uint8_t *dst)
+{
+    __m128i p16 = _mm_packs_epi32(_mm_cvtps_epi32(v0), _mm_cvtps_epi32(v1));
+    _mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(p16, p16));
+}
+
+static inline void resize_lanczos_store(float v, float *dst)
+{
+    *dst = v;
+}
+
+static inline void resize_lanczos_store(float v, uint8_t *dst)
+{
+    *dst = (uint8_t)std::min(std::max((int32_t)lrintf(v), 0), 255);
+}
+
+// height pass over whole rows, every output element is independent
+template <typename TSrc, typename TDst>
+static void resize_lanczos_h(
+    const TSrc *const *rows,
+    const float *coeff,
+    int32_t ksize,
+    int32_t n,
+    TDst *dst)
+{
+    int32_t i = 0;
+    if (CpuSupports(ISA_X86_FMA)) {
+        i = fma::resize_lanczos_h_fma(rows, coeff, ksize, n, dst);
+    }
+    for (; i <= n - 8; i += 8) {
+        __m128 a0 = _mm_setzero_ps();
+        __m128 a1 = _mm_setzero_ps();
+        for (int32_t k = 0; k < ksize; ++k) {
+            __m128 w = _mm_set1_ps(coeff[k]);
+            __m128 v0, v1;
+            resize_lanczos_load(rows[k] + i, v0, v1);
+            a0 = _mm_add_ps(a0, _mm_mul_ps(v0, w));
+            a1 = _mm_add_ps(a1, _mm_mul_ps(v1, w));
+        }
+        resize_lanczos_store(a0, a1, dst + i);
+    }
+    for (; i < n; ++i) {
+        float acc = 0.f;
+        for (int32_t k = 0; k < ksize; ++k) {
+            acc += rows[k][i] * coeff[k];
+        }
+        resize_lanczos_store(acc, dst + i);
+    }
+}
+
+template <typename T>
+static void resize_lanczos_kernel(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t channels,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t window)
+{
+    std::shared_ptr<const ResizeFilterTable> xtab = GetLanczosFilterTable(inWidth, outWidth, window);
+    std::shared_ptr<const ResizeFilterTable> ytab = GetLanczosFilterTable(inHeight, outHeight, window);
+    const bool use_fma = CpuSupports(ISA_X86_FMA);
+    void (*resize_w)(const float *, int32_t, const int32_t *, const float *, int32_t, int32_t, int32_t, float *) =
+        use_fma ? fma::resize_lanczos_w_fma : resize_lanczos_w;
+
+    int32_t in_len   = inWidth * channels;
+    int32_t out_len  = outWidth * channels;
+    int32_t ksize    = ytab->ksize;
+    uint64_t src_len = (in_len + 8 + 31) & ~31;
+    uint64_t row_len = (out_len + 8 + 31) & ~31;
+    const float one = 1.f;
+
+    if (outHeight < inHeight) {
+        // shrinking: filter the source rows vertically first so the width pass runs on output rows only
+        float *line = (float *)tinycv::ScratchAlloc((src_len + row_len) * sizeof(float), 128);
+        float *row  = line + src_len;
+        const T **src_rows = (const T **)tinycv::ScratchAlloc(ksize * sizeof(const T *), 64);
+        memset(line + in_len, 0, 8 * sizeof(float));
+        for (int32_t h = 0; h < outHeight; ++h) {
+            int32_t sy = ytab->start[h];
+            for (int32_t k = 0; k < ksize; ++k) {
+                src_rows[k] = inData + (sy + k) * inWidthStride;
+            }
+            resize_lanczos_h(src_rows, ytab->weights.data() + h * ytab->ksize_pad, ksize, in_len, line);
+            resize_w(line, channels, xtab->start.data(), xtab->weights.data(), xtab->ksize, xtab->ksize_pad, outWidth, row);
+            resize_lanczos_h(&row, &one, 1, out_len, outData + h * outWidthStride);
+        }
+        tinycv::ScratchFree(src_rows);
+        tinycv::ScratchFree(line);
+        return;
+    }
+
+    float *src_row    = (float *)tinycv::ScratchAlloc((src_len + row_len * ksize) * sizeof(float), 128);
+    float *row_buffer = src_row + src_len;
+    const float **rows = (const float **)tinycv::ScratchAlloc(ksize * sizeof(const float *), 64);
+
+    // horizontally filtered rows live in a ring indexed by source row, windows only move forward
+    int32_t next_row = 0;
+    for (int32_t h = 0; h < outHeight; ++h) {
+        int32_t sy = ytab->start[h];
+        for (int32_t r = std::max(next_row, sy); r < sy + ksize; ++r) {
+            resize_lanczos_load_row(inData + r * inWidthStride, in_len, src_row);
+            resize_w(src_row, channels, xtab->start.data(), xtab->weights.data(), xtab->ksize, xtab->ksize_pad, outWidth, row_buffer + (r % ksize) * row_len);
+        }
+        next_row = std::max(next_row, sy + ksize);
+        for (int32_t k = 0; k < ksize; ++k) {
+            rows[k] = row_buffer + ((sy + k) % ksize) * row_len;
+        }
+        resize_lanczos_h(rows, ytab->weights.data() + h * ytab->ksize_pad, ksize, out_len, outData + h * outWidthStride);
+    }
+    tinycv::ScratchFree(rows);
+    tinycv::ScratchFree(src_row);
+}
+
+template <typename T, int32_t channels>
+void ResizeLanczos(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t window)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || outHeight <= 0 || outWidth <= 0 || window <= 0) {
+        return;
+    }
+    resize_lanczos_kernel(inHeight, inWidth, inWidthStride, inData, channels, outHeight, outWidth, outWidthStride, outData, window);
+}
+
+template void ResizeLanczos<uint8_t, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t window);
+template void ResizeLanczos<uint8_t, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t window);
+template void ResizeLanczos<uint8_t, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const uint8_t *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, uint8_t *outData, int32_t window);
+template void ResizeLanczos<float, 1>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t window);
+template void ResizeLanczos<float, 3>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t window);
+template void ResizeLanczos<float, 4>(int32_t inHeight, int32_t inWidth, int32_t inWidthStride, const float *inData, int32_t outHeight, int32_t outWidth, int32_t outWidthStride, float *outData, int32_t window);
+
+} // namespace tinycv
@@ -16,6 +16,7 @@
 // under the License.
 
 #include "tinycv/resize.h"
+#include "tinycv/stream.h"
 #include "tinycv/types.h"
 #include "tinycv/sys.h"
 #include "tinycv/x86/sysinfo.h"
@@ -27,6 +28,7 @@
 #include <float.h>
 #include <stdint.h>
 #include <math.h>
+#include <type_traits>
 
 namespace tinycv {
 
@@ -41,16 +43,20 @@ static void resize_linear_calc_offset_fp32(
     int32_t channels,
     int32_t outHeight,
     int32_t outWidth,
+    double scale_h,
+    double scale_w,
+    double origin_h,
+    double origin_w,
+    int32_t out_y,
+    int32_t out_x,
     int32_t &w_max,
     int32_t *h_offset,
     int32_t *w_offset,
     float *h_coeff,
     float *w_coeff)
 {
-    double inv_scale_h = (double)outHeight / inHeight;
-    double scale_h = 1.0 / inv_scale_h;
     for (int32_t h = 0; h < outHeight; ++h) {
-        float float_h = (h + 0.5) * scale_h - 0.5;
+        float float_h = (out_y + h + 0.5) * scale_h - 0.5 + origin_h;
         int32_t int_h = resize_img_floor(float_h);
         float_h -= int_h;
 
@@ -67,12 +73,9 @@ static void resize_linear_calc_offset_fp32(
         h_coeff[h] = 1.0f - float_h;
     }
 
-    double inv_scale_w = (double)outWidth / inWidth;
-    double scale_w = 1.0 / inv_scale_w;
-
     w_max = 0;
     for (int32_t w = 0; w < outWidth; ++w) {
-        float float_w = (w + 0.5) * scale_w - 0.5;
+        float float_w = (out_x + w + 0.5) * scale_w - 0.5 + origin_w;
         int32_t int_w = resize_img_floor(float_w);
         float_w -= int_w;
 
@@ -108,11 +111,12 @@ static void resize_linear_twoline_fp32(
     float h_coeff,
     float *row_0,
     float *row_1,
-    float *outData)
+    float *outData,
+    isa_t isa)
 {
     int32_t i = 0;
 
-    if (CpuSupports(ISA_X86_FMA)) {
+    if (isa & ISA_X86_FMA) {
         i = fma::resize_linear_twoline_fp32_fma(w_max * channels, channels, inData_0, inData_1, w_offset, w_coeff, h_coeff, row_0, row_1, outData);
     }
 
@@ -212,7 +216,8 @@ static void resize_linear_w_oneline_fp32(
     int32_t w_max,
     const int32_t *w_offset,
     const float *w_coeff,
-    float *row)
+    float *row,
+    isa_t isa)
 {
     __m128 m_one = _mm_set1_ps(1.0f);
     int32_t i = 0;
@@ -267,7 +272,8 @@ static void resize_linear_h_fp32(
     const float *row_1,
     int32_t h_idx,
     float h_coeff,
-    float *outData)
+    float *outData,
+    isa_t isa)
 {
     int32_t i = 0;
 
@@ -285,18 +291,306 @@ static void resize_linear_h_fp32(
     }
 }
 
+static void resize_linear_w_oneline_fp32(
+    int32_t inWidth,
+    int32_t outWidth,
+    int32_t channels,
+    const half_t *inData,
+    int32_t w_max,
+    const int32_t *w_offset,
+    const float *w_coeff,
+    float *row,
+    isa_t isa)
+{
+    int32_t i = 0;
+    if ((isa & ISA_X86_FMA) && (isa & ISA_X86_F16C)) {
+        i = fma::resize_linear_w_oneline_fp16_fma(w_max * channels, channels, inData, w_offset, w_coeff, row);
+    }
+    for (; i < outWidth * channels; ++i) {
+        int32_t w_idx_0 = w_offset[i];
+        int32_t w_idx_1 = w_idx_0 >= (inWidth - 1) * channels ? w_idx_0 : w_idx_0 + channels;
+        float coeff = w_coeff[i];
+        row[i] = float(inData[w_idx_0]) * coeff + float(inData[w_idx_1]) * (1.0f - coeff);
+    }
+}
+
+static void resize_linear_h_fp32(
+    int32_t outWidth,
+    int32_t channels,
+    const float *row_0,
+    const float *row_1,
+    int32_t h_idx,
+    float h_coeff,
+    half_t *outData,
+    isa_t isa)
+{
+    int32_t i = 0;
+    if ((isa & ISA_X86_FMA) && (isa & ISA_X86_F16C)) {
+        i = fma::resize_linear_h_fp16_fma(outWidth * channels, row_0, row_1, h_coeff, outData);
+    }
+    for (; i < outWidth * channels; ++i) {
+        outData[i] = half_t(row_0[i] * h_coeff + row_1[i] * (1.0f - h_coeff));
+    }
+}
+
+static void resize_linear_twoline_fp32(
+    int32_t inWidth,
+    int32_t outWidth,
+    int32_t channels,
+    const half_t *inData_0,
+    const half_t *inData_1,
+    int32_t w_max,
+    const int32_t *w_offset,
+    const float *w_coeff,
+    int32_t h_idx,
+    float h_coeff,
+    float *row_0,
+    float *row_1,
+    half_t *outData,
+    isa_t isa)
+{
+    resize_linear_w_oneline_fp32(inWidth, outWidth, channels, inData_0, w_max, w_offset, w_coeff, row_0, isa);
+    resize_linear_w_oneline_fp32(inWidth, outWidth, channels, inData_1, w_max, w_offset, w_coeff, row_1, isa);
+    resize_linear_h_fp32(outWidth, channels, row_0, row_1, h_idx, h_coeff, outData, isa);
+}
+
+template <typename T>
+struct resize_linear_16bit_ops;
+
+template <>
+struct resize_linear_16bit_ops<uint16_t> {
+    static inline __m128 load4(const uint16_t *data)
+    {
+        return _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)data)));
+    }
+    static inline __m128i pack(__m128i lo, __m128i hi)
+    {
+        return _mm_packus_epi32(lo, hi);
+    }
+    static inline uint16_t saturate(float value)
+    {
+        int32_t v = (int32_t)lrintf(value);
+        return (uint16_t)(v < 0 ? 0 : (v > USHRT_MAX ? USHRT_MAX : v));
+    }
+};
+
+template <>
+struct resize_linear_16bit_ops<int16_t> {
+    static inline __m128 load4(const int16_t *data)
+    {
+        return _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)data)));
+    }
+    static inline __m128i pack(__m128i lo, __m128i hi)
+    {
+        return _mm_packs_epi32(lo, hi);
+    }
+    static inline int16_t saturate(float value)
+    {
+        int32_t v = (int32_t)lrintf(value);
+        return (int16_t)(v < SHRT_MIN ? SHRT_MIN : (v > SHRT_MAX ? SHRT_MAX : v));
+    }
+};
+
+// 16-bit rows are widened to fp32 while being interpolated horizontally, so the source is never copied as float
+template <typename T>
+static void resize_linear_w_oneline_16bit(
+    int32_t inWidth,
+    int32_t outWidth,
+    int32_t channels,
+    const T *inData,
+    int32_t w_max,
+    const int32_t *w_offset,
+    const float *w_coeff,
+    float *row)
+{
+    typedef resize_linear_16bit_ops<T> ops;
+    __m128 m_one = _mm_set1_ps(1.0f);
+    int32_t i = 0;
+
+    if (channels == 4) {
+        for (; i < w_max * channels; i += 4) {
+            __m128 m_data_0 = ops::load4(inData + w_offset[i]);
+            __m128 m_data_1 = ops::load4(inData + w_offset[i] + 4);
+
+            __m128 m_w_coeff_0 = _mm_load_ps(w_coeff + i);
+            __m128 m_w_coeff_1 = _mm_sub_ps(m_one, m_w_coeff_0);
+            __m128 m_rst_row = _mm_add_ps(_mm_mul_ps(m_data_0, m_w_coeff_0), _mm_mul_ps(m_data_1, m_w_coeff_1));
+
+            _mm_store_ps(row + i, m_rst_row);
+        }
+    }
+
+    for (; i < w_max * channels - 4; i += 4) {
+        __m128 m_data_0 = _mm_set_ps(inData[w_offset[i + 3]],
+                                     inData[w_offset[i + 2]],
+                                     inData[w_offset[i + 1]],
+                                     inData[w_offset[i + 0]]);
+        __m128 m_data_1 = _mm_set_ps(inData[w_offset[i + 3] + channels],
+                                     inData[w_offset[i + 2] + channels],
+                                     inData[w_offset[i + 1] + channels],
+                                     inData[w_offset[i + 0] + channels]);
+
+        __m128 m_w_coeff_0 = _mm_load_ps(w_coeff + i);
+        __m128 m_w_coeff_1 = _mm_sub_ps(m_one, m_w_coeff_0);
+        __m128 m_rst_row = _mm_add_ps(_mm_mul_ps(m_data_0, m_w_coeff_0), _mm_mul_ps(m_data_1, m_w_coeff_1));
+
+        _mm_store_ps(row + i, m_rst_row);
+    }
+
+    for (; i < outWidth * channels; ++i) {
+        int32_t w_idx_0 = w_offset[i];
+        int32_t w_idx_1 = w_idx_0 >= (inWidth - 1) * channels ? w_idx_0 : w_idx_0 + channels;
+        float coeff = w_coeff[i];
+        row[i] = inData[w_idx_0] * coeff + inData[w_idx_1] * (1.0f - coeff);
+    }
+}
+
+template <typename T>
+static void resize_linear_h_16bit(
+    int32_t outWidth,
+    int32_t channels,
+    const float *row_0,
+    const float *row_1,
+    float h_coeff,
+    T *outData)
+{
+    typedef resize_linear_16bit_ops<T> ops;
+    int32_t i = 0;
+
+    __m128 m_h_coeff_0 = _mm_set1_ps(h_coeff);
+    __m128 m_h_coeff_1 = _mm_set1_ps(1.0f - h_coeff);
+    for (; i <= outWidth * channels - 8; i += 8) {
+        __m128 m_rst_0 = _mm_add_ps(_mm_mul_ps(_mm_load_ps(row_0 + i), m_h_coeff_0),
+                                    _mm_mul_ps(_mm_load_ps(row_1 + i), m_h_coeff_1));
+        __m128 m_rst_1 = _mm_add_ps(_mm_mul_ps(_mm_load_ps(row_0 + i + 4), m_h_coeff_0),
+                                    _mm_mul_ps(_mm_load_ps(row_1 + i + 4), m_h_coeff_1));
+        __m128i m_rst = ops::pack(_mm_cvtps_epi32(m_rst_0), _mm_cvtps_epi32(m_rst_1));
+        _mm_storeu_si128((__m128i *)(outData + i), m_rst);
+    }
+    for (; i < outWidth * channels; ++i) {
+        outData[i] = ops::saturate(row_0[i] * h_coeff + row_1[i] * (1.0f - h_coeff));
+    }
+}
+
+static void resize_linear_w_oneline_fp32(
+    int32_t inWidth,
+    int32_t outWidth,
+    int32_t channels,
+    const uint16_t *inData,
+    int32_t w_max,
+    const int32_t *w_offset,
+    const float *w_coeff,
+    float *row,
+    isa_t isa)
+{
+    resize_linear_w_oneline_16bit(inWidth, outWidth, channels, inData, w_max, w_offset, w_coeff, row);
+}
+
+static void resize_linear_h_fp32(
+    int32_t outWidth,
+    int32_t channels,
+    const float *row_0,
+    const float *row_1,
+    int32_t h_idx,
+    float h_coeff,
+    uint16_t *outData,
+    isa_t isa)
+{
+    resize_linear_h_16bit(outWidth, channels, row_0, row_1, h_coeff, outData);
+}
+
+static void resize_linear_twoline_fp32(
+    int32_t inWidth,
+    int32_t outWidth,
+    int32_t channels,
+    const uint16_t *inData_0,
+    const uint16_t *inData_1,
+    int32_t w_max,
+    const int32_t *w_offset,
+    const float *w_coeff,
+    int32_t h_idx,
+    float h_coeff,
+    float *row_0,
+    float *row_1,
+    uint16_t *outData,
+    isa_t isa)
+{
+    resize_linear_w_oneline_16bit(inWidth, outWidth, channels, inData_0, w_max, w_offset, w_coeff, row_0);
+    resize_linear_w_oneline_16bit(inWidth, outWidth, channels, inData_1, w_max, w_offset, w_coeff, row_1);
+    resize_linear_h_16bit(outWidth, channels, row_0, row_1, h_coeff, outData);
+}
+
+static void resize_linear_w_oneline_fp32(
+    int32_t inWidth,
+    int32_t outWidth,
+    int32_t channels,
+    const int16_t *inData,
+    int32_t w_max,
+    const int32_t *w_offset,
+    const float *w_coeff,
+    float *row,
+    isa_t isa)
+{
+    resize_linear_w_oneline_16bit(inWidth, outWidth, channels, inData, w_max, w_offset, w_coeff, row);
+}
+
+static void resize_linear_h_fp32(
+    int32_t outWidth,
+    int32_t channels,
+    const float *row_0,
+    const float *row_1,
+    int32_t h_idx,
+    float h_coeff,
+    int16_t *outData,
+    isa_t isa)
+{
+    resize_linear_h_16bit(outWidth, channels, row_0, row_1, h_coeff, outData);
+}
+
+static void resize_linear_twoline_fp32(
+    int32_t inWidth,
+    int32_t outWidth,
+    int32_t channels,
+    const int16_t *inData_0,
+    const int16_t *inData_1,
+    int32_t w_max,
+    const int32_t *w_offset,
+    const float *w_coeff,
+    int32_t h_idx,
+    float h_coeff,
+    float *row_0,
+    float *row_1,
+    int16_t *outData,
+    isa_t isa)
+{
+    resize_linear_w_oneline_16bit(inWidth, outWidth, channels, inData_0, w_max, w_offset, w_coeff, row_0);
+    resize_linear_w_oneline_16bit(inWidth, outWidth, channels, inData_1, w_max, w_offset, w_coeff, row_1);
+    resize_linear_h_16bit(outWidth, channels, row_0, row_1, h_coeff, outData);
+}
+
+// rows are always buffered as fp32, T only decides how the source is loaded and the result is stored
+template <typename T>
 static void resize_linear_kernel_fp32(
     int32_t inHeight,
     int32_t inWidth,
     int32_t inWidthStride,
-    const float *inData,
+    const T *inData,
     int32_t channels,
     int32_t outHeight,
     int32_t outWidth,
     int32_t outWidthStride,
-    float *outData)
+    T *outData,
+    double scale_h,
+    double scale_w,
+    double origin_h,
+    double origin_w,
+    int32_t out_y,
+    int32_t out_x,
+    bool use_fma,
+    StreamContext *context)
 {
     int32_t cn_width = channels * outWidth;
+    uint64_t size_for_w_max = 128;
     uint64_t size_for_h_offset = (outHeight * sizeof(int32_t) + 128 - 1) / 128 * 128;
     uint64_t size_for_w_offset = (cn_width * sizeof(int32_t) + 128 - 1) / 128 * 128;
     uint64_t size_for_h_coeff = (outHeight * sizeof(float) + 128 - 1) / 128 * 128;
@@ -304,19 +598,36 @@ static void resize_linear_kernel_fp32(
     uint64_t size_for_row_0 = (cn_width * sizeof(float) + 128 - 1) / 128 * 128;
     uint64_t size_for_row_1 = (cn_width * sizeof(float) + 128 - 1) / 128 * 128;
 
-    uint64_t total_size = size_for_h_offset + size_for_w_offset + size_for_h_coeff + size_for_w_coeff + size_for_row_0 + size_for_row_1;
-
-    void *temp_buffer = tinycv::AlignedAlloc(total_size, 128);
+    uint64_t total_size = size_for_w_max + size_for_h_offset + size_for_w_offset + size_for_h_coeff + size_for_w_coeff + size_for_row_0 + size_for_row_1;
+
+    void *temp_buffer = nullptr;
+    bool tables_ready = false;
+    if (context) {
+        // only ResizeLinear passes a context, its mapping follows from the sizes, and the tables do not
+        // depend on T since every type is buffered as fp32
+        const int32_t key[] = {inHeight, inWidth, channels, outHeight, outWidth};
+        temp_buffer = context->Tables("resize_linear_fp32", key, 5, total_size, &tables_ready);
+    } else {
+        temp_buffer = tinycv::ScratchAlloc(total_size, 128);
+    }
+    if (nullptr == temp_buffer) {
+        return;
+    }
 
-    int32_t *h_offset = (int32_t *)temp_buffer;
+    int32_t *w_max_ptr = (int32_t *)temp_buffer;
+    int32_t *h_offset = (int32_t *)((unsigned char *)w_max_ptr + size_for_w_max);
     int32_t *w_offset = (int32_t *)((unsigned char *)h_offset + size_for_h_offset);
     float *h_coeff = (float *)((unsigned char *)w_offset + size_for_w_offset);
     float *w_coeff = (float *)((unsigned char *)h_coeff + size_for_h_coeff);
     float *row_0 = (float *)((unsigned char *)w_coeff + size_for_w_coeff);
     float *row_1 = (float *)((unsigned char *)row_0 + size_for_row_0);
 
-    int32_t w_max = 0;
-    resize_linear_calc_offset_fp32(inHeight, inWidth, channels, outHeight, outWidth, w_max, h_offset, w_offset, h_coeff, w_coeff);
+    if (!tables_ready) {
+        resize_linear_calc_offset_fp32(inHeight, inWidth, channels, outHeight, outWidth, scale_h, scale_w, origin_h, origin_w, out_y, out_x, *w_max_ptr, h_offset, w_offset, h_coeff, w_coeff);
+    }
+    int32_t w_max = *w_max_ptr;
+    // read once per call, a context has it cached and the row helpers only test its bits
+    isa_t isa = !use_fma ? ISA_UNKNOWN : context ? context->Isa() : GetCpuISA();
 
     int32_t prev_h[2] = {-1, -1};
     float *prev_ptr[2] = {nullptr, nullptr};
@@ -357,7 +668,7 @@ static void resize_linear_kernel_fp32(
             row_ptr[0] = row_0;
             row_ptr[1] = row_1;
 
-            resize_linear_twoline_fp32(inWidth, outWidth, channels, inData + src_h_idx_0 * inWidthStride, inData + src_h_idx_1 * inWidthStride, w_max, w_offset, w_coeff, h_offset[h], h_coeff[h], row_ptr[0], row_ptr[1], outData + h * outWidthStride);
+            resize_linear_twoline_fp32(inWidth, outWidth, channels, inData + src_h_idx_0 * inWidthStride, inData + src_h_idx_1 * inWidthStride, w_max, w_offset, w_coeff, h_offset[h], h_coeff[h], row_ptr[0], row_ptr[1], outData + h * outWidthStride, isa);
         } else {
             if (reuse_count == 1) {
                 if (row_ptr[0] == row_0) {
@@ -365,9 +676,9 @@ static void resize_linear_kernel_fp32(
                 } else {
                     row_ptr[1] = row_0;
                 }
-                resize_linear_w_oneline_fp32(inWidth, outWidth, channels, inData + src_h_idx_1 * inWidthStride, w_max, w_offset, w_coeff, row_ptr[1]);
+                resize_linear_w_oneline_fp32(inWidth, outWidth, channels, inData + src_h_idx_1 * inWidthStride, w_max, w_offset, w_coeff, row_ptr[1], isa);
             }
-            resize_linear_h_fp32(outWidth, channels, row_ptr[0], row_ptr[1], h_offset[h], h_coeff[h], outData + h * outWidthStride);
+            resize_linear_h_fp32(outWidth, channels, row_ptr[0], row_ptr[1], h_offset[h], h_coeff[h], outData + h * outWidthStride, isa);
         }
 
         prev_h[0] = src_h_idx_0;
@@ -375,7 +686,9 @@ static void resize_linear_kernel_fp32(
         prev_ptr[0] = row_ptr[0];
         prev_ptr[1] = row_ptr[1];
     }
-    tinycv::AlignedFree(temp_buffer);
+    if (!context) {
+        tinycv::ScratchFree(temp_buffer);
+    }
 }
 
 static void resize_linear_shrink2_c1_kernel_fp32(
@@ -481,6 +794,96 @@ static void resize_linear_shrink2_c4_kernel_fp32(
     }
 }
 
+// At exactly 1/4 the bilinear sample points fall halfway between source pixels 4x+1 and 4x+2,
+// so every output is the mean of a 2x2 block at offset (1, 1).
+static void resize_linear_shrink4_c1_kernel_fp32(
+    const float *inData,
+    int32_t inWidthStride,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData)
+{
+    __m128 m_p25 = _mm_set1_ps(0.25f);
+    const int32_t middle_pair = _MM_SHUFFLE(2, 1, 2, 1);
+
+    for (int32_t i = 0; i < outHeight; ++i) {
+        const float *row_0 = inData + (i * 4 + 1) * inWidthStride;
+        const float *row_1 = inData + (i * 4 + 2) * inWidthStride;
+        int32_t j = 0;
+        for (; j <= outWidth - 4; j += 4) {
+            __m128 m_row_0 = _mm_hadd_ps(
+                _mm_shuffle_ps(_mm_loadu_ps(row_0 + j * 4 + 0), _mm_loadu_ps(row_0 + j * 4 + 4), middle_pair),
+                _mm_shuffle_ps(_mm_loadu_ps(row_0 + j * 4 + 8), _mm_loadu_ps(row_0 + j * 4 + 12), middle_pair));
+            __m128 m_row_1 = _mm_hadd_ps(
+                _mm_shuffle_ps(_mm_loadu_ps(row_1 + j * 4 + 0), _mm_loadu_ps(row_1 + j * 4 + 4), middle_pair),
+                _mm_shuffle_ps(_mm_loadu_ps(row_1 + j * 4 + 8), _mm_loadu_ps(row_1 + j * 4 + 12), middle_pair));
+            _mm_storeu_ps(outData + i * outWidthStride + j, _mm_mul_ps(_mm_add_ps(m_row_0, m_row_1), m_p25));
+        }
+        for (; j < outWidth; ++j) {
+            float rst = (row_0[j * 4 + 1] + row_0[j * 4 + 2]) + (row_1[j * 4 + 1] + row_1[j * 4 + 2]);
+            outData[i * outWidthStride + j] = rst * 0.25f;
+        }
+    }
+}
+
+static void resize_linear_shrink4_c3_kernel_fp32(
+    const float *inData,
+    int32_t inWidthStride,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData)
+{
+    __m128 m_p25 = _mm_set1_ps(0.25f);
+
+    for (int32_t i = 0; i < outHeight; ++i) {
+        const float *row_0 = inData + (i * 4 + 1) * inWidthStride + 3;
+        const float *row_1 = inData + (i * 4 + 2) * inWidthStride + 3;
+        int32_t j = 0;
+        // the fourth lane spills into the next output pixel and is overwritten by it
+        for (; j < outWidth - 1; ++j) {
+            __m128 m_data_0 = _mm_loadu_ps(row_0 + j * 3 * 4 + 0);
+            __m128 m_data_1 = _mm_loadu_ps(row_0 + j * 3 * 4 + 3);
+            __m128 m_data_2 = _mm_loadu_ps(row_1 + j * 3 * 4 + 0);
+            __m128 m_data_3 = _mm_loadu_ps(row_1 + j * 3 * 4 + 3);
+            __m128 m_rst = _mm_add_ps(_mm_add_ps(m_data_0, m_data_1), _mm_add_ps(m_data_2, m_data_3));
+            _mm_storeu_ps(outData + i * outWidthStride + j * 3, _mm_mul_ps(m_rst, m_p25));
+        }
+        for (; j < outWidth; ++j) {
+            for (int32_t c = 0; c < 3; ++c) {
+                float rst = (row_0[j * 3 * 4 + c] + row_0[j * 3 * 4 + 3 + c]) +
+                            (row_1[j * 3 * 4 + c] + row_1[j * 3 * 4 + 3 + c]);
+                outData[i * outWidthStride + j * 3 + c] = rst * 0.25f;
+            }
+        }
+    }
+}
+
+static void resize_linear_shrink4_c4_kernel_fp32(
+    const float *inData,
+    int32_t inWidthStride,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData)
+{
+    __m128 m_p25 = _mm_set1_ps(0.25f);
+
+    for (int32_t i = 0; i < outHeight; ++i) {
+        const float *row_0 = inData + (i * 4 + 1) * inWidthStride + 4;
+        const float *row_1 = inData + (i * 4 + 2) * inWidthStride + 4;
+        for (int32_t j = 0; j < outWidth; ++j) {
+            __m128 m_data_0 = _mm_loadu_ps(row_0 + j * 4 * 4 + 0);
+            __m128 m_data_1 = _mm_loadu_ps(row_0 + j * 4 * 4 + 4);
+            __m128 m_data_2 = _mm_loadu_ps(row_1 + j * 4 * 4 + 0);
+            __m128 m_data_3 = _mm_loadu_ps(row_1 + j * 4 * 4 + 4);
+            __m128 m_rst = _mm_add_ps(_mm_add_ps(m_data_0, m_data_1), _mm_add_ps(m_data_2, m_data_3));
+            _mm_storeu_ps(outData + i * outWidthStride + j * 4, _mm_mul_ps(m_rst, m_p25));
+        }
+    }
+}
+
 template <>
 void ResizeLinear<float, 1>(
     int32_t inHeight,
@@ -503,9 +906,14 @@ void ResizeLinear<float, 1>(
         resize_linear_shrink2_c1_kernel_fp32(inData, inWidthStride, outHeight, outWidth, outWidthStride, outData);
         return;
     }
+    if (outHeight * 4 == inHeight && outWidth * 4 == inWidth) {
+        resize_linear_shrink4_c1_kernel_fp32(inData, inWidthStride, outHeight, outWidth, outWidthStride, outData);
+        return;
+    }
 
     resize_linear_kernel_fp32(
-        inHeight, inWidth, inWidthStride, inData, 1, outHeight, outWidth, outWidthStride, outData);
+        inHeight, inWidth, inWidthStride, inData, 1, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, true, nullptr);
 }
 
 template <>
@@ -530,9 +938,14 @@ void ResizeLinear<float, 3>(
         resize_linear_shrink2_c3_kernel_fp32(inData, inWidthStride, outHeight, outWidth, outWidthStride, outData);
         return;
     }
+    if (outHeight * 4 == inHeight && outWidth * 4 == inWidth) {
+        resize_linear_shrink4_c3_kernel_fp32(inData, inWidthStride, outHeight, outWidth, outWidthStride, outData);
+        return;
+    }
 
     resize_linear_kernel_fp32(
-        inHeight, inWidth, inWidthStride, inData, 3, outHeight, outWidth, outWidthStride, outData);
+        inHeight, inWidth, inWidthStride, inData, 3, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, true, nullptr);
 }
 
 template <>
@@ -557,9 +970,717 @@ void ResizeLinear<float, 4>(
         resize_linear_shrink2_c4_kernel_fp32(inData, inWidthStride, outHeight, outWidth, outWidthStride, outData);
         return;
     }
+    if (outHeight * 4 == inHeight && outWidth * 4 == inWidth) {
+        resize_linear_shrink4_c4_kernel_fp32(inData, inWidthStride, outHeight, outWidth, outWidthStride, outData);
+        return;
+    }
 
     resize_linear_kernel_fp32(
-        inHeight, inWidth, inWidthStride, inData, 4, outHeight, outWidth, outWidthStride, outData);
+        inHeight, inWidth, inWidthStride, inData, 4, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, true, nullptr);
+}
+
+template <>
+void ResizeLinear<half_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_linear_kernel_fp32(
+        inHeight, inWidth, inWidthStride, inData, 1, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, true, nullptr);
+}
+
+template <>
+void ResizeLinear<half_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_linear_kernel_fp32(
+        inHeight, inWidth, inWidthStride, inData, 3, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, true, nullptr);
+}
+
+template <>
+void ResizeLinear<half_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_linear_kernel_fp32(
+        inHeight, inWidth, inWidthStride, inData, 4, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, true, nullptr);
+}
+
+template <>
+void ResizeLinear<uint16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_linear_kernel_fp32(
+        inHeight, inWidth, inWidthStride, inData, 1, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, true, nullptr);
+}
+
+template <>
+void ResizeLinear<uint16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_linear_kernel_fp32(
+        inHeight, inWidth, inWidthStride, inData, 3, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, true, nullptr);
+}
+
+template <>
+void ResizeLinear<uint16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_linear_kernel_fp32(
+        inHeight, inWidth, inWidthStride, inData, 4, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, true, nullptr);
+}
+
+template <>
+void ResizeLinear<int16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_linear_kernel_fp32(
+        inHeight, inWidth, inWidthStride, inData, 1, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, true, nullptr);
+}
+
+template <>
+void ResizeLinear<int16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_linear_kernel_fp32(
+        inHeight, inWidth, inWidthStride, inData, 3, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, true, nullptr);
+}
+
+template <>
+void ResizeLinear<int16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_linear_kernel_fp32(
+        inHeight, inWidth, inWidthStride, inData, 4, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, true, nullptr);
+}
+
+template <typename T, int32_t channels>
+static void resize_linear_stream_fp32(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData)
+{
+    StreamStageTimer timer(context, "ResizeLinear");
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+
+    // the exact shrinks of float images need neither tables nor buffers
+    if (std::is_same<T, float>::value &&
+        ((outHeight * 2 == inHeight && outWidth * 2 == inWidth) ||
+         (outHeight * 4 == inHeight && outWidth * 4 == inWidth))) {
+        ResizeLinear<T, channels>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+        return;
+    }
+
+    resize_linear_kernel_fp32(
+        inHeight, inWidth, inWidthStride, inData, channels, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, true, &context);
+}
+
+template <>
+void ResizeLinear<float, 1>(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData)
+{
+    resize_linear_stream_fp32<float, 1>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<float, 3>(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData)
+{
+    resize_linear_stream_fp32<float, 3>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<float, 4>(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData)
+{
+    resize_linear_stream_fp32<float, 4>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<half_t, 1>(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    resize_linear_stream_fp32<half_t, 1>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<half_t, 3>(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    resize_linear_stream_fp32<half_t, 3>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<half_t, 4>(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    resize_linear_stream_fp32<half_t, 4>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<uint16_t, 1>(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    resize_linear_stream_fp32<uint16_t, 1>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<uint16_t, 3>(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    resize_linear_stream_fp32<uint16_t, 3>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<uint16_t, 4>(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    resize_linear_stream_fp32<uint16_t, 4>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<int16_t, 1>(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    resize_linear_stream_fp32<int16_t, 1>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<int16_t, 3>(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    resize_linear_stream_fp32<int16_t, 3>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<int16_t, 4>(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    resize_linear_stream_fp32<int16_t, 4>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <typename T, int32_t channels>
+static void resize_linear_region_fp32(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    T *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || outHeight <= 0 || outWidth <= 0) {
+        return;
+    }
+    if (!(scaleY > 0.0) || !(scaleX > 0.0)) {
+        return;
+    }
+
+    // the FMA kernels only cover the full vectors of a row and fresh row pairs, the rest is rounded
+    // separately, so whether a pixel is fused would depend on the tile it falls in
+    resize_linear_kernel_fp32(
+        inHeight, inWidth, inWidthStride, inData, channels, outHeight, outWidth, outWidthStride, outData,
+        scaleY, scaleX, originY, originX, outY, outX, false, nullptr);
+}
+
+template <>
+void ResizeLinearRegion<float, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<float, 1>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<float, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<float, 3>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<float, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<float, 4>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<half_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<half_t, 1>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<half_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<half_t, 3>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<half_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<half_t, 4>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<uint16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<uint16_t, 1>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<uint16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<uint16_t, 3>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<uint16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<uint16_t, 4>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<int16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<int16_t, 1>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<int16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<int16_t, 3>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<int16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_fp32<int16_t, 4>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
 }
 
 } // namespace tinycv
@@ -16,6 +16,7 @@
 // under the License.
 
 #include "tinycv/resize.h"
+#include "tinycv/stream.h"
 #include "tinycv/types.h"
 #include "tinycv/sys.h"
 #include "tinycv/x86/sysinfo.h"
@@ -64,30 +65,38 @@ static void resize_linear_calc_offset_u8(
     int32_t channels,
     int32_t outHeight,
     int32_t outWidth,
+    double scale_h,
+    double scale_w,
+    double origin_h,
+    double origin_w,
+    int32_t out_y,
+    int32_t out_x,
     int32_t &w_max,
     int32_t *h_offset,
     int32_t *w_offset,
     int16_t *h_coeff,
     int16_t *w_coeff)
 {
-    double inv_scale_h = (double)outHeight / inHeight;
-    double scale_h = 1.0 / inv_scale_h;
-
     for (int32_t h = 0; h < outHeight; ++h) {
-        float float_h = (h + 0.5) * scale_h - 0.5;
+        float float_h = (out_y + h + 0.5) * scale_h - 0.5 + origin_h;
         int32_t int_h = resize_img_floor(float_h);
         float_h -= int_h;
 
+        // -1 still blends row 0 with itself like OpenCV, only an origin can move rows further out
+        if (int_h < -1) {
+            int_h = -1;
+        }
+        if (int_h > inHeight - 1) {
+            int_h = inHeight - 1;
+        }
+
         h_offset[h] = int_h;
         h_coeff[h] = resize_img_saturate_cast_short((1.0f - float_h) * INTER_RESIZE_COEF_SCALE);
     }
 
-    double inv_scale_w = (double)outWidth / inWidth;
-    double scale_w = 1.0 / inv_scale_w;
-
     w_max = 0;
     for (int32_t w = 0; w < outWidth; ++w) {
-        float float_w = (w + 0.5) * scale_w - 0.5;
+        float float_w = (out_x + w + 0.5) * scale_w - 0.5 + origin_w;
         int32_t int_w = resize_img_floor(float_w);
         float_w -= int_w;
 
@@ -119,20 +128,21 @@ static void resize_linear_w_oneline_u8(
     int32_t w_max,
     const int32_t *w_offset,
     const int16_t *w_coeff,
-    int32_t *row)
+    int32_t *row,
+    isa_t isa)
 {
     int32_t i = 0;
 
     if (1 == channels &&
-        CpuSupports(ISA_X86_FMA)) {
+        (isa & ISA_X86_FMA)) {
         i = fma::resize_linear_w_oneline_c1_u8_fma(inWidth, inData, outWidth, w_offset, w_coeff, INTER_RESIZE_COEF_SCALE, row);
     }
     if (3 == channels &&
-        CpuSupports(ISA_X86_FMA)) {
+        (isa & ISA_X86_FMA)) {
         i = fma::resize_linear_w_oneline_c3_u8_fma(inWidth, inData, outWidth, w_offset, w_coeff, INTER_RESIZE_COEF_SCALE, row);
     }
     if (4 == channels &&
-        CpuSupports(ISA_X86_FMA)) {
+        (isa & ISA_X86_FMA)) {
         i = fma::resize_linear_w_oneline_c4_u8_fma(inWidth, inData, outWidth, w_offset, w_coeff, INTER_RESIZE_COEF_SCALE, row);
     }
 
@@ -218,9 +228,17 @@ static void resize_linear_kernel_u8(
     int32_t outHeight,
     int32_t outWidth,
     int32_t outWidthStride,
-    uint8_t *outData)
+    uint8_t *outData,
+    double scale_h,
+    double scale_w,
+    double origin_h,
+    double origin_w,
+    int32_t out_y,
+    int32_t out_x,
+    StreamContext *context)
 {
     int32_t cn_width = channels * outWidth;
+    uint64_t size_for_w_max = 128;
     uint64_t size_for_h_offset = (outHeight * sizeof(int32_t) + 128 - 1) / 128 * 128;
     uint64_t size_for_w_offset = (cn_width * sizeof(int32_t) + 128 - 1) / 128 * 128;
     uint64_t size_for_h_coeff = (outHeight * sizeof(int16_t) * 2 + 128 - 1) / 128 * 128;
@@ -228,25 +246,43 @@ static void resize_linear_kernel_u8(
     uint64_t size_for_row_0 = (cn_width * sizeof(int32_t) + 128 - 1) / 128 * 128;
     uint64_t size_for_row_1 = (cn_width * sizeof(int32_t) + 128 - 1) / 128 * 128;
 
-    uint64_t total_size = size_for_h_offset + size_for_w_offset + size_for_h_coeff + size_for_w_coeff + size_for_row_0 + size_for_row_1;
+    uint64_t total_size = size_for_w_max + size_for_h_offset + size_for_w_offset + size_for_h_coeff + size_for_w_coeff + size_for_row_0 + size_for_row_1;
 
-    void *temp_buffer = tinycv::AlignedAlloc(total_size, 128);
-    int32_t *h_offset = (int32_t *)temp_buffer;
+    void *temp_buffer = nullptr;
+    bool tables_ready = false;
+    if (context) {
+        // only ResizeLinear passes a context, its mapping follows from the sizes
+        const int32_t key[] = {inHeight, inWidth, channels, outHeight, outWidth};
+        temp_buffer = context->Tables("resize_linear_u8", key, 5, total_size, &tables_ready);
+    } else {
+        temp_buffer = tinycv::ScratchAlloc(total_size, 128);
+    }
+    if (nullptr == temp_buffer) {
+        return;
+    }
+    int32_t *w_max_ptr = (int32_t *)temp_buffer;
+    int32_t *h_offset = (int32_t *)((unsigned char *)w_max_ptr + size_for_w_max);
     int32_t *w_offset = (int32_t *)((unsigned char *)h_offset + size_for_h_offset);
     int16_t *h_coeff = (int16_t *)((unsigned char *)w_offset + size_for_w_offset);
     int16_t *w_coeff = (int16_t *)((unsigned char *)h_coeff + size_for_h_coeff);
     int32_t *row_0 = (int32_t *)((unsigned char *)w_coeff + size_for_w_coeff);
     int32_t *row_1 = (int32_t *)((unsigned char *)row_0 + size_for_row_0);
 
-    int32_t w_max = 0;
-    resize_linear_calc_offset_u8(inHeight, inWidth, channels, outHeight, outWidth, w_max, h_offset, w_offset, h_coeff, w_coeff);
+    if (!tables_ready) {
+        resize_linear_calc_offset_u8(inHeight, inWidth, channels, outHeight, outWidth, scale_h, scale_w, origin_h, origin_w, out_y, out_x, *w_max_ptr, h_offset, w_offset, h_coeff, w_coeff);
+    }
+    int32_t w_max = *w_max_ptr;
+    isa_t isa = context ? context->Isa() : GetCpuISA();
 
     if (1 == channels &&
-        inHeight > outHeight &&
-        CpuSupports(ISA_X86_FMA)) {
+        scale_h > 1.0 &&
+        h_offset[0] >= 0 &&
+        (isa & ISA_X86_FMA)) {
         fma::resize_linear_kernel_c1_shrink_u8_fma(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, h_offset, w_offset, h_coeff, w_coeff, INTER_RESIZE_COEF_SCALE, outData);
 
-        tinycv::AlignedFree(temp_buffer);
+        if (!context) {
+            tinycv::ScratchFree(temp_buffer);
+        }
         return;
     }
 
@@ -294,8 +330,8 @@ static void resize_linear_kernel_u8(
             row_ptr[0] = row_0;
             row_ptr[1] = row_1;
 
-            resize_linear_w_oneline_u8(inWidth, outWidth, channels, inData + src_h_idx_0 * inWidthStride, w_max, w_offset, w_coeff, row_ptr[0]);
-            resize_linear_w_oneline_u8(inWidth, outWidth, channels, inData + src_h_idx_1 * inWidthStride, w_max, w_offset, w_coeff, row_ptr[1]);
+            resize_linear_w_oneline_u8(inWidth, outWidth, channels, inData + src_h_idx_0 * inWidthStride, w_max, w_offset, w_coeff, row_ptr[0], isa);
+            resize_linear_w_oneline_u8(inWidth, outWidth, channels, inData + src_h_idx_1 * inWidthStride, w_max, w_offset, w_coeff, row_ptr[1], isa);
         } else {
             if (reuse_count == 1) {
                 if (row_ptr[0] == row_0) {
@@ -303,7 +339,7 @@ static void resize_linear_kernel_u8(
                 } else {
                     row_ptr[1] = row_0;
                 }
-                resize_linear_w_oneline_u8(inWidth, outWidth, channels, inData + src_h_idx_1 * inWidthStride, w_max, w_offset, w_coeff, row_ptr[1]);
+                resize_linear_w_oneline_u8(inWidth, outWidth, channels, inData + src_h_idx_1 * inWidthStride, w_max, w_offset, w_coeff, row_ptr[1], isa);
             }
         }
         resize_linear_h_u8(outWidth, channels, row_ptr[0], row_ptr[1], h_offset[h], h_coeff[h], outData + h * outWidthStride);
@@ -313,7 +349,9 @@ static void resize_linear_kernel_u8(
         prev_ptr[0] = row_ptr[0];
         prev_ptr[1] = row_ptr[1];
     }
-    tinycv::AlignedFree(temp_buffer);
+    if (!context) {
+        tinycv::ScratchFree(temp_buffer);
+    }
 }
 
 static void resize_linear_shrink2_c1_kernel_u8(
@@ -326,10 +364,11 @@ static void resize_linear_shrink2_c1_kernel_u8(
 {
     __m128i m_zero = _mm_set1_epi8(0);
     __m128i m_epi16_two = _mm_set1_epi16(2);
+    const bool use_fma = CpuSupports(ISA_X86_FMA);
     for (int32_t h = 0; h < outHeight; ++h) {
         int32_t w = 0;
 
-        if (CpuSupports(ISA_X86_FMA)) {
+        if (use_fma) {
             w = fma::resize_linear_shrink2_oneline_c1_kernel_u8_fma(inData + h * 2 * inWidthStride, inWidthStride, outWidth, outData + h * outWidthStride);
         }
         for (; w <= outWidth - 16; w += 16) {
@@ -392,10 +431,11 @@ static void resize_linear_shrink2_c4_kernel_u8(
 
     __m128i m_zero = _mm_set1_epi8(0);
     __m128i m_epi16_two = _mm_set1_epi16(2);
+    const bool use_fma = CpuSupports(ISA_X86_FMA);
     for (int32_t h = 0; h < outHeight; ++h) {
         int32_t w = 0;
 
-        if (CpuSupports(ISA_X86_FMA)) {
+        if (use_fma) {
             w = fma::resize_linear_shrink2_oneline_c4_kernel_u8_fma(inData + h * 2 * inWidthStride, inWidthStride, outWidth, outData + h * outWidthStride);
         }
         for (; w <= outWidth - 4; w += 4) {
@@ -472,6 +512,185 @@ static void resize_linear_shrink2_c4_kernel_u8(
     }
 }
 
+// sums the byte pairs laid out side by side in both rows, 8 u16 results
+static inline __m128i resize_shrink_pair_sum_u8(__m128i m_row0_pairs, __m128i m_row1_pairs)
+{
+    const __m128i m_one = _mm_set1_epi8(1);
+    return _mm_add_epi16(_mm_maddubs_epi16(m_row0_pairs, m_one), _mm_maddubs_epi16(m_row1_pairs, m_one));
+}
+
+static inline __m128i resize_shrink_load_two_u8(const uint8_t *ptr_0, const uint8_t *ptr_1)
+{
+    return _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)ptr_0), _mm_loadl_epi64((const __m128i *)ptr_1));
+}
+
+// (sum + 2) >> 2 of four source pixels, same rounding as the generic fixed point path
+static inline __m128i resize_shrink_round_u8(__m128i m_sum_lo, __m128i m_sum_hi)
+{
+    const __m128i m_epi16_two = _mm_set1_epi16(2);
+    m_sum_lo = _mm_srli_epi16(_mm_add_epi16(m_sum_lo, m_epi16_two), 2);
+    m_sum_hi = _mm_srli_epi16(_mm_add_epi16(m_sum_hi, m_epi16_two), 2);
+    return _mm_packus_epi16(m_sum_lo, m_sum_hi);
+}
+
+static void resize_linear_shrink2_c3_kernel_u8(
+    const uint8_t *inData,
+    int32_t inWidthStride,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const int32_t channels = 3;
+    // two output pixels per register, each built from the 6 bytes at offset 0 and 8
+    const __m128i m_pairs = _mm_setr_epi8(0, 3, 1, 4, 2, 5, 8, 11, 9, 12, 10, 13, -1, -1, -1, -1);
+    const __m128i m_compact = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13, -1, -1, -1, -1);
+
+    for (int32_t h = 0; h < outHeight; ++h) {
+        const uint8_t *row_0 = inData + (h * 2 + 0) * inWidthStride;
+        const uint8_t *row_1 = inData + (h * 2 + 1) * inWidthStride;
+        uint8_t *out_ptr = outData + h * outWidthStride;
+
+        int32_t w = 0;
+        // the 8 byte loads run 2 bytes past the last pixel they use
+        for (; w <= outWidth - 5; w += 4) {
+            const uint8_t *p0 = row_0 + w * channels * 2;
+            const uint8_t *p1 = row_1 + w * channels * 2;
+            __m128i m_sum_lo = resize_shrink_pair_sum_u8(
+                _mm_shuffle_epi8(resize_shrink_load_two_u8(p0 + 0, p0 + 6), m_pairs),
+                _mm_shuffle_epi8(resize_shrink_load_two_u8(p1 + 0, p1 + 6), m_pairs));
+            __m128i m_sum_hi = resize_shrink_pair_sum_u8(
+                _mm_shuffle_epi8(resize_shrink_load_two_u8(p0 + 12, p0 + 18), m_pairs),
+                _mm_shuffle_epi8(resize_shrink_load_two_u8(p1 + 12, p1 + 18), m_pairs));
+            __m128i m_dst = _mm_shuffle_epi8(resize_shrink_round_u8(m_sum_lo, m_sum_hi), m_compact);
+            _mm_storel_epi64((__m128i *)(out_ptr + w * channels), m_dst);
+            *(int32_t *)(out_ptr + w * channels + 8) = _mm_extract_epi32(m_dst, 2);
+        }
+        for (; w < outWidth; ++w) {
+            for (int32_t c = 0; c < channels; ++c) {
+                out_ptr[w * channels + c] = (row_0[w * channels * 2 + c] + row_0[w * channels * 2 + channels + c] +
+                                             row_1[w * channels * 2 + c] + row_1[w * channels * 2 + channels + c] + 2) >>
+                                            2;
+            }
+        }
+    }
+}
+
+// At exactly 1/4 the bilinear sample points fall halfway between source pixels 4x+1 and 4x+2,
+// so every output is the rounded mean of a 2x2 block at offset (1, 1).
+static void resize_linear_shrink4_c1_kernel_u8(
+    const uint8_t *inData,
+    int32_t inWidthStride,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const __m128i m_pairs = _mm_setr_epi8(1, 2, 5, 6, 9, 10, 13, 14, -1, -1, -1, -1, -1, -1, -1, -1);
+
+    for (int32_t h = 0; h < outHeight; ++h) {
+        const uint8_t *row_0 = inData + (h * 4 + 1) * inWidthStride;
+        const uint8_t *row_1 = inData + (h * 4 + 2) * inWidthStride;
+        uint8_t *out_ptr = outData + h * outWidthStride;
+
+        int32_t w = 0;
+        for (; w <= outWidth - 16; w += 16) {
+            __m128i m_row[2][4];
+            for (int32_t i = 0; i < 4; ++i) {
+                m_row[0][i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(row_0 + w * 4 + i * 16)), m_pairs);
+                m_row[1][i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(row_1 + w * 4 + i * 16)), m_pairs);
+            }
+            __m128i m_sum_lo = resize_shrink_pair_sum_u8(_mm_unpacklo_epi64(m_row[0][0], m_row[0][1]),
+                                                         _mm_unpacklo_epi64(m_row[1][0], m_row[1][1]));
+            __m128i m_sum_hi = resize_shrink_pair_sum_u8(_mm_unpacklo_epi64(m_row[0][2], m_row[0][3]),
+                                                         _mm_unpacklo_epi64(m_row[1][2], m_row[1][3]));
+            _mm_storeu_si128((__m128i *)(out_ptr + w), resize_shrink_round_u8(m_sum_lo, m_sum_hi));
+        }
+        for (; w < outWidth; ++w) {
+            out_ptr[w] = (row_0[w * 4 + 1] + row_0[w * 4 + 2] + row_1[w * 4 + 1] + row_1[w * 4 + 2] + 2) >> 2;
+        }
+    }
+}
+
+static void resize_linear_shrink4_c3_kernel_u8(
+    const uint8_t *inData,
+    int32_t inWidthStride,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const int32_t channels = 3;
+    const __m128i m_pairs = _mm_setr_epi8(0, 3, 1, 4, 2, 5, 8, 11, 9, 12, 10, 13, -1, -1, -1, -1);
+    const __m128i m_compact = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 8, 9, 10, 11, 12, 13, -1, -1, -1, -1);
+
+    for (int32_t h = 0; h < outHeight; ++h) {
+        const uint8_t *row_0 = inData + (h * 4 + 1) * inWidthStride + channels;
+        const uint8_t *row_1 = inData + (h * 4 + 2) * inWidthStride + channels;
+        uint8_t *out_ptr = outData + h * outWidthStride;
+
+        int32_t w = 0;
+        for (; w <= outWidth - 4; w += 4) {
+            const uint8_t *p0 = row_0 + w * channels * 4;
+            const uint8_t *p1 = row_1 + w * channels * 4;
+            __m128i m_sum_lo = resize_shrink_pair_sum_u8(
+                _mm_shuffle_epi8(resize_shrink_load_two_u8(p0 + 0, p0 + 12), m_pairs),
+                _mm_shuffle_epi8(resize_shrink_load_two_u8(p1 + 0, p1 + 12), m_pairs));
+            __m128i m_sum_hi = resize_shrink_pair_sum_u8(
+                _mm_shuffle_epi8(resize_shrink_load_two_u8(p0 + 24, p0 + 36), m_pairs),
+                _mm_shuffle_epi8(resize_shrink_load_two_u8(p1 + 24, p1 + 36), m_pairs));
+            __m128i m_dst = _mm_shuffle_epi8(resize_shrink_round_u8(m_sum_lo, m_sum_hi), m_compact);
+            _mm_storel_epi64((__m128i *)(out_ptr + w * channels), m_dst);
+            *(int32_t *)(out_ptr + w * channels + 8) = _mm_extract_epi32(m_dst, 2);
+        }
+        for (; w < outWidth; ++w) {
+            for (int32_t c = 0; c < channels; ++c) {
+                out_ptr[w * channels + c] = (row_0[w * channels * 4 + c] + row_0[w * channels * 4 + channels + c] +
+                                             row_1[w * channels * 4 + c] + row_1[w * channels * 4 + channels + c] + 2) >>
+                                            2;
+            }
+        }
+    }
+}
+
+static void resize_linear_shrink4_c4_kernel_u8(
+    const uint8_t *inData,
+    int32_t inWidthStride,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const int32_t channels = 4;
+    const __m128i m_pairs = _mm_setr_epi8(0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15);
+
+    for (int32_t h = 0; h < outHeight; ++h) {
+        const uint8_t *row_0 = inData + (h * 4 + 1) * inWidthStride + channels;
+        const uint8_t *row_1 = inData + (h * 4 + 2) * inWidthStride + channels;
+        uint8_t *out_ptr = outData + h * outWidthStride;
+
+        int32_t w = 0;
+        for (; w <= outWidth - 4; w += 4) {
+            const uint8_t *p0 = row_0 + w * channels * 4;
+            const uint8_t *p1 = row_1 + w * channels * 4;
+            __m128i m_sum_lo = resize_shrink_pair_sum_u8(
+                _mm_shuffle_epi8(resize_shrink_load_two_u8(p0 + 0, p0 + 16), m_pairs),
+                _mm_shuffle_epi8(resize_shrink_load_two_u8(p1 + 0, p1 + 16), m_pairs));
+            __m128i m_sum_hi = resize_shrink_pair_sum_u8(
+                _mm_shuffle_epi8(resize_shrink_load_two_u8(p0 + 32, p0 + 48), m_pairs),
+                _mm_shuffle_epi8(resize_shrink_load_two_u8(p1 + 32, p1 + 48), m_pairs));
+            _mm_storeu_si128((__m128i *)(out_ptr + w * channels), resize_shrink_round_u8(m_sum_lo, m_sum_hi));
+        }
+        for (; w < outWidth; ++w) {
+            for (int32_t c = 0; c < channels; ++c) {
+                out_ptr[w * channels + c] = (row_0[w * channels * 4 + c] + row_0[w * channels * 4 + channels + c] +
+                                             row_1[w * channels * 4 + c] + row_1[w * channels * 4 + channels + c] + 2) >>
+                                            2;
+            }
+        }
+    }
+}
+
 template <>
 void ResizeLinear<uint8_t, 1>(
     int32_t inHeight,
@@ -494,9 +713,14 @@ void ResizeLinear<uint8_t, 1>(
         resize_linear_shrink2_c1_kernel_u8(inData, inWidthStride, outHeight, outWidth, outWidthStride, outData);
         return;
     }
+    if (outHeight * 4 == inHeight && outWidth * 4 == inWidth) {
+        resize_linear_shrink4_c1_kernel_u8(inData, inWidthStride, outHeight, outWidth, outWidthStride, outData);
+        return;
+    }
 
     resize_linear_kernel_u8(
-        inHeight, inWidth, inWidthStride, inData, 1, outHeight, outWidth, outWidthStride, outData);
+        inHeight, inWidth, inWidthStride, inData, 1, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, nullptr);
 }
 
 template <>
@@ -517,8 +741,18 @@ void ResizeLinear<uint8_t, 3>(
         return;
     }
 
+    if (outHeight * 2 == inHeight && outWidth * 2 == inWidth) {
+        resize_linear_shrink2_c3_kernel_u8(inData, inWidthStride, outHeight, outWidth, outWidthStride, outData);
+        return;
+    }
+    if (outHeight * 4 == inHeight && outWidth * 4 == inWidth) {
+        resize_linear_shrink4_c3_kernel_u8(inData, inWidthStride, outHeight, outWidth, outWidthStride, outData);
+        return;
+    }
+
     resize_linear_kernel_u8(
-        inHeight, inWidth, inWidthStride, inData, 3, outHeight, outWidth, outWidthStride, outData);
+        inHeight, inWidth, inWidthStride, inData, 3, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, nullptr);
 }
 
 template <>
@@ -543,9 +777,184 @@ void ResizeLinear<uint8_t, 4>(
         resize_linear_shrink2_c4_kernel_u8(inData, inWidthStride, outHeight, outWidth, outWidthStride, outData);
         return;
     }
+    if (outHeight * 4 == inHeight && outWidth * 4 == inWidth) {
+        resize_linear_shrink4_c4_kernel_u8(inData, inWidthStride, outHeight, outWidth, outWidthStride, outData);
+        return;
+    }
 
     resize_linear_kernel_u8(
-        inHeight, inWidth, inWidthStride, inData, 4, outHeight, outWidth, outWidthStride, outData);
+        inHeight, inWidth, inWidthStride, inData, 4, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, nullptr);
+}
+
+template <int32_t channels>
+static void resize_linear_stream_u8(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    StreamStageTimer timer(context, "ResizeLinear");
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+
+    // the exact shrinks need neither tables nor buffers
+    if ((outHeight * 2 == inHeight && outWidth * 2 == inWidth) ||
+        (outHeight * 4 == inHeight && outWidth * 4 == inWidth)) {
+        ResizeLinear<uint8_t, channels>(inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+        return;
+    }
+
+    resize_linear_kernel_u8(
+        inHeight, inWidth, inWidthStride, inData, channels, outHeight, outWidth, outWidthStride, outData,
+        ResizeLinearScale(inHeight, outHeight), ResizeLinearScale(inWidth, outWidth), 0.0, 0.0, 0, 0, &context);
+}
+
+template <>
+void ResizeLinear<uint8_t, 1>(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    resize_linear_stream_u8<1>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<uint8_t, 3>(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    resize_linear_stream_u8<3>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeLinear<uint8_t, 4>(
+    StreamContext &context,
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    resize_linear_stream_u8<4>(context, inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <int32_t channels>
+static void resize_linear_region_u8(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (inHeight <= 0 || inWidth <= 0 || outHeight <= 0 || outWidth <= 0) {
+        return;
+    }
+    if (!(scaleY > 0.0) || !(scaleX > 0.0)) {
+        return;
+    }
+
+    // every code path is exact integer arithmetic, so a pixel gets the same bits whichever tile it is in
+    resize_linear_kernel_u8(
+        inHeight, inWidth, inWidthStride, inData, channels, outHeight, outWidth, outWidthStride, outData,
+        scaleY, scaleX, originY, originX, outY, outX, nullptr);
+}
+
+template <>
+void ResizeLinearRegion<uint8_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_u8<1>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<uint8_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_u8<3>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
+}
+
+template <>
+void ResizeLinearRegion<uint8_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    double scaleY,
+    double scaleX,
+    double originY,
+    double originX,
+    int32_t outY,
+    int32_t outX)
+{
+    resize_linear_region_u8<4>(
+        inHeight, inWidth, inWidthStride, inData, outHeight, outWidth, outWidthStride, outData, scaleY, scaleX, originY, originX, outY, outX);
 }
 
 } // namespace tinycv
@@ -234,7 +234,7 @@ static void resize_nearest_kernel_fp32(
     uint64_t size_for_w_offset = (outWidth * sizeof(int32_t) + 128 - 1) / 128 * 128;
     uint64_t total_size = size_for_h_offset + size_for_w_offset;
 
-    void *temp_buffer = tinycv::AlignedAlloc(total_size, 128);
+    void *temp_buffer = tinycv::ScratchAlloc(total_size, 128);
 
     int32_t *h_offset = (int32_t *)temp_buffer;
     int32_t *w_offset = (int32_t *)((unsigned char *)h_offset + size_for_h_offset);
@@ -305,7 +305,100 @@ static void resize_nearest_kernel_fp32(
         }
     }
 
-    tinycv::AlignedFree(temp_buffer);
+    tinycv::ScratchFree(temp_buffer);
+}
+
+// 16-bit elements are only moved around, an output row mapping to the same source row as the previous one is a plain copy
+static void resize_nearest_kernel_16bit(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t channels,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    uint64_t size_for_h_offset = (outHeight * sizeof(int32_t) + 128 - 1) / 128 * 128;
+    uint64_t size_for_w_offset = (outWidth * sizeof(int32_t) + 128 - 1) / 128 * 128;
+    uint64_t total_size = size_for_h_offset + size_for_w_offset;
+
+    void *temp_buffer = tinycv::ScratchAlloc(total_size, 128);
+
+    int32_t *h_offset = (int32_t *)temp_buffer;
+    int32_t *w_offset = (int32_t *)((unsigned char *)h_offset + size_for_h_offset);
+
+    resize_nearest_calc_offset_fp32(inHeight, inWidth, outHeight, outWidth, h_offset, w_offset);
+
+    for (int32_t i = 0; i < outHeight; ++i) {
+        uint16_t *dst = outData + i * outWidthStride;
+        if (i > 0 && h_offset[i] == h_offset[i - 1]) {
+            memcpy(dst, dst - outWidthStride, outWidth * channels * sizeof(uint16_t));
+            continue;
+        }
+        const uint16_t *src = inData + h_offset[i] * inWidthStride;
+        if (channels == 1) {
+            for (int32_t j = 0; j < outWidth; ++j) {
+                dst[j] = src[w_offset[j]];
+            }
+        } else if (channels == 3) {
+            for (int32_t j = 0; j < outWidth; ++j) {
+                const uint16_t *s = src + w_offset[j] * 3;
+                dst[j * 3 + 0] = s[0];
+                dst[j * 3 + 1] = s[1];
+                dst[j * 3 + 2] = s[2];
+            }
+        } else {
+            for (int32_t j = 0; j < outWidth; ++j) {
+                uint64_t pixel;
+                memcpy(&pixel, src + w_offset[j] * 4, sizeof(pixel));
+                memcpy(dst + j * 4, &pixel, sizeof(pixel));
+            }
+        }
+    }
+
+    tinycv::ScratchFree(temp_buffer);
+}
+
+// exact 1/2 and 1/4 downscale, the sample points are the top left pixel of every block
+static void resize_nearest_shrink_kernel_fp32(
+    const float *inData,
+    int32_t inWidthStride,
+    int32_t channels,
+    int32_t scale,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    float *outData)
+{
+    for (int32_t h = 0; h < outHeight; ++h) {
+        const float *in_ptr = inData + h * scale * inWidthStride;
+        float *out_ptr = outData + h * outWidthStride;
+        int32_t w = 0;
+        if (channels == 1 && scale == 2) {
+            for (; w <= outWidth - 4; w += 4) {
+                __m128 m_data_0 = _mm_loadu_ps(in_ptr + w * 2 + 0);
+                __m128 m_data_1 = _mm_loadu_ps(in_ptr + w * 2 + 4);
+                _mm_storeu_ps(out_ptr + w, _mm_shuffle_ps(m_data_0, m_data_1, _MM_SHUFFLE(2, 0, 2, 0)));
+            }
+        } else if (channels == 1 && scale == 4) {
+            for (; w <= outWidth - 4; w += 4) {
+                __m128 m_data_0 = _mm_unpacklo_ps(_mm_loadu_ps(in_ptr + w * 4 + 0), _mm_loadu_ps(in_ptr + w * 4 + 4));
+                __m128 m_data_1 = _mm_unpacklo_ps(_mm_loadu_ps(in_ptr + w * 4 + 8), _mm_loadu_ps(in_ptr + w * 4 + 12));
+                _mm_storeu_ps(out_ptr + w, _mm_movelh_ps(m_data_0, m_data_1));
+            }
+        } else if (channels == 4) {
+            for (; w < outWidth; ++w) {
+                _mm_storeu_ps(out_ptr + w * 4, _mm_loadu_ps(in_ptr + w * scale * 4));
+            }
+        }
+        for (; w < outWidth; ++w) {
+            for (int32_t c = 0; c < channels; ++c) {
+                out_ptr[w * channels + c] = in_ptr[w * scale * channels + c];
+            }
+        }
+    }
 }
 
 template <>
@@ -326,6 +419,12 @@ void ResizeNearestPoint<float, 1>(
         return;
     }
 
+    if ((outHeight * 2 == inHeight && outWidth * 2 == inWidth) ||
+        (outHeight * 4 == inHeight && outWidth * 4 == inWidth)) {
+        resize_nearest_shrink_kernel_fp32(inData, inWidthStride, 1, inHeight / outHeight, outHeight, outWidth, outWidthStride, outData);
+        return;
+    }
+
     resize_nearest_kernel_fp32(
         inHeight, inWidth, inWidthStride, inData, 1, outHeight, outWidth, outWidthStride, outData);
 }
@@ -348,6 +447,12 @@ void ResizeNearestPoint<float, 3>(
         return;
     }
 
+    if ((outHeight * 2 == inHeight && outWidth * 2 == inWidth) ||
+        (outHeight * 4 == inHeight && outWidth * 4 == inWidth)) {
+        resize_nearest_shrink_kernel_fp32(inData, inWidthStride, 3, inHeight / outHeight, outHeight, outWidth, outWidthStride, outData);
+        return;
+    }
+
     resize_nearest_kernel_fp32(
         inHeight, inWidth, inWidthStride, inData, 3, outHeight, outWidth, outWidthStride, outData);
 }
@@ -370,8 +475,212 @@ void ResizeNearestPoint<float, 4>(
         return;
     }
 
+    if ((outHeight * 2 == inHeight && outWidth * 2 == inWidth) ||
+        (outHeight * 4 == inHeight && outWidth * 4 == inWidth)) {
+        resize_nearest_shrink_kernel_fp32(inData, inWidthStride, 4, inHeight / outHeight, outHeight, outWidth, outWidthStride, outData);
+        return;
+    }
+
     resize_nearest_kernel_fp32(
         inHeight, inWidth, inWidthStride, inData, 4, outHeight, outWidth, outWidthStride, outData);
 }
 
+template <>
+void ResizeNearestPoint<half_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_nearest_kernel_16bit(
+        inHeight, inWidth, inWidthStride, (const uint16_t *)inData, 1, outHeight, outWidth, outWidthStride, (uint16_t *)outData);
+}
+
+template <>
+void ResizeNearestPoint<half_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_nearest_kernel_16bit(
+        inHeight, inWidth, inWidthStride, (const uint16_t *)inData, 3, outHeight, outWidth, outWidthStride, (uint16_t *)outData);
+}
+
+template <>
+void ResizeNearestPoint<half_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const half_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    half_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_nearest_kernel_16bit(
+        inHeight, inWidth, inWidthStride, (const uint16_t *)inData, 4, outHeight, outWidth, outWidthStride, (uint16_t *)outData);
+}
+
+template <>
+void ResizeNearestPoint<uint16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_nearest_kernel_16bit(
+        inHeight, inWidth, inWidthStride, inData, 1, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeNearestPoint<uint16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_nearest_kernel_16bit(
+        inHeight, inWidth, inWidthStride, inData, 3, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeNearestPoint<uint16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const uint16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint16_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_nearest_kernel_16bit(
+        inHeight, inWidth, inWidthStride, inData, 4, outHeight, outWidth, outWidthStride, outData);
+}
+
+template <>
+void ResizeNearestPoint<int16_t, 1>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_nearest_kernel_16bit(
+        inHeight, inWidth, inWidthStride, (const uint16_t *)inData, 1, outHeight, outWidth, outWidthStride, (uint16_t *)outData);
+}
+
+template <>
+void ResizeNearestPoint<int16_t, 3>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_nearest_kernel_16bit(
+        inHeight, inWidth, inWidthStride, (const uint16_t *)inData, 3, outHeight, outWidth, outWidthStride, (uint16_t *)outData);
+}
+
+template <>
+void ResizeNearestPoint<int16_t, 4>(
+    int32_t inHeight,
+    int32_t inWidth,
+    int32_t inWidthStride,
+    const int16_t *inData,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    int16_t *outData)
+{
+    if (nullptr == inData) {
+        return;
+    }
+    if (nullptr == outData) {
+        return;
+    }
+
+    resize_nearest_kernel_16bit(
+        inHeight, inWidth, inWidthStride, (const uint16_t *)inData, 4, outHeight, outWidth, outWidthStride, (uint16_t *)outData);
+}
+
 } // namespace tinycv
@@ -230,7 +230,7 @@ static void resize_nearest_kernel_u8(
     uint64_t size_for_w_offset = (outWidth * sizeof(int32_t) + 128 - 1) / 128 * 128;
     uint64_t total_size = size_for_h_offset + size_for_w_offset;
 
-    void *temp_buffer = tinycv::AlignedAlloc(total_size, 128);
+    void *temp_buffer = tinycv::ScratchAlloc(total_size, 128);
 
     int32_t *h_offset = (int32_t *)temp_buffer;
     int32_t *w_offset = (int32_t *)((unsigned char *)h_offset + size_for_h_offset);
@@ -301,7 +301,64 @@ static void resize_nearest_kernel_u8(
         }
     }
 
-    tinycv::AlignedFree(temp_buffer);
+    tinycv::ScratchFree(temp_buffer);
+}
+
+// exact 1/2 and 1/4 downscale, the sample points are the top left pixel of every block
+static void resize_nearest_shrink_kernel_u8(
+    const uint8_t *inData,
+    int32_t inWidthStride,
+    int32_t channels,
+    int32_t scale,
+    int32_t outHeight,
+    int32_t outWidth,
+    int32_t outWidthStride,
+    uint8_t *outData)
+{
+    const __m128i m_mask_w = _mm_set1_epi16(0xff);
+    const __m128i m_mask_d = _mm_set1_epi32(0xff);
+
+    for (int32_t h = 0; h < outHeight; ++h) {
+        const uint8_t *in_ptr = inData + h * scale * inWidthStride;
+        uint8_t *out_ptr = outData + h * outWidthStride;
+        int32_t w = 0;
+        if (channels == 1 && scale == 2) {
+            for (; w <= outWidth - 16; w += 16) {
+                __m128i m_data_0 = _mm_and_si128(_mm_loadu_si128((const __m128i *)(in_ptr + w * 2 + 0)), m_mask_w);
+                __m128i m_data_1 = _mm_and_si128(_mm_loadu_si128((const __m128i *)(in_ptr + w * 2 + 16)), m_mask_w);
+                _mm_storeu_si128((__m128i *)(out_ptr + w), _mm_packus_epi16(m_data_0, m_data_1));
+            }
+        } else if (channels == 1 && scale == 4) {
+            for (; w <= outWidth - 16; w += 16) {
+                __m128i m_data[4];
+                for (int32_t i = 0; i < 4; ++i) {
+                    m_data[i] = _mm_and_si128(_mm_loadu_si128((const __m128i *)(in_ptr + w * 4 + i * 16)), m_mask_d);
+                }
+                __m128i m_lo = _mm_packs_epi32(m_data[0], m_data[1]);
+                __m128i m_hi = _mm_packs_epi32(m_data[2], m_data[3]);
+                _mm_storeu_si128((__m128i *)(out_ptr + w), _mm_packus_epi16(m_lo, m_hi));
+            }
+        } else if (channels == 4 && scale == 2) {
+            for (; w <= outWidth - 4; w += 4) {
+                __m128 m_data_0 = _mm_loadu_ps((const float *)(in_ptr + w * 8 + 0));
+                __m128 m_data_1 = _mm_loadu_ps((const float *)(in_ptr + w * 8 + 16));
+                _mm_storeu_ps((float *)(out_ptr + w * 4), _mm_shuffle_ps(m_data_0, m_data_1, _MM_SHUFFLE(2, 0, 2, 0)));
+            }
+        } else if (channels == 4 && scale == 4) {
+            for (; w <= outWidth - 4; w += 4) {
+                __m128i m_data_0 = _mm_unpacklo_epi32(_mm_loadu_si128((const __m128i *)(in_ptr + w * 16 + 0)),
+                                                      _mm_loadu_si128((const __m128i *)(in_ptr + w * 16 + 16)));
+                __m128i m_data_1 = _mm_unpacklo_epi32(_mm_loadu_si128((const __m128i *)(in_ptr + w * 16 + 32)),
+                                                      _mm_loadu_si128((const __m128i *)(in_ptr + w * 16 + 48)));
+                _mm_storeu_si128((__m128i *)(out_ptr + w * 4), _mm_unpacklo_epi64(m_data_0, m_data_1));
+            }
+        }
+        for (; w < outWidth; ++w) {
+            for (int32_t c = 0; c < channels; ++c) {
+                out_ptr[w * channels + c] = in_ptr[w * scale * channels + c];
+            }
+        }
+    }
 }
 
 template <>
@@ -322,6 +379,12 @@ void ResizeNearestPoint<uint8_t, 1>(
         return;
     }
 
+    if ((outHeight * 2 == inHeight && outWidth * 2 == inWidth) ||
+        (outHeight * 4 == inHeight && outWidth * 4 == inWidth)) {
+        resize_nearest_shrink_kernel_u8(inData, inWidthStride, 1, inHeight / outHeight, outHeight, outWidth, outWidthStride, outData);
+        return;
+    }
+
     resize_nearest_kernel_u8(
         inHeight, inWidth, inWidthStride, inData, 1, outHeight, outWidth, outWidthStride, outData);
 }
@@ -344,6 +407,12 @@ void ResizeNearestPoint<uint8_t, 3>(
         return;
     }
 
+    if ((outHeight * 2 == inHeight && outWidth * 2 == inWidth) ||
+        (outHeight * 4 == inHeight && outWidth * 4 == inWidth)) {
+        resize_nearest_shrink_kernel_u8(inData, inWidthStride, 3, inHeight / outHeight, outHeight, outWidth, outWidthStride, outData);
+        return;
+    }
+
     resize_nearest_kernel_u8(
         inHeight, inWidth, inWidthStride, inData, 3, outHeight, outWidth, outWidthStride, outData);
 }
@@ -366,6 +435,12 @@ void ResizeNearestPoint<uint8_t, 4>(
         return;
     }
 
+    if ((outHeight * 2 == inHeight && outWidth * 2 == inWidth) ||
+        (outHeight * 4 == inHeight && outWidth * 4 == inWidth)) {
+        resize_nearest_shrink_kernel_u8(inData, inWidthStride, 4, inHeight / outHeight, outHeight, outWidth, outWidthStride, outData);
+        return;
+    }
+
     resize_nearest_kernel_u8(
         inHeight, inWidth, inWidthStride, inData, 4, outHeight, outWidth, outWidthStride, outData);
 }
@@ -23,6 +23,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <algorithm>
 
 template <typename T, int32_t nc>
 void ResizeLinearTest(int32_t inHeight, int32_t inWidth, int32_t outHeight, int32_t outWidth, T diff)
@@ -57,22 +58,81 @@ void ResizeNearestTest(int32_t inHeight, int32_t inWidth, int32_t outHeight, int
     checkResult<T, nc>(dst_ref.get(), dst.get(), outHeight, outWidth, outWidth * nc, outWidth * nc, diff);
 }
 
+template <typename T, int32_t nc>
+void ResizeCubicTest(int32_t inHeight, int32_t inWidth, int32_t outHeight, int32_t outWidth, float diff)
+{
+    std::unique_ptr<T[]> src(new T[inWidth * inHeight * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[outWidth * outHeight * nc]);
+    std::unique_ptr<T[]> dst(new T[outWidth * outHeight * nc]);
+    tinycv::debug::randomFill<T>(src.get(), inWidth * inHeight * nc, 0, 255);
+    cv::Mat src_opencv(inHeight, inWidth, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get(), sizeof(T) * inWidth * nc);
+    cv::Mat dst_opencv(outHeight, outWidth, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get(), sizeof(T) * outWidth * nc);
+
+    cv::resize(src_opencv, dst_opencv, cv::Size(outWidth, outHeight), 0, 0, cv::INTER_CUBIC);
+    tinycv::ResizeCubic<T, nc>(inHeight, inWidth, inWidth * nc, src.get(), outHeight, outWidth, outWidth * nc, dst.get());
+
+    checkResult<T, nc>(dst_ref.get(), dst.get(), outHeight, outWidth, outWidth * nc, outWidth * nc, diff);
+}
+
+// with window 4 a 2x upscale uses the same 8 taps as OpenCV's INTER_LANCZOS4, only the borders
+// differ since clipped windows are renormalized instead of replicating edge pixels
+template <typename T, int32_t nc>
+void ResizeLanczosTest(int32_t inHeight, int32_t inWidth, float diff)
+{
+    const int32_t margin = 8;
+    int32_t outHeight = inHeight * 2;
+    int32_t outWidth = inWidth * 2;
+    std::unique_ptr<T[]> src(new T[inWidth * inHeight * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[outWidth * outHeight * nc]);
+    std::unique_ptr<T[]> dst(new T[outWidth * outHeight * nc]);
+    tinycv::debug::randomFill<T>(src.get(), inWidth * inHeight * nc, 0, 255);
+    cv::Mat src_opencv(inHeight, inWidth, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get(), sizeof(T) * inWidth * nc);
+    cv::Mat dst_opencv(outHeight, outWidth, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get(), sizeof(T) * outWidth * nc);
+
+    cv::resize(src_opencv, dst_opencv, cv::Size(outWidth, outHeight), 0, 0, cv::INTER_LANCZOS4);
+    tinycv::ResizeLanczos<T, nc>(inHeight, inWidth, inWidth * nc, src.get(), outHeight, outWidth, outWidth * nc, dst.get(), 4);
+
+    int32_t offset = margin * outWidth * nc + margin * nc;
+    checkResult<T, nc>(dst_ref.get() + offset, dst.get() + offset, outHeight - 2 * margin, outWidth - 2 * margin, outWidth * nc, outWidth * nc, diff);
+}
+
+// weights are normalized per output, so a flat image stays flat for any ratio and window
+template <typename T, int32_t nc>
+void ResizeLanczosFlatTest(int32_t inHeight, int32_t inWidth, int32_t outHeight, int32_t outWidth, int32_t window, float diff)
+{
+    std::unique_ptr<T[]> src(new T[inWidth * inHeight * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[outWidth * outHeight * nc]);
+    std::unique_ptr<T[]> dst(new T[outWidth * outHeight * nc]);
+    std::fill(src.get(), src.get() + inWidth * inHeight * nc, (T)173);
+    std::fill(dst_ref.get(), dst_ref.get() + outWidth * outHeight * nc, (T)173);
+
+    tinycv::ResizeLanczos<T, nc>(inHeight, inWidth, inWidth * nc, src.get(), outHeight, outWidth, outWidth * nc, dst.get(), window);
+
+    checkResult<T, nc>(dst_ref.get(), dst.get(), outHeight, outWidth, outWidth * nc, outWidth * nc, diff);
+}
+
 TEST(RESIZE_LINEAR_FP32, x86)
 {
     ResizeLinearTest<float, 1>(360, 540, 720, 1080, 1);
     ResizeLinearTest<float, 1>(720, 1080, 360, 540, 1);
     ResizeLinearTest<float, 1>(360, 540, 640, 480, 1);
     ResizeLinearTest<float, 1>(640, 480, 360, 540, 1);
+    ResizeLinearTest<float, 1>(724, 1076, 181, 269, 1);
+    ResizeLinearTest<float, 1>(362, 538, 181, 269, 1);
 
     ResizeLinearTest<float, 3>(360, 540, 720, 1080, 1);
     ResizeLinearTest<float, 3>(720, 1080, 360, 540, 1);
     ResizeLinearTest<float, 3>(360, 540, 640, 480, 1);
     ResizeLinearTest<float, 3>(640, 480, 360, 540, 1);
+    ResizeLinearTest<float, 3>(724, 1076, 181, 269, 1);
+    ResizeLinearTest<float, 3>(362, 538, 181, 269, 1);
 
     ResizeLinearTest<float, 4>(360, 540, 720, 1080, 1);
     ResizeLinearTest<float, 4>(720, 1080, 360, 540, 1);
     ResizeLinearTest<float, 4>(360, 540, 640, 480, 1);
     ResizeLinearTest<float, 4>(640, 480, 360, 540, 1);
+    ResizeLinearTest<float, 4>(724, 1076, 181, 269, 1);
+    ResizeLinearTest<float, 4>(362, 538, 181, 269, 1);
 }
 
 TEST(RESIZE_LINEAR_UINT8, x86)
@@ -81,16 +141,58 @@ TEST(RESIZE_LINEAR_UINT8, x86)
     ResizeLinearTest<uint8_t, 1>(720, 1080, 360, 540, 1);
     ResizeLinearTest<uint8_t, 1>(360, 540, 640, 480, 1);
     ResizeLinearTest<uint8_t, 1>(640, 480, 360, 540, 1);
+    ResizeLinearTest<uint8_t, 1>(724, 1076, 181, 269, 1);
+    ResizeLinearTest<uint8_t, 1>(362, 538, 181, 269, 1);
 
     ResizeLinearTest<uint8_t, 3>(360, 540, 720, 1080, 1);
     ResizeLinearTest<uint8_t, 3>(720, 1080, 360, 540, 1);
     ResizeLinearTest<uint8_t, 3>(360, 540, 640, 480, 1);
     ResizeLinearTest<uint8_t, 3>(640, 480, 360, 540, 1);
+    ResizeLinearTest<uint8_t, 3>(724, 1076, 181, 269, 1);
+    ResizeLinearTest<uint8_t, 3>(362, 538, 181, 269, 1);
 
     ResizeLinearTest<uint8_t, 4>(360, 540, 720, 1080, 1);
     ResizeLinearTest<uint8_t, 4>(720, 1080, 360, 540, 1);
     ResizeLinearTest<uint8_t, 4>(360, 540, 640, 480, 1);
     ResizeLinearTest<uint8_t, 4>(640, 480, 360, 540, 1);
+    ResizeLinearTest<uint8_t, 4>(724, 1076, 181, 269, 1);
+    ResizeLinearTest<uint8_t, 4>(362, 538, 181, 269, 1);
+}
+
+TEST(RESIZE_LINEAR_UINT16, x86)
+{
+    ResizeLinearTest<uint16_t, 1>(360, 540, 720, 1080, 1);
+    ResizeLinearTest<uint16_t, 1>(720, 1080, 360, 540, 1);
+    ResizeLinearTest<uint16_t, 1>(360, 540, 640, 480, 1);
+    ResizeLinearTest<uint16_t, 1>(640, 480, 360, 540, 1);
+
+    ResizeLinearTest<uint16_t, 3>(360, 540, 720, 1080, 1);
+    ResizeLinearTest<uint16_t, 3>(720, 1080, 360, 540, 1);
+    ResizeLinearTest<uint16_t, 3>(360, 540, 640, 480, 1);
+    ResizeLinearTest<uint16_t, 3>(640, 480, 360, 540, 1);
+
+    ResizeLinearTest<uint16_t, 4>(360, 540, 720, 1080, 1);
+    ResizeLinearTest<uint16_t, 4>(720, 1080, 360, 540, 1);
+    ResizeLinearTest<uint16_t, 4>(360, 540, 640, 480, 1);
+    ResizeLinearTest<uint16_t, 4>(640, 480, 360, 540, 1);
+}
+
+TEST(RESIZE_LINEAR_INT16, x86)
+{
+    ResizeLinearTest<int16_t, 1>(360, 540, 720, 1080, 1);
+    ResizeLinearTest<int16_t, 1>(720, 1080, 360, 540, 1);
+    ResizeLinearTest<int16_t, 1>(360, 540, 640, 480, 1);
+    ResizeLinearTest<int16_t, 1>(640, 480, 360, 540, 1);
+
+    ResizeLinearTest<int16_t, 3>(360, 540, 720, 1080, 1);
+    ResizeLinearTest<int16_t, 3>(720, 1080, 360, 540, 1);
+    ResizeLinearTest<int16_t, 3>(360, 540, 640, 480, 1);
+    ResizeLinearTest<int16_t, 3>(640, 480, 360, 540, 1);
+
+    ResizeLinearTest<int16_t, 4>(360, 540, 720, 1080, 1);
+    ResizeLinearTest<int16_t, 4>(720, 1080, 360, 540, 1);
+    ResizeLinearTest<int16_t, 4>(360, 540, 640, 480, 1);
+    ResizeLinearTest<int16_t, 4>(640, 480, 360, 540, 1);
 }
 
 TEST(RESIZE_NEAREST_FP32, x86)
@@ -99,16 +201,22 @@ TEST(RESIZE_NEAREST_FP32, x86)
     ResizeNearestTest<float, 1>(720, 1080, 360, 540, 1);
     ResizeNearestTest<float, 1>(360, 540, 640, 480, 1);
     ResizeNearestTest<float, 1>(640, 480, 360, 540, 1);
+    ResizeNearestTest<float, 1>(724, 1076, 181, 269, 1);
+    ResizeNearestTest<float, 1>(362, 538, 181, 269, 1);
 
     ResizeNearestTest<float, 3>(360, 540, 720, 1080, 1);
     ResizeNearestTest<float, 3>(720, 1080, 360, 540, 1);
     ResizeNearestTest<float, 3>(360, 540, 640, 480, 1);
     ResizeNearestTest<float, 3>(640, 480, 360, 540, 1);
+    ResizeNearestTest<float, 3>(724, 1076, 181, 269, 1);
+    ResizeNearestTest<float, 3>(362, 538, 181, 269, 1);
 
     ResizeNearestTest<float, 4>(360, 540, 720, 1080, 1);
     ResizeNearestTest<float, 4>(720, 1080, 360, 540, 1);
     ResizeNearestTest<float, 4>(360, 540, 640, 480, 1);
     ResizeNearestTest<float, 4>(640, 480, 360, 540, 1);
+    ResizeNearestTest<float, 4>(724, 1076, 181, 269, 1);
+    ResizeNearestTest<float, 4>(362, 538, 181, 269, 1);
 }
 
 TEST(RESIZE_NEAREST_UINT8, x86)
@@ -117,14 +225,242 @@ TEST(RESIZE_NEAREST_UINT8, x86)
     ResizeNearestTest<uint8_t, 1>(720, 1080, 360, 540, 1);
     ResizeNearestTest<uint8_t, 1>(360, 540, 640, 480, 1);
     ResizeNearestTest<uint8_t, 1>(640, 480, 360, 540, 1);
+    ResizeNearestTest<uint8_t, 1>(724, 1076, 181, 269, 1);
+    ResizeNearestTest<uint8_t, 1>(362, 538, 181, 269, 1);
 
     ResizeNearestTest<uint8_t, 3>(360, 540, 720, 1080, 1);
     ResizeNearestTest<uint8_t, 3>(720, 1080, 360, 540, 1);
     ResizeNearestTest<uint8_t, 3>(360, 540, 640, 480, 1);
     ResizeNearestTest<uint8_t, 3>(640, 480, 360, 540, 1);
+    ResizeNearestTest<uint8_t, 3>(724, 1076, 181, 269, 1);
+    ResizeNearestTest<uint8_t, 3>(362, 538, 181, 269, 1);
 
     ResizeNearestTest<uint8_t, 4>(360, 540, 720, 1080, 1);
     ResizeNearestTest<uint8_t, 4>(720, 1080, 360, 540, 1);
     ResizeNearestTest<uint8_t, 4>(360, 540, 640, 480, 1);
     ResizeNearestTest<uint8_t, 4>(640, 480, 360, 540, 1);
+    ResizeNearestTest<uint8_t, 4>(724, 1076, 181, 269, 1);
+    ResizeNearestTest<uint8_t, 4>(362, 538, 181, 269, 1);
+}
+
+TEST(RESIZE_NEAREST_UINT16, x86)
+{
+    ResizeNearestTest<uint16_t, 1>(360, 540, 720, 1080, 1);
+    ResizeNearestTest<uint16_t, 1>(720, 1080, 360, 540, 1);
+    ResizeNearestTest<uint16_t, 1>(360, 540, 640, 480, 1);
+    ResizeNearestTest<uint16_t, 1>(640, 480, 360, 540, 1);
+
+    ResizeNearestTest<uint16_t, 3>(360, 540, 720, 1080, 1);
+    ResizeNearestTest<uint16_t, 3>(720, 1080, 360, 540, 1);
+    ResizeNearestTest<uint16_t, 3>(360, 540, 640, 480, 1);
+    ResizeNearestTest<uint16_t, 3>(640, 480, 360, 540, 1);
+
+    ResizeNearestTest<uint16_t, 4>(360, 540, 720, 1080, 1);
+    ResizeNearestTest<uint16_t, 4>(720, 1080, 360, 540, 1);
+    ResizeNearestTest<uint16_t, 4>(360, 540, 640, 480, 1);
+    ResizeNearestTest<uint16_t, 4>(640, 480, 360, 540, 1);
+}
+
+TEST(RESIZE_NEAREST_INT16, x86)
+{
+    ResizeNearestTest<int16_t, 1>(360, 540, 720, 1080, 1);
+    ResizeNearestTest<int16_t, 1>(720, 1080, 360, 540, 1);
+    ResizeNearestTest<int16_t, 1>(360, 540, 640, 480, 1);
+    ResizeNearestTest<int16_t, 1>(640, 480, 360, 540, 1);
+
+    ResizeNearestTest<int16_t, 3>(360, 540, 720, 1080, 1);
+    ResizeNearestTest<int16_t, 3>(720, 1080, 360, 540, 1);
+    ResizeNearestTest<int16_t, 3>(360, 540, 640, 480, 1);
+    ResizeNearestTest<int16_t, 3>(640, 480, 360, 540, 1);
+
+    ResizeNearestTest<int16_t, 4>(360, 540, 720, 1080, 1);
+    ResizeNearestTest<int16_t, 4>(720, 1080, 360, 540, 1);
+    ResizeNearestTest<int16_t, 4>(360, 540, 640, 480, 1);
+    ResizeNearestTest<int16_t, 4>(640, 480, 360, 540, 1);
+}
+
+template <int32_t nc>
+void ResizeLinearHalfTest(int32_t inHeight, int32_t inWidth, int32_t outHeight, int32_t outWidth, float diff)
+{
+    std::unique_ptr<tinycv::half_t[]> src(new tinycv::half_t[inWidth * inHeight * nc]);
+    std::unique_ptr<float[]> src_f32(new float[inWidth * inHeight * nc]);
+    std::unique_ptr<float[]> dst_f32(new float[outWidth * outHeight * nc]);
+    std::unique_ptr<tinycv::half_t[]> dst_ref(new tinycv::half_t[outWidth * outHeight * nc]);
+    std::unique_ptr<tinycv::half_t[]> dst(new tinycv::half_t[outWidth * outHeight * nc]);
+    randomFillHalf(src.get(), src_f32.get(), inWidth * inHeight * nc, 0, 255);
+
+    cv::Mat src_opencv(inHeight, inWidth, CV_MAKETYPE(CV_32F, nc), src_f32.get(), sizeof(float) * inWidth * nc);
+    cv::Mat dst_opencv(outHeight, outWidth, CV_MAKETYPE(CV_32F, nc), dst_f32.get(), sizeof(float) * outWidth * nc);
+
+    cv::resize(src_opencv, dst_opencv, cv::Size(outWidth, outHeight), cv::INTER_LINEAR);
+    tinycv::ResizeLinear<tinycv::half_t, nc>(inHeight, inWidth, inWidth * nc, src.get(), outHeight, outWidth, outWidth * nc, dst.get());
+
+    for (int32_t i = 0; i < outWidth * outHeight * nc; ++i) {
+        dst_ref[i] = tinycv::half_t(dst_f32[i]);
+    }
+    checkResult<tinycv::half_t, nc>(dst_ref.get(), dst.get(), outHeight, outWidth, outWidth * nc, outWidth * nc, diff);
+}
+
+TEST(RESIZE_LINEAR_FP16, x86)
+{
+    // one fp16 step is 0.125 between 128 and 256, allow a rounding difference of one step
+    ResizeLinearHalfTest<1>(360, 540, 720, 1080, 0.26f);
+    ResizeLinearHalfTest<1>(720, 1080, 360, 540, 0.26f);
+    ResizeLinearHalfTest<1>(360, 540, 640, 480, 0.26f);
+    ResizeLinearHalfTest<1>(640, 480, 360, 540, 0.26f);
+
+    ResizeLinearHalfTest<3>(360, 540, 720, 1080, 0.26f);
+    ResizeLinearHalfTest<3>(720, 1080, 360, 540, 0.26f);
+    ResizeLinearHalfTest<3>(360, 540, 640, 480, 0.26f);
+    ResizeLinearHalfTest<3>(640, 480, 360, 540, 0.26f);
+
+    ResizeLinearHalfTest<4>(360, 540, 720, 1080, 0.26f);
+    ResizeLinearHalfTest<4>(720, 1080, 360, 540, 0.26f);
+    ResizeLinearHalfTest<4>(360, 540, 640, 480, 0.26f);
+    ResizeLinearHalfTest<4>(640, 480, 360, 540, 0.26f);
+}
+
+TEST(RESIZE_CUBIC_FP32, x86)
+{
+    ResizeCubicTest<float, 1>(360, 540, 720, 1080, 1e-2f);
+    ResizeCubicTest<float, 1>(720, 1080, 360, 540, 1e-2f);
+    ResizeCubicTest<float, 1>(360, 540, 640, 480, 1e-2f);
+    ResizeCubicTest<float, 1>(101, 99, 37, 203, 1e-2f);
+
+    ResizeCubicTest<float, 3>(360, 540, 720, 1080, 1e-2f);
+    ResizeCubicTest<float, 3>(720, 1080, 360, 540, 1e-2f);
+    ResizeCubicTest<float, 3>(360, 540, 640, 480, 1e-2f);
+    ResizeCubicTest<float, 3>(101, 99, 37, 203, 1e-2f);
+
+    ResizeCubicTest<float, 4>(360, 540, 720, 1080, 1e-2f);
+    ResizeCubicTest<float, 4>(720, 1080, 360, 540, 1e-2f);
+    ResizeCubicTest<float, 4>(360, 540, 640, 480, 1e-2f);
+    ResizeCubicTest<float, 4>(101, 99, 37, 203, 1e-2f);
+}
+
+TEST(RESIZE_CUBIC_UINT8, x86)
+{
+    ResizeCubicTest<uint8_t, 1>(360, 540, 720, 1080, 1.01f);
+    ResizeCubicTest<uint8_t, 1>(720, 1080, 360, 540, 1.01f);
+    ResizeCubicTest<uint8_t, 1>(360, 540, 640, 480, 1.01f);
+    ResizeCubicTest<uint8_t, 1>(101, 99, 37, 203, 1.01f);
+
+    ResizeCubicTest<uint8_t, 3>(360, 540, 720, 1080, 1.01f);
+    ResizeCubicTest<uint8_t, 3>(720, 1080, 360, 540, 1.01f);
+    ResizeCubicTest<uint8_t, 3>(360, 540, 640, 480, 1.01f);
+    ResizeCubicTest<uint8_t, 3>(101, 99, 37, 203, 1.01f);
+
+    ResizeCubicTest<uint8_t, 4>(360, 540, 720, 1080, 1.01f);
+    ResizeCubicTest<uint8_t, 4>(720, 1080, 360, 540, 1.01f);
+    ResizeCubicTest<uint8_t, 4>(360, 540, 640, 480, 1.01f);
+    ResizeCubicTest<uint8_t, 4>(101, 99, 37, 203, 1.01f);
+}
+
+TEST(RESIZE_LANCZOS_FP32, x86)
+{
+    ResizeLanczosTest<float, 1>(240, 320, 1e-2f);
+    ResizeLanczosTest<float, 1>(99, 101, 1e-2f);
+    ResizeLanczosTest<float, 3>(240, 320, 1e-2f);
+    ResizeLanczosTest<float, 3>(99, 101, 1e-2f);
+    ResizeLanczosTest<float, 4>(240, 320, 1e-2f);
+    ResizeLanczosTest<float, 4>(99, 101, 1e-2f);
+
+    ResizeLanczosFlatTest<float, 1>(1080, 1920, 135, 240, 3, 1e-3f);
+    ResizeLanczosFlatTest<float, 3>(720, 1080, 203, 37, 3, 1e-3f);
+    ResizeLanczosFlatTest<float, 4>(360, 540, 640, 480, 2, 1e-3f);
+}
+
+TEST(RESIZE_LANCZOS_UINT8, x86)
+{
+    ResizeLanczosTest<uint8_t, 1>(240, 320, 1.01f);
+    ResizeLanczosTest<uint8_t, 1>(99, 101, 1.01f);
+    ResizeLanczosTest<uint8_t, 3>(240, 320, 1.01f);
+    ResizeLanczosTest<uint8_t, 3>(99, 101, 1.01f);
+    ResizeLanczosTest<uint8_t, 4>(240, 320, 1.01f);
+    ResizeLanczosTest<uint8_t, 4>(99, 101, 1.01f);
+
+    ResizeLanczosFlatTest<uint8_t, 1>(1080, 1920, 135, 240, 3, 0.01f);
+    ResizeLanczosFlatTest<uint8_t, 3>(720, 1080, 203, 37, 3, 0.01f);
+    ResizeLanczosFlatTest<uint8_t, 4>(360, 540, 640, 480, 2, 0.01f);
+}
+
+template <typename T, int32_t nc>
+void ResizeLinearRegionTest(int32_t inHeight, int32_t inWidth, int32_t outHeight, int32_t outWidth, int32_t tileHeight, int32_t tileWidth, float diff)
+{
+    std::unique_ptr<T[]> src(new T[inWidth * inHeight * nc]);
+    std::unique_ptr<T[]> dst_ref(new T[outWidth * outHeight * nc]);
+    std::unique_ptr<T[]> dst(new T[outWidth * outHeight * nc]);
+    std::unique_ptr<T[]> dst_tiled(new T[outWidth * outHeight * nc]);
+    tinycv::debug::randomFill<T>(src.get(), inWidth * inHeight * nc, 0, 255);
+
+    cv::Mat src_opencv(inHeight, inWidth, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get(), sizeof(T) * inWidth * nc);
+    cv::Mat dst_opencv(outHeight, outWidth, CV_MAKETYPE(cv::DataType<T>::depth, nc), dst_ref.get(), sizeof(T) * outWidth * nc);
+
+    cv::resize(src_opencv, dst_opencv, cv::Size(outWidth, outHeight), cv::INTER_LINEAR);
+    double scaleY = tinycv::ResizeLinearScale(inHeight, outHeight);
+    double scaleX = tinycv::ResizeLinearScale(inWidth, outWidth);
+    tinycv::ResizeLinearRegion<T, nc>(inHeight, inWidth, inWidth * nc, src.get(), outHeight, outWidth, outWidth * nc, dst.get(), scaleY, scaleX);
+
+    checkResult<T, nc>(dst_ref.get(), dst.get(), outHeight, outWidth, outWidth * nc, outWidth * nc, diff);
+
+    // the tiles have to reassemble bit exactly, also with a sub-pixel origin pushing samples over the border
+    const double origins[][2] = {{0.0, 0.0}, {0.37, -1.6}};
+    for (const auto &origin : origins) {
+        tinycv::ResizeLinearRegion<T, nc>(inHeight, inWidth, inWidth * nc, src.get(), outHeight, outWidth, outWidth * nc, dst.get(), scaleY, scaleX, origin[0], origin[1]);
+        for (int32_t y = 0; y < outHeight; y += tileHeight) {
+            for (int32_t x = 0; x < outWidth; x += tileWidth) {
+                tinycv::ResizeLinearRegion<T, nc>(inHeight, inWidth, inWidth * nc, src.get(), std::min(tileHeight, outHeight - y), std::min(tileWidth, outWidth - x), outWidth * nc, dst_tiled.get() + y * outWidth * nc + x * nc, scaleY, scaleX, origin[0], origin[1], y, x);
+            }
+        }
+        EXPECT_EQ(0, memcmp(dst.get(), dst_tiled.get(), sizeof(T) * outWidth * outHeight * nc));
+    }
+}
+
+template <typename T, int32_t nc>
+void ResizeLinearShiftTest(int32_t height, int32_t width, int32_t shiftY, int32_t shiftX)
+{
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<T[]> dst(new T[width * height * nc]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, 0, 255);
+
+    // unit scale and an integer origin sample exactly on source pixels, clamped at the border
+    tinycv::ResizeLinearRegion<T, nc>(height, width, width * nc, src.get(), height, width, width * nc, dst.get(), 1.0, 1.0, shiftY, shiftX);
+    int32_t mismatch = 0;
+    for (int32_t y = 0; y < height; ++y) {
+        int32_t sy = std::min(std::max(y + shiftY, 0), height - 1);
+        for (int32_t x = 0; x < width; ++x) {
+            int32_t sx = std::min(std::max(x + shiftX, 0), width - 1);
+            mismatch += memcmp(dst.get() + (y * width + x) * nc, src.get() + (sy * width + sx) * nc, sizeof(T) * nc) != 0;
+        }
+    }
+    EXPECT_EQ(0, mismatch);
+}
+
+TEST(RESIZE_LINEAR_REGION_FP32, x86)
+{
+    ResizeLinearRegionTest<float, 1>(360, 540, 720, 1080, 64, 100, 1);
+    ResizeLinearRegionTest<float, 1>(720, 1080, 360, 540, 37, 53, 1);
+    ResizeLinearRegionTest<float, 3>(640, 480, 360, 540, 50, 77, 1);
+    ResizeLinearRegionTest<float, 4>(724, 1076, 181, 269, 16, 16, 1);
+
+    ResizeLinearShiftTest<float, 1>(99, 101, 7, -12);
+    ResizeLinearShiftTest<float, 3>(99, 101, -150, 3);
+}
+
+TEST(RESIZE_LINEAR_REGION_UINT8, x86)
+{
+    ResizeLinearRegionTest<uint8_t, 1>(360, 540, 720, 1080, 64, 100, 1.01f);
+    ResizeLinearRegionTest<uint8_t, 1>(720, 1080, 360, 540, 37, 53, 1.01f);
+    ResizeLinearRegionTest<uint8_t, 3>(640, 480, 360, 540, 50, 77, 1.01f);
+    ResizeLinearRegionTest<uint8_t, 4>(724, 1076, 181, 269, 16, 16, 1.01f);
+
+    ResizeLinearShiftTest<uint8_t, 1>(99, 101, 7, -12);
+    ResizeLinearShiftTest<uint8_t, 4>(99, 101, -150, 3);
+}
+
+TEST(RESIZE_LINEAR_REGION_UINT16, x86)
+{
+    ResizeLinearRegionTest<uint16_t, 1>(360, 540, 720, 1080, 64, 100, 1.01f);
+    ResizeLinearRegionTest<uint16_t, 3>(720, 1080, 360, 540, 37, 53, 1.01f);
+    ResizeLinearShiftTest<uint16_t, 1>(99, 101, 7, -12);
 }
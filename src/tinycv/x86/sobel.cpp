@@ -0,0 +1,584 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/x86/sobel.hpp"
+#include "tinycv/types.h"
+#include "tinycv/sys.h"
+
+#include <string.h>
+#include <math.h>
+#include <immintrin.h>
+
+namespace tinycv {
+
+// all border modes, also valid far outside the image, -1 for BORDER_CONSTANT
+static inline int32_t deriv_border_interpolate(int32_t p, int32_t len, BorderType border_type)
+{
+    if ((uint32_t)p < (uint32_t)len) {
+        return p;
+    }
+    if (border_type == BORDER_REPLICATE) {
+        p = p < 0 ? 0 : len - 1;
+    } else if (border_type == BORDER_REFLECT || border_type == BORDER_REFLECT_101) {
+        int32_t delta = border_type == BORDER_REFLECT_101;
+        if (len == 1) {
+            return 0;
+        }
+        do {
+            if (p < 0) {
+                p = -p - 1 + delta;
+            } else {
+                p = len - 1 - (p - len) - delta;
+            }
+        } while ((uint32_t)p >= (uint32_t)len);
+    } else {
+        p = -1;
+    }
+    return p;
+}
+
+static inline bool deriv_valid_border(BorderType border_type)
+{
+    return border_type == BORDER_CONSTANT || border_type == BORDER_REPLICATE ||
+           border_type == BORDER_REFLECT || border_type == BORDER_REFLECT_101;
+}
+
+// same as OpenCV's getSobelKernels, binomial smoothing convolved with `order` differences. ksize 1 is a 3 tap
+// difference without smoothing, or a single tap without derivative.
+static void sobel_kernel(int32_t order, int32_t ksize, DerivKernel &kernel)
+{
+    if (ksize == 1 && order > 0) {
+        ksize = 3;
+    }
+    int32_t k[DERIV_MAX_KSIZE + 1] = {1};
+    for (int32_t i = 0; i < ksize - order - 1; ++i) {
+        int32_t oldval = k[0];
+        for (int32_t j = 1; j <= ksize; ++j) {
+            int32_t newval = k[j] + k[j - 1];
+            k[j - 1] = oldval;
+            oldval = newval;
+        }
+    }
+    for (int32_t i = 0; i < order; ++i) {
+        int32_t oldval = -k[0];
+        for (int32_t j = 1; j <= ksize; ++j) {
+            int32_t newval = k[j - 1] - k[j];
+            k[j - 1] = oldval;
+            oldval = newval;
+        }
+    }
+    kernel.size = ksize;
+    memcpy(kernel.taps, k, ksize * sizeof(int32_t));
+}
+
+static void scharr_kernel(int32_t order, DerivKernel &kernel)
+{
+    static const int32_t smooth[3] = {3, 10, 3};
+    static const int32_t diff[3] = {-1, 0, 1};
+    kernel.size = 3;
+    memcpy(kernel.taps, order == 0 ? smooth : diff, sizeof(smooth));
+}
+
+// dst[i] = sum over k of kernel[k] * rows[k][i], the sums of uint8_t rows fit in int16_t for kernels up to 7 taps
+static void deriv_cols(const uint8_t *const *rows, const int32_t *kernel, int32_t ksize, int32_t n, int16_t *dst)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int32_t i = 0;
+    for (; i <= n - 16; i += 16) {
+        __m128i lo = zero, hi = zero;
+        for (int32_t k = 0; k < ksize; ++k) {
+            if (kernel[k] == 0) {
+                continue;
+            }
+            __m128i v = _mm_loadu_si128((const __m128i *)(rows[k] + i));
+            __m128i c = _mm_set1_epi16((int16_t)kernel[k]);
+            lo = _mm_add_epi16(lo, _mm_mullo_epi16(_mm_unpacklo_epi8(v, zero), c));
+            hi = _mm_add_epi16(hi, _mm_mullo_epi16(_mm_unpackhi_epi8(v, zero), c));
+        }
+        _mm_storeu_si128((__m128i *)(dst + i), lo);
+        _mm_storeu_si128((__m128i *)(dst + i + 8), hi);
+    }
+    for (; i < n; ++i) {
+        int32_t s = 0;
+        for (int32_t k = 0; k < ksize; ++k) {
+            s += kernel[k] * rows[k][i];
+        }
+        dst[i] = (int16_t)s;
+    }
+}
+
+static void deriv_cols(const float *const *rows, const int32_t *kernel, int32_t ksize, int32_t n, float *dst)
+{
+    int32_t i = 0;
+    for (; i <= n - 8; i += 8) {
+        __m128 lo = _mm_setzero_ps(), hi = _mm_setzero_ps();
+        for (int32_t k = 0; k < ksize; ++k) {
+            if (kernel[k] == 0) {
+                continue;
+            }
+            __m128 c = _mm_set1_ps((float)kernel[k]);
+            lo = _mm_add_ps(lo, _mm_mul_ps(_mm_loadu_ps(rows[k] + i), c));
+            hi = _mm_add_ps(hi, _mm_mul_ps(_mm_loadu_ps(rows[k] + i + 4), c));
+        }
+        _mm_storeu_ps(dst + i, lo);
+        _mm_storeu_ps(dst + i + 4, hi);
+    }
+    for (; i < n; ++i) {
+        float s = 0;
+        for (int32_t k = 0; k < ksize; ++k) {
+            if (kernel[k] != 0) {
+                s += (float)kernel[k] * rows[k][i];
+            }
+        }
+        dst[i] = s;
+    }
+}
+
+// integer sums to the output type, exact when the scale is 1 and there is no delta
+static inline void deriv_store(__m128i lo, __m128i hi, bool identity, __m128 scale, __m128 delta, int16_t *dst)
+{
+    if (!identity) {
+        lo = _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(lo), scale), delta));
+        hi = _mm_cvtps_epi32(_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(hi), scale), delta));
+    }
+    _mm_storeu_si128((__m128i *)dst, _mm_packs_epi32(lo, hi));
+}
+
+static inline void deriv_store(__m128i lo, __m128i hi, bool, __m128 scale, __m128 delta, float *dst)
+{
+    _mm_storeu_ps(dst, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(lo), scale), delta));
+    _mm_storeu_ps(dst + 4, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(hi), scale), delta));
+}
+
+static inline void deriv_store(int32_t v, bool identity, float scale, float delta, int16_t *dst)
+{
+    if (!identity) {
+        v = (int32_t)lrintf((float)v * scale + delta);
+    }
+    *dst = (int16_t)(v < -32768 ? -32768 : (v > 32767 ? 32767 : v));
+}
+
+static inline void deriv_store(int32_t v, bool, float scale, float delta, float *dst)
+{
+    *dst = (float)v * scale + delta;
+}
+
+// horizontal pass over a padded row of vertical sums, taps are multiplied and added in pairs by madd
+template <typename Tdst>
+static void deriv_row(const int16_t *src, const int32_t *kernel, int32_t ksize, int32_t cn, int32_t n, float scale, float delta, Tdst *dst)
+{
+    const bool identity = scale == 1.0f && delta == 0.0f;
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 vdelta = _mm_set1_ps(delta);
+    const __m128i zero = _mm_setzero_si128();
+    int32_t pairs[4];
+    for (int32_t k = 0; k < ksize; k += 2) {
+        uint32_t next = k + 1 < ksize ? (uint32_t)kernel[k + 1] : 0;
+        pairs[k / 2] = (int32_t)(((uint32_t)kernel[k] & 0xffff) | (next << 16));
+    }
+    int32_t i = 0;
+    for (; i <= n - 8; i += 8) {
+        __m128i lo = zero, hi = zero;
+        for (int32_t k = 0; k < ksize; k += 2) {
+            __m128i a = _mm_loadu_si128((const __m128i *)(src + i + k * cn));
+            __m128i b = k + 1 < ksize ? _mm_loadu_si128((const __m128i *)(src + i + (k + 1) * cn)) : zero;
+            __m128i c = _mm_set1_epi32(pairs[k / 2]);
+            lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), c));
+            hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), c));
+        }
+        deriv_store(lo, hi, identity, vscale, vdelta, dst + i);
+    }
+    for (; i < n; ++i) {
+        int32_t s = 0;
+        for (int32_t k = 0; k < ksize; ++k) {
+            s += kernel[k] * src[i + k * cn];
+        }
+        deriv_store(s, identity, scale, delta, dst + i);
+    }
+}
+
+static void deriv_row(const float *src, const int32_t *kernel, int32_t ksize, int32_t cn, int32_t n, float scale, float delta, float *dst)
+{
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 vdelta = _mm_set1_ps(delta);
+    int32_t i = 0;
+    for (; i <= n - 8; i += 8) {
+        __m128 lo = _mm_setzero_ps(), hi = _mm_setzero_ps();
+        for (int32_t k = 0; k < ksize; ++k) {
+            if (kernel[k] == 0) {
+                continue;
+            }
+            __m128 c = _mm_set1_ps((float)kernel[k]);
+            lo = _mm_add_ps(lo, _mm_mul_ps(_mm_loadu_ps(src + i + k * cn), c));
+            hi = _mm_add_ps(hi, _mm_mul_ps(_mm_loadu_ps(src + i + k * cn + 4), c));
+        }
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_mul_ps(lo, vscale), vdelta));
+        _mm_storeu_ps(dst + i + 4, _mm_add_ps(_mm_mul_ps(hi, vscale), vdelta));
+    }
+    for (; i < n; ++i) {
+        float s = 0;
+        for (int32_t k = 0; k < ksize; ++k) {
+            if (kernel[k] != 0) {
+                s += (float)kernel[k] * src[i + k * cn];
+            }
+        }
+        dst[i] = s * scale + delta;
+    }
+}
+
+// the zero row, the source rows, the border columns and the padded row, in this order
+template <typename Tsrc, typename Tdst, int32_t channels>
+uint64_t DerivRowFilter<Tsrc, Tdst, channels>::BufferSize(int32_t height, int32_t width, const DerivKernel &kernelX, const DerivKernel &kernelY)
+{
+    uint64_t size_for_zero_row = ((uint64_t)width * channels * sizeof(Tsrc) + 64 - 1) / 64 * 64;
+    uint64_t size_for_rows = ((uint64_t)(height + kernelY.size - 1) * sizeof(const Tsrc *) + 64 - 1) / 64 * 64;
+    uint64_t size_for_border_cols = ((uint64_t)kernelX.size * 2 * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    uint64_t size_for_padded = ((uint64_t)(width + kernelX.size - 1) * channels * sizeof(B) + 64 - 1) / 64 * 64;
+    return size_for_zero_row + size_for_rows + size_for_border_cols + size_for_padded;
+}
+
+template <typename Tsrc, typename Tdst, int32_t channels>
+DerivRowFilter<Tsrc, Tdst, channels>::DerivRowFilter(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const Tsrc *inData,
+    const DerivKernel &kernelX,
+    const DerivKernel &kernelY,
+    float scale,
+    float delta,
+    BorderType border_type,
+    void *buffer)
+    : width(width), kernelX(kernelX), kernelY(kernelY), scale(scale), delta(delta)
+{
+    const int32_t ksizeX = kernelX.size;
+    const int32_t ksizeY = kernelY.size;
+    const int32_t anchorX = ksizeX / 2;
+    const int32_t anchorY = ksizeY / 2;
+
+    uint64_t size_for_zero_row = ((uint64_t)width * channels * sizeof(Tsrc) + 64 - 1) / 64 * 64;
+    uint64_t size_for_rows = ((uint64_t)(height + ksizeY - 1) * sizeof(const Tsrc *) + 64 - 1) / 64 * 64;
+    uint64_t size_for_border_cols = ((uint64_t)ksizeX * 2 * sizeof(int32_t) + 64 - 1) / 64 * 64;
+    Tsrc *zeroRow = (Tsrc *)buffer;
+    rows = (const Tsrc **)((unsigned char *)zeroRow + size_for_zero_row);
+    borderCols = (int32_t *)((unsigned char *)rows + size_for_rows);
+    padded = (B *)((unsigned char *)borderCols + size_for_border_cols);
+
+    if (border_type == BORDER_CONSTANT) {
+        memset(zeroRow, 0, width * channels * sizeof(Tsrc));
+    }
+    for (int32_t p = 0; p < height + ksizeY - 1; ++p) {
+        int32_t sy = deriv_border_interpolate(p - anchorY, height, border_type);
+        rows[p] = sy < 0 ? zeroRow : inData + (size_t)sy * inWidthStride;
+    }
+    numBorderCols = 0;
+    for (int32_t p = 0; p < width + ksizeX - 1; ++p) {
+        if (p < anchorX || p >= anchorX + width) {
+            borderCols[numBorderCols++] = p;
+            borderCols[numBorderCols++] = deriv_border_interpolate(p - anchorX, width, border_type);
+        }
+    }
+}
+
+template <typename Tsrc, typename Tdst, int32_t channels>
+void DerivRowFilter<Tsrc, Tdst, channels>::operator()(int32_t y, Tdst *dst)
+{
+    const int32_t n = width * channels;
+    const int32_t ksizeX = kernelX.size;
+    B *center = padded + ksizeX / 2 * channels;
+    deriv_cols(rows + y, kernelY.taps, kernelY.size, n, center);
+    for (int32_t b = 0; b < numBorderCols; b += 2) {
+        B *pad = padded + borderCols[b] * channels;
+        int32_t sx = borderCols[b + 1];
+        for (int32_t c = 0; c < channels; ++c) {
+            pad[c] = sx < 0 ? 0 : center[sx * channels + c];
+        }
+    }
+    deriv_row(padded, kernelX.taps, ksizeX, channels, n, scale, delta, dst);
+}
+
+bool DerivKernels(int32_t dx, int32_t dy, int32_t ksize, DerivKernel &kernelX, DerivKernel &kernelY)
+{
+    if (dx < 0 || dy < 0 || dx + dy <= 0) {
+        return false;
+    }
+    if (ksize == -1) {
+        if (dx + dy != 1) {
+            return false;
+        }
+        scharr_kernel(dx, kernelX);
+        scharr_kernel(dy, kernelY);
+        return true;
+    }
+    if (ksize != 1 && ksize != 3 && ksize != 5 && ksize != 7) {
+        return false;
+    }
+    int32_t maxOrder = ksize == 1 ? 2 : ksize - 1;
+    if (dx > maxOrder || dy > maxOrder) {
+        return false;
+    }
+    sobel_kernel(dx, ksize, kernelX);
+    sobel_kernel(dy, ksize, kernelY);
+    return true;
+}
+
+template <typename Tsrc, typename Tdst, int32_t channels>
+void Sobel(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const Tsrc *inData,
+    int32_t outWidthStride,
+    Tdst *outData,
+    int32_t dx,
+    int32_t dy,
+    int32_t ksize,
+    float scale,
+    float delta,
+    BorderType border_type)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * channels || outWidthStride < width * channels) {
+        return;
+    }
+    if (!deriv_valid_border(border_type)) {
+        return;
+    }
+    DerivKernel kernelX, kernelY;
+    if (!DerivKernels(dx, dy, ksize, kernelX, kernelY)) {
+        return;
+    }
+    typedef DerivRowFilter<Tsrc, Tdst, channels> Filter;
+    void *temp_buffer = tinycv::ScratchAlloc(Filter::BufferSize(height, width, kernelX, kernelY), 64);
+    Filter filter(height, width, inWidthStride, inData, kernelX, kernelY, scale, delta, border_type, temp_buffer);
+    for (int32_t y = 0; y < height; ++y) {
+        filter(y, outData + (size_t)y * outWidthStride);
+    }
+    tinycv::ScratchFree(temp_buffer);
+}
+
+template <typename Tsrc, typename Tdst, int32_t channels>
+void Scharr(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const Tsrc *inData,
+    int32_t outWidthStride,
+    Tdst *outData,
+    int32_t dx,
+    int32_t dy,
+    float scale,
+    float delta,
+    BorderType border_type)
+{
+    Sobel<Tsrc, Tdst, channels>(height, width, inWidthStride, inData, outWidthStride, outData, dx, dy, -1, scale, delta, border_type);
+}
+
+// a bin boundary at angle theta, tested by the sign of cross(direction, gradient) on the gradient folded into the
+// upper half plane. The direction is theta folded the same way, `mode` merges the test with the fold: 0 the test
+// alone, 1 a boundary below 180 degrees passed by every folded gradient, 2 one above passed by folded ones only.
+struct OrientationBoundary {
+    float cosine;
+    float sine;
+    int32_t mode;
+};
+
+static void orientation_boundaries(int32_t numBins, bool signedGradient, OrientationBoundary *bounds)
+{
+    const double pi = 3.14159265358979323846;
+    const double range = signedGradient ? 2 * pi : pi;
+    for (int32_t k = 1; k < numBins; ++k) {
+        double theta = range * k / numBins;
+        OrientationBoundary &b = bounds[k - 1];
+        b.mode = signedGradient ? (theta < pi ? 1 : 2) : 0;
+        if (theta >= pi) {
+            theta -= pi;
+        }
+        b.cosine = (float)cos(theta);
+        b.sine = (float)sin(theta);
+    }
+}
+
+static inline uint8_t orientation_bin(float gx, float gy, const OrientationBoundary *bounds, int32_t numBounds)
+{
+    if (gx == 0 && gy == 0) {
+        return 0;
+    }
+    bool lower = gy < 0 || (gy == 0 && gx < 0);
+    if (lower) {
+        gx = -gx;
+        gy = -gy;
+    }
+    int32_t bin = 0;
+    for (int32_t k = 0; k < numBounds; ++k) {
+        float cross = bounds[k].cosine * gy - bounds[k].sine * gx;
+        bool pass = cross >= 0;
+        pass = bounds[k].mode == 1 ? (pass || lower) : (bounds[k].mode == 2 ? (pass && lower) : pass);
+        bin += pass;
+    }
+    return (uint8_t)bin;
+}
+
+// bins of 4 gradients, the count of boundaries passed
+static inline __m128i orientation_bins(__m128 gx, __m128 gy, const OrientationBoundary *bounds, int32_t numBounds)
+{
+    const __m128 zero = _mm_setzero_ps();
+    __m128 lower = _mm_or_ps(_mm_cmplt_ps(gy, zero), _mm_and_ps(_mm_cmpeq_ps(gy, zero), _mm_cmplt_ps(gx, zero)));
+    __m128 nonzero = _mm_or_ps(_mm_cmpneq_ps(gx, zero), _mm_cmpneq_ps(gy, zero));
+    __m128 flip = _mm_and_ps(lower, _mm_set1_ps(-0.0f));
+    gx = _mm_xor_ps(gx, flip);
+    gy = _mm_xor_ps(gy, flip);
+    __m128i bin = _mm_setzero_si128();
+    for (int32_t k = 0; k < numBounds; ++k) {
+        __m128 cross = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(bounds[k].cosine), gy), _mm_mul_ps(_mm_set1_ps(bounds[k].sine), gx));
+        __m128 pass = _mm_cmpge_ps(cross, zero);
+        if (bounds[k].mode == 1) {
+            pass = _mm_or_ps(pass, lower);
+        } else if (bounds[k].mode == 2) {
+            pass = _mm_and_ps(pass, lower);
+        }
+        bin = _mm_sub_epi32(bin, _mm_castps_si128(pass));
+    }
+    return _mm_and_si128(bin, _mm_castps_si128(nonzero));
+}
+
+void SobelMagnitudeOrientation(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t magWidthStride,
+    float *magnitude,
+    int32_t binWidthStride,
+    uint8_t *bins,
+    int32_t numBins,
+    bool signedGradient,
+    BorderType border_type)
+{
+    if (nullptr == inData || nullptr == magnitude || nullptr == bins) {
+        return;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width || magWidthStride < width || binWidthStride < width) {
+        return;
+    }
+    if (numBins < 1 || numBins > 255 || !deriv_valid_border(border_type)) {
+        return;
+    }
+    //! the three rows of the kernel padded by one pixel, a ring indexed by padded row number
+    const int32_t length = width + 2;
+    const int32_t numBounds = numBins - 1;
+    uint64_t size_for_bounds = ((uint64_t)numBounds * sizeof(OrientationBoundary) + 64 - 1) / 64 * 64;
+    uint64_t size_for_ring = ((uint64_t)4 * length + 64 - 1) / 64 * 64;
+
+    void *temp_buffer = tinycv::ScratchAlloc(size_for_bounds + size_for_ring, 64);
+    OrientationBoundary *bounds = (OrientationBoundary *)temp_buffer;
+    uint8_t *ring = (uint8_t *)bounds + size_for_bounds;
+    orientation_boundaries(numBins, signedGradient, bounds);
+
+    uint8_t *zeroRow = ring + (size_t)3 * length;
+    memset(zeroRow, 0, length);
+    int32_t left = deriv_border_interpolate(-1, width, border_type);
+    int32_t right = deriv_border_interpolate(width, width, border_type);
+    const uint8_t *rows[3];
+    for (int32_t p = 0; p < height + 2; ++p) {
+        int32_t sy = deriv_border_interpolate(p - 1, height, border_type);
+        const uint8_t *prow = zeroRow;
+        if (sy >= 0) {
+            uint8_t *dst = ring + (size_t)(p % 3) * length;
+            const uint8_t *src = inData + (size_t)sy * inWidthStride;
+            memcpy(dst + 1, src, width);
+            dst[0] = left < 0 ? 0 : src[left];
+            dst[width + 1] = right < 0 ? 0 : src[right];
+            prow = dst;
+        }
+        rows[p % 3] = prow;
+        if (p < 2) {
+            continue;
+        }
+
+        int32_t y = p - 2;
+        const uint8_t *r0 = rows[y % 3];
+        const uint8_t *r1 = rows[(y + 1) % 3];
+        const uint8_t *r2 = rows[(y + 2) % 3];
+        float *mag = magnitude + (size_t)y * magWidthStride;
+        uint8_t *bin = bins + (size_t)y * binWidthStride;
+        int32_t x = 0;
+        for (; x <= width - 8; x += 8) {
+            __m128i a0 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(r0 + x)));
+            __m128i a1 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(r0 + x + 1)));
+            __m128i a2 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(r0 + x + 2)));
+            __m128i b0 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(r1 + x)));
+            __m128i b2 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(r1 + x + 2)));
+            __m128i c0 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(r2 + x)));
+            __m128i c1 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(r2 + x + 1)));
+            __m128i c2 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *)(r2 + x + 2)));
+            __m128i gx = _mm_add_epi16(_mm_add_epi16(_mm_sub_epi16(a2, a0), _mm_sub_epi16(c2, c0)), _mm_slli_epi16(_mm_sub_epi16(b2, b0), 1));
+            __m128i gy = _mm_add_epi16(_mm_add_epi16(_mm_sub_epi16(c0, a0), _mm_sub_epi16(c2, a2)), _mm_slli_epi16(_mm_sub_epi16(c1, a1), 1));
+            __m128 gxl = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(gx));
+            __m128 gxh = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(gx, 8)));
+            __m128 gyl = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(gy));
+            __m128 gyh = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(gy, 8)));
+            _mm_storeu_ps(mag + x, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(gxl, gxl), _mm_mul_ps(gyl, gyl))));
+            _mm_storeu_ps(mag + x + 4, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(gxh, gxh), _mm_mul_ps(gyh, gyh))));
+            __m128i bl = orientation_bins(gxl, gyl, bounds, numBounds);
+            __m128i bh = orientation_bins(gxh, gyh, bounds, numBounds);
+            __m128i b16 = _mm_packs_epi32(bl, bh);
+            _mm_storel_epi64((__m128i *)(bin + x), _mm_packus_epi16(b16, b16));
+        }
+        for (; x < width; ++x) {
+            int32_t gx = (r0[x + 2] - r0[x]) + 2 * (r1[x + 2] - r1[x]) + (r2[x + 2] - r2[x]);
+            int32_t gy = (r2[x] + 2 * r2[x + 1] + r2[x + 2]) - (r0[x] + 2 * r0[x + 1] + r0[x + 2]);
+            mag[x] = sqrtf((float)(gx * gx + gy * gy));
+            bin[x] = orientation_bin((float)gx, (float)gy, bounds, numBounds);
+        }
+    }
+    tinycv::ScratchFree(temp_buffer);
+}
+
+template struct DerivRowFilter<uint8_t, int16_t, 1>;
+template struct DerivRowFilter<uint8_t, int16_t, 3>;
+template struct DerivRowFilter<uint8_t, int16_t, 4>;
+template struct DerivRowFilter<uint8_t, float, 1>;
+template struct DerivRowFilter<uint8_t, float, 3>;
+template struct DerivRowFilter<uint8_t, float, 4>;
+template struct DerivRowFilter<float, float, 1>;
+template struct DerivRowFilter<float, float, 3>;
+template struct DerivRowFilter<float, float, 4>;
+
+template void Sobel<uint8_t, int16_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int16_t *outData, int32_t dx, int32_t dy, int32_t ksize, float scale, float delta, BorderType border_type);
+template void Sobel<uint8_t, int16_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int16_t *outData, int32_t dx, int32_t dy, int32_t ksize, float scale, float delta, BorderType border_type);
+template void Sobel<uint8_t, int16_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int16_t *outData, int32_t dx, int32_t dy, int32_t ksize, float scale, float delta, BorderType border_type);
+template void Sobel<uint8_t, float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, float *outData, int32_t dx, int32_t dy, int32_t ksize, float scale, float delta, BorderType border_type);
+template void Sobel<uint8_t, float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, float *outData, int32_t dx, int32_t dy, int32_t ksize, float scale, float delta, BorderType border_type);
+template void Sobel<uint8_t, float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, float *outData, int32_t dx, int32_t dy, int32_t ksize, float scale, float delta, BorderType border_type);
+template void Sobel<float, float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t dx, int32_t dy, int32_t ksize, float scale, float delta, BorderType border_type);
+template void Sobel<float, float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t dx, int32_t dy, int32_t ksize, float scale, float delta, BorderType border_type);
+template void Sobel<float, float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t dx, int32_t dy, int32_t ksize, float scale, float delta, BorderType border_type);
+
+template void Scharr<uint8_t, int16_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int16_t *outData, int32_t dx, int32_t dy, float scale, float delta, BorderType border_type);
+template void Scharr<uint8_t, int16_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int16_t *outData, int32_t dx, int32_t dy, float scale, float delta, BorderType border_type);
+template void Scharr<uint8_t, int16_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, int16_t *outData, int32_t dx, int32_t dy, float scale, float delta, BorderType border_type);
+template void Scharr<uint8_t, float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, float *outData, int32_t dx, int32_t dy, float scale, float delta, BorderType border_type);
+template void Scharr<uint8_t, float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, float *outData, int32_t dx, int32_t dy, float scale, float delta, BorderType border_type);
+template void Scharr<uint8_t, float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, float *outData, int32_t dx, int32_t dy, float scale, float delta, BorderType border_type);
+template void Scharr<float, float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t dx, int32_t dy, float scale, float delta, BorderType border_type);
+template void Scharr<float, float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t dx, int32_t dy, float scale, float delta, BorderType border_type);
+template void Scharr<float, float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, int32_t dx, int32_t dy, float scale, float delta, BorderType border_type);
+
+} // namespace tinycv
@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_X86_SOBEL_HPP_
+#define __ST_TINYCV_X86_SOBEL_HPP_
+
+#include "tinycv/sobel.h"
+
+namespace tinycv {
+
+// vertical pass results, exact integers for uint8_t input
+template <typename T>
+struct DerivBuf;
+
+template <>
+struct DerivBuf<uint8_t> {
+    typedef int16_t type;
+};
+
+template <>
+struct DerivBuf<float> {
+    typedef float type;
+};
+
+#define DERIV_MAX_KSIZE 7
+
+// taps of one direction of a separable derivative kernel
+struct DerivKernel {
+    int32_t size;
+    int32_t taps[DERIV_MAX_KSIZE];
+};
+
+// Kernels of `Sobel`, `ksize == -1` for Scharr. Returns false for orders and sizes `Sobel` does not support.
+bool DerivKernels(int32_t dx, int32_t dy, int32_t ksize, DerivKernel &kernelX, DerivKernel &kernelY);
+
+// One separable derivative computed row by row: the vertical pass of an output row goes to a padded row buffer,
+// its horizontal border is filled from the image columns it replicates, then the horizontal pass writes the row.
+// Output rows do not depend on each other, so they can be produced in any order and by several filters at once.
+// The tables and the row buffer live in `buffer`, `BufferSize` bytes aligned to 64 that the caller owns.
+template <typename Tsrc, typename Tdst, int32_t channels>
+struct DerivRowFilter {
+    typedef typename DerivBuf<Tsrc>::type B;
+
+    static uint64_t BufferSize(int32_t height, int32_t width, const DerivKernel &kernelX, const DerivKernel &kernelY);
+    DerivRowFilter(
+        int32_t height,
+        int32_t width,
+        int32_t inWidthStride,
+        const Tsrc *inData,
+        const DerivKernel &kernelX,
+        const DerivKernel &kernelY,
+        float scale,
+        float delta,
+        BorderType border_type,
+        void *buffer);
+    void operator()(int32_t y, Tdst *dst);
+
+    int32_t width;
+    DerivKernel kernelX, kernelY;
+    float scale, delta;
+    const Tsrc **rows; //!< source rows by padded row number, border rows included
+    int32_t *borderCols; //!< pairs of padded column and the source column it takes, -1 for zeros
+    int32_t numBorderCols;
+    B *padded;
+};
+
+} // namespace tinycv
+
+#endif //! __ST_TINYCV_X86_SOBEL_HPP_
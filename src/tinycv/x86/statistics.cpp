@@ -0,0 +1,617 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/statistics.h"
+#include "tinycv/sys.h"
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <limits>
+#include <immintrin.h>
+
+#define STAT_MIN_BAND_PIXELS (1 << 16)
+#define STAT_FLUSH_STEPS 256 //! 16 bit lanes may wrap after 257 bytes are added
+
+namespace tinycv {
+
+// sums of a band of rows, per channel
+struct StatSums {
+    double sum[4];
+    double sqsum[4];
+    int64_t count;
+};
+
+// shuffle spreading the mask bytes of 16 pixels over the j-th of the `channels` vectors holding them,
+// `lanes` elements of `16 / lanes` bytes per vector
+template <int32_t channels, int32_t lanes>
+static inline __m128i stat_mask_shuffle(int32_t j)
+{
+    uint8_t t[16];
+    for (int32_t k = 0; k < 16; ++k) {
+        t[k] = (uint8_t)((lanes * j + k / (16 / lanes)) / channels);
+    }
+    return _mm_loadu_si128((const __m128i *)t);
+}
+
+// u8 sums of rows [y0, y1): one channel is summed with sad, several in 16 bit lanes, squares in 32 bit lanes,
+// lanes are flushed to 64 bit sums per element position of the 16 pixels before they may wrap
+template <int32_t channels, bool squares>
+static void stat_sums(
+    int32_t y0,
+    int32_t y1,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    StatSums &s)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i shuffle[channels];
+    for (int32_t j = 0; j < channels; ++j) {
+        shuffle[j] = stat_mask_shuffle<channels, 16>(j);
+    }
+    const __m128i one = _mm_set1_epi8(1);
+    __m128i masked = zero; //! pixels under the mask counted with sad
+    int64_t pos[16 * channels] = {0}, posSq[16 * channels] = {0};
+    int64_t count = 0;
+    for (int32_t y = y0; y < y1; ++y) {
+        const uint8_t *src = inData + (size_t)y * inWidthStride;
+        const uint8_t *m = nullptr != mask ? mask + (size_t)y * maskWidthStride : nullptr;
+        int32_t x = 0;
+        while (x <= width - 16) {
+            __m128i acc[2 * channels], accSq[4 * channels];
+            for (int32_t k = 0; k < 2 * channels; ++k) {
+                acc[k] = zero;
+            }
+            for (int32_t k = 0; k < 4 * channels; ++k) {
+                accSq[k] = zero;
+            }
+            int32_t end = std::min(width - 16, x + 16 * (STAT_FLUSH_STEPS - 1));
+            for (; x <= end; x += 16) {
+                __m128i off = zero;
+                if (nullptr != m) {
+                    off = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(m + x)), zero);
+                    masked = _mm_add_epi64(masked, _mm_sad_epu8(_mm_andnot_si128(off, one), zero));
+                }
+                for (int32_t j = 0; j < channels; ++j) {
+                    __m128i v = _mm_loadu_si128((const __m128i *)(src + x * channels + 16 * j));
+                    if (nullptr != m) {
+                        v = _mm_andnot_si128(channels == 1 ? off : _mm_shuffle_epi8(off, shuffle[j]), v);
+                    }
+                    __m128i lo = _mm_unpacklo_epi8(v, zero);
+                    __m128i hi = _mm_unpackhi_epi8(v, zero);
+                    if (channels == 1) {
+                        acc[0] = _mm_add_epi64(acc[0], _mm_sad_epu8(v, zero));
+                        if (squares) {
+                            accSq[0] = _mm_add_epi32(accSq[0], _mm_add_epi32(_mm_madd_epi16(lo, lo), _mm_madd_epi16(hi, hi)));
+                        }
+                    } else {
+                        acc[2 * j] = _mm_add_epi16(acc[2 * j], lo);
+                        acc[2 * j + 1] = _mm_add_epi16(acc[2 * j + 1], hi);
+                        if (squares) {
+                            //! 255 * 255 still fits 16 bits
+                            __m128i sl = _mm_mullo_epi16(lo, lo);
+                            __m128i sh = _mm_mullo_epi16(hi, hi);
+                            accSq[4 * j] = _mm_add_epi32(accSq[4 * j], _mm_unpacklo_epi16(sl, zero));
+                            accSq[4 * j + 1] = _mm_add_epi32(accSq[4 * j + 1], _mm_unpackhi_epi16(sl, zero));
+                            accSq[4 * j + 2] = _mm_add_epi32(accSq[4 * j + 2], _mm_unpacklo_epi16(sh, zero));
+                            accSq[4 * j + 3] = _mm_add_epi32(accSq[4 * j + 3], _mm_unpackhi_epi16(sh, zero));
+                        }
+                    }
+                }
+            }
+            if (channels == 1) {
+                uint64_t a[2];
+                uint32_t b[4];
+                _mm_storeu_si128((__m128i *)a, acc[0]);
+                _mm_storeu_si128((__m128i *)b, accSq[0]);
+                pos[0] += (int64_t)(a[0] + a[1]);
+                posSq[0] += (int64_t)b[0] + b[1] + b[2] + b[3];
+            } else {
+                uint16_t a[16 * channels];
+                uint32_t b[16 * channels];
+                for (int32_t k = 0; k < 2 * channels; ++k) {
+                    _mm_storeu_si128((__m128i *)(a + 8 * k), acc[k]);
+                }
+                for (int32_t k = 0; k < 4 * channels; ++k) {
+                    _mm_storeu_si128((__m128i *)(b + 4 * k), accSq[k]);
+                }
+                for (int32_t p = 0; p < 16 * channels; ++p) {
+                    pos[p] += a[p];
+                    posSq[p] += b[p];
+                }
+            }
+        }
+        if (nullptr == m) {
+            count += x;
+        }
+        for (; x < width; ++x) {
+            if (nullptr != m && 0 == m[x]) {
+                continue;
+            }
+            for (int32_t c = 0; c < channels; ++c) {
+                int32_t v = src[x * channels + c];
+                pos[c] += v;
+                posSq[c] += v * v;
+            }
+            ++count;
+        }
+    }
+    for (int32_t p = 0; p < 16 * channels; ++p) {
+        s.sum[p % channels] += (double)pos[p];
+        s.sqsum[p % channels] += (double)posSq[p];
+    }
+    uint64_t n[2];
+    _mm_storeu_si128((__m128i *)n, masked);
+    s.count += count + (int64_t)(n[0] + n[1]);
+}
+
+// fp32 sums of rows [y0, y1) in double lanes, per element position of 8 pixels so that additions of
+// neighbouring vectors do not wait for each other
+template <int32_t channels, bool squares>
+static void stat_sums(
+    int32_t y0,
+    int32_t y1,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    StatSums &s)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi8(1);
+    __m128i shuffle[2 * channels];
+    for (int32_t j = 0; j < 2 * channels; ++j) {
+        shuffle[j] = stat_mask_shuffle<channels, 4>(j);
+    }
+    __m128d acc[4 * channels], accSq[4 * channels];
+    for (int32_t k = 0; k < 4 * channels; ++k) {
+        acc[k] = _mm_setzero_pd();
+        accSq[k] = _mm_setzero_pd();
+    }
+    __m128i masked = zero;
+    double tail[channels] = {0}, tailSq[channels] = {0};
+    int64_t count = 0;
+    for (int32_t y = y0; y < y1; ++y) {
+        const float *src = inData + (size_t)y * inWidthStride;
+        const uint8_t *m = nullptr != mask ? mask + (size_t)y * maskWidthStride : nullptr;
+        int32_t x = 0;
+        for (; x <= width - 8; x += 8) {
+            __m128i off = zero;
+            if (nullptr != m) {
+                //! the upper 8 bytes compare equal too but are never shuffled in or counted
+                off = _mm_cmpeq_epi8(_mm_loadl_epi64((const __m128i *)(m + x)), zero);
+                masked = _mm_add_epi64(masked, _mm_sad_epu8(_mm_andnot_si128(off, one), zero));
+            }
+            for (int32_t j = 0; j < 2 * channels; ++j) {
+                __m128 v = _mm_loadu_ps(src + x * channels + 4 * j);
+                if (nullptr != m) {
+                    v = _mm_andnot_ps(_mm_castsi128_ps(_mm_shuffle_epi8(off, shuffle[j])), v);
+                }
+                __m128d lo = _mm_cvtps_pd(v);
+                __m128d hi = _mm_cvtps_pd(_mm_movehl_ps(v, v));
+                acc[2 * j] = _mm_add_pd(acc[2 * j], lo);
+                acc[2 * j + 1] = _mm_add_pd(acc[2 * j + 1], hi);
+                if (squares) {
+                    accSq[2 * j] = _mm_add_pd(accSq[2 * j], _mm_mul_pd(lo, lo));
+                    accSq[2 * j + 1] = _mm_add_pd(accSq[2 * j + 1], _mm_mul_pd(hi, hi));
+                }
+            }
+        }
+        if (nullptr == m) {
+            count += x;
+        }
+        for (; x < width; ++x) {
+            if (nullptr != m && 0 == m[x]) {
+                continue;
+            }
+            for (int32_t c = 0; c < channels; ++c) {
+                double v = src[x * channels + c];
+                tail[c] += v;
+                tailSq[c] += v * v;
+            }
+            ++count;
+        }
+    }
+    double pos[8 * channels], posSq[8 * channels];
+    for (int32_t k = 0; k < 4 * channels; ++k) {
+        _mm_storeu_pd(pos + 2 * k, acc[k]);
+        _mm_storeu_pd(posSq + 2 * k, accSq[k]);
+    }
+    for (int32_t p = 0; p < 8 * channels; ++p) {
+        s.sum[p % channels] += pos[p];
+        s.sqsum[p % channels] += posSq[p];
+    }
+    for (int32_t c = 0; c < channels; ++c) {
+        s.sum[c] += tail[c];
+        s.sqsum[c] += tailSq[c];
+    }
+    uint64_t n[2];
+    _mm_storeu_si128((__m128i *)n, masked);
+    count += (int64_t)(n[0] + n[1]);
+    s.count += count;
+}
+
+static inline int32_t stat_bands(int32_t height, int32_t width, int32_t numThreads)
+{
+    int32_t bands = (int32_t)std::min<int64_t>((int64_t)height * width / STAT_MIN_BAND_PIXELS, height);
+    return std::max(std::min(bands, numThreads), 1);
+}
+
+// per band partial sums, added in band order so results do not depend on scheduling
+template <typename T, int32_t channels, bool squares>
+static StatSums stat_reduce(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    int32_t numThreads)
+{
+    int32_t bands = stat_bands(height, width, numThreads);
+    StatSums *partial = (StatSums *)tinycv::ScratchAlloc((uint64_t)bands * sizeof(StatSums), 64);
+    ParallelFor(bands, bands, [&](int32_t b0, int32_t b1) {
+        for (int32_t b = b0; b < b1; ++b) {
+            memset(&partial[b], 0, sizeof(StatSums));
+            int32_t y0 = (int32_t)((int64_t)height * b / bands);
+            int32_t y1 = (int32_t)((int64_t)height * (b + 1) / bands);
+            stat_sums<channels, squares>(y0, y1, width, inWidthStride, inData, maskWidthStride, mask, partial[b]);
+        }
+    });
+    StatSums s = partial[0];
+    for (int32_t b = 1; b < bands; ++b) {
+        for (int32_t c = 0; c < channels; ++c) {
+            s.sum[c] += partial[b].sum[c];
+            s.sqsum[c] += partial[b].sqsum[c];
+        }
+        s.count += partial[b].count;
+    }
+    tinycv::ScratchFree(partial);
+    return s;
+}
+
+template <typename T, int32_t channels>
+static inline bool stat_valid(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask)
+{
+    if (nullptr == inData || height <= 0 || width <= 0) {
+        return false;
+    }
+    if (inWidthStride < width * channels) {
+        return false;
+    }
+    return nullptr == mask || maskWidthStride >= width;
+}
+
+template <typename T, int32_t channels>
+void Sum(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    double *sum,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    int32_t numThreads)
+{
+    if (nullptr == sum || !stat_valid<T, channels>(height, width, inWidthStride, inData, maskWidthStride, mask)) {
+        return;
+    }
+    StatSums s = stat_reduce<T, channels, false>(height, width, inWidthStride, inData, maskWidthStride, mask, numThreads);
+    for (int32_t c = 0; c < channels; ++c) {
+        sum[c] = s.sum[c];
+    }
+}
+
+template <typename T, int32_t channels>
+void MeanStdDev(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    double *mean,
+    double *stddev,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    int32_t numThreads)
+{
+    if (nullptr == mean || !stat_valid<T, channels>(height, width, inWidthStride, inData, maskWidthStride, mask)) {
+        return;
+    }
+    StatSums s = stat_reduce<T, channels, true>(height, width, inWidthStride, inData, maskWidthStride, mask, numThreads);
+    double scale = s.count ? 1.0 / s.count : 0;
+    for (int32_t c = 0; c < channels; ++c) {
+        mean[c] = s.sum[c] * scale;
+        if (nullptr != stddev) {
+            stddev[c] = sqrt(std::max(s.sqsum[c] * scale - mean[c] * mean[c], 0.0));
+        }
+    }
+}
+
+// extrema of rows [y0, y1) where the mask is set, 255 and 0 when it is empty
+static void stat_min_max(
+    int32_t y0,
+    int32_t y1,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    uint8_t &minVal,
+    uint8_t &maxVal)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i vmin = _mm_set1_epi8((char)0xff), vmax = zero;
+    uint8_t lo = 0xff, hi = 0;
+    for (int32_t y = y0; y < y1; ++y) {
+        const uint8_t *src = inData + (size_t)y * inWidthStride;
+        const uint8_t *m = nullptr != mask ? mask + (size_t)y * maskWidthStride : nullptr;
+        int32_t x = 0;
+        for (; x <= width - 16; x += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(src + x));
+            if (nullptr != m) {
+                __m128i off = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(m + x)), zero);
+                vmin = _mm_min_epu8(vmin, _mm_or_si128(v, off));
+                vmax = _mm_max_epu8(vmax, _mm_andnot_si128(off, v));
+            } else {
+                vmin = _mm_min_epu8(vmin, v);
+                vmax = _mm_max_epu8(vmax, v);
+            }
+        }
+        for (; x < width; ++x) {
+            if (nullptr == m || m[x]) {
+                lo = std::min(lo, src[x]);
+                hi = std::max(hi, src[x]);
+            }
+        }
+    }
+    uint8_t a[16], b[16];
+    _mm_storeu_si128((__m128i *)a, vmin);
+    _mm_storeu_si128((__m128i *)b, vmax);
+    for (int32_t k = 0; k < 16; ++k) {
+        lo = std::min(lo, a[k]);
+        hi = std::max(hi, b[k]);
+    }
+    minVal = lo;
+    maxVal = hi;
+}
+
+// the same for fp32, +inf and -inf when it is empty, NaNs are skipped as min_ps returns its second operand then
+static void stat_min_max(
+    int32_t y0,
+    int32_t y1,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    float &minVal,
+    float &maxVal)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const float inf = std::numeric_limits<float>::infinity();
+    const __m128 vinf = _mm_set1_ps(inf), vninf = _mm_set1_ps(-inf);
+    __m128 vmin[2] = {vinf, vinf}, vmax[2] = {vninf, vninf};
+    float lo = inf, hi = -inf;
+    for (int32_t y = y0; y < y1; ++y) {
+        const float *src = inData + (size_t)y * inWidthStride;
+        const uint8_t *m = nullptr != mask ? mask + (size_t)y * maskWidthStride : nullptr;
+        int32_t x = 0;
+        for (; x <= width - 8; x += 8) {
+            for (int32_t j = 0; j < 2; ++j) {
+                __m128 v = _mm_loadu_ps(src + x + 4 * j);
+                if (nullptr != m) {
+                    int32_t bytes;
+                    memcpy(&bytes, m + x + 4 * j, sizeof(bytes));
+                    __m128 off = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(bytes)), zero));
+                    vmin[j] = _mm_min_ps(_mm_blendv_ps(v, vinf, off), vmin[j]);
+                    vmax[j] = _mm_max_ps(_mm_blendv_ps(v, vninf, off), vmax[j]);
+                } else {
+                    vmin[j] = _mm_min_ps(v, vmin[j]);
+                    vmax[j] = _mm_max_ps(v, vmax[j]);
+                }
+            }
+        }
+        for (; x < width; ++x) {
+            if (nullptr == m || m[x]) {
+                lo = src[x] < lo ? src[x] : lo;
+                hi = src[x] > hi ? src[x] : hi;
+            }
+        }
+    }
+    float a[4], b[4];
+    _mm_storeu_ps(a, _mm_min_ps(vmin[0], vmin[1]));
+    _mm_storeu_ps(b, _mm_max_ps(vmax[0], vmax[1]));
+    for (int32_t k = 0; k < 4; ++k) {
+        lo = std::min(lo, a[k]);
+        hi = std::max(hi, b[k]);
+    }
+    minVal = lo;
+    maxVal = hi;
+}
+
+// offset y * width + x of the first pixel of rows [y0, y1) equal to `value` where the mask is set, -1 if none
+static int64_t stat_locate(
+    int32_t y0,
+    int32_t y1,
+    int32_t width,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    uint8_t value)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i vv = _mm_set1_epi8((char)value);
+    for (int32_t y = y0; y < y1; ++y) {
+        const uint8_t *src = inData + (size_t)y * inWidthStride;
+        const uint8_t *m = nullptr != mask ? mask + (size_t)y * maskWidthStride : nullptr;
+        int32_t x = 0;
+        for (; x <= width - 16; x += 16) {
+            __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(src + x)), vv);
+            if (nullptr != m) {
+                eq = _mm_andnot_si128(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(m + x)), zero), eq);
+            }
+            int32_t bits = _mm_movemask_epi8(eq);
+            if (bits) {
+                return (int64_t)y * width + x + __builtin_ctz(bits);
+            }
+        }
+        for (; x < width; ++x) {
+            if (src[x] == value && (nullptr == m || m[x])) {
+                return (int64_t)y * width + x;
+            }
+        }
+    }
+    return -1;
+}
+
+static int64_t stat_locate(
+    int32_t y0,
+    int32_t y1,
+    int32_t width,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    float value)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 vv = _mm_set1_ps(value);
+    for (int32_t y = y0; y < y1; ++y) {
+        const float *src = inData + (size_t)y * inWidthStride;
+        const uint8_t *m = nullptr != mask ? mask + (size_t)y * maskWidthStride : nullptr;
+        int32_t x = 0;
+        for (; x <= width - 4; x += 4) {
+            __m128 eq = _mm_cmpeq_ps(_mm_loadu_ps(src + x), vv);
+            if (nullptr != m) {
+                int32_t bytes;
+                memcpy(&bytes, m + x, sizeof(bytes));
+                eq = _mm_andnot_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(bytes)), zero)), eq);
+            }
+            int32_t bits = _mm_movemask_ps(eq);
+            if (bits) {
+                return (int64_t)y * width + x + __builtin_ctz(bits);
+            }
+        }
+        for (; x < width; ++x) {
+            if (src[x] == value && (nullptr == m || m[x])) {
+                return (int64_t)y * width + x;
+            }
+        }
+    }
+    return -1;
+}
+
+template <typename T>
+void MinMaxLoc(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    T *minVal,
+    T *maxVal,
+    int32_t *minLoc,
+    int32_t *maxLoc,
+    int32_t maskWidthStride,
+    const uint8_t *mask,
+    int32_t numThreads)
+{
+    if (!stat_valid<T, 1>(height, width, inWidthStride, inData, maskWidthStride, mask)) {
+        return;
+    }
+    int32_t bands = stat_bands(height, width, numThreads);
+    uint64_t size_for_at = ((uint64_t)bands * sizeof(int64_t) + 64 - 1) / 64 * 64;
+    uint64_t size_for_val = ((uint64_t)bands * sizeof(T) + 64 - 1) / 64 * 64;
+    void *temp_buffer = tinycv::ScratchAlloc(2 * size_for_at + 2 * size_for_val, 64);
+    int64_t *bandMinAt = (int64_t *)temp_buffer;
+    int64_t *bandMaxAt = (int64_t *)((unsigned char *)bandMinAt + size_for_at);
+    T *bandMin = (T *)((unsigned char *)bandMaxAt + size_for_at);
+    T *bandMax = (T *)((unsigned char *)bandMin + size_for_val);
+    ParallelFor(bands, bands, [&](int32_t b0, int32_t b1) {
+        for (int32_t b = b0; b < b1; ++b) {
+            int32_t y0 = (int32_t)((int64_t)height * b / bands);
+            int32_t y1 = (int32_t)((int64_t)height * (b + 1) / bands);
+            stat_min_max(y0, y1, width, inWidthStride, inData, maskWidthStride, mask, bandMin[b], bandMax[b]);
+        }
+    });
+    T lo = *std::min_element(bandMin, bandMin + bands);
+    T hi = *std::max_element(bandMax, bandMax + bands);
+
+    //! the extrema are known, every band looks for their first occurrence and the first band having one wins
+    ParallelFor(bands, bands, [&](int32_t b0, int32_t b1) {
+        for (int32_t b = b0; b < b1; ++b) {
+            int32_t y0 = (int32_t)((int64_t)height * b / bands);
+            int32_t y1 = (int32_t)((int64_t)height * (b + 1) / bands);
+            bandMinAt[b] = stat_locate(y0, y1, width, inWidthStride, inData, maskWidthStride, mask, lo);
+            bandMaxAt[b] = stat_locate(y0, y1, width, inWidthStride, inData, maskWidthStride, mask, hi);
+        }
+    });
+    int64_t minAt = -1, maxAt = -1;
+    for (int32_t b = bands - 1; b >= 0; --b) {
+        minAt = bandMinAt[b] >= 0 ? bandMinAt[b] : minAt;
+        maxAt = bandMaxAt[b] >= 0 ? bandMaxAt[b] : maxAt;
+    }
+    tinycv::ScratchFree(temp_buffer);
+    if (minAt < 0 || maxAt < 0) {
+        //! nothing under the mask
+        lo = hi = 0;
+        minAt = maxAt = -1;
+    }
+    if (nullptr != minVal) {
+        *minVal = lo;
+    }
+    if (nullptr != maxVal) {
+        *maxVal = hi;
+    }
+    if (nullptr != minLoc) {
+        minLoc[0] = minAt < 0 ? -1 : (int32_t)(minAt % width);
+        minLoc[1] = minAt < 0 ? -1 : (int32_t)(minAt / width);
+    }
+    if (nullptr != maxLoc) {
+        maxLoc[0] = maxAt < 0 ? -1 : (int32_t)(maxAt % width);
+        maxLoc[1] = maxAt < 0 ? -1 : (int32_t)(maxAt / width);
+    }
+}
+
+template void Sum<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, double *sum, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void Sum<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, double *sum, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void Sum<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, double *sum, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void Sum<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, double *sum, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void Sum<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, double *sum, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void Sum<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, double *sum, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+
+template void MeanStdDev<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, double *mean, double *stddev, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void MeanStdDev<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, double *mean, double *stddev, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void MeanStdDev<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, double *mean, double *stddev, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void MeanStdDev<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, double *mean, double *stddev, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void MeanStdDev<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, double *mean, double *stddev, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void MeanStdDev<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, double *mean, double *stddev, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+
+template void MinMaxLoc<uint8_t>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, uint8_t *minVal, uint8_t *maxVal, int32_t *minLoc, int32_t *maxLoc, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+template void MinMaxLoc<float>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, float *minVal, float *maxVal, int32_t *minLoc, int32_t *maxLoc, int32_t maskWidthStride, const uint8_t *mask, int32_t numThreads);
+
+} // namespace tinycv
@@ -0,0 +1,142 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/statistics.h"
+#include "tinycv/x86/test.h"
+#include "tinycv/debug.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+#include <memory>
+
+template <typename T, int32_t nc>
+void StatisticsTest(int32_t height, int32_t width, T min, T max, bool useMask, int32_t numThreads)
+{
+    std::unique_ptr<T[]> src(new T[width * height * nc]);
+    std::unique_ptr<uint8_t[]> mask(new uint8_t[width * height]);
+    tinycv::debug::randomFill<T>(src.get(), width * height * nc, min, max);
+    tinycv::debug::randomFill<uint8_t>(mask.get(), width * height, 0, 255);
+    for (int32_t i = 0; i < width * height; ++i) {
+        mask[i] = mask[i] < 64 ? 0 : mask[i];
+    }
+    const uint8_t *m = useMask ? mask.get() : nullptr;
+
+    double sum[nc], mean[nc], stddev[nc];
+    tinycv::Sum<T, nc>(height, width, width * nc, src.get(), sum, width, m, numThreads);
+    tinycv::MeanStdDev<T, nc>(height, width, width * nc, src.get(), mean, stddev, width, m, numThreads);
+
+    cv::Mat iMat(height, width, CV_MAKETYPE(cv::DataType<T>::depth, nc), src.get());
+    cv::Mat mMat(height, width, CV_8UC1, mask.get());
+    cv::Scalar mean_opencv, stddev_opencv;
+    if (useMask) {
+        cv::meanStdDev(iMat, mean_opencv, stddev_opencv, mMat);
+    } else {
+        cv::meanStdDev(iMat, mean_opencv, stddev_opencv);
+    }
+    double count = useMask ? cv::countNonZero(mMat) : (double)width * height;
+    for (int32_t c = 0; c < nc; ++c) {
+        double tolerance = 1e-6 * (fabs(mean_opencv[c]) + 1);
+        EXPECT_NEAR(sum[c], mean_opencv[c] * count, tolerance * count);
+        EXPECT_NEAR(mean[c], mean_opencv[c], tolerance);
+        EXPECT_NEAR(stddev[c], stddev_opencv[c], 1e-6 * (stddev_opencv[c] + 1));
+    }
+    if (!useMask) {
+        cv::Scalar sum_opencv = cv::sum(iMat);
+        for (int32_t c = 0; c < nc; ++c) {
+            EXPECT_NEAR(sum[c], sum_opencv[c], 1e-9 * (fabs(sum_opencv[c]) + 1));
+        }
+    }
+
+    if (nc == 1) {
+        T minVal, maxVal;
+        int32_t minLoc[2], maxLoc[2];
+        tinycv::MinMaxLoc<T>(height, width, width, src.get(), &minVal, &maxVal, minLoc, maxLoc, width, m, numThreads);
+        double minVal_opencv, maxVal_opencv;
+        cv::Point minLoc_opencv, maxLoc_opencv;
+        if (useMask) {
+            cv::minMaxLoc(iMat, &minVal_opencv, &maxVal_opencv, &minLoc_opencv, &maxLoc_opencv, mMat);
+        } else {
+            cv::minMaxLoc(iMat, &minVal_opencv, &maxVal_opencv, &minLoc_opencv, &maxLoc_opencv);
+        }
+        EXPECT_EQ((double)minVal, minVal_opencv);
+        EXPECT_EQ((double)maxVal, maxVal_opencv);
+        EXPECT_EQ(minLoc[0], minLoc_opencv.x);
+        EXPECT_EQ(minLoc[1], minLoc_opencv.y);
+        EXPECT_EQ(maxLoc[0], maxLoc_opencv.x);
+        EXPECT_EQ(maxLoc[1], maxLoc_opencv.y);
+    }
+}
+
+TEST(STATISTICS_UINT8_C1, x86)
+{
+    StatisticsTest<uint8_t, 1>(480, 640, 0, 255, false, 1);
+    StatisticsTest<uint8_t, 1>(480, 640, 0, 255, true, 1);
+    StatisticsTest<uint8_t, 1>(1080, 1920, 0, 255, true, 4);
+    StatisticsTest<uint8_t, 1>(101, 99, 0, 255, true, 1);
+    StatisticsTest<uint8_t, 1>(3, 5, 0, 255, false, 1);
+}
+
+TEST(STATISTICS_UINT8_C3, x86)
+{
+    StatisticsTest<uint8_t, 3>(480, 640, 0, 255, false, 1);
+    StatisticsTest<uint8_t, 3>(480, 640, 0, 255, true, 4);
+    StatisticsTest<uint8_t, 3>(101, 99, 0, 255, true, 1);
+}
+
+TEST(STATISTICS_UINT8_C4, x86)
+{
+    StatisticsTest<uint8_t, 4>(480, 640, 0, 255, false, 1);
+    StatisticsTest<uint8_t, 4>(101, 99, 0, 255, true, 4);
+}
+
+TEST(STATISTICS_FLOAT_C1, x86)
+{
+    StatisticsTest<float, 1>(480, 640, -100.0f, 100.0f, false, 1);
+    StatisticsTest<float, 1>(480, 640, -100.0f, 100.0f, true, 4);
+    StatisticsTest<float, 1>(101, 99, 0.0f, 1.0f, true, 1);
+}
+
+TEST(STATISTICS_FLOAT_C3, x86)
+{
+    StatisticsTest<float, 3>(480, 640, -100.0f, 100.0f, false, 1);
+    StatisticsTest<float, 3>(101, 99, 0.0f, 1.0f, true, 4);
+}
+
+TEST(STATISTICS_FLOAT_C4, x86)
+{
+    StatisticsTest<float, 4>(480, 640, -100.0f, 100.0f, true, 1);
+    StatisticsTest<float, 4>(101, 99, 0.0f, 1.0f, false, 4);
+}
+
+TEST(STATISTICS_EMPTY_MASK, x86)
+{
+    std::unique_ptr<uint8_t[]> src(new uint8_t[64 * 64]);
+    std::unique_ptr<uint8_t[]> mask(new uint8_t[64 * 64]());
+    tinycv::debug::randomFill<uint8_t>(src.get(), 64 * 64, 0, 255);
+    double mean, stddev;
+    uint8_t minVal, maxVal;
+    int32_t minLoc[2], maxLoc[2];
+    tinycv::MeanStdDev<uint8_t, 1>(64, 64, 64, src.get(), &mean, &stddev, 64, mask.get());
+    tinycv::MinMaxLoc<uint8_t>(64, 64, 64, src.get(), &minVal, &maxVal, minLoc, maxLoc, 64, mask.get());
+    EXPECT_EQ(mean, 0.0);
+    EXPECT_EQ(stddev, 0.0);
+    EXPECT_EQ(minVal, 0);
+    EXPECT_EQ(maxVal, 0);
+    EXPECT_EQ(minLoc[0], -1);
+    EXPECT_EQ(maxLoc[1], -1);
+}
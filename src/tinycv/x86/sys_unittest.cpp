@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/sys.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+TEST(PARALLEL_FOR, x86)
+{
+    const int32_t counts[] = {1, 3, 100, 1001};
+    for (int32_t count : counts) {
+        for (int32_t threads = 0; threads <= 8; ++threads) {
+            // the ranges do not overlap, each index is written by one thread only
+            std::vector<int32_t> hits(count, 0);
+            tinycv::ParallelFor(count, threads, [&hits](int32_t begin, int32_t end) {
+                for (int32_t i = begin; i < end; ++i) {
+                    ++hits[i];
+                }
+            });
+            for (int32_t i = 0; i < count; ++i) {
+                ASSERT_EQ(1, hits[i]) << "count " << count << " threads " << threads << " index " << i;
+            }
+        }
+    }
+}
+
+TEST(PARALLEL_FOR_JOIN, x86)
+{
+    std::atomic<int32_t> done(0);
+    tinycv::ParallelFor(4, 4, [&done](int32_t begin, int32_t) {
+        if (begin != 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        ++done;
+    });
+    // the calling thread finishes first, the slower ranges were waited for before the return
+    EXPECT_EQ(4, done.load());
+}
@@ -210,6 +210,19 @@ static
     return buf[19];
 }
 
+static
+#ifndef _MSC_VER
+    __attribute__((__target__("f16c"))) __attribute__((optimize(0)))
+#endif
+    float
+    TestIsaF16C()
+{
+    __m128 xmm0 = _mm_set_ps(4.0f, 3.0f, 2.0f, 1.0f);
+    __m128i xmm1 = _mm_cvtps_ph(xmm0, _MM_FROUND_TO_NEAREST_INT);
+    xmm0 = _mm_cvtph_ps(xmm1);
+    return _mm_cvtss_f32(xmm0);
+}
+
 // About __AVX512F__ see: https://docs.microsoft.com/en-us/cpp/build/reference/arch-x64?view=vs-2019
 // AVX512 was landed in VS2017 and GCC-4.9.2
 #if (GCC_VERSION >= 40902 || _MSC_VER >= 1910)
@@ -359,6 +372,7 @@ void GetCPUInfoByCPUID(struct CpuInfo* info)
     info->isa |= (BIT_TEST(ecx, 20) ? ISA_X86_SSE42 : 0x0UL); // ISA_X86_SSE42
     info->isa |= (BIT_TEST(ecx, 28) ? ISA_X86_AVX : 0x0UL); // ISA_X86_AVX
     info->isa |= (BIT_TEST(ecx, 12) ? ISA_X86_FMA : 0x0UL); // ISA_X86_FMA
+    info->isa |= (BIT_TEST(ecx, 29) ? ISA_X86_F16C : 0x0UL); // ISA_X86_F16C
     DoCpuid(0x7, 0x0, &eax, &ebx, &ecx, &edx);
     info->isa |= (BIT_TEST(ebx, 5) ? ISA_X86_AVX2 : 0x0UL); // ISA_X86_AVX2
     info->isa |= (BIT_TEST(ebx, 16) ? ISA_X86_AVX512 : 0x0UL); // ISA_X86_AVX512
@@ -379,6 +393,9 @@ void GetCPUInfoByRun(CpuInfo* info)
     if (0 == try_run(&TestIsaFMA)) {
         info->isa |= ISA_X86_FMA;
     }
+    if (0 == try_run(&TestIsaF16C)) {
+        info->isa |= ISA_X86_F16C;
+    }
     if (0 == try_run(&TestIsaAVX)) {
         info->isa |= ISA_X86_AVX;
     }
@@ -23,6 +23,8 @@
 #include <float.h>
 #include <random>
 
+#include "tinycv/types.h"
+
 template <typename T, int32_t nc>
 inline void checkResult(const T* data1,
                         const T* data2,
@@ -89,6 +91,20 @@ inline void randomFill(T* array, size_t N)
     RandomFillImpl<T, std::is_integral<T>::value>::randomFill(array, N, std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
 }
 
+/**
+ * Fill a half precision buffer and its fp32 copy with the same random values,
+ * the fp32 copy is what gets handed to OpenCV as the reference input.
+ */
+inline void randomFillHalf(tinycv::half_t* data, float* data_f32, size_t N, float min, float max)
+{
+    std::default_random_engine eng(clock());
+    std::uniform_real_distribution<float> dis(min, max);
+    for (size_t i = 0; i < N; ++i) {
+        data[i] = tinycv::half_t(dis(eng));
+        data_f32[i] = data[i];
+    }
+}
+
 struct Size {
     int width;
     int height;
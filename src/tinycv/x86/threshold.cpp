@@ -0,0 +1,194 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "tinycv/threshold.h"
+#include "tinycv/x86/threshold.hpp"
+#include "tinycv/x86/fma/internal_fma.hpp"
+#include "tinycv/x86/sysinfo.h"
+#include "tinycv/sys.h"
+
+#include <limits.h>
+#include <immintrin.h>
+
+namespace tinycv {
+
+template <int32_t type>
+static void threshold_row(const ThresholdOpU8<type> &op, const uint8_t *src, int32_t n, uint8_t *dst)
+{
+    int32_t i = 0;
+    for (; i <= n - 32; i += 32) {
+        __m128i x0 = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i x1 = _mm_loadu_si128((const __m128i *)(src + i + 16));
+        _mm_storeu_si128((__m128i *)(dst + i), op(x0));
+        _mm_storeu_si128((__m128i *)(dst + i + 16), op(x1));
+    }
+    for (; i <= n - 16; i += 16) {
+        _mm_storeu_si128((__m128i *)(dst + i), op(_mm_loadu_si128((const __m128i *)(src + i))));
+    }
+    for (; i < n; ++i) {
+        dst[i] = op(src[i]);
+    }
+}
+
+template <int32_t type>
+static void threshold_row(const ThresholdOpF32<type> &op, const float *src, int32_t n, float *dst)
+{
+    int32_t i = 0;
+    for (; i <= n - 8; i += 8) {
+        __m128 x0 = _mm_loadu_ps(src + i);
+        __m128 x1 = _mm_loadu_ps(src + i + 4);
+        _mm_storeu_ps(dst + i, op(x0));
+        _mm_storeu_ps(dst + i + 4, op(x1));
+    }
+    for (; i < n; ++i) {
+        dst[i] = op(src[i]);
+    }
+}
+
+template <typename T, typename Op>
+static void threshold_image(
+    int32_t height,
+    int32_t length,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    int32_t type,
+    const Op &op)
+{
+    //! elements are independent, continuous images are a single long row
+    if (inWidthStride == length && outWidthStride == length && (int64_t)length * height <= INT_MAX) {
+        length *= height;
+        height = 1;
+    }
+    bool use_fma = CpuSupports(ISA_X86_FMA);
+    for (int32_t y = 0; y < height; ++y) {
+        const T *src = inData + (size_t)y * inWidthStride;
+        T *dst = outData + (size_t)y * outWidthStride;
+        int32_t i = use_fma ? fma::threshold_row_fma<T>(src, length, op.t, op.m, type, dst) : 0;
+        threshold_row(op, src + i, length - i, dst + i);
+    }
+}
+
+template <typename T, template <int32_t> class Op>
+static void threshold_dispatch(
+    int32_t height,
+    int32_t length,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    T thresh,
+    T maxval,
+    int32_t type)
+{
+    switch (type) {
+        case THRESH_BINARY:
+            threshold_image(height, length, inWidthStride, inData, outWidthStride, outData, type, Op<THRESH_BINARY>(thresh, maxval));
+            break;
+        case THRESH_BINARY_INV:
+            threshold_image(height, length, inWidthStride, inData, outWidthStride, outData, type, Op<THRESH_BINARY_INV>(thresh, maxval));
+            break;
+        case THRESH_TRUNC:
+            threshold_image(height, length, inWidthStride, inData, outWidthStride, outData, type, Op<THRESH_TRUNC>(thresh, maxval));
+            break;
+        case THRESH_TOZERO:
+            threshold_image(height, length, inWidthStride, inData, outWidthStride, outData, type, Op<THRESH_TOZERO>(thresh, maxval));
+            break;
+        case THRESH_TOZERO_INV:
+            threshold_image(height, length, inWidthStride, inData, outWidthStride, outData, type, Op<THRESH_TOZERO_INV>(thresh, maxval));
+            break;
+        default:
+            break;
+    }
+}
+
+static void threshold_kernel(
+    int32_t height,
+    int32_t length,
+    int32_t inWidthStride,
+    const uint8_t *inData,
+    int32_t outWidthStride,
+    uint8_t *outData,
+    uint8_t thresh,
+    uint8_t maxval,
+    int32_t type)
+{
+    threshold_dispatch<uint8_t, ThresholdOpU8>(height, length, inWidthStride, inData, outWidthStride, outData, thresh, maxval, type);
+}
+
+static void threshold_kernel(
+    int32_t height,
+    int32_t length,
+    int32_t inWidthStride,
+    const float *inData,
+    int32_t outWidthStride,
+    float *outData,
+    float thresh,
+    float maxval,
+    int32_t type)
+{
+    threshold_dispatch<float, ThresholdOpF32>(height, length, inWidthStride, inData, outWidthStride, outData, thresh, maxval, type);
+}
+
+static uint8_t otsu_threshold(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, uint8_t)
+{
+    return OtsuThreshold(height, width, inWidthStride, inData);
+}
+
+static float otsu_threshold(int32_t, int32_t, int32_t, const float *, float thresh)
+{
+    return thresh;
+}
+
+template <typename T, int32_t channels>
+T Threshold(
+    int32_t height,
+    int32_t width,
+    int32_t inWidthStride,
+    const T *inData,
+    int32_t outWidthStride,
+    T *outData,
+    T thresh,
+    T maxval,
+    int32_t type)
+{
+    if (nullptr == inData || nullptr == outData) {
+        return thresh;
+    }
+    if (height <= 0 || width <= 0 || inWidthStride < width * channels || outWidthStride < width * channels) {
+        return thresh;
+    }
+    int32_t mode = type & ~THRESH_OTSU;
+    if (mode < THRESH_BINARY || mode > THRESH_TOZERO_INV) {
+        return thresh;
+    }
+    if ((type & THRESH_OTSU) && channels == 1) {
+        thresh = otsu_threshold(height, width, inWidthStride, inData, thresh);
+    }
+    threshold_kernel(height, width * channels, inWidthStride, inData, outWidthStride, outData, thresh, maxval, mode);
+    return thresh;
+}
+
+template uint8_t Threshold<uint8_t, 1>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, uint8_t thresh, uint8_t maxval, int32_t type);
+template uint8_t Threshold<uint8_t, 3>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, uint8_t thresh, uint8_t maxval, int32_t type);
+template uint8_t Threshold<uint8_t, 4>(int32_t height, int32_t width, int32_t inWidthStride, const uint8_t *inData, int32_t outWidthStride, uint8_t *outData, uint8_t thresh, uint8_t maxval, int32_t type);
+template float Threshold<float, 1>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, float thresh, float maxval, int32_t type);
+template float Threshold<float, 3>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, float thresh, float maxval, int32_t type);
+template float Threshold<float, 4>(int32_t height, int32_t width, int32_t inWidthStride, const float *inData, int32_t outWidthStride, float *outData, float thresh, float maxval, int32_t type);
+
+} // namespace tinycv
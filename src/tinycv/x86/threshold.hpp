@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef __ST_TINYCV_X86_THRESHOLD_HPP_
+#define __ST_TINYCV_X86_THRESHOLD_HPP_
+
+#include "tinycv/threshold.h"
+
+#include <immintrin.h>
+
+namespace tinycv {
+
+// Per element threshold of a fixed type, for 16 u8 or 4 f32 lanes at a time and for single elements.
+// `type` is a compile time constant so every branch below folds away.
+template <int32_t type>
+struct ThresholdOpU8 {
+    ThresholdOpU8(uint8_t thresh, uint8_t maxval)
+        : t(thresh), m(maxval)
+    {
+        v_t = _mm_set1_epi8((char)thresh);
+        v_t_signed = _mm_set1_epi8((char)(thresh ^ 0x80));
+        v_m = _mm_set1_epi8((char)maxval);
+        v_sign = _mm_set1_epi8((char)0x80);
+    }
+    inline uint8_t operator()(uint8_t x) const
+    {
+        bool gt = x > t;
+        if (type == THRESH_BINARY) return gt ? m : 0;
+        if (type == THRESH_BINARY_INV) return gt ? 0 : m;
+        if (type == THRESH_TRUNC) return gt ? t : x;
+        if (type == THRESH_TOZERO) return gt ? x : 0;
+        return gt ? 0 : x;
+    }
+    inline __m128i operator()(__m128i x) const
+    {
+        if (type == THRESH_TRUNC) return _mm_min_epu8(x, v_t);
+        //! there is no unsigned byte compare, flip the sign bits and compare signed
+        __m128i gt = _mm_cmpgt_epi8(_mm_xor_si128(x, v_sign), v_t_signed);
+        if (type == THRESH_BINARY) return _mm_and_si128(gt, v_m);
+        if (type == THRESH_BINARY_INV) return _mm_andnot_si128(gt, v_m);
+        if (type == THRESH_TOZERO) return _mm_and_si128(gt, x);
+        return _mm_andnot_si128(gt, x);
+    }
+    uint8_t t, m;
+    __m128i v_t, v_t_signed, v_m, v_sign;
+};
+
+template <int32_t type>
+struct ThresholdOpF32 {
+    ThresholdOpF32(float thresh, float maxval)
+        : t(thresh), m(maxval)
+    {
+        v_t = _mm_set1_ps(thresh);
+        v_m = _mm_set1_ps(maxval);
+    }
+    inline float operator()(float x) const
+    {
+        bool gt = x > t;
+        if (type == THRESH_BINARY) return gt ? m : 0.f;
+        if (type == THRESH_BINARY_INV) return gt ? 0.f : m;
+        if (type == THRESH_TRUNC) return gt ? t : x;
+        if (type == THRESH_TOZERO) return gt ? x : 0.f;
+        return gt ? 0.f : x;
+    }
+    inline __m128 operator()(__m128 x) const
+    {
+        __m128 gt = _mm_cmpgt_ps(x, v_t);
+        if (type == THRESH_BINARY) return _mm_and_ps(gt, v_m);
+        if (type == THRESH_BINARY_INV) return _mm_andnot_ps(gt, v_m);
+        if (type == THRESH_TRUNC) return _mm_or_ps(_mm_and_ps(gt, v_t), _mm_andnot_ps(gt, x));
+        if (type == THRESH_TOZERO) return _mm_and_ps(gt, x);
+        return _mm_andnot_ps(gt, x);
+    }
+    float t, m;
+    __m128 v_t, v_m;
+};
+
+} // namespace tinycv
+
+#endif //! __ST_TINYCV_X86_THRESHOLD_HPP_